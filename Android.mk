@@ -15,6 +15,7 @@ LOCAL_SRC_FILES := \
     source/compare_win.cc       \
     source/convert.cc           \
     source/convert_argb.cc      \
+    source/convert_frame.cc     \
     source/convert_from.cc      \
     source/convert_from_argb.cc \
     source/convert_to_argb.cc   \
@@ -22,6 +22,28 @@ extern "C" {
 LIBYUV_API
 uint32_t HashDjb2(const uint8_t* src, uint64_t count, uint32_t seed);
 
+// Compute a 64 bit hash of a plane. Rows are hashed with multiple SIMD lanes
+// and may be hashed on multiple threads. Stride padding is not hashed, so the
+// result depends only on width, height, pixels and seed. Not cryptographic.
+LIBYUV_API
+uint64_t HashPlane(const uint8_t* src,
+                   int src_stride,
+                   int width,
+                   int height,
+                   uint64_t seed);
+
+// Compute a 64 bit hash of an I420 frame with HashPlane.
+LIBYUV_API
+uint64_t HashI420(const uint8_t* src_y,
+                  int src_stride_y,
+                  const uint8_t* src_u,
+                  int src_stride_u,
+                  const uint8_t* src_v,
+                  int src_stride_v,
+                  int width,
+                  int height,
+                  uint64_t seed);
+
 // Hamming Distance
 LIBYUV_API
 uint64_t ComputeHammingDistance(const uint8_t* src_a,
@@ -36,6 +58,22 @@ uint32_t ARGBDetect(const uint8_t* argb,
                     int width,
                     int height);
 
+// Returns 1 if every alpha value in an ARGB image is 255, otherwise 0.
+// An opaque image can skip alpha blending.
+LIBYUV_API
+int ARGBIsOpaque(const uint8_t* src_argb,
+                 int src_stride_argb,
+                 int width,
+                 int height);
+
+// Returns 1 if every byte of a plane has the same value, otherwise 0.
+// Useful to detect a uniform alpha plane.
+LIBYUV_API
+int PlaneIsConstant(const uint8_t* src_y,
+                    int src_stride_y,
+                    int width,
+                    int height);
+
 // Sum Square Error - used to compute Mean Square Error or PSNR.
 LIBYUV_API
 uint64_t ComputeSumSquareError(const uint8_t* src_a,
@@ -50,6 +88,105 @@ uint64_t ComputeSumSquareErrorPlane(const uint8_t* src_a,
                                     int width,
                                     int height);
 
+// Sum Square Error of 16 bit planes. Strides are in uint16_t elements. Any
+// 16 bit sample values are supported.
+LIBYUV_API
+uint64_t ComputeSumSquareErrorPlane_16(const uint16_t* src_a,
+                                       int stride_a,
+                                       const uint16_t* src_b,
+                                       int stride_b,
+                                       int width,
+                                       int height);
+
+// Compute the sum of absolute differences of each block_size x block_size
+// block of 2 planes into a grid of uint32 values with a stride of
+// dst_stride_sad elements. block_size is 8, 16 or 32. Blocks on the right
+// and bottom edges may be partial. If downscale is non-zero the planes are
+// first halved with a box filter, so each block covers 2 * block_size source
+// pixels. Returns 0 on success.
+LIBYUV_API
+int ComputeBlockSadPlane(const uint8_t* src_a,
+                         int stride_a,
+                         const uint8_t* src_b,
+                         int stride_b,
+                         uint32_t* dst_sad,
+                         int dst_stride_sad,
+                         int width,
+                         int height,
+                         int block_size,
+                         int downscale);
+
+// Compute the sum of squared errors of each block into a grid.
+// Same layout and parameters as ComputeBlockSadPlane.
+LIBYUV_API
+int ComputeBlockSsePlane(const uint8_t* src_a,
+                         int stride_a,
+                         const uint8_t* src_b,
+                         int stride_b,
+                         uint32_t* dst_sse,
+                         int dst_stride_sse,
+                         int width,
+                         int height,
+                         int block_size,
+                         int downscale);
+
+// Frame change summary produced by AnalyzeFrameChange.
+struct FrameChangeReport {
+  uint64_t sad_y;   // Sum of absolute differences of Y.
+  uint64_t sad_uv;  // Sum of absolute differences of U and V.
+  // Fraction of luma that moved between 16 histogram bins, measured on a
+  // 2x box downscaled Y, in units of 1/1024.
+  uint32_t histogram_delta;
+  int num_tiles;      // Number of tiles in the frame.
+  int changed_tiles;  // Number of tiles with any difference.
+  int is_duplicate;   // No pixel changed, so the frame can be dropped.
+  int is_scene_cut;   // histogram_delta >= kSceneCutHistogramDelta.
+};
+
+// histogram_delta at which a frame is reported as a scene cut.
+static const uint32_t kSceneCutHistogramDelta = 384;
+
+// Compare an I420 frame with the previous frame in a single pass over the
+// planes. src_u/src_v and prev_u/prev_v may be NULL to analyse luma only.
+// tile_size is 16, 32 or 64. If dst_tile_changed is not NULL it receives
+// 1 for each tile with any difference and 0 otherwise, with a stride of
+// dst_stride_tile_changed bytes. Returns 0 on success.
+LIBYUV_API
+int AnalyzeFrameChange(const uint8_t* src_y,
+                       int src_stride_y,
+                       const uint8_t* src_u,
+                       int src_stride_u,
+                       const uint8_t* src_v,
+                       int src_stride_v,
+                       const uint8_t* prev_y,
+                       int prev_stride_y,
+                       const uint8_t* prev_u,
+                       int prev_stride_u,
+                       const uint8_t* prev_v,
+                       int prev_stride_v,
+                       uint8_t* dst_tile_changed,
+                       int dst_stride_tile_changed,
+                       int width,
+                       int height,
+                       int tile_size,
+                       struct FrameChangeReport* report);
+
+// Compare 2 ARGB frames per tile_size x tile_size tile, where tile_size is
+// 16, 32 or 64, and set bit (x & 7) of byte x / 8 of each row of
+// dst_dirty_tiles for every tile that differs. Each bitmap row holds
+// (tiles_x + 7) / 8 bytes with a stride of dst_stride_dirty_tiles bytes.
+// Returns the number of dirty tiles, or -1 on invalid parameters.
+LIBYUV_API
+int ARGBDirtyTiles(const uint8_t* src_argb,
+                   int src_stride_argb,
+                   const uint8_t* prev_argb,
+                   int prev_stride_argb,
+                   uint8_t* dst_dirty_tiles,
+                   int dst_stride_dirty_tiles,
+                   int width,
+                   int height,
+                   int tile_size);
+
 static const int kMaxPsnr = 128;
 
 LIBYUV_API
@@ -79,6 +216,37 @@ double I420Psnr(const uint8_t* src_y_a,
                 int width,
                 int height);
 
+// PSNR of 10 bit I010 frames, using a peak value of 1023.
+LIBYUV_API
+double I010Psnr(const uint16_t* src_y_a,
+                int stride_y_a,
+                const uint16_t* src_u_a,
+                int stride_u_a,
+                const uint16_t* src_v_a,
+                int stride_v_a,
+                const uint16_t* src_y_b,
+                int stride_y_b,
+                const uint16_t* src_u_b,
+                int stride_u_b,
+                const uint16_t* src_v_b,
+                int stride_v_b,
+                int width,
+                int height);
+
+// PSNR of P010 frames. Samples are in the upper 10 bits, so the peak value
+// is 1023 << 6 and the result matches I010Psnr of the same frame.
+LIBYUV_API
+double P010Psnr(const uint16_t* src_y_a,
+                int stride_y_a,
+                const uint16_t* src_uv_a,
+                int stride_uv_a,
+                const uint16_t* src_y_b,
+                int stride_y_b,
+                const uint16_t* src_uv_b,
+                int stride_uv_b,
+                int width,
+                int height);
+
 LIBYUV_API
 double CalcFrameSsim(const uint8_t* src_a,
                      int stride_a,
@@ -103,6 +271,23 @@ double I420Ssim(const uint8_t* src_y_a,
                 int width,
                 int height);
 
+// SSIM of 10 bit I010 frames.
+LIBYUV_API
+double I010Ssim(const uint16_t* src_y_a,
+                int stride_y_a,
+                const uint16_t* src_u_a,
+                int stride_u_a,
+                const uint16_t* src_v_a,
+                int stride_v_a,
+                const uint16_t* src_y_b,
+                int stride_y_b,
+                const uint16_t* src_u_b,
+                int stride_u_b,
+                const uint16_t* src_v_b,
+                int stride_v_b,
+                int width,
+                int height);
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
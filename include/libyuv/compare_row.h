@@ -48,6 +48,28 @@ extern "C" {
 #endif  // clang >= 3.4
 #endif  // __clang__
 
+// GCC >= 4.7.0 required for AVX2.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#if (__GNUC__ > 4) || (__GNUC__ == 4 && (__GNUC_MINOR__ >= 7))
+#define GCC_HAS_AVX2 1
+#endif  // GNUC >= 4.7
+#endif  // __GNUC__
+
+// clang >= 7.0.0 required for AVX512.
+#if defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#if (__clang_major__ >= 7) && !defined(__APPLE__)
+#define CLANG_HAS_AVX512 1
+#endif  // clang >= 7
+#endif  // __clang__
+
+// GCC >= 8.0.0 required for AVX512 VPOPCNTDQ.
+#if defined(__GNUC__) && !defined(__clang__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#if (__GNUC__ >= 8)
+#define GCC_HAS_AVX512 1
+#endif  // GNUC >= 8
+#endif  // __GNUC__
+
 // The following are available for Visual C and GCC:
 #if !defined(LIBYUV_DISABLE_X86) && \
     (defined(__x86_64__) || defined(__i386__) || defined(_M_IX86))
@@ -67,6 +89,26 @@ extern "C" {
 // The following are available for GCC and clangcl:
 #if !defined(LIBYUV_DISABLE_X86) && (defined(__x86_64__) || defined(__i386__))
 #define HAS_HAMMINGDISTANCE_SSSE3
+#define HAS_ARGBDETECTROW_SSE2
+#define HAS_ARGBMINMAXROW_SSE2
+#define HAS_BLOCKSADROW_SSE2
+#define HAS_BLOCKSSEROW_SSE2
+#define HAS_BYTESEQUAL_SSE2
+#define HAS_HASHSTRIPES_SSE2
+#define HAS_SUMSQUAREERROR_16_SSE2
+#endif
+
+// The following are available for AVX2 gcc/clang x86 platforms:
+#if !defined(LIBYUV_DISABLE_X86) &&                \
+    (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(CLANG_HAS_AVX2) || defined(GCC_HAS_AVX2))
+#define HAS_ARGBDETECTROW_AVX2
+#define HAS_ARGBMINMAXROW_AVX2
+#define HAS_BLOCKSADROW_AVX2
+#define HAS_BLOCKSSEROW_AVX2
+#define HAS_BYTESEQUAL_AVX2
+#define HAS_HASHSTRIPES_AVX2
+#define HAS_SUMSQUAREERROR_16_AVX2
 #endif
 
 // The following are available for GCC and clangcl:
@@ -75,6 +117,14 @@ extern "C" {
 #define HAS_HAMMINGDISTANCE_AVX2
 #endif
 
+// The following are available for AVX512 gcc/clang x86 platforms:
+#if !defined(LIBYUV_DISABLE_X86) &&                \
+    (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(CLANG_HAS_AVX512) || defined(GCC_HAS_AVX512))
+#define HAS_HAMMINGDISTANCE_AVX512VPOPCNTDQ
+#define HAS_SUMSQUAREERROR_AVX512BW
+#endif
+
 // The following are available for Neon:
 #if !defined(LIBYUV_DISABLE_NEON) && \
     (defined(__ARM_NEON__) || defined(LIBYUV_NEON) || defined(__aarch64__))
@@ -82,6 +132,17 @@ extern "C" {
 #define HAS_HAMMINGDISTANCE_NEON
 #endif
 
+// The following are available for AArch64 Neon:
+#if !defined(LIBYUV_DISABLE_NEON) && defined(__aarch64__)
+#define HAS_ARGBDETECTROW_NEON
+#define HAS_ARGBMINMAXROW_NEON
+#define HAS_BLOCKSADROW_NEON
+#define HAS_BLOCKSSEROW_NEON
+#define HAS_BYTESEQUAL_NEON
+#define HAS_HASHSTRIPES_NEON
+#define HAS_SUMSQUAREERROR_16_NEON
+#endif
+
 #if !defined(LIBYUV_DISABLE_MSA) && defined(__mips_msa)
 #define HAS_HAMMINGDISTANCE_MSA
 #define HAS_SUMSQUAREERROR_MSA
@@ -99,6 +160,9 @@ uint32_t HammingDistance_SSSE3(const uint8_t* src_a,
 uint32_t HammingDistance_AVX2(const uint8_t* src_a,
                               const uint8_t* src_b,
                               int count);
+uint32_t HammingDistance_AVX512VPOPCNTDQ(const uint8_t* src_a,
+                                         const uint8_t* src_b,
+                                         int count);
 uint32_t HammingDistance_NEON(const uint8_t* src_a,
                               const uint8_t* src_b,
                               int count);
@@ -114,6 +178,9 @@ uint32_t SumSquareError_SSE2(const uint8_t* src_a,
 uint32_t SumSquareError_AVX2(const uint8_t* src_a,
                              const uint8_t* src_b,
                              int count);
+uint32_t SumSquareError_AVX512BW(const uint8_t* src_a,
+                                  const uint8_t* src_b,
+                                  int count);
 uint32_t SumSquareError_NEON(const uint8_t* src_a,
                              const uint8_t* src_b,
                              int count);
@@ -121,6 +188,101 @@ uint32_t SumSquareError_MSA(const uint8_t* src_a,
                             const uint8_t* src_b,
                             int count);
 
+// Sum of squared differences of 16 bit samples. Any 16 bit values are
+// allowed; squares are summed in 64 bits.
+uint64_t SumSquareError_16_C(const uint16_t* src_a,
+                             const uint16_t* src_b,
+                             int count);
+uint64_t SumSquareError_16_SSE2(const uint16_t* src_a,
+                                const uint16_t* src_b,
+                                int count);
+uint64_t SumSquareError_16_AVX2(const uint16_t* src_a,
+                                const uint16_t* src_b,
+                                int count);
+uint64_t SumSquareError_16_NEON(const uint16_t* src_a,
+                                const uint16_t* src_b,
+                                int count);
+
+uint32_t ARGBDetectRow_C(const uint8_t* argb, int width);
+uint32_t ARGBDetectRow_SSE2(const uint8_t* argb, int width);
+uint32_t ARGBDetectRow_AVX2(const uint8_t* argb, int width);
+uint32_t ARGBDetectRow_NEON(const uint8_t* argb, int width);
+
+// Accumulate per channel minimum into dst_minmax[0..3] and per channel
+// maximum into dst_minmax[4..7].
+void ARGBMinMaxRow_C(const uint8_t* src_argb, uint8_t* dst_minmax, int width);
+void ARGBMinMaxRow_SSE2(const uint8_t* src_argb,
+                        uint8_t* dst_minmax,
+                        int width);
+void ARGBMinMaxRow_AVX2(const uint8_t* src_argb,
+                        uint8_t* dst_minmax,
+                        int width);
+void ARGBMinMaxRow_NEON(const uint8_t* src_argb,
+                        uint8_t* dst_minmax,
+                        int width);
+
+// Accumulate the sum of absolute differences or sum of squared errors of
+// each group of 8 pixels into dst_sum[x / 8].
+void BlockSadRow_C(const uint8_t* src_a,
+                   const uint8_t* src_b,
+                   uint32_t* dst_sum,
+                   int width);
+void BlockSadRow_SSE2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width);
+void BlockSadRow_AVX2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width);
+void BlockSadRow_NEON(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width);
+void BlockSseRow_C(const uint8_t* src_a,
+                   const uint8_t* src_b,
+                   uint32_t* dst_sum,
+                   int width);
+void BlockSseRow_SSE2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width);
+void BlockSseRow_AVX2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width);
+void BlockSseRow_NEON(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width);
+
+// Returns 1 if count bytes are equal, stopping at the first difference.
+// SIMD versions require count to be a multiple of 64.
+int BytesEqual_C(const uint8_t* src_a, const uint8_t* src_b, int count);
+int BytesEqual_SSE2(const uint8_t* src_a, const uint8_t* src_b, int count);
+int BytesEqual_AVX2(const uint8_t* src_a, const uint8_t* src_b, int count);
+int BytesEqual_NEON(const uint8_t* src_a, const uint8_t* src_b, int count);
+
+// Accumulate 64 byte stripes into 8 independent 64 bit lanes. For each lane
+// acc[i] += lo32(d[i] ^ key[i]) * hi32(d[i] ^ key[i]) and acc[i ^ 1] += d[i].
+// Count must be a multiple of 64.
+void HashStripes_C(const uint8_t* src,
+                   const uint64_t* key,
+                   uint64_t* acc,
+                   int count);
+void HashStripes_SSE2(const uint8_t* src,
+                      const uint64_t* key,
+                      uint64_t* acc,
+                      int count);
+void HashStripes_AVX2(const uint8_t* src,
+                      const uint64_t* key,
+                      uint64_t* acc,
+                      int count);
+void HashStripes_NEON(const uint8_t* src,
+                      const uint64_t* key,
+                      uint64_t* acc,
+                      int count);
+
 uint32_t HashDjb2_C(const uint8_t* src, int count, uint32_t seed);
 uint32_t HashDjb2_SSE41(const uint8_t* src, int count, uint32_t seed);
 uint32_t HashDjb2_AVX2(const uint8_t* src, int count, uint32_t seed);
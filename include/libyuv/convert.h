@@ -511,6 +511,23 @@ int I010ToP010(const uint16_t* src_y,
                int width,
                int height);
 
+// Convert BT.2020 limited range I010 to BT.709 limited range NV12, tone
+// mapping HDR to SDR. See InitToneMapConstants.
+LIBYUV_API
+int I010ToNV12ToneMapped(const uint16_t* src_y,
+                         int src_stride_y,
+                         const uint16_t* src_u,
+                         int src_stride_u,
+                         const uint16_t* src_v,
+                         int src_stride_v,
+                         uint8_t* dst_y,
+                         int dst_stride_y,
+                         uint8_t* dst_uv,
+                         int dst_stride_uv,
+                         const struct ToneMapConstants* tonemap,
+                         int width,
+                         int height);
+
 // Convert I210 to P210
 LIBYUV_API
 int I210ToP210(const uint16_t* src_y,
@@ -556,6 +573,114 @@ int I212ToP212(const uint16_t* src_y,
                int width,
                int height);
 
+// Convert v210 to I210. v210 packs 6 pixels of 10 bit 4:2:2 into each 16
+// bytes; rows are usually padded to a multiple of 48 pixels (128 bytes).
+LIBYUV_API
+int V210ToI210(const uint8_t* src_v210,
+               int src_stride_v210,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_u,
+               int dst_stride_u,
+               uint16_t* dst_v,
+               int dst_stride_v,
+               int width,
+               int height);
+
+// Convert v210 to P210.
+LIBYUV_API
+int V210ToP210(const uint8_t* src_v210,
+               int src_stride_v210,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_uv,
+               int dst_stride_uv,
+               int width,
+               int height);
+
+// Convert Y210 to I210. Y210 is YUY2 with 16 bit samples holding 10 bits in
+// the msbs.
+LIBYUV_API
+int Y210ToI210(const uint16_t* src_y210,
+               int src_stride_y210,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_u,
+               int dst_stride_u,
+               uint16_t* dst_v,
+               int dst_stride_v,
+               int width,
+               int height);
+
+// Convert Y410 to I410. Y410 packs U, Y, V and 2 bit A into 32 bits; alpha
+// is dropped.
+LIBYUV_API
+int Y410ToI410(const uint8_t* src_y410,
+               int src_stride_y410,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_u,
+               int dst_stride_u,
+               uint16_t* dst_v,
+               int dst_stride_v,
+               int width,
+               int height);
+
+// Convert Bayer to I420 with bilinear demosaic.  "fourcc" is the pattern of
+// the first row: FOURCC_RGGB, FOURCC_BGGR, FOURCC_GRBG or FOURCC_GBRG.
+LIBYUV_API
+int BayerToI420(const uint8_t* src_bayer,
+                int src_stride_bayer,
+                uint8_t* dst_y,
+                int dst_stride_y,
+                uint8_t* dst_u,
+                int dst_stride_u,
+                uint8_t* dst_v,
+                int dst_stride_v,
+                int width,
+                int height,
+                uint32_t fourcc);
+
+// Convert Bayer to NV12.
+LIBYUV_API
+int BayerToNV12(const uint8_t* src_bayer,
+                int src_stride_bayer,
+                uint8_t* dst_y,
+                int dst_stride_y,
+                uint8_t* dst_uv,
+                int dst_stride_uv,
+                int width,
+                int height,
+                uint32_t fourcc);
+
+// Convert 10, 12 or 16 bit Bayer in lsbs to I420.  Stride is in samples.
+LIBYUV_API
+int Bayer16ToI420(const uint16_t* src_bayer,
+                  int src_stride_bayer,
+                  uint8_t* dst_y,
+                  int dst_stride_y,
+                  uint8_t* dst_u,
+                  int dst_stride_u,
+                  uint8_t* dst_v,
+                  int dst_stride_v,
+                  int width,
+                  int height,
+                  int depth,
+                  uint32_t fourcc);
+
+// Convert 10, 12 or 16 bit Bayer in lsbs to NV12.
+LIBYUV_API
+int Bayer16ToNV12(const uint16_t* src_bayer,
+                  int src_stride_bayer,
+                  uint8_t* dst_y,
+                  int dst_stride_y,
+                  uint8_t* dst_uv,
+                  int dst_stride_uv,
+                  int width,
+                  int height,
+                  int depth,
+                  uint32_t fourcc);
+
 // Convert I400 (grey) to I420.
 LIBYUV_API
 int I400ToI420(const uint8_t* src_y,
@@ -1037,6 +1162,31 @@ int ConvertToI420(const uint8_t* sample,
                   enum RotationMode rotation,
                   uint32_t fourcc);
 
+// Size in bytes of a frame for ConvertFrame, with planes stored one after
+// another and rows not padded. Returns -1 for unsupported fourccs.
+LIBYUV_API
+int ConvertFrameSize(uint32_t fourcc, int width, int height);
+
+// Convert a frame between any two of the fourccs ConvertFrame supports:
+// ARGB, BGRA, ABGR, RGBA, AR30, AB30, 24BG, RAW, RGBP, RGBO, R444, YUY2,
+// UYVY, I400, J400, I420, I422, I444, YV12, YV16, YV24, J420, J422, NV12,
+// NV21 and P010, and as sources only J444, H420, H422, H444, U420, U422,
+// U444, I010, H010, U010, I210, H210, U210 and P210.
+// Frames are laid out as for ConvertFrameSize. Rows are converted through
+// ARGB a strip at a time, and the conversion chosen for each source, dest
+// and size is cached. Same fourccs are copied.
+// "height" can be negative indicating a vertically flipped source.
+// Returns 0 for successful; -1 for invalid parameter.
+LIBYUV_API
+int ConvertFrame(const uint8_t* src_frame,
+                 size_t src_size,
+                 uint32_t src_fourcc,
+                 uint8_t* dst_frame,
+                 size_t dst_size,
+                 uint32_t dst_fourcc,
+                 int width,
+                 int height);
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
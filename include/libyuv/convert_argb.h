@@ -14,7 +14,7 @@
 #include "libyuv/basic_types.h"
 
 #include "libyuv/rotate.h"  // For enum RotationMode.
-#include "libyuv/scale.h"   // For enum FilterMode.
+#include "libyuv/scale.h"   // For enum FilterMode and ParallelForFunc.
 
 #ifdef __cplusplus
 namespace libyuv {
@@ -37,6 +37,56 @@ LIBYUV_API extern const struct YuvConstants kYvuF709Constants;   // BT.709 full
 LIBYUV_API extern const struct YuvConstants kYvu2020Constants;   // BT.2020
 LIBYUV_API extern const struct YuvConstants kYvuV2020Constants;  // BT.2020 full
 
+// Build conversion matrices for any YUV colour space at runtime, for use with
+// the *Matrix functions. kr and kb are the luma weights of red and blue,
+// e.g. 0.212 and 0.087 for SMPTE 240M. Ranges are code values at bit depth
+// depth (8 to 16), e.g. 64, 940, 64, 960 for limited range 10 bit, or
+// 0, 255, 0, 255 for full range 8 bit. Either output may be NULL.
+// The struct is defined in row.h. Returns -1 if the matrix does not fit the
+// fixed point format.
+LIBYUV_API
+int InitYuvConstants(struct YuvConstants* yuvconstants,
+                     struct YuvConstants* yvuconstants,
+                     float kr,
+                     float kb,
+                     int depth,
+                     int y_min,
+                     int y_max,
+                     int uv_min,
+                     int uv_max);
+
+// Same as InitYuvConstants but returns matrices owned by libyuv from a small
+// cache, so callers need not size YuvConstants. Thread safe. Returns -1 if
+// the parameters are invalid or the cache is full.
+LIBYUV_API
+int GetYuvConstants(const struct YuvConstants** yuvconstants,
+                    const struct YuvConstants** yvuconstants,
+                    float kr,
+                    float kb,
+                    int depth,
+                    int y_min,
+                    int y_max,
+                    int uv_min,
+                    int uv_max);
+
+// Convert whole frames with the *Matrix functions on num_threads threads, the
+// calling thread included, by splitting frames into bands of even rows.
+// 0 or 1 converts on the calling thread, which is the default. Output is
+// identical to serial conversion. Small frames are converted serially.
+// Not thread safe with conversions in progress; call once at startup.
+// Returns -1 if num_threads is negative or greater than 64.
+LIBYUV_API
+int SetConvertThreads(int num_threads);
+
+// Same as SetConvertThreads but bands are run by a caller provided executor,
+// which must call task for every index before returning. Frames are split
+// into at most num_bands bands. A NULL parallel_for restores the built in
+// threads.
+LIBYUV_API
+int SetConvertExecutor(ParallelForFunc parallel_for,
+                       void* executor_context,
+                       int num_bands);
+
 // Macros for end swapped destination Matrix conversions.
 // Swap UV and pass mirrored kYvuJPEGConstants matrix.
 // TODO(fbarchard): Add macro for each Matrix function.
@@ -1742,6 +1792,50 @@ int P210ToAR30Matrix(const uint16_t* src_y,
 // Convert P216 to AR30 with matrix.
 #define P216ToAR30Matrix P210ToAR30Matrix
 
+// Transfer characteristics of HDR sources for tone mapping.
+typedef enum ToneMapTransfer {
+  kToneMapPQ = 0,   // SMPTE ST 2084, as used by HDR10.
+  kToneMapHLG = 1,  // ARIB STD-B67 hybrid log-gamma.
+} ToneMapTransferEnum;
+
+// Fixed point tables for HDR to SDR tone mapping.
+// kEotf maps 10 bit R'G'B' to linear light where 65535 is the source peak.
+// kGamut holds the BT.2020 to BT.709 matrix with 14 bit fraction, as rows
+// of 8 copies: R from r, g, b, G from r, g, b, B from r, g, b, then the
+// rounding term and the largest kOetf index. Sums are shifted by 16, which
+// also drops linear light to the 14 bit kOetf index.
+// kOetf maps linear light >> 2 through the tone curve and BT.709 OETF to
+// 8 bits. It is padded so a dword gather of the last entry stays in bounds.
+struct ToneMapConstants {
+  uint32_t kEotf[1024];
+  int32_t kGamut[11 * 8];
+  uint8_t kOetf[16384 + 4];
+};
+
+// Build the tables used to tone map BT.2020 HDR to BT.709 SDR.
+// src_peak_nits is the brightest source level kept; brighter levels clip.
+// For HLG it is also the nominal display peak that sets the system gamma.
+// dst_white_nits is the source level shown as SDR white, e.g. 100 or 203.
+// Levels up to 3/4 of white are kept and brighter levels roll off to reach
+// white at src_peak_nits.
+LIBYUV_API
+int InitToneMapConstants(struct ToneMapConstants* tonemap,
+                         enum ToneMapTransfer transfer,
+                         int src_peak_nits,
+                         int dst_white_nits);
+
+// Convert BT.2020 limited range P010 to BT.709 ARGB, tone mapping HDR to SDR.
+LIBYUV_API
+int P010ToARGBToneMapped(const uint16_t* src_y,
+                         int src_stride_y,
+                         const uint16_t* src_uv,
+                         int src_stride_uv,
+                         uint8_t* dst_argb,
+                         int dst_stride_argb,
+                         const struct ToneMapConstants* tonemap,
+                         int width,
+                         int height);
+
 // Convert I420 with Alpha to preattenuated ARGB with matrix.
 LIBYUV_API
 int I420AlphaToARGBMatrix(const uint8_t* src_y,
@@ -2042,6 +2136,42 @@ int I420ToARGBMatrixFilter(const uint8_t* src_y,
                            int height,
                            enum FilterMode filter);
 
+// Convert I420 to ARGB a slice of rows at a time, as a decoder or capture
+// driver delivers them, with the same output as I420ToARGBMatrixFilter.
+// Create a slicer per frame size and filter; kFilterLinear is not supported.
+// Returns NULL for invalid parameters.
+struct I420ToARGBSlicer;
+
+LIBYUV_API
+struct I420ToARGBSlicer* I420ToARGBSlicerCreate(
+    const struct YuvConstants* yuvconstants,
+    int width,
+    int height,
+    enum FilterMode filter);
+
+LIBYUV_API
+void I420ToARGBSlicerDestroy(struct I420ToARGBSlicer* slicer);
+
+// Convert the next num_rows rows of the frame. src_y points to the first row
+// of the slice and src_u and src_v to the first chroma row not in an earlier
+// slice. Slices need not be even; rows still needed later are copied, so
+// the source may be reused once this returns. dst_argb is the whole frame.
+// Returns the number of rows of dst_argb now complete, which is at most 1
+// behind the rows received, and the whole height after the last slice, at
+// which point the slicer is ready for the next frame. Returns -1 for invalid
+// parameters or rows past the end of the frame.
+LIBYUV_API
+int I420ToARGBSliceConvert(struct I420ToARGBSlicer* slicer,
+                           const uint8_t* src_y,
+                           int src_stride_y,
+                           const uint8_t* src_u,
+                           int src_stride_u,
+                           const uint8_t* src_v,
+                           int src_stride_v,
+                           int num_rows,
+                           uint8_t* dst_argb,
+                           int dst_stride_argb);
+
 // Convert I422 to ARGB with matrix and UV filter mode.
 LIBYUV_API
 int I422ToARGBMatrixFilter(const uint8_t* src_y,
@@ -2271,6 +2401,28 @@ int P210ToAR30MatrixFilter(const uint16_t* src_y,
                            int height,
                            enum FilterMode filter);
 
+// Convert Bayer to ARGB with bilinear demosaic.  "fourcc" is the pattern
+// of the first row: FOURCC_RGGB, FOURCC_BGGR, FOURCC_GRBG or FOURCC_GBRG.
+LIBYUV_API
+int BayerToARGB(const uint8_t* src_bayer,
+                int src_stride_bayer,
+                uint8_t* dst_argb,
+                int dst_stride_argb,
+                int width,
+                int height,
+                uint32_t fourcc);
+
+// Convert 10, 12 or 16 bit Bayer in lsbs to ARGB.  Stride is in samples.
+LIBYUV_API
+int Bayer16ToARGB(const uint16_t* src_bayer,
+                  int src_stride_bayer,
+                  uint8_t* dst_argb,
+                  int dst_stride_argb,
+                  int width,
+                  int height,
+                  int depth,
+                  uint32_t fourcc);
+
 // Convert camera sample to ARGB with cropping, rotation and vertical flip.
 // "sample_size" is needed to parse MJPG.
 // "dst_stride_argb" number of bytes in a row of the dst_argb plane.
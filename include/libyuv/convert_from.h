@@ -150,6 +150,46 @@ int I420ToUYVY(const uint8_t* src_y,
                int width,
                int height);
 
+// Convert I210 to v210. A partial last group of 6 pixels repeats the last
+// pixel. Samples above 1023 are clamped.
+LIBYUV_API
+int I210ToV210(const uint16_t* src_y,
+               int src_stride_y,
+               const uint16_t* src_u,
+               int src_stride_u,
+               const uint16_t* src_v,
+               int src_stride_v,
+               uint8_t* dst_v210,
+               int dst_stride_v210,
+               int width,
+               int height);
+
+// Convert I210 to Y210.
+LIBYUV_API
+int I210ToY210(const uint16_t* src_y,
+               int src_stride_y,
+               const uint16_t* src_u,
+               int src_stride_u,
+               const uint16_t* src_v,
+               int src_stride_v,
+               uint16_t* dst_y210,
+               int dst_stride_y210,
+               int width,
+               int height);
+
+// Convert I410 to Y410 with opaque alpha.
+LIBYUV_API
+int I410ToY410(const uint16_t* src_y,
+               int src_stride_y,
+               const uint16_t* src_u,
+               int src_stride_u,
+               const uint16_t* src_v,
+               int src_stride_v,
+               uint8_t* dst_y410,
+               int dst_stride_y410,
+               int width,
+               int height);
+
 // The following are from convert_argb.h
 // DEPRECATED: The prototypes will be removed in future.  Use convert_argb.h
 
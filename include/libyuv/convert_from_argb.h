@@ -373,6 +373,38 @@ int RAWToJNV21(const uint8_t* src_raw,
                int width,
                int height);
 
+// Convert only the dirty tiles of an ARGB frame to I420, updating an existing
+// destination in place. dirty_tiles is a bitmap as produced by
+// ARGBDirtyTiles with the same tile_size of 16, 32 or 64.
+LIBYUV_API
+int ARGBToI420Tiles(const uint8_t* src_argb,
+                    int src_stride_argb,
+                    uint8_t* dst_y,
+                    int dst_stride_y,
+                    uint8_t* dst_u,
+                    int dst_stride_u,
+                    uint8_t* dst_v,
+                    int dst_stride_v,
+                    int width,
+                    int height,
+                    const uint8_t* dirty_tiles,
+                    int dirty_tiles_stride,
+                    int tile_size);
+
+// Convert only the dirty tiles of an ARGB frame to NV12 in place.
+LIBYUV_API
+int ARGBToNV12Tiles(const uint8_t* src_argb,
+                    int src_stride_argb,
+                    uint8_t* dst_y,
+                    int dst_stride_y,
+                    uint8_t* dst_uv,
+                    int dst_stride_uv,
+                    int width,
+                    int height,
+                    const uint8_t* dirty_tiles,
+                    int dirty_tiles_stride,
+                    int tile_size);
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
@@ -989,6 +989,42 @@ int ARGBBlur(const uint8_t* src_argb,
              int height,
              int radius);
 
+// Box blur a plane without a cumulative sum table.
+// Each destination pixel is the average of the (radius * 2 + 1) square of
+// source pixels around it, clipped to the image.  Memory use is a few rows
+// of width and the source is read once, top to bottom.
+// src and dst must not overlap.
+// Returns -1 if the box holds more than 2^23 pixels.
+LIBYUV_API
+int BoxBlurPlane(const uint8_t* src_y,
+                 int src_stride_y,
+                 uint8_t* dst_y,
+                 int dst_stride_y,
+                 int width,
+                 int height,
+                 int radius);
+
+// Box blur an interleaved UV plane.  width is in UV pairs.
+LIBYUV_API
+int BoxBlurUVPlane(const uint8_t* src_uv,
+                   int src_stride_uv,
+                   uint8_t* dst_uv,
+                   int dst_stride_uv,
+                   int width,
+                   int height,
+                   int radius);
+
+// Box blur an ARGB image.  Streaming alternative to ARGBBlur that needs no
+// cumulative sum table.
+LIBYUV_API
+int ARGBBoxBlur(const uint8_t* src_argb,
+                int src_stride_argb,
+                uint8_t* dst_argb,
+                int dst_stride_argb,
+                int width,
+                int height,
+                int radius);
+
 // Gaussian 5x5 blur a float plane.
 // Coefficients of 1, 4, 6, 4, 1.
 // Each destination pixel is a blur of the 5x5
@@ -1002,6 +1038,29 @@ int GaussPlane_F32(const float* src,
                    int width,
                    int height);
 
+// Gaussian blur a plane.
+// kernel_size is 5 for coefficients of 1, 4, 6, 4, 1 or 7 for
+// 1, 6, 15, 20, 15, 6, 1, applied horizontally and vertically.
+// Source edges are clamped.
+LIBYUV_API
+int GaussPlane(const uint8_t* src,
+               int src_stride,
+               uint8_t* dst,
+               int dst_stride,
+               int width,
+               int height,
+               int kernel_size);
+
+// Gaussian 5x5 blur a 16 bit plane.
+// Coefficients of 1, 4, 6, 4, 1.  Source edges are clamped.
+LIBYUV_API
+int GaussPlane_16(const uint16_t* src,
+                  int src_stride,
+                  uint16_t* dst,
+                  int dst_stride,
+                  int width,
+                  int height);
+
 // Multiply ARGB image by ARGB value.
 LIBYUV_API
 int ARGBShade(const uint8_t* src_argb,
@@ -1097,6 +1156,57 @@ void ARGBAffineRow_SSE2(const uint8_t* src_argb,
                         const float* uv_dudv,
                         int width);
 
+// Warp ARGB with an affine transform and bilinear sampling.
+// affine is 6 floats {a, b, c, d, e, f} mapping destination pixel (x, y) to
+// source (a * x + b * y + c, d * x + e * y + f).  Pixel centers are at
+// integer coordinates, and samples outside the source repeat the edge.
+LIBYUV_API
+int ARGBAffine(const uint8_t* src_argb,
+               int src_stride_argb,
+               int src_width,
+               int src_height,
+               uint8_t* dst_argb,
+               int dst_stride_argb,
+               int dst_width,
+               int dst_height,
+               const float* affine);
+
+// Warp ARGB with a perspective transform and bilinear sampling.
+// matrix is a row major 3x3 homography mapping destination pixel (x, y, 1)
+// to source (u * w, v * w, w).  Edges are handled as in ARGBAffine.
+LIBYUV_API
+int ARGBPerspective(const uint8_t* src_argb,
+                    int src_stride_argb,
+                    int src_width,
+                    int src_height,
+                    uint8_t* dst_argb,
+                    int dst_stride_argb,
+                    int dst_width,
+                    int dst_height,
+                    const float* matrix);
+
+// Warp I420 with a perspective transform and bilinear sampling.
+// matrix is as in ARGBPerspective, in luma coordinates.  Chroma uses the
+// same transform adjusted for subsampling.
+LIBYUV_API
+int I420Warp(const uint8_t* src_y,
+             int src_stride_y,
+             const uint8_t* src_u,
+             int src_stride_u,
+             const uint8_t* src_v,
+             int src_stride_v,
+             int src_width,
+             int src_height,
+             uint8_t* dst_y,
+             int dst_stride_y,
+             uint8_t* dst_u,
+             int dst_stride_u,
+             uint8_t* dst_v,
+             int dst_stride_v,
+             int dst_width,
+             int dst_height,
+             const float* matrix);
+
 // Shuffle ARGB channel order.  e.g. BGRA to ARGB.
 // shuffler is 16 bytes.
 LIBYUV_API
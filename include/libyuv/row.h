@@ -68,6 +68,14 @@ extern "C" {
 #endif  // clang >= 7
 #endif  // __clang__
 
+// gcc >= 7 required for AVX512.  Functions using zmm16 and up are built with
+// the AVX512 target, see TARGET_AVX512BW.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#if (__GNUC__ >= 7)
+#define GCC_HAS_AVX512 1
+#endif  // gcc >= 7
+#endif  // __GNUC__
+
 // Visual C 2012 required for AVX2.
 #if defined(_M_IX86) && !defined(__clang__) && defined(_MSC_VER) && \
     _MSC_VER >= 1700
@@ -285,12 +293,17 @@ extern "C" {
 #define HAS_ARGBTOAR30ROW_SSSE3
 #define HAS_ARGBTOAR64ROW_SSSE3
 #define HAS_ARGBUNATTENUATEROW_SSE2
+#define HAS_BLURCOLUMNROW_SSE2
+#define HAS_BLURSCALEROW_SSE2
 #define HAS_CONVERT16TO8ROW_SSSE3
 #define HAS_CONVERT8TO16ROW_SSE2
 #define HAS_DETILEROW_16_SSE2
 #define HAS_DETILEROW_SSE2
 #define HAS_DETILESPLITUVROW_SSSE3
 #define HAS_DETILETOYUY2_SSE2
+#define HAS_GAUSS7ROW_8_SSE2
+#define HAS_GAUSSROW_8_SSE2
+#define HAS_GAUSSROW_SSE2
 #define HAS_HALFMERGEUVROW_SSSE3
 #define HAS_I210TOAR30ROW_SSSE3
 #define HAS_I210TOARGBROW_SSSE3
@@ -318,6 +331,7 @@ extern "C" {
 #define HAS_SPLITXRGBROW_SSE2
 #define HAS_SPLITXRGBROW_SSSE3
 #define HAS_SWAPUVROW_SSSE3
+#define HAS_Y410TOI410ROW_SSE2
 #define HAS_YUY2TONVUVROW_SSE2
 #if !defined(LIBYUV_BIT_EXACT)
 #define HAS_ABGRTOUVJROW_SSSE3
@@ -326,8 +340,14 @@ extern "C" {
 #if defined(__x86_64__) || !defined(__pic__)
 // TODO(fbarchard): fix build error on android_full_debug=1
 // https://code.google.com/p/libyuv/issues/detail?id=517
+#define HAS_GAUSS7COL_8_SSSE3
+#define HAS_GAUSSCOL_8_SSSE3
+#define HAS_GAUSSCOL_SSE2
 #define HAS_I210ALPHATOARGBROW_SSSE3
+#define HAS_BAYERROWTOARGBROW_SSE2
 #define HAS_I410ALPHATOARGBROW_SSSE3
+#define HAS_V210TOI210ROW_SSSE3
+#define HAS_Y210TOI210ROW_SSSE3
 #endif
 #endif
 
@@ -340,6 +360,7 @@ extern "C" {
 #define HAS_ABGRTOAR30ROW_AVX2
 #define HAS_ABGRTOYJROW_AVX2
 #define HAS_ABGRTOYROW_AVX2
+#define HAS_AR30TOARGBTONEMAPROW_AVX2
 #define HAS_AR64TOARGBROW_AVX2
 #define HAS_ARGBATTENUATEROW_AVX2
 #define HAS_ARGBTOAB64ROW_AVX2
@@ -348,21 +369,33 @@ extern "C" {
 #define HAS_ARGBTORAWROW_AVX2
 #define HAS_ARGBTORGB24ROW_AVX2
 #define HAS_ARGBUNATTENUATEROW_AVX2
+#define HAS_ARGBWARPROW_AVX2
+#define HAS_BLURCOLUMNROW_AVX2
+#define HAS_BLURSCALEROW_AVX2
 #define HAS_CONVERT16TO8ROW_AVX2
 #define HAS_CONVERT8TO16ROW_AVX2
+#define HAS_CONVERTFP32TOFP16ROW_F16C
+#define HAS_CONVERTFP32TOINT8ROW_AVX2
 #define HAS_DETILEROW_16_AVX
 #define HAS_DIVIDEROW_16_AVX2
+#define HAS_GAUSS7ROW_8_AVX2
+#define HAS_GAUSSROW_8_AVX2
+#define HAS_GAUSSROW_AVX2
+#define HAS_GAUSSROW_F32_AVX2
 #define HAS_HALFMERGEUVROW_AVX2
 #define HAS_I210TOAR30ROW_AVX2
 #define HAS_I210TOARGBROW_AVX2
+#define HAS_I210TOY210ROW_AVX2
 #define HAS_I212TOAR30ROW_AVX2
 #define HAS_I212TOARGBROW_AVX2
 #define HAS_I400TOARGBROW_AVX2
 #define HAS_I410TOAR30ROW_AVX2
 #define HAS_I410TOARGBROW_AVX2
+#define HAS_I410TOY410ROW_AVX2
 #define HAS_I422TOAR30ROW_AVX2
 #define HAS_I422TOUYVYROW_AVX2
 #define HAS_I422TOYUY2ROW_AVX2
+#define HAS_INTERPOLATEROW_16_AVX2
 #define HAS_INTERPOLATEROW_16TO8_AVX2
 #define HAS_MERGEAR64ROW_AVX2
 #define HAS_MERGEARGB16TO8ROW_AVX2
@@ -379,11 +412,14 @@ extern "C" {
 #define HAS_P210TOARGBROW_AVX2
 #define HAS_P410TOAR30ROW_AVX2
 #define HAS_P410TOARGBROW_AVX2
+#define HAS_RAWTOFLOATROW_AVX2
 #define HAS_RGBATOYJROW_AVX2
 #define HAS_SPLITARGBROW_AVX2
 #define HAS_SPLITUVROW_16_AVX2
 #define HAS_SPLITXRGBROW_AVX2
 #define HAS_SWAPUVROW_AVX2
+#define HAS_WARPROW_AVX2
+#define HAS_Y410TOI410ROW_AVX2
 #define HAS_YUY2TONVUVROW_AVX2
 #if !defined(LIBYUV_BIT_EXACT)
 #define HAS_ABGRTOUVJROW_AVX2
@@ -393,8 +429,16 @@ extern "C" {
 #if defined(__x86_64__) || !defined(__pic__)
 // TODO(fbarchard): fix build error on android_full_debug=1
 // https://code.google.com/p/libyuv/issues/detail?id=517
+#define HAS_ARGBTORGBPLANARFLOATROW_AVX2
+#define HAS_BAYERROWTOARGBROW_AVX2
+#define HAS_GAUSS7COL_8_AVX2
+#define HAS_GAUSSCOL_8_AVX2
+#define HAS_GAUSSCOL_AVX2
+#define HAS_GAUSSCOL_F32_AVX2
 #define HAS_I210ALPHATOARGBROW_AVX2
 #define HAS_I410ALPHATOARGBROW_AVX2
+#define HAS_V210TOI210ROW_AVX2
+#define HAS_Y210TOI210ROW_AVX2
 #endif
 #endif
 
@@ -407,11 +451,18 @@ extern "C" {
 #define HAS_MERGEUVROW_AVX512BW
 #endif
 
-// The following are available for AVX512 clang x64 platforms:
+// The following are available for AVX512 clang and gcc x64 platforms:
 // TODO(fbarchard): Port to x86
 #if !defined(LIBYUV_DISABLE_X86) && defined(__x86_64__) && \
-    (defined(CLANG_HAS_AVX512))
+    (defined(CLANG_HAS_AVX512) || defined(GCC_HAS_AVX512))
+#define HAS_I210TOAR30ROW_AVX512BW
+#define HAS_I210TOARGBROW_AVX512BW
+#define HAS_I410TOAR30ROW_AVX512BW
+#define HAS_I410TOARGBROW_AVX512BW
+#define HAS_I422TOAR30ROW_AVX512BW
 #define HAS_I422TOARGBROW_AVX512BW
+#define HAS_I444TOARGBROW_AVX512BW
+#define HAS_NV12TOARGBROW_AVX512BW
 #endif
 
 // The following are available on Neon platforms:
@@ -458,6 +509,8 @@ extern "C" {
 #define HAS_DETILETOYUY2_NEON
 #define HAS_UNPACKMT2T_NEON
 #define HAS_DIVIDEROW_16_NEON
+#define HAS_GAUSSCOL_NEON
+#define HAS_GAUSSROW_NEON
 #define HAS_HALFFLOATROW_NEON
 #define HAS_HALFMERGEUVROW_NEON
 #define HAS_I400TOARGBROW_NEON
@@ -553,10 +606,28 @@ extern "C" {
 
 // The following are available on AArch64 platforms:
 #if !defined(LIBYUV_DISABLE_NEON) && defined(__aarch64__)
+#define HAS_ARGBTORGBPLANARFLOATROW_NEON
+#define HAS_ARGBWARPROW_NEON
+#define HAS_BAYERROWTOARGBROW_NEON
+#define HAS_BLURCOLUMNROW_NEON
+#define HAS_BLURSCALEROW_NEON
+#define HAS_CONVERTFP32TOFP16ROW_NEON
+#define HAS_CONVERTFP32TOINT8ROW_NEON
+#define HAS_GAUSS7COL_8_NEON
+#define HAS_GAUSS7ROW_8_NEON
+#define HAS_GAUSSCOL_8_NEON
 #define HAS_GAUSSCOL_F32_NEON
 #define HAS_GAUSSROW_F32_NEON
+#define HAS_GAUSSROW_8_NEON
+#define HAS_I210TOY210ROW_NEON
+#define HAS_I410TOY410ROW_NEON
 #define HAS_INTERPOLATEROW_16TO8_NEON
+#define HAS_RAWTOFLOATROW_NEON
 #define HAS_SCALESUMSAMPLES_NEON
+#define HAS_V210TOI210ROW_NEON
+#define HAS_WARPROW_NEON
+#define HAS_Y210TOI210ROW_NEON
+#define HAS_Y410TOI410ROW_NEON
 #endif
 #if !defined(LIBYUV_DISABLE_MSA) && defined(__mips_msa)
 #define HAS_ABGRTOUVJROW_MSA
@@ -939,6 +1010,14 @@ struct YuvConstants {
 
 #endif
 
+// Tables for AR30ToARGBToneMapRow, defined in convert_argb.h.
+struct ToneMapConstants;
+
+// Offsets into ToneMapConstants structure
+#define KTONEMAPEOTF 0
+#define KTONEMAPGAMUT 4096
+#define KTONEMAPOETF 4448
+
 #define IS_ALIGNED(p, a) (!((uintptr_t)(p) & ((a)-1)))
 
 #define align_buffer_64(var, size)                                         \
@@ -963,6 +1042,13 @@ struct YuvConstants {
 #define OMITFP __attribute__((optimize("omit-frame-pointer")))
 #endif
 
+// gcc only allows zmm16 and up in inline assembly of AVX512 functions.
+#if defined(GCC_HAS_AVX512)
+#define TARGET_AVX512BW __attribute__((target("avx512bw,avx512vl")))
+#else
+#define TARGET_AVX512BW
+#endif
+
 // NaCL macros for GCC x86 and x64.
 #if defined(__native_client__)
 #define LABELALIGN ".p2align 5\n"
@@ -2089,6 +2175,13 @@ void ARGBToUVJRow_C(const uint8_t* src_rgb,
                     uint8_t* dst_u,
                     uint8_t* dst_v,
                     int width);
+// BT.709 limited range.
+void ARGBToYHRow_C(const uint8_t* src_rgb, uint8_t* dst_y, int width);
+void ARGBToUVHRow_C(const uint8_t* src_rgb,
+                    int src_stride_rgb,
+                    uint8_t* dst_u,
+                    uint8_t* dst_v,
+                    int width);
 void ABGRToUVJRow_C(const uint8_t* src_rgb,
                     int src_stride_rgb,
                     uint8_t* dst_u,
@@ -2987,6 +3080,212 @@ void SplitUVRow_16_Any_NEON(const uint16_t* src_uv,
                             int depth,
                             int width);
 
+void V210ToI210Row_C(const uint8_t* src_v210,
+                     uint16_t* dst_y,
+                     uint16_t* dst_u,
+                     uint16_t* dst_v,
+                     int width);
+void V210ToI210Row_SSSE3(const uint8_t* src_v210,
+                         uint16_t* dst_y,
+                         uint16_t* dst_u,
+                         uint16_t* dst_v,
+                         int width);
+void V210ToI210Row_AVX2(const uint8_t* src_v210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width);
+void V210ToI210Row_NEON(const uint8_t* src_v210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width);
+void V210ToI210Row_Any_SSSE3(const uint8_t* src_v210,
+                             uint16_t* dst_y,
+                             uint16_t* dst_u,
+                             uint16_t* dst_v,
+                             int width);
+void V210ToI210Row_Any_AVX2(const uint8_t* src_v210,
+                            uint16_t* dst_y,
+                            uint16_t* dst_u,
+                            uint16_t* dst_v,
+                            int width);
+void V210ToI210Row_Any_NEON(const uint8_t* src_v210,
+                            uint16_t* dst_y,
+                            uint16_t* dst_u,
+                            uint16_t* dst_v,
+                            int width);
+void I210ToV210Row_C(const uint16_t* src_y,
+                     const uint16_t* src_u,
+                     const uint16_t* src_v,
+                     uint8_t* dst_v210,
+                     int width);
+void Y210ToI210Row_C(const uint16_t* src_y210,
+                     uint16_t* dst_y,
+                     uint16_t* dst_u,
+                     uint16_t* dst_v,
+                     int width);
+void Y210ToI210Row_SSSE3(const uint16_t* src_y210,
+                         uint16_t* dst_y,
+                         uint16_t* dst_u,
+                         uint16_t* dst_v,
+                         int width);
+void Y210ToI210Row_AVX2(const uint16_t* src_y210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width);
+void Y210ToI210Row_NEON(const uint16_t* src_y210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width);
+void Y210ToI210Row_Any_SSSE3(const uint16_t* src_y210,
+                             uint16_t* dst_y,
+                             uint16_t* dst_u,
+                             uint16_t* dst_v,
+                             int width);
+void Y210ToI210Row_Any_AVX2(const uint16_t* src_y210,
+                            uint16_t* dst_y,
+                            uint16_t* dst_u,
+                            uint16_t* dst_v,
+                            int width);
+void Y210ToI210Row_Any_NEON(const uint16_t* src_y210,
+                            uint16_t* dst_y,
+                            uint16_t* dst_u,
+                            uint16_t* dst_v,
+                            int width);
+void I210ToY210Row_C(const uint16_t* src_y,
+                     const uint16_t* src_u,
+                     const uint16_t* src_v,
+                     uint16_t* dst_y210,
+                     int width);
+void I210ToY210Row_AVX2(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint16_t* dst_y210,
+                        int width);
+void I210ToY210Row_NEON(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint16_t* dst_y210,
+                        int width);
+void I210ToY210Row_Any_AVX2(const uint16_t* src_y,
+                            const uint16_t* src_u,
+                            const uint16_t* src_v,
+                            uint16_t* dst_y210,
+                            int width);
+void I210ToY210Row_Any_NEON(const uint16_t* src_y,
+                            const uint16_t* src_u,
+                            const uint16_t* src_v,
+                            uint16_t* dst_y210,
+                            int width);
+void Y410ToI410Row_C(const uint8_t* src_y410,
+                     uint16_t* dst_y,
+                     uint16_t* dst_u,
+                     uint16_t* dst_v,
+                     int width);
+void Y410ToI410Row_SSE2(const uint8_t* src_y410,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width);
+void Y410ToI410Row_AVX2(const uint8_t* src_y410,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width);
+void Y410ToI410Row_NEON(const uint8_t* src_y410,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width);
+void Y410ToI410Row_Any_SSE2(const uint8_t* src_y410,
+                            uint16_t* dst_y,
+                            uint16_t* dst_u,
+                            uint16_t* dst_v,
+                            int width);
+void Y410ToI410Row_Any_AVX2(const uint8_t* src_y410,
+                            uint16_t* dst_y,
+                            uint16_t* dst_u,
+                            uint16_t* dst_v,
+                            int width);
+void Y410ToI410Row_Any_NEON(const uint8_t* src_y410,
+                            uint16_t* dst_y,
+                            uint16_t* dst_u,
+                            uint16_t* dst_v,
+                            int width);
+void I410ToY410Row_C(const uint16_t* src_y,
+                     const uint16_t* src_u,
+                     const uint16_t* src_v,
+                     uint8_t* dst_y410,
+                     int width);
+void I410ToY410Row_AVX2(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint8_t* dst_y410,
+                        int width);
+void I410ToY410Row_NEON(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint8_t* dst_y410,
+                        int width);
+void I410ToY410Row_Any_AVX2(const uint16_t* src_y,
+                            const uint16_t* src_u,
+                            const uint16_t* src_v,
+                            uint8_t* dst_y410,
+                            int width);
+void I410ToY410Row_Any_NEON(const uint16_t* src_y,
+                            const uint16_t* src_u,
+                            const uint16_t* src_v,
+                            uint8_t* dst_y410,
+                            int width);
+
+// Bayer demosaic of the middle row of 3 padded rows.  Layout bit 0 means the
+// R or B sample is at odd columns; bit 1 means the row holds B, not R.
+void BayerRowToARGBRow_C(const uint8_t* src_bayer0,
+                         const uint8_t* src_bayer1,
+                         const uint8_t* src_bayer2,
+                         uint8_t* dst_argb,
+                         int layout,
+                         int width);
+void BayerRowToARGBRow_SSE2(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2,
+                            uint8_t* dst_argb,
+                            int layout,
+                            int width);
+void BayerRowToARGBRow_AVX2(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2,
+                            uint8_t* dst_argb,
+                            int layout,
+                            int width);
+void BayerRowToARGBRow_NEON(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2,
+                            uint8_t* dst_argb,
+                            int layout,
+                            int width);
+void BayerRowToARGBRow_Any_SSE2(const uint8_t* src_bayer0,
+                                const uint8_t* src_bayer1,
+                                const uint8_t* src_bayer2,
+                                uint8_t* dst_argb,
+                                int layout,
+                                int width);
+void BayerRowToARGBRow_Any_AVX2(const uint8_t* src_bayer0,
+                                const uint8_t* src_bayer1,
+                                const uint8_t* src_bayer2,
+                                uint8_t* dst_argb,
+                                int layout,
+                                int width);
+void BayerRowToARGBRow_Any_NEON(const uint8_t* src_bayer0,
+                                const uint8_t* src_bayer1,
+                                const uint8_t* src_bayer2,
+                                uint8_t* dst_argb,
+                                int layout,
+                                int width);
+
 void MultiplyRow_16_C(const uint16_t* src_y,
                       uint16_t* dst_y,
                       int scale,
@@ -3311,6 +3610,20 @@ void AR30ToARGBRow_C(const uint8_t* src_ar30, uint8_t* dst_argb, int width);
 void AR30ToABGRRow_C(const uint8_t* src_ar30, uint8_t* dst_abgr, int width);
 void ARGBToAR30Row_C(const uint8_t* src_argb, uint8_t* dst_ar30, int width);
 void AR30ToAB30Row_C(const uint8_t* src_ar30, uint8_t* dst_ab30, int width);
+// Tone map 10 bit BT.2020 R'G'B' to 8 bit BT.709 R'G'B'. src_ar30 may equal
+// dst_argb.
+void AR30ToARGBToneMapRow_C(const uint8_t* src_ar30,
+                            uint8_t* dst_argb,
+                            const struct ToneMapConstants* tonemap,
+                            int width);
+void AR30ToARGBToneMapRow_AVX2(const uint8_t* src_ar30,
+                               uint8_t* dst_argb,
+                               const struct ToneMapConstants* tonemap,
+                               int width);
+void AR30ToARGBToneMapRow_Any_AVX2(const uint8_t* src_ar30,
+                                   uint8_t* dst_argb,
+                                   const struct ToneMapConstants* tonemap,
+                                   int width);
 
 void RGB24ToARGBRow_Any_SSSE3(const uint8_t* src_ptr,
                               uint8_t* dst_ptr,
@@ -3518,6 +3831,8 @@ void ARGBToAR30Row_C(const uint8_t* src_argb, uint8_t* dst_ar30, int width);
 void ARGBToAR64Row_C(const uint8_t* src_argb, uint16_t* dst_ar64, int width);
 void ARGBToAB64Row_C(const uint8_t* src_argb, uint16_t* dst_ab64, int width);
 void AR64ToARGBRow_C(const uint16_t* src_ar64, uint8_t* dst_argb, int width);
+void AR30ToAR64Row_C(const uint8_t* src_ar30, uint16_t* dst_ar64, int width);
+void AR64ToAR30Row_C(const uint16_t* src_ar64, uint8_t* dst_ar30, int width);
 void AB64ToARGBRow_C(const uint16_t* src_ab64, uint8_t* dst_argb, int width);
 void AR64ToAB64Row_C(const uint16_t* src_ar64, uint16_t* dst_ab64, int width);
 void RGBAToARGBRow_C(const uint8_t* src_rgba, uint8_t* dst_argb, int width);
@@ -3795,6 +4110,47 @@ void I422ToARGBRow_AVX512BW(const uint8_t* y_buf,
                             uint8_t* dst_argb,
                             const struct YuvConstants* yuvconstants,
                             int width);
+void I444ToARGBRow_AVX512BW(const uint8_t* y_buf,
+                            const uint8_t* u_buf,
+                            const uint8_t* v_buf,
+                            uint8_t* dst_argb,
+                            const struct YuvConstants* yuvconstants,
+                            int width);
+void I422ToAR30Row_AVX512BW(const uint8_t* y_buf,
+                            const uint8_t* u_buf,
+                            const uint8_t* v_buf,
+                            uint8_t* dst_ar30,
+                            const struct YuvConstants* yuvconstants,
+                            int width);
+void I210ToARGBRow_AVX512BW(const uint16_t* y_buf,
+                            const uint16_t* u_buf,
+                            const uint16_t* v_buf,
+                            uint8_t* dst_argb,
+                            const struct YuvConstants* yuvconstants,
+                            int width);
+void I210ToAR30Row_AVX512BW(const uint16_t* y_buf,
+                            const uint16_t* u_buf,
+                            const uint16_t* v_buf,
+                            uint8_t* dst_ar30,
+                            const struct YuvConstants* yuvconstants,
+                            int width);
+void I410ToARGBRow_AVX512BW(const uint16_t* y_buf,
+                            const uint16_t* u_buf,
+                            const uint16_t* v_buf,
+                            uint8_t* dst_argb,
+                            const struct YuvConstants* yuvconstants,
+                            int width);
+void I410ToAR30Row_AVX512BW(const uint16_t* y_buf,
+                            const uint16_t* u_buf,
+                            const uint16_t* v_buf,
+                            uint8_t* dst_ar30,
+                            const struct YuvConstants* yuvconstants,
+                            int width);
+void NV12ToARGBRow_AVX512BW(const uint8_t* y_buf,
+                            const uint8_t* uv_buf,
+                            uint8_t* dst_argb,
+                            const struct YuvConstants* yuvconstants,
+                            int width);
 void I422ToRGBARow_AVX2(const uint8_t* y_buf,
                         const uint8_t* u_buf,
                         const uint8_t* v_buf,
@@ -4154,6 +4510,47 @@ void I422ToARGBRow_Any_AVX512BW(const uint8_t* y_buf,
                                 uint8_t* dst_ptr,
                                 const struct YuvConstants* yuvconstants,
                                 int width);
+void I444ToARGBRow_Any_AVX512BW(const uint8_t* y_buf,
+                                const uint8_t* u_buf,
+                                const uint8_t* v_buf,
+                                uint8_t* dst_ptr,
+                                const struct YuvConstants* yuvconstants,
+                                int width);
+void I422ToAR30Row_Any_AVX512BW(const uint8_t* y_buf,
+                                const uint8_t* u_buf,
+                                const uint8_t* v_buf,
+                                uint8_t* dst_ptr,
+                                const struct YuvConstants* yuvconstants,
+                                int width);
+void I210ToARGBRow_Any_AVX512BW(const uint16_t* y_buf,
+                                const uint16_t* u_buf,
+                                const uint16_t* v_buf,
+                                uint8_t* dst_ptr,
+                                const struct YuvConstants* yuvconstants,
+                                int width);
+void I210ToAR30Row_Any_AVX512BW(const uint16_t* y_buf,
+                                const uint16_t* u_buf,
+                                const uint16_t* v_buf,
+                                uint8_t* dst_ptr,
+                                const struct YuvConstants* yuvconstants,
+                                int width);
+void I410ToARGBRow_Any_AVX512BW(const uint16_t* y_buf,
+                                const uint16_t* u_buf,
+                                const uint16_t* v_buf,
+                                uint8_t* dst_ptr,
+                                const struct YuvConstants* yuvconstants,
+                                int width);
+void I410ToAR30Row_Any_AVX512BW(const uint16_t* y_buf,
+                                const uint16_t* u_buf,
+                                const uint16_t* v_buf,
+                                uint8_t* dst_ptr,
+                                const struct YuvConstants* yuvconstants,
+                                int width);
+void NV12ToARGBRow_Any_AVX512BW(const uint8_t* y_buf,
+                                const uint8_t* uv_buf,
+                                uint8_t* dst_ptr,
+                                const struct YuvConstants* yuvconstants,
+                                int width);
 void I422ToRGBARow_Any_AVX2(const uint8_t* y_buf,
                             const uint8_t* u_buf,
                             const uint8_t* v_buf,
@@ -5896,6 +6293,144 @@ void ARGBAffineRow_SSE2(const uint8_t* src_argb,
                         const float* src_dudv,
                         int width);
 
+// Bilinear sample pixels at the source coordinates in src_uv (u, v pairs).
+void ARGBWarpRow_C(const uint8_t* src_argb,
+                   int src_stride_argb,
+                   int src_width,
+                   int src_height,
+                   const float* src_uv,
+                   uint8_t* dst_argb,
+                   int width);
+void ARGBWarpRow_AVX2(const uint8_t* src_argb,
+                      int src_stride_argb,
+                      int src_width,
+                      int src_height,
+                      const float* src_uv,
+                      uint8_t* dst_argb,
+                      int width);
+void ARGBWarpRow_Any_AVX2(const uint8_t* src_argb,
+                          int src_stride_argb,
+                          int src_width,
+                          int src_height,
+                          const float* src_uv,
+                          uint8_t* dst_argb,
+                          int width);
+void ARGBWarpRow_NEON(const uint8_t* src_argb,
+                      int src_stride_argb,
+                      int src_width,
+                      int src_height,
+                      const float* src_uv,
+                      uint8_t* dst_argb,
+                      int width);
+void ARGBWarpRow_Any_NEON(const uint8_t* src_argb,
+                          int src_stride_argb,
+                          int src_width,
+                          int src_height,
+                          const float* src_uv,
+                          uint8_t* dst_argb,
+                          int width);
+void WarpRow_C(const uint8_t* src,
+               int src_stride,
+               int src_width,
+               int src_height,
+               const float* src_uv,
+               uint8_t* dst,
+               int width);
+void WarpRow_AVX2(const uint8_t* src,
+                  int src_stride,
+                  int src_width,
+                  int src_height,
+                  const float* src_uv,
+                  uint8_t* dst,
+                  int width);
+void WarpRow_Any_AVX2(const uint8_t* src,
+                      int src_stride,
+                      int src_width,
+                      int src_height,
+                      const float* src_uv,
+                      uint8_t* dst,
+                      int width);
+void WarpRow_NEON(const uint8_t* src,
+                  int src_stride,
+                  int src_width,
+                  int src_height,
+                  const float* src_uv,
+                  uint8_t* dst,
+                  int width);
+void WarpRow_Any_NEON(const uint8_t* src,
+                      int src_stride,
+                      int src_width,
+                      int src_height,
+                      const float* src_uv,
+                      uint8_t* dst,
+                      int width);
+
+// Streaming box blur.  Add src_add and subtract src_sub into running sums.
+void BlurColumnRow_C(const uint8_t* src_add,
+                     const uint8_t* src_sub,
+                     int32_t* dst_sum,
+                     int width);
+void BlurColumnRow_SSE2(const uint8_t* src_add,
+                        const uint8_t* src_sub,
+                        int32_t* dst_sum,
+                        int width);
+void BlurColumnRow_AVX2(const uint8_t* src_add,
+                        const uint8_t* src_sub,
+                        int32_t* dst_sum,
+                        int width);
+void BlurColumnRow_NEON(const uint8_t* src_add,
+                        const uint8_t* src_sub,
+                        int32_t* dst_sum,
+                        int width);
+void BlurColumnRow_Any_SSE2(const uint8_t* src_add,
+                            const uint8_t* src_sub,
+                            int32_t* dst_sum,
+                            int width);
+void BlurColumnRow_Any_AVX2(const uint8_t* src_add,
+                            const uint8_t* src_sub,
+                            int32_t* dst_sum,
+                            int width);
+void BlurColumnRow_Any_NEON(const uint8_t* src_add,
+                            const uint8_t* src_sub,
+                            int32_t* dst_sum,
+                            int width);
+// Convert box sums to pixels: ((int)(sum * src_scale * scale) + 128) >> 8.
+void BlurScaleRow_C(const int32_t* src_sum,
+                    const float* src_scale,
+                    float scale,
+                    uint8_t* dst,
+                    int width);
+void BlurScaleRow_SSE2(const int32_t* src_sum,
+                       const float* src_scale,
+                       float scale,
+                       uint8_t* dst,
+                       int width);
+void BlurScaleRow_AVX2(const int32_t* src_sum,
+                       const float* src_scale,
+                       float scale,
+                       uint8_t* dst,
+                       int width);
+void BlurScaleRow_NEON(const int32_t* src_sum,
+                       const float* src_scale,
+                       float scale,
+                       uint8_t* dst,
+                       int width);
+void BlurScaleRow_Any_SSE2(const int32_t* src_sum,
+                           const float* src_scale,
+                           float scale,
+                           uint8_t* dst,
+                           int width);
+void BlurScaleRow_Any_AVX2(const int32_t* src_sum,
+                           const float* src_scale,
+                           float scale,
+                           uint8_t* dst,
+                           int width);
+void BlurScaleRow_Any_NEON(const int32_t* src_sum,
+                           const float* src_scale,
+                           float scale,
+                           uint8_t* dst,
+                           int width);
+
 // Used for I420Scale, ARGBScale, and ARGBInterpolate.
 void InterpolateRow_C(uint8_t* dst_ptr,
                       const uint8_t* src_ptr,
@@ -5973,6 +6508,16 @@ void InterpolateRow_16_Any_NEON(uint16_t* dst_ptr,
                                 ptrdiff_t src_stride,
                                 int width,
                                 int source_y_fraction);
+void InterpolateRow_16_AVX2(uint16_t* dst_ptr,
+                            const uint16_t* src_ptr,
+                            ptrdiff_t src_stride,
+                            int width,
+                            int source_y_fraction);
+void InterpolateRow_16_Any_AVX2(uint16_t* dst_ptr,
+                                const uint16_t* src_ptr,
+                                ptrdiff_t src_stride,
+                                int width,
+                                int source_y_fraction);
 
 void InterpolateRow_16To8_C(uint8_t* dst_ptr,
                             const uint16_t* src_ptr,
@@ -6252,6 +6797,76 @@ void ConvertFP16ToFP32Column_NEON(const uint16_t* src,  // fp16
 void ConvertFP32ToFP16Row_NEON(const float* src,
                                uint16_t* dst,  // fp16
                                int width);
+void ConvertFP32ToFP16Row_C(const float* src, uint16_t* dst, int width);
+void ConvertFP32ToFP16Row_F16C(const float* src, uint16_t* dst, int width);
+void ConvertFP32ToFP16Row_Any_F16C(const float* src_ptr,
+                                   uint16_t* dst_ptr,
+                                   int width);
+void ConvertFP32ToFP16Row_Any_NEON(const float* src_ptr,
+                                   uint16_t* dst_ptr,
+                                   int width);
+// Convert FP32 Floats to int8 with rounding and saturation
+void ConvertFP32ToInt8Row_C(const float* src, int8_t* dst, int width);
+void ConvertFP32ToInt8Row_AVX2(const float* src, int8_t* dst, int width);
+void ConvertFP32ToInt8Row_NEON(const float* src, int8_t* dst, int width);
+void ConvertFP32ToInt8Row_Any_AVX2(const float* src_ptr,
+                                   int8_t* dst_ptr,
+                                   int width);
+void ConvertFP32ToInt8Row_Any_NEON(const float* src_ptr,
+                                   int8_t* dst_ptr,
+                                   int width);
+// Convert ARGB or RAW to RGB floats as value * scale + bias.  scale_bias
+// holds 24 scales then 24 biases, each repeating R, G, B.
+void ARGBToRGBPlanarFloatRow_C(const uint8_t* src_argb,
+                               float* dst_r,
+                               float* dst_g,
+                               float* dst_b,
+                               const float* scale_bias,
+                               int width);
+void ARGBToRGBPlanarFloatRow_AVX2(const uint8_t* src_argb,
+                                  float* dst_r,
+                                  float* dst_g,
+                                  float* dst_b,
+                                  const float* scale_bias,
+                                  int width);
+void ARGBToRGBPlanarFloatRow_NEON(const uint8_t* src_argb,
+                                  float* dst_r,
+                                  float* dst_g,
+                                  float* dst_b,
+                                  const float* scale_bias,
+                                  int width);
+void ARGBToRGBPlanarFloatRow_Any_AVX2(const uint8_t* src_ptr,
+                                      float* dst_r,
+                                      float* dst_g,
+                                      float* dst_b,
+                                      const float* scale_bias,
+                                      int width);
+void ARGBToRGBPlanarFloatRow_Any_NEON(const uint8_t* src_ptr,
+                                      float* dst_r,
+                                      float* dst_g,
+                                      float* dst_b,
+                                      const float* scale_bias,
+                                      int width);
+void RAWToFloatRow_C(const uint8_t* src_raw,
+                     float* dst,
+                     const float* scale_bias,
+                     int width);
+void RAWToFloatRow_AVX2(const uint8_t* src_raw,
+                        float* dst,
+                        const float* scale_bias,
+                        int width);
+void RAWToFloatRow_NEON(const uint8_t* src_raw,
+                        float* dst,
+                        const float* scale_bias,
+                        int width);
+void RAWToFloatRow_Any_AVX2(const uint8_t* src_ptr,
+                            float* dst_ptr,
+                            const float* scale_bias,
+                            int width);
+void RAWToFloatRow_Any_NEON(const uint8_t* src_ptr,
+                            float* dst_ptr,
+                            const float* scale_bias,
+                            int width);
 void ARGBLumaColorTableRow_C(const uint8_t* src_argb,
                              uint8_t* dst_argb,
                              int width,
@@ -6277,6 +6892,7 @@ void ScaleSamples_C(const float* src, float* dst, float scale, int width);
 void ScaleSamples_NEON(const float* src, float* dst, float scale, int width);
 
 void GaussRow_F32_NEON(const float* src, float* dst, int width);
+void GaussRow_F32_AVX2(const float* src, float* dst, int width);
 void GaussRow_F32_C(const float* src, float* dst, int width);
 
 void GaussCol_F32_NEON(const float* src0,
@@ -6287,6 +6903,14 @@ void GaussCol_F32_NEON(const float* src0,
                        float* dst,
                        int width);
 
+void GaussCol_F32_AVX2(const float* src0,
+                       const float* src1,
+                       const float* src2,
+                       const float* src3,
+                       const float* src4,
+                       float* dst,
+                       int width);
+
 void GaussCol_F32_C(const float* src0,
                     const float* src1,
                     const float* src2,
@@ -6304,6 +6928,106 @@ void GaussCol_C(const uint16_t* src0,
                 uint32_t* dst,
                 int width);
 
+void GaussRow_SSE2(const uint32_t* src, uint16_t* dst, int width);
+void GaussRow_AVX2(const uint32_t* src, uint16_t* dst, int width);
+void GaussRow_NEON(const uint32_t* src, uint16_t* dst, int width);
+void GaussCol_SSE2(const uint16_t* src0,
+                   const uint16_t* src1,
+                   const uint16_t* src2,
+                   const uint16_t* src3,
+                   const uint16_t* src4,
+                   uint32_t* dst,
+                   int width);
+void GaussCol_AVX2(const uint16_t* src0,
+                   const uint16_t* src1,
+                   const uint16_t* src2,
+                   const uint16_t* src3,
+                   const uint16_t* src4,
+                   uint32_t* dst,
+                   int width);
+void GaussCol_NEON(const uint16_t* src0,
+                   const uint16_t* src1,
+                   const uint16_t* src2,
+                   const uint16_t* src3,
+                   const uint16_t* src4,
+                   uint32_t* dst,
+                   int width);
+
+// 8 bit Gaussian filters.  Columns sum to 16 bit and rows round back to 8.
+void GaussCol_8_C(const uint8_t* src0,
+                  const uint8_t* src1,
+                  const uint8_t* src2,
+                  const uint8_t* src3,
+                  const uint8_t* src4,
+                  uint16_t* dst,
+                  int width);
+void GaussCol_8_SSSE3(const uint8_t* src0,
+                      const uint8_t* src1,
+                      const uint8_t* src2,
+                      const uint8_t* src3,
+                      const uint8_t* src4,
+                      uint16_t* dst,
+                      int width);
+void GaussCol_8_AVX2(const uint8_t* src0,
+                     const uint8_t* src1,
+                     const uint8_t* src2,
+                     const uint8_t* src3,
+                     const uint8_t* src4,
+                     uint16_t* dst,
+                     int width);
+void GaussCol_8_NEON(const uint8_t* src0,
+                     const uint8_t* src1,
+                     const uint8_t* src2,
+                     const uint8_t* src3,
+                     const uint8_t* src4,
+                     uint16_t* dst,
+                     int width);
+void GaussRow_8_C(const uint16_t* src, uint8_t* dst, int width);
+void GaussRow_8_SSE2(const uint16_t* src, uint8_t* dst, int width);
+void GaussRow_8_AVX2(const uint16_t* src, uint8_t* dst, int width);
+void GaussRow_8_NEON(const uint16_t* src, uint8_t* dst, int width);
+// 7 tap 1, 6, 15, 20, 15, 6, 1 filters.
+void Gauss7Col_8_C(const uint8_t* src0,
+                   const uint8_t* src1,
+                   const uint8_t* src2,
+                   const uint8_t* src3,
+                   const uint8_t* src4,
+                   const uint8_t* src5,
+                   const uint8_t* src6,
+                   uint16_t* dst,
+                   int width);
+void Gauss7Col_8_SSSE3(const uint8_t* src0,
+                       const uint8_t* src1,
+                       const uint8_t* src2,
+                       const uint8_t* src3,
+                       const uint8_t* src4,
+                       const uint8_t* src5,
+                       const uint8_t* src6,
+                       uint16_t* dst,
+                       int width);
+void Gauss7Col_8_AVX2(const uint8_t* src0,
+                      const uint8_t* src1,
+                      const uint8_t* src2,
+                      const uint8_t* src3,
+                      const uint8_t* src4,
+                      const uint8_t* src5,
+                      const uint8_t* src6,
+                      uint16_t* dst,
+                      int width);
+void Gauss7Col_8_NEON(const uint8_t* src0,
+                      const uint8_t* src1,
+                      const uint8_t* src2,
+                      const uint8_t* src3,
+                      const uint8_t* src4,
+                      const uint8_t* src5,
+                      const uint8_t* src6,
+                      uint16_t* dst,
+                      int width);
+void Gauss7Row_8_C(const uint16_t* src, uint8_t* dst, int width);
+void Gauss7Row_8_SSE2(const uint16_t* src, uint8_t* dst, int width);
+void Gauss7Row_8_AVX2(const uint16_t* src, uint8_t* dst, int width);
+void Gauss7Row_8_NEON(const uint16_t* src, uint8_t* dst, int width);
+
 void ClampFloatToZero_SSE2(const float* src_x, float* dst_y, int width);
 
 #ifdef __cplusplus
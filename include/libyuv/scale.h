@@ -26,6 +26,14 @@ typedef enum FilterMode {
   kFilterBox = 3        // Highest quality.
 } FilterModeEnum;
 
+// Runs task(task_context, index) for index 0 to count - 1, possibly
+// concurrently, and returns when all have finished.  Lets callers supply
+// their own thread pool.
+typedef void (*ParallelForFunc)(void* executor_context,
+                                void (*task)(void* task_context, int index),
+                                void* task_context,
+                                int count);
+
 // Scale a YUV plane.
 LIBYUV_API
 void ScalePlane(const uint8_t* src,
@@ -38,6 +46,21 @@ void ScalePlane(const uint8_t* src,
                 int dst_height,
                 enum FilterMode filtering);
 
+// Scale a plane of sRGB encoded values, such as gray, in linear light.
+// Pixels are converted to 16 bit linear light, filtered and converted back
+// to sRGB a row at a time.  Averaging linear light keeps thumbnails of high
+// frequency content from darkening.
+LIBYUV_API
+void ScalePlaneLinearLight(const uint8_t* src,
+                           int src_stride,
+                           int src_width,
+                           int src_height,
+                           uint8_t* dst,
+                           int dst_stride,
+                           int dst_width,
+                           int dst_height,
+                           enum FilterMode filtering);
+
 LIBYUV_API
 void ScalePlane_16(const uint16_t* src,
                    int src_stride,
@@ -128,6 +151,35 @@ int I420Scale_12(const uint16_t* src_y,
                  int dst_height,
                  enum FilterMode filtering);
 
+// Scales a YUV 4:2:0 image with a full size alpha plane.
+// Y, U, V and A are scaled with the same filtering.
+// If attenuate is true, the destination Y, U and V are premultiplied by the
+// destination alpha (blended over black).
+// Returns 0 if successful.
+LIBYUV_API
+int I420AScale(const uint8_t* src_y,
+               int src_stride_y,
+               const uint8_t* src_u,
+               int src_stride_u,
+               const uint8_t* src_v,
+               int src_stride_v,
+               const uint8_t* src_a,
+               int src_stride_a,
+               int src_width,
+               int src_height,
+               uint8_t* dst_y,
+               int dst_stride_y,
+               uint8_t* dst_u,
+               int dst_stride_u,
+               uint8_t* dst_v,
+               int dst_stride_v,
+               uint8_t* dst_a,
+               int dst_stride_a,
+               int dst_width,
+               int dst_height,
+               enum FilterMode filtering,
+               int attenuate);
+
 // Scales a YUV 4:4:4 image from the src width and height to the
 // dst width and height.
 // If filtering is kFilterNone, a simple nearest-neighbor algorithm is
@@ -195,6 +247,34 @@ int I444Scale_12(const uint16_t* src_y,
                  int dst_height,
                  enum FilterMode filtering);
 
+// Scales a YUV 4:4:4 image with an alpha plane.
+// If attenuate is true, the destination Y, U and V are premultiplied by the
+// destination alpha (blended over black).
+// Returns 0 if successful.
+LIBYUV_API
+int I444AScale(const uint8_t* src_y,
+               int src_stride_y,
+               const uint8_t* src_u,
+               int src_stride_u,
+               const uint8_t* src_v,
+               int src_stride_v,
+               const uint8_t* src_a,
+               int src_stride_a,
+               int src_width,
+               int src_height,
+               uint8_t* dst_y,
+               int dst_stride_y,
+               uint8_t* dst_u,
+               int dst_stride_u,
+               uint8_t* dst_v,
+               int dst_stride_v,
+               uint8_t* dst_a,
+               int dst_stride_a,
+               int dst_width,
+               int dst_height,
+               enum FilterMode filtering,
+               int attenuate);
+
 // Scales a YUV 4:2:2 image from the src width and height to the
 // dst width and height.
 // If filtering is kFilterNone, a simple nearest-neighbor algorithm is
@@ -286,6 +366,33 @@ int NV12Scale(const uint8_t* src_y,
               int dst_height,
               enum FilterMode filtering);
 
+// Scales a packed 4:2:2 YUY2 or UYVY image from the src width and height to
+// the dst width and height.
+// Luma and chroma are filtered a row at a time without unpacking the image.
+// Returns 0 if successful.
+
+LIBYUV_API
+int YUY2Scale(const uint8_t* src_yuy2,
+              int src_stride_yuy2,
+              int src_width,
+              int src_height,
+              uint8_t* dst_yuy2,
+              int dst_stride_yuy2,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering);
+
+LIBYUV_API
+int UYVYScale(const uint8_t* src_uyvy,
+              int src_stride_uyvy,
+              int src_width,
+              int src_height,
+              uint8_t* dst_uyvy,
+              int dst_stride_uyvy,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering);
+
 #ifdef __cplusplus
 // Legacy API.  Deprecated.
 LIBYUV_API
@@ -46,6 +46,77 @@ int ARGBScaleClip(const uint8_t* src_argb,
                   int clip_height,
                   enum FilterMode filtering);
 
+// Scale an unattenuated (straight alpha) ARGB image with the color channels
+// filtered as premultiplied by alpha.  This avoids dark fringes around
+// transparent pixels and is equivalent to ARGBAttenuate, ARGBScale and
+// ARGBUnattenuate, but done a strip of rows at a time.
+LIBYUV_API
+int ARGBScalePremultiplied(const uint8_t* src_argb,
+                           int src_stride_argb,
+                           int src_width,
+                           int src_height,
+                           uint8_t* dst_argb,
+                           int dst_stride_argb,
+                           int dst_width,
+                           int dst_height,
+                           enum FilterMode filtering);
+
+// Clipped premultiplied scale.  See ARGBScaleClip and ARGBScalePremultiplied.
+LIBYUV_API
+int ARGBScaleClipPremultiplied(const uint8_t* src_argb,
+                               int src_stride_argb,
+                               int src_width,
+                               int src_height,
+                               uint8_t* dst_argb,
+                               int dst_stride_argb,
+                               int dst_width,
+                               int dst_height,
+                               int clip_x,
+                               int clip_y,
+                               int clip_width,
+                               int clip_height,
+                               enum FilterMode filtering);
+
+// Scale an sRGB encoded ARGB image in linear light.
+// Color channels are converted to 16 bit linear light, filtered and converted
+// back to sRGB a row at a time.  Alpha is filtered linearly.
+LIBYUV_API
+int ARGBScaleLinearLight(const uint8_t* src_argb,
+                         int src_stride_argb,
+                         int src_width,
+                         int src_height,
+                         uint8_t* dst_argb,
+                         int dst_stride_argb,
+                         int dst_width,
+                         int dst_height,
+                         enum FilterMode filtering);
+
+// Scale an AR64 image with 16 bits per channel.
+// Strides are in uint16_t elements.
+LIBYUV_API
+int AR64Scale(const uint16_t* src_ar64,
+              int src_stride_ar64,
+              int src_width,
+              int src_height,
+              uint16_t* dst_ar64,
+              int dst_stride_ar64,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering);
+
+// Scale an AR30 image with 10 bits per channel and 2 bit alpha.
+// Rows are unpacked to AR64, filtered and packed back.
+LIBYUV_API
+int AR30Scale(const uint8_t* src_ar30,
+              int src_stride_ar30,
+              int src_width,
+              int src_height,
+              uint8_t* dst_ar30,
+              int dst_stride_ar30,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering);
+
 // Scale with YUV conversion to ARGB and clipping.
 LIBYUV_API
 int YUVToARGBScaleClip(const uint8_t* src_y,
@@ -68,6 +139,136 @@ int YUVToARGBScaleClip(const uint8_t* src_y,
                        int clip_height,
                        enum FilterMode filtering);
 
+// Memory layouts for an RGB tensor of height x width pixels.
+typedef enum TensorLayout {
+  kTensorCHW = 0,  // Planar.  All R, then all G, then all B.
+  kTensorHWC = 1   // Interleaved.  R, G, B for each pixel.
+} TensorLayoutEnum;
+
+// Element types for an RGB tensor.
+typedef enum TensorType {
+  kTensorFloat32 = 0,
+  kTensorFloat16 = 1,  // IEEE half float, rounded to nearest even.
+  kTensorInt8 = 2      // Rounded to nearest even and saturated.
+} TensorTypeEnum;
+
+// Convert a crop of I420 to a dense RGB tensor for inference.
+// The crop is converted to RGB, scaled to dst_width x dst_height and each
+// channel normalized as value * scale[c] + bias[c], where value is 0 to 255
+// and c is R, G, B.  e.g. for mean/std normalization use
+// scale = 1 / (255 * std) and bias = -mean / std.
+// Rows are converted, scaled and normalized one at a time.
+// kFilterNone point samples; other filter modes are bilinear.
+LIBYUV_API
+int I420ToRGBTensor(const uint8_t* src_y,
+                    int src_stride_y,
+                    const uint8_t* src_u,
+                    int src_stride_u,
+                    const uint8_t* src_v,
+                    int src_stride_v,
+                    const struct YuvConstants* yuvconstants,
+                    int src_width,
+                    int src_height,
+                    int crop_x,
+                    int crop_y,
+                    int crop_width,
+                    int crop_height,
+                    void* dst_tensor,
+                    int dst_width,
+                    int dst_height,
+                    const float* scale,
+                    const float* bias,
+                    enum TensorLayout layout,
+                    enum TensorType type,
+                    enum FilterMode filtering);
+
+// Convert a crop of NV12 to a dense RGB tensor for inference.
+// See I420ToRGBTensor.
+LIBYUV_API
+int NV12ToRGBTensor(const uint8_t* src_y,
+                    int src_stride_y,
+                    const uint8_t* src_uv,
+                    int src_stride_uv,
+                    const struct YuvConstants* yuvconstants,
+                    int src_width,
+                    int src_height,
+                    int crop_x,
+                    int crop_y,
+                    int crop_width,
+                    int crop_height,
+                    void* dst_tensor,
+                    int dst_width,
+                    int dst_height,
+                    const float* scale,
+                    const float* bias,
+                    enum TensorLayout layout,
+                    enum TensorType type,
+                    enum FilterMode filtering);
+
+// A crop of the source and the destination it is scaled to.  ARGB uses
+// dst[0].  I420 uses all 3 planes, with chroma (dst_width + 1) / 2 by
+// (dst_height + 1) / 2.  An RGB tensor is dense at dst[0] and ignores
+// dst_stride.
+struct CropScaleRegion {
+  int crop_x;
+  int crop_y;
+  int crop_width;
+  int crop_height;
+  uint8_t* dst[3];
+  int dst_stride[3];
+  int dst_width;
+  int dst_height;
+};
+
+// Crop and scale many regions of one I420 or NV12 frame, as for detected
+// objects.  src_fourcc is FOURCC_I420 or FOURCC_NV12, with src_u pointing
+// to interleaved UV and src_v ignored for NV12.  dst_fourcc is FOURCC_ARGB
+// or FOURCC_I420.  Row functions and scratch memory are set up once for the
+// batch.  If parallel_for is not NULL regions are scaled by it, otherwise
+// one after another.  kFilterBox is treated as kFilterBilinear.
+// Returns 0 on success, or -1 if any region is invalid, in which case
+// nothing is written.
+LIBYUV_API
+int YUVCropScaleBatch(const uint8_t* src_y,
+                      int src_stride_y,
+                      const uint8_t* src_u,
+                      int src_stride_u,
+                      const uint8_t* src_v,
+                      int src_stride_v,
+                      uint32_t src_fourcc,
+                      const struct YuvConstants* yuvconstants,
+                      int src_width,
+                      int src_height,
+                      const struct CropScaleRegion* regions,
+                      int num_regions,
+                      uint32_t dst_fourcc,
+                      enum FilterMode filtering,
+                      ParallelForFunc parallel_for,
+                      void* executor_context);
+
+// Crop and scale many regions of one I420 or NV12 frame to RGB tensors.
+// See YUVCropScaleBatch for the source and I420ToRGBTensor for the tensor.
+LIBYUV_API
+int YUVCropScaleBatchToRGBTensor(const uint8_t* src_y,
+                                 int src_stride_y,
+                                 const uint8_t* src_u,
+                                 int src_stride_u,
+                                 const uint8_t* src_v,
+                                 int src_stride_v,
+                                 uint32_t src_fourcc,
+                                 const struct YuvConstants* yuvconstants,
+                                 int src_width,
+                                 int src_height,
+                                 const struct CropScaleRegion* regions,
+                                 int num_regions,
+                                 const float* scale,
+                                 const float* bias,
+                                 enum TensorLayout layout,
+                                 enum TensorType type,
+                                 enum FilterMode filtering,
+                                 ParallelForFunc parallel_for,
+                                 void* executor_context);
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
@@ -110,6 +110,7 @@ extern "C" {
 #define HAS_SCALEUVROWUP2_BILINEAR_AVX2
 #define HAS_SCALEUVROWUP2_LINEAR_16_AVX2
 #define HAS_SCALEUVROWUP2_BILINEAR_16_AVX2
+#define HAS_SCALEADDROW_16_AVX2
 #endif
 
 // The following are available on all x86 platforms, but
@@ -260,6 +261,38 @@ void ScalePlaneDown2_16To8(int src_width,
                            int scale,
                            enum FilterMode filtering);
 
+// Scale a plane (bpp 1) or ARGB (bpp 4) through a 16 bit per channel
+// intermediate.  Rows are converted with ToRow16 and FromRow16, where NULL
+// means the source or destination is already 16 bit.  Strides are in bytes.
+void ScaleConvert_16(int src_width,
+                     int src_height,
+                     int dst_width,
+                     int dst_height,
+                     int src_stride,
+                     int dst_stride,
+                     const uint8_t* src_ptr,
+                     uint8_t* dst_ptr,
+                     int bpp,
+                     enum FilterMode filtering,
+                     void (*ToRow16)(const uint8_t* src_ptr,
+                                     uint16_t* dst_ptr,
+                                     int width),
+                     void (*FromRow16)(const uint16_t* src_ptr,
+                                       uint8_t* dst_ptr,
+                                       int width));
+
+// Scale sRGB encoded plane (bpp 1) or ARGB (bpp 4) in linear light.
+void ScaleLinearLight(int src_width,
+                      int src_height,
+                      int dst_width,
+                      int dst_height,
+                      int src_stride,
+                      int dst_stride,
+                      const uint8_t* src_ptr,
+                      uint8_t* dst_ptr,
+                      int bpp,
+                      enum FilterMode filtering);
+
 // Simplify the filtering based on scale factors.
 enum FilterMode ScaleFilterReduce(int src_width,
                                   int src_height,
@@ -469,6 +502,24 @@ void ScaleFilterCols64_16_C(uint16_t* dst_ptr,
                             int dst_width,
                             int x32,
                             int dx);
+void ScaleAR64Cols_C(uint16_t* dst_ar64,
+                     const uint16_t* src_ar64,
+                     int dst_width,
+                     int x32,
+                     int dx);
+void ScaleAR64FilterCols_C(uint16_t* dst_ar64,
+                           const uint16_t* src_ar64,
+                           int dst_width,
+                           int x32,
+                           int dx);
+void SRGBToLinearRow_C(const uint8_t* src_y, uint16_t* dst_y, int width);
+void LinearToSRGBRow_C(const uint16_t* src_y, uint8_t* dst_y, int width);
+void ARGBSRGBToLinearRow_C(const uint8_t* src_argb,
+                           uint16_t* dst_ar64,
+                           int width);
+void ARGBLinearToSRGBRow_C(const uint16_t* src_ar64,
+                           uint8_t* dst_argb,
+                           int width);
 void ScaleRowDown38_C(const uint8_t* src_ptr,
                       ptrdiff_t src_stride,
                       uint8_t* dst,
@@ -888,6 +939,12 @@ void ScaleAddRow_Any_SSE2(const uint8_t* src_ptr,
 void ScaleAddRow_Any_AVX2(const uint8_t* src_ptr,
                           uint16_t* dst_ptr,
                           int src_width);
+void ScaleAddRow_16_AVX2(const uint16_t* src_ptr,
+                         uint32_t* dst_ptr,
+                         int src_width);
+void ScaleAddRow_16_Any_AVX2(const uint16_t* src_ptr,
+                             uint32_t* dst_ptr,
+                             int src_width);
 
 void ScaleFilterCols_SSSE3(uint8_t* dst_ptr,
                            const uint8_t* src_ptr,
@@ -80,6 +80,12 @@ enum FourCC {
   FOURCC_RGBO = FOURCC('R', 'G', 'B', 'O'),  // argb1555 LE.
   FOURCC_R444 = FOURCC('R', '4', '4', '4'),  // argb4444 LE.
 
+  // 4 Bayer formats, named for the first 2 pixels of the first 2 rows.
+  FOURCC_RGGB = FOURCC('R', 'G', 'G', 'B'),
+  FOURCC_BGGR = FOURCC('B', 'G', 'G', 'R'),
+  FOURCC_GRBG = FOURCC('G', 'R', 'B', 'G'),
+  FOURCC_GBRG = FOURCC('G', 'B', 'R', 'G'),
+
   // 1 Primary Compressed YUV format.
   FOURCC_MJPG = FOURCC('M', 'J', 'P', 'G'),
 
@@ -113,6 +119,9 @@ enum FourCC {
   FOURCC_U210 = FOURCC('U', '2', '1', '0'),  // bt.2020 10 bit 422
   FOURCC_P010 = FOURCC('P', '0', '1', '0'),
   FOURCC_P210 = FOURCC('P', '2', '1', '0'),
+  FOURCC_V210 = FOURCC('v', '2', '1', '0'),  // 10 bit 422 packed 6 per 16 bytes
+  FOURCC_Y210 = FOURCC('Y', '2', '1', '0'),  // 10 bit 422 YUY2 of 16 bit
+  FOURCC_Y410 = FOURCC('Y', '4', '1', '0'),  // 10 bit 444 packed 2101010
 
   // 14 Auxiliary aliases.  CanonicalFourCC() maps these to canonical fourcc.
   FOURCC_IYUV = FOURCC('I', 'Y', 'U', 'V'),  // Alias for I420.
@@ -136,10 +145,6 @@ enum FourCC {
   // deprecated formats.  Not supported, but defined for backward compatibility.
   FOURCC_I411 = FOURCC('I', '4', '1', '1'),
   FOURCC_Q420 = FOURCC('Q', '4', '2', '0'),
-  FOURCC_RGGB = FOURCC('R', 'G', 'G', 'B'),
-  FOURCC_BGGR = FOURCC('B', 'G', 'G', 'R'),
-  FOURCC_GRBG = FOURCC('G', 'R', 'B', 'G'),
-  FOURCC_GBRG = FOURCC('G', 'B', 'R', 'G'),
   FOURCC_H264 = FOURCC('H', '2', '6', '4'),
 
   // Match any fourcc.
@@ -190,6 +195,9 @@ enum FourCCBpp {
   FOURCC_BPP_H210 = 20,
   FOURCC_BPP_P010 = 15,
   FOURCC_BPP_P210 = 20,
+  FOURCC_BPP_V210 = 22,  // 21.33 rounded up.
+  FOURCC_BPP_Y210 = 32,
+  FOURCC_BPP_Y410 = 32,
   FOURCC_BPP_MJPG = 0,  // 0 means unknown.
   FOURCC_BPP_H264 = 0,
   FOURCC_BPP_IYUV = 12,
@@ -19,6 +19,7 @@ LOCAL_OBJ_FILES := \
 	source/compare_win.o       \
 	source/convert.o           \
 	source/convert_argb.o      \
+	source/convert_frame.o     \
 	source/convert_from.o      \
 	source/convert_from_argb.o \
 	source/convert_jpeg.o      \
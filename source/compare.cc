@@ -12,6 +12,7 @@
 
 #include <float.h>
 #include <math.h>
+#include <string.h>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -20,6 +21,7 @@
 #include "libyuv/compare_row.h"
 #include "libyuv/cpu_id.h"
 #include "libyuv/row.h"
+#include "libyuv/scale_row.h"
 #include "libyuv/video_common.h"
 
 #ifdef __cplusplus
@@ -63,32 +65,121 @@ uint32_t HashDjb2(const uint8_t* src, uint64_t count, uint32_t seed) {
   return seed;
 }
 
-static uint32_t ARGBDetectRow_C(const uint8_t* argb, int width) {
-  int x;
-  for (x = 0; x < width - 1; x += 2) {
-    if (argb[0] != 255) {  // First byte is not Alpha of 255, so not ARGB.
-      return FOURCC_BGRA;
-    }
-    if (argb[3] != 255) {  // Fourth byte is not Alpha of 255, so not BGRA.
-      return FOURCC_ARGB;
-    }
-    if (argb[4] != 255) {  // Second pixel first byte is not Alpha of 255.
-      return FOURCC_BGRA;
-    }
-    if (argb[7] != 255) {  // Second pixel fourth byte is not Alpha of 255.
-      return FOURCC_ARGB;
-    }
-    argb += 8;
+// Lane keys for HashStripes used by HashPlane.
+static const uint64_t kHashPlaneKey[8] = {
+    0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL,
+    0x1f67b3b7a4a44072ULL, 0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL,
+    0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL};
+
+// 64 bit finalizer from MurmurHash3.
+static uint64_t HashMix64(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// Hash one row. The partial stripe at the end of the row is zero padded.
+static uint64_t HashPlaneRow(void (*HashStripes)(const uint8_t* src,
+                                                 const uint64_t* key,
+                                                 uint64_t* acc,
+                                                 int count),
+                             const uint8_t* src,
+                             int width,
+                             uint64_t seed) {
+  uint64_t acc[8];
+  uint64_t hash = (uint64_t)width * 0x9e3779b97f4a7c15ULL;
+  int stripes = width & ~63;
+  int i;
+  for (i = 0; i < 8; ++i) {
+    acc[i] = kHashPlaneKey[i] + seed;
   }
-  if (width & 1) {
-    if (argb[0] != 255) {  // First byte is not Alpha of 255, so not ARGB.
-      return FOURCC_BGRA;
-    }
-    if (argb[3] != 255) {  // 4th byte is not Alpha of 255, so not BGRA.
-      return FOURCC_ARGB;
-    }
+  if (stripes > 0) {
+    HashStripes(src, kHashPlaneKey, acc, stripes);
   }
-  return 0;
+  if (width > stripes) {
+    SIMD_ALIGNED(uint8_t tail[64]);
+    memset(tail, 0, sizeof(tail));
+    memcpy(tail, src + stripes, width - stripes);
+    HashStripes_C(tail, kHashPlaneKey, acc, 64);
+  }
+  for (i = 0; i < 8; ++i) {
+    hash = HashMix64(hash ^ acc[i]);
+  }
+  return hash;
+}
+
+// Rows are hashed independently and combined with their row index, so rows
+// may be hashed in parallel.
+LIBYUV_API
+uint64_t HashPlane(const uint8_t* src,
+                   int src_stride,
+                   int width,
+                   int height,
+                   uint64_t seed) {
+  int y;
+  uint64_t sum = 0;
+  void (*HashStripes)(const uint8_t* src, const uint64_t* key, uint64_t* acc,
+                      int count) = HashStripes_C;
+  if (!src || width <= 0 || height == 0) {
+    return 0;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src = src + (height - 1) * (intptr_t)src_stride;
+    src_stride = -src_stride;
+  }
+#if defined(HAS_HASHSTRIPES_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    HashStripes = HashStripes_SSE2;
+  }
+#endif
+#if defined(HAS_HASHSTRIPES_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    HashStripes = HashStripes_AVX2;
+  }
+#endif
+#if defined(HAS_HASHSTRIPES_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    HashStripes = HashStripes_NEON;
+  }
+#endif
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : sum)
+#endif
+  for (y = 0; y < height; ++y) {
+    uint64_t row = HashPlaneRow(HashStripes, src + y * (intptr_t)src_stride,
+                                width, seed);
+    sum += HashMix64(row + (uint64_t)y * 0xc2b2ae3d27d4eb4fULL);
+  }
+  return HashMix64(sum ^ ((uint64_t)height << 32) ^ seed);
+}
+
+LIBYUV_API
+uint64_t HashI420(const uint8_t* src_y,
+                  int src_stride_y,
+                  const uint8_t* src_u,
+                  int src_stride_u,
+                  const uint8_t* src_v,
+                  int src_stride_v,
+                  int width,
+                  int height,
+                  uint64_t seed) {
+  int halfwidth = (width + 1) >> 1;
+  int halfheight = (height + 1) >> 1;
+  uint64_t hash;
+  if (!src_y || !src_u || !src_v || width <= 0 || height == 0) {
+    return 0;
+  }
+  if (height < 0) {
+    halfheight = -((1 - height) >> 1);
+  }
+  hash = HashPlane(src_y, src_stride_y, width, height, seed);
+  hash = HashPlane(src_u, src_stride_u, halfwidth, halfheight, hash);
+  return HashPlane(src_v, src_stride_v, halfwidth, halfheight, hash);
 }
 
 // Scan an opaque argb image and return fourcc based on alpha offset.
@@ -100,6 +191,7 @@ uint32_t ARGBDetect(const uint8_t* argb,
                     int height) {
   uint32_t fourcc = 0;
   int h;
+  uint32_t (*ARGBDetectRow)(const uint8_t* argb, int width) = ARGBDetectRow_C;
 
   // Coalesce rows.
   if (stride_argb == width * 4) {
@@ -107,13 +199,173 @@ uint32_t ARGBDetect(const uint8_t* argb,
     height = 1;
     stride_argb = 0;
   }
+#if defined(HAS_ARGBDETECTROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    ARGBDetectRow = ARGBDetectRow_SSE2;
+  }
+#endif
+#if defined(HAS_ARGBDETECTROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    ARGBDetectRow = ARGBDetectRow_AVX2;
+  }
+#endif
+#if defined(HAS_ARGBDETECTROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    ARGBDetectRow = ARGBDetectRow_NEON;
+  }
+#endif
   for (h = 0; h < height && fourcc == 0; ++h) {
-    fourcc = ARGBDetectRow_C(argb, width);
+    fourcc = ARGBDetectRow(argb, width);
     argb += stride_argb;
   }
   return fourcc;
 }
 
+// Reduce a block of pixels to per channel min/max with SIMD for the
+// aligned part and C for the remainder.
+static void ARGBMinMaxBlock(void (*ARGBMinMaxRow)(const uint8_t* src_argb,
+                                                  uint8_t* dst_minmax,
+                                                  int width),
+                            int simd_mask,
+                            const uint8_t* src_argb,
+                            uint8_t* dst_minmax,
+                            int width) {
+  int simd_width = width & ~simd_mask;
+  dst_minmax[0] = dst_minmax[1] = dst_minmax[2] = dst_minmax[3] = 255u;
+  dst_minmax[4] = dst_minmax[5] = dst_minmax[6] = dst_minmax[7] = 0u;
+  if (simd_width > 0) {
+    ARGBMinMaxRow(src_argb, dst_minmax, simd_width);
+  }
+  if (width > simd_width) {
+    ARGBMinMaxRow_C(src_argb + simd_width * 4, dst_minmax, width - simd_width);
+  }
+}
+
+// Returns 1 if every alpha value in an ARGB image is 255.
+LIBYUV_API
+int ARGBIsOpaque(const uint8_t* src_argb,
+                 int src_stride_argb,
+                 int width,
+                 int height) {
+  const int kBlockSize = 4096;  // Pixels reduced between early exit checks.
+  int x, y;
+  int simd_mask = 0;
+  uint8_t minmax[8];
+  void (*ARGBMinMaxRow)(const uint8_t* src_argb, uint8_t* dst_minmax,
+                        int width) = ARGBMinMaxRow_C;
+  if (!src_argb || width <= 0 || height == 0) {
+    return 0;
+  }
+  if (height < 0) {
+    height = -height;
+    src_argb = src_argb + (height - 1) * src_stride_argb;
+    src_stride_argb = -src_stride_argb;
+  }
+  // Coalesce rows.
+  if (src_stride_argb == width * 4) {
+    width *= height;
+    height = 1;
+    src_stride_argb = 0;
+  }
+#if defined(HAS_ARGBMINMAXROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    ARGBMinMaxRow = ARGBMinMaxRow_SSE2;
+    simd_mask = 7;
+  }
+#endif
+#if defined(HAS_ARGBMINMAXROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    ARGBMinMaxRow = ARGBMinMaxRow_AVX2;
+    simd_mask = 15;
+  }
+#endif
+#if defined(HAS_ARGBMINMAXROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    ARGBMinMaxRow = ARGBMinMaxRow_NEON;
+    simd_mask = 15;
+  }
+#endif
+  for (y = 0; y < height; ++y) {
+    for (x = 0; x < width; x += kBlockSize) {
+      int n = width - x < kBlockSize ? width - x : kBlockSize;
+      ARGBMinMaxBlock(ARGBMinMaxRow, simd_mask, src_argb + x * 4, minmax, n);
+      if (minmax[3] != 255u) {
+        return 0;
+      }
+    }
+    src_argb += src_stride_argb;
+  }
+  return 1;
+}
+
+// Returns 1 if every byte of a plane has the same value.
+LIBYUV_API
+int PlaneIsConstant(const uint8_t* src_y,
+                    int src_stride_y,
+                    int width,
+                    int height) {
+  const int kBlockSize = 4096;
+  int x, y;
+  int simd_mask = 0;
+  uint8_t value;
+  uint8_t minmax[8];
+  void (*ARGBMinMaxRow)(const uint8_t* src_argb, uint8_t* dst_minmax,
+                        int width) = ARGBMinMaxRow_C;
+  if (!src_y || width <= 0 || height == 0) {
+    return 0;
+  }
+  if (height < 0) {
+    height = -height;
+    src_y = src_y + (height - 1) * src_stride_y;
+    src_stride_y = -src_stride_y;
+  }
+  // Coalesce rows.
+  if (src_stride_y == width) {
+    width *= height;
+    height = 1;
+    src_stride_y = 0;
+  }
+#if defined(HAS_ARGBMINMAXROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    ARGBMinMaxRow = ARGBMinMaxRow_SSE2;
+    simd_mask = 7;
+  }
+#endif
+#if defined(HAS_ARGBMINMAXROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    ARGBMinMaxRow = ARGBMinMaxRow_AVX2;
+    simd_mask = 15;
+  }
+#endif
+#if defined(HAS_ARGBMINMAXROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    ARGBMinMaxRow = ARGBMinMaxRow_NEON;
+    simd_mask = 15;
+  }
+#endif
+  value = src_y[0];
+  for (y = 0; y < height; ++y) {
+    // Bytes are reduced as groups of 4 and the remainder compared in C.
+    int pixels = width >> 2;
+    for (x = 0; x < pixels; x += kBlockSize) {
+      int n = pixels - x < kBlockSize ? pixels - x : kBlockSize;
+      ARGBMinMaxBlock(ARGBMinMaxRow, simd_mask, src_y + x * 4, minmax, n);
+      if (minmax[0] != value || minmax[1] != value || minmax[2] != value ||
+          minmax[3] != value || minmax[4] != value || minmax[5] != value ||
+          minmax[6] != value || minmax[7] != value) {
+        return 0;
+      }
+    }
+    for (x = pixels * 4; x < width; ++x) {
+      if (src_y[x] != value) {
+        return 0;
+      }
+    }
+    src_y += src_stride_y;
+  }
+  return 1;
+}
+
 // NEON version accumulates in 16 bit shorts which overflow at 65536 bytes.
 // So actual maximum is 1 less loop, which is 64436 - 32 bytes.
 
@@ -149,6 +401,11 @@ uint64_t ComputeHammingDistance(const uint8_t* src_a,
     HammingDistance = HammingDistance_AVX2;
   }
 #endif
+#if defined(HAS_HAMMINGDISTANCE_AVX512VPOPCNTDQ)
+  if (TestCpuFlag(kCpuHasAVX512VPOPCNTDQ)) {
+    HammingDistance = HammingDistance_AVX512VPOPCNTDQ;
+  }
+#endif
 #if defined(HAS_HAMMINGDISTANCE_MSA)
   if (TestCpuFlag(kCpuHasMSA)) {
     HammingDistance = HammingDistance_MSA;
@@ -206,6 +463,12 @@ uint64_t ComputeSumSquareError(const uint8_t* src_a,
     SumSquareError = SumSquareError_AVX2;
   }
 #endif
+#if defined(HAS_SUMSQUAREERROR_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW)) {
+    // Note only used for multiples of 32 so count is not checked.
+    SumSquareError = SumSquareError_AVX512BW;
+  }
+#endif
 #if defined(HAS_SUMSQUAREERROR_MSA)
   if (TestCpuFlag(kCpuHasMSA)) {
     SumSquareError = SumSquareError_MSA;
@@ -255,11 +518,564 @@ uint64_t ComputeSumSquareErrorPlane(const uint8_t* src_a,
 }
 
 LIBYUV_API
-double SumSquareErrorToPsnr(uint64_t sse, uint64_t count) {
+uint64_t ComputeSumSquareErrorPlane_16(const uint16_t* src_a,
+                                       int stride_a,
+                                       const uint16_t* src_b,
+                                       int stride_b,
+                                       int width,
+                                       int height) {
+  uint64_t sse = 0;
+  int simd_mask = 0;
+  int simd_width;
+  int h;
+  uint64_t (*SumSquareError_16)(const uint16_t* src_a, const uint16_t* src_b,
+                                int count) = SumSquareError_16_C;
+#if defined(HAS_SUMSQUAREERROR_16_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    SumSquareError_16 = SumSquareError_16_SSE2;
+    simd_mask = 7;
+  }
+#endif
+#if defined(HAS_SUMSQUAREERROR_16_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    SumSquareError_16 = SumSquareError_16_AVX2;
+    simd_mask = 15;
+  }
+#endif
+#if defined(HAS_SUMSQUAREERROR_16_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    SumSquareError_16 = SumSquareError_16_NEON;
+    simd_mask = 15;
+  }
+#endif
+  // Coalesce rows.
+  if (stride_a == width && stride_b == width) {
+    width *= height;
+    height = 1;
+    stride_a = stride_b = 0;
+  }
+  simd_width = width & ~simd_mask;
+  for (h = 0; h < height; ++h) {
+    if (simd_width) {
+      sse += SumSquareError_16(src_a, src_b, simd_width);
+    }
+    if (width & simd_mask) {
+      sse += SumSquareError_16_C(src_a + simd_width, src_b + simd_width,
+                                 width - simd_width);
+    }
+    src_a += stride_a;
+    src_b += stride_b;
+  }
+  return sse;
+}
+
+// Sum SAD or SSE of block_size x block_size blocks into a grid. Each row is
+// accumulated per 8 pixel group, then groups are folded into blocks after the
+// last row of a block row.
+static int ComputeBlockPlane(const uint8_t* src_a,
+                             int stride_a,
+                             const uint8_t* src_b,
+                             int stride_b,
+                             uint32_t* dst_block,
+                             int dst_stride_block,
+                             int width,
+                             int height,
+                             int block_size,
+                             int downscale,
+                             int sse) {
+  int x, y;
+  int simd_mask = 0;
+  int halfwidth = (width + 1) >> 1;
+  int block_width = downscale ? halfwidth : width;
+  int block_height;
+  int blocks_x;
+  int groups;
+  int simd_width;
+  void (*BlockRow)(const uint8_t* src_a, const uint8_t* src_b,
+                   uint32_t* dst_sum, int width) =
+      sse ? BlockSseRow_C : BlockSadRow_C;
+  void (*BlockRow_C)(const uint8_t* src_a, const uint8_t* src_b,
+                     uint32_t* dst_sum, int width) =
+      sse ? BlockSseRow_C : BlockSadRow_C;
+  void (*ScaleRowDown2)(const uint8_t* src_ptr, ptrdiff_t src_stride,
+                        uint8_t* dst_ptr, int dst_width) = ScaleRowDown2Box_C;
+  if (!src_a || !src_b || !dst_block || width <= 0 || height == 0 ||
+      (block_size != 8 && block_size != 16 && block_size != 32)) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src_a = src_a + (height - 1) * stride_a;
+    src_b = src_b + (height - 1) * stride_b;
+    stride_a = -stride_a;
+    stride_b = -stride_b;
+  }
+  block_height = downscale ? (height + 1) >> 1 : height;
+  blocks_x = (block_width + block_size - 1) / block_size;
+  groups = blocks_x * (block_size >> 3);
+
+#if defined(HAS_BLOCKSADROW_SSE2)
+  if (!sse && TestCpuFlag(kCpuHasSSE2)) {
+    BlockRow = BlockSadRow_SSE2;
+    simd_mask = 15;
+  }
+#endif
+#if defined(HAS_BLOCKSSEROW_SSE2)
+  if (sse && TestCpuFlag(kCpuHasSSE2)) {
+    BlockRow = BlockSseRow_SSE2;
+    simd_mask = 15;
+  }
+#endif
+#if defined(HAS_BLOCKSADROW_AVX2)
+  if (!sse && TestCpuFlag(kCpuHasAVX2)) {
+    BlockRow = BlockSadRow_AVX2;
+    simd_mask = 31;
+  }
+#endif
+#if defined(HAS_BLOCKSSEROW_AVX2)
+  if (sse && TestCpuFlag(kCpuHasAVX2)) {
+    BlockRow = BlockSseRow_AVX2;
+    simd_mask = 31;
+  }
+#endif
+#if defined(HAS_BLOCKSADROW_NEON)
+  if (!sse && TestCpuFlag(kCpuHasNEON)) {
+    BlockRow = BlockSadRow_NEON;
+    simd_mask = 15;
+  }
+#endif
+#if defined(HAS_BLOCKSSEROW_NEON)
+  if (sse && TestCpuFlag(kCpuHasNEON)) {
+    BlockRow = BlockSseRow_NEON;
+    simd_mask = 15;
+  }
+#endif
+  if (!IS_ALIGNED(width, 2)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_C;
+  }
+#if defined(HAS_SCALEROWDOWN2_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_NEON;
+    if (IS_ALIGNED(width, 2)) {
+      ScaleRowDown2 = ScaleRowDown2Box_Any_NEON;
+      if (IS_ALIGNED(halfwidth, 16)) {
+        ScaleRowDown2 = ScaleRowDown2Box_NEON;
+      }
+    }
+  }
+#endif
+#if defined(HAS_SCALEROWDOWN2_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_SSSE3;
+    if (IS_ALIGNED(width, 2)) {
+      ScaleRowDown2 = ScaleRowDown2Box_Any_SSSE3;
+      if (IS_ALIGNED(halfwidth, 16)) {
+        ScaleRowDown2 = ScaleRowDown2Box_SSSE3;
+      }
+    }
+  }
+#endif
+#if defined(HAS_SCALEROWDOWN2_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_AVX2;
+    if (IS_ALIGNED(width, 2)) {
+      ScaleRowDown2 = ScaleRowDown2Box_Any_AVX2;
+      if (IS_ALIGNED(halfwidth, 32)) {
+        ScaleRowDown2 = ScaleRowDown2Box_AVX2;
+      }
+    }
+  }
+#endif
+
+
+  simd_width = block_width & ~simd_mask;
+  // Per group sums for one block row and 2 half size rows.
+  align_buffer_64(row_sum, groups * 4);
+  align_buffer_64(half_rows, halfwidth * 2);
+  uint32_t* sum = (uint32_t*)row_sum;
+  for (y = 0; y < block_height; ++y) {
+    const uint8_t* row_a = src_a;
+    const uint8_t* row_b = src_b;
+    if (downscale) {
+      // Last row of odd height image uses 1 row instead of 2.
+      int last = (y * 2 + 1) >= height;
+      ScaleRowDown2(src_a, last ? 0 : stride_a, half_rows, halfwidth);
+      ScaleRowDown2(src_b, last ? 0 : stride_b, half_rows + halfwidth,
+                    halfwidth);
+      row_a = half_rows;
+      row_b = half_rows + halfwidth;
+      src_a += stride_a * 2;
+      src_b += stride_b * 2;
+    } else {
+      src_a += stride_a;
+      src_b += stride_b;
+    }
+    if ((y % block_size) == 0) {
+      memset(sum, 0, groups * 4);
+    }
+    if (simd_width > 0) {
+      BlockRow(row_a, row_b, sum, simd_width);
+    }
+    if (block_width > simd_width) {
+      BlockRow_C(row_a + simd_width, row_b + simd_width,
+                 sum + (simd_width >> 3), block_width - simd_width);
+    }
+    if ((y % block_size) == (block_size - 1) || y == (block_height - 1)) {
+      for (x = 0; x < blocks_x; ++x) {
+        const uint32_t* s = sum + x * (block_size >> 3);
+        uint32_t total = s[0];
+        int i;
+        for (i = 1; i < (block_size >> 3); ++i) {
+          total += s[i];
+        }
+        dst_block[x] = total;
+      }
+      dst_block += dst_stride_block;
+    }
+  }
+  free_aligned_buffer_64(half_rows);
+  free_aligned_buffer_64(row_sum);
+  return 0;
+}
+
+LIBYUV_API
+int ComputeBlockSadPlane(const uint8_t* src_a,
+                         int stride_a,
+                         const uint8_t* src_b,
+                         int stride_b,
+                         uint32_t* dst_sad,
+                         int dst_stride_sad,
+                         int width,
+                         int height,
+                         int block_size,
+                         int downscale) {
+  return ComputeBlockPlane(src_a, stride_a, src_b, stride_b, dst_sad,
+                           dst_stride_sad, width, height, block_size,
+                           downscale, 0);
+}
+
+LIBYUV_API
+int ComputeBlockSsePlane(const uint8_t* src_a,
+                         int stride_a,
+                         const uint8_t* src_b,
+                         int stride_b,
+                         uint32_t* dst_sse,
+                         int dst_stride_sse,
+                         int width,
+                         int height,
+                         int block_size,
+                         int downscale) {
+  return ComputeBlockPlane(src_a, stride_a, src_b, stride_b, dst_sse,
+                           dst_stride_sse, width, height, block_size,
+                           downscale, 1);
+}
+
+// Count values of a row into 16 bins.
+static void HistogramRow16(const uint8_t* src, uint32_t* histogram, int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    ++histogram[src[x] >> 4];
+  }
+}
+
+LIBYUV_API
+int AnalyzeFrameChange(const uint8_t* src_y,
+                       int src_stride_y,
+                       const uint8_t* src_u,
+                       int src_stride_u,
+                       const uint8_t* src_v,
+                       int src_stride_v,
+                       const uint8_t* prev_y,
+                       int prev_stride_y,
+                       const uint8_t* prev_u,
+                       int prev_stride_u,
+                       const uint8_t* prev_v,
+                       int prev_stride_v,
+                       uint8_t* dst_tile_changed,
+                       int dst_stride_tile_changed,
+                       int width,
+                       int height,
+                       int tile_size,
+                       struct FrameChangeReport* report) {
+  int x, y, i;
+  int simd_mask = 0;
+  int halfwidth = (width + 1) >> 1;
+  int halfheight;
+  int tiles_x;
+  int groups_y;
+  int groups_uv;
+  int simd_width;
+  int simd_halfwidth;
+  int has_uv = src_u && src_v && prev_u && prev_v;
+  uint32_t histogram[16];
+  uint32_t prev_histogram[16];
+  uint64_t moved = 0;
+  void (*BlockSadRow)(const uint8_t* src_a, const uint8_t* src_b,
+                      uint32_t* dst_sum, int width) = BlockSadRow_C;
+  void (*ScaleRowDown2)(const uint8_t* src_ptr, ptrdiff_t src_stride,
+                        uint8_t* dst_ptr, int dst_width) = ScaleRowDown2Box_C;
+  if (!src_y || !prev_y || !report || width <= 0 || height == 0 ||
+      (tile_size != 16 && tile_size != 32 && tile_size != 64)) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    halfheight = (height + 1) >> 1;
+    src_y = src_y + (height - 1) * src_stride_y;
+    prev_y = prev_y + (height - 1) * prev_stride_y;
+    src_stride_y = -src_stride_y;
+    prev_stride_y = -prev_stride_y;
+    if (has_uv) {
+      src_u = src_u + (halfheight - 1) * src_stride_u;
+      src_v = src_v + (halfheight - 1) * src_stride_v;
+      prev_u = prev_u + (halfheight - 1) * prev_stride_u;
+      prev_v = prev_v + (halfheight - 1) * prev_stride_v;
+      src_stride_u = -src_stride_u;
+      src_stride_v = -src_stride_v;
+      prev_stride_u = -prev_stride_u;
+      prev_stride_v = -prev_stride_v;
+    }
+  }
+  halfheight = (height + 1) >> 1;
+  tiles_x = (width + tile_size - 1) / tile_size;
+  groups_y = tiles_x * (tile_size >> 3);
+  groups_uv = tiles_x * (tile_size >> 4);
+
+#if defined(HAS_BLOCKSADROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    BlockSadRow = BlockSadRow_SSE2;
+    simd_mask = 15;
+  }
+#endif
+#if defined(HAS_BLOCKSADROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    BlockSadRow = BlockSadRow_AVX2;
+    simd_mask = 31;
+  }
+#endif
+#if defined(HAS_BLOCKSADROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    BlockSadRow = BlockSadRow_NEON;
+    simd_mask = 15;
+  }
+#endif
+  if (!IS_ALIGNED(width, 2)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_C;
+  }
+#if defined(HAS_SCALEROWDOWN2_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_NEON;
+    if (IS_ALIGNED(width, 2)) {
+      ScaleRowDown2 = ScaleRowDown2Box_Any_NEON;
+      if (IS_ALIGNED(halfwidth, 16)) {
+        ScaleRowDown2 = ScaleRowDown2Box_NEON;
+      }
+    }
+  }
+#endif
+#if defined(HAS_SCALEROWDOWN2_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_SSSE3;
+    if (IS_ALIGNED(width, 2)) {
+      ScaleRowDown2 = ScaleRowDown2Box_Any_SSSE3;
+      if (IS_ALIGNED(halfwidth, 16)) {
+        ScaleRowDown2 = ScaleRowDown2Box_SSSE3;
+      }
+    }
+  }
+#endif
+#if defined(HAS_SCALEROWDOWN2_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    ScaleRowDown2 = ScaleRowDown2Box_Odd_AVX2;
+    if (IS_ALIGNED(width, 2)) {
+      ScaleRowDown2 = ScaleRowDown2Box_Any_AVX2;
+      if (IS_ALIGNED(halfwidth, 32)) {
+        ScaleRowDown2 = ScaleRowDown2Box_AVX2;
+      }
+    }
+  }
+#endif
+
+  simd_width = width & ~simd_mask;
+  simd_halfwidth = halfwidth & ~simd_mask;
+  memset(report, 0, sizeof(*report));
+  memset(histogram, 0, sizeof(histogram));
+  memset(prev_histogram, 0, sizeof(prev_histogram));
+  report->num_tiles = tiles_x * ((height + tile_size - 1) / tile_size);
+
+  // Per 8 pixel group SAD of one tile row for Y and UV, and 2 half size rows
+  // of luma for the histograms.
+  align_buffer_64(row_sum, (groups_y + groups_uv) * 4);
+  align_buffer_64(half_rows, halfwidth * 2);
+  uint32_t* sum_y = (uint32_t*)row_sum;
+  uint32_t* sum_uv = sum_y + groups_y;
+  for (y = 0; y < height; ++y) {
+    if ((y % tile_size) == 0) {
+      memset(row_sum, 0, (groups_y + groups_uv) * 4);
+    }
+    if (simd_width > 0) {
+      BlockSadRow(src_y, prev_y, sum_y, simd_width);
+    }
+    if (width > simd_width) {
+      BlockSadRow_C(src_y + simd_width, prev_y + simd_width,
+                    sum_y + (simd_width >> 3), width - simd_width);
+    }
+    if ((y & 1) == 0) {
+      // Last row of odd height image uses 1 row instead of 2.
+      int last = (y + 1) >= height;
+      ScaleRowDown2(src_y, last ? 0 : src_stride_y, half_rows, halfwidth);
+      ScaleRowDown2(prev_y, last ? 0 : prev_stride_y, half_rows + halfwidth,
+                    halfwidth);
+      HistogramRow16(half_rows, histogram, halfwidth);
+      HistogramRow16(half_rows + halfwidth, prev_histogram, halfwidth);
+      if (has_uv) {
+        if (simd_halfwidth > 0) {
+          BlockSadRow(src_u, prev_u, sum_uv, simd_halfwidth);
+          BlockSadRow(src_v, prev_v, sum_uv, simd_halfwidth);
+        }
+        if (halfwidth > simd_halfwidth) {
+          BlockSadRow_C(src_u + simd_halfwidth, prev_u + simd_halfwidth,
+                        sum_uv + (simd_halfwidth >> 3),
+                        halfwidth - simd_halfwidth);
+          BlockSadRow_C(src_v + simd_halfwidth, prev_v + simd_halfwidth,
+                        sum_uv + (simd_halfwidth >> 3),
+                        halfwidth - simd_halfwidth);
+        }
+        src_u += src_stride_u;
+        src_v += src_stride_v;
+        prev_u += prev_stride_u;
+        prev_v += prev_stride_v;
+      }
+    }
+    src_y += src_stride_y;
+    prev_y += prev_stride_y;
+
+    // Fold groups into tiles at the end of each tile row.
+    if ((y % tile_size) == (tile_size - 1) || y == (height - 1)) {
+      for (x = 0; x < tiles_x; ++x) {
+        uint32_t tile_y = 0;
+        uint32_t tile_uv = 0;
+        for (i = 0; i < (tile_size >> 3); ++i) {
+          tile_y += sum_y[x * (tile_size >> 3) + i];
+        }
+        for (i = 0; i < (tile_size >> 4); ++i) {
+          tile_uv += sum_uv[x * (tile_size >> 4) + i];
+        }
+        report->sad_y += tile_y;
+        report->sad_uv += tile_uv;
+        if (tile_y || tile_uv) {
+          ++report->changed_tiles;
+        }
+        if (dst_tile_changed) {
+          dst_tile_changed[x] = (tile_y || tile_uv) ? 1 : 0;
+        }
+      }
+      if (dst_tile_changed) {
+        dst_tile_changed += dst_stride_tile_changed;
+      }
+    }
+  }
+  free_aligned_buffer_64(half_rows);
+  free_aligned_buffer_64(row_sum);
+
+  // Half of the absolute histogram difference is the number of pixels that
+  // moved to another bin.
+  for (i = 0; i < 16; ++i) {
+    moved += histogram[i] > prev_histogram[i] ? histogram[i] - prev_histogram[i]
+                                              : prev_histogram[i] - histogram[i];
+  }
+  report->histogram_delta =
+      (uint32_t)((moved * 512) / ((uint64_t)halfwidth * halfheight));
+  report->is_duplicate = report->sad_y == 0 && report->sad_uv == 0;
+  report->is_scene_cut = report->histogram_delta >= kSceneCutHistogramDelta;
+  return 0;
+}
+
+LIBYUV_API
+int ARGBDirtyTiles(const uint8_t* src_argb,
+                   int src_stride_argb,
+                   const uint8_t* prev_argb,
+                   int prev_stride_argb,
+                   uint8_t* dst_dirty_tiles,
+                   int dst_stride_dirty_tiles,
+                   int width,
+                   int height,
+                   int tile_size) {
+  int x, y;
+  int tiles_x;
+  int num_dirty = 0;
+  int (*BytesEqual)(const uint8_t* src_a, const uint8_t* src_b, int count) =
+      BytesEqual_C;
+  if (!src_argb || !prev_argb || !dst_dirty_tiles || width <= 0 ||
+      height == 0 || (tile_size != 16 && tile_size != 32 && tile_size != 64)) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src_argb = src_argb + (height - 1) * src_stride_argb;
+    prev_argb = prev_argb + (height - 1) * prev_stride_argb;
+    src_stride_argb = -src_stride_argb;
+    prev_stride_argb = -prev_stride_argb;
+  }
+  tiles_x = (width + tile_size - 1) / tile_size;
+#if defined(HAS_BYTESEQUAL_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    BytesEqual = BytesEqual_SSE2;
+  }
+#endif
+#if defined(HAS_BYTESEQUAL_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    BytesEqual = BytesEqual_AVX2;
+  }
+#endif
+#if defined(HAS_BYTESEQUAL_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    BytesEqual = BytesEqual_NEON;
+  }
+#endif
+
+  // Rows are scanned in order and tiles already found dirty are skipped.
+  for (y = 0; y < height; ++y) {
+    if ((y % tile_size) == 0) {
+      if (y) {
+        dst_dirty_tiles += dst_stride_dirty_tiles;
+      }
+      memset(dst_dirty_tiles, 0, (tiles_x + 7) >> 3);
+    }
+    for (x = 0; x < tiles_x; ++x) {
+      const uint8_t* a = src_argb + x * tile_size * 4;
+      const uint8_t* b = prev_argb + x * tile_size * 4;
+      int tile_width =
+          width - x * tile_size < tile_size ? width - x * tile_size : tile_size;
+      int count = tile_width * 4;
+      int simd_count = count & ~63;
+      if (dst_dirty_tiles[x >> 3] & (1 << (x & 7))) {
+        continue;
+      }
+      if ((simd_count && !BytesEqual(a, b, simd_count)) ||
+          (count > simd_count &&
+           !BytesEqual_C(a + simd_count, b + simd_count, count - simd_count))) {
+        dst_dirty_tiles[x >> 3] |= (uint8_t)(1 << (x & 7));
+        ++num_dirty;
+      }
+    }
+    src_argb += src_stride_argb;
+    prev_argb += prev_stride_argb;
+  }
+  return num_dirty;
+}
+
+// PSNR for samples with a peak value of max_value.
+static double SumSquareErrorToPsnrMax(uint64_t sse,
+                                      uint64_t count,
+                                      double max_value) {
   double psnr;
   if (sse > 0) {
     double mse = (double)count / (double)sse;
-    psnr = 10.0 * log10(255.0 * 255.0 * mse);
+    psnr = 10.0 * log10(max_value * max_value * mse);
   } else {
     psnr = kMaxPsnr;  // Limit to prevent divide by 0
   }
@@ -271,6 +1087,11 @@ double SumSquareErrorToPsnr(uint64_t sse, uint64_t count) {
   return psnr;
 }
 
+LIBYUV_API
+double SumSquareErrorToPsnr(uint64_t sse, uint64_t count) {
+  return SumSquareErrorToPsnrMax(sse, count, 255.0);
+}
+
 LIBYUV_API
 double CalcFramePsnr(const uint8_t* src_a,
                      int stride_a,
@@ -313,6 +1134,59 @@ double I420Psnr(const uint8_t* src_y_a,
   return SumSquareErrorToPsnr(sse, samples);
 }
 
+LIBYUV_API
+double I010Psnr(const uint16_t* src_y_a,
+                int stride_y_a,
+                const uint16_t* src_u_a,
+                int stride_u_a,
+                const uint16_t* src_v_a,
+                int stride_v_a,
+                const uint16_t* src_y_b,
+                int stride_y_b,
+                const uint16_t* src_u_b,
+                int stride_u_b,
+                const uint16_t* src_v_b,
+                int stride_v_b,
+                int width,
+                int height) {
+  const uint64_t sse_y = ComputeSumSquareErrorPlane_16(
+      src_y_a, stride_y_a, src_y_b, stride_y_b, width, height);
+  const int width_uv = (width + 1) >> 1;
+  const int height_uv = (height + 1) >> 1;
+  const uint64_t sse_u = ComputeSumSquareErrorPlane_16(
+      src_u_a, stride_u_a, src_u_b, stride_u_b, width_uv, height_uv);
+  const uint64_t sse_v = ComputeSumSquareErrorPlane_16(
+      src_v_a, stride_v_a, src_v_b, stride_v_b, width_uv, height_uv);
+  const uint64_t samples = (uint64_t)width * (uint64_t)height +
+                           2 * ((uint64_t)width_uv * (uint64_t)height_uv);
+  const uint64_t sse = sse_y + sse_u + sse_v;
+  return SumSquareErrorToPsnrMax(sse, samples, 1023.0);
+}
+
+// P010 holds 10 bit samples in the upper bits, so the peak is 1023 << 6 and
+// the result matches I010Psnr of the same frame.
+LIBYUV_API
+double P010Psnr(const uint16_t* src_y_a,
+                int stride_y_a,
+                const uint16_t* src_uv_a,
+                int stride_uv_a,
+                const uint16_t* src_y_b,
+                int stride_y_b,
+                const uint16_t* src_uv_b,
+                int stride_uv_b,
+                int width,
+                int height) {
+  const uint64_t sse_y = ComputeSumSquareErrorPlane_16(
+      src_y_a, stride_y_a, src_y_b, stride_y_b, width, height);
+  const int width_uv = (width + 1) >> 1;
+  const int height_uv = (height + 1) >> 1;
+  const uint64_t sse_uv = ComputeSumSquareErrorPlane_16(
+      src_uv_a, stride_uv_a, src_uv_b, stride_uv_b, width_uv * 2, height_uv);
+  const uint64_t samples = (uint64_t)width * (uint64_t)height +
+                           2 * ((uint64_t)width_uv * (uint64_t)height_uv);
+  return SumSquareErrorToPsnrMax(sse_y + sse_uv, samples, 1023.0 * 64.0);
+}
+
 static const int64_t cc1 = 26634;   // (64^2*(.01*255)^2
 static const int64_t cc2 = 239708;  // (64^2*(.03*255)^2
 
@@ -424,6 +1298,117 @@ double I420Ssim(const uint8_t* src_y_a,
   return ssim_y * 0.8 + 0.1 * (ssim_u + ssim_v);
 }
 
+// 16 bit version of Ssim8x8_C. The products exceed 64 bits for high bit
+// depths so the final terms are computed in double.
+static double Ssim8x8_16_C(const uint16_t* src_a,
+                           int stride_a,
+                           const uint16_t* src_b,
+                           int stride_b,
+                           double max_value) {
+  int64_t sum_a = 0;
+  int64_t sum_b = 0;
+  int64_t sum_sq_a = 0;
+  int64_t sum_sq_b = 0;
+  int64_t sum_axb = 0;
+
+  int i;
+  for (i = 0; i < 8; ++i) {
+    int j;
+    for (j = 0; j < 8; ++j) {
+      sum_a += src_a[j];
+      sum_b += src_b[j];
+      sum_sq_a += (int64_t)src_a[j] * src_a[j];
+      sum_sq_b += (int64_t)src_b[j] * src_b[j];
+      sum_axb += (int64_t)src_a[j] * src_b[j];
+    }
+
+    src_a += stride_a;
+    src_b += stride_b;
+  }
+
+  {
+    const double count = 64.0;
+    // scale the constants by number of pixels
+    const double c1 = (0.01 * max_value * count) * (0.01 * max_value * count);
+    const double c2 = (0.03 * max_value * count) * (0.03 * max_value * count);
+
+    const double sum_a_x_sum_b = (double)sum_a * (double)sum_b;
+
+    const double ssim_n =
+        (2.0 * sum_a_x_sum_b + c1) *
+        (2.0 * count * (double)sum_axb - 2.0 * sum_a_x_sum_b + c2);
+
+    const double sum_a_sq = (double)sum_a * (double)sum_a;
+    const double sum_b_sq = (double)sum_b * (double)sum_b;
+
+    const double ssim_d =
+        (sum_a_sq + sum_b_sq + c1) *
+        (count * (double)sum_sq_a - sum_a_sq + count * (double)sum_sq_b -
+         sum_b_sq + c2);
+
+    if (ssim_d == 0.0) {
+      return DBL_MAX;
+    }
+    return ssim_n / ssim_d;
+  }
+}
+
+static double CalcFrameSsim_16(const uint16_t* src_a,
+                               int stride_a,
+                               const uint16_t* src_b,
+                               int stride_b,
+                               int width,
+                               int height,
+                               double max_value) {
+  int samples = 0;
+  double ssim_total = 0;
+
+  // sample point start with each 4x4 location
+  int i;
+  for (i = 0; i < height - 8; i += 4) {
+    int j;
+    for (j = 0; j < width - 8; j += 4) {
+      ssim_total +=
+          Ssim8x8_16_C(src_a + j, stride_a, src_b + j, stride_b, max_value);
+      samples++;
+    }
+
+    src_a += stride_a * 4;
+    src_b += stride_b * 4;
+  }
+
+  ssim_total /= samples;
+  return ssim_total;
+}
+
+LIBYUV_API
+double I010Ssim(const uint16_t* src_y_a,
+                int stride_y_a,
+                const uint16_t* src_u_a,
+                int stride_u_a,
+                const uint16_t* src_v_a,
+                int stride_v_a,
+                const uint16_t* src_y_b,
+                int stride_y_b,
+                const uint16_t* src_u_b,
+                int stride_u_b,
+                const uint16_t* src_v_b,
+                int stride_v_b,
+                int width,
+                int height) {
+  const double ssim_y = CalcFrameSsim_16(src_y_a, stride_y_a, src_y_b,
+                                         stride_y_b, width, height, 1023.0);
+  const int width_uv = (width + 1) >> 1;
+  const int height_uv = (height + 1) >> 1;
+  const double ssim_u = CalcFrameSsim_16(src_u_a, stride_u_a, src_u_b,
+                                         stride_u_b, width_uv, height_uv,
+                                         1023.0);
+  const double ssim_v = CalcFrameSsim_16(src_v_a, stride_v_a, src_v_b,
+                                         stride_v_b, width_uv, height_uv,
+                                         1023.0);
+  return ssim_y * 0.8 + 0.1 * (ssim_u + ssim_v);
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
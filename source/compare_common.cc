@@ -11,6 +11,7 @@
 #include "libyuv/basic_types.h"
 
 #include "libyuv/compare_row.h"
+#include "libyuv/video_common.h"
 
 #ifdef __cplusplus
 namespace libyuv {
@@ -57,6 +58,132 @@ uint32_t SumSquareError_C(const uint8_t* src_a,
   return sse;
 }
 
+uint64_t SumSquareError_16_C(const uint16_t* src_a,
+                             const uint16_t* src_b,
+                             int count) {
+  uint64_t sse = 0u;
+  int i;
+  for (i = 0; i < count; ++i) {
+    int64_t diff = (int64_t)src_a[i] - src_b[i];
+    sse += (uint64_t)(diff * diff);
+  }
+  return sse;
+}
+
+// Returns FOURCC_BGRA or FOURCC_ARGB for the first pixel that is not opaque
+// in the ARGB or BGRA layout, or 0 if all pixels are opaque in both.
+uint32_t ARGBDetectRow_C(const uint8_t* argb, int width) {
+  int x;
+  for (x = 0; x < width - 1; x += 2) {
+    if (argb[0] != 255) {  // First byte is not Alpha of 255, so not ARGB.
+      return FOURCC_BGRA;
+    }
+    if (argb[3] != 255) {  // Fourth byte is not Alpha of 255, so not BGRA.
+      return FOURCC_ARGB;
+    }
+    if (argb[4] != 255) {  // Second pixel first byte is not Alpha of 255.
+      return FOURCC_BGRA;
+    }
+    if (argb[7] != 255) {  // Second pixel fourth byte is not Alpha of 255.
+      return FOURCC_ARGB;
+    }
+    argb += 8;
+  }
+  if (width & 1) {
+    if (argb[0] != 255) {  // First byte is not Alpha of 255, so not ARGB.
+      return FOURCC_BGRA;
+    }
+    if (argb[3] != 255) {  // 4th byte is not Alpha of 255, so not BGRA.
+      return FOURCC_ARGB;
+    }
+  }
+  return 0;
+}
+
+void ARGBMinMaxRow_C(const uint8_t* src_argb, uint8_t* dst_minmax, int width) {
+  uint8_t min0 = dst_minmax[0];
+  uint8_t min1 = dst_minmax[1];
+  uint8_t min2 = dst_minmax[2];
+  uint8_t min3 = dst_minmax[3];
+  uint8_t max0 = dst_minmax[4];
+  uint8_t max1 = dst_minmax[5];
+  uint8_t max2 = dst_minmax[6];
+  uint8_t max3 = dst_minmax[7];
+  int x;
+  for (x = 0; x < width; ++x) {
+    min0 = src_argb[0] < min0 ? src_argb[0] : min0;
+    min1 = src_argb[1] < min1 ? src_argb[1] : min1;
+    min2 = src_argb[2] < min2 ? src_argb[2] : min2;
+    min3 = src_argb[3] < min3 ? src_argb[3] : min3;
+    max0 = src_argb[0] > max0 ? src_argb[0] : max0;
+    max1 = src_argb[1] > max1 ? src_argb[1] : max1;
+    max2 = src_argb[2] > max2 ? src_argb[2] : max2;
+    max3 = src_argb[3] > max3 ? src_argb[3] : max3;
+    src_argb += 4;
+  }
+  dst_minmax[0] = min0;
+  dst_minmax[1] = min1;
+  dst_minmax[2] = min2;
+  dst_minmax[3] = min3;
+  dst_minmax[4] = max0;
+  dst_minmax[5] = max1;
+  dst_minmax[6] = max2;
+  dst_minmax[7] = max3;
+}
+
+void BlockSadRow_C(const uint8_t* src_a,
+                   const uint8_t* src_b,
+                   uint32_t* dst_sum,
+                   int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    int diff = src_a[x] - src_b[x];
+    dst_sum[x >> 3] += (uint32_t)(diff < 0 ? -diff : diff);
+  }
+}
+
+void BlockSseRow_C(const uint8_t* src_a,
+                   const uint8_t* src_b,
+                   uint32_t* dst_sum,
+                   int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    int diff = src_a[x] - src_b[x];
+    dst_sum[x >> 3] += (uint32_t)(diff * diff);
+  }
+}
+
+int BytesEqual_C(const uint8_t* src_a, const uint8_t* src_b, int count) {
+  int i;
+  for (i = 0; i < count - 3; i += 4) {
+    if (*((const uint32_t*)(src_a + i)) != *((const uint32_t*)(src_b + i))) {
+      return 0;
+    }
+  }
+  for (; i < count; ++i) {
+    if (src_a[i] != src_b[i]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+void HashStripes_C(const uint8_t* src,
+                   const uint64_t* key,
+                   uint64_t* acc,
+                   int count) {
+  int x, i;
+  for (x = 0; x < count; x += 64) {
+    for (i = 0; i < 8; ++i) {
+      uint64_t d = *((const uint64_t*)(src + i * 8));
+      uint64_t k = d ^ key[i];
+      acc[i] += (k & 0xffffffffu) * (k >> 32);
+      acc[i ^ 1] += d;
+    }
+    src += 64;
+  }
+}
+
 // hash seed of 5381 recommended.
 // Internal C version of HashDjb2 with int sized count for efficiency.
 uint32_t HashDjb2_C(const uint8_t* src, int count, uint32_t seed) {
@@ -228,6 +228,46 @@ uint32_t HammingDistance_AVX2(const uint8_t* src_a,
 }
 #endif  // HAS_HAMMINGDISTANCE_AVX2
 
+#ifdef HAS_HAMMINGDISTANCE_AVX512VPOPCNTDQ
+// Counts 64 bytes per loop with vpopcntq.  count must be a multiple of 64.
+uint32_t HammingDistance_AVX512VPOPCNTDQ(const uint8_t* src_a,
+                                         const uint8_t* src_b,
+                                         int count) {
+  uint32_t diff = 0u;
+
+  asm volatile(
+      "vpxorq      %%zmm0,%%zmm0,%%zmm0          \n"
+      "sub         %0,%1                         \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu64   (%0),%%zmm1                   \n"
+      "vpxorq      (%0,%1),%%zmm1,%%zmm1         \n"
+      "add         $0x40,%0                      \n"
+      "vpopcntq    %%zmm1,%%zmm1                 \n"
+      "vpaddq      %%zmm1,%%zmm0,%%zmm0          \n"
+      "sub         $0x40,%2                      \n"
+      "jg          1b                            \n"
+
+      "vextracti64x4 $0x1,%%zmm0,%%ymm1          \n"
+      "vpaddq      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpaddq      %%xmm1,%%xmm0,%%xmm0          \n"
+      "vpshufd     $0xee,%%xmm0,%%xmm1           \n"
+      "vpaddq      %%xmm1,%%xmm0,%%xmm0          \n"
+      "vmovd       %%xmm0,%3                     \n"
+      "vzeroupper                                \n"
+      : "+r"(src_a),  // %0
+        "+r"(src_b),  // %1
+        "+r"(count),  // %2
+        "=r"(diff)    // %3
+      :
+      : "memory", "cc", "xmm0", "xmm1");
+
+  return diff;
+}
+#endif  // HAS_HAMMINGDISTANCE_AVX512VPOPCNTDQ
+
 uint32_t SumSquareError_SSE2(const uint8_t* src_a,
                              const uint8_t* src_b,
                              int count) {
@@ -271,6 +311,172 @@ uint32_t SumSquareError_SSE2(const uint8_t* src_a,
   return sse;
 }
 
+#ifdef HAS_SUMSQUAREERROR_AVX512BW
+// Widens 64 bytes per loop to words and squares with vpmaddwd.
+// count must be a multiple of 32.
+uint32_t SumSquareError_AVX512BW(const uint8_t* src_a,
+                                 const uint8_t* src_b,
+                                 int count) {
+  uint32_t sse;
+  asm volatile(
+      "vpxorq      %%zmm0,%%zmm0,%%zmm0          \n"
+      "vpxorq      %%zmm5,%%zmm5,%%zmm5          \n"
+      "sub         $0x40,%2                      \n"
+      "jl          2f                            \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vpmovzxbw   (%0),%%zmm1                   \n"
+      "vpmovzxbw   0x20(%0),%%zmm2               \n"
+      "vpmovzxbw   (%1),%%zmm3                   \n"
+      "vpmovzxbw   0x20(%1),%%zmm4               \n"
+      "lea         0x40(%0),%0                   \n"
+      "lea         0x40(%1),%1                   \n"
+      "vpsubw      %%zmm3,%%zmm1,%%zmm1          \n"
+      "vpsubw      %%zmm4,%%zmm2,%%zmm2          \n"
+      "vpmaddwd    %%zmm1,%%zmm1,%%zmm1          \n"
+      "vpmaddwd    %%zmm2,%%zmm2,%%zmm2          \n"
+      "vpaddd      %%zmm1,%%zmm0,%%zmm0          \n"
+      "vpaddd      %%zmm2,%%zmm5,%%zmm5          \n"
+      "sub         $0x40,%2                      \n"
+      "jge         1b                            \n"
+
+      // Remaining 32 bytes.
+      "2:                                        \n"
+      "add         $0x40,%2                      \n"
+      "jle         3f                            \n"
+      "vpmovzxbw   (%0),%%zmm1                   \n"
+      "vpmovzxbw   (%1),%%zmm3                   \n"
+      "vpsubw      %%zmm3,%%zmm1,%%zmm1          \n"
+      "vpmaddwd    %%zmm1,%%zmm1,%%zmm1          \n"
+      "vpaddd      %%zmm1,%%zmm0,%%zmm0          \n"
+
+      "3:                                        \n"
+      "vpaddd      %%zmm5,%%zmm0,%%zmm0          \n"
+      "vextracti64x4 $0x1,%%zmm0,%%ymm1          \n"
+      "vpaddd      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpaddd      %%xmm1,%%xmm0,%%xmm0          \n"
+      "vpshufd     $0xee,%%xmm0,%%xmm1           \n"
+      "vpaddd      %%xmm1,%%xmm0,%%xmm0          \n"
+      "vpshufd     $0x1,%%xmm0,%%xmm1            \n"
+      "vpaddd      %%xmm1,%%xmm0,%%xmm0          \n"
+      "vmovd       %%xmm0,%3                     \n"
+      "vzeroupper                                \n"
+
+      : "+r"(src_a),  // %0
+        "+r"(src_b),  // %1
+        "+r"(count),  // %2
+        "=g"(sse)     // %3
+        ::"memory",
+        "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+  return sse;
+}
+#endif  // HAS_SUMSQUAREERROR_AVX512BW
+
+#ifdef HAS_SUMSQUAREERROR_16_SSE2
+// Absolute differences are zero extended to dwords and squared with pmuludq
+// into 64 bit lanes, so the full 16 bit range can not overflow.
+uint64_t SumSquareError_16_SSE2(const uint16_t* src_a,
+                                const uint16_t* src_b,
+                                int count) {
+  uint64_t sse;
+  asm volatile(
+      "pxor        %%xmm0,%%xmm0                 \n"
+      "pxor        %%xmm5,%%xmm5                 \n"
+      "sub         %0,%1                         \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm1                   \n"
+      "movdqu      (%0,%1),%%xmm2                \n"
+      "lea         0x10(%0),%0                   \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "psubusw     %%xmm2,%%xmm1                 \n"
+      "psubusw     %%xmm3,%%xmm2                 \n"
+      "por         %%xmm2,%%xmm1                 \n"
+      "movdqa      %%xmm1,%%xmm2                 \n"
+      "punpcklwd   %%xmm5,%%xmm1                 \n"
+      "punpckhwd   %%xmm5,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "movdqa      %%xmm2,%%xmm4                 \n"
+      "psrlq       $0x20,%%xmm3                  \n"
+      "psrlq       $0x20,%%xmm4                  \n"
+      "pmuludq     %%xmm1,%%xmm1                 \n"
+      "pmuludq     %%xmm2,%%xmm2                 \n"
+      "pmuludq     %%xmm3,%%xmm3                 \n"
+      "pmuludq     %%xmm4,%%xmm4                 \n"
+      "paddq       %%xmm1,%%xmm0                 \n"
+      "paddq       %%xmm2,%%xmm0                 \n"
+      "paddq       %%xmm3,%%xmm0                 \n"
+      "paddq       %%xmm4,%%xmm0                 \n"
+      "sub         $0x8,%2                       \n"
+      "jg          1b                            \n"
+
+      "pshufd      $0xee,%%xmm0,%%xmm1           \n"
+      "paddq       %%xmm1,%%xmm0                 \n"
+      "movq        %%xmm0,%3                     \n"
+
+      : "+r"(src_a),  // %0
+        "+r"(src_b),  // %1
+        "+r"(count),  // %2
+        "=m"(sse)     // %3
+        ::"memory",
+        "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+  return sse;
+}
+#endif  // HAS_SUMSQUAREERROR_16_SSE2
+
+#ifdef HAS_SUMSQUAREERROR_16_AVX2
+uint64_t SumSquareError_16_AVX2(const uint16_t* src_a,
+                                const uint16_t* src_b,
+                                int count) {
+  uint64_t sse;
+  asm volatile(
+      "vpxor       %%ymm0,%%ymm0,%%ymm0          \n"
+      "vpxor       %%ymm5,%%ymm5,%%ymm5          \n"
+      "sub         %0,%1                         \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm1                   \n"
+      "vmovdqu     (%0,%1),%%ymm2                \n"
+      "lea         0x20(%0),%0                   \n"
+      "vpsubusw    %%ymm2,%%ymm1,%%ymm3          \n"
+      "vpsubusw    %%ymm1,%%ymm2,%%ymm2          \n"
+      "vpor        %%ymm2,%%ymm3,%%ymm1          \n"
+      "vpunpckhwd  %%ymm5,%%ymm1,%%ymm2          \n"
+      "vpunpcklwd  %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpsrlq      $0x20,%%ymm1,%%ymm3           \n"
+      "vpsrlq      $0x20,%%ymm2,%%ymm4           \n"
+      "vpmuludq    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpmuludq    %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpmuludq    %%ymm3,%%ymm3,%%ymm3          \n"
+      "vpmuludq    %%ymm4,%%ymm4,%%ymm4          \n"
+      "vpaddq      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpaddq      %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpaddq      %%ymm3,%%ymm0,%%ymm0          \n"
+      "vpaddq      %%ymm4,%%ymm0,%%ymm0          \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpaddq      %%xmm1,%%xmm0,%%xmm0          \n"
+      "vpshufd     $0xee,%%xmm0,%%xmm1           \n"
+      "vpaddq      %%xmm1,%%xmm0,%%xmm0          \n"
+      "vmovq       %%xmm0,%3                     \n"
+      "vzeroupper                                \n"
+
+      : "+r"(src_a),  // %0
+        "+r"(src_b),  // %1
+        "+r"(count),  // %2
+        "=m"(sse)     // %3
+        ::"memory",
+        "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+  return sse;
+}
+#endif  // HAS_SUMSQUAREERROR_16_AVX2
+
 static const uvec32 kHash16x33 = {0x92d9e201, 0, 0, 0};  // 33 ^ 16
 static const uvec32 kHashMul0 = {
     0x0c3525e1,  // 33 ^ 15
@@ -351,6 +557,502 @@ uint32_t HashDjb2_SSE41(const uint8_t* src, int count, uint32_t seed) {
         "xmm7");
   return hash;
 }
+
+#if defined(HAS_ARGBDETECTROW_SSE2) || defined(HAS_ARGBDETECTROW_AVX2)
+// Sets the 2 middle bytes of each pixel so only first and last are tested.
+static const uvec32 kARGBDetectMask = {0x00ffff00u, 0x00ffff00u, 0x00ffff00u,
+                                       0x00ffff00u};
+#endif
+
+#ifdef HAS_ARGBDETECTROW_SSE2
+// Skip runs of 8 pixels that are opaque as both ARGB and BGRA, then let the C
+// version resolve the first block that is not.
+uint32_t ARGBDetectRow_SSE2(const uint8_t* argb, int width) {
+  int mask;
+  asm volatile(
+      "pcmpeqb     %%xmm5,%%xmm5                 \n"
+      "movdqa      %3,%%xmm4                     \n"
+      "sub         $0x8,%1                       \n"
+      "jl          2f                            \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "pand        %%xmm1,%%xmm0                 \n"
+      "por         %%xmm4,%%xmm0                 \n"
+      "pcmpeqb     %%xmm5,%%xmm0                 \n"
+      "pmovmskb    %%xmm0,%2                     \n"
+      "cmp         $0xffff,%2                    \n"
+      "jne         2f                            \n"
+      "lea         0x20(%0),%0                   \n"
+      "sub         $0x8,%1                       \n"
+      "jge         1b                            \n"
+
+      "2:                                        \n"
+      "add         $0x8,%1                       \n"
+      : "+r"(argb),           // %0
+        "+r"(width),          // %1
+        "=&r"(mask)           // %2
+      : "m"(kARGBDetectMask)  // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm4", "xmm5");
+  return ARGBDetectRow_C(argb, width);
+}
+#endif  // HAS_ARGBDETECTROW_SSE2
+
+#ifdef HAS_ARGBDETECTROW_AVX2
+// Skip runs of 16 pixels that are opaque as both ARGB and BGRA.
+uint32_t ARGBDetectRow_AVX2(const uint8_t* argb, int width) {
+  int mask;
+  asm volatile(
+      "vpcmpeqb    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vbroadcastss %3,%%ymm4                    \n"
+      "sub         $0x10,%1                      \n"
+      "jl          2f                            \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vpand       0x20(%0),%%ymm0,%%ymm0        \n"
+      "vpor        %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpcmpeqb    %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpmovmskb   %%ymm0,%2                     \n"
+      "cmp         $0xffffffff,%2                \n"
+      "jne         2f                            \n"
+      "lea         0x40(%0),%0                   \n"
+      "sub         $0x10,%1                      \n"
+      "jge         1b                            \n"
+
+      "2:                                        \n"
+      "add         $0x10,%1                      \n"
+      "vzeroupper                                \n"
+      : "+r"(argb),           // %0
+        "+r"(width),          // %1
+        "=&r"(mask)           // %2
+      : "m"(kARGBDetectMask)  // %3
+      : "memory", "cc", "xmm0", "xmm4", "xmm5");
+  return ARGBDetectRow_C(argb, width);
+}
+#endif  // HAS_ARGBDETECTROW_AVX2
+
+#ifdef HAS_ARGBMINMAXROW_SSE2
+// Reduce 8 pixels per loop. Width must be a multiple of 8.
+void ARGBMinMaxRow_SSE2(const uint8_t* src_argb,
+                        uint8_t* dst_minmax,
+                        int width) {
+  asm volatile(
+      "movd        (%1),%%xmm0                   \n"
+      "movd        0x4(%1),%%xmm1                \n"
+      "pshufd      $0x0,%%xmm0,%%xmm0            \n"
+      "pshufd      $0x0,%%xmm1,%%xmm1            \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm4                   \n"
+      "movdqu      0x10(%0),%%xmm5               \n"
+      "lea         0x20(%0),%0                   \n"
+      "pminub      %%xmm4,%%xmm0                 \n"
+      "pmaxub      %%xmm4,%%xmm1                 \n"
+      "pminub      %%xmm5,%%xmm2                 \n"
+      "pmaxub      %%xmm5,%%xmm3                 \n"
+      "sub         $0x8,%2                       \n"
+      "jg          1b                            \n"
+
+      "pminub      %%xmm2,%%xmm0                 \n"
+      "pmaxub      %%xmm3,%%xmm1                 \n"
+      "pshufd      $0x4e,%%xmm0,%%xmm2           \n"
+      "pshufd      $0x4e,%%xmm1,%%xmm3           \n"
+      "pminub      %%xmm2,%%xmm0                 \n"
+      "pmaxub      %%xmm3,%%xmm1                 \n"
+      "pshufd      $0xb1,%%xmm0,%%xmm2           \n"
+      "pshufd      $0xb1,%%xmm1,%%xmm3           \n"
+      "pminub      %%xmm2,%%xmm0                 \n"
+      "pmaxub      %%xmm3,%%xmm1                 \n"
+      "movd        %%xmm0,(%1)                   \n"
+      "movd        %%xmm1,0x4(%1)                \n"
+      : "+r"(src_argb),    // %0
+        "+r"(dst_minmax),  // %1
+        "+r"(width)        // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_ARGBMINMAXROW_SSE2
+
+#ifdef HAS_ARGBMINMAXROW_AVX2
+// Reduce 16 pixels per loop. Width must be a multiple of 16.
+void ARGBMinMaxRow_AVX2(const uint8_t* src_argb,
+                        uint8_t* dst_minmax,
+                        int width) {
+  asm volatile(
+      "vbroadcastss (%1),%%ymm0                  \n"
+      "vbroadcastss 0x4(%1),%%ymm1               \n"
+      "vmovdqa     %%ymm0,%%ymm2                 \n"
+      "vmovdqa     %%ymm1,%%ymm3                 \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm4                   \n"
+      "vmovdqu     0x20(%0),%%ymm5               \n"
+      "lea         0x40(%0),%0                   \n"
+      "vpminub     %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpmaxub     %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpminub     %%ymm5,%%ymm2,%%ymm2          \n"
+      "vpmaxub     %%ymm5,%%ymm3,%%ymm3          \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+
+      "vpminub     %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpmaxub     %%ymm3,%%ymm1,%%ymm1          \n"
+      "vextracti128 $0x1,%%ymm0,%%xmm2           \n"
+      "vextracti128 $0x1,%%ymm1,%%xmm3           \n"
+      "vpminub     %%xmm2,%%xmm0,%%xmm0          \n"
+      "vpmaxub     %%xmm3,%%xmm1,%%xmm1          \n"
+      "vpshufd     $0x4e,%%xmm0,%%xmm2           \n"
+      "vpshufd     $0x4e,%%xmm1,%%xmm3           \n"
+      "vpminub     %%xmm2,%%xmm0,%%xmm0          \n"
+      "vpmaxub     %%xmm3,%%xmm1,%%xmm1          \n"
+      "vpshufd     $0xb1,%%xmm0,%%xmm2           \n"
+      "vpshufd     $0xb1,%%xmm1,%%xmm3           \n"
+      "vpminub     %%xmm2,%%xmm0,%%xmm0          \n"
+      "vpmaxub     %%xmm3,%%xmm1,%%xmm1          \n"
+      "vmovd       %%xmm0,(%1)                   \n"
+      "vmovd       %%xmm1,0x4(%1)                \n"
+      "vzeroupper                                \n"
+      : "+r"(src_argb),    // %0
+        "+r"(dst_minmax),  // %1
+        "+r"(width)        // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_ARGBMINMAXROW_AVX2
+
+#ifdef HAS_BLOCKSADROW_SSE2
+// Accumulate SAD of 2 groups of 8 pixels per loop.
+void BlockSadRow_SSE2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width) {
+  asm volatile(
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "movdqu      (%1),%%xmm1                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "psadbw      %%xmm1,%%xmm0                 \n"
+      "pshufd      $0x8,%%xmm0,%%xmm0            \n"
+      "movq        (%2),%%xmm1                   \n"
+      "paddd       %%xmm1,%%xmm0                 \n"
+      "movq        %%xmm0,(%2)                   \n"
+      "lea         0x8(%2),%2                    \n"
+      "sub         $0x10,%3                      \n"
+      "jg          1b                            \n"
+      : "+r"(src_a),    // %0
+        "+r"(src_b),    // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "memory", "cc", "xmm0", "xmm1");
+}
+#endif  // HAS_BLOCKSADROW_SSE2
+
+#ifdef HAS_BLOCKSADROW_AVX2
+// Accumulate SAD of 4 groups of 8 pixels per loop.
+void BlockSadRow_AVX2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width) {
+  asm volatile(
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "lea         0x20(%0),%0                   \n"
+      "vpsadbw     (%1),%%ymm0,%%ymm0            \n"
+      "lea         0x20(%1),%1                   \n"
+      "vpshufd     $0x8,%%ymm0,%%ymm0            \n"
+      "vpermq      $0x8,%%ymm0,%%ymm0            \n"
+      "vpaddd      (%2),%%xmm0,%%xmm0            \n"
+      "vmovdqu     %%xmm0,(%2)                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "sub         $0x20,%3                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_a),    // %0
+        "+r"(src_b),    // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "memory", "cc", "xmm0");
+}
+#endif  // HAS_BLOCKSADROW_AVX2
+
+#ifdef HAS_BLOCKSSEROW_SSE2
+// Accumulate SSE of 2 groups of 8 pixels per loop.
+void BlockSseRow_SSE2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width) {
+  asm volatile(
+      "pxor        %%xmm5,%%xmm5                 \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm1                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "movdqu      (%1),%%xmm2                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "psubusb     %%xmm2,%%xmm1                 \n"
+      "psubusb     %%xmm3,%%xmm2                 \n"
+      "por         %%xmm2,%%xmm1                 \n"
+      "movdqa      %%xmm1,%%xmm2                 \n"
+      "punpcklbw   %%xmm5,%%xmm1                 \n"
+      "punpckhbw   %%xmm5,%%xmm2                 \n"
+      "pmaddwd     %%xmm1,%%xmm1                 \n"
+      "pmaddwd     %%xmm2,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "punpckldq   %%xmm2,%%xmm1                 \n"
+      "punpckhdq   %%xmm2,%%xmm3                 \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "pshufd      $0xee,%%xmm1,%%xmm3           \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "movq        (%2),%%xmm3                   \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "movq        %%xmm1,(%2)                   \n"
+      "lea         0x8(%2),%2                    \n"
+      "sub         $0x10,%3                      \n"
+      "jg          1b                            \n"
+      : "+r"(src_a),    // %0
+        "+r"(src_b),    // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "memory", "cc", "xmm1", "xmm2", "xmm3", "xmm5");
+}
+#endif  // HAS_BLOCKSSEROW_SSE2
+
+#ifdef HAS_BLOCKSSEROW_AVX2
+// Accumulate SSE of 4 groups of 8 pixels per loop.
+void BlockSseRow_AVX2(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width) {
+  asm volatile(
+      "vpxor       %%ymm5,%%ymm5,%%ymm5          \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm1                   \n"
+      "lea         0x20(%0),%0                   \n"
+      "vmovdqu     (%1),%%ymm2                   \n"
+      "lea         0x20(%1),%1                   \n"
+      "vpsubusb    %%ymm2,%%ymm1,%%ymm3          \n"
+      "vpsubusb    %%ymm1,%%ymm2,%%ymm2          \n"
+      "vpor        %%ymm2,%%ymm3,%%ymm1          \n"
+      "vpunpckhbw  %%ymm5,%%ymm1,%%ymm2          \n"
+      "vpunpcklbw  %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpmaddwd    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpmaddwd    %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpunpckhdq  %%ymm2,%%ymm1,%%ymm3          \n"
+      "vpunpckldq  %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpaddd      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vpshufd     $0xee,%%ymm1,%%ymm3           \n"
+      "vpaddd      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vpermq      $0x8,%%ymm1,%%ymm1            \n"
+      "vpaddd      (%2),%%xmm1,%%xmm1            \n"
+      "vmovdqu     %%xmm1,(%2)                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "sub         $0x20,%3                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_a),    // %0
+        "+r"(src_b),    // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "memory", "cc", "xmm1", "xmm2", "xmm3", "xmm5");
+}
+#endif  // HAS_BLOCKSSEROW_AVX2
+
+#ifdef HAS_BYTESEQUAL_SSE2
+// Compare 64 bytes per loop and stop at the first difference.
+int BytesEqual_SSE2(const uint8_t* src_a, const uint8_t* src_b, int count) {
+  int mask;
+  asm volatile(
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "movdqu      (%1),%%xmm2                   \n"
+      "movdqu      0x10(%1),%%xmm3               \n"
+      "pcmpeqb     %%xmm2,%%xmm0                 \n"
+      "pcmpeqb     %%xmm3,%%xmm1                 \n"
+      "pand        %%xmm1,%%xmm0                 \n"
+      "movdqu      0x20(%0),%%xmm1               \n"
+      "movdqu      0x30(%0),%%xmm2               \n"
+      "movdqu      0x20(%1),%%xmm3               \n"
+      "movdqu      0x30(%1),%%xmm4               \n"
+      "pcmpeqb     %%xmm3,%%xmm1                 \n"
+      "pcmpeqb     %%xmm4,%%xmm2                 \n"
+      "pand        %%xmm2,%%xmm1                 \n"
+      "pand        %%xmm1,%%xmm0                 \n"
+      "pmovmskb    %%xmm0,%3                     \n"
+      "cmp         $0xffff,%3                    \n"
+      "jne         2f                            \n"
+      "lea         0x40(%0),%0                   \n"
+      "lea         0x40(%1),%1                   \n"
+      "sub         $0x40,%2                      \n"
+      "jg          1b                            \n"
+      "2:                                        \n"
+      : "+r"(src_a),  // %0
+        "+r"(src_b),  // %1
+        "+r"(count),  // %2
+        "=&r"(mask)   // %3
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4");
+  return mask == 0xffff;
+}
+#endif  // HAS_BYTESEQUAL_SSE2
+
+#ifdef HAS_BYTESEQUAL_AVX2
+// Compare 64 bytes per loop and stop at the first difference.
+int BytesEqual_AVX2(const uint8_t* src_a, const uint8_t* src_b, int count) {
+  int mask;
+  asm volatile(
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "vpcmpeqb    (%1),%%ymm0,%%ymm0            \n"
+      "vpcmpeqb    0x20(%1),%%ymm1,%%ymm1        \n"
+      "vpand       %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpmovmskb   %%ymm0,%3                     \n"
+      "cmp         $0xffffffff,%3                \n"
+      "jne         2f                            \n"
+      "lea         0x40(%0),%0                   \n"
+      "lea         0x40(%1),%1                   \n"
+      "sub         $0x40,%2                      \n"
+      "jg          1b                            \n"
+      "2:                                        \n"
+      "vzeroupper                                \n"
+      : "+r"(src_a),  // %0
+        "+r"(src_b),  // %1
+        "+r"(count),  // %2
+        "=&r"(mask)   // %3
+      :
+      : "memory", "cc", "xmm0", "xmm1");
+  return mask == -1;
+}
+#endif  // HAS_BYTESEQUAL_AVX2
+
+#ifdef HAS_HASHSTRIPES_SSE2
+// Hash 64 bytes per loop with 2 lanes per register.
+void HashStripes_SSE2(const uint8_t* src,
+                      const uint64_t* key,
+                      uint64_t* acc,
+                      int count) {
+  asm volatile(
+      "movdqu      (%3),%%xmm0                   \n"
+      "movdqu      0x10(%3),%%xmm1               \n"
+      "movdqu      0x20(%3),%%xmm2               \n"
+      "movdqu      0x30(%3),%%xmm3               \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm4                   \n"
+      "movdqu      (%2),%%xmm5                   \n"
+      "pxor        %%xmm4,%%xmm5                 \n"
+      "pshufd      $0xf5,%%xmm5,%%xmm6           \n"
+      "pmuludq     %%xmm6,%%xmm5                 \n"
+      "pshufd      $0x4e,%%xmm4,%%xmm4           \n"
+      "paddq       %%xmm5,%%xmm0                 \n"
+      "paddq       %%xmm4,%%xmm0                 \n"
+      "movdqu      0x10(%0),%%xmm4               \n"
+      "movdqu      0x10(%2),%%xmm5               \n"
+      "pxor        %%xmm4,%%xmm5                 \n"
+      "pshufd      $0xf5,%%xmm5,%%xmm6           \n"
+      "pmuludq     %%xmm6,%%xmm5                 \n"
+      "pshufd      $0x4e,%%xmm4,%%xmm4           \n"
+      "paddq       %%xmm5,%%xmm1                 \n"
+      "paddq       %%xmm4,%%xmm1                 \n"
+      "movdqu      0x20(%0),%%xmm4               \n"
+      "movdqu      0x20(%2),%%xmm5               \n"
+      "pxor        %%xmm4,%%xmm5                 \n"
+      "pshufd      $0xf5,%%xmm5,%%xmm6           \n"
+      "pmuludq     %%xmm6,%%xmm5                 \n"
+      "pshufd      $0x4e,%%xmm4,%%xmm4           \n"
+      "paddq       %%xmm5,%%xmm2                 \n"
+      "paddq       %%xmm4,%%xmm2                 \n"
+      "movdqu      0x30(%0),%%xmm4               \n"
+      "movdqu      0x30(%2),%%xmm5               \n"
+      "pxor        %%xmm4,%%xmm5                 \n"
+      "pshufd      $0xf5,%%xmm5,%%xmm6           \n"
+      "pmuludq     %%xmm6,%%xmm5                 \n"
+      "pshufd      $0x4e,%%xmm4,%%xmm4           \n"
+      "paddq       %%xmm5,%%xmm3                 \n"
+      "paddq       %%xmm4,%%xmm3                 \n"
+      "lea         0x40(%0),%0                   \n"
+      "sub         $0x40,%1                      \n"
+      "jg          1b                            \n"
+
+      "movdqu      %%xmm0,(%3)                   \n"
+      "movdqu      %%xmm1,0x10(%3)               \n"
+      "movdqu      %%xmm2,0x20(%3)               \n"
+      "movdqu      %%xmm3,0x30(%3)               \n"
+      : "+r"(src),   // %0
+        "+r"(count)  // %1
+      : "r"(key),    // %2
+        "r"(acc)     // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+        "xmm6");
+}
+#endif  // HAS_HASHSTRIPES_SSE2
+
+#ifdef HAS_HASHSTRIPES_AVX2
+// Hash 64 bytes per loop with 4 lanes per register.
+void HashStripes_AVX2(const uint8_t* src,
+                      const uint64_t* key,
+                      uint64_t* acc,
+                      int count) {
+  asm volatile(
+      "vmovdqu     (%3),%%ymm0                   \n"
+      "vmovdqu     0x20(%3),%%ymm1               \n"
+      "vmovdqu     (%2),%%ymm2                   \n"
+      "vmovdqu     0x20(%2),%%ymm3               \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm4                   \n"
+      "vmovdqu     0x20(%0),%%ymm5               \n"
+      "vpxor       %%ymm2,%%ymm4,%%ymm6          \n"
+      "vpshufd     $0xf5,%%ymm6,%%ymm7           \n"
+      "vpmuludq    %%ymm7,%%ymm6,%%ymm6          \n"
+      "vpshufd     $0x4e,%%ymm4,%%ymm4           \n"
+      "vpaddq      %%ymm6,%%ymm0,%%ymm0          \n"
+      "vpaddq      %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpxor       %%ymm3,%%ymm5,%%ymm6          \n"
+      "vpshufd     $0xf5,%%ymm6,%%ymm7           \n"
+      "vpmuludq    %%ymm7,%%ymm6,%%ymm6          \n"
+      "vpshufd     $0x4e,%%ymm5,%%ymm5           \n"
+      "vpaddq      %%ymm6,%%ymm1,%%ymm1          \n"
+      "vpaddq      %%ymm5,%%ymm1,%%ymm1          \n"
+      "lea         0x40(%0),%0                   \n"
+      "sub         $0x40,%1                      \n"
+      "jg          1b                            \n"
+
+      "vmovdqu     %%ymm0,(%3)                   \n"
+      "vmovdqu     %%ymm1,0x20(%3)               \n"
+      "vzeroupper                                \n"
+      : "+r"(src),   // %0
+        "+r"(count)  // %1
+      : "r"(key),    // %2
+        "r"(acc)     // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+        "xmm6", "xmm7");
+}
+#endif  // HAS_HASHSTRIPES_AVX2
 #endif  // defined(__x86_64__) || (defined(__i386__) && !defined(__pic__)))
 
 #ifdef __cplusplus
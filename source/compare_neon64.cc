@@ -86,6 +86,249 @@ uint32_t SumSquareError_NEON(const uint8_t* src_a,
   return sse;
 }
 
+// Absolute differences are squared into 32 bits with umull and pairwise
+// accumulated into 64 bit lanes with uadalp.
+uint64_t SumSquareError_16_NEON(const uint16_t* src_a,
+                                const uint16_t* src_b,
+                                int count) {
+  uint64_t sse;
+  asm volatile(
+      "movi        v16.2d, #0                    \n"
+      "movi        v17.2d, #0                    \n"
+
+      "1:                                        \n"
+      "ld1         {v0.8h, v1.8h}, [%0], #32     \n"
+      "ld1         {v2.8h, v3.8h}, [%1], #32     \n"
+      "subs        %w2, %w2, #16                 \n"
+      "uabd        v0.8h, v0.8h, v2.8h           \n"
+      "uabd        v1.8h, v1.8h, v3.8h           \n"
+      "prfm        pldl1keep, [%0, 448]          \n"  // prefetch 7 lines ahead
+      "umull       v4.4s, v0.4h, v0.4h           \n"
+      "umull2      v5.4s, v0.8h, v0.8h           \n"
+      "umull       v6.4s, v1.4h, v1.4h           \n"
+      "umull2      v7.4s, v1.8h, v1.8h           \n"
+      "prfm        pldl1keep, [%1, 448]          \n"
+      "uadalp      v16.2d, v4.4s                 \n"
+      "uadalp      v17.2d, v5.4s                 \n"
+      "uadalp      v16.2d, v6.4s                 \n"
+      "uadalp      v17.2d, v7.4s                 \n"
+      "b.gt        1b                            \n"
+
+      "add         v16.2d, v16.2d, v17.2d        \n"
+      "addp        d0, v16.2d                    \n"
+      "fmov        %3, d0                        \n"
+      : "+r"(src_a), "+r"(src_b), "+r"(count), "=r"(sse)
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16",
+        "v17");
+  return sse;
+}
+
+// Skip runs of 16 pixels that are opaque as both ARGB and BGRA, then let the C
+// version resolve the first block that is not.
+uint32_t ARGBDetectRow_NEON(const uint8_t* argb, int width) {
+  int alpha;
+  asm volatile(
+      "subs        %w1, %w1, #16                 \n"
+      "b.lt        2f                            \n"
+      "1:                                        \n"
+      "ld4         {v0.16b,v1.16b,v2.16b,v3.16b}, [%0] \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "and         v0.16b, v0.16b, v3.16b        \n"
+      "uminv       b0, v0.16b                    \n"
+      "umov        %w2, v0.b[0]                  \n"
+      "cmp         %w2, #255                     \n"
+      "b.ne        2f                            \n"
+      "add         %0, %0, #64                   \n"
+      "subs        %w1, %w1, #16                 \n"
+      "b.ge        1b                            \n"
+      "2:                                        \n"
+      "add         %w1, %w1, #16                 \n"
+      : "+r"(argb),   // %0
+        "+r"(width),  // %1
+        "=&r"(alpha)  // %2
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3");
+  return ARGBDetectRow_C(argb, width);
+}
+
+// Reduce 16 pixels per loop. Width must be a multiple of 16.
+void ARGBMinMaxRow_NEON(const uint8_t* src_argb,
+                        uint8_t* dst_minmax,
+                        int width) {
+  asm volatile(
+      "ld1r        {v0.4s}, [%1]                 \n"
+      "add         %1, %1, #4                    \n"
+      "ld1r        {v1.4s}, [%1]                 \n"
+      "1:                                        \n"
+      "ld1         {v2.16b,v3.16b,v4.16b,v5.16b}, [%0], #64 \n"
+      "subs        %w2, %w2, #16                 \n"
+      "umin        v6.16b, v2.16b, v3.16b        \n"
+      "umax        v7.16b, v2.16b, v3.16b        \n"
+      "umin        v16.16b, v4.16b, v5.16b       \n"
+      "umax        v17.16b, v4.16b, v5.16b       \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "umin        v6.16b, v6.16b, v16.16b       \n"
+      "umax        v7.16b, v7.16b, v17.16b       \n"
+      "umin        v0.16b, v0.16b, v6.16b        \n"
+      "umax        v1.16b, v1.16b, v7.16b        \n"
+      "b.gt        1b                            \n"
+
+      "ext         v2.16b, v0.16b, v0.16b, #8    \n"
+      "ext         v3.16b, v1.16b, v1.16b, #8    \n"
+      "umin        v0.8b, v0.8b, v2.8b           \n"
+      "umax        v1.8b, v1.8b, v3.8b           \n"
+      "ext         v2.8b, v0.8b, v0.8b, #4       \n"
+      "ext         v3.8b, v1.8b, v1.8b, #4       \n"
+      "umin        v0.8b, v0.8b, v2.8b           \n"
+      "umax        v1.8b, v1.8b, v3.8b           \n"
+      "st1         {v1.s}[0], [%1]               \n"
+      "sub         %1, %1, #4                    \n"
+      "st1         {v0.s}[0], [%1]               \n"
+      : "+r"(src_argb),    // %0
+        "+r"(dst_minmax),  // %1
+        "+r"(width)        // %2
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16",
+        "v17");
+}
+
+// Accumulate SAD of 2 groups of 8 pixels per loop.
+void BlockSadRow_NEON(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width) {
+  asm volatile(
+      "1:                                        \n"
+      "ld1         {v0.16b}, [%0], #16           \n"
+      "ld1         {v1.16b}, [%1], #16           \n"
+      "subs        %w3, %w3, #16                 \n"
+      "uabdl       v2.8h, v0.8b, v1.8b           \n"
+      "uabdl2      v3.8h, v0.16b, v1.16b         \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "addp        v2.8h, v2.8h, v3.8h           \n"
+      "prfm        pldl1keep, [%1, 448]          \n"
+      "addp        v2.8h, v2.8h, v2.8h           \n"
+      "ld1         {v4.2s}, [%2]                 \n"
+      "addp        v2.8h, v2.8h, v2.8h           \n"
+      "uaddw       v4.4s, v4.4s, v2.4h           \n"
+      "st1         {v4.2s}, [%2], #8             \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_a),    // %0
+        "+r"(src_b),    // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4");
+}
+
+// Accumulate SSE of 2 groups of 8 pixels per loop.
+void BlockSseRow_NEON(const uint8_t* src_a,
+                      const uint8_t* src_b,
+                      uint32_t* dst_sum,
+                      int width) {
+  asm volatile(
+      "1:                                        \n"
+      "ld1         {v0.16b}, [%0], #16           \n"
+      "ld1         {v1.16b}, [%1], #16           \n"
+      "subs        %w3, %w3, #16                 \n"
+      "uabd        v0.16b, v0.16b, v1.16b        \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "umull       v2.8h, v0.8b, v0.8b           \n"
+      "umull2      v3.8h, v0.16b, v0.16b         \n"
+      "prfm        pldl1keep, [%1, 448]          \n"
+      "uaddlp      v2.4s, v2.8h                  \n"
+      "uaddlp      v3.4s, v3.8h                  \n"
+      "ld1         {v4.2s}, [%2]                 \n"
+      "addp        v2.4s, v2.4s, v3.4s           \n"
+      "addp        v2.4s, v2.4s, v2.4s           \n"
+      "add         v4.2s, v4.2s, v2.2s           \n"
+      "st1         {v4.2s}, [%2], #8             \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_a),    // %0
+        "+r"(src_b),    // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4");
+}
+
+// Compare 64 bytes per loop and stop at the first difference.
+int BytesEqual_NEON(const uint8_t* src_a, const uint8_t* src_b, int count) {
+  int diff;
+  asm volatile(
+      "1:                                        \n"
+      "ld1         {v0.16b,v1.16b,v2.16b,v3.16b}, [%0], #64 \n"
+      "ld1         {v4.16b,v5.16b,v6.16b,v7.16b}, [%1], #64 \n"
+      "eor         v0.16b, v0.16b, v4.16b        \n"
+      "eor         v1.16b, v1.16b, v5.16b        \n"
+      "eor         v2.16b, v2.16b, v6.16b        \n"
+      "eor         v3.16b, v3.16b, v7.16b        \n"
+      "orr         v0.16b, v0.16b, v1.16b        \n"
+      "orr         v2.16b, v2.16b, v3.16b        \n"
+      "orr         v0.16b, v0.16b, v2.16b        \n"
+      "umaxv       b0, v0.16b                    \n"
+      "umov        %w3, v0.b[0]                  \n"
+      "cbnz        %w3, 2f                       \n"
+      "subs        %w2, %w2, #64                 \n"
+      "b.gt        1b                            \n"
+      "2:                                        \n"
+      : "+r"(src_a),  // %0
+        "+r"(src_b),  // %1
+        "+r"(count),  // %2
+        "=&r"(diff)   // %3
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7");
+  return diff == 0;
+}
+
+// Hash 64 bytes per loop with 2 lanes per register.
+void HashStripes_NEON(const uint8_t* src,
+                      const uint64_t* key,
+                      uint64_t* acc,
+                      int count) {
+  asm volatile(
+      "ld1         {v16.2d,v17.2d,v18.2d,v19.2d}, [%3] \n"
+      "ld1         {v20.2d,v21.2d,v22.2d,v23.2d}, [%2] \n"
+      "1:                                        \n"
+      "ld1         {v0.2d,v1.2d,v2.2d,v3.2d}, [%0], #64 \n"
+      "subs        %w1, %w1, #64                 \n"
+      "eor         v4.16b, v0.16b, v20.16b       \n"
+      "eor         v5.16b, v1.16b, v21.16b       \n"
+      "eor         v6.16b, v2.16b, v22.16b       \n"
+      "eor         v7.16b, v3.16b, v23.16b       \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "xtn         v24.2s, v4.2d                 \n"
+      "shrn        v4.2s, v4.2d, #32             \n"
+      "xtn         v25.2s, v5.2d                 \n"
+      "shrn        v5.2s, v5.2d, #32             \n"
+      "xtn         v26.2s, v6.2d                 \n"
+      "shrn        v6.2s, v6.2d, #32             \n"
+      "xtn         v27.2s, v7.2d                 \n"
+      "shrn        v7.2s, v7.2d, #32             \n"
+      "umlal       v16.2d, v24.2s, v4.2s         \n"
+      "umlal       v17.2d, v25.2s, v5.2s         \n"
+      "umlal       v18.2d, v26.2s, v6.2s         \n"
+      "umlal       v19.2d, v27.2s, v7.2s         \n"
+      "ext         v0.16b, v0.16b, v0.16b, #8    \n"
+      "ext         v1.16b, v1.16b, v1.16b, #8    \n"
+      "ext         v2.16b, v2.16b, v2.16b, #8    \n"
+      "ext         v3.16b, v3.16b, v3.16b, #8    \n"
+      "add         v16.2d, v16.2d, v0.2d         \n"
+      "add         v17.2d, v17.2d, v1.2d         \n"
+      "add         v18.2d, v18.2d, v2.2d         \n"
+      "add         v19.2d, v19.2d, v3.2d         \n"
+      "b.gt        1b                            \n"
+      "st1         {v16.2d,v17.2d,v18.2d,v19.2d}, [%3] \n"
+      : "+r"(src),   // %0
+        "+r"(count)  // %1
+      : "r"(key),    // %2
+        "r"(acc)     // %3
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16",
+        "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25", "v26",
+        "v27");
+}
+
 #endif  // !defined(LIBYUV_DISABLE_NEON) && defined(__aarch64__)
 
 #ifdef __cplusplus
@@ -10,6 +10,8 @@
 
 #include "libyuv/convert.h"
 
+#include <string.h>  // For memcpy
+
 #include "libyuv/basic_types.h"
 #include "libyuv/cpu_id.h"
 #include "libyuv/planar_functions.h"
@@ -18,6 +20,7 @@
 #include "libyuv/scale.h"      // For ScalePlane()
 #include "libyuv/scale_row.h"  // For FixedDiv
 #include "libyuv/scale_uv.h"   // For UVScale()
+#include "libyuv/video_common.h"
 
 #ifdef __cplusplus
 namespace libyuv {
@@ -627,6 +630,130 @@ int I010ToP010(const uint16_t* src_y,
                     width, height, 1, 1, 10);
 }
 
+// Convert BT.2020 I010 to BT.709 NV12 with tone mapping. Each pair of rows is
+// tone mapped to ARGB and then converted with BT.709 coefficients.
+LIBYUV_API
+int I010ToNV12ToneMapped(const uint16_t* src_y,
+                         int src_stride_y,
+                         const uint16_t* src_u,
+                         int src_stride_u,
+                         const uint16_t* src_v,
+                         int src_stride_v,
+                         uint8_t* dst_y,
+                         int dst_stride_y,
+                         uint8_t* dst_uv,
+                         int dst_stride_uv,
+                         const struct ToneMapConstants* tonemap,
+                         int width,
+                         int height) {
+  int y;
+  void (*I210ToAR30Row)(const uint16_t* y_buf, const uint16_t* u_buf,
+                        const uint16_t* v_buf, uint8_t* rgb_buf,
+                        const struct YuvConstants* yuvconstants, int width) =
+      I210ToAR30Row_C;
+  void (*AR30ToARGBToneMapRow)(const uint8_t* src_ar30, uint8_t* dst_argb,
+                               const struct ToneMapConstants* tonemap,
+                               int width) = AR30ToARGBToneMapRow_C;
+  void (*MergeUVRow)(const uint8_t* src_u, const uint8_t* src_v,
+                     uint8_t* dst_uv, int width) = MergeUVRow_C;
+  const int kRowSize = (width * 4 + 31) & ~31;
+  const int halfwidth = (width + 1) >> 1;
+  const int kUVRowSize = (halfwidth + 31) & ~31;
+  if (!src_y || !src_u || !src_v || !dst_y || !dst_uv || !tonemap ||
+      width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    dst_y = dst_y + (height - 1) * dst_stride_y;
+    dst_uv = dst_uv + (((height + 1) >> 1) - 1) * dst_stride_uv;
+    dst_stride_y = -dst_stride_y;
+    dst_stride_uv = -dst_stride_uv;
+  }
+#if defined(HAS_I210TOAR30ROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    I210ToAR30Row = I210ToAR30Row_Any_SSSE3;
+    if (IS_ALIGNED(width, 8)) {
+      I210ToAR30Row = I210ToAR30Row_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_I210TOAR30ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    I210ToAR30Row = I210ToAR30Row_Any_AVX2;
+    if (IS_ALIGNED(width, 16)) {
+      I210ToAR30Row = I210ToAR30Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_AR30TOARGBTONEMAPROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    AR30ToARGBToneMapRow = AR30ToARGBToneMapRow_Any_AVX2;
+    if (IS_ALIGNED(width, 8)) {
+      AR30ToARGBToneMapRow = AR30ToARGBToneMapRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    MergeUVRow = MergeUVRow_Any_SSE2;
+    if (IS_ALIGNED(halfwidth, 16)) {
+      MergeUVRow = MergeUVRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    MergeUVRow = MergeUVRow_Any_AVX2;
+    if (IS_ALIGNED(halfwidth, 16)) {
+      MergeUVRow = MergeUVRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    MergeUVRow = MergeUVRow_Any_NEON;
+    if (IS_ALIGNED(halfwidth, 16)) {
+      MergeUVRow = MergeUVRow_NEON;
+    }
+  }
+#endif
+
+  {
+    // Allocate 2 rows of ARGB and a row each of U and V.
+    align_buffer_64(row, kRowSize * 2 + kUVRowSize * 2);
+    uint8_t* row_u = row + kRowSize * 2;
+    uint8_t* row_v = row_u + kUVRowSize;
+
+    for (y = 0; y < height - 1; y += 2) {
+      I210ToAR30Row(src_y, src_u, src_v, row, &kYuv2020Constants, width);
+      AR30ToARGBToneMapRow(row, row, tonemap, width);
+      I210ToAR30Row(src_y + src_stride_y, src_u, src_v, row + kRowSize,
+                    &kYuv2020Constants, width);
+      AR30ToARGBToneMapRow(row + kRowSize, row + kRowSize, tonemap, width);
+      ARGBToUVHRow_C(row, kRowSize, row_u, row_v, width);
+      MergeUVRow(row_u, row_v, dst_uv, halfwidth);
+      ARGBToYHRow_C(row, dst_y, width);
+      ARGBToYHRow_C(row + kRowSize, dst_y + dst_stride_y, width);
+      src_y += src_stride_y * 2;
+      src_u += src_stride_u;
+      src_v += src_stride_v;
+      dst_y += dst_stride_y * 2;
+      dst_uv += dst_stride_uv;
+    }
+    if (height & 1) {
+      I210ToAR30Row(src_y, src_u, src_v, row, &kYuv2020Constants, width);
+      AR30ToARGBToneMapRow(row, row, tonemap, width);
+      ARGBToUVHRow_C(row, 0, row_u, row_v, width);
+      MergeUVRow(row_u, row_v, dst_uv, halfwidth);
+      ARGBToYHRow_C(row, dst_y, width);
+    }
+    free_aligned_buffer_64(row);
+  }
+  return 0;
+}
+
 LIBYUV_API
 int I210ToP210(const uint16_t* src_y,
                int src_stride_y,
@@ -681,6 +808,295 @@ int I212ToP212(const uint16_t* src_y,
                     width, height, 1, 0, 12);
 }
 
+LIBYUV_API
+int V210ToI210(const uint8_t* src_v210,
+               int src_stride_v210,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_u,
+               int dst_stride_u,
+               uint16_t* dst_v,
+               int dst_stride_v,
+               int width,
+               int height) {
+  int y;
+  void (*V210ToI210Row)(const uint8_t* src_v210, uint16_t* dst_y,
+                        uint16_t* dst_u, uint16_t* dst_v, int width) =
+      V210ToI210Row_C;
+  if (!src_v210 || !dst_y || !dst_u || !dst_v || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src_v210 = src_v210 + (height - 1) * src_stride_v210;
+    src_stride_v210 = -src_stride_v210;
+  }
+#if defined(HAS_V210TOI210ROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    V210ToI210Row = V210ToI210Row_Any_SSSE3;
+    if (width % 12 == 0) {
+      V210ToI210Row = V210ToI210Row_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_V210TOI210ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    V210ToI210Row = V210ToI210Row_Any_AVX2;
+    if (width % 24 == 0) {
+      V210ToI210Row = V210ToI210Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_V210TOI210ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    V210ToI210Row = V210ToI210Row_Any_NEON;
+    if (width % 12 == 0) {
+      V210ToI210Row = V210ToI210Row_NEON;
+    }
+  }
+#endif
+
+  for (y = 0; y < height; ++y) {
+    V210ToI210Row(src_v210, dst_y, dst_u, dst_v, width);
+    src_v210 += src_stride_v210;
+    dst_y += dst_stride_y;
+    dst_u += dst_stride_u;
+    dst_v += dst_stride_v;
+  }
+  return 0;
+}
+
+LIBYUV_API
+int V210ToP210(const uint8_t* src_v210,
+               int src_stride_v210,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_uv,
+               int dst_stride_uv,
+               int width,
+               int height) {
+  int y;
+  const int uv_width = (width + 1) >> 1;
+  void (*V210ToI210Row)(const uint8_t* src_v210, uint16_t* dst_y,
+                        uint16_t* dst_u, uint16_t* dst_v, int width) =
+      V210ToI210Row_C;
+  void (*MultiplyRow_16)(const uint16_t* src_y, uint16_t* dst_y, int scale,
+                         int width) = MultiplyRow_16_C;
+  void (*MergeUVRow_16)(const uint16_t* src_u, const uint16_t* src_v,
+                        uint16_t* dst_uv, int depth, int width) =
+      MergeUVRow_16_C;
+  if (!src_v210 || !dst_y || !dst_uv || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src_v210 = src_v210 + (height - 1) * src_stride_v210;
+    src_stride_v210 = -src_stride_v210;
+  }
+#if defined(HAS_V210TOI210ROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    V210ToI210Row = V210ToI210Row_Any_SSSE3;
+    if (width % 12 == 0) {
+      V210ToI210Row = V210ToI210Row_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_V210TOI210ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    V210ToI210Row = V210ToI210Row_Any_AVX2;
+    if (width % 24 == 0) {
+      V210ToI210Row = V210ToI210Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_V210TOI210ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    V210ToI210Row = V210ToI210Row_Any_NEON;
+    if (width % 12 == 0) {
+      V210ToI210Row = V210ToI210Row_NEON;
+    }
+  }
+#endif
+#if defined(HAS_MULTIPLYROW_16_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    MultiplyRow_16 = MultiplyRow_16_Any_AVX2;
+    if (IS_ALIGNED(width, 32)) {
+      MultiplyRow_16 = MultiplyRow_16_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_MULTIPLYROW_16_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    MultiplyRow_16 = MultiplyRow_16_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      MultiplyRow_16 = MultiplyRow_16_NEON;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_16_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    MergeUVRow_16 = MergeUVRow_16_Any_AVX2;
+    if (IS_ALIGNED(uv_width, 8)) {
+      MergeUVRow_16 = MergeUVRow_16_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_16_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    MergeUVRow_16 = MergeUVRow_16_Any_NEON;
+    if (IS_ALIGNED(uv_width, 8)) {
+      MergeUVRow_16 = MergeUVRow_16_NEON;
+    }
+  }
+#endif
+
+  {
+    // Allocate 2 rows of U and V.
+    const int kRowSize = (uv_width + 31) & ~31;
+    align_buffer_64(row_u, kRowSize * 2 * 2);
+    uint16_t* row_v = (uint16_t*)(row_u) + kRowSize;
+
+    for (y = 0; y < height; ++y) {
+      // Unpack Y into place then move it to the msbs like P210.
+      V210ToI210Row(src_v210, dst_y, (uint16_t*)(row_u), row_v, width);
+      MultiplyRow_16(dst_y, dst_y, 64, width);
+      MergeUVRow_16((uint16_t*)(row_u), row_v, dst_uv, 10, uv_width);
+      src_v210 += src_stride_v210;
+      dst_y += dst_stride_y;
+      dst_uv += dst_stride_uv;
+    }
+    free_aligned_buffer_64(row_u);
+  }
+  return 0;
+}
+
+LIBYUV_API
+int Y210ToI210(const uint16_t* src_y210,
+               int src_stride_y210,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_u,
+               int dst_stride_u,
+               uint16_t* dst_v,
+               int dst_stride_v,
+               int width,
+               int height) {
+  int y;
+  void (*Y210ToI210Row)(const uint16_t* src_y210, uint16_t* dst_y,
+                        uint16_t* dst_u, uint16_t* dst_v, int width) =
+      Y210ToI210Row_C;
+  if (!src_y210 || !dst_y || !dst_u || !dst_v || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src_y210 = src_y210 + (height - 1) * src_stride_y210;
+    src_stride_y210 = -src_stride_y210;
+  }
+#if defined(HAS_Y210TOI210ROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    Y210ToI210Row = Y210ToI210Row_Any_SSSE3;
+    if (IS_ALIGNED(width, 8)) {
+      Y210ToI210Row = Y210ToI210Row_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_Y210TOI210ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    Y210ToI210Row = Y210ToI210Row_Any_AVX2;
+    if (IS_ALIGNED(width, 16)) {
+      Y210ToI210Row = Y210ToI210Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_Y210TOI210ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    Y210ToI210Row = Y210ToI210Row_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      Y210ToI210Row = Y210ToI210Row_NEON;
+    }
+  }
+#endif
+
+  for (y = 0; y < height; ++y) {
+    Y210ToI210Row(src_y210, dst_y, dst_u, dst_v, width);
+    src_y210 += src_stride_y210;
+    dst_y += dst_stride_y;
+    dst_u += dst_stride_u;
+    dst_v += dst_stride_v;
+  }
+  return 0;
+}
+
+LIBYUV_API
+int Y410ToI410(const uint8_t* src_y410,
+               int src_stride_y410,
+               uint16_t* dst_y,
+               int dst_stride_y,
+               uint16_t* dst_u,
+               int dst_stride_u,
+               uint16_t* dst_v,
+               int dst_stride_v,
+               int width,
+               int height) {
+  int y;
+  void (*Y410ToI410Row)(const uint8_t* src_y410, uint16_t* dst_y,
+                        uint16_t* dst_u, uint16_t* dst_v, int width) =
+      Y410ToI410Row_C;
+  if (!src_y410 || !dst_y || !dst_u || !dst_v || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src_y410 = src_y410 + (height - 1) * src_stride_y410;
+    src_stride_y410 = -src_stride_y410;
+  }
+  // Coalesce rows.
+  if (src_stride_y410 == width * 4 && dst_stride_y == width &&
+      dst_stride_u == width && dst_stride_v == width) {
+    width *= height;
+    height = 1;
+    src_stride_y410 = dst_stride_y = dst_stride_u = dst_stride_v = 0;
+  }
+#if defined(HAS_Y410TOI410ROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    Y410ToI410Row = Y410ToI410Row_Any_SSE2;
+    if (IS_ALIGNED(width, 8)) {
+      Y410ToI410Row = Y410ToI410Row_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_Y410TOI410ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    Y410ToI410Row = Y410ToI410Row_Any_AVX2;
+    if (IS_ALIGNED(width, 16)) {
+      Y410ToI410Row = Y410ToI410Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_Y410TOI410ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    Y410ToI410Row = Y410ToI410Row_Any_NEON;
+    if (IS_ALIGNED(width, 8)) {
+      Y410ToI410Row = Y410ToI410Row_NEON;
+    }
+  }
+#endif
+
+  for (y = 0; y < height; ++y) {
+    Y410ToI410Row(src_y410, dst_y, dst_u, dst_v, width);
+    src_y410 += src_stride_y410;
+    dst_y += dst_stride_y;
+    dst_u += dst_stride_u;
+    dst_v += dst_stride_v;
+  }
+  return 0;
+}
+
 // 422 chroma is 1/2 width, 1x height
 // 420 chroma is 1/2 width, 1/2 height
 LIBYUV_API
@@ -1831,6 +2247,358 @@ int AYUVToNV21(const uint8_t* src_ayuv,
   return 0;
 }
 
+// Returns the BayerRowToARGBRow layout of the first row of a Bayer fourcc, or
+// -1 if the fourcc is not Bayer.  Odd rows use the layout xor 3.
+static int BayerLayout(uint32_t fourcc) {
+  switch (CanonicalFourCC(fourcc)) {
+    case FOURCC_RGGB:
+      return 0;
+    case FOURCC_GRBG:
+      return 1;
+    case FOURCC_BGGR:
+      return 2;
+    case FOURCC_GBRG:
+      return 3;
+    default:
+      return -1;
+  }
+}
+
+// Copy Bayer row y to 8 bits with 1 mirrored sample each side.  Rows
+// outside the image mirror too, which keeps the color phase.
+static void BayerCopyRow(const uint8_t* src_bayer,
+                         const uint16_t* src_bayer_16,
+                         int src_stride_bayer,
+                         void (*Convert16To8Row)(const uint16_t* src_y,
+                                                 uint8_t* dst_y,
+                                                 int scale,
+                                                 int width),
+                         int scale,
+                         uint8_t* dst,
+                         int y,
+                         int width,
+                         int height) {
+  if (y < 0) {
+    y = height > 1 ? 1 : 0;
+  } else if (y >= height) {
+    y = height > 1 ? height - 2 : 0;
+  }
+  if (src_bayer_16) {
+    Convert16To8Row(src_bayer_16 + y * src_stride_bayer, dst, scale, width);
+  } else {
+    memcpy(dst, src_bayer + y * src_stride_bayer, width);
+  }
+  dst[-1] = dst[width > 1 ? 1 : 0];
+  dst[width] = dst[width > 1 ? width - 2 : 0];
+}
+
+// Demosaic 2 Bayer rows at a time to ARGB and subsample them to I420, or to
+// NV12 when dst_uv is not NULL.
+static int BayerxToYUV(const uint8_t* src_bayer,
+                       const uint16_t* src_bayer_16,
+                       int src_stride_bayer,
+                       uint8_t* dst_y,
+                       int dst_stride_y,
+                       uint8_t* dst_u,
+                       int dst_stride_u,
+                       uint8_t* dst_v,
+                       int dst_stride_v,
+                       uint8_t* dst_uv,
+                       int dst_stride_uv,
+                       int width,
+                       int height,
+                       int depth,
+                       uint32_t fourcc) {
+  int y;
+  int layout = BayerLayout(fourcc);
+  const int halfwidth = (width + 1) >> 1;
+  const int scale = 1 << (24 - depth);
+  void (*BayerRowToARGBRow)(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2, uint8_t* dst_argb,
+                            int layout, int width) = BayerRowToARGBRow_C;
+  void (*Convert16To8Row)(const uint16_t* src_y, uint8_t* dst_y, int scale,
+                          int width) = Convert16To8Row_C;
+  void (*ARGBToUVRow)(const uint8_t* src_argb0, int src_stride_argb,
+                      uint8_t* dst_u, uint8_t* dst_v, int width) =
+      ARGBToUVRow_C;
+  void (*ARGBToYRow)(const uint8_t* src_argb, uint8_t* dst_y, int width) =
+      ARGBToYRow_C;
+  void (*MergeUVRow_)(const uint8_t* src_u, const uint8_t* src_v,
+                      uint8_t* dst_uv, int width) = MergeUVRow_C;
+  if ((!src_bayer && !src_bayer_16) || !dst_y || width <= 0 || height == 0 ||
+      layout < 0 || depth < 8 || depth > 16) {
+    return -1;
+  }
+  // Negative height means invert the image.  The first row read is then the
+  // last row of the pattern.
+  if (height < 0) {
+    height = -height;
+    if (src_bayer_16) {
+      src_bayer_16 = src_bayer_16 + (height - 1) * src_stride_bayer;
+    } else {
+      src_bayer = src_bayer + (height - 1) * src_stride_bayer;
+    }
+    src_stride_bayer = -src_stride_bayer;
+    if (!(height & 1)) {
+      layout ^= 3;
+    }
+  }
+#if defined(HAS_BAYERROWTOARGBROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    BayerRowToARGBRow = BayerRowToARGBRow_Any_SSE2;
+    if (IS_ALIGNED(width, 16)) {
+      BayerRowToARGBRow = BayerRowToARGBRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_BAYERROWTOARGBROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    BayerRowToARGBRow = BayerRowToARGBRow_Any_AVX2;
+    if (IS_ALIGNED(width, 32)) {
+      BayerRowToARGBRow = BayerRowToARGBRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_BAYERROWTOARGBROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    BayerRowToARGBRow = BayerRowToARGBRow_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      BayerRowToARGBRow = BayerRowToARGBRow_NEON;
+    }
+  }
+#endif
+#if defined(HAS_CONVERT16TO8ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    Convert16To8Row = Convert16To8Row_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      Convert16To8Row = Convert16To8Row_NEON;
+    }
+  }
+#endif
+#if defined(HAS_CONVERT16TO8ROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    Convert16To8Row = Convert16To8Row_Any_SSSE3;
+    if (IS_ALIGNED(width, 16)) {
+      Convert16To8Row = Convert16To8Row_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_CONVERT16TO8ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    Convert16To8Row = Convert16To8Row_Any_AVX2;
+    if (IS_ALIGNED(width, 32)) {
+      Convert16To8Row = Convert16To8Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_ARGBTOYROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    ARGBToYRow = ARGBToYRow_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      ARGBToYRow = ARGBToYRow_NEON;
+    }
+  }
+#endif
+#if defined(HAS_ARGBTOUVROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    ARGBToUVRow = ARGBToUVRow_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      ARGBToUVRow = ARGBToUVRow_NEON;
+    }
+  }
+#endif
+#if defined(HAS_ARGBTOYROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    ARGBToYRow = ARGBToYRow_Any_SSSE3;
+    if (IS_ALIGNED(width, 16)) {
+      ARGBToYRow = ARGBToYRow_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_ARGBTOUVROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    ARGBToUVRow = ARGBToUVRow_Any_SSSE3;
+    if (IS_ALIGNED(width, 16)) {
+      ARGBToUVRow = ARGBToUVRow_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_ARGBTOYROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    ARGBToYRow = ARGBToYRow_Any_AVX2;
+    if (IS_ALIGNED(width, 32)) {
+      ARGBToYRow = ARGBToYRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_ARGBTOUVROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    ARGBToUVRow = ARGBToUVRow_Any_AVX2;
+    if (IS_ALIGNED(width, 32)) {
+      ARGBToUVRow = ARGBToUVRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    MergeUVRow_ = MergeUVRow_Any_SSE2;
+    if (IS_ALIGNED(halfwidth, 16)) {
+      MergeUVRow_ = MergeUVRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    MergeUVRow_ = MergeUVRow_Any_AVX2;
+    if (IS_ALIGNED(halfwidth, 16)) {
+      MergeUVRow_ = MergeUVRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_MERGEUVROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    MergeUVRow_ = MergeUVRow_Any_NEON;
+    if (IS_ALIGNED(halfwidth, 16)) {
+      MergeUVRow_ = MergeUVRow_NEON;
+    }
+  }
+#endif
+
+  {
+    // A ring of 4 padded Bayer rows, 2 ARGB rows and a U and V row for NV12.
+    const int kRowSize = (width + 63) & ~31;
+    const int kARGBRowSize = (width * 4 + 63) & ~63;
+    const int kUVRowSize = (halfwidth + 31) & ~31;
+    align_buffer_64(row, kRowSize * 4 + kARGBRowSize * 2 + kUVRowSize * 2);
+    uint8_t* rows[4] = {row + 16, row + kRowSize + 16, row + kRowSize * 2 + 16,
+                        row + kRowSize * 3 + 16};
+    uint8_t* row_argb = row + kRowSize * 4;
+    uint8_t* row_u = row_argb + kARGBRowSize * 2;
+    uint8_t* row_v = row_u + kUVRowSize;
+    if (dst_uv) {
+      dst_u = row_u;
+      dst_v = row_v;
+      dst_stride_u = dst_stride_v = 0;
+    }
+    BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                 scale, rows[3], -1, width, height);
+    BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                 scale, rows[0], 0, width, height);
+    for (y = 0; y < height - 1; y += 2) {
+      BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                   scale, rows[(y + 1) & 3], y + 1, width, height);
+      BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                   scale, rows[(y + 2) & 3], y + 2, width, height);
+      BayerRowToARGBRow(rows[(y - 1) & 3], rows[y & 3], rows[(y + 1) & 3],
+                        row_argb, layout, width);
+      BayerRowToARGBRow(rows[y & 3], rows[(y + 1) & 3], rows[(y + 2) & 3],
+                        row_argb + kARGBRowSize, layout ^ 3, width);
+      ARGBToUVRow(row_argb, kARGBRowSize, dst_u, dst_v, width);
+      ARGBToYRow(row_argb, dst_y, width);
+      ARGBToYRow(row_argb + kARGBRowSize, dst_y + dst_stride_y, width);
+      if (dst_uv) {
+        MergeUVRow_(row_u, row_v, dst_uv, halfwidth);
+        dst_uv += dst_stride_uv;
+      }
+      dst_y += dst_stride_y * 2;
+      dst_u += dst_stride_u;
+      dst_v += dst_stride_v;
+    }
+    if (height & 1) {
+      BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                   scale, rows[(y + 1) & 3], y + 1, width, height);
+      BayerRowToARGBRow(rows[(y - 1) & 3], rows[y & 3], rows[(y + 1) & 3],
+                        row_argb, layout, width);
+      ARGBToUVRow(row_argb, 0, dst_u, dst_v, width);
+      ARGBToYRow(row_argb, dst_y, width);
+      if (dst_uv) {
+        MergeUVRow_(row_u, row_v, dst_uv, halfwidth);
+      }
+    }
+    free_aligned_buffer_64(row);
+  }
+  return 0;
+}
+
+LIBYUV_API
+int BayerToI420(const uint8_t* src_bayer,
+                int src_stride_bayer,
+                uint8_t* dst_y,
+                int dst_stride_y,
+                uint8_t* dst_u,
+                int dst_stride_u,
+                uint8_t* dst_v,
+                int dst_stride_v,
+                int width,
+                int height,
+                uint32_t fourcc) {
+  if (!dst_u || !dst_v) {
+    return -1;
+  }
+  return BayerxToYUV(src_bayer, NULL, src_stride_bayer, dst_y, dst_stride_y,
+                     dst_u, dst_stride_u, dst_v, dst_stride_v, NULL, 0, width,
+                     height, 8, fourcc);
+}
+
+LIBYUV_API
+int BayerToNV12(const uint8_t* src_bayer,
+                int src_stride_bayer,
+                uint8_t* dst_y,
+                int dst_stride_y,
+                uint8_t* dst_uv,
+                int dst_stride_uv,
+                int width,
+                int height,
+                uint32_t fourcc) {
+  if (!dst_uv) {
+    return -1;
+  }
+  return BayerxToYUV(src_bayer, NULL, src_stride_bayer, dst_y, dst_stride_y,
+                     NULL, 0, NULL, 0, dst_uv, dst_stride_uv, width, height, 8,
+                     fourcc);
+}
+
+LIBYUV_API
+int Bayer16ToI420(const uint16_t* src_bayer,
+                  int src_stride_bayer,
+                  uint8_t* dst_y,
+                  int dst_stride_y,
+                  uint8_t* dst_u,
+                  int dst_stride_u,
+                  uint8_t* dst_v,
+                  int dst_stride_v,
+                  int width,
+                  int height,
+                  int depth,
+                  uint32_t fourcc) {
+  if (!dst_u || !dst_v) {
+    return -1;
+  }
+  return BayerxToYUV(NULL, src_bayer, src_stride_bayer, dst_y, dst_stride_y,
+                     dst_u, dst_stride_u, dst_v, dst_stride_v, NULL, 0, width,
+                     height, depth, fourcc);
+}
+
+LIBYUV_API
+int Bayer16ToNV12(const uint16_t* src_bayer,
+                  int src_stride_bayer,
+                  uint8_t* dst_y,
+                  int dst_stride_y,
+                  uint8_t* dst_uv,
+                  int dst_stride_uv,
+                  int width,
+                  int height,
+                  int depth,
+                  uint32_t fourcc) {
+  if (!dst_uv) {
+    return -1;
+  }
+  return BayerxToYUV(NULL, src_bayer, src_stride_bayer, dst_y, dst_stride_y,
+                     NULL, 0, NULL, 0, dst_uv, dst_stride_uv, width, height,
+                     depth, fourcc);
+}
+
 // Convert ARGB to I420.
 LIBYUV_API
 int ARGBToI420(const uint8_t* src_argb,
@@ -11,6 +11,14 @@
 #include "libyuv/convert_argb.h"
 
 #include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "libyuv/convert_from_argb.h"
 #include "libyuv/cpu_id.h"
@@ -51,6 +59,579 @@ int ARGBCopy(const uint8_t* src_argb,
   return 0;
 }
 
+// Whole frame conversions are split into bands of at least this many rows
+// and pixels when threads or an executor are set.
+#define MIN_CONVERT_BAND_ROWS 16
+#define MIN_CONVERT_BAND_PIXELS (128 * 128)
+#define MAX_CONVERT_THREADS 64
+
+// Pool of threads that runs bands along with the calling thread.
+class ConvertThreadPool {
+ public:
+  explicit ConvertThreadPool(int num_threads)
+      : task_(NULL),
+        task_context_(NULL),
+        count_(0),
+        next_(0),
+        done_(0),
+        generation_(0),
+        quit_(false) {
+    int i;
+    for (i = 1; i < num_threads; ++i) {
+      threads_.push_back(std::thread(&ConvertThreadPool::Worker, this));
+    }
+  }
+
+  ~ConvertThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    work_cv_.notify_all();
+    for (size_t i = 0; i < threads_.size(); ++i) {
+      threads_[i].join();
+    }
+  }
+
+  // Returns false without running any task if another thread is using the
+  // pool, in which case the caller runs the tasks itself.
+  bool ParallelFor(void (*task)(void* task_context, int index),
+                   void* task_context,
+                   int count) {
+    std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+    if (!run_lock.owns_lock()) {
+      return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_ = task;
+    task_context_ = task_context;
+    count_ = count;
+    next_ = 0;
+    done_ = 0;
+    ++generation_;
+    work_cv_.notify_all();
+    RunTasks(&lock);
+    done_cv_.wait(lock, [this] { return done_ == count_; });
+    return true;
+  }
+
+ private:
+  void Worker() {
+    unsigned int generation = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      work_cv_.wait(lock,
+                    [&] { return quit_ || generation_ != generation; });
+      if (quit_) {
+        return;
+      }
+      generation = generation_;
+      RunTasks(&lock);
+    }
+  }
+
+  // Called with mutex_ held. Claims tasks until none are left.
+  void RunTasks(std::unique_lock<std::mutex>* lock) {
+    while (next_ < count_) {
+      int index = next_++;
+      lock->unlock();
+      task_(task_context_, index);
+      lock->lock();
+      if (++done_ == count_) {
+        done_cv_.notify_all();
+      }
+    }
+  }
+
+  std::mutex run_mutex_;  // Held while a frame is converted.
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  std::vector<std::thread> threads_;
+  void (*task_)(void* task_context, int index);
+  void* task_context_;
+  int count_;
+  int next_;
+  int done_;
+  unsigned int generation_;
+  bool quit_;
+};
+
+static ConvertThreadPool* convert_thread_pool = NULL;
+static int convert_num_threads = 0;
+static ParallelForFunc convert_parallel_for = NULL;
+static void* convert_executor_context = NULL;
+static int convert_num_bands = 0;
+// Set while a band is converted so the *Matrix function it calls does not
+// split the band again.
+static thread_local int convert_in_band = 0;
+
+LIBYUV_API
+int SetConvertThreads(int num_threads) {
+  if (num_threads < 0 || num_threads > MAX_CONVERT_THREADS) {
+    return -1;
+  }
+  delete convert_thread_pool;
+  convert_thread_pool = NULL;
+  convert_num_threads = 0;
+  if (num_threads > 1) {
+    convert_thread_pool = new ConvertThreadPool(num_threads);
+    convert_num_threads = num_threads;
+  }
+  return 0;
+}
+
+LIBYUV_API
+int SetConvertExecutor(ParallelForFunc parallel_for,
+                       void* executor_context,
+                       int num_bands) {
+  if (parallel_for && num_bands <= 0) {
+    return -1;
+  }
+  convert_parallel_for = parallel_for;
+  convert_executor_context = executor_context;
+  convert_num_bands = parallel_for ? num_bands : 0;
+  return 0;
+}
+
+// Returns the number of bands to convert a frame in, or 1 to convert it on
+// the calling thread.
+static int ConvertNumBands(int width, int height) {
+  int num_bands =
+      convert_parallel_for ? convert_num_bands : convert_num_threads;
+  int max_bands = (int)((int64_t)width * height / MIN_CONVERT_BAND_PIXELS);
+  if (convert_in_band || num_bands <= 1) {
+    return 1;
+  }
+  if (max_bands > height / MIN_CONVERT_BAND_ROWS) {
+    max_bands = height / MIN_CONVERT_BAND_ROWS;
+  }
+  return num_bands < max_bands ? num_bands : max_bands;
+}
+
+typedef int (*PlaneToRGBMatrixFunc)(const uint8_t* src_y,
+                                    int src_stride_y,
+                                    uint8_t* dst,
+                                    int dst_stride,
+                                    const struct YuvConstants* yuvconstants,
+                                    int width,
+                                    int height);
+typedef int (*PlanarToRGBMatrixFunc)(const uint8_t* src_y,
+                                     int src_stride_y,
+                                     const uint8_t* src_u,
+                                     int src_stride_u,
+                                     const uint8_t* src_v,
+                                     int src_stride_v,
+                                     uint8_t* dst,
+                                     int dst_stride,
+                                     const struct YuvConstants* yuvconstants,
+                                     int width,
+                                     int height);
+typedef int (*Planar16ToRGBMatrixFunc)(const uint16_t* src_y,
+                                       int src_stride_y,
+                                       const uint16_t* src_u,
+                                       int src_stride_u,
+                                       const uint16_t* src_v,
+                                       int src_stride_v,
+                                       uint8_t* dst,
+                                       int dst_stride,
+                                       const struct YuvConstants* yuvconstants,
+                                       int width,
+                                       int height);
+typedef int (*BiplanarToRGBMatrixFunc)(const uint8_t* src_y,
+                                       int src_stride_y,
+                                       const uint8_t* src_uv,
+                                       int src_stride_uv,
+                                       uint8_t* dst,
+                                       int dst_stride,
+                                       const struct YuvConstants* yuvconstants,
+                                       int width,
+                                       int height);
+typedef int (*Biplanar16ToRGBMatrixFunc)(
+    const uint16_t* src_y,
+    int src_stride_y,
+    const uint16_t* src_uv,
+    int src_stride_uv,
+    uint8_t* dst,
+    int dst_stride,
+    const struct YuvConstants* yuvconstants,
+    int width,
+    int height);
+typedef int (*PlanarAlphaToARGBMatrixFunc)(
+    const uint8_t* src_y,
+    int src_stride_y,
+    const uint8_t* src_u,
+    int src_stride_u,
+    const uint8_t* src_v,
+    int src_stride_v,
+    const uint8_t* src_a,
+    int src_stride_a,
+    uint8_t* dst_argb,
+    int dst_stride_argb,
+    const struct YuvConstants* yuvconstants,
+    int width,
+    int height,
+    int attenuate);
+typedef int (*PlanarAlpha16ToARGBMatrixFunc)(
+    const uint16_t* src_y,
+    int src_stride_y,
+    const uint16_t* src_u,
+    int src_stride_u,
+    const uint16_t* src_v,
+    int src_stride_v,
+    const uint16_t* src_a,
+    int src_stride_a,
+    uint8_t* dst_argb,
+    int dst_stride_argb,
+    const struct YuvConstants* yuvconstants,
+    int width,
+    int height,
+    int attenuate);
+
+enum ConvertBandsType {
+  kBandsPlane,
+  kBandsPlanar,
+  kBandsPlanar16,
+  kBandsBiplanar,
+  kBandsBiplanar16,
+  kBandsPlanarAlpha,
+  kBandsPlanarAlpha16,
+};
+
+// A frame to convert in bands. Planes are y, u (or uv), v and a.
+struct ConvertBands {
+  enum ConvertBandsType type;
+  union {
+    PlaneToRGBMatrixFunc plane;
+    PlanarToRGBMatrixFunc planar;
+    Planar16ToRGBMatrixFunc planar16;
+    BiplanarToRGBMatrixFunc biplanar;
+    Biplanar16ToRGBMatrixFunc biplanar16;
+    PlanarAlphaToARGBMatrixFunc planar_alpha;
+    PlanarAlpha16ToARGBMatrixFunc planar_alpha16;
+  } func;
+  int num_planes;
+  int bytes_per_sample;  // 1 or 2.
+  const uint8_t* src[4];
+  int src_stride[4];  // In samples.
+  int src_shift_y[4];
+  uint8_t* dst;
+  int dst_stride;
+  const struct YuvConstants* yuvconstants;
+  int width;
+  int height;
+  int band_height;
+  int attenuate;
+};
+
+static void ConvertBandTask(void* task_context, int index) {
+  const struct ConvertBands* bands = (const struct ConvertBands*)task_context;
+  const uint8_t* src[4] = {NULL, NULL, NULL, NULL};
+  const uint16_t* src16[4];
+  const int* stride = bands->src_stride;
+  uint8_t* dst;
+  int y = index * bands->band_height;
+  int height = bands->height - y;
+  int i;
+  if (height > bands->band_height) {
+    height = bands->band_height;
+  }
+  for (i = 0; i < bands->num_planes; ++i) {
+    src[i] = bands->src[i] + (ptrdiff_t)(y >> bands->src_shift_y[i]) *
+                                 bands->src_stride[i] *
+                                 bands->bytes_per_sample;
+    src16[i] = (const uint16_t*)src[i];
+  }
+  dst = bands->dst + (ptrdiff_t)y * bands->dst_stride;
+  convert_in_band = 1;
+  switch (bands->type) {
+    case kBandsPlane:
+      bands->func.plane(src[0], stride[0], dst, bands->dst_stride,
+                        bands->yuvconstants, bands->width, height);
+      break;
+    case kBandsBiplanar:
+      bands->func.biplanar(src[0], stride[0], src[1], stride[1], dst,
+                           bands->dst_stride, bands->yuvconstants,
+                           bands->width, height);
+      break;
+    case kBandsBiplanar16:
+      bands->func.biplanar16(src16[0], stride[0], src16[1], stride[1], dst,
+                             bands->dst_stride, bands->yuvconstants,
+                             bands->width, height);
+      break;
+    case kBandsPlanar:
+      bands->func.planar(src[0], stride[0], src[1], stride[1], src[2],
+                         stride[2], dst, bands->dst_stride,
+                         bands->yuvconstants, bands->width, height);
+      break;
+    case kBandsPlanar16:
+      bands->func.planar16(src16[0], stride[0], src16[1], stride[1], src16[2],
+                           stride[2], dst, bands->dst_stride,
+                           bands->yuvconstants, bands->width, height);
+      break;
+    case kBandsPlanarAlpha:
+      bands->func.planar_alpha(src[0], stride[0], src[1], stride[1], src[2],
+                               stride[2], src[3], stride[3], dst,
+                               bands->dst_stride, bands->yuvconstants,
+                               bands->width, height, bands->attenuate);
+      break;
+    case kBandsPlanarAlpha16:
+      bands->func.planar_alpha16(src16[0], stride[0], src16[1], stride[1],
+                                 src16[2], stride[2], src16[3], stride[3], dst,
+                                 bands->dst_stride, bands->yuvconstants,
+                                 bands->width, height, bands->attenuate);
+      break;
+  }
+  convert_in_band = 0;
+}
+
+// Converts a validated, upright frame in bands of even rows, so subsampled
+// chroma rows are never shared between bands.
+static int ConvertInBands(struct ConvertBands* bands) {
+  int num_bands = ConvertNumBands(bands->width, bands->height);
+  int i;
+  bands->band_height = ((bands->height + num_bands - 1) / num_bands + 1) & ~1;
+  num_bands = (bands->height + bands->band_height - 1) / bands->band_height;
+  // Detect cpu features before row functions are chosen on many threads.
+  TestCpuFlag(kCpuInitialized);
+  if (convert_parallel_for) {
+    convert_parallel_for(convert_executor_context, ConvertBandTask, bands,
+                         num_bands);
+  } else if (!convert_thread_pool ||
+             !convert_thread_pool->ParallelFor(ConvertBandTask, bands,
+                                               num_bands)) {
+    for (i = 0; i < num_bands; ++i) {
+      ConvertBandTask(bands, i);
+    }
+  }
+  return 0;
+}
+
+static int PlaneToRGBBands(PlaneToRGBMatrixFunc func,
+                           const uint8_t* src_y,
+                           int src_stride_y,
+                           uint8_t* dst,
+                           int dst_stride,
+                           const struct YuvConstants* yuvconstants,
+                           int width,
+                           int height) {
+  struct ConvertBands bands = {};
+  bands.type = kBandsPlane;
+  bands.func.plane = func;
+  bands.num_planes = 1;
+  bands.bytes_per_sample = 1;
+  bands.src[0] = src_y;
+  bands.src_stride[0] = src_stride_y;
+  bands.dst = dst;
+  bands.dst_stride = dst_stride;
+  bands.yuvconstants = yuvconstants;
+  bands.width = width;
+  bands.height = height;
+  return ConvertInBands(&bands);
+}
+
+static int PlanarToRGBBands(PlanarToRGBMatrixFunc func,
+                            const uint8_t* src_y,
+                            int src_stride_y,
+                            const uint8_t* src_u,
+                            int src_stride_u,
+                            const uint8_t* src_v,
+                            int src_stride_v,
+                            int uv_shift_y,
+                            uint8_t* dst,
+                            int dst_stride,
+                            const struct YuvConstants* yuvconstants,
+                            int width,
+                            int height) {
+  struct ConvertBands bands = {};
+  bands.type = kBandsPlanar;
+  bands.func.planar = func;
+  bands.num_planes = 3;
+  bands.bytes_per_sample = 1;
+  bands.src[0] = src_y;
+  bands.src[1] = src_u;
+  bands.src[2] = src_v;
+  bands.src_stride[0] = src_stride_y;
+  bands.src_stride[1] = src_stride_u;
+  bands.src_stride[2] = src_stride_v;
+  bands.src_shift_y[1] = bands.src_shift_y[2] = uv_shift_y;
+  bands.dst = dst;
+  bands.dst_stride = dst_stride;
+  bands.yuvconstants = yuvconstants;
+  bands.width = width;
+  bands.height = height;
+  return ConvertInBands(&bands);
+}
+
+static int Planar16ToRGBBands(Planar16ToRGBMatrixFunc func,
+                              const uint16_t* src_y,
+                              int src_stride_y,
+                              const uint16_t* src_u,
+                              int src_stride_u,
+                              const uint16_t* src_v,
+                              int src_stride_v,
+                              int uv_shift_y,
+                              uint8_t* dst,
+                              int dst_stride,
+                              const struct YuvConstants* yuvconstants,
+                              int width,
+                              int height) {
+  struct ConvertBands bands = {};
+  bands.type = kBandsPlanar16;
+  bands.func.planar16 = func;
+  bands.num_planes = 3;
+  bands.bytes_per_sample = 2;
+  bands.src[0] = (const uint8_t*)src_y;
+  bands.src[1] = (const uint8_t*)src_u;
+  bands.src[2] = (const uint8_t*)src_v;
+  bands.src_stride[0] = src_stride_y;
+  bands.src_stride[1] = src_stride_u;
+  bands.src_stride[2] = src_stride_v;
+  bands.src_shift_y[1] = bands.src_shift_y[2] = uv_shift_y;
+  bands.dst = dst;
+  bands.dst_stride = dst_stride;
+  bands.yuvconstants = yuvconstants;
+  bands.width = width;
+  bands.height = height;
+  return ConvertInBands(&bands);
+}
+
+static int BiplanarToRGBBands(BiplanarToRGBMatrixFunc func,
+                              const uint8_t* src_y,
+                              int src_stride_y,
+                              const uint8_t* src_uv,
+                              int src_stride_uv,
+                              int uv_shift_y,
+                              uint8_t* dst,
+                              int dst_stride,
+                              const struct YuvConstants* yuvconstants,
+                              int width,
+                              int height) {
+  struct ConvertBands bands = {};
+  bands.type = kBandsBiplanar;
+  bands.func.biplanar = func;
+  bands.num_planes = 2;
+  bands.bytes_per_sample = 1;
+  bands.src[0] = src_y;
+  bands.src[1] = src_uv;
+  bands.src_stride[0] = src_stride_y;
+  bands.src_stride[1] = src_stride_uv;
+  bands.src_shift_y[1] = uv_shift_y;
+  bands.dst = dst;
+  bands.dst_stride = dst_stride;
+  bands.yuvconstants = yuvconstants;
+  bands.width = width;
+  bands.height = height;
+  return ConvertInBands(&bands);
+}
+
+static int Biplanar16ToRGBBands(Biplanar16ToRGBMatrixFunc func,
+                                const uint16_t* src_y,
+                                int src_stride_y,
+                                const uint16_t* src_uv,
+                                int src_stride_uv,
+                                int uv_shift_y,
+                                uint8_t* dst,
+                                int dst_stride,
+                                const struct YuvConstants* yuvconstants,
+                                int width,
+                                int height) {
+  struct ConvertBands bands = {};
+  bands.type = kBandsBiplanar16;
+  bands.func.biplanar16 = func;
+  bands.num_planes = 2;
+  bands.bytes_per_sample = 2;
+  bands.src[0] = (const uint8_t*)src_y;
+  bands.src[1] = (const uint8_t*)src_uv;
+  bands.src_stride[0] = src_stride_y;
+  bands.src_stride[1] = src_stride_uv;
+  bands.src_shift_y[1] = uv_shift_y;
+  bands.dst = dst;
+  bands.dst_stride = dst_stride;
+  bands.yuvconstants = yuvconstants;
+  bands.width = width;
+  bands.height = height;
+  return ConvertInBands(&bands);
+}
+
+static int PlanarAlphaToARGBBands(PlanarAlphaToARGBMatrixFunc func,
+                                  const uint8_t* src_y,
+                                  int src_stride_y,
+                                  const uint8_t* src_u,
+                                  int src_stride_u,
+                                  const uint8_t* src_v,
+                                  int src_stride_v,
+                                  const uint8_t* src_a,
+                                  int src_stride_a,
+                                  int uv_shift_y,
+                                  uint8_t* dst_argb,
+                                  int dst_stride_argb,
+                                  const struct YuvConstants* yuvconstants,
+                                  int width,
+                                  int height,
+                                  int attenuate) {
+  struct ConvertBands bands = {};
+  bands.type = kBandsPlanarAlpha;
+  bands.func.planar_alpha = func;
+  bands.num_planes = 4;
+  bands.bytes_per_sample = 1;
+  bands.src[0] = src_y;
+  bands.src[1] = src_u;
+  bands.src[2] = src_v;
+  bands.src[3] = src_a;
+  bands.src_stride[0] = src_stride_y;
+  bands.src_stride[1] = src_stride_u;
+  bands.src_stride[2] = src_stride_v;
+  bands.src_stride[3] = src_stride_a;
+  bands.src_shift_y[1] = bands.src_shift_y[2] = uv_shift_y;
+  bands.dst = dst_argb;
+  bands.dst_stride = dst_stride_argb;
+  bands.yuvconstants = yuvconstants;
+  bands.width = width;
+  bands.height = height;
+  bands.attenuate = attenuate;
+  return ConvertInBands(&bands);
+}
+
+static int PlanarAlpha16ToARGBBands(PlanarAlpha16ToARGBMatrixFunc func,
+                                    const uint16_t* src_y,
+                                    int src_stride_y,
+                                    const uint16_t* src_u,
+                                    int src_stride_u,
+                                    const uint16_t* src_v,
+                                    int src_stride_v,
+                                    const uint16_t* src_a,
+                                    int src_stride_a,
+                                    int uv_shift_y,
+                                    uint8_t* dst_argb,
+                                    int dst_stride_argb,
+                                    const struct YuvConstants* yuvconstants,
+                                    int width,
+                                    int height,
+                                    int attenuate) {
+  struct ConvertBands bands = {};
+  bands.type = kBandsPlanarAlpha16;
+  bands.func.planar_alpha16 = func;
+  bands.num_planes = 4;
+  bands.bytes_per_sample = 2;
+  bands.src[0] = (const uint8_t*)src_y;
+  bands.src[1] = (const uint8_t*)src_u;
+  bands.src[2] = (const uint8_t*)src_v;
+  bands.src[3] = (const uint8_t*)src_a;
+  bands.src_stride[0] = src_stride_y;
+  bands.src_stride[1] = src_stride_u;
+  bands.src_stride[2] = src_stride_v;
+  bands.src_stride[3] = src_stride_a;
+  bands.src_shift_y[1] = bands.src_shift_y[2] = uv_shift_y;
+  bands.dst = dst_argb;
+  bands.dst_stride = dst_stride_argb;
+  bands.yuvconstants = yuvconstants;
+  bands.width = width;
+  bands.height = height;
+  bands.attenuate = attenuate;
+  return ConvertInBands(&bands);
+}
+
 // Convert I420 to ARGB with matrix.
 LIBYUV_API
 int I420ToARGBMatrix(const uint8_t* src_y,
@@ -79,6 +660,11 @@ int I420ToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I420ToARGBMatrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 1, dst_argb,
+                            dst_stride_argb, yuvconstants, width, height);
+  }
 #if defined(HAS_I422TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422ToARGBRow = I422ToARGBRow_Any_SSSE3;
@@ -326,6 +912,11 @@ int I422ToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I422ToARGBMatrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 0, dst_argb,
+                            dst_stride_argb, yuvconstants, width, height);
+  }
   // Coalesce rows.
   if (src_stride_y == width && src_stride_u * 2 == width &&
       src_stride_v * 2 == width && dst_stride_argb == width * 4) {
@@ -578,6 +1169,11 @@ int I444ToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I444ToARGBMatrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 0, dst_argb,
+                            dst_stride_argb, yuvconstants, width, height);
+  }
   // Coalesce rows.
   if (src_stride_y == width && src_stride_u == width && src_stride_v == width &&
       dst_stride_argb == width * 4) {
@@ -601,6 +1197,15 @@ int I444ToARGBMatrix(const uint8_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I444TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I444ToARGBRow = I444ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I444ToARGBRow = I444ToARGBRow_AVX512BW;
+    }
+  }
+#endif
 #if defined(HAS_I444TOARGBROW_NEON)
   if (TestCpuFlag(kCpuHasNEON)) {
     I444ToARGBRow = I444ToARGBRow_Any_NEON;
@@ -813,6 +1418,11 @@ int I444ToRGB24Matrix(const uint8_t* src_y,
     dst_rgb24 = dst_rgb24 + (height - 1) * dst_stride_rgb24;
     dst_stride_rgb24 = -dst_stride_rgb24;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I444ToRGB24Matrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 0, dst_rgb24,
+                            dst_stride_rgb24, yuvconstants, width, height);
+  }
   // Coalesce rows.
   if (src_stride_y == width && src_stride_u == width && src_stride_v == width &&
       dst_stride_rgb24 == width * 3) {
@@ -942,6 +1552,11 @@ int I010ToAR30Matrix(const uint16_t* src_y,
     dst_ar30 = dst_ar30 + (height - 1) * dst_stride_ar30;
     dst_stride_ar30 = -dst_stride_ar30;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I010ToAR30Matrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 1, dst_ar30,
+                              dst_stride_ar30, yuvconstants, width, height);
+  }
 #if defined(HAS_I210TOAR30ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I210ToAR30Row = I210ToAR30Row_Any_SSSE3;
@@ -957,6 +1572,15 @@ int I010ToAR30Matrix(const uint16_t* src_y,
       I210ToAR30Row = I210ToAR30Row_AVX2;
     }
   }
+#endif
+#if defined(HAS_I210TOAR30ROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I210ToAR30Row = I210ToAR30Row_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I210ToAR30Row = I210ToAR30Row_AVX512BW;
+    }
+  }
 #endif
   for (y = 0; y < height; ++y) {
     I210ToAR30Row(src_y, src_u, src_v, dst_ar30, yuvconstants, width);
@@ -1102,6 +1726,11 @@ int I012ToAR30Matrix(const uint16_t* src_y,
     dst_ar30 = dst_ar30 + (height - 1) * dst_stride_ar30;
     dst_stride_ar30 = -dst_stride_ar30;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I012ToAR30Matrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 1, dst_ar30,
+                              dst_stride_ar30, yuvconstants, width, height);
+  }
 #if defined(HAS_I212TOAR30ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I212ToAR30Row = I212ToAR30Row_Any_SSSE3;
@@ -1160,6 +1789,11 @@ int I210ToAR30Matrix(const uint16_t* src_y,
     dst_ar30 = dst_ar30 + (height - 1) * dst_stride_ar30;
     dst_stride_ar30 = -dst_stride_ar30;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I210ToAR30Matrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 0, dst_ar30,
+                              dst_stride_ar30, yuvconstants, width, height);
+  }
 #if defined(HAS_I210TOAR30ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I210ToAR30Row = I210ToAR30Row_Any_SSSE3;
@@ -1175,6 +1809,15 @@ int I210ToAR30Matrix(const uint16_t* src_y,
       I210ToAR30Row = I210ToAR30Row_AVX2;
     }
   }
+#endif
+#if defined(HAS_I210TOAR30ROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I210ToAR30Row = I210ToAR30Row_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I210ToAR30Row = I210ToAR30Row_AVX512BW;
+    }
+  }
 #endif
   for (y = 0; y < height; ++y) {
     I210ToAR30Row(src_y, src_u, src_v, dst_ar30, yuvconstants, width);
@@ -1315,6 +1958,11 @@ int I410ToAR30Matrix(const uint16_t* src_y,
     dst_ar30 = dst_ar30 + (height - 1) * dst_stride_ar30;
     dst_stride_ar30 = -dst_stride_ar30;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I410ToAR30Matrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 0, dst_ar30,
+                              dst_stride_ar30, yuvconstants, width, height);
+  }
 #if defined(HAS_I410TOAR30ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I410ToAR30Row = I410ToAR30Row_Any_SSSE3;
@@ -1330,6 +1978,15 @@ int I410ToAR30Matrix(const uint16_t* src_y,
       I410ToAR30Row = I410ToAR30Row_AVX2;
     }
   }
+#endif
+#if defined(HAS_I410TOAR30ROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I410ToAR30Row = I410ToAR30Row_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I410ToAR30Row = I410ToAR30Row_AVX512BW;
+    }
+  }
 #endif
   for (y = 0; y < height; ++y) {
     I410ToAR30Row(src_y, src_u, src_v, dst_ar30, yuvconstants, width);
@@ -1369,6 +2026,11 @@ int I010ToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I010ToARGBMatrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 1, dst_argb,
+                              dst_stride_argb, yuvconstants, width, height);
+  }
 #if defined(HAS_I210TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I210ToARGBRow = I210ToARGBRow_Any_SSSE3;
@@ -1384,6 +2046,15 @@ int I010ToARGBMatrix(const uint16_t* src_y,
       I210ToARGBRow = I210ToARGBRow_AVX2;
     }
   }
+#endif
+#if defined(HAS_I210TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I210ToARGBRow = I210ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I210ToARGBRow = I210ToARGBRow_AVX512BW;
+    }
+  }
 #endif
   for (y = 0; y < height; ++y) {
     I210ToARGBRow(src_y, src_u, src_v, dst_argb, yuvconstants, width);
@@ -1533,6 +2204,11 @@ int I012ToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I012ToARGBMatrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 1, dst_argb,
+                              dst_stride_argb, yuvconstants, width, height);
+  }
 #if defined(HAS_I212TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I212ToARGBRow = I212ToARGBRow_Any_SSSE3;
@@ -1589,6 +2265,11 @@ int I210ToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I210ToARGBMatrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 0, dst_argb,
+                              dst_stride_argb, yuvconstants, width, height);
+  }
 #if defined(HAS_I210TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I210ToARGBRow = I210ToARGBRow_Any_SSSE3;
@@ -1604,6 +2285,15 @@ int I210ToARGBMatrix(const uint16_t* src_y,
       I210ToARGBRow = I210ToARGBRow_AVX2;
     }
   }
+#endif
+#if defined(HAS_I210TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I210ToARGBRow = I210ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I210ToARGBRow = I210ToARGBRow_AVX512BW;
+    }
+  }
 #endif
   for (y = 0; y < height; ++y) {
     I210ToARGBRow(src_y, src_u, src_v, dst_argb, yuvconstants, width);
@@ -1750,6 +2440,11 @@ int I410ToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Planar16ToRGBBands(I410ToARGBMatrix, src_y, src_stride_y, src_u,
+                              src_stride_u, src_v, src_stride_v, 0, dst_argb,
+                              dst_stride_argb, yuvconstants, width, height);
+  }
 #if defined(HAS_I410TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I410ToARGBRow = I410ToARGBRow_Any_SSSE3;
@@ -1765,6 +2460,15 @@ int I410ToARGBMatrix(const uint16_t* src_y,
       I410ToARGBRow = I410ToARGBRow_AVX2;
     }
   }
+#endif
+#if defined(HAS_I410TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I410ToARGBRow = I410ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I410ToARGBRow = I410ToARGBRow_AVX512BW;
+    }
+  }
 #endif
   for (y = 0; y < height; ++y) {
     I410ToARGBRow(src_y, src_u, src_v, dst_argb, yuvconstants, width);
@@ -1800,6 +2504,11 @@ int P010ToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Biplanar16ToRGBBands(P010ToARGBMatrix, src_y, src_stride_y, src_uv,
+                                src_stride_uv, 1, dst_argb, dst_stride_argb,
+                                yuvconstants, width, height);
+  }
 #if defined(HAS_P210TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     P210ToARGBRow = P210ToARGBRow_Any_SSSE3;
@@ -1851,6 +2560,11 @@ int P210ToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Biplanar16ToRGBBands(P210ToARGBMatrix, src_y, src_stride_y, src_uv,
+                                src_stride_uv, 0, dst_argb, dst_stride_argb,
+                                yuvconstants, width, height);
+  }
 #if defined(HAS_P210TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     P210ToARGBRow = P210ToARGBRow_Any_SSSE3;
@@ -1900,6 +2614,11 @@ int P010ToAR30Matrix(const uint16_t* src_y,
     dst_ar30 = dst_ar30 + (height - 1) * dst_stride_ar30;
     dst_stride_ar30 = -dst_stride_ar30;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Biplanar16ToRGBBands(P010ToAR30Matrix, src_y, src_stride_y, src_uv,
+                                src_stride_uv, 1, dst_ar30, dst_stride_ar30,
+                                yuvconstants, width, height);
+  }
 #if defined(HAS_P210TOAR30ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     P210ToAR30Row = P210ToAR30Row_Any_SSSE3;
@@ -1951,6 +2670,11 @@ int P210ToAR30Matrix(const uint16_t* src_y,
     dst_ar30 = dst_ar30 + (height - 1) * dst_stride_ar30;
     dst_stride_ar30 = -dst_stride_ar30;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return Biplanar16ToRGBBands(P210ToAR30Matrix, src_y, src_stride_y, src_uv,
+                                src_stride_uv, 0, dst_ar30, dst_stride_ar30,
+                                yuvconstants, width, height);
+  }
 #if defined(HAS_P210TOAR30ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     P210ToAR30Row = P210ToAR30Row_Any_SSSE3;
@@ -1976,6 +2700,155 @@ int P210ToAR30Matrix(const uint16_t* src_y,
   return 0;
 }
 
+// Linear BT.2020 RGB to linear BT.709 RGB (ITU-R BT.2087).
+static const double kBT2020ToBT709[9] = {
+    1.6605, -0.5876, -0.0728,  // R
+    -0.1246, 1.1329, -0.0083,  // G
+    -0.0182, -0.1006, 1.1187,  // B
+};
+
+// Relative light l, where 1.0 is SDR white, to the SDR range 0 to 1. Levels
+// below the knee pass unchanged and the rest roll off to reach 1.0 at lw.
+static double ToneMapCurve(double l, double lw) {
+  const double kKnee = 0.75;
+  double t, tw;
+  if (lw <= 1.0 || l <= kKnee) {
+    return l > 1.0 ? 1.0 : l;
+  }
+  t = (l - kKnee) / (1.0 - kKnee);
+  tw = (lw - kKnee) / (1.0 - kKnee);
+  return kKnee + (1.0 - kKnee) * t * (1.0 + t / (tw * tw)) / (1.0 + t);
+}
+
+LIBYUV_API
+int InitToneMapConstants(struct ToneMapConstants* tonemap,
+                         enum ToneMapTransfer transfer,
+                         int src_peak_nits,
+                         int dst_white_nits) {
+  const double peak = (double)src_peak_nits;
+  const double lw = (double)src_peak_nits / (double)dst_white_nits;
+  int i;
+  if (!tonemap || src_peak_nits <= 0 || dst_white_nits <= 0 ||
+      (transfer != kToneMapPQ && transfer != kToneMapHLG)) {
+    return -1;
+  }
+  for (i = 0; i < 1024; ++i) {
+    double e = i / 1023.0;
+    double nits, lin;
+    if (transfer == kToneMapPQ) {
+      // SMPTE ST 2084 EOTF.
+      const double m1 = 0.1593017578125;
+      const double m2 = 78.84375;
+      const double c1 = 0.8359375;
+      const double c2 = 18.8515625;
+      const double c3 = 18.6875;
+      double p = pow(e, 1.0 / m2);
+      double n = p - c1 > 0.0 ? p - c1 : 0.0;
+      nits = 10000.0 * pow(n / (c2 - c3 * p), 1.0 / m1);
+    } else {
+      // HLG inverse OETF then the system gamma of BT.2100 for a display of
+      // src_peak_nits, applied per channel rather than on luminance.
+      const double a = 0.17883277;
+      const double b = 0.28466892;
+      const double c = 0.55991073;
+      double gamma = 1.2 + 0.42 * log10(peak / 1000.0);
+      double scene = e <= 0.5 ? e * e / 3.0 : (exp((e - c) / a) + b) / 12.0;
+      if (gamma < 1.0) {
+        gamma = 1.0;
+      }
+      nits = peak * pow(scene, gamma);
+    }
+    lin = nits >= peak ? 1.0 : nits / peak;
+    tonemap->kEotf[i] = (uint32_t)(lin * 65535.0 + 0.5);
+  }
+  for (i = 0; i < 9; ++i) {
+    int32_t coeff = (int32_t)floor(kBT2020ToBT709[i] * 16384.0 + 0.5);
+    int j;
+    for (j = 0; j < 8; ++j) {
+      tonemap->kGamut[i * 8 + j] = coeff;
+    }
+  }
+  for (i = 0; i < 8; ++i) {
+    tonemap->kGamut[9 * 8 + i] = 32768;
+    tonemap->kGamut[10 * 8 + i] = 16383;
+  }
+  for (i = 0; i < 16384; ++i) {
+    double l = ToneMapCurve(i * 4 / 65535.0 * lw, lw);
+    // BT.709 OETF.
+    double v = l < 0.018 ? 4.5 * l : 1.099 * pow(l, 0.45) - 0.099;
+    tonemap->kOetf[i] = (uint8_t)(v * 255.0 + 0.5);
+  }
+  for (i = 16384; i < 16384 + 4; ++i) {
+    tonemap->kOetf[i] = tonemap->kOetf[16383];
+  }
+  return 0;
+}
+
+// Convert BT.2020 P010 to BT.709 ARGB with tone mapping. Rows are converted
+// to AR30 in dst_argb and then tone mapped in place.
+LIBYUV_API
+int P010ToARGBToneMapped(const uint16_t* src_y,
+                         int src_stride_y,
+                         const uint16_t* src_uv,
+                         int src_stride_uv,
+                         uint8_t* dst_argb,
+                         int dst_stride_argb,
+                         const struct ToneMapConstants* tonemap,
+                         int width,
+                         int height) {
+  int y;
+  void (*P210ToAR30Row)(
+      const uint16_t* y_buf, const uint16_t* uv_buf, uint8_t* rgb_buf,
+      const struct YuvConstants* yuvconstants, int width) = P210ToAR30Row_C;
+  void (*AR30ToARGBToneMapRow)(const uint8_t* src_ar30, uint8_t* dst_argb,
+                               const struct ToneMapConstants* tonemap,
+                               int width) = AR30ToARGBToneMapRow_C;
+  if (!src_y || !src_uv || !dst_argb || !tonemap || width <= 0 ||
+      height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    dst_argb = dst_argb + (height - 1) * dst_stride_argb;
+    dst_stride_argb = -dst_stride_argb;
+  }
+#if defined(HAS_P210TOAR30ROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    P210ToAR30Row = P210ToAR30Row_Any_SSSE3;
+    if (IS_ALIGNED(width, 8)) {
+      P210ToAR30Row = P210ToAR30Row_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_P210TOAR30ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    P210ToAR30Row = P210ToAR30Row_Any_AVX2;
+    if (IS_ALIGNED(width, 16)) {
+      P210ToAR30Row = P210ToAR30Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_AR30TOARGBTONEMAPROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    AR30ToARGBToneMapRow = AR30ToARGBToneMapRow_Any_AVX2;
+    if (IS_ALIGNED(width, 8)) {
+      AR30ToARGBToneMapRow = AR30ToARGBToneMapRow_AVX2;
+    }
+  }
+#endif
+  for (y = 0; y < height; ++y) {
+    P210ToAR30Row(src_y, src_uv, dst_argb, &kYuv2020Constants, width);
+    AR30ToARGBToneMapRow(dst_argb, dst_argb, tonemap, width);
+    dst_argb += dst_stride_argb;
+    src_y += src_stride_y;
+    if (y & 1) {
+      src_uv += src_stride_uv;
+    }
+  }
+  return 0;
+}
+
 // Convert I420 with Alpha to preattenuated ARGB with matrix.
 LIBYUV_API
 int I420AlphaToARGBMatrix(const uint8_t* src_y,
@@ -2011,6 +2884,13 @@ int I420AlphaToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarAlphaToARGBBands(I420AlphaToARGBMatrix, src_y, src_stride_y,
+                                  src_u, src_stride_u, src_v, src_stride_v,
+                                  src_a, src_stride_a, 1, dst_argb,
+                                  dst_stride_argb, yuvconstants, width, height,
+                                  attenuate);
+  }
 #if defined(HAS_I422ALPHATOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422AlphaToARGBRow = I422AlphaToARGBRow_Any_SSSE3;
@@ -2154,6 +3034,13 @@ int I422AlphaToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarAlphaToARGBBands(I422AlphaToARGBMatrix, src_y, src_stride_y,
+                                  src_u, src_stride_u, src_v, src_stride_v,
+                                  src_a, src_stride_a, 0, dst_argb,
+                                  dst_stride_argb, yuvconstants, width, height,
+                                  attenuate);
+  }
 #if defined(HAS_I422ALPHATOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422AlphaToARGBRow = I422AlphaToARGBRow_Any_SSSE3;
@@ -2295,6 +3182,13 @@ int I444AlphaToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarAlphaToARGBBands(I444AlphaToARGBMatrix, src_y, src_stride_y,
+                                  src_u, src_stride_u, src_v, src_stride_v,
+                                  src_a, src_stride_a, 0, dst_argb,
+                                  dst_stride_argb, yuvconstants, width, height,
+                                  attenuate);
+  }
 #if defined(HAS_I444ALPHATOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I444AlphaToARGBRow = I444AlphaToARGBRow_Any_SSSE3;
@@ -2549,6 +3443,13 @@ int I010AlphaToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarAlpha16ToARGBBands(I010AlphaToARGBMatrix, src_y, src_stride_y,
+                                    src_u, src_stride_u, src_v, src_stride_v,
+                                    src_a, src_stride_a, 1, dst_argb,
+                                    dst_stride_argb, yuvconstants, width,
+                                    height, attenuate);
+  }
 #if defined(HAS_I210ALPHATOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I210AlphaToARGBRow = I210AlphaToARGBRow_Any_SSSE3;
@@ -2655,6 +3556,13 @@ int I210AlphaToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarAlpha16ToARGBBands(I210AlphaToARGBMatrix, src_y, src_stride_y,
+                                    src_u, src_stride_u, src_v, src_stride_v,
+                                    src_a, src_stride_a, 0, dst_argb,
+                                    dst_stride_argb, yuvconstants, width,
+                                    height, attenuate);
+  }
 #if defined(HAS_I210ALPHATOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I210AlphaToARGBRow = I210AlphaToARGBRow_Any_SSSE3;
@@ -2759,6 +3667,13 @@ int I410AlphaToARGBMatrix(const uint16_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarAlpha16ToARGBBands(I410AlphaToARGBMatrix, src_y, src_stride_y,
+                                    src_u, src_stride_u, src_v, src_stride_v,
+                                    src_a, src_stride_a, 0, dst_argb,
+                                    dst_stride_argb, yuvconstants, width,
+                                    height, attenuate);
+  }
 #if defined(HAS_I410ALPHATOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I410AlphaToARGBRow = I410AlphaToARGBRow_Any_SSSE3;
@@ -2851,6 +3766,10 @@ int I400ToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlaneToRGBBands(I400ToARGBMatrix, src_y, src_stride_y, dst_argb,
+                           dst_stride_argb, yuvconstants, width, height);
+  }
   // Coalesce rows.
   if (src_stride_y == width && dst_stride_argb == width * 4) {
     width *= height;
@@ -3995,6 +4914,11 @@ int NV12ToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return BiplanarToRGBBands(NV12ToARGBMatrix, src_y, src_stride_y, src_uv,
+                              src_stride_uv, 1, dst_argb, dst_stride_argb,
+                              yuvconstants, width, height);
+  }
 #if defined(HAS_NV12TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     NV12ToARGBRow = NV12ToARGBRow_Any_SSSE3;
@@ -4011,6 +4935,15 @@ int NV12ToARGBMatrix(const uint8_t* src_y,
     }
   }
 #endif
+#if defined(HAS_NV12TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    NV12ToARGBRow = NV12ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      NV12ToARGBRow = NV12ToARGBRow_AVX512BW;
+    }
+  }
+#endif
 #if defined(HAS_NV12TOARGBROW_NEON)
   if (TestCpuFlag(kCpuHasNEON)) {
     NV12ToARGBRow = NV12ToARGBRow_Any_NEON;
@@ -4085,6 +5018,11 @@ int NV21ToARGBMatrix(const uint8_t* src_y,
     dst_argb = dst_argb + (height - 1) * dst_stride_argb;
     dst_stride_argb = -dst_stride_argb;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return BiplanarToRGBBands(NV21ToARGBMatrix, src_y, src_stride_y, src_vu,
+                              src_stride_vu, 1, dst_argb, dst_stride_argb,
+                              yuvconstants, width, height);
+  }
 #if defined(HAS_NV21TOARGBROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     NV21ToARGBRow = NV21ToARGBRow_Any_SSSE3;
@@ -4234,6 +5172,11 @@ int NV12ToRGB24Matrix(const uint8_t* src_y,
     dst_rgb24 = dst_rgb24 + (height - 1) * dst_stride_rgb24;
     dst_stride_rgb24 = -dst_stride_rgb24;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return BiplanarToRGBBands(NV12ToRGB24Matrix, src_y, src_stride_y, src_uv,
+                              src_stride_uv, 1, dst_rgb24, dst_stride_rgb24,
+                              yuvconstants, width, height);
+  }
 #if defined(HAS_NV12TORGB24ROW_NEON)
   if (TestCpuFlag(kCpuHasNEON)) {
     NV12ToRGB24Row = NV12ToRGB24Row_Any_NEON;
@@ -4300,6 +5243,11 @@ int NV21ToRGB24Matrix(const uint8_t* src_y,
     dst_rgb24 = dst_rgb24 + (height - 1) * dst_stride_rgb24;
     dst_stride_rgb24 = -dst_stride_rgb24;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return BiplanarToRGBBands(NV21ToRGB24Matrix, src_y, src_stride_y, src_vu,
+                              src_stride_vu, 1, dst_rgb24, dst_stride_rgb24,
+                              yuvconstants, width, height);
+  }
 #if defined(HAS_NV21TORGB24ROW_NEON)
   if (TestCpuFlag(kCpuHasNEON)) {
     NV21ToRGB24Row = NV21ToRGB24Row_Any_NEON;
@@ -4749,6 +5697,11 @@ int I422ToRGBAMatrix(const uint8_t* src_y,
     dst_rgba = dst_rgba + (height - 1) * dst_stride_rgba;
     dst_stride_rgba = -dst_stride_rgba;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I422ToRGBAMatrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 0, dst_rgba,
+                            dst_stride_rgba, yuvconstants, width, height);
+  }
 #if defined(HAS_I422TORGBAROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422ToRGBARow = I422ToRGBARow_Any_SSSE3;
@@ -4874,6 +5827,11 @@ int NV12ToRGB565Matrix(const uint8_t* src_y,
     dst_rgb565 = dst_rgb565 + (height - 1) * dst_stride_rgb565;
     dst_stride_rgb565 = -dst_stride_rgb565;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return BiplanarToRGBBands(NV12ToRGB565Matrix, src_y, src_stride_y, src_uv,
+                              src_stride_uv, 1, dst_rgb565, dst_stride_rgb565,
+                              yuvconstants, width, height);
+  }
 #if defined(HAS_NV12TORGB565ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     NV12ToRGB565Row = NV12ToRGB565Row_Any_SSSE3;
@@ -4977,6 +5935,11 @@ int I420ToRGBAMatrix(const uint8_t* src_y,
     dst_rgba = dst_rgba + (height - 1) * dst_stride_rgba;
     dst_stride_rgba = -dst_stride_rgba;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I420ToRGBAMatrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 1, dst_rgba,
+                            dst_stride_rgba, yuvconstants, width, height);
+  }
 #if defined(HAS_I422TORGBAROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422ToRGBARow = I422ToRGBARow_Any_SSSE3;
@@ -5107,6 +6070,11 @@ int I420ToRGB24Matrix(const uint8_t* src_y,
     dst_rgb24 = dst_rgb24 + (height - 1) * dst_stride_rgb24;
     dst_stride_rgb24 = -dst_stride_rgb24;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I420ToRGB24Matrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 1, dst_rgb24,
+                            dst_stride_rgb24, yuvconstants, width, height);
+  }
 #if defined(HAS_I422TORGB24ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422ToRGB24Row = I422ToRGB24Row_Any_SSSE3;
@@ -5309,6 +6277,11 @@ int I422ToRGB24Matrix(const uint8_t* src_y,
     dst_rgb24 = dst_rgb24 + (height - 1) * dst_stride_rgb24;
     dst_stride_rgb24 = -dst_stride_rgb24;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I422ToRGB24Matrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 0, dst_rgb24,
+                            dst_stride_rgb24, yuvconstants, width, height);
+  }
 #if defined(HAS_I422TORGB24ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422ToRGB24Row = I422ToRGB24Row_Any_SSSE3;
@@ -5615,6 +6588,11 @@ int I420ToRGB565Matrix(const uint8_t* src_y,
     dst_rgb565 = dst_rgb565 + (height - 1) * dst_stride_rgb565;
     dst_stride_rgb565 = -dst_stride_rgb565;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I420ToRGB565Matrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 1, dst_rgb565,
+                            dst_stride_rgb565, yuvconstants, width, height);
+  }
 #if defined(HAS_I422TORGB565ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422ToRGB565Row = I422ToRGB565Row_Any_SSSE3;
@@ -5755,6 +6733,11 @@ int I422ToRGB565Matrix(const uint8_t* src_y,
     dst_rgb565 = dst_rgb565 + (height - 1) * dst_stride_rgb565;
     dst_stride_rgb565 = -dst_stride_rgb565;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I422ToRGB565Matrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 0, dst_rgb565,
+                            dst_stride_rgb565, yuvconstants, width, height);
+  }
 #if defined(HAS_I422TORGB565ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
     I422ToRGB565Row = I422ToRGB565Row_Any_SSSE3;
@@ -6028,6 +7011,11 @@ int I420ToAR30Matrix(const uint8_t* src_y,
     dst_ar30 = dst_ar30 + (height - 1) * dst_stride_ar30;
     dst_stride_ar30 = -dst_stride_ar30;
   }
+  if (ConvertNumBands(width, height) > 1) {
+    return PlanarToRGBBands(I420ToAR30Matrix, src_y, src_stride_y, src_u,
+                            src_stride_u, src_v, src_stride_v, 1, dst_ar30,
+                            dst_stride_ar30, yuvconstants, width, height);
+  }
 
 #if defined(HAS_I422TOAR30ROW_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
@@ -6045,6 +7033,15 @@ int I420ToAR30Matrix(const uint8_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I422TOAR30ROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I422ToAR30Row = I422ToAR30Row_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I422ToAR30Row = I422ToAR30Row_AVX512BW;
+    }
+  }
+#endif
 
   for (y = 0; y < height; ++y) {
     I422ToAR30Row(src_y, src_u, src_v, dst_ar30, yuvconstants, width);
@@ -6173,6 +7170,15 @@ static int I420ToARGBMatrixBilinear(const uint8_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I444TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I444ToARGBRow = I444ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I444ToARGBRow = I444ToARGBRow_AVX512BW;
+    }
+  }
+#endif
 #if defined(HAS_I444TOARGBROW_NEON)
   if (TestCpuFlag(kCpuHasNEON)) {
     I444ToARGBRow = I444ToARGBRow_Any_NEON;
@@ -6318,6 +7324,15 @@ static int I422ToARGBMatrixLinear(const uint8_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I444TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I444ToARGBRow = I444ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I444ToARGBRow = I444ToARGBRow_AVX512BW;
+    }
+  }
+#endif
 #if defined(HAS_I444TOARGBROW_NEON)
   if (TestCpuFlag(kCpuHasNEON)) {
     I444ToARGBRow = I444ToARGBRow_Any_NEON;
@@ -6588,6 +7603,15 @@ static int I010ToAR30MatrixBilinear(const uint16_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I410TOAR30ROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I410ToAR30Row = I410ToAR30Row_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I410ToAR30Row = I410ToAR30Row_AVX512BW;
+    }
+  }
+#endif
 
 #if defined(HAS_SCALEROWUP2_BILINEAR_12_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
@@ -6692,6 +7716,15 @@ static int I210ToAR30MatrixLinear(const uint16_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I410TOAR30ROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I410ToAR30Row = I410ToAR30Row_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I410ToAR30Row = I410ToAR30Row_AVX512BW;
+    }
+  }
+#endif
 
 #if defined(HAS_SCALEROWUP2_LINEAR_12_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
@@ -6775,6 +7808,15 @@ static int I010ToARGBMatrixBilinear(const uint16_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I410TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I410ToARGBRow = I410ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I410ToARGBRow = I410ToARGBRow_AVX512BW;
+    }
+  }
+#endif
 
 #if defined(HAS_SCALEROWUP2_BILINEAR_12_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
@@ -6878,6 +7920,15 @@ static int I210ToARGBMatrixLinear(const uint16_t* src_y,
     }
   }
 #endif
+#if defined(HAS_I410TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I410ToARGBRow = I410ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I410ToARGBRow = I410ToARGBRow_AVX512BW;
+    }
+  }
+#endif
 
 #if defined(HAS_SCALEROWUP2_LINEAR_12_SSSE3)
   if (TestCpuFlag(kCpuHasSSSE3)) {
@@ -8094,6 +9145,370 @@ int I420ToARGBMatrixFilter(const uint8_t* src_y,
   return -1;
 }
 
+// State for converting a frame of I420 to ARGB in slices of rows.
+struct I420ToARGBSlicer {
+  void (*I422ToARGBRow)(const uint8_t* y_buf,
+                        const uint8_t* u_buf,
+                        const uint8_t* v_buf,
+                        uint8_t* rgb_buf,
+                        const struct YuvConstants* yuvconstants,
+                        int width);
+  void (*I444ToARGBRow)(const uint8_t* y_buf,
+                        const uint8_t* u_buf,
+                        const uint8_t* v_buf,
+                        uint8_t* rgb_buf,
+                        const struct YuvConstants* yuvconstants,
+                        int width);
+  void (*Scale2RowUp_Bilinear)(const uint8_t* src_ptr,
+                               ptrdiff_t src_stride,
+                               uint8_t* dst_ptr,
+                               ptrdiff_t dst_stride,
+                               int dst_width);
+  void (*ScaleRowUp2_Linear)(const uint8_t* src_ptr,
+                             uint8_t* dst_ptr,
+                             int dst_width);
+  const struct YuvConstants* yuvconstants;
+  int width;
+  int height;  // Negative height means invert the image.
+  int bilinear;
+  int row_size;
+  int src_rows;  // Rows of the frame received so far.
+  int dst_rows;  // Rows of the frame converted so far.
+  uint8_t* row_mem;
+  // 2 rows each of upsampled u and v, then 2 rows each of u and v carried
+  // over from the previous slice, then 1 row of y.
+  uint8_t* temp_u;
+  uint8_t* temp_v;
+  uint8_t* carry_u;
+  uint8_t* carry_v;
+  uint8_t* carry_y;
+};
+
+LIBYUV_API
+struct I420ToARGBSlicer* I420ToARGBSlicerCreate(
+    const struct YuvConstants* yuvconstants,
+    int width,
+    int height,
+    enum FilterMode filter) {
+  struct I420ToARGBSlicer* slicer;
+  void (*I422ToARGBRow)(const uint8_t* y_buf, const uint8_t* u_buf,
+                        const uint8_t* v_buf, uint8_t* rgb_buf,
+                        const struct YuvConstants* yuvconstants, int width) =
+      I422ToARGBRow_C;
+  void (*I444ToARGBRow)(const uint8_t* y_buf, const uint8_t* u_buf,
+                        const uint8_t* v_buf, uint8_t* rgb_buf,
+                        const struct YuvConstants* yuvconstants, int width) =
+      I444ToARGBRow_C;
+  void (*Scale2RowUp_Bilinear)(const uint8_t* src_ptr, ptrdiff_t src_stride,
+                               uint8_t* dst_ptr, ptrdiff_t dst_stride,
+                               int dst_width) = ScaleRowUp2_Bilinear_Any_C;
+  void (*ScaleRowUp2_Linear)(const uint8_t* src_ptr, uint8_t* dst_ptr,
+                             int dst_width) = ScaleRowUp2_Linear_Any_C;
+  const int row_size = (width + 31) & ~31;
+  if (!yuvconstants || width <= 0 || height == 0 || filter == kFilterLinear) {
+    return NULL;
+  }
+#if defined(HAS_I422TOARGBROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    I422ToARGBRow = I422ToARGBRow_Any_SSSE3;
+    if (IS_ALIGNED(width, 8)) {
+      I422ToARGBRow = I422ToARGBRow_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    I422ToARGBRow = I422ToARGBRow_Any_AVX2;
+    if (IS_ALIGNED(width, 16)) {
+      I422ToARGBRow = I422ToARGBRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I422ToARGBRow = I422ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I422ToARGBRow = I422ToARGBRow_AVX512BW;
+    }
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    I422ToARGBRow = I422ToARGBRow_Any_NEON;
+    if (IS_ALIGNED(width, 8)) {
+      I422ToARGBRow = I422ToARGBRow_NEON;
+    }
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    I422ToARGBRow = I422ToARGBRow_Any_MSA;
+    if (IS_ALIGNED(width, 8)) {
+      I422ToARGBRow = I422ToARGBRow_MSA;
+    }
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    I422ToARGBRow = I422ToARGBRow_Any_LSX;
+    if (IS_ALIGNED(width, 16)) {
+      I422ToARGBRow = I422ToARGBRow_LSX;
+    }
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_LASX)
+  if (TestCpuFlag(kCpuHasLASX)) {
+    I422ToARGBRow = I422ToARGBRow_Any_LASX;
+    if (IS_ALIGNED(width, 32)) {
+      I422ToARGBRow = I422ToARGBRow_LASX;
+    }
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    I422ToARGBRow = I422ToARGBRow_RVV;
+  }
+#endif
+#if defined(HAS_I444TOARGBROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    I444ToARGBRow = I444ToARGBRow_Any_SSSE3;
+    if (IS_ALIGNED(width, 8)) {
+      I444ToARGBRow = I444ToARGBRow_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_I444TOARGBROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    I444ToARGBRow = I444ToARGBRow_Any_AVX2;
+    if (IS_ALIGNED(width, 16)) {
+      I444ToARGBRow = I444ToARGBRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_I444TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    I444ToARGBRow = I444ToARGBRow_Any_AVX512BW;
+    if (IS_ALIGNED(width, 32)) {
+      I444ToARGBRow = I444ToARGBRow_AVX512BW;
+    }
+  }
+#endif
+#if defined(HAS_I444TOARGBROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    I444ToARGBRow = I444ToARGBRow_Any_NEON;
+    if (IS_ALIGNED(width, 8)) {
+      I444ToARGBRow = I444ToARGBRow_NEON;
+    }
+  }
+#endif
+#if defined(HAS_I444TOARGBROW_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    I444ToARGBRow = I444ToARGBRow_Any_MSA;
+    if (IS_ALIGNED(width, 8)) {
+      I444ToARGBRow = I444ToARGBRow_MSA;
+    }
+  }
+#endif
+#if defined(HAS_I444TOARGBROW_LASX)
+  if (TestCpuFlag(kCpuHasLASX)) {
+    I444ToARGBRow = I444ToARGBRow_Any_LASX;
+    if (IS_ALIGNED(width, 32)) {
+      I444ToARGBRow = I444ToARGBRow_LASX;
+    }
+  }
+#endif
+#if defined(HAS_I444TOARGBROW_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    I444ToARGBRow = I444ToARGBRow_RVV;
+  }
+#endif
+
+#if defined(HAS_SCALEROWUP2_BILINEAR_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    Scale2RowUp_Bilinear = ScaleRowUp2_Bilinear_Any_SSE2;
+    ScaleRowUp2_Linear = ScaleRowUp2_Linear_Any_SSE2;
+  }
+#endif
+
+#if defined(HAS_SCALEROWUP2_BILINEAR_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    Scale2RowUp_Bilinear = ScaleRowUp2_Bilinear_Any_SSSE3;
+    ScaleRowUp2_Linear = ScaleRowUp2_Linear_Any_SSSE3;
+  }
+#endif
+
+#if defined(HAS_SCALEROWUP2_BILINEAR_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    Scale2RowUp_Bilinear = ScaleRowUp2_Bilinear_Any_AVX2;
+    ScaleRowUp2_Linear = ScaleRowUp2_Linear_Any_AVX2;
+  }
+#endif
+
+#if defined(HAS_SCALEROWUP2_BILINEAR_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    Scale2RowUp_Bilinear = ScaleRowUp2_Bilinear_Any_NEON;
+    ScaleRowUp2_Linear = ScaleRowUp2_Linear_Any_NEON;
+  }
+#endif
+#if defined(HAS_SCALEROWUP2_BILINEAR_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    Scale2RowUp_Bilinear = ScaleRowUp2_Bilinear_RVV;
+    ScaleRowUp2_Linear = ScaleRowUp2_Linear_RVV;
+  }
+#endif
+
+  slicer = (struct I420ToARGBSlicer*)malloc(sizeof(struct I420ToARGBSlicer));
+  if (!slicer) {
+    return NULL;
+  }
+  slicer->row_mem = (uint8_t*)malloc(row_size * 9 + 63);
+  if (!slicer->row_mem) {
+    free(slicer);
+    return NULL;
+  }
+  slicer->I422ToARGBRow = I422ToARGBRow;
+  slicer->I444ToARGBRow = I444ToARGBRow;
+  slicer->Scale2RowUp_Bilinear = Scale2RowUp_Bilinear;
+  slicer->ScaleRowUp2_Linear = ScaleRowUp2_Linear;
+  slicer->yuvconstants = yuvconstants;
+  slicer->width = width;
+  slicer->height = height;
+  slicer->bilinear = filter != kFilterNone;
+  slicer->row_size = row_size;
+  slicer->src_rows = 0;
+  slicer->dst_rows = 0;
+  slicer->temp_u =
+      (uint8_t*)(((uintptr_t)(slicer->row_mem) + 63) & ~(uintptr_t)63);
+  slicer->temp_v = slicer->temp_u + row_size * 2;
+  slicer->carry_u = slicer->temp_u + row_size * 4;
+  slicer->carry_v = slicer->temp_u + row_size * 6;
+  slicer->carry_y = slicer->temp_u + row_size * 8;
+  return slicer;
+}
+
+LIBYUV_API
+void I420ToARGBSlicerDestroy(struct I420ToARGBSlicer* slicer) {
+  if (slicer) {
+    free(slicer->row_mem);
+    free(slicer);
+  }
+}
+
+// Upsample chroma rows k and k + 1 to 2 rows of temp. Row k is the carried
+// over row when it came with the previous slice, which starts at row c0.
+static void SliceChromaRowsUp2(const struct I420ToARGBSlicer* slicer,
+                               const uint8_t* src,
+                               int src_stride,
+                               uint8_t* carry,
+                               int k,
+                               int c0,
+                               uint8_t* temp) {
+  if (k >= c0) {
+    slicer->Scale2RowUp_Bilinear(src + (ptrdiff_t)(k - c0) * src_stride,
+                                 src_stride, temp, slicer->row_size,
+                                 slicer->width);
+  } else {
+    memcpy(carry + slicer->row_size, src, (slicer->width + 1) / 2);
+    slicer->Scale2RowUp_Bilinear(carry, slicer->row_size, temp,
+                                 slicer->row_size, slicer->width);
+  }
+}
+
+LIBYUV_API
+int I420ToARGBSliceConvert(struct I420ToARGBSlicer* slicer,
+                           const uint8_t* src_y,
+                           int src_stride_y,
+                           const uint8_t* src_u,
+                           int src_stride_u,
+                           const uint8_t* src_v,
+                           int src_stride_v,
+                           int num_rows,
+                           uint8_t* dst_argb,
+                           int dst_stride_argb) {
+  int height;
+  int y0;
+  int y1;
+  int c0;
+  int c1;
+  int end;
+  int y;
+  if (!slicer || !src_y || !src_u || !src_v || !dst_argb || num_rows <= 0) {
+    return -1;
+  }
+  height = slicer->height;
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    dst_argb = dst_argb + (height - 1) * dst_stride_argb;
+    dst_stride_argb = -dst_stride_argb;
+  }
+  if (num_rows > height - slicer->src_rows) {
+    return -1;
+  }
+  // This slice has rows y0 to y1 - 1 and chroma rows c0 to c1 - 1.
+  y0 = slicer->src_rows;
+  y1 = y0 + num_rows;
+  c0 = (y0 + 1) >> 1;
+  c1 = (y1 + 1) >> 1;
+  // With bilinear filtering an odd row needs the chroma row below it, which
+  // comes with the next slice.
+  end = (slicer->bilinear && y1 < height && !(y1 & 1)) ? y1 - 1 : y1;
+
+  for (y = slicer->dst_rows; y < end; ++y) {
+    const uint8_t* row_y =
+        y < y0 ? slicer->carry_y : src_y + (ptrdiff_t)(y - y0) * src_stride_y;
+    uint8_t* row_argb = dst_argb + (ptrdiff_t)y * dst_stride_argb;
+    const int c = y >> 1;
+    const uint8_t* row_u =
+        c < c0 ? slicer->carry_u : src_u + (ptrdiff_t)(c - c0) * src_stride_u;
+    const uint8_t* row_v =
+        c < c0 ? slicer->carry_v : src_v + (ptrdiff_t)(c - c0) * src_stride_v;
+    if (!slicer->bilinear) {
+      slicer->I422ToARGBRow(row_y, row_u, row_v, row_argb,
+                            slicer->yuvconstants, slicer->width);
+    } else if (y == 0 || (y == height - 1 && !(height & 1))) {
+      slicer->ScaleRowUp2_Linear(row_u, slicer->temp_u, slicer->width);
+      slicer->ScaleRowUp2_Linear(row_v, slicer->temp_v, slicer->width);
+      slicer->I444ToARGBRow(row_y, slicer->temp_u, slicer->temp_v, row_argb,
+                            slicer->yuvconstants, slicer->width);
+    } else if (y & 1) {
+      SliceChromaRowsUp2(slicer, src_u, src_stride_u, slicer->carry_u, c, c0,
+                         slicer->temp_u);
+      SliceChromaRowsUp2(slicer, src_v, src_stride_v, slicer->carry_v, c, c0,
+                         slicer->temp_v);
+      slicer->I444ToARGBRow(row_y, slicer->temp_u, slicer->temp_v, row_argb,
+                            slicer->yuvconstants, slicer->width);
+    } else {
+      // Second row of the pair upsampled for the odd row above.
+      slicer->I444ToARGBRow(row_y, slicer->temp_u + slicer->row_size,
+                            slicer->temp_v + slicer->row_size, row_argb,
+                            slicer->yuvconstants, slicer->width);
+    }
+  }
+
+  // Keep the last chroma row, which the next slice may share, and a row
+  // still waiting for the next chroma row.
+  if (c1 > c0) {
+    memcpy(slicer->carry_u, src_u + (ptrdiff_t)(c1 - 1 - c0) * src_stride_u,
+           (slicer->width + 1) / 2);
+    memcpy(slicer->carry_v, src_v + (ptrdiff_t)(c1 - 1 - c0) * src_stride_v,
+           (slicer->width + 1) / 2);
+  }
+  if (end < y1) {
+    memcpy(slicer->carry_y, src_y + (ptrdiff_t)(num_rows - 1) * src_stride_y,
+           slicer->width);
+  }
+  slicer->src_rows = y1;
+  slicer->dst_rows = end;
+  if (y1 == height) {
+    slicer->src_rows = 0;
+    slicer->dst_rows = 0;
+  }
+  return end;
+}
+
 LIBYUV_API
 int I422ToARGBMatrixFilter(const uint8_t* src_y,
                            int src_stride_y,
@@ -8514,6 +9929,348 @@ int P210ToAR30MatrixFilter(const uint16_t* src_y,
   return -1;
 }
 
+// Returns the BayerRowToARGBRow layout of the first row of a Bayer fourcc, or
+// -1 if the fourcc is not Bayer.  Odd rows use the layout xor 3.
+static int BayerLayout(uint32_t fourcc) {
+  switch (CanonicalFourCC(fourcc)) {
+    case FOURCC_RGGB:
+      return 0;
+    case FOURCC_GRBG:
+      return 1;
+    case FOURCC_BGGR:
+      return 2;
+    case FOURCC_GBRG:
+      return 3;
+    default:
+      return -1;
+  }
+}
+
+// Copy Bayer row y to 8 bits with 1 mirrored sample each side.  Rows
+// outside the image mirror too, which keeps the color phase.
+static void BayerCopyRow(const uint8_t* src_bayer,
+                         const uint16_t* src_bayer_16,
+                         int src_stride_bayer,
+                         void (*Convert16To8Row)(const uint16_t* src_y,
+                                                 uint8_t* dst_y,
+                                                 int scale,
+                                                 int width),
+                         int scale,
+                         uint8_t* dst,
+                         int y,
+                         int width,
+                         int height) {
+  if (y < 0) {
+    y = height > 1 ? 1 : 0;
+  } else if (y >= height) {
+    y = height > 1 ? height - 2 : 0;
+  }
+  if (src_bayer_16) {
+    Convert16To8Row(src_bayer_16 + y * src_stride_bayer, dst, scale, width);
+  } else {
+    memcpy(dst, src_bayer + y * src_stride_bayer, width);
+  }
+  dst[-1] = dst[width > 1 ? 1 : 0];
+  dst[width] = dst[width > 1 ? width - 2 : 0];
+}
+
+// Bilinear demosaic of 8 bit, or 10 to 16 bit samples in lsbs, to ARGB.
+static int BayerxToARGB(const uint8_t* src_bayer,
+                        const uint16_t* src_bayer_16,
+                        int src_stride_bayer,
+                        uint8_t* dst_argb,
+                        int dst_stride_argb,
+                        int width,
+                        int height,
+                        int depth,
+                        uint32_t fourcc) {
+  int y;
+  int layout = BayerLayout(fourcc);
+  const int scale = 1 << (24 - depth);
+  void (*BayerRowToARGBRow)(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2, uint8_t* dst_argb,
+                            int layout, int width) = BayerRowToARGBRow_C;
+  void (*Convert16To8Row)(const uint16_t* src_y, uint8_t* dst_y, int scale,
+                          int width) = Convert16To8Row_C;
+  if ((!src_bayer && !src_bayer_16) || !dst_argb || width <= 0 ||
+      height == 0 || layout < 0 || depth < 8 || depth > 16) {
+    return -1;
+  }
+  // Negative height means invert the image.  The first row read is then the
+  // last row of the pattern.
+  if (height < 0) {
+    height = -height;
+    if (src_bayer_16) {
+      src_bayer_16 = src_bayer_16 + (height - 1) * src_stride_bayer;
+    } else {
+      src_bayer = src_bayer + (height - 1) * src_stride_bayer;
+    }
+    src_stride_bayer = -src_stride_bayer;
+    if (!(height & 1)) {
+      layout ^= 3;
+    }
+  }
+#if defined(HAS_BAYERROWTOARGBROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    BayerRowToARGBRow = BayerRowToARGBRow_Any_SSE2;
+    if (IS_ALIGNED(width, 16)) {
+      BayerRowToARGBRow = BayerRowToARGBRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_BAYERROWTOARGBROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    BayerRowToARGBRow = BayerRowToARGBRow_Any_AVX2;
+    if (IS_ALIGNED(width, 32)) {
+      BayerRowToARGBRow = BayerRowToARGBRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_BAYERROWTOARGBROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    BayerRowToARGBRow = BayerRowToARGBRow_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      BayerRowToARGBRow = BayerRowToARGBRow_NEON;
+    }
+  }
+#endif
+#if defined(HAS_CONVERT16TO8ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    Convert16To8Row = Convert16To8Row_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      Convert16To8Row = Convert16To8Row_NEON;
+    }
+  }
+#endif
+#if defined(HAS_CONVERT16TO8ROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    Convert16To8Row = Convert16To8Row_Any_SSSE3;
+    if (IS_ALIGNED(width, 16)) {
+      Convert16To8Row = Convert16To8Row_SSSE3;
+    }
+  }
+#endif
+#if defined(HAS_CONVERT16TO8ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    Convert16To8Row = Convert16To8Row_Any_AVX2;
+    if (IS_ALIGNED(width, 32)) {
+      Convert16To8Row = Convert16To8Row_AVX2;
+    }
+  }
+#endif
+
+  {
+    // A ring of 4 padded rows; the center of each starts 16 bytes in.
+    const int kRowSize = (width + 63) & ~31;
+    align_buffer_64(row, kRowSize * 4);
+    uint8_t* rows[4] = {row + 16, row + kRowSize + 16, row + kRowSize * 2 + 16,
+                        row + kRowSize * 3 + 16};
+    BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                 scale, rows[3], -1, width, height);
+    BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                 scale, rows[0], 0, width, height);
+    for (y = 0; y < height; ++y) {
+      BayerCopyRow(src_bayer, src_bayer_16, src_stride_bayer, Convert16To8Row,
+                   scale, rows[(y + 1) & 3], y + 1, width, height);
+      BayerRowToARGBRow(rows[(y - 1) & 3], rows[y & 3], rows[(y + 1) & 3],
+                        dst_argb, layout ^ ((y & 1) * 3), width);
+      dst_argb += dst_stride_argb;
+    }
+    free_aligned_buffer_64(row);
+  }
+  return 0;
+}
+
+// Convert Bayer to ARGB.
+LIBYUV_API
+int BayerToARGB(const uint8_t* src_bayer,
+                int src_stride_bayer,
+                uint8_t* dst_argb,
+                int dst_stride_argb,
+                int width,
+                int height,
+                uint32_t fourcc) {
+  return BayerxToARGB(src_bayer, NULL, src_stride_bayer, dst_argb,
+                      dst_stride_argb, width, height, 8, fourcc);
+}
+
+// Convert 10 to 16 bit Bayer to ARGB.
+LIBYUV_API
+int Bayer16ToARGB(const uint16_t* src_bayer,
+                  int src_stride_bayer,
+                  uint8_t* dst_argb,
+                  int dst_stride_argb,
+                  int width,
+                  int height,
+                  int depth,
+                  uint32_t fourcc) {
+  return BayerxToARGB(NULL, src_bayer, src_stride_bayer, dst_argb,
+                      dst_stride_argb, width, height, depth, fourcc);
+}
+
+// Fill a matrix in the layout used by the row functions. The ARM and RISC-V
+// biases fold in subtracting 128 from U and V, like YUVCONSTANTSBODY.
+static void FillYuvConstants(struct YuvConstants* yuvconstants,
+                             int yg,
+                             int yb,
+                             int ub,
+                             int ug,
+                             int vg,
+                             int vr) {
+  int i;
+  memset(yuvconstants, 0, sizeof(*yuvconstants));
+#if defined(__aarch64__) || defined(__arm__) || defined(__riscv)
+  yuvconstants->kUVCoeff[0] = (uint8_t)ub;
+  yuvconstants->kUVCoeff[1] = (uint8_t)vr;
+  yuvconstants->kUVCoeff[2] = (uint8_t)ug;
+  yuvconstants->kUVCoeff[3] = (uint8_t)vg;
+  yuvconstants->kRGBCoeffBias[0] = (int16_t)yg;
+  yuvconstants->kRGBCoeffBias[1] = (int16_t)(ub * 128 - yb);
+  yuvconstants->kRGBCoeffBias[2] = (int16_t)(ug * 128 + vg * 128 + yb);
+  yuvconstants->kRGBCoeffBias[3] = (int16_t)(vr * 128 - yb);
+  yuvconstants->kRGBCoeffBias[4] = (int16_t)yb;
+  (void)i;
+#else
+  for (i = 0; i < 16; ++i) {
+    yuvconstants->kUVToB[i * 2] = (uint8_t)ub;
+    yuvconstants->kUVToG[i * 2] = (uint8_t)ug;
+    yuvconstants->kUVToG[i * 2 + 1] = (uint8_t)vg;
+    yuvconstants->kUVToR[i * 2 + 1] = (uint8_t)vr;
+    yuvconstants->kYToRgb[i] = (int16_t)yg;
+    yuvconstants->kYBiasToRgb[i] = (int16_t)yb;
+  }
+#endif
+}
+
+static int RoundToInt(double v) {
+  return (int)floor(v + 0.5);
+}
+
+// Derives the fixed point terms the same way as the kYuv*Constants tables in
+// row_common.cc: U and V contributions scaled by 64, Y scale by
+// 64 * 256 * 256 / 257 and Y bias including rounding.
+LIBYUV_API
+int InitYuvConstants(struct YuvConstants* yuvconstants,
+                     struct YuvConstants* yvuconstants,
+                     float kr,
+                     float kb,
+                     int depth,
+                     int y_min,
+                     int y_max,
+                     int uv_min,
+                     int uv_max) {
+  double kg = 1.0 - kr - kb;
+  // Luma is widened by replicating bits and chroma by shifting, as the 10 and
+  // 12 bit rows do, so scale the ranges the same way to 8 bits.
+  double ynorm, uvnorm, ys, uvs;
+  int yg, yb, ub, ug, vg, vr;
+  if (kr <= 0.f || kb <= 0.f || kg <= 0.0 || depth < 8 || depth > 16 ||
+      y_min < 0 || y_max <= y_min || y_max >= (1 << depth) || uv_min < 0 ||
+      uv_max <= uv_min || uv_max >= (1 << depth)) {
+    return -1;
+  }
+  ynorm = 255.0 / ((1 << depth) - 1);
+  uvnorm = 1.0 / (1 << (depth - 8));
+  ys = 255.0 / ((y_max - y_min) * ynorm);
+  uvs = 255.0 / ((uv_max - uv_min) * uvnorm);
+  yg = RoundToInt(ys * 64 * 256 * 256 / 257);
+  yb = RoundToInt(ys * 64 * -(y_min * ynorm) + 64 / 2);
+  ub = RoundToInt(2.0 * (1.0 - kb) * uvs * 64);
+  ug = RoundToInt(2.0 * (1.0 - kb) * kb / kg * uvs * 64);
+  vg = RoundToInt(2.0 * (1.0 - kr) * kr / kg * uvs * 64);
+  vr = RoundToInt(2.0 * (1.0 - kr) * uvs * 64);
+#if !defined(LIBYUV_UNLIMITED_DATA)
+  if (ub > 128) {
+    ub = 128;
+  }
+#endif
+  // Terms must fit the 8 bit coefficients and 16 bit biases of either
+  // layout, so a matrix is accepted or rejected on every platform alike.
+  if (yg > 32767 || yb < -32768 || yb > 32767 || ub > 255 || vr > 255 ||
+      ug + vg > 255 || ub * 128 - yb > 32767 || vr * 128 - yb > 32767 ||
+      (ug + vg) * 128 + yb > 32767) {
+    return -1;
+  }
+  if (yuvconstants) {
+    FillYuvConstants(yuvconstants, yg, yb, ub, ug, vg, vr);
+  }
+  if (yvuconstants) {
+    FillYuvConstants(yvuconstants, yg, yb, vr, vg, ug, ub);
+  }
+  return 0;
+}
+
+// Entries are claimed by one writer, filled, then published; readers only
+// look at published entries. Entries are never evicted so pointers returned
+// stay valid.
+#define YUV_CONSTANTS_CACHE_SIZE 16
+
+struct YuvConstantsCacheEntry {
+  struct YuvConstants SIMD_ALIGNED(yuv);
+  struct YuvConstants SIMD_ALIGNED(yvu);
+  float kr;
+  float kb;
+  int depth;
+  int y_min;
+  int y_max;
+  int uv_min;
+  int uv_max;
+};
+
+static struct YuvConstantsCacheEntry
+    yuv_constants_cache[YUV_CONSTANTS_CACHE_SIZE];
+// 0 = empty, 1 = being filled, 2 = ready.
+static std::atomic<int> yuv_constants_cache_state[YUV_CONSTANTS_CACHE_SIZE];
+
+LIBYUV_API
+int GetYuvConstants(const struct YuvConstants** yuvconstants,
+                    const struct YuvConstants** yvuconstants,
+                    float kr,
+                    float kb,
+                    int depth,
+                    int y_min,
+                    int y_max,
+                    int uv_min,
+                    int uv_max) {
+  int i;
+  if (InitYuvConstants(NULL, NULL, kr, kb, depth, y_min, y_max, uv_min,
+                       uv_max)) {
+    return -1;
+  }
+  for (i = 0; i < YUV_CONSTANTS_CACHE_SIZE; ++i) {
+    struct YuvConstantsCacheEntry* entry = &yuv_constants_cache[i];
+    int state = yuv_constants_cache_state[i].load(std::memory_order_acquire);
+    if (state == 0 && yuv_constants_cache_state[i].compare_exchange_strong(
+                          state, 1, std::memory_order_acquire)) {
+      InitYuvConstants(&entry->yuv, &entry->yvu, kr, kb, depth, y_min, y_max,
+                       uv_min, uv_max);
+      entry->kr = kr;
+      entry->kb = kb;
+      entry->depth = depth;
+      entry->y_min = y_min;
+      entry->y_max = y_max;
+      entry->uv_min = uv_min;
+      entry->uv_max = uv_max;
+      yuv_constants_cache_state[i].store(2, std::memory_order_release);
+      state = 2;
+    }
+    if (state == 2 && entry->kr == kr && entry->kb == kb &&
+        entry->depth == depth && entry->y_min == y_min &&
+        entry->y_max == y_max && entry->uv_min == uv_min &&
+        entry->uv_max == uv_max) {
+      if (yuvconstants) {
+        *yuvconstants = &entry->yuv;
+      }
+      if (yvuconstants) {
+        *yvuconstants = &entry->yvu;
+      }
+      return 0;
+    }
+  }
+  return -1;
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
@@ -0,0 +1,530 @@
+/*
+ *  Copyright 2024 The LibYuv Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS. All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "libyuv/convert.h"
+
+#include <atomic>
+
+#include "libyuv/convert_argb.h"
+#include "libyuv/convert_from_argb.h"
+#include "libyuv/planar_functions.h"
+#include "libyuv/row.h"  // For align_buffer_64.
+#include "libyuv/video_common.h"
+
+#ifdef __cplusplus
+namespace libyuv {
+extern "C" {
+#endif
+
+// Frames are converted through ARGB in strips of rows whose ARGB fits in
+// this many bytes, so the intermediate stays in L2 cache.
+#define CONVERT_FRAME_STRIP_BYTES (256 * 1024)
+#define CONVERT_FRAME_CACHE_SIZE 16
+
+enum FrameKind {
+  kFramePacked,    // 1 plane.
+  kFramePlanar,    // Y, U and V planes.
+  kFrameBiplanar,  // Y and interleaved UV planes.
+};
+
+typedef int (*PackedToARGBFunc)(const uint8_t* src,
+                                int src_stride,
+                                uint8_t* dst_argb,
+                                int dst_stride_argb,
+                                int width,
+                                int height);
+typedef int (*PlanarToARGBFunc)(const uint8_t* src_y,
+                                int src_stride_y,
+                                const uint8_t* src_u,
+                                int src_stride_u,
+                                const uint8_t* src_v,
+                                int src_stride_v,
+                                uint8_t* dst_argb,
+                                int dst_stride_argb,
+                                const struct YuvConstants* yuvconstants,
+                                int width,
+                                int height);
+typedef int (*Planar16ToARGBFunc)(const uint16_t* src_y,
+                                  int src_stride_y,
+                                  const uint16_t* src_u,
+                                  int src_stride_u,
+                                  const uint16_t* src_v,
+                                  int src_stride_v,
+                                  uint8_t* dst_argb,
+                                  int dst_stride_argb,
+                                  const struct YuvConstants* yuvconstants,
+                                  int width,
+                                  int height);
+typedef int (*BiplanarToARGBFunc)(const uint8_t* src_y,
+                                  int src_stride_y,
+                                  const uint8_t* src_uv,
+                                  int src_stride_uv,
+                                  uint8_t* dst_argb,
+                                  int dst_stride_argb,
+                                  const struct YuvConstants* yuvconstants,
+                                  int width,
+                                  int height);
+typedef int (*Biplanar16ToARGBFunc)(const uint16_t* src_y,
+                                    int src_stride_y,
+                                    const uint16_t* src_uv,
+                                    int src_stride_uv,
+                                    uint8_t* dst_argb,
+                                    int dst_stride_argb,
+                                    const struct YuvConstants* yuvconstants,
+                                    int width,
+                                    int height);
+typedef int (*ARGBToPackedFunc)(const uint8_t* src_argb,
+                                int src_stride_argb,
+                                uint8_t* dst,
+                                int dst_stride,
+                                int width,
+                                int height);
+typedef int (*ARGBToPlanarFunc)(const uint8_t* src_argb,
+                                int src_stride_argb,
+                                uint8_t* dst_y,
+                                int dst_stride_y,
+                                uint8_t* dst_u,
+                                int dst_stride_u,
+                                uint8_t* dst_v,
+                                int dst_stride_v,
+                                int width,
+                                int height);
+typedef int (*ARGBToBiplanarFunc)(const uint8_t* src_argb,
+                                  int src_stride_argb,
+                                  uint8_t* dst_y,
+                                  int dst_stride_y,
+                                  uint8_t* dst_uv,
+                                  int dst_stride_uv,
+                                  int width,
+                                  int height);
+
+// A frame format and the conversions between it and ARGB. A format is a
+// source if it has a conversion to ARGB and a destination if it has one from
+// ARGB. 16 bit biplanar destinations are packed as 8 bit then widened.
+struct FrameFormat {
+  uint32_t fourcc;
+  enum FrameKind kind;
+  int bytes;  // Per pixel for packed formats, else per sample.
+  int shift_x;  // Chroma subsampling, or pixels per group for packed.
+  int shift_y;
+  int swap_uv;  // V plane before U, as in YV12.
+  const struct YuvConstants* yuvconstants;
+  PackedToARGBFunc packed_to_argb;
+  PlanarToARGBFunc planar_to_argb;
+  Planar16ToARGBFunc planar16_to_argb;
+  BiplanarToARGBFunc biplanar_to_argb;
+  Biplanar16ToARGBFunc biplanar16_to_argb;
+  ARGBToPackedFunc argb_to_packed;
+  ARGBToPlanarFunc argb_to_planar;
+  ARGBToBiplanarFunc argb_to_biplanar;
+};
+
+#define PACKED(FOURCC, BPP, SX, TO_ARGB, FROM_ARGB)                            \
+  {FOURCC, kFramePacked, BPP, SX, 0, 0, NULL, TO_ARGB, NULL, NULL, NULL, NULL, \
+   FROM_ARGB, NULL, NULL}
+#define PLANAR(FOURCC, SX, SY, SWAP, YUVCONSTANTS, TO_ARGB, FROM_ARGB)         \
+  {FOURCC, kFramePlanar, 1, SX, SY, SWAP, YUVCONSTANTS, NULL, TO_ARGB, NULL,   \
+   NULL, NULL, NULL, FROM_ARGB, NULL}
+#define PLANAR16(FOURCC, SX, SY, YUVCONSTANTS, TO_ARGB)                        \
+  {FOURCC, kFramePlanar, 2, SX, SY, 0, YUVCONSTANTS, NULL, NULL, TO_ARGB,      \
+   NULL, NULL, NULL, NULL, NULL}
+#define BIPLANAR(FOURCC, BYTES, SY, TO_ARGB, TO_ARGB16, FROM_ARGB)             \
+  {FOURCC, kFrameBiplanar, BYTES, 1, SY, 0, &kYuvI601Constants, NULL, NULL,    \
+   NULL, TO_ARGB, TO_ARGB16, NULL, NULL, FROM_ARGB}
+
+static const struct FrameFormat kFrameFormats[] = {
+    PACKED(FOURCC_ARGB, 4, 0, ARGBCopy, ARGBCopy),
+    PACKED(FOURCC_BGRA, 4, 0, BGRAToARGB, ARGBToBGRA),
+    PACKED(FOURCC_ABGR, 4, 0, ABGRToARGB, ARGBToABGR),
+    PACKED(FOURCC_RGBA, 4, 0, RGBAToARGB, ARGBToRGBA),
+    PACKED(FOURCC_AR30, 4, 0, AR30ToARGB, ARGBToAR30),
+    PACKED(FOURCC_AB30, 4, 0, AB30ToARGB, ARGBToAB30),
+    PACKED(FOURCC_24BG, 3, 0, RGB24ToARGB, ARGBToRGB24),
+    PACKED(FOURCC_RAW, 3, 0, RAWToARGB, ARGBToRAW),
+    PACKED(FOURCC_RGBP, 2, 0, RGB565ToARGB, ARGBToRGB565),
+    PACKED(FOURCC_RGBO, 2, 0, ARGB1555ToARGB, ARGBToARGB1555),
+    PACKED(FOURCC_R444, 2, 0, ARGB4444ToARGB, ARGBToARGB4444),
+    PACKED(FOURCC_YUY2, 2, 1, YUY2ToARGB, ARGBToYUY2),
+    PACKED(FOURCC_UYVY, 2, 1, UYVYToARGB, ARGBToUYVY),
+    PACKED(FOURCC_I400, 1, 0, I400ToARGB, ARGBToI400),
+    PACKED(FOURCC_J400, 1, 0, J400ToARGB, ARGBToJ400),
+    PLANAR(FOURCC_I420, 1, 1, 0, &kYuvI601Constants, I420ToARGBMatrix,
+           ARGBToI420),
+    PLANAR(FOURCC_I422, 1, 0, 0, &kYuvI601Constants, I422ToARGBMatrix,
+           ARGBToI422),
+    PLANAR(FOURCC_I444, 0, 0, 0, &kYuvI601Constants, I444ToARGBMatrix,
+           ARGBToI444),
+    PLANAR(FOURCC_YV12, 1, 1, 1, &kYuvI601Constants, I420ToARGBMatrix,
+           ARGBToI420),
+    PLANAR(FOURCC_YV16, 1, 0, 1, &kYuvI601Constants, I422ToARGBMatrix,
+           ARGBToI422),
+    PLANAR(FOURCC_YV24, 0, 0, 1, &kYuvI601Constants, I444ToARGBMatrix,
+           ARGBToI444),
+    PLANAR(FOURCC_J420, 1, 1, 0, &kYuvJPEGConstants, I420ToARGBMatrix,
+           ARGBToJ420),
+    PLANAR(FOURCC_J422, 1, 0, 0, &kYuvJPEGConstants, I422ToARGBMatrix,
+           ARGBToJ422),
+    PLANAR(FOURCC_J444, 0, 0, 0, &kYuvJPEGConstants, I444ToARGBMatrix, NULL),
+    PLANAR(FOURCC_H420, 1, 1, 0, &kYuvH709Constants, I420ToARGBMatrix, NULL),
+    PLANAR(FOURCC_H422, 1, 0, 0, &kYuvH709Constants, I422ToARGBMatrix, NULL),
+    PLANAR(FOURCC_H444, 0, 0, 0, &kYuvH709Constants, I444ToARGBMatrix, NULL),
+    PLANAR(FOURCC_U420, 1, 1, 0, &kYuv2020Constants, I420ToARGBMatrix, NULL),
+    PLANAR(FOURCC_U422, 1, 0, 0, &kYuv2020Constants, I422ToARGBMatrix, NULL),
+    PLANAR(FOURCC_U444, 0, 0, 0, &kYuv2020Constants, I444ToARGBMatrix, NULL),
+    PLANAR16(FOURCC_I010, 1, 1, &kYuvI601Constants, I010ToARGBMatrix),
+    PLANAR16(FOURCC_H010, 1, 1, &kYuvH709Constants, I010ToARGBMatrix),
+    PLANAR16(FOURCC_U010, 1, 1, &kYuv2020Constants, I010ToARGBMatrix),
+    PLANAR16(FOURCC_I210, 1, 0, &kYuvI601Constants, I210ToARGBMatrix),
+    PLANAR16(FOURCC_H210, 1, 0, &kYuvH709Constants, I210ToARGBMatrix),
+    PLANAR16(FOURCC_U210, 1, 0, &kYuv2020Constants, I210ToARGBMatrix),
+    BIPLANAR(FOURCC_NV12, 1, 1, NV12ToARGBMatrix, NULL, ARGBToNV12),
+    BIPLANAR(FOURCC_NV21, 1, 1, NV21ToARGBMatrix, NULL, ARGBToNV21),
+    BIPLANAR(FOURCC_P010, 2, 1, NULL, P010ToARGBMatrix, ARGBToNV12),
+    BIPLANAR(FOURCC_P210, 2, 0, NULL, P210ToARGBMatrix, NULL),
+};
+
+#undef PACKED
+#undef PLANAR
+#undef PLANAR16
+#undef BIPLANAR
+
+static const struct FrameFormat* FindFrameFormat(uint32_t fourcc) {
+  size_t i;
+  fourcc = CanonicalFourCC(fourcc);
+  for (i = 0; i < sizeof(kFrameFormats) / sizeof(kFrameFormats[0]); ++i) {
+    if (kFrameFormats[i].fourcc == fourcc) {
+      return &kFrameFormats[i];
+    }
+  }
+  return NULL;
+}
+
+// Where the planes of a contiguous frame are. Strides are in samples.
+struct FrameLayout {
+  int num_planes;
+  size_t offset[3];
+  int stride[3];
+  int rows[3];
+  int shift_y[3];
+  size_t size;
+};
+
+static void GetFrameLayout(const struct FrameFormat* format,
+                           int width,
+                           int height,
+                           struct FrameLayout* layout) {
+  const int chroma_width = (width + format->shift_x) >> format->shift_x;
+  const int chroma_height = (height + format->shift_y) >> format->shift_y;
+  int i;
+  layout->num_planes = format->kind == kFramePacked
+                           ? 1
+                           : (format->kind == kFramePlanar ? 3 : 2);
+  // Packed 4:2:2 formats store whole pairs of pixels.
+  layout->stride[0] = format->kind == kFramePacked
+                          ? (chroma_width << format->shift_x) * format->bytes
+                          : width;
+  layout->rows[0] = height;
+  layout->shift_y[0] = 0;
+  for (i = 1; i < layout->num_planes; ++i) {
+    layout->stride[i] =
+        format->kind == kFrameBiplanar ? chroma_width * 2 : chroma_width;
+    layout->rows[i] = chroma_height;
+    layout->shift_y[i] = format->shift_y;
+  }
+  layout->size = 0;
+  for (i = 0; i < layout->num_planes; ++i) {
+    const int sample_bytes = format->kind == kFramePacked ? 1 : format->bytes;
+    layout->offset[i] = layout->size;
+    layout->size += (size_t)layout->stride[i] * layout->rows[i] * sample_bytes;
+  }
+  if (format->swap_uv) {
+    size_t offset = layout->offset[1];
+    layout->offset[1] = layout->offset[2];
+    layout->offset[2] = offset;
+  }
+}
+
+// A conversion compiled for a source and destination format and frame size.
+struct ConvertFramePlan {
+  const struct FrameFormat* src;
+  const struct FrameFormat* dst;
+  int width;
+  int height;
+  struct FrameLayout src_layout;
+  struct FrameLayout dst_layout;
+  int strip_rows;  // Even, so strips start on a chroma row.
+};
+
+static int InitConvertFramePlan(struct ConvertFramePlan* plan,
+                                uint32_t src_fourcc,
+                                uint32_t dst_fourcc,
+                                int width,
+                                int height) {
+  const struct FrameFormat* src = FindFrameFormat(src_fourcc);
+  const struct FrameFormat* dst = FindFrameFormat(dst_fourcc);
+  if (!src || !dst || width <= 0 || height <= 0) {
+    return -1;
+  }
+  if (src != dst && (!(src->packed_to_argb || src->planar_to_argb ||
+                       src->planar16_to_argb || src->biplanar_to_argb ||
+                       src->biplanar16_to_argb) ||
+                     !(dst->argb_to_packed || dst->argb_to_planar ||
+                       dst->argb_to_biplanar))) {
+    return -1;
+  }
+  plan->src = src;
+  plan->dst = dst;
+  plan->width = width;
+  plan->height = height;
+  GetFrameLayout(src, width, height, &plan->src_layout);
+  GetFrameLayout(dst, width, height, &plan->dst_layout);
+  plan->strip_rows = (CONVERT_FRAME_STRIP_BYTES / (width * 4)) & ~1;
+  if (plan->strip_rows < 2) {
+    plan->strip_rows = 2;
+  }
+  return 0;
+}
+
+static struct ConvertFramePlan convert_frame_cache[CONVERT_FRAME_CACHE_SIZE];
+// 0 = empty, 1 = being filled, 2 = ready.
+static std::atomic<int> convert_frame_cache_state[CONVERT_FRAME_CACHE_SIZE];
+
+// Returns a cached plan, or builds one in plan if the cache is full.
+static const struct ConvertFramePlan* GetConvertFramePlan(
+    uint32_t src_fourcc,
+    uint32_t dst_fourcc,
+    int width,
+    int height,
+    struct ConvertFramePlan* plan) {
+  const struct FrameFormat* src = FindFrameFormat(src_fourcc);
+  const struct FrameFormat* dst = FindFrameFormat(dst_fourcc);
+  int i;
+  for (i = 0; i < CONVERT_FRAME_CACHE_SIZE; ++i) {
+    struct ConvertFramePlan* entry = &convert_frame_cache[i];
+    int state = convert_frame_cache_state[i].load(std::memory_order_acquire);
+    if (state == 0 && convert_frame_cache_state[i].compare_exchange_strong(
+                          state, 1, std::memory_order_acquire)) {
+      if (InitConvertFramePlan(entry, src_fourcc, dst_fourcc, width,
+                               height)) {
+        convert_frame_cache_state[i].store(0, std::memory_order_release);
+        return NULL;
+      }
+      convert_frame_cache_state[i].store(2, std::memory_order_release);
+      state = 2;
+    }
+    if (state == 2 && entry->src == src && entry->dst == dst &&
+        entry->width == width && entry->height == height) {
+      return entry;
+    }
+  }
+  if (InitConvertFramePlan(plan, src_fourcc, dst_fourcc, width, height)) {
+    return NULL;
+  }
+  return plan;
+}
+
+// Convert rows of src to ARGB.
+static void FrameToARGBStrip(const struct FrameFormat* format,
+                             const uint8_t* const* src,
+                             const int* src_stride,
+                             uint8_t* dst_argb,
+                             int dst_stride_argb,
+                             int width,
+                             int height) {
+  const uint16_t* const* src16 = (const uint16_t* const*)src;
+  if (format->packed_to_argb) {
+    format->packed_to_argb(src[0], src_stride[0], dst_argb, dst_stride_argb,
+                           width, height);
+  } else if (format->planar_to_argb) {
+    format->planar_to_argb(src[0], src_stride[0], src[1], src_stride[1],
+                           src[2], src_stride[2], dst_argb, dst_stride_argb,
+                           format->yuvconstants, width, height);
+  } else if (format->planar16_to_argb) {
+    format->planar16_to_argb(src16[0], src_stride[0], src16[1], src_stride[1],
+                             src16[2], src_stride[2], dst_argb,
+                             dst_stride_argb, format->yuvconstants, width,
+                             height);
+  } else if (format->biplanar_to_argb) {
+    format->biplanar_to_argb(src[0], src_stride[0], src[1], src_stride[1],
+                             dst_argb, dst_stride_argb, format->yuvconstants,
+                             width, height);
+  } else {
+    format->biplanar16_to_argb(src16[0], src_stride[0], src16[1],
+                               src_stride[1], dst_argb, dst_stride_argb,
+                               format->yuvconstants, width, height);
+  }
+}
+
+// Convert rows of ARGB to dst. 16 bit formats are packed to 8 bits in temp
+// and then widened to 10 bits in the msbs.
+static void ARGBToFrameStrip(const struct FrameFormat* format,
+                             const uint8_t* src_argb,
+                             int src_stride_argb,
+                             uint8_t* const* dst,
+                             const int* dst_stride,
+                             uint8_t* temp,
+                             int width,
+                             int height) {
+  if (format->argb_to_packed) {
+    format->argb_to_packed(src_argb, src_stride_argb, dst[0], dst_stride[0],
+                           width, height);
+  } else if (format->argb_to_planar) {
+    format->argb_to_planar(src_argb, src_stride_argb, dst[0], dst_stride[0],
+                           dst[1], dst_stride[1], dst[2], dst_stride[2], width,
+                           height);
+  } else if (format->bytes == 1) {
+    format->argb_to_biplanar(src_argb, src_stride_argb, dst[0], dst_stride[0],
+                             dst[1], dst_stride[1], width, height);
+  } else {
+    const int uv_width = ((width + 1) >> 1) * 2;
+    const int uv_height = (height + format->shift_y) >> format->shift_y;
+    uint8_t* temp_uv = temp + width * height;
+    int i;
+    format->argb_to_biplanar(src_argb, src_stride_argb, temp, width, temp_uv,
+                             uv_width, width, height);
+    Convert8To16Plane(temp, width, (uint16_t*)dst[0], dst_stride[0], 1024,
+                      width, height);
+    Convert8To16Plane(temp_uv, uv_width, (uint16_t*)dst[1], dst_stride[1],
+                      1024, uv_width, uv_height);
+    for (i = 0; i < 2; ++i) {
+      ConvertToMSBPlane_16((const uint16_t*)dst[i], dst_stride[i],
+                           (uint16_t*)dst[i], dst_stride[i],
+                           i ? uv_width : width, i ? uv_height : height, 10);
+    }
+  }
+}
+
+LIBYUV_API
+int ConvertFrameSize(uint32_t fourcc, int width, int height) {
+  const struct FrameFormat* format = FindFrameFormat(fourcc);
+  struct FrameLayout layout;
+  if (!format || width <= 0 || height == 0) {
+    return -1;
+  }
+  GetFrameLayout(format, width, height < 0 ? -height : height, &layout);
+  return (int)layout.size;
+}
+
+LIBYUV_API
+int ConvertFrame(const uint8_t* src_frame,
+                 size_t src_size,
+                 uint32_t src_fourcc,
+                 uint8_t* dst_frame,
+                 size_t dst_size,
+                 uint32_t dst_fourcc,
+                 int width,
+                 int height) {
+  const int abs_height = height < 0 ? -height : height;
+  struct ConvertFramePlan local_plan;
+  const struct ConvertFramePlan* plan;
+  const uint8_t* src[3];
+  int src_stride[3];
+  int src_bytes;
+  int dst_bytes;
+  int num_planes;
+  int strip_rows;
+  int y;
+  int i;
+  if (!src_frame || !dst_frame || width <= 0 || height == 0) {
+    return -1;
+  }
+  plan = GetConvertFramePlan(src_fourcc, dst_fourcc, width, abs_height,
+                             &local_plan);
+  if (!plan || src_size < plan->src_layout.size ||
+      dst_size < plan->dst_layout.size) {
+    return -1;
+  }
+  src_bytes = plan->src->kind == kFramePacked ? 1 : plan->src->bytes;
+  dst_bytes = plan->dst->kind == kFramePacked ? 1 : plan->dst->bytes;
+  num_planes = plan->src_layout.num_planes;
+  for (i = 0; i < num_planes; ++i) {
+    src[i] = src_frame + plan->src_layout.offset[i];
+    src_stride[i] = plan->src_layout.stride[i];
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    for (i = 0; i < num_planes; ++i) {
+      src[i] += (ptrdiff_t)(plan->src_layout.rows[i] - 1) * src_stride[i] *
+                src_bytes;
+      src_stride[i] = -src_stride[i];
+    }
+  }
+  if (plan->src == plan->dst) {
+    for (i = 0; i < num_planes; ++i) {
+      CopyPlane(src[i], src_stride[i] * src_bytes,
+                dst_frame + plan->dst_layout.offset[i],
+                plan->dst_layout.stride[i] * dst_bytes,
+                plan->dst_layout.stride[i] * dst_bytes,
+                plan->dst_layout.rows[i]);
+    }
+    return 0;
+  }
+
+  {
+    const int argb_stride = width * 4;
+    const int src_argb = plan->src->fourcc == FOURCC_ARGB;
+    const int dst_argb = plan->dst->fourcc == FOURCC_ARGB;
+    const int argb_size =
+        src_argb || dst_argb ? 0 : plan->strip_rows * argb_stride;
+    // 8 bit Y and UV rows of a strip for 16 bit destinations.
+    const int temp_size = plan->dst->kind == kFrameBiplanar &&
+                                  plan->dst->bytes == 2
+                              ? plan->strip_rows * width * 2
+                              : 0;
+    strip_rows = plan->strip_rows;
+    align_buffer_64(row, argb_size + temp_size);
+    if (!row) {
+      return 1;
+    }
+    for (y = 0; y < abs_height; y += strip_rows) {
+      const int rows =
+          abs_height - y < strip_rows ? abs_height - y : strip_rows;
+      const uint8_t* strip_src[3];
+      uint8_t* strip_dst[3];
+      int strip_dst_stride[3];
+      uint8_t* argb;
+      for (i = 0; i < num_planes; ++i) {
+        strip_src[i] = src[i] + (ptrdiff_t)(y >> plan->src_layout.shift_y[i]) *
+                                    src_stride[i] * src_bytes;
+      }
+      for (i = 0; i < plan->dst_layout.num_planes; ++i) {
+        strip_dst[i] =
+            dst_frame + plan->dst_layout.offset[i] +
+            (size_t)(y >> plan->dst_layout.shift_y[i]) *
+                plan->dst_layout.stride[i] * dst_bytes;
+        strip_dst_stride[i] = plan->dst_layout.stride[i];
+      }
+      if (src_argb) {
+        argb = (uint8_t*)strip_src[0];
+      } else if (dst_argb) {
+        argb = strip_dst[0];
+      } else {
+        argb = row;
+      }
+      if (!src_argb) {
+        FrameToARGBStrip(plan->src, strip_src, src_stride, argb, argb_stride,
+                         width, rows);
+      }
+      if (!dst_argb) {
+        ARGBToFrameStrip(plan->dst, argb,
+                         src_argb ? src_stride[0] : argb_stride, strip_dst,
+                         strip_dst_stride, row + argb_size,
+                         width, rows);
+      }
+    }
+    free_aligned_buffer_64(row);
+  }
+  return 0;
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+}  // namespace libyuv
+#endif
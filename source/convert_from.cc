@@ -656,6 +656,147 @@ int I420ToUYVY(const uint8_t* src_y,
   return 0;
 }
 
+LIBYUV_API
+int I210ToV210(const uint16_t* src_y,
+               int src_stride_y,
+               const uint16_t* src_u,
+               int src_stride_u,
+               const uint16_t* src_v,
+               int src_stride_v,
+               uint8_t* dst_v210,
+               int dst_stride_v210,
+               int width,
+               int height) {
+  int y;
+  if (!src_y || !src_u || !src_v || !dst_v210 || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    dst_v210 = dst_v210 + (height - 1) * dst_stride_v210;
+    dst_stride_v210 = -dst_stride_v210;
+  }
+
+  for (y = 0; y < height; ++y) {
+    I210ToV210Row_C(src_y, src_u, src_v, dst_v210, width);
+    src_y += src_stride_y;
+    src_u += src_stride_u;
+    src_v += src_stride_v;
+    dst_v210 += dst_stride_v210;
+  }
+  return 0;
+}
+
+LIBYUV_API
+int I210ToY210(const uint16_t* src_y,
+               int src_stride_y,
+               const uint16_t* src_u,
+               int src_stride_u,
+               const uint16_t* src_v,
+               int src_stride_v,
+               uint16_t* dst_y210,
+               int dst_stride_y210,
+               int width,
+               int height) {
+  int y;
+  void (*I210ToY210Row)(const uint16_t* src_y, const uint16_t* src_u,
+                        const uint16_t* src_v, uint16_t* dst_y210, int width) =
+      I210ToY210Row_C;
+  if (!src_y || !src_u || !src_v || !dst_y210 || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    dst_y210 = dst_y210 + (height - 1) * dst_stride_y210;
+    dst_stride_y210 = -dst_stride_y210;
+  }
+#if defined(HAS_I210TOY210ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    I210ToY210Row = I210ToY210Row_Any_AVX2;
+    if (IS_ALIGNED(width, 16)) {
+      I210ToY210Row = I210ToY210Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_I210TOY210ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    I210ToY210Row = I210ToY210Row_Any_NEON;
+    if (IS_ALIGNED(width, 16)) {
+      I210ToY210Row = I210ToY210Row_NEON;
+    }
+  }
+#endif
+
+  for (y = 0; y < height; ++y) {
+    I210ToY210Row(src_y, src_u, src_v, dst_y210, width);
+    src_y += src_stride_y;
+    src_u += src_stride_u;
+    src_v += src_stride_v;
+    dst_y210 += dst_stride_y210;
+  }
+  return 0;
+}
+
+LIBYUV_API
+int I410ToY410(const uint16_t* src_y,
+               int src_stride_y,
+               const uint16_t* src_u,
+               int src_stride_u,
+               const uint16_t* src_v,
+               int src_stride_v,
+               uint8_t* dst_y410,
+               int dst_stride_y410,
+               int width,
+               int height) {
+  int y;
+  void (*I410ToY410Row)(const uint16_t* src_y, const uint16_t* src_u,
+                        const uint16_t* src_v, uint8_t* dst_y410, int width) =
+      I410ToY410Row_C;
+  if (!src_y || !src_u || !src_v || !dst_y410 || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    dst_y410 = dst_y410 + (height - 1) * dst_stride_y410;
+    dst_stride_y410 = -dst_stride_y410;
+  }
+  // Coalesce rows.
+  if (src_stride_y == width && src_stride_u == width && src_stride_v == width &&
+      dst_stride_y410 == width * 4) {
+    width *= height;
+    height = 1;
+    src_stride_y = src_stride_u = src_stride_v = dst_stride_y410 = 0;
+  }
+#if defined(HAS_I410TOY410ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    I410ToY410Row = I410ToY410Row_Any_AVX2;
+    if (IS_ALIGNED(width, 8)) {
+      I410ToY410Row = I410ToY410Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_I410TOY410ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    I410ToY410Row = I410ToY410Row_Any_NEON;
+    if (IS_ALIGNED(width, 8)) {
+      I410ToY410Row = I410ToY410Row_NEON;
+    }
+  }
+#endif
+
+  for (y = 0; y < height; ++y) {
+    I410ToY410Row(src_y, src_u, src_v, dst_y410, width);
+    src_y += src_stride_y;
+    src_u += src_stride_u;
+    src_v += src_stride_v;
+    dst_y410 += dst_stride_y410;
+  }
+  return 0;
+}
+
 LIBYUV_API
 int I420ToNV12(const uint8_t* src_y,
                int src_stride_y,
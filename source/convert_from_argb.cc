@@ -3320,6 +3320,110 @@ int RAWToJNV21(const uint8_t* src_raw,
 }
 #undef HAS_RAWTOYJROW
 
+// Convert each horizontal run of dirty tiles with ARGBToI420 or ARGBToNV12.
+// Tiles start on even rows and columns so chroma of a run is the same as
+// for a whole frame conversion.
+static int ARGBToYUVTiles(const uint8_t* src_argb,
+                          int src_stride_argb,
+                          uint8_t* dst_y,
+                          int dst_stride_y,
+                          uint8_t* dst_u,
+                          int dst_stride_u,
+                          uint8_t* dst_v,
+                          int dst_stride_v,
+                          int width,
+                          int height,
+                          const uint8_t* dirty_tiles,
+                          int dirty_tiles_stride,
+                          int tile_size) {
+  int tx, ty;
+  int tiles_x, tiles_y;
+  if (!src_argb || !dst_y || !dst_u || !dirty_tiles || width <= 0 ||
+      height == 0 || (tile_size != 16 && tile_size != 32 && tile_size != 64)) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src_argb = src_argb + (height - 1) * src_stride_argb;
+    src_stride_argb = -src_stride_argb;
+  }
+  tiles_x = (width + tile_size - 1) / tile_size;
+  tiles_y = (height + tile_size - 1) / tile_size;
+  for (ty = 0; ty < tiles_y; ++ty) {
+    int y0 = ty * tile_size;
+    int tile_height = height - y0 < tile_size ? height - y0 : tile_size;
+    tx = 0;
+    while (tx < tiles_x) {
+      int run_start;
+      int x0, run_width;
+      if (!(dirty_tiles[tx >> 3] & (1 << (tx & 7)))) {
+        ++tx;
+        continue;
+      }
+      run_start = tx;
+      while (tx < tiles_x && (dirty_tiles[tx >> 3] & (1 << (tx & 7)))) {
+        ++tx;
+      }
+      x0 = run_start * tile_size;
+      run_width = (tx * tile_size < width ? tx * tile_size : width) - x0;
+      if (dst_v) {
+        ARGBToI420(src_argb + y0 * src_stride_argb + x0 * 4, src_stride_argb,
+                   dst_y + y0 * dst_stride_y + x0, dst_stride_y,
+                   dst_u + (y0 >> 1) * dst_stride_u + (x0 >> 1), dst_stride_u,
+                   dst_v + (y0 >> 1) * dst_stride_v + (x0 >> 1), dst_stride_v,
+                   run_width, tile_height);
+      } else {
+        ARGBToNV12(src_argb + y0 * src_stride_argb + x0 * 4, src_stride_argb,
+                   dst_y + y0 * dst_stride_y + x0, dst_stride_y,
+                   dst_u + (y0 >> 1) * dst_stride_u + x0, dst_stride_u,
+                   run_width, tile_height);
+      }
+    }
+    dirty_tiles += dirty_tiles_stride;
+  }
+  return 0;
+}
+
+LIBYUV_API
+int ARGBToI420Tiles(const uint8_t* src_argb,
+                    int src_stride_argb,
+                    uint8_t* dst_y,
+                    int dst_stride_y,
+                    uint8_t* dst_u,
+                    int dst_stride_u,
+                    uint8_t* dst_v,
+                    int dst_stride_v,
+                    int width,
+                    int height,
+                    const uint8_t* dirty_tiles,
+                    int dirty_tiles_stride,
+                    int tile_size) {
+  if (!dst_v) {
+    return -1;
+  }
+  return ARGBToYUVTiles(src_argb, src_stride_argb, dst_y, dst_stride_y, dst_u,
+                        dst_stride_u, dst_v, dst_stride_v, width, height,
+                        dirty_tiles, dirty_tiles_stride, tile_size);
+}
+
+LIBYUV_API
+int ARGBToNV12Tiles(const uint8_t* src_argb,
+                    int src_stride_argb,
+                    uint8_t* dst_y,
+                    int dst_stride_y,
+                    uint8_t* dst_uv,
+                    int dst_stride_uv,
+                    int width,
+                    int height,
+                    const uint8_t* dirty_tiles,
+                    int dirty_tiles_stride,
+                    int tile_size) {
+  return ARGBToYUVTiles(src_argb, src_stride_argb, dst_y, dst_stride_y, dst_uv,
+                        dst_stride_uv, NULL, 0, width, height, dirty_tiles,
+                        dirty_tiles_stride, tile_size);
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
@@ -163,6 +163,103 @@ int ConvertToI420(const uint8_t* sample,
                      dst_stride_u, dst_v, dst_stride_v, crop_width,
                      inv_crop_height);
       break;
+    // 10 bit packed formats are unpacked to a temporary I210 or I410.
+    case FOURCC_V210: {
+      // Each group of 16 bytes holds 6 pixels; rows are 128 byte aligned.
+      const int x_off = crop_x % 6;
+      const int unpack_width = x_off + crop_width;
+      const int half_width = (unpack_width + 1) / 2;
+      uint16_t* tmp_i210;
+      if (crop_x & 1) {
+        r = -1;
+        break;
+      }
+      tmp_i210 = (uint16_t*)malloc(  // NOLINT
+          (unpack_width + half_width * 2) * abs_crop_height * 2);
+      if (!tmp_i210) {
+        r = 1;  // Out of memory runtime error.
+        break;
+      }
+      src = sample + (src_width + 47) / 48 * 128 * crop_y + crop_x / 6 * 16;
+      r = V210ToI210(src, (src_width + 47) / 48 * 128, tmp_i210, unpack_width,
+                     tmp_i210 + unpack_width * abs_crop_height, half_width,
+                     tmp_i210 + (unpack_width + half_width) * abs_crop_height,
+                     half_width, unpack_width, abs_crop_height);
+      if (r == 0) {
+        r = I210ToI420(
+            tmp_i210 + x_off, unpack_width,
+            tmp_i210 + unpack_width * abs_crop_height + x_off / 2, half_width,
+            tmp_i210 + (unpack_width + half_width) * abs_crop_height +
+                x_off / 2,
+            half_width, dst_y, dst_stride_y, dst_u, dst_stride_u, dst_v,
+            dst_stride_v, crop_width, inv_crop_height);
+      }
+      free(tmp_i210);
+      break;
+    }
+    case FOURCC_Y210: {
+      const int half_width = (crop_width + 1) / 2;
+      uint16_t* tmp_i210;
+      if (crop_x & 1) {
+        r = -1;
+        break;
+      }
+      tmp_i210 = (uint16_t*)malloc(  // NOLINT
+          (crop_width + half_width * 2) * abs_crop_height * 2);
+      if (!tmp_i210) {
+        r = 1;  // Out of memory runtime error.
+        break;
+      }
+      src = sample + (aligned_src_width * crop_y + crop_x) * 4;
+      r = Y210ToI210((const uint16_t*)src, aligned_src_width * 2, tmp_i210,
+                     crop_width, tmp_i210 + crop_width * abs_crop_height,
+                     half_width,
+                     tmp_i210 + (crop_width + half_width) * abs_crop_height,
+                     half_width, crop_width, abs_crop_height);
+      if (r == 0) {
+        r = I210ToI420(
+            tmp_i210, crop_width, tmp_i210 + crop_width * abs_crop_height,
+            half_width, tmp_i210 + (crop_width + half_width) * abs_crop_height,
+            half_width, dst_y, dst_stride_y, dst_u, dst_stride_u, dst_v,
+            dst_stride_v, crop_width, inv_crop_height);
+      }
+      free(tmp_i210);
+      break;
+    }
+    case FOURCC_Y410: {
+      const int plane_size = crop_width * abs_crop_height;
+      uint16_t* tmp_i410 = (uint16_t*)malloc(plane_size * 3 * 2);  // NOLINT
+      if (!tmp_i410) {
+        r = 1;  // Out of memory runtime error.
+        break;
+      }
+      src = sample + (src_width * crop_y + crop_x) * 4;
+      r = Y410ToI410(src, src_width * 4, tmp_i410, crop_width,
+                     tmp_i410 + plane_size, crop_width,
+                     tmp_i410 + plane_size * 2, crop_width, crop_width,
+                     abs_crop_height);
+      if (r == 0) {
+        r = I410ToI420(tmp_i410, crop_width, tmp_i410 + plane_size, crop_width,
+                       tmp_i410 + plane_size * 2, crop_width, dst_y,
+                       dst_stride_y, dst_u, dst_stride_u, dst_v, dst_stride_v,
+                       crop_width, inv_crop_height);
+      }
+      free(tmp_i410);
+      break;
+    }
+    // Bayer formats.  Crop must be even to keep the pattern.
+    case FOURCC_RGGB:
+    case FOURCC_BGGR:
+    case FOURCC_GRBG:
+    case FOURCC_GBRG:
+      if ((crop_x | crop_y) & 1) {
+        r = -1;
+        break;
+      }
+      src = sample + (src_width * crop_y + crop_x);
+      r = BayerToI420(src, src_width, dst_y, dst_stride_y, dst_u, dst_stride_u,
+                      dst_v, dst_stride_v, crop_width, inv_crop_height, format);
+      break;
     // TODO(fbarchard): Add AR30 and AB30
     case FOURCC_I400:
       src = sample + src_width * crop_y + crop_x;
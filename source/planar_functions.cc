@@ -4241,6 +4241,193 @@ int ARGBBlur(const uint8_t* src_argb,
   return 0;
 }
 
+// Box blur a plane of bpp byte pixels in a single streaming pass.
+// Keeps one row of vertical running sums, updated by adding the row that
+// enters the window and subtracting the row that leaves it, then slides the
+// window horizontally along that row.  The box is clipped at the edges and
+// averaged over the pixels inside the image.
+static int BoxBlurPlaneBpp(const uint8_t* src,
+                           int src_stride,
+                           uint8_t* dst,
+                           int dst_stride,
+                           int width,
+                           int height,
+                           int radius,
+                           int bpp) {
+  int x;
+  int y;
+  int i;
+  int radius_x;
+  int radius_y;
+  const int n = width * bpp;
+  int32_t* col_sum;
+  int32_t* row_sum;
+  float* scale_x;
+  uint8_t* zero_row;
+  void (*BlurColumnRow)(const uint8_t* src_add, const uint8_t* src_sub,
+                        int32_t* dst_sum, int width) = BlurColumnRow_C;
+  void (*BlurScaleRow)(const int32_t* src_sum, const float* src_scale,
+                       float scale, uint8_t* dst, int width) = BlurScaleRow_C;
+  if (!src || !dst || width <= 0 || height == 0 || radius < 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src = src + (height - 1) * src_stride;
+    src_stride = -src_stride;
+  }
+  radius_x = radius < width - 1 ? radius : width - 1;
+  radius_y = radius < height - 1 ? radius : height - 1;
+  // Sums of 255 must fit in int32.
+  if ((int64_t)(radius_x * 2 + 1) * (radius_y * 2 + 1) > (1 << 23)) {
+    return -1;
+  }
+#if defined(HAS_BLURCOLUMNROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    BlurColumnRow = BlurColumnRow_Any_SSE2;
+    if (IS_ALIGNED(n, 16)) {
+      BlurColumnRow = BlurColumnRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_BLURCOLUMNROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    BlurColumnRow = BlurColumnRow_Any_AVX2;
+    if (IS_ALIGNED(n, 16)) {
+      BlurColumnRow = BlurColumnRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_BLURCOLUMNROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    BlurColumnRow = BlurColumnRow_Any_NEON;
+    if (IS_ALIGNED(n, 16)) {
+      BlurColumnRow = BlurColumnRow_NEON;
+    }
+  }
+#endif
+#if defined(HAS_BLURSCALEROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    BlurScaleRow = BlurScaleRow_Any_SSE2;
+    if (IS_ALIGNED(n, 8)) {
+      BlurScaleRow = BlurScaleRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_BLURSCALEROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    BlurScaleRow = BlurScaleRow_Any_AVX2;
+    if (IS_ALIGNED(n, 16)) {
+      BlurScaleRow = BlurScaleRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_BLURSCALEROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    BlurScaleRow = BlurScaleRow_Any_NEON;
+    if (IS_ALIGNED(n, 8)) {
+      BlurScaleRow = BlurScaleRow_NEON;
+    }
+  }
+#endif
+
+  {
+    // Column sums are padded with zeros so the horizontal window can slide
+    // off either edge.
+    const int col_size = (radius_x * 2 + 1) * bpp + n;
+    align_buffer_64(row_mem, (col_size + n) * 4 + n * 4 + n);
+    col_sum = (int32_t*)(row_mem) + (radius_x + 1) * bpp;
+    row_sum = (int32_t*)(row_mem) + col_size;
+    scale_x = (float*)(row_sum + n);
+    zero_row = (uint8_t*)(scale_x + n);
+    memset(row_mem, 0, col_size * 4);
+    memset(zero_row, 0, n);
+
+    for (x = 0; x < width; ++x) {
+      int x0 = x - radius_x > 0 ? x - radius_x : 0;
+      int x1 = x + radius_x < width - 1 ? x + radius_x : width - 1;
+      for (i = 0; i < bpp; ++i) {
+        scale_x[x * bpp + i] = 1.f / (float)(x1 - x0 + 1);
+      }
+    }
+    // Prime the vertical sums with the rows above the first window centre.
+    for (y = 0; y < radius_y; ++y) {
+      BlurColumnRow(src + y * src_stride, zero_row, col_sum, n);
+    }
+
+    for (y = 0; y < height; ++y) {
+      const int y0 = y - radius_y > 0 ? y - radius_y : 0;
+      const int y1 = y + radius_y < height - 1 ? y + radius_y : height - 1;
+      const uint8_t* src_add =
+          (y + radius_y < height) ? src + (y + radius_y) * src_stride
+                                  : zero_row;
+      const uint8_t* src_sub = (y - radius_y - 1 >= 0)
+                                   ? src + (y - radius_y - 1) * src_stride
+                                   : zero_row;
+      const int32_t* sum_add = col_sum + radius_x * bpp;
+      const int32_t* sum_sub = col_sum - (radius_x + 1) * bpp;
+      if (src_add != zero_row || src_sub != zero_row) {
+        BlurColumnRow(src_add, src_sub, col_sum, n);
+      }
+      // Slide the window along the row.
+      for (i = 0; i < bpp; ++i) {
+        int32_t sum = 0;
+        for (x = 0; x < radius_x; ++x) {
+          sum += col_sum[x * bpp + i];
+        }
+        row_sum[i] = sum + sum_add[i] - sum_sub[i];
+      }
+      for (i = bpp; i < n; ++i) {
+        row_sum[i] = row_sum[i - bpp] + sum_add[i] - sum_sub[i];
+      }
+      BlurScaleRow(row_sum, scale_x, 256.f / (float)(y1 - y0 + 1), dst, n);
+      dst += dst_stride;
+    }
+    free_aligned_buffer_64(row_mem);
+  }
+  return 0;
+}
+
+// Box blur a plane.
+LIBYUV_API
+int BoxBlurPlane(const uint8_t* src_y,
+                 int src_stride_y,
+                 uint8_t* dst_y,
+                 int dst_stride_y,
+                 int width,
+                 int height,
+                 int radius) {
+  return BoxBlurPlaneBpp(src_y, src_stride_y, dst_y, dst_stride_y, width,
+                         height, radius, 1);
+}
+
+// Box blur an interleaved UV plane.
+LIBYUV_API
+int BoxBlurUVPlane(const uint8_t* src_uv,
+                   int src_stride_uv,
+                   uint8_t* dst_uv,
+                   int dst_stride_uv,
+                   int width,
+                   int height,
+                   int radius) {
+  return BoxBlurPlaneBpp(src_uv, src_stride_uv, dst_uv, dst_stride_uv, width,
+                         height, radius, 2);
+}
+
+// Box blur an ARGB image.
+LIBYUV_API
+int ARGBBoxBlur(const uint8_t* src_argb,
+                int src_stride_argb,
+                uint8_t* dst_argb,
+                int dst_stride_argb,
+                int width,
+                int height,
+                int radius) {
+  return BoxBlurPlaneBpp(src_argb, src_stride_argb, dst_argb, dst_stride_argb,
+                         width, height, radius, 4);
+}
+
 // Multiply ARGB image by a specified ARGB value.
 LIBYUV_API
 int ARGBShade(const uint8_t* src_argb,
@@ -4301,6 +4488,230 @@ int ARGBShade(const uint8_t* src_argb,
   return 0;
 }
 
+// Destination tile size for warps.  A tile maps to a compact region of the
+// source, so rotations and perspective reuse source rows from cache instead
+// of walking a full source diagonal for every destination row.
+#define WARP_TILE 64
+
+// Compute source coordinates for a destination row with a 3x3 matrix.
+static void WarpCoordsRow(const float* matrix,
+                          int x,
+                          int y,
+                          int width,
+                          float* dst_uv) {
+  const float fy = (float)(y);
+  const float u0 = matrix[1] * fy + matrix[2];
+  const float v0 = matrix[4] * fy + matrix[5];
+  const float w0 = matrix[7] * fy + matrix[8];
+  int i;
+  for (i = 0; i < width; ++i) {
+    const float fx = (float)(x + i);
+    const float rw = 1.f / (matrix[6] * fx + w0);
+    dst_uv[0] = (matrix[0] * fx + u0) * rw;
+    dst_uv[1] = (matrix[3] * fx + v0) * rw;
+    dst_uv += 2;
+  }
+}
+
+// dst = a * b for 3x3 matrices.
+static void WarpMatrixMul(const float* a, const float* b, float* dst) {
+  int i, j;
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) {
+      dst[i * 3 + j] = a[i * 3 + 0] * b[0 * 3 + j] +
+                       a[i * 3 + 1] * b[1 * 3 + j] +
+                       a[i * 3 + 2] * b[2 * 3 + j];
+    }
+  }
+}
+
+// Warp a plane with 1 (planar) or 4 (ARGB) bytes per pixel.
+static void WarpPlane(const uint8_t* src,
+                      int src_stride,
+                      int src_width,
+                      int src_height,
+                      uint8_t* dst,
+                      int dst_stride,
+                      int dst_width,
+                      int dst_height,
+                      const float* matrix,
+                      int bpp) {
+  SIMD_ALIGNED(float src_uv[WARP_TILE * 2]);
+  int tx, ty, y;
+  void (*WarpRow)(const uint8_t* src, int src_stride, int src_width,
+                  int src_height, const float* src_uv, uint8_t* dst,
+                  int width) = bpp == 4 ? ARGBWarpRow_C : WarpRow_C;
+  // The SIMD rows always read the right and bottom neighbours.
+  const int has_neighbours = src_width >= 2 && src_height >= 2;
+  if (bpp == 4) {
+#if defined(HAS_ARGBWARPROW_AVX2)
+    if (TestCpuFlag(kCpuHasAVX2) && has_neighbours) {
+      WarpRow = ARGBWarpRow_Any_AVX2;
+      if (IS_ALIGNED(dst_width, 8)) {
+        WarpRow = ARGBWarpRow_AVX2;
+      }
+    }
+#endif
+#if defined(HAS_ARGBWARPROW_NEON)
+    if (TestCpuFlag(kCpuHasNEON) && has_neighbours) {
+      WarpRow = ARGBWarpRow_Any_NEON;
+      if (IS_ALIGNED(dst_width, 4)) {
+        WarpRow = ARGBWarpRow_NEON;
+      }
+    }
+#endif
+  } else {
+#if defined(HAS_WARPROW_AVX2)
+    // Gather addresses are clamped to the end of the plane.
+    if (TestCpuFlag(kCpuHasAVX2) && has_neighbours && src_stride > 0) {
+      WarpRow = WarpRow_Any_AVX2;
+      if (IS_ALIGNED(dst_width, 8)) {
+        WarpRow = WarpRow_AVX2;
+      }
+    }
+#endif
+#if defined(HAS_WARPROW_NEON)
+    if (TestCpuFlag(kCpuHasNEON) && has_neighbours) {
+      WarpRow = WarpRow_Any_NEON;
+      if (IS_ALIGNED(dst_width, 4)) {
+        WarpRow = WarpRow_NEON;
+      }
+    }
+#endif
+  }
+
+  for (ty = 0; ty < dst_height; ty += WARP_TILE) {
+    const int tile_height = dst_height - ty < WARP_TILE ? dst_height - ty
+                                                        : WARP_TILE;
+    for (tx = 0; tx < dst_width; tx += WARP_TILE) {
+      const int tile_width =
+          dst_width - tx < WARP_TILE ? dst_width - tx : WARP_TILE;
+      uint8_t* dst_tile = dst + ty * (intptr_t)dst_stride + tx * bpp;
+      for (y = 0; y < tile_height; ++y) {
+        WarpCoordsRow(matrix, tx, ty + y, tile_width, src_uv);
+        WarpRow(src, src_stride, src_width, src_height, src_uv, dst_tile,
+                tile_width);
+        dst_tile += dst_stride;
+      }
+    }
+  }
+}
+
+// Warp ARGB with an affine transform.
+LIBYUV_API
+int ARGBAffine(const uint8_t* src_argb,
+               int src_stride_argb,
+               int src_width,
+               int src_height,
+               uint8_t* dst_argb,
+               int dst_stride_argb,
+               int dst_width,
+               int dst_height,
+               const float* affine) {
+  float matrix[9];
+  if (!affine) {
+    return -1;
+  }
+  matrix[0] = affine[0];
+  matrix[1] = affine[1];
+  matrix[2] = affine[2];
+  matrix[3] = affine[3];
+  matrix[4] = affine[4];
+  matrix[5] = affine[5];
+  matrix[6] = 0.f;
+  matrix[7] = 0.f;
+  matrix[8] = 1.f;
+  return ARGBPerspective(src_argb, src_stride_argb, src_width, src_height,
+                         dst_argb, dst_stride_argb, dst_width, dst_height,
+                         matrix);
+}
+
+// Warp ARGB with a perspective transform.
+LIBYUV_API
+int ARGBPerspective(const uint8_t* src_argb,
+                    int src_stride_argb,
+                    int src_width,
+                    int src_height,
+                    uint8_t* dst_argb,
+                    int dst_stride_argb,
+                    int dst_width,
+                    int dst_height,
+                    const float* matrix) {
+  if (!src_argb || !dst_argb || !matrix || src_width <= 0 ||
+      src_height == 0 || dst_width <= 0 || dst_height <= 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (src_height < 0) {
+    src_height = -src_height;
+    src_argb = src_argb + (src_height - 1) * (intptr_t)src_stride_argb;
+    src_stride_argb = -src_stride_argb;
+  }
+  WarpPlane(src_argb, src_stride_argb, src_width, src_height, dst_argb,
+            dst_stride_argb, dst_width, dst_height, matrix, 4);
+  return 0;
+}
+
+// Warp I420 with a perspective transform in luma coordinates.
+LIBYUV_API
+int I420Warp(const uint8_t* src_y,
+             int src_stride_y,
+             const uint8_t* src_u,
+             int src_stride_u,
+             const uint8_t* src_v,
+             int src_stride_v,
+             int src_width,
+             int src_height,
+             uint8_t* dst_y,
+             int dst_stride_y,
+             uint8_t* dst_u,
+             int dst_stride_u,
+             uint8_t* dst_v,
+             int dst_stride_v,
+             int dst_width,
+             int dst_height,
+             const float* matrix) {
+  // Chroma sample (x, y) is centered on luma (2 * x + 0.5, 2 * y + 0.5).
+  static const float kChromaToLuma[9] = {2.f, 0.f, 0.5f, 0.f, 2.f,
+                                         0.5f, 0.f, 0.f, 1.f};
+  static const float kLumaToChroma[9] = {0.5f, 0.f, -0.25f, 0.f, 0.5f,
+                                         -0.25f, 0.f, 0.f, 1.f};
+  float luma_to_src[9];  // Chroma to source luma.
+  float uv_matrix[9];
+  int src_halfwidth = (src_width + 1) >> 1;
+  int src_halfheight;
+  int dst_halfwidth = (dst_width + 1) >> 1;
+  int dst_halfheight = (dst_height + 1) >> 1;
+  if (!src_y || !src_u || !src_v || !dst_y || !dst_u || !dst_v || !matrix ||
+      src_width <= 0 || src_height == 0 || dst_width <= 0 ||
+      dst_height <= 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (src_height < 0) {
+    src_height = -src_height;
+    src_halfheight = (src_height + 1) >> 1;
+    src_y = src_y + (src_height - 1) * (intptr_t)src_stride_y;
+    src_u = src_u + (src_halfheight - 1) * (intptr_t)src_stride_u;
+    src_v = src_v + (src_halfheight - 1) * (intptr_t)src_stride_v;
+    src_stride_y = -src_stride_y;
+    src_stride_u = -src_stride_u;
+    src_stride_v = -src_stride_v;
+  }
+  src_halfheight = (src_height + 1) >> 1;
+
+  WarpMatrixMul(matrix, kChromaToLuma, luma_to_src);
+  WarpMatrixMul(kLumaToChroma, luma_to_src, uv_matrix);
+
+  WarpPlane(src_y, src_stride_y, src_width, src_height, dst_y, dst_stride_y,
+            dst_width, dst_height, matrix, 1);
+  WarpPlane(src_u, src_stride_u, src_halfwidth, src_halfheight, dst_u,
+            dst_stride_u, dst_halfwidth, dst_halfheight, uv_matrix, 1);
+  WarpPlane(src_v, src_stride_v, src_halfwidth, src_halfheight, dst_v,
+            dst_stride_v, dst_halfwidth, dst_halfheight, uv_matrix, 1);
+  return 0;
+}
+
 // Interpolate 2 planes by specified amount (0 to 255).
 LIBYUV_API
 int InterpolatePlane(const uint8_t* src0,
@@ -4706,6 +5117,18 @@ int GaussPlane_F32(const float* src,
   if (TestCpuFlag(kCpuHasNEON) && IS_ALIGNED(width, 8)) {
     GaussRow_F32 = GaussRow_F32_NEON;
   }
+#endif
+#if defined(HAS_GAUSSCOL_F32_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && TestCpuFlag(kCpuHasFMA3) &&
+      IS_ALIGNED(width, 8)) {
+    GaussCol_F32 = GaussCol_F32_AVX2;
+  }
+#endif
+#if defined(HAS_GAUSSROW_F32_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && TestCpuFlag(kCpuHasFMA3) &&
+      IS_ALIGNED(width, 8)) {
+    GaussRow_F32 = GaussRow_F32_AVX2;
+  }
 #endif
   {
     // 2 pixels on each side, but aligned out to 16 bytes.
@@ -4742,6 +5165,229 @@ int GaussPlane_F32(const float* src,
   return 0;
 }
 
+// Gaussian blur a plane with a 5x5 or 7x7 kernel.
+LIBYUV_API
+int GaussPlane(const uint8_t* src,
+               int src_stride,
+               uint8_t* dst,
+               int dst_stride,
+               int width,
+               int height,
+               int kernel_size) {
+  int y;
+  int i;
+  const int radius = kernel_size / 2;
+  void (*GaussCol_8)(const uint8_t* src0, const uint8_t* src1,
+                     const uint8_t* src2, const uint8_t* src3,
+                     const uint8_t* src4, uint16_t* dst, int width) =
+      GaussCol_8_C;
+  void (*GaussRow_8)(const uint16_t* src, uint8_t* dst, int width) =
+      GaussRow_8_C;
+  void (*Gauss7Col_8)(const uint8_t* src0, const uint8_t* src1,
+                      const uint8_t* src2, const uint8_t* src3,
+                      const uint8_t* src4, const uint8_t* src5,
+                      const uint8_t* src6, uint16_t* dst, int width) =
+      Gauss7Col_8_C;
+  void (*Gauss7Row_8)(const uint16_t* src, uint8_t* dst, int width) =
+      Gauss7Row_8_C;
+  if (!src || !dst || width <= 0 || height == 0 ||
+      (kernel_size != 5 && kernel_size != 7)) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src = src + (height - 1) * src_stride;
+    src_stride = -src_stride;
+  }
+
+#if defined(HAS_GAUSSCOL_8_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3) && IS_ALIGNED(width, 16)) {
+    GaussCol_8 = GaussCol_8_SSSE3;
+  }
+#endif
+#if defined(HAS_GAUSSROW_8_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2) && IS_ALIGNED(width, 16)) {
+    GaussRow_8 = GaussRow_8_SSE2;
+  }
+#endif
+#if defined(HAS_GAUSS7COL_8_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3) && IS_ALIGNED(width, 16)) {
+    Gauss7Col_8 = Gauss7Col_8_SSSE3;
+  }
+#endif
+#if defined(HAS_GAUSS7ROW_8_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2) && IS_ALIGNED(width, 8)) {
+    Gauss7Row_8 = Gauss7Row_8_SSE2;
+  }
+#endif
+#if defined(HAS_GAUSSCOL_8_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && IS_ALIGNED(width, 16)) {
+    GaussCol_8 = GaussCol_8_AVX2;
+  }
+#endif
+#if defined(HAS_GAUSSROW_8_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && IS_ALIGNED(width, 16)) {
+    GaussRow_8 = GaussRow_8_AVX2;
+  }
+#endif
+#if defined(HAS_GAUSS7COL_8_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && IS_ALIGNED(width, 16)) {
+    Gauss7Col_8 = Gauss7Col_8_AVX2;
+  }
+#endif
+#if defined(HAS_GAUSS7ROW_8_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && IS_ALIGNED(width, 16)) {
+    Gauss7Row_8 = Gauss7Row_8_AVX2;
+  }
+#endif
+#if defined(HAS_GAUSSCOL_8_NEON)
+  if (TestCpuFlag(kCpuHasNEON) && IS_ALIGNED(width, 16)) {
+    GaussCol_8 = GaussCol_8_NEON;
+  }
+#endif
+#if defined(HAS_GAUSSROW_8_NEON)
+  if (TestCpuFlag(kCpuHasNEON) && IS_ALIGNED(width, 8)) {
+    GaussRow_8 = GaussRow_8_NEON;
+  }
+#endif
+#if defined(HAS_GAUSS7COL_8_NEON)
+  if (TestCpuFlag(kCpuHasNEON) && IS_ALIGNED(width, 16)) {
+    Gauss7Col_8 = Gauss7Col_8_NEON;
+  }
+#endif
+#if defined(HAS_GAUSS7ROW_8_NEON)
+  if (TestCpuFlag(kCpuHasNEON) && IS_ALIGNED(width, 8)) {
+    Gauss7Row_8 = Gauss7Row_8_NEON;
+  }
+#endif
+  {
+    // 3 samples on each side for the 7 tap filter, padded out to 16 bytes
+    // so the row filters may read past the last tap.
+    align_buffer_64(rowbuf, (8 + width + 8) * 2);
+    uint16_t* row = (uint16_t*)(rowbuf) + 8;
+    const uint8_t* rows[7];
+
+    for (y = 0; y < height; ++y) {
+      // Clamp source rows to the image.
+      for (i = 0; i < kernel_size; ++i) {
+        int sy = y + i - radius;
+        sy = sy < 0 ? 0 : (sy > height - 1 ? height - 1 : sy);
+        rows[i] = src + sy * src_stride;
+      }
+      if (kernel_size == 5) {
+        GaussCol_8(rows[0], rows[1], rows[2], rows[3], rows[4], row, width);
+      } else {
+        Gauss7Col_8(rows[0], rows[1], rows[2], rows[3], rows[4], rows[5],
+                    rows[6], row, width);
+      }
+
+      // Extrude edges by 3 samples.
+      row[-3] = row[-2] = row[-1] = row[0];
+      row[width + 2] = row[width + 1] = row[width] = row[width - 1];
+
+      if (kernel_size == 5) {
+        GaussRow_8(row - 2, dst, width);
+      } else {
+        Gauss7Row_8(row - 3, dst, width);
+      }
+      dst += dst_stride;
+    }
+    free_aligned_buffer_64(rowbuf);
+  }
+  return 0;
+}
+
+// Gaussian blur a 16 bit plane with a 5x5 kernel.
+LIBYUV_API
+int GaussPlane_16(const uint16_t* src,
+                  int src_stride,
+                  uint16_t* dst,
+                  int dst_stride,
+                  int width,
+                  int height) {
+  int y;
+  void (*GaussCol)(const uint16_t* src0, const uint16_t* src1,
+                   const uint16_t* src2, const uint16_t* src3,
+                   const uint16_t* src4, uint32_t* dst, int width) =
+      GaussCol_C;
+  void (*GaussRow)(const uint32_t* src, uint16_t* dst, int width) =
+      GaussRow_C;
+  if (!src || !dst || width <= 0 || height == 0) {
+    return -1;
+  }
+  // Negative height means invert the image.
+  if (height < 0) {
+    height = -height;
+    src = src + (height - 1) * src_stride;
+    src_stride = -src_stride;
+  }
+
+#if defined(HAS_GAUSSCOL_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2) && IS_ALIGNED(width, 8)) {
+    GaussCol = GaussCol_SSE2;
+  }
+#endif
+#if defined(HAS_GAUSSROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2) && IS_ALIGNED(width, 8)) {
+    GaussRow = GaussRow_SSE2;
+  }
+#endif
+#if defined(HAS_GAUSSCOL_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && IS_ALIGNED(width, 8)) {
+    GaussCol = GaussCol_AVX2;
+  }
+#endif
+#if defined(HAS_GAUSSROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2) && IS_ALIGNED(width, 16)) {
+    GaussRow = GaussRow_AVX2;
+  }
+#endif
+#if defined(HAS_GAUSSCOL_NEON)
+  if (TestCpuFlag(kCpuHasNEON) && IS_ALIGNED(width, 8)) {
+    GaussCol = GaussCol_NEON;
+  }
+#endif
+#if defined(HAS_GAUSSROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON) && IS_ALIGNED(width, 8)) {
+    GaussRow = GaussRow_NEON;
+  }
+#endif
+  {
+    // 2 samples on each side, but aligned out to 16 bytes.
+    align_buffer_64(rowbuf, (4 + width + 4) * 4);
+    uint32_t* row = (uint32_t*)(rowbuf) + 4;
+    const uint16_t* src0 = src;
+    const uint16_t* src1 = src;
+    const uint16_t* src2 = src;
+    const uint16_t* src3 = src2 + ((height > 1) ? src_stride : 0);
+    const uint16_t* src4 = src3 + ((height > 2) ? src_stride : 0);
+    memset(rowbuf, 0, 16);
+    memset(rowbuf + (4 + width) * 4, 0, 16);
+
+    for (y = 0; y < height; ++y) {
+      GaussCol(src0, src1, src2, src3, src4, row, width);
+
+      // Extrude edge by 2 samples.
+      row[-2] = row[-1] = row[0];
+      row[width + 1] = row[width] = row[width - 1];
+
+      GaussRow(row - 2, dst, width);
+
+      src0 = src1;
+      src1 = src2;
+      src2 = src3;
+      src3 = src4;
+      if ((y + 2) < (height - 1)) {
+        src4 += src_stride;
+      }
+      dst += dst_stride;
+    }
+    free_aligned_buffer_64(rowbuf);
+  }
+  return 0;
+}
+
 // Sobel ARGB effect.
 static int ARGBSobelize(const uint8_t* src_argb,
                         int src_stride_argb,
@@ -313,6 +313,39 @@ ANY31(BlendPlaneRow_Any_SSSE3, BlendPlaneRow_SSSE3, 0, 0, 1, 7)
 #endif
 #undef ANY31
 
+// Any 3 16 bit planes to 1 packed 10 bit format with 4 bytes per pixel.
+#define ANY31P10(NAMEANY, ANY_SIMD, DTYPE, UVSHIFT, MASK)                \
+  void NAMEANY(const uint16_t* y_buf, const uint16_t* u_buf,             \
+               const uint16_t* v_buf, DTYPE* dst_ptr, int width) {       \
+    SIMD_ALIGNED(uint16_t vin[16 * 3]);                                  \
+    SIMD_ALIGNED(uint8_t vout[16 * 4]);                                  \
+    memset(vin, 0, sizeof(vin)); /* for odd width and msan */            \
+    int r = width & MASK;                                                \
+    int n = width & ~MASK;                                               \
+    if (n > 0) {                                                         \
+      ANY_SIMD(y_buf, u_buf, v_buf, dst_ptr, n);                         \
+    }                                                                    \
+    memcpy(vin, y_buf + n, r * 2);                                       \
+    memcpy(vin + 16, u_buf + (n >> UVSHIFT), SS(r, UVSHIFT) * 2);        \
+    memcpy(vin + 32, v_buf + (n >> UVSHIFT), SS(r, UVSHIFT) * 2);        \
+    ANY_SIMD(vin, vin + 16, vin + 32, (DTYPE*)vout, MASK + 1);           \
+    memcpy((uint8_t*)dst_ptr + n * 4, vout, (SS(r, UVSHIFT) << UVSHIFT) * 4); \
+  }
+
+#ifdef HAS_I210TOY210ROW_AVX2
+ANY31P10(I210ToY210Row_Any_AVX2, I210ToY210Row_AVX2, uint16_t, 1, 15)
+#endif
+#ifdef HAS_I210TOY210ROW_NEON
+ANY31P10(I210ToY210Row_Any_NEON, I210ToY210Row_NEON, uint16_t, 1, 15)
+#endif
+#ifdef HAS_I410TOY410ROW_AVX2
+ANY31P10(I410ToY410Row_Any_AVX2, I410ToY410Row_AVX2, uint8_t, 0, 7)
+#endif
+#ifdef HAS_I410TOY410ROW_NEON
+ANY31P10(I410ToY410Row_Any_NEON, I410ToY410Row_NEON, uint8_t, 0, 7)
+#endif
+#undef ANY31P10
+
 // Note that odd width replication includes 444 due to implementation
 // on arm that subsamples 444 to 422 internally.
 // Any 3 planes to 1 with yuvconstants
@@ -363,6 +396,9 @@ ANY31C(I422ToAR30Row_Any_SSSE3, I422ToAR30Row_SSSE3, 1, 0, 4, 7)
 #ifdef HAS_I422TOAR30ROW_AVX2
 ANY31C(I422ToAR30Row_Any_AVX2, I422ToAR30Row_AVX2, 1, 0, 4, 15)
 #endif
+#ifdef HAS_I422TOAR30ROW_AVX512BW
+ANY31C(I422ToAR30Row_Any_AVX512BW, I422ToAR30Row_AVX512BW, 1, 0, 4, 31)
+#endif
 #ifdef HAS_I444TOARGBROW_SSSE3
 ANY31C(I444ToARGBRow_Any_SSSE3, I444ToARGBRow_SSSE3, 0, 0, 4, 7)
 #endif
@@ -384,6 +420,9 @@ ANY31C(I422ToRGBARow_Any_AVX2, I422ToRGBARow_AVX2, 1, 0, 4, 15)
 #ifdef HAS_I444TOARGBROW_AVX2
 ANY31C(I444ToARGBRow_Any_AVX2, I444ToARGBRow_AVX2, 0, 0, 4, 15)
 #endif
+#ifdef HAS_I444TOARGBROW_AVX512BW
+ANY31C(I444ToARGBRow_Any_AVX512BW, I444ToARGBRow_AVX512BW, 0, 0, 4, 31)
+#endif
 #ifdef HAS_I444TORGB24ROW_AVX2
 ANY31C(I444ToRGB24Row_Any_AVX2, I444ToRGB24Row_AVX2, 0, 0, 3, 31)
 #endif
@@ -468,9 +507,29 @@ ANY31CT(I210ToARGBRow_Any_SSSE3, I210ToARGBRow_SSSE3, 1, 0, uint16_t, 2, 4, 7)
 #ifdef HAS_I210TOARGBROW_AVX2
 ANY31CT(I210ToARGBRow_Any_AVX2, I210ToARGBRow_AVX2, 1, 0, uint16_t, 2, 4, 15)
 #endif
+#ifdef HAS_I210TOARGBROW_AVX512BW
+ANY31CT(I210ToARGBRow_Any_AVX512BW,
+        I210ToARGBRow_AVX512BW,
+        1,
+        0,
+        uint16_t,
+        2,
+        4,
+        31)
+#endif
 #ifdef HAS_I210TOAR30ROW_AVX2
 ANY31CT(I210ToAR30Row_Any_AVX2, I210ToAR30Row_AVX2, 1, 0, uint16_t, 2, 4, 15)
 #endif
+#ifdef HAS_I210TOAR30ROW_AVX512BW
+ANY31CT(I210ToAR30Row_Any_AVX512BW,
+        I210ToAR30Row_AVX512BW,
+        1,
+        0,
+        uint16_t,
+        2,
+        4,
+        31)
+#endif
 #ifdef HAS_I410TOAR30ROW_SSSE3
 ANY31CT(I410ToAR30Row_Any_SSSE3, I410ToAR30Row_SSSE3, 0, 0, uint16_t, 2, 4, 7)
 #endif
@@ -480,9 +539,29 @@ ANY31CT(I410ToARGBRow_Any_SSSE3, I410ToARGBRow_SSSE3, 0, 0, uint16_t, 2, 4, 7)
 #ifdef HAS_I410TOARGBROW_AVX2
 ANY31CT(I410ToARGBRow_Any_AVX2, I410ToARGBRow_AVX2, 0, 0, uint16_t, 2, 4, 15)
 #endif
+#ifdef HAS_I410TOARGBROW_AVX512BW
+ANY31CT(I410ToARGBRow_Any_AVX512BW,
+        I410ToARGBRow_AVX512BW,
+        0,
+        0,
+        uint16_t,
+        2,
+        4,
+        31)
+#endif
 #ifdef HAS_I410TOAR30ROW_AVX2
 ANY31CT(I410ToAR30Row_Any_AVX2, I410ToAR30Row_AVX2, 0, 0, uint16_t, 2, 4, 15)
 #endif
+#ifdef HAS_I410TOAR30ROW_AVX512BW
+ANY31CT(I410ToAR30Row_Any_AVX512BW,
+        I410ToAR30Row_AVX512BW,
+        0,
+        0,
+        uint16_t,
+        2,
+        4,
+        31)
+#endif
 #ifdef HAS_I212TOAR30ROW_SSSE3
 ANY31CT(I212ToAR30Row_Any_SSSE3, I212ToAR30Row_SSSE3, 1, 0, uint16_t, 2, 4, 7)
 #endif
@@ -757,6 +836,9 @@ ANY21C(NV12ToARGBRow_Any_SSSE3, NV12ToARGBRow_SSSE3, 1, 1, 2, 4, 7)
 #ifdef HAS_NV12TOARGBROW_AVX2
 ANY21C(NV12ToARGBRow_Any_AVX2, NV12ToARGBRow_AVX2, 1, 1, 2, 4, 15)
 #endif
+#ifdef HAS_NV12TOARGBROW_AVX512BW
+ANY21C(NV12ToARGBRow_Any_AVX512BW, NV12ToARGBRow_AVX512BW, 1, 1, 2, 4, 31)
+#endif
 #ifdef HAS_NV12TOARGBROW_NEON
 ANY21C(NV12ToARGBRow_Any_NEON, NV12ToARGBRow_NEON, 1, 1, 2, 4, 7)
 #endif
@@ -1523,6 +1605,14 @@ ANY11P(ARGBShuffleRow_Any_LSX, ARGBShuffleRow_LSX, const uint8_t*, 4, 4, 7)
 #ifdef HAS_ARGBSHUFFLEROW_LASX
 ANY11P(ARGBShuffleRow_Any_LASX, ARGBShuffleRow_LASX, const uint8_t*, 4, 4, 15)
 #endif
+#ifdef HAS_AR30TOARGBTONEMAPROW_AVX2
+ANY11P(AR30ToARGBToneMapRow_Any_AVX2,
+       AR30ToARGBToneMapRow_AVX2,
+       const struct ToneMapConstants*,
+       4,
+       4,
+       7)
+#endif
 #undef ANY11P
 #undef ANY11P
 
@@ -1554,6 +1644,43 @@ ANY11T(ARGBToAB64Row_Any_SSSE3, ARGBToAB64Row_SSSE3, 4, 8, uint8_t, uint16_t, 3)
 ANY11T(AR64ToARGBRow_Any_SSSE3, AR64ToARGBRow_SSSE3, 8, 4, uint16_t, uint8_t, 3)
 #endif
 
+#ifdef HAS_CONVERTFP32TOFP16ROW_F16C
+ANY11T(ConvertFP32ToFP16Row_Any_F16C,
+       ConvertFP32ToFP16Row_F16C,
+       4,
+       2,
+       float,
+       uint16_t,
+       15)
+#endif
+#ifdef HAS_CONVERTFP32TOFP16ROW_NEON
+ANY11T(ConvertFP32ToFP16Row_Any_NEON,
+       ConvertFP32ToFP16Row_NEON,
+       4,
+       2,
+       float,
+       uint16_t,
+       7)
+#endif
+#ifdef HAS_CONVERTFP32TOINT8ROW_AVX2
+ANY11T(ConvertFP32ToInt8Row_Any_AVX2,
+       ConvertFP32ToInt8Row_AVX2,
+       4,
+       1,
+       float,
+       int8_t,
+       15)
+#endif
+#ifdef HAS_CONVERTFP32TOINT8ROW_NEON
+ANY11T(ConvertFP32ToInt8Row_Any_NEON,
+       ConvertFP32ToInt8Row_NEON,
+       4,
+       1,
+       float,
+       int8_t,
+       15)
+#endif
+
 #ifdef HAS_ARGBTOAR64ROW_SSSE3
 ANY11T(AB64ToARGBRow_Any_SSSE3, AB64ToARGBRow_SSSE3, 8, 4, uint16_t, uint8_t, 3)
 #endif
@@ -1823,6 +1950,15 @@ ANY11I(InterpolateRow_16_Any_NEON,
        1,
        7)
 #endif
+#ifdef HAS_INTERPOLATEROW_16_AVX2
+ANY11I(InterpolateRow_16_Any_AVX2,
+       InterpolateRow_16_AVX2,
+       uint16_t,
+       uint16_t,
+       1,
+       1,
+       15)
+#endif
 #undef ANY11I
 
 // Any 1 to 1 interpolate with scale param
@@ -2109,6 +2245,162 @@ ANY13(SplitXRGBRow_Any_AVX2, SplitXRGBRow_AVX2, 4, 15)
 ANY13(SplitXRGBRow_Any_NEON, SplitXRGBRow_NEON, 4, 15)
 #endif
 
+// Any 1 to 3 float planes with a scale and bias table.
+#define ANY13F(NAMEANY, ANY_SIMD, BPP, MASK)                         \
+  void NAMEANY(const uint8_t* src_ptr, float* dst_r, float* dst_g,   \
+               float* dst_b, const float* scale_bias, int width) {   \
+    SIMD_ALIGNED(uint8_t vin[16 * 4]);                               \
+    SIMD_ALIGNED(float vout[16 * 3]);                                \
+    memset(vin, 0, sizeof(vin)); /* for msan */                      \
+    int r = width & MASK;                                            \
+    int n = width & ~MASK;                                           \
+    if (n > 0) {                                                     \
+      ANY_SIMD(src_ptr, dst_r, dst_g, dst_b, scale_bias, n);         \
+    }                                                                \
+    memcpy(vin, src_ptr + n * BPP, r * BPP);                         \
+    ANY_SIMD(vin, vout, vout + 16, vout + 32, scale_bias, MASK + 1); \
+    memcpy(dst_r + n, vout, r * sizeof(float));                      \
+    memcpy(dst_g + n, vout + 16, r * sizeof(float));                 \
+    memcpy(dst_b + n, vout + 32, r * sizeof(float));                 \
+  }
+
+#ifdef HAS_ARGBTORGBPLANARFLOATROW_AVX2
+ANY13F(ARGBToRGBPlanarFloatRow_Any_AVX2, ARGBToRGBPlanarFloatRow_AVX2, 4, 7)
+#endif
+#ifdef HAS_ARGBTORGBPLANARFLOATROW_NEON
+ANY13F(ARGBToRGBPlanarFloatRow_Any_NEON, ARGBToRGBPlanarFloatRow_NEON, 4, 7)
+#endif
+#undef ANY13F
+
+// Any 1 to 1 RGB floats with a scale and bias table.
+#define ANY11F(NAMEANY, ANY_SIMD, SBPP, MASK)             \
+  void NAMEANY(const uint8_t* src_ptr, float* dst_ptr,    \
+               const float* scale_bias, int width) {      \
+    SIMD_ALIGNED(uint8_t vin[8 * 3]);                     \
+    SIMD_ALIGNED(float vout[8 * 3]);                      \
+    memset(vin, 0, sizeof(vin)); /* for msan */           \
+    int r = width & MASK;                                 \
+    int n = width & ~MASK;                                \
+    if (n > 0) {                                          \
+      ANY_SIMD(src_ptr, dst_ptr, scale_bias, n);          \
+    }                                                     \
+    memcpy(vin, src_ptr + n * SBPP, r * SBPP);            \
+    ANY_SIMD(vin, vout, scale_bias, MASK + 1);            \
+    memcpy(dst_ptr + n * 3, vout, r * 3 * sizeof(float)); \
+  }
+
+#ifdef HAS_RAWTOFLOATROW_AVX2
+ANY11F(RAWToFloatRow_Any_AVX2, RAWToFloatRow_AVX2, 3, 7)
+#endif
+#ifdef HAS_RAWTOFLOATROW_NEON
+ANY11F(RAWToFloatRow_Any_NEON, RAWToFloatRow_NEON, 3, 7)
+#endif
+#undef ANY11F
+
+// Any 1 to 3 for packed 10 bit formats with 4 bytes per pixel, unpacked
+// to 16 bit planes.
+#define ANY13P10(NAMEANY, ANY_SIMD, STYPE, UVSHIFT, MASK)                 \
+  void NAMEANY(const STYPE* src_ptr, uint16_t* dst_y, uint16_t* dst_u,   \
+               uint16_t* dst_v, int width) {                             \
+    SIMD_ALIGNED(uint8_t vin[16 * 4]);                                   \
+    SIMD_ALIGNED(uint16_t vout[16 * 3]);                                 \
+    memset(vin, 0, sizeof(vin)); /* for msan */                          \
+    int r = width & MASK;                                                \
+    int n = width & ~MASK;                                               \
+    if (n > 0) {                                                         \
+      ANY_SIMD(src_ptr, dst_y, dst_u, dst_v, n);                         \
+    }                                                                    \
+    memcpy(vin, (const uint8_t*)src_ptr + n * 4,                         \
+           (SS(r, UVSHIFT) << UVSHIFT) * 4);                             \
+    ANY_SIMD((const STYPE*)vin, vout, vout + 16, vout + 32, MASK + 1);   \
+    memcpy(dst_y + n, vout, r * 2);                                      \
+    memcpy(dst_u + (n >> UVSHIFT), vout + 16, SS(r, UVSHIFT) * 2);       \
+    memcpy(dst_v + (n >> UVSHIFT), vout + 32, SS(r, UVSHIFT) * 2);       \
+  }
+
+#ifdef HAS_Y210TOI210ROW_SSSE3
+ANY13P10(Y210ToI210Row_Any_SSSE3, Y210ToI210Row_SSSE3, uint16_t, 1, 7)
+#endif
+#ifdef HAS_Y210TOI210ROW_AVX2
+ANY13P10(Y210ToI210Row_Any_AVX2, Y210ToI210Row_AVX2, uint16_t, 1, 15)
+#endif
+#ifdef HAS_Y210TOI210ROW_NEON
+ANY13P10(Y210ToI210Row_Any_NEON, Y210ToI210Row_NEON, uint16_t, 1, 15)
+#endif
+#ifdef HAS_Y410TOI410ROW_SSE2
+ANY13P10(Y410ToI410Row_Any_SSE2, Y410ToI410Row_SSE2, uint8_t, 0, 7)
+#endif
+#ifdef HAS_Y410TOI410ROW_AVX2
+ANY13P10(Y410ToI410Row_Any_AVX2, Y410ToI410Row_AVX2, uint8_t, 0, 15)
+#endif
+#ifdef HAS_Y410TOI410ROW_NEON
+ANY13P10(Y410ToI410Row_Any_NEON, Y410ToI410Row_NEON, uint8_t, 0, 7)
+#endif
+#undef ANY13P10
+
+// Any v210 to I210. STEP is pixels per loop, a multiple of the 6 pixels in
+// each 16 byte group.
+#define ANYV210(NAMEANY, ANY_SIMD, STEP)                                  \
+  void NAMEANY(const uint8_t* src_ptr, uint16_t* dst_y, uint16_t* dst_u, \
+               uint16_t* dst_v, int width) {                             \
+    SIMD_ALIGNED(uint8_t vin[64]);                                       \
+    SIMD_ALIGNED(uint16_t vout[24 * 3]);                                 \
+    memset(vin, 0, sizeof(vin)); /* for msan */                          \
+    int r = width % STEP;                                                \
+    int n = width - r;                                                   \
+    if (n > 0) {                                                         \
+      ANY_SIMD(src_ptr, dst_y, dst_u, dst_v, n);                         \
+    }                                                                    \
+    memcpy(vin, src_ptr + n / 6 * 16, (r + 5) / 6 * 16);                 \
+    ANY_SIMD(vin, vout, vout + 24, vout + 48, STEP);                     \
+    memcpy(dst_y + n, vout, r * 2);                                      \
+    memcpy(dst_u + n / 2, vout + 24, SS(r, 1) * 2);                      \
+    memcpy(dst_v + n / 2, vout + 48, SS(r, 1) * 2);                      \
+  }
+
+#ifdef HAS_V210TOI210ROW_SSSE3
+ANYV210(V210ToI210Row_Any_SSSE3, V210ToI210Row_SSSE3, 12)
+#endif
+#ifdef HAS_V210TOI210ROW_AVX2
+ANYV210(V210ToI210Row_Any_AVX2, V210ToI210Row_AVX2, 24)
+#endif
+#ifdef HAS_V210TOI210ROW_NEON
+ANYV210(V210ToI210Row_Any_NEON, V210ToI210Row_NEON, 12)
+#endif
+#undef ANYV210
+
+// Any 3 padded Bayer rows to ARGB.  The remainder is copied along with its
+// left and right neighbours.
+#define ANYBAYER(NAMEANY, ANY_SIMD, MASK)                                 \
+  void NAMEANY(const uint8_t* src_bayer0, const uint8_t* src_bayer1,     \
+               const uint8_t* src_bayer2, uint8_t* dst_argb, int layout, \
+               int width) {                                              \
+    SIMD_ALIGNED(uint8_t vin[64 * 3]);                                   \
+    SIMD_ALIGNED(uint8_t vout[(MASK + 1) * 4]);                          \
+    memset(vin, 0, sizeof(vin)); /* for msan */                          \
+    int r = width & MASK;                                                \
+    int n = width & ~MASK;                                               \
+    if (n > 0) {                                                         \
+      ANY_SIMD(src_bayer0, src_bayer1, src_bayer2, dst_argb, layout, n); \
+    }                                                                    \
+    memcpy(vin, src_bayer0 + n - 1, r + 2);                              \
+    memcpy(vin + 64, src_bayer1 + n - 1, r + 2);                         \
+    memcpy(vin + 128, src_bayer2 + n - 1, r + 2);                        \
+    ANY_SIMD(vin + 1, vin + 65, vin + 129, vout, layout, MASK + 1);      \
+    memcpy(dst_argb + n * 4, vout, r * 4);                               \
+  }
+
+#ifdef HAS_BAYERROWTOARGBROW_SSE2
+ANYBAYER(BayerRowToARGBRow_Any_SSE2, BayerRowToARGBRow_SSE2, 15)
+#endif
+#ifdef HAS_BAYERROWTOARGBROW_AVX2
+ANYBAYER(BayerRowToARGBRow_Any_AVX2, BayerRowToARGBRow_AVX2, 31)
+#endif
+#ifdef HAS_BAYERROWTOARGBROW_NEON
+ANYBAYER(BayerRowToARGBRow_Any_NEON, BayerRowToARGBRow_NEON, 15)
+#endif
+#undef ANYBAYER
+
 // Any 1 to 4.  Outputs ARGB planes.
 #define ANY14(NAMEANY, ANY_SIMD, BPP, MASK)                            \
   void NAMEANY(const uint8_t* src_ptr, uint8_t* dst_r, uint8_t* dst_g, \
@@ -2453,6 +2745,103 @@ ANYDETILEMERGE(DetileToYUY2_Any_NEON, DetileToYUY2_NEON, 15)
 ANYDETILEMERGE(DetileToYUY2_Any_SSE2, DetileToYUY2_SSE2, 15)
 #endif
 
+// Any warp.  Source pixels are read in place; only the coordinates and
+// destination are padded.
+#define ANYWARP(NAMEANY, ANY_SIMD, BPP, MASK)                               \
+  void NAMEANY(const uint8_t* src_ptr, int src_stride, int src_width,      \
+               int src_height, const float* src_uv, uint8_t* dst_ptr,      \
+               int width) {                                                \
+    SIMD_ALIGNED(float vin[(MASK + 1) * 2]);                                \
+    SIMD_ALIGNED(uint8_t vout[(MASK + 1) * BPP]);                           \
+    memset(vin, 0, sizeof(vin)); /* for msan */                             \
+    int r = width & MASK;                                                   \
+    int n = width & ~MASK;                                                  \
+    if (n > 0) {                                                            \
+      ANY_SIMD(src_ptr, src_stride, src_width, src_height, src_uv, dst_ptr, \
+               n);                                                          \
+    }                                                                       \
+    memcpy(vin, src_uv + n * 2, r * 2 * sizeof(float));                     \
+    ANY_SIMD(src_ptr, src_stride, src_width, src_height, vin, vout,         \
+             MASK + 1);                                                     \
+    memcpy(dst_ptr + n * BPP, vout, r * BPP);                               \
+  }
+
+#ifdef HAS_ARGBWARPROW_AVX2
+ANYWARP(ARGBWarpRow_Any_AVX2, ARGBWarpRow_AVX2, 4, 7)
+#endif
+#ifdef HAS_ARGBWARPROW_NEON
+ANYWARP(ARGBWarpRow_Any_NEON, ARGBWarpRow_NEON, 4, 3)
+#endif
+#ifdef HAS_WARPROW_AVX2
+ANYWARP(WarpRow_Any_AVX2, WarpRow_AVX2, 1, 7)
+#endif
+#ifdef HAS_WARPROW_NEON
+ANYWARP(WarpRow_Any_NEON, WarpRow_NEON, 1, 3)
+#endif
+#undef ANYWARP
+
+// Any 2 byte rows accumulated into int32 sums.
+#define ANYBLURCOL(NAMEANY, ANY_SIMD, MASK)                               \
+  void NAMEANY(const uint8_t* src_add, const uint8_t* src_sub,            \
+               int32_t* dst_sum, int width) {                             \
+    SIMD_ALIGNED(uint8_t vin[(MASK + 1) * 2]);                            \
+    SIMD_ALIGNED(int32_t vsum[MASK + 1]);                                 \
+    memset(vin, 0, sizeof(vin)); /* for msan */                           \
+    memset(vsum, 0, sizeof(vsum));                                        \
+    int r = width & MASK;                                                 \
+    int n = width & ~MASK;                                                \
+    if (n > 0) {                                                          \
+      ANY_SIMD(src_add, src_sub, dst_sum, n);                             \
+    }                                                                     \
+    memcpy(vin, src_add + n, r);                                          \
+    memcpy(vin + MASK + 1, src_sub + n, r);                               \
+    memcpy(vsum, dst_sum + n, r * sizeof(int32_t));                       \
+    ANY_SIMD(vin, vin + MASK + 1, vsum, MASK + 1);                        \
+    memcpy(dst_sum + n, vsum, r * sizeof(int32_t));                       \
+  }
+
+#ifdef HAS_BLURCOLUMNROW_SSE2
+ANYBLURCOL(BlurColumnRow_Any_SSE2, BlurColumnRow_SSE2, 15)
+#endif
+#ifdef HAS_BLURCOLUMNROW_AVX2
+ANYBLURCOL(BlurColumnRow_Any_AVX2, BlurColumnRow_AVX2, 15)
+#endif
+#ifdef HAS_BLURCOLUMNROW_NEON
+ANYBLURCOL(BlurColumnRow_Any_NEON, BlurColumnRow_NEON, 15)
+#endif
+#undef ANYBLURCOL
+
+// Any int32 sums with float scales to bytes.
+#define ANYBLURSCALE(NAMEANY, ANY_SIMD, MASK)                             \
+  void NAMEANY(const int32_t* src_sum, const float* src_scale,            \
+               float scale, uint8_t* dst_ptr, int width) {                \
+    SIMD_ALIGNED(int32_t vin[MASK + 1]);                                  \
+    SIMD_ALIGNED(float vscale[MASK + 1]);                                 \
+    SIMD_ALIGNED(uint8_t vout[MASK + 1]);                                 \
+    memset(vin, 0, sizeof(vin)); /* for msan */                           \
+    memset(vscale, 0, sizeof(vscale));                                    \
+    int r = width & MASK;                                                 \
+    int n = width & ~MASK;                                                \
+    if (n > 0) {                                                          \
+      ANY_SIMD(src_sum, src_scale, scale, dst_ptr, n);                    \
+    }                                                                     \
+    memcpy(vin, src_sum + n, r * sizeof(int32_t));                        \
+    memcpy(vscale, src_scale + n, r * sizeof(float));                     \
+    ANY_SIMD(vin, vscale, scale, vout, MASK + 1);                         \
+    memcpy(dst_ptr + n, vout, r);                                         \
+  }
+
+#ifdef HAS_BLURSCALEROW_SSE2
+ANYBLURSCALE(BlurScaleRow_Any_SSE2, BlurScaleRow_SSE2, 7)
+#endif
+#ifdef HAS_BLURSCALEROW_AVX2
+ANYBLURSCALE(BlurScaleRow_Any_AVX2, BlurScaleRow_AVX2, 15)
+#endif
+#ifdef HAS_BLURSCALEROW_NEON
+ANYBLURSCALE(BlurScaleRow_Any_NEON, BlurScaleRow_NEON, 7)
+#endif
+#undef ANYBLURSCALE
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
@@ -11,6 +11,7 @@
 #include "libyuv/row.h"
 
 #include <assert.h>
+#include <math.h>    // For lrintf.
 #include <string.h>  // For memcpy and memset.
 
 #include "libyuv/basic_types.h"
@@ -281,6 +282,36 @@ void AR30ToAB30Row_C(const uint8_t* src_ar30, uint8_t* dst_ab30, int width) {
   }
 }
 
+// Each channel is linearized with kEotf, mixed into BT.709 primaries, then
+// tone mapped and encoded with kOetf.
+void AR30ToARGBToneMapRow_C(const uint8_t* src_ar30,
+                            uint8_t* dst_argb,
+                            const struct ToneMapConstants* tonemap,
+                            int width) {
+  const int32_t* m = tonemap->kGamut;
+  const int32_t max_index = m[10 * 8];
+  int x;
+  for (x = 0; x < width; ++x) {
+    uint32_t ar30;
+    memcpy(&ar30, src_ar30, sizeof ar30);
+    int32_t b = (int32_t)tonemap->kEotf[ar30 & 0x3ff];
+    int32_t g = (int32_t)tonemap->kEotf[(ar30 >> 10) & 0x3ff];
+    int32_t r = (int32_t)tonemap->kEotf[(ar30 >> 20) & 0x3ff];
+    int32_t r709 =
+        (m[0 * 8] * r + m[1 * 8] * g + m[2 * 8] * b + m[9 * 8]) >> 16;
+    int32_t g709 =
+        (m[3 * 8] * r + m[4 * 8] * g + m[5 * 8] * b + m[9 * 8]) >> 16;
+    int32_t b709 =
+        (m[6 * 8] * r + m[7 * 8] * g + m[8 * 8] * b + m[9 * 8]) >> 16;
+    dst_argb[0] = tonemap->kOetf[ClampMax(clamp0(b709), max_index)];
+    dst_argb[1] = tonemap->kOetf[ClampMax(clamp0(g709), max_index)];
+    dst_argb[2] = tonemap->kOetf[ClampMax(clamp0(r709), max_index)];
+    dst_argb[3] = 255u;
+    src_ar30 += 4;
+    dst_argb += 4;
+  }
+}
+
 void ARGBToABGRRow_C(const uint8_t* src_argb, uint8_t* dst_abgr, int width) {
   int x;
   for (x = 0; x < width; ++x) {
@@ -565,6 +596,39 @@ void AR64ToARGBRow_C(const uint16_t* src_ar64, uint8_t* dst_argb, int width) {
   }
 }
 
+// Replicate the top bits of each 10 bit channel and the 2 bit alpha.
+void AR30ToAR64Row_C(const uint8_t* src_ar30, uint16_t* dst_ar64, int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    uint32_t ar30;
+    memcpy(&ar30, src_ar30, sizeof ar30);
+    uint32_t b = ar30 & 0x3ff;
+    uint32_t g = (ar30 >> 10) & 0x3ff;
+    uint32_t r = (ar30 >> 20) & 0x3ff;
+    dst_ar64[0] = STATIC_CAST(uint16_t, (b << 6) | (b >> 4));
+    dst_ar64[1] = STATIC_CAST(uint16_t, (g << 6) | (g >> 4));
+    dst_ar64[2] = STATIC_CAST(uint16_t, (r << 6) | (r >> 4));
+    dst_ar64[3] = STATIC_CAST(uint16_t, (ar30 >> 30) * 0x5555);
+    dst_ar64 += 4;
+    src_ar30 += 4;
+  }
+}
+
+// Round each channel to 10 bits and alpha to 2 bits.
+void AR64ToAR30Row_C(const uint16_t* src_ar64, uint8_t* dst_ar30, int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    uint32_t b = (src_ar64[0] * 1023 + 32768) >> 16;
+    uint32_t g = (src_ar64[1] * 1023 + 32768) >> 16;
+    uint32_t r = (src_ar64[2] * 1023 + 32768) >> 16;
+    uint32_t a = (src_ar64[3] * 3 + 32768) >> 16;
+    uint32_t ar30 = b | (g << 10) | (r << 20) | (a << 30);
+    memcpy(dst_ar30, &ar30, sizeof ar30);
+    dst_ar30 += 4;
+    src_ar64 += 4;
+  }
+}
+
 void AB64ToARGBRow_C(const uint16_t* src_ab64, uint8_t* dst_argb, int width) {
   int x;
   for (x = 0; x < width; ++x) {
@@ -903,6 +967,56 @@ MAKEROWYJ(RGB24, 2, 1, 0, 3)
 MAKEROWYJ(RAW, 0, 1, 2, 3)
 #undef MAKEROWYJ
 
+// BT.709 limited range
+// y =  0.1826 * r + 0.6142 * g + 0.0620 * b + 16
+// u = -0.1006 * r - 0.3386 * g + 0.4392 * b + 128
+// v =  0.4392 * r - 0.3989 * g - 0.0403 * b + 128
+static __inline uint8_t RGBToYH(uint8_t r, uint8_t g, uint8_t b) {
+  return STATIC_CAST(uint8_t, (47 * r + 157 * g + 16 * b + 0x1080) >> 8);
+}
+static __inline uint8_t RGBToUH(uint8_t r, uint8_t g, uint8_t b) {
+  return STATIC_CAST(uint8_t, (112 * b - 86 * g - 26 * r + 0x8080) >> 8);
+}
+static __inline uint8_t RGBToVH(uint8_t r, uint8_t g, uint8_t b) {
+  return STATIC_CAST(uint8_t, (112 * r - 102 * g - 10 * b + 0x8080) >> 8);
+}
+
+void ARGBToYHRow_C(const uint8_t* src_rgb, uint8_t* dst_y, int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    dst_y[0] = RGBToYH(src_rgb[2], src_rgb[1], src_rgb[0]);
+    src_rgb += 4;
+    dst_y += 1;
+  }
+}
+
+void ARGBToUVHRow_C(const uint8_t* src_rgb,
+                    int src_stride_rgb,
+                    uint8_t* dst_u,
+                    uint8_t* dst_v,
+                    int width) {
+  const uint8_t* src_rgb1 = src_rgb + src_stride_rgb;
+  int x;
+  for (x = 0; x < width - 1; x += 2) {
+    uint8_t ab = (src_rgb[0] + src_rgb[4] + src_rgb1[0] + src_rgb1[4] + 2) >> 2;
+    uint8_t ag = (src_rgb[1] + src_rgb[5] + src_rgb1[1] + src_rgb1[5] + 2) >> 2;
+    uint8_t ar = (src_rgb[2] + src_rgb[6] + src_rgb1[2] + src_rgb1[6] + 2) >> 2;
+    dst_u[0] = RGBToUH(ar, ag, ab);
+    dst_v[0] = RGBToVH(ar, ag, ab);
+    src_rgb += 8;
+    src_rgb1 += 8;
+    dst_u += 1;
+    dst_v += 1;
+  }
+  if (width & 1) {
+    uint8_t ab = AVGB(src_rgb[0], src_rgb1[0]);
+    uint8_t ag = AVGB(src_rgb[1], src_rgb1[1]);
+    uint8_t ar = AVGB(src_rgb[2], src_rgb1[2]);
+    dst_u[0] = RGBToUH(ar, ag, ab);
+    dst_v[0] = RGBToVH(ar, ag, ab);
+  }
+}
+
 void RGB565ToYRow_C(const uint8_t* src_rgb565, uint8_t* dst_y, int width) {
   int x;
   for (x = 0; x < width; ++x) {
@@ -3191,6 +3305,177 @@ void SplitUVRow_16_C(const uint16_t* src_uv,
   }
 }
 
+// Unpack v210. Each 16 bytes hold 6 pixels as 3 10 bit samples per little
+// endian dword, in the order U0 Y0 V0, Y1 U1 Y2, V1 Y3 U2, Y4 V2 Y5.
+void V210ToI210Row_C(const uint8_t* src_v210,
+                     uint16_t* dst_y,
+                     uint16_t* dst_u,
+                     uint16_t* dst_v,
+                     int width) {
+  int x;
+  for (x = 0; x < width; x += 6) {
+    uint16_t s[12];
+    int n = width - x < 6 ? width - x : 6;
+    int i;
+    for (i = 0; i < 4; ++i) {
+      uint32_t d;
+      memcpy(&d, src_v210 + i * 4, sizeof d);
+      s[i * 3 + 0] = d & 0x3ff;
+      s[i * 3 + 1] = (d >> 10) & 0x3ff;
+      s[i * 3 + 2] = (d >> 20) & 0x3ff;
+    }
+    for (i = 0; i < n; ++i) {
+      dst_y[i] = s[i * 2 + 1];
+    }
+    for (i = 0; i < (n + 1) / 2; ++i) {
+      dst_u[i] = s[i * 4];
+      dst_v[i] = s[i * 4 + 2];
+    }
+    src_v210 += 16;
+    dst_y += 6;
+    dst_u += 3;
+    dst_v += 3;
+  }
+}
+
+// Pack v210. A partial last group repeats the last pixel.
+void I210ToV210Row_C(const uint16_t* src_y,
+                     const uint16_t* src_u,
+                     const uint16_t* src_v,
+                     uint8_t* dst_v210,
+                     int width) {
+  int x;
+  for (x = 0; x < width; x += 6) {
+    uint32_t s[12];
+    int n = width - x < 6 ? width - x : 6;
+    int nuv = (n + 1) / 2;
+    int i;
+    for (i = 0; i < 6; ++i) {
+      s[i * 2 + 1] = clamp1023(src_y[i < n ? i : n - 1]);
+    }
+    for (i = 0; i < 3; ++i) {
+      s[i * 4] = clamp1023(src_u[i < nuv ? i : nuv - 1]);
+      s[i * 4 + 2] = clamp1023(src_v[i < nuv ? i : nuv - 1]);
+    }
+    for (i = 0; i < 4; ++i) {
+      uint32_t d = s[i * 3] | (s[i * 3 + 1] << 10) | (s[i * 3 + 2] << 20);
+      memcpy(dst_v210 + i * 4, &d, sizeof d);
+    }
+    src_y += 6;
+    src_u += 3;
+    src_v += 3;
+    dst_v210 += 16;
+  }
+}
+
+// Y210 is YUY2 with 16 bit samples holding 10 bits in the msbs.
+void Y210ToI210Row_C(const uint16_t* src_y210,
+                     uint16_t* dst_y,
+                     uint16_t* dst_u,
+                     uint16_t* dst_v,
+                     int width) {
+  int x;
+  for (x = 0; x < width - 1; x += 2) {
+    dst_y[0] = src_y210[0] >> 6;
+    dst_u[0] = src_y210[1] >> 6;
+    dst_y[1] = src_y210[2] >> 6;
+    dst_v[0] = src_y210[3] >> 6;
+    src_y210 += 4;
+    dst_y += 2;
+    dst_u += 1;
+    dst_v += 1;
+  }
+  if (width & 1) {
+    dst_y[0] = src_y210[0] >> 6;
+    dst_u[0] = src_y210[1] >> 6;
+    dst_v[0] = src_y210[3] >> 6;
+  }
+}
+
+void I210ToY210Row_C(const uint16_t* src_y,
+                     const uint16_t* src_u,
+                     const uint16_t* src_v,
+                     uint16_t* dst_y210,
+                     int width) {
+  int x;
+  for (x = 0; x < width - 1; x += 2) {
+    dst_y210[0] = STATIC_CAST(uint16_t, clamp1023(src_y[0]) << 6);
+    dst_y210[1] = STATIC_CAST(uint16_t, clamp1023(src_u[0]) << 6);
+    dst_y210[2] = STATIC_CAST(uint16_t, clamp1023(src_y[1]) << 6);
+    dst_y210[3] = STATIC_CAST(uint16_t, clamp1023(src_v[0]) << 6);
+    src_y += 2;
+    src_u += 1;
+    src_v += 1;
+    dst_y210 += 4;
+  }
+  if (width & 1) {
+    dst_y210[0] = STATIC_CAST(uint16_t, clamp1023(src_y[0]) << 6);
+    dst_y210[1] = STATIC_CAST(uint16_t, clamp1023(src_u[0]) << 6);
+    dst_y210[2] = 0;
+    dst_y210[3] = STATIC_CAST(uint16_t, clamp1023(src_v[0]) << 6);
+  }
+}
+
+// Y410 holds U, Y, V and A in bits 0, 10, 20 and 30 of a little endian dword.
+void Y410ToI410Row_C(const uint8_t* src_y410,
+                     uint16_t* dst_y,
+                     uint16_t* dst_u,
+                     uint16_t* dst_v,
+                     int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    uint32_t d;
+    memcpy(&d, src_y410, sizeof d);
+    dst_u[x] = d & 0x3ff;
+    dst_y[x] = (d >> 10) & 0x3ff;
+    dst_v[x] = (d >> 20) & 0x3ff;
+    src_y410 += 4;
+  }
+}
+
+// Alpha is set to opaque.
+void I410ToY410Row_C(const uint16_t* src_y,
+                     const uint16_t* src_u,
+                     const uint16_t* src_v,
+                     uint8_t* dst_y410,
+                     int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    uint32_t d = clamp1023(src_u[x]) | (clamp1023(src_y[x]) << 10) |
+                 (clamp1023(src_v[x]) << 20) | 0xc0000000u;
+    memcpy(dst_y410, &d, sizeof d);
+    dst_y410 += 4;
+  }
+}
+
+// Bilinear demosaic.  The row's own R or B sample is kept, G at those sites
+// is the average of the 4 neighbours and the other color the average of the
+// 4 diagonals.  Averages are pairwise rounded to match pavgb.
+void BayerRowToARGBRow_C(const uint8_t* src_bayer0,
+                         const uint8_t* src_bayer1,
+                         const uint8_t* src_bayer2,
+                         uint8_t* dst_argb,
+                         int layout,
+                         int width) {
+  const int c0 = (layout & 2) ? 0 : 2;  // Byte offset of the row's own color.
+  int x;
+  for (x = 0; x < width; ++x) {
+    if (((x ^ layout) & 1) == 0) {
+      dst_argb[c0] = src_bayer1[x];
+      dst_argb[1] = AVGB(AVGB(src_bayer1[x - 1], src_bayer1[x + 1]),
+                         AVGB(src_bayer0[x], src_bayer2[x]));
+      dst_argb[2 - c0] = AVGB(AVGB(src_bayer0[x - 1], src_bayer0[x + 1]),
+                              AVGB(src_bayer2[x - 1], src_bayer2[x + 1]));
+    } else {
+      dst_argb[c0] = AVGB(src_bayer1[x - 1], src_bayer1[x + 1]);
+      dst_argb[1] = src_bayer1[x];
+      dst_argb[2 - c0] = AVGB(src_bayer0[x], src_bayer2[x]);
+    }
+    dst_argb[3] = 255u;
+    dst_argb += 4;
+  }
+}
+
 void MultiplyRow_16_C(const uint16_t* src_y,
                       uint16_t* dst_y,
                       int scale,
@@ -3635,6 +3920,104 @@ void ARGBAffineRow_C(const uint8_t* src_argb,
   }
 }
 
+// Convert a source coordinate to an integer position and 8 bit fraction.
+// The coordinate is clamped to the image and the position to size - 2 so
+// the right/bottom neighbour is always in the image; the far edge is then
+// sampled with a fraction of 256.
+static __inline int WarpCoord(float u, int size, int* frac) {
+  const float umax = (float)(size - 1) * 256.f;
+  const int pmax = size > 1 ? size - 2 : 0;
+  float fu = u * 256.f;
+  int iu;
+  int pos;
+  fu = fu > 0.f ? fu : 0.f;  // Also maps NaN to 0.
+  fu = fu < umax ? fu : umax;
+  iu = (int)(fu);
+  pos = iu >> 8;
+  pos = pos < pmax ? pos : pmax;
+  *frac = iu - (pos << 8);
+  return pos;
+}
+
+static __inline uint8_t WarpLerp(int a, int b, int c, int d, int fx, int fy) {
+  int t = (a * (256 - fx) + b * fx + 128) >> 8;
+  int u = (c * (256 - fx) + d * fx + 128) >> 8;
+  return (uint8_t)((t * (256 - fy) + u * fy + 128) >> 8);
+}
+
+// Bilinear sample ARGB pixels at the source coordinates in src_uv.
+void ARGBWarpRow_C(const uint8_t* src_argb,
+                   int src_stride_argb,
+                   int src_width,
+                   int src_height,
+                   const float* src_uv,
+                   uint8_t* dst_argb,
+                   int width) {
+  const int dx = src_width > 1 ? 4 : 0;
+  const int dy = src_height > 1 ? src_stride_argb : 0;
+  int i;
+  for (i = 0; i < width; ++i) {
+    int fx, fy;
+    int x = WarpCoord(src_uv[0], src_width, &fx);
+    int y = WarpCoord(src_uv[1], src_height, &fy);
+    const uint8_t* s = src_argb + y * src_stride_argb + x * 4;
+    int c;
+    for (c = 0; c < 4; ++c) {
+      dst_argb[c] =
+          WarpLerp(s[c], s[c + dx], s[c + dy], s[c + dx + dy], fx, fy);
+    }
+    src_uv += 2;
+    dst_argb += 4;
+  }
+}
+
+// Bilinear sample a plane at the source coordinates in src_uv.
+void WarpRow_C(const uint8_t* src,
+               int src_stride,
+               int src_width,
+               int src_height,
+               const float* src_uv,
+               uint8_t* dst,
+               int width) {
+  const int dx = src_width > 1 ? 1 : 0;
+  const int dy = src_height > 1 ? src_stride : 0;
+  int i;
+  for (i = 0; i < width; ++i) {
+    int fx, fy;
+    int x = WarpCoord(src_uv[0], src_width, &fx);
+    int y = WarpCoord(src_uv[1], src_height, &fy);
+    const uint8_t* s = src + y * src_stride + x;
+    dst[i] = WarpLerp(s[0], s[dx], s[dy], s[dx + dy], fx, fy);
+    src_uv += 2;
+  }
+}
+
+// Update the vertical running sums of a box blur by adding one row and
+// subtracting the row that left the window.
+void BlurColumnRow_C(const uint8_t* src_add,
+                     const uint8_t* src_sub,
+                     int32_t* dst_sum,
+                     int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    dst_sum[i] += src_add[i] - src_sub[i];
+  }
+}
+
+// Normalize box sums.  src_scale holds the reciprocal of the horizontal
+// window size per element and scale is 256 / vertical window size.
+void BlurScaleRow_C(const int32_t* src_sum,
+                    const float* src_scale,
+                    float scale,
+                    uint8_t* dst,
+                    int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    int v = (int)((float)(src_sum[i]) * src_scale[i] * scale);
+    dst[i] = clamp255((v + 128) >> 8);
+  }
+}
+
 // Blend 2 rows into 1.
 static void HalfRow_C(const uint8_t* src_uv,
                       ptrdiff_t src_uv_stride,
@@ -3923,6 +4306,85 @@ void ByteToFloatRow_C(const uint8_t* src, float* dst, float scale, int width) {
   }
 }
 
+// Scale and bias tables hold 24 scales followed by 24 biases, each repeating
+// R, G, B so that SIMD can apply them to interleaved RGB floats directly.
+void ARGBToRGBPlanarFloatRow_C(const uint8_t* src_argb,
+                               float* dst_r,
+                               float* dst_g,
+                               float* dst_b,
+                               const float* scale_bias,
+                               int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    dst_r[i] = src_argb[2] * scale_bias[0] + scale_bias[24];
+    dst_g[i] = src_argb[1] * scale_bias[1] + scale_bias[25];
+    dst_b[i] = src_argb[0] * scale_bias[2] + scale_bias[26];
+    src_argb += 4;
+  }
+}
+
+void RAWToFloatRow_C(const uint8_t* src_raw,
+                     float* dst,
+                     const float* scale_bias,
+                     int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    dst[0] = src_raw[0] * scale_bias[0] + scale_bias[24];
+    dst[1] = src_raw[1] * scale_bias[1] + scale_bias[25];
+    dst[2] = src_raw[2] * scale_bias[2] + scale_bias[26];
+    src_raw += 3;
+    dst += 3;
+  }
+}
+
+// Convert float to half float with round to nearest even, matching
+// vcvtps2ph and fcvtn.  Overflow becomes infinity and NaN is preserved.
+static uint16_t FloatToHalf(float value) {
+  const uint32_t kHalfMax = (127 + 16) << 23;  // 65536.0f overflows.
+  const uint32_t kHalfDenormMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+  uint32_t f;
+  uint32_t sign;
+  uint16_t h;
+  memcpy(&f, &value, 4);
+  sign = f & 0x80000000u;
+  f ^= sign;
+  if (f >= kHalfMax) {
+    h = (f > 0x7f800000u) ? 0x7e00 : 0x7c00;
+  } else if (f < (113u << 23)) {
+    // Denormal or zero.  Float addition does the rounding.
+    float magic;
+    float v;
+    memcpy(&magic, &kHalfDenormMagic, 4);
+    memcpy(&v, &f, 4);
+    v += magic;
+    memcpy(&f, &v, 4);
+    h = (uint16_t)(f - kHalfDenormMagic);
+  } else {
+    uint32_t mant_odd = (f >> 13) & 1;
+    f += ((uint32_t)(15 - 127) << 23) + 0xfff + mant_odd;
+    h = (uint16_t)(f >> 13);
+  }
+  return (uint16_t)(h | (sign >> 16));
+}
+
+void ConvertFP32ToFP16Row_C(const float* src, uint16_t* dst, int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    dst[i] = FloatToHalf(src[i]);
+  }
+}
+
+// Round to nearest even and saturate to int8.
+void ConvertFP32ToInt8Row_C(const float* src, int8_t* dst, int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    float value = src[i];
+    value = value < -128.f ? -128.f : value;
+    value = value > 127.f ? 127.f : value;
+    dst[i] = (int8_t)lrintf(value);
+  }
+}
+
 void ARGBLumaColorTableRow_C(const uint8_t* src_argb,
                              uint8_t* dst_argb,
                              int width,
@@ -4496,6 +4958,58 @@ void GaussCol_F32_C(const float* src0,
   }
 }
 
+// filter 5 rows with 1, 4, 6, 4, 1 coefficients to produce 1 row.
+void GaussCol_8_C(const uint8_t* src0,
+                  const uint8_t* src1,
+                  const uint8_t* src2,
+                  const uint8_t* src3,
+                  const uint8_t* src4,
+                  uint16_t* dst,
+                  int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    *dst++ = *src0++ + *src1++ * 4 + *src2++ * 6 + *src3++ * 4 + *src4++;
+  }
+}
+
+void GaussRow_8_C(const uint16_t* src, uint8_t* dst, int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    *dst++ = STATIC_CAST(
+        uint8_t,
+        (src[0] + src[1] * 4 + src[2] * 6 + src[3] * 4 + src[4] + 128) >> 8);
+    ++src;
+  }
+}
+
+// filter 7 rows with 1, 6, 15, 20, 15, 6, 1 coefficients to produce 1 row.
+void Gauss7Col_8_C(const uint8_t* src0,
+                   const uint8_t* src1,
+                   const uint8_t* src2,
+                   const uint8_t* src3,
+                   const uint8_t* src4,
+                   const uint8_t* src5,
+                   const uint8_t* src6,
+                   uint16_t* dst,
+                   int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    *dst++ = *src0++ + *src1++ * 6 + *src2++ * 15 + *src3++ * 20 +
+             *src4++ * 15 + *src5++ * 6 + *src6++;
+  }
+}
+
+void Gauss7Row_8_C(const uint16_t* src, uint8_t* dst, int width) {
+  int i;
+  for (i = 0; i < width; ++i) {
+    *dst++ = STATIC_CAST(uint8_t, (src[0] + src[1] * 6 + src[2] * 15 +
+                                   src[3] * 20 + src[4] * 15 + src[5] * 6 +
+                                   src[6] + 2048) >>
+                                      12);
+    ++src;
+  }
+}
+
 // Convert biplanar NV21 to packed YUV24
 void NV21ToYUV24Row_C(const uint8_t* src_y,
                       const uint8_t* src_vu,
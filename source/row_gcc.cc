@@ -3428,6 +3428,70 @@ void OMITFP I422ToRGBARow_SSSE3(const uint8_t* y_buf,
   "vpunpcklbw %%zmm4,%%zmm4,%%zmm4                                \n" \
   "lea        0x20(%[y_buf]),%[y_buf]                             \n"
 
+// Read 32 UV from 444.
+#define READYUV444_AVX512BW                                           \
+  "vmovdqu    (%[u_buf]),%%ymm3                                   \n" \
+  "vmovdqu    0x00(%[u_buf],%[v_buf],1),%%ymm1                    \n" \
+  "vpermq     %%zmm3,%%zmm17,%%zmm3                               \n" \
+  "vpermq     %%zmm1,%%zmm17,%%zmm1                               \n" \
+  "lea        0x20(%[u_buf]),%[u_buf]                             \n" \
+  "vpermq     $0xd8,%%zmm3,%%zmm3                                 \n" \
+  "vpermq     $0xd8,%%zmm1,%%zmm1                                 \n" \
+  "vpunpcklbw %%zmm1,%%zmm3,%%zmm3                                \n" \
+  "vmovdqu8   (%[y_buf]),%%ymm4                                   \n" \
+  "vpermq     %%zmm4,%%zmm17,%%zmm4                               \n" \
+  "vpermq     $0xd8,%%zmm4,%%zmm4                                 \n" \
+  "vpunpcklbw %%zmm4,%%zmm4,%%zmm4                                \n" \
+  "lea        0x20(%[y_buf]),%[y_buf]                             \n"
+
+// Read 16 UV from 210, upsample to 32 UV.
+#define READYUV210_AVX512BW                                           \
+  "vmovdqu    (%[u_buf]),%%ymm3                                   \n" \
+  "vmovdqu    0x00(%[u_buf],%[v_buf],1),%%ymm1                    \n" \
+  "vpermq     %%zmm3,%%zmm17,%%zmm3                               \n" \
+  "vpermq     %%zmm1,%%zmm17,%%zmm1                               \n" \
+  "lea        0x20(%[u_buf]),%[u_buf]                             \n" \
+  "vpermq     $0xd8,%%zmm3,%%zmm3                                 \n" \
+  "vpermq     $0xd8,%%zmm1,%%zmm1                                 \n" \
+  "vpunpcklwd %%zmm1,%%zmm3,%%zmm3                                \n" \
+  "vpsraw     $2,%%zmm3,%%zmm3                                    \n" \
+  "vpackuswb  %%zmm3,%%zmm3,%%zmm3                                \n" \
+  "vpunpcklwd %%zmm3,%%zmm3,%%zmm3                                \n" \
+  "vmovdqu8   (%[y_buf]),%%zmm4                                   \n" \
+  "vpsllw     $6,%%zmm4,%%zmm2                                    \n" \
+  "vpsrlw     $4,%%zmm4,%%zmm4                                    \n" \
+  "vpaddw     %%zmm2,%%zmm4,%%zmm4                                \n" \
+  "lea        0x40(%[y_buf]),%[y_buf]                             \n"
+
+// Read 32 UV from 410.
+#define READYUV410_AVX512BW                                           \
+  "vmovdqu8   (%[u_buf]),%%zmm3                                   \n" \
+  "vmovdqu8   0x00(%[u_buf],%[v_buf],1),%%zmm2                    \n" \
+  "lea        0x40(%[u_buf]),%[u_buf]                             \n" \
+  "vpsraw     $2,%%zmm3,%%zmm3                                    \n" \
+  "vpsraw     $2,%%zmm2,%%zmm2                                    \n" \
+  "vpunpckhwd %%zmm2,%%zmm3,%%zmm1                                \n" \
+  "vpunpcklwd %%zmm2,%%zmm3,%%zmm3                                \n" \
+  "vpackuswb  %%zmm1,%%zmm3,%%zmm3                                \n" \
+  "vmovdqu8   (%[y_buf]),%%zmm4                                   \n" \
+  "vpsllw     $6,%%zmm4,%%zmm2                                    \n" \
+  "vpsrlw     $4,%%zmm4,%%zmm4                                    \n" \
+  "vpaddw     %%zmm2,%%zmm4,%%zmm4                                \n" \
+  "lea        0x40(%[y_buf]),%[y_buf]                             \n"
+
+// Read 16 UV from NV12, upsample to 32 UV.
+#define READNV12_AVX512BW                                             \
+  "vmovdqu    (%[uv_buf]),%%ymm3                                  \n" \
+  "lea        0x20(%[uv_buf]),%[uv_buf]                           \n" \
+  "vpermq     %%zmm3,%%zmm17,%%zmm3                               \n" \
+  "vpermq     $0xd8,%%zmm3,%%zmm3                                 \n" \
+  "vpunpcklwd %%zmm3,%%zmm3,%%zmm3                                \n" \
+  "vmovdqu8   (%[y_buf]),%%ymm4                                   \n" \
+  "vpermq     %%zmm4,%%zmm17,%%zmm4                               \n" \
+  "vpermq     $0xd8,%%zmm4,%%zmm4                                 \n" \
+  "vpunpcklbw %%zmm4,%%zmm4,%%zmm4                                \n" \
+  "lea        0x20(%[y_buf]),%[y_buf]                             \n"
+
 // Read 8 UV from 210, upsample to 16 UV
 // TODO(fbarchard): Consider vshufb to replace pack/unpack
 // TODO(fbarchard): Consider vunpcklpd to combine the 2 registers into 1.
@@ -3627,17 +3691,17 @@ void OMITFP I422ToRGBARow_SSSE3(const uint8_t* y_buf,
 
 #define YUVTORGB_SETUP_AVX512BW(yuvconstants)                         \
   "vpcmpeqb   %%xmm13,%%xmm13,%%xmm13                             \n" \
-  "movdqa     (%[yuvconstants]),%%xmm8                            \n" \
+  "vmovdqa    (%[yuvconstants]),%%xmm8                            \n" \
   "vpbroadcastq %%xmm8, %%zmm8                                    \n" \
   "vpsllw     $7,%%xmm13,%%xmm13                                  \n" \
   "vpbroadcastb %%xmm13,%%zmm13                                   \n" \
-  "movq     32(%[yuvconstants]),%%xmm9                            \n" \
+  "vmovq    32(%[yuvconstants]),%%xmm9                            \n" \
   "vpbroadcastq %%xmm9,%%zmm9                                     \n" \
-  "movq     64(%[yuvconstants]),%%xmm10                           \n" \
+  "vmovq    64(%[yuvconstants]),%%xmm10                           \n" \
   "vpbroadcastq %%xmm10,%%zmm10                                   \n" \
-  "movq     96(%[yuvconstants]),%%xmm11                           \n" \
+  "vmovq    96(%[yuvconstants]),%%xmm11                           \n" \
   "vpbroadcastq %%xmm11,%%zmm11                                   \n" \
-  "movq     128(%[yuvconstants]),%%xmm12                          \n" \
+  "vmovq    128(%[yuvconstants]),%%xmm12                          \n" \
   "vpbroadcastq %%xmm12,%%zmm12                                   \n" \
   "vmovdqu8 (%[quadsplitperm]),%%zmm16                            \n" \
   "vmovdqu8 (%[dquadsplitperm]),%%zmm17                           \n" \
@@ -3762,6 +3826,33 @@ void OMITFP I422ToRGBARow_SSSE3(const uint8_t* y_buf,
   "vmovdqu    %%ymm3,0x20(%[dst_ar30])                            \n" \
   "lea        0x40(%[dst_ar30]), %[dst_ar30]                      \n"
 
+// Store 32 AR30 values.
+#define STOREAR30_AVX512BW                                            \
+  "vpsraw     $0x4,%%zmm0,%%zmm0                                  \n" \
+  "vpsraw     $0x4,%%zmm1,%%zmm1                                  \n" \
+  "vpsraw     $0x4,%%zmm2,%%zmm2                                  \n" \
+  "vpminsw    %%zmm7,%%zmm0,%%zmm0                                \n" \
+  "vpminsw    %%zmm7,%%zmm1,%%zmm1                                \n" \
+  "vpminsw    %%zmm7,%%zmm2,%%zmm2                                \n" \
+  "vpmaxsw    %%zmm6,%%zmm0,%%zmm0                                \n" \
+  "vpmaxsw    %%zmm6,%%zmm1,%%zmm1                                \n" \
+  "vpmaxsw    %%zmm6,%%zmm2,%%zmm2                                \n" \
+  "vpsllw     $0x4,%%zmm2,%%zmm2                                  \n" \
+  "vpermq     %%zmm0,%%zmm18,%%zmm0                               \n" \
+  "vpermq     %%zmm1,%%zmm18,%%zmm1                               \n" \
+  "vpermq     %%zmm2,%%zmm18,%%zmm2                               \n" \
+  "vpunpckhwd %%zmm2,%%zmm0,%%zmm3                                \n" \
+  "vpunpcklwd %%zmm2,%%zmm0,%%zmm0                                \n" \
+  "vpunpckhwd %%zmm5,%%zmm1,%%zmm2                                \n" \
+  "vpunpcklwd %%zmm5,%%zmm1,%%zmm1                                \n" \
+  "vpslld     $0xa,%%zmm1,%%zmm1                                  \n" \
+  "vpslld     $0xa,%%zmm2,%%zmm2                                  \n" \
+  "vpord      %%zmm1,%%zmm0,%%zmm0                                \n" \
+  "vpord      %%zmm2,%%zmm3,%%zmm3                                \n" \
+  "vmovdqu8   %%zmm0,(%[dst_ar30])                                \n" \
+  "vmovdqu8   %%zmm3,0x40(%[dst_ar30])                            \n" \
+  "lea        0x80(%[dst_ar30]), %[dst_ar30]                      \n"
+
 #ifdef HAS_I444TOARGBROW_AVX2
 // 16 pixels
 // 16 UV values with 16 Y producing 16 ARGB (64 bytes).
@@ -3839,12 +3930,13 @@ static const uint64_t kUnpermuteAVX512[8] = {0, 4, 1, 5, 2, 6, 3, 7};
 // 32 pixels
 // 16 UV values upsampled to 32 UV, mixed with 32 Y producing 32 ARGB (128
 // bytes).
-void OMITFP I422ToARGBRow_AVX512BW(const uint8_t* y_buf,
-                                   const uint8_t* u_buf,
-                                   const uint8_t* v_buf,
-                                   uint8_t* dst_argb,
-                                   const struct YuvConstants* yuvconstants,
-                                   int width) {
+void OMITFP TARGET_AVX512BW
+I422ToARGBRow_AVX512BW(const uint8_t* y_buf,
+                       const uint8_t* u_buf,
+                       const uint8_t* v_buf,
+                       uint8_t* dst_argb,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
   asm volatile (
     YUVTORGB_SETUP_AVX512BW(yuvconstants)
       "sub         %[u_buf],%[v_buf]             \n"
@@ -3875,6 +3967,305 @@ void OMITFP I422ToARGBRow_AVX512BW(const uint8_t* y_buf,
 }
 #endif  // HAS_I422TOARGBROW_AVX512BW
 
+#if defined(HAS_I444TOARGBROW_AVX512BW)
+// 32 pixels
+// 32 UV values with 32 Y producing 32 ARGB (128 bytes).
+void OMITFP TARGET_AVX512BW
+I444ToARGBRow_AVX512BW(const uint8_t* y_buf,
+                       const uint8_t* u_buf,
+                       const uint8_t* v_buf,
+                       uint8_t* dst_argb,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
+  asm volatile (
+    YUVTORGB_SETUP_AVX512BW(yuvconstants)
+      "sub         %[u_buf],%[v_buf]             \n"
+      "vpcmpeqb    %%xmm5,%%xmm5,%%xmm5          \n"
+      "vpbroadcastq %%xmm5,%%zmm5                \n"
+
+    LABELALIGN
+      "1:                                        \n"
+    READYUV444_AVX512BW
+    YUVTORGB_AVX512BW(yuvconstants)
+    STOREARGB_AVX512BW
+      "sub         $0x20,%[width]                \n"
+      "jg          1b                            \n"
+
+      "vzeroupper                                \n"
+  : [y_buf]"+r"(y_buf),                         // %[y_buf]
+    [u_buf]"+r"(u_buf),                         // %[u_buf]
+    [v_buf]"+r"(v_buf),                         // %[v_buf]
+    [dst_argb]"+r"(dst_argb),                   // %[dst_argb]
+    [width]"+rm"(width)                         // %[width]
+  : [yuvconstants]"r"(yuvconstants),            // %[yuvconstants]
+    [quadsplitperm]"r"(kSplitQuadWords),        // %[quadsplitperm]
+    [dquadsplitperm]"r"(kSplitDoubleQuadWords), // %[dquadsplitperm]
+    [unperm]"r"(kUnpermuteAVX512)               // %[unperm]
+  : "memory", "cc", YUVTORGB_REGS_AVX512BW
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5"
+  );
+}
+#endif  // HAS_I444TOARGBROW_AVX512BW
+
+#if defined(HAS_I422TOAR30ROW_AVX512BW)
+// 32 pixels
+// 16 UV values upsampled to 32 UV, mixed with 32 Y producing 32 AR30 (128
+// bytes).
+void OMITFP TARGET_AVX512BW
+I422ToAR30Row_AVX512BW(const uint8_t* y_buf,
+                       const uint8_t* u_buf,
+                       const uint8_t* v_buf,
+                       uint8_t* dst_ar30,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
+  asm volatile (
+    YUVTORGB_SETUP_AVX512BW(yuvconstants)
+      "sub         %[u_buf],%[v_buf]             \n"
+      "vpcmpeqb    %%xmm5,%%xmm5,%%xmm5          \n"  // AR30 constants
+      "vpsrlw      $14,%%xmm5,%%xmm5             \n"
+      "vpsllw      $4,%%xmm5,%%xmm5              \n"  // 2 alpha bits
+      "vpbroadcastq %%xmm5,%%zmm5                \n"
+      "vpxord      %%zmm6,%%zmm6,%%zmm6          \n"  // 0 for min
+      "vpcmpeqb    %%xmm7,%%xmm7,%%xmm7          \n"  // 1023 for max
+      "vpsrlw      $6,%%xmm7,%%xmm7              \n"
+      "vpbroadcastq %%xmm7,%%zmm7                \n"
+
+    LABELALIGN
+      "1:                                        \n"
+    READYUV422_AVX512BW
+    YUVTORGB16_AVX512BW(yuvconstants)
+    STOREAR30_AVX512BW
+      "sub         $0x20,%[width]                \n"
+      "jg          1b                            \n"
+
+      "vzeroupper                                \n"
+  : [y_buf]"+r"(y_buf),                         // %[y_buf]
+    [u_buf]"+r"(u_buf),                         // %[u_buf]
+    [v_buf]"+r"(v_buf),                         // %[v_buf]
+    [dst_ar30]"+r"(dst_ar30),                   // %[dst_ar30]
+    [width]"+rm"(width)                         // %[width]
+  : [yuvconstants]"r"(yuvconstants),            // %[yuvconstants]
+    [quadsplitperm]"r"(kSplitQuadWords),        // %[quadsplitperm]
+    [dquadsplitperm]"r"(kSplitDoubleQuadWords), // %[dquadsplitperm]
+    [unperm]"r"(kUnpermuteAVX512)               // %[unperm]
+  : "memory", "cc", YUVTORGB_REGS_AVX512BW
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7"
+  );
+}
+#endif  // HAS_I422TOAR30ROW_AVX512BW
+
+#if defined(HAS_I210TOARGBROW_AVX512BW)
+// 32 pixels
+// 16 UV values upsampled to 32 UV, mixed with 32 Y producing 32 ARGB (128
+// bytes).
+void OMITFP TARGET_AVX512BW
+I210ToARGBRow_AVX512BW(const uint16_t* y_buf,
+                       const uint16_t* u_buf,
+                       const uint16_t* v_buf,
+                       uint8_t* dst_argb,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
+  asm volatile (
+    YUVTORGB_SETUP_AVX512BW(yuvconstants)
+      "sub         %[u_buf],%[v_buf]             \n"
+      "vpcmpeqb    %%xmm5,%%xmm5,%%xmm5          \n"
+      "vpbroadcastq %%xmm5,%%zmm5                \n"
+
+    LABELALIGN
+      "1:                                        \n"
+    READYUV210_AVX512BW
+    YUVTORGB_AVX512BW(yuvconstants)
+    STOREARGB_AVX512BW
+      "sub         $0x20,%[width]                \n"
+      "jg          1b                            \n"
+
+      "vzeroupper                                \n"
+  : [y_buf]"+r"(y_buf),                         // %[y_buf]
+    [u_buf]"+r"(u_buf),                         // %[u_buf]
+    [v_buf]"+r"(v_buf),                         // %[v_buf]
+    [dst_argb]"+r"(dst_argb),                   // %[dst_argb]
+    [width]"+rm"(width)                         // %[width]
+  : [yuvconstants]"r"(yuvconstants),            // %[yuvconstants]
+    [quadsplitperm]"r"(kSplitQuadWords),        // %[quadsplitperm]
+    [dquadsplitperm]"r"(kSplitDoubleQuadWords), // %[dquadsplitperm]
+    [unperm]"r"(kUnpermuteAVX512)               // %[unperm]
+  : "memory", "cc", YUVTORGB_REGS_AVX512BW
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5"
+  );
+}
+#endif  // HAS_I210TOARGBROW_AVX512BW
+
+#if defined(HAS_I210TOAR30ROW_AVX512BW)
+// 32 pixels
+// 16 UV values upsampled to 32 UV, mixed with 32 Y producing 32 AR30 (128
+// bytes).
+void OMITFP TARGET_AVX512BW
+I210ToAR30Row_AVX512BW(const uint16_t* y_buf,
+                       const uint16_t* u_buf,
+                       const uint16_t* v_buf,
+                       uint8_t* dst_ar30,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
+  asm volatile (
+    YUVTORGB_SETUP_AVX512BW(yuvconstants)
+      "sub         %[u_buf],%[v_buf]             \n"
+      "vpcmpeqb    %%xmm5,%%xmm5,%%xmm5          \n"  // AR30 constants
+      "vpsrlw      $14,%%xmm5,%%xmm5             \n"
+      "vpsllw      $4,%%xmm5,%%xmm5              \n"  // 2 alpha bits
+      "vpbroadcastq %%xmm5,%%zmm5                \n"
+      "vpxord      %%zmm6,%%zmm6,%%zmm6          \n"  // 0 for min
+      "vpcmpeqb    %%xmm7,%%xmm7,%%xmm7          \n"  // 1023 for max
+      "vpsrlw      $6,%%xmm7,%%xmm7              \n"
+      "vpbroadcastq %%xmm7,%%zmm7                \n"
+
+    LABELALIGN
+      "1:                                        \n"
+    READYUV210_AVX512BW
+    YUVTORGB16_AVX512BW(yuvconstants)
+    STOREAR30_AVX512BW
+      "sub         $0x20,%[width]                \n"
+      "jg          1b                            \n"
+
+      "vzeroupper                                \n"
+  : [y_buf]"+r"(y_buf),                         // %[y_buf]
+    [u_buf]"+r"(u_buf),                         // %[u_buf]
+    [v_buf]"+r"(v_buf),                         // %[v_buf]
+    [dst_ar30]"+r"(dst_ar30),                   // %[dst_ar30]
+    [width]"+rm"(width)                         // %[width]
+  : [yuvconstants]"r"(yuvconstants),            // %[yuvconstants]
+    [quadsplitperm]"r"(kSplitQuadWords),        // %[quadsplitperm]
+    [dquadsplitperm]"r"(kSplitDoubleQuadWords), // %[dquadsplitperm]
+    [unperm]"r"(kUnpermuteAVX512)               // %[unperm]
+  : "memory", "cc", YUVTORGB_REGS_AVX512BW
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7"
+  );
+}
+#endif  // HAS_I210TOAR30ROW_AVX512BW
+
+#if defined(HAS_I410TOARGBROW_AVX512BW)
+// 32 pixels
+// 32 UV values with 32 Y producing 32 ARGB (128 bytes).
+void OMITFP TARGET_AVX512BW
+I410ToARGBRow_AVX512BW(const uint16_t* y_buf,
+                       const uint16_t* u_buf,
+                       const uint16_t* v_buf,
+                       uint8_t* dst_argb,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
+  asm volatile (
+    YUVTORGB_SETUP_AVX512BW(yuvconstants)
+      "sub         %[u_buf],%[v_buf]             \n"
+      "vpcmpeqb    %%xmm5,%%xmm5,%%xmm5          \n"
+      "vpbroadcastq %%xmm5,%%zmm5                \n"
+
+    LABELALIGN
+      "1:                                        \n"
+    READYUV410_AVX512BW
+    YUVTORGB_AVX512BW(yuvconstants)
+    STOREARGB_AVX512BW
+      "sub         $0x20,%[width]                \n"
+      "jg          1b                            \n"
+
+      "vzeroupper                                \n"
+  : [y_buf]"+r"(y_buf),                         // %[y_buf]
+    [u_buf]"+r"(u_buf),                         // %[u_buf]
+    [v_buf]"+r"(v_buf),                         // %[v_buf]
+    [dst_argb]"+r"(dst_argb),                   // %[dst_argb]
+    [width]"+rm"(width)                         // %[width]
+  : [yuvconstants]"r"(yuvconstants),            // %[yuvconstants]
+    [quadsplitperm]"r"(kSplitQuadWords),        // %[quadsplitperm]
+    [dquadsplitperm]"r"(kSplitDoubleQuadWords), // %[dquadsplitperm]
+    [unperm]"r"(kUnpermuteAVX512)               // %[unperm]
+  : "memory", "cc", YUVTORGB_REGS_AVX512BW
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5"
+  );
+}
+#endif  // HAS_I410TOARGBROW_AVX512BW
+
+#if defined(HAS_I410TOAR30ROW_AVX512BW)
+// 32 pixels
+// 32 UV values with 32 Y producing 32 AR30 (128 bytes).
+void OMITFP TARGET_AVX512BW
+I410ToAR30Row_AVX512BW(const uint16_t* y_buf,
+                       const uint16_t* u_buf,
+                       const uint16_t* v_buf,
+                       uint8_t* dst_ar30,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
+  asm volatile (
+    YUVTORGB_SETUP_AVX512BW(yuvconstants)
+      "sub         %[u_buf],%[v_buf]             \n"
+      "vpcmpeqb    %%xmm5,%%xmm5,%%xmm5          \n"  // AR30 constants
+      "vpsrlw      $14,%%xmm5,%%xmm5             \n"
+      "vpsllw      $4,%%xmm5,%%xmm5              \n"  // 2 alpha bits
+      "vpbroadcastq %%xmm5,%%zmm5                \n"
+      "vpxord      %%zmm6,%%zmm6,%%zmm6          \n"  // 0 for min
+      "vpcmpeqb    %%xmm7,%%xmm7,%%xmm7          \n"  // 1023 for max
+      "vpsrlw      $6,%%xmm7,%%xmm7              \n"
+      "vpbroadcastq %%xmm7,%%zmm7                \n"
+
+    LABELALIGN
+      "1:                                        \n"
+    READYUV410_AVX512BW
+    YUVTORGB16_AVX512BW(yuvconstants)
+    STOREAR30_AVX512BW
+      "sub         $0x20,%[width]                \n"
+      "jg          1b                            \n"
+
+      "vzeroupper                                \n"
+  : [y_buf]"+r"(y_buf),                         // %[y_buf]
+    [u_buf]"+r"(u_buf),                         // %[u_buf]
+    [v_buf]"+r"(v_buf),                         // %[v_buf]
+    [dst_ar30]"+r"(dst_ar30),                   // %[dst_ar30]
+    [width]"+rm"(width)                         // %[width]
+  : [yuvconstants]"r"(yuvconstants),            // %[yuvconstants]
+    [quadsplitperm]"r"(kSplitQuadWords),        // %[quadsplitperm]
+    [dquadsplitperm]"r"(kSplitDoubleQuadWords), // %[dquadsplitperm]
+    [unperm]"r"(kUnpermuteAVX512)               // %[unperm]
+  : "memory", "cc", YUVTORGB_REGS_AVX512BW
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7"
+  );
+}
+#endif  // HAS_I410TOAR30ROW_AVX512BW
+
+#if defined(HAS_NV12TOARGBROW_AVX512BW)
+// 32 pixels
+// 16 UV values upsampled to 32 UV, mixed with 32 Y producing 32 ARGB (128
+// bytes).
+void OMITFP TARGET_AVX512BW
+NV12ToARGBRow_AVX512BW(const uint8_t* y_buf,
+                       const uint8_t* uv_buf,
+                       uint8_t* dst_argb,
+                       const struct YuvConstants* yuvconstants,
+                       int width) {
+  asm volatile (
+    YUVTORGB_SETUP_AVX512BW(yuvconstants)
+      "vpcmpeqb    %%xmm5,%%xmm5,%%xmm5          \n"
+      "vpbroadcastq %%xmm5,%%zmm5                \n"
+
+    LABELALIGN
+      "1:                                        \n"
+    READNV12_AVX512BW
+    YUVTORGB_AVX512BW(yuvconstants)
+    STOREARGB_AVX512BW
+      "sub         $0x20,%[width]                \n"
+      "jg          1b                            \n"
+
+      "vzeroupper                                \n"
+  : [y_buf]"+r"(y_buf),                         // %[y_buf]
+    [uv_buf]"+r"(uv_buf),                       // %[uv_buf]
+    [dst_argb]"+r"(dst_argb),                   // %[dst_argb]
+    [width]"+rm"(width)                         // %[width]
+  : [yuvconstants]"r"(yuvconstants),            // %[yuvconstants]
+    [quadsplitperm]"r"(kSplitQuadWords),        // %[quadsplitperm]
+    [dquadsplitperm]"r"(kSplitDoubleQuadWords), // %[dquadsplitperm]
+    [unperm]"r"(kUnpermuteAVX512)               // %[unperm]
+  : "memory", "cc", YUVTORGB_REGS_AVX512BW
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5"
+  );
+}
+#endif  // HAS_NV12TOARGBROW_AVX512BW
+
 #if defined(HAS_I422TOAR30ROW_AVX2)
 // 16 pixels
 // 8 UV values upsampled to 16 UV, mixed with 16 Y producing 16 AR30 (64 bytes).
@@ -5313,609 +5704,906 @@ void SplitUVRow_16_AVX2(const uint16_t* src_uv,
 }
 #endif  // HAS_SPLITUVROW_16_AVX2
 
-// Use scale to convert lsb formats to msb, depending how many bits there are:
-// 128 = 9 bits
-// 64 = 10 bits
-// 16 = 12 bits
-// 1 = 16 bits
-#ifdef HAS_MULTIPLYROW_16_AVX2
-void MultiplyRow_16_AVX2(const uint16_t* src_y,
+#if defined(HAS_V210TOI210ROW_SSSE3) || defined(HAS_V210TOI210ROW_AVX2)
+// Shuffles gather the 2 bytes holding each 10 bit sample of 2 v210 groups.
+// Multipliers then move each sample to the msbs of its word, so a shift
+// right by 6 drops the bits of its neighbours.
+static const uvec8 kShuffleV210YA = {1u,  2u,  4u,  5u,  6u,   7u,   9u,   10u,
+                                     12u, 13u, 14u, 15u, 128u, 128u, 128u, 128u};
+static const uvec8 kShuffleV210YB = {128u, 128u, 128u, 128u, 128u, 128u,
+                                     128u, 128u, 128u, 128u, 128u, 128u,
+                                     1u,   2u,   4u,   5u};
+static const uvec8 kShuffleV210YC = {6u,   7u,   9u,   10u,  12u,  13u,
+                                     14u,  15u,  128u, 128u, 128u, 128u,
+                                     128u, 128u, 128u, 128u};
+static const uvec8 kShuffleV210UA = {0u,   1u,   5u,   6u,   10u,  11u,
+                                     128u, 128u, 128u, 128u, 128u, 128u,
+                                     128u, 128u, 128u, 128u};
+static const uvec8 kShuffleV210UB = {128u, 128u, 128u, 128u, 128u, 128u,
+                                     0u,   1u,   5u,   6u,   10u,  11u,
+                                     128u, 128u, 128u, 128u};
+static const uvec8 kShuffleV210VA = {2u,   3u,   8u,   9u,   13u,  14u,
+                                     128u, 128u, 128u, 128u, 128u, 128u,
+                                     128u, 128u, 128u, 128u};
+static const uvec8 kShuffleV210VB = {128u, 128u, 128u, 128u, 128u, 128u,
+                                     2u,   3u,   8u,   9u,   13u,  14u,
+                                     128u, 128u, 128u, 128u};
+static const vec16 kMulV210YA = {16, 64, 4, 16, 64, 4, 16, 64};
+static const vec16 kMulV210YC = {4, 16, 64, 4, 0, 0, 0, 0};
+static const vec16 kMulV210U = {64, 16, 4, 64, 16, 4, 0, 0};
+static const vec16 kMulV210V = {4, 64, 16, 4, 64, 16, 0, 0};
+#endif
+
+#ifdef HAS_V210TOI210ROW_SSSE3
+void V210ToI210Row_SSSE3(const uint8_t* src_v210,
                          uint16_t* dst_y,
-                         int scale,
+                         uint16_t* dst_u,
+                         uint16_t* dst_v,
                          int width) {
-  // clang-format off
-  asm volatile (
-      "vmovd       %3,%%xmm3                     \n"
-      "vpunpcklwd  %%xmm3,%%xmm3,%%xmm3          \n"
-      "vbroadcastss %%xmm3,%%ymm3                \n"
-      "sub         %0,%1                         \n"
+  asm volatile(
+      "sub         %2,%3                         \n"
 
-    // 32 pixels per loop.
-    LABELALIGN
+      // 12 pixels per loop.
+      LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"
-      "vmovdqu     0x20(%0),%%ymm1               \n"
-      "vpmullw     %%ymm3,%%ymm0,%%ymm0          \n"
-      "vpmullw     %%ymm3,%%ymm1,%%ymm1          \n"
-      "vmovdqu     %%ymm0,(%0,%1)                \n"
-      "vmovdqu     %%ymm1,0x20(%0,%1)            \n"
-      "add         $0x40,%0                      \n"
-      "sub         $0x20,%2                      \n"
-      "jg          1b                            \n"
-      "vzeroupper                                \n"
-  : "+r"(src_y),   // %0
-    "+r"(dst_y),   // %1
-    "+r"(width)    // %2
-  : "r"(scale)     // %3
-  : "memory", "cc", "xmm0", "xmm1", "xmm3");
-  // clang-format on
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "lea         0x20(%0),%0                   \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "pshufb      %5,%%xmm2                     \n"
+      "pshufb      %6,%%xmm3                     \n"
+      "por         %%xmm3,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "pshufb      %7,%%xmm3                     \n"
+      "pmullw      %12,%%xmm2                    \n"
+      "pmullw      %13,%%xmm3                    \n"
+      "psrlw       $0x6,%%xmm2                   \n"
+      "psrlw       $0x6,%%xmm3                   \n"
+      "movdqu      %%xmm2,(%1)                   \n"
+      "movq        %%xmm3,0x10(%1)               \n"
+      "lea         0x18(%1),%1                   \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "pshufb      %8,%%xmm2                     \n"
+      "pshufb      %9,%%xmm3                     \n"
+      "por         %%xmm3,%%xmm2                 \n"
+      "pshufb      %10,%%xmm0                    \n"
+      "pshufb      %11,%%xmm1                    \n"
+      "por         %%xmm1,%%xmm0                 \n"
+      "pmullw      %14,%%xmm2                    \n"
+      "pmullw      %15,%%xmm0                    \n"
+      "psrlw       $0x6,%%xmm2                   \n"
+      "psrlw       $0x6,%%xmm0                   \n"
+      "movq        %%xmm2,(%2)                   \n"
+      "movq        %%xmm0,0x00(%2,%3,1)          \n"
+      "psrldq      $0x8,%%xmm2                   \n"
+      "psrldq      $0x8,%%xmm0                   \n"
+      "movd        %%xmm2,0x08(%2)               \n"
+      "movd        %%xmm0,0x08(%2,%3,1)          \n"
+      "lea         0xc(%2),%2                    \n"
+      "sub         $0xc,%4                       \n"
+      "jg          1b                            \n"
+      : "+r"(src_v210),        // %0
+        "+r"(dst_y),           // %1
+        "+r"(dst_u),           // %2
+        "+r"(dst_v),           // %3
+        "+r"(width)            // %4
+      : "m"(kShuffleV210YA),   // %5
+        "m"(kShuffleV210YB),   // %6
+        "m"(kShuffleV210YC),   // %7
+        "m"(kShuffleV210UA),   // %8
+        "m"(kShuffleV210UB),   // %9
+        "m"(kShuffleV210VA),   // %10
+        "m"(kShuffleV210VB),   // %11
+        "m"(kMulV210YA),       // %12
+        "m"(kMulV210YC),       // %13
+        "m"(kMulV210U),        // %14
+        "m"(kMulV210V)         // %15
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3");
 }
-#endif  // HAS_MULTIPLYROW_16_AVX2
+#endif  // HAS_V210TOI210ROW_SSSE3
 
-// Use scale to convert msb formats to lsb, depending how many bits there are:
-// 512 = 9 bits
-// 1024 = 10 bits
-// 4096 = 12 bits
-// 65536 = 16 bits
-#ifdef HAS_DIVIDEROW_16_AVX2
-void DivideRow_16_AVX2(const uint16_t* src_y,
-                       uint16_t* dst_y,
-                       int scale,
-                       int width) {
-  // clang-format off
-  asm volatile (
-      "vmovd       %3,%%xmm3                     \n"
-      "vpunpcklwd  %%xmm3,%%xmm3,%%xmm3          \n"
-      "vbroadcastss %%xmm3,%%ymm3                \n"
-      "sub         %0,%1                         \n"
+#ifdef HAS_V210TOI210ROW_AVX2
+// Same as SSSE3 with groups 0 and 1 in the low lanes and 2 and 3 in the high
+// lanes.
+void V210ToI210Row_AVX2(const uint8_t* src_v210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width) {
+  asm volatile(
+      "vbroadcastf128 %5,%%ymm4                  \n"
+      "vbroadcastf128 %6,%%ymm5                  \n"
+      "vbroadcastf128 %7,%%ymm6                  \n"
+      "vbroadcastf128 %12,%%ymm7                 \n"
+      "sub         %2,%3                         \n"
 
-    // 32 pixels per loop.
-    LABELALIGN
+      // 24 pixels per loop.
+      LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"
-      "vmovdqu     0x20(%0),%%ymm1               \n"
-      "vpmulhuw    %%ymm3,%%ymm0,%%ymm0          \n"
-      "vpmulhuw    %%ymm3,%%ymm1,%%ymm1          \n"
-      "vmovdqu     %%ymm0,(%0,%1)                \n"
-      "vmovdqu     %%ymm1,0x20(%0,%1)            \n"
-      "add         $0x40,%0                      \n"
-      "sub         $0x20,%2                      \n"
+      "vmovdqu     (%0),%%xmm0                   \n"
+      "vmovdqu     0x10(%0),%%xmm1               \n"
+      "vinserti128 $0x1,0x20(%0),%%ymm0,%%ymm0   \n"
+      "vinserti128 $0x1,0x30(%0),%%ymm1,%%ymm1   \n"
+      "lea         0x40(%0),%0                   \n"
+      "vpshufb     %%ymm4,%%ymm0,%%ymm2          \n"
+      "vpshufb     %%ymm5,%%ymm1,%%ymm3          \n"
+      "vpor        %%ymm3,%%ymm2,%%ymm2          \n"
+      "vpshufb     %%ymm6,%%ymm1,%%ymm3          \n"
+      "vpmullw     %%ymm7,%%ymm2,%%ymm2          \n"
+      "vbroadcastf128 %13,%%ymm7                 \n"
+      "vpmullw     %%ymm7,%%ymm3,%%ymm3          \n"
+      "vbroadcastf128 %12,%%ymm7                 \n"
+      "vpsrlw      $0x6,%%ymm2,%%ymm2            \n"
+      "vpsrlw      $0x6,%%ymm3,%%ymm3            \n"
+      "vmovdqu     %%xmm2,(%1)                   \n"
+      "vmovq       %%xmm3,0x10(%1)               \n"
+      "vextracti128 $0x1,%%ymm2,0x18(%1)         \n"
+      "vextracti128 $0x1,%%ymm3,%%xmm3           \n"
+      "vmovq       %%xmm3,0x28(%1)               \n"
+      "lea         0x30(%1),%1                   \n"
+      "vbroadcastf128 %8,%%ymm2                  \n"
+      "vbroadcastf128 %9,%%ymm3                  \n"
+      "vpshufb     %%ymm2,%%ymm0,%%ymm2          \n"
+      "vpshufb     %%ymm3,%%ymm1,%%ymm3          \n"
+      "vpor        %%ymm3,%%ymm2,%%ymm2          \n"
+      "vbroadcastf128 %10,%%ymm3                 \n"
+      "vpshufb     %%ymm3,%%ymm0,%%ymm0          \n"
+      "vbroadcastf128 %11,%%ymm3                 \n"
+      "vpshufb     %%ymm3,%%ymm1,%%ymm1          \n"
+      "vpor        %%ymm1,%%ymm0,%%ymm0          \n"
+      "vbroadcastf128 %14,%%ymm3                 \n"
+      "vpmullw     %%ymm3,%%ymm2,%%ymm2          \n"
+      "vbroadcastf128 %15,%%ymm3                 \n"
+      "vpmullw     %%ymm3,%%ymm0,%%ymm0          \n"
+      "vpsrlw      $0x6,%%ymm2,%%ymm2            \n"
+      "vpsrlw      $0x6,%%ymm0,%%ymm0            \n"
+      "vmovq       %%xmm2,(%2)                   \n"
+      "vmovq       %%xmm0,0x00(%2,%3,1)          \n"
+      "vpextrd     $0x2,%%xmm2,0x08(%2)          \n"
+      "vpextrd     $0x2,%%xmm0,0x08(%2,%3,1)     \n"
+      "vextracti128 $0x1,%%ymm2,%%xmm2           \n"
+      "vextracti128 $0x1,%%ymm0,%%xmm0           \n"
+      "vmovq       %%xmm2,0x0c(%2)               \n"
+      "vmovq       %%xmm0,0x0c(%2,%3,1)          \n"
+      "vpextrd     $0x2,%%xmm2,0x14(%2)          \n"
+      "vpextrd     $0x2,%%xmm0,0x14(%2,%3,1)     \n"
+      "lea         0x18(%2),%2                   \n"
+      "sub         $0x18,%4                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-  : "+r"(src_y),   // %0
-    "+r"(dst_y),   // %1
-    "+r"(width),    // %2
-    "+r"(scale)     // %3
-  :
-  : "memory", "cc", "xmm0", "xmm1", "xmm3");
-  // clang-format on
+      : "+r"(src_v210),        // %0
+        "+r"(dst_y),           // %1
+        "+r"(dst_u),           // %2
+        "+r"(dst_v),           // %3
+        "+r"(width)            // %4
+      : "m"(kShuffleV210YA),   // %5
+        "m"(kShuffleV210YB),   // %6
+        "m"(kShuffleV210YC),   // %7
+        "m"(kShuffleV210UA),   // %8
+        "m"(kShuffleV210UB),   // %9
+        "m"(kShuffleV210VA),   // %10
+        "m"(kShuffleV210VB),   // %11
+        "m"(kMulV210YA),       // %12
+        "m"(kMulV210YC),       // %13
+        "m"(kMulV210U),        // %14
+        "m"(kMulV210V)         // %15
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_MULTIPLYROW_16_AVX2
+#endif  // HAS_V210TOI210ROW_AVX2
 
-// Use scale to convert lsb formats to msb, depending how many bits there are:
-// 32768 = 9 bits
-// 16384 = 10 bits
-// 4096 = 12 bits
-// 256 = 16 bits
-void Convert16To8Row_SSSE3(const uint16_t* src_y,
-                           uint8_t* dst_y,
-                           int scale,
-                           int width) {
-  // clang-format off
-  asm volatile (
-      "movd        %3,%%xmm2                     \n"
-      "punpcklwd   %%xmm2,%%xmm2                 \n"
-      "pshufd      $0x0,%%xmm2,%%xmm2            \n"
+#if defined(HAS_Y210TOI210ROW_SSSE3) || defined(HAS_Y210TOI210ROW_AVX2)
+// Y0 U0 Y1 V0 Y2 U1 Y3 V1 to Y0 Y1 Y2 Y3 U0 U1 V0 V1.
+static const uvec8 kShuffleY210 = {0u, 1u,  4u,  5u,  8u, 9u,  12u, 13u,
+                                   2u, 3u, 10u, 11u, 6u, 7u, 14u, 15u};
+#endif
 
-    // 32 pixels per loop.
-    LABELALIGN
+#ifdef HAS_Y210TOI210ROW_SSSE3
+void Y210ToI210Row_SSSE3(const uint16_t* src_y210,
+                         uint16_t* dst_y,
+                         uint16_t* dst_u,
+                         uint16_t* dst_v,
+                         int width) {
+  asm volatile(
+      "movdqa      %5,%%xmm4                     \n"
+      "sub         %2,%3                         \n"
+
+      // 8 pixels per loop.
+      LABELALIGN
       "1:                                        \n"
       "movdqu      (%0),%%xmm0                   \n"
       "movdqu      0x10(%0),%%xmm1               \n"
-      "add         $0x20,%0                      \n"
-      "pmulhuw     %%xmm2,%%xmm0                 \n"
-      "pmulhuw     %%xmm2,%%xmm1                 \n"
-      "packuswb    %%xmm1,%%xmm0                 \n"
+      "lea         0x20(%0),%0                   \n"
+      "psrlw       $0x6,%%xmm0                   \n"
+      "psrlw       $0x6,%%xmm1                   \n"
+      "pshufb      %%xmm4,%%xmm0                 \n"
+      "pshufb      %%xmm4,%%xmm1                 \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpcklqdq  %%xmm1,%%xmm0                 \n"
+      "punpckhqdq  %%xmm1,%%xmm2                 \n"
+      "pshufd      $0xd8,%%xmm2,%%xmm2           \n"
       "movdqu      %%xmm0,(%1)                   \n"
-      "add         $0x10,%1                      \n"
-      "sub         $0x10,%2                      \n"
+      "lea         0x10(%1),%1                   \n"
+      "movq        %%xmm2,(%2)                   \n"
+      "movhps      %%xmm2,0x00(%2,%3,1)          \n"
+      "lea         0x8(%2),%2                    \n"
+      "sub         $0x8,%4                       \n"
       "jg          1b                            \n"
-  : "+r"(src_y),   // %0
-    "+r"(dst_y),   // %1
-    "+r"(width)    // %2
-  : "r"(scale)     // %3
-  : "memory", "cc", "xmm0", "xmm1", "xmm2");
-  // clang-format on
+      : "+r"(src_y210),   // %0
+        "+r"(dst_y),      // %1
+        "+r"(dst_u),      // %2
+        "+r"(dst_v),      // %3
+        "+r"(width)       // %4
+      : "m"(kShuffleY210) // %5
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm4");
 }
+#endif  // HAS_Y210TOI210ROW_SSSE3
 
-#ifdef HAS_CONVERT16TO8ROW_AVX2
-void Convert16To8Row_AVX2(const uint16_t* src_y,
-                          uint8_t* dst_y,
-                          int scale,
-                          int width) {
-  // clang-format off
-  asm volatile (
-      "vmovd       %3,%%xmm2                     \n"
-      "vpunpcklwd  %%xmm2,%%xmm2,%%xmm2          \n"
-      "vbroadcastss %%xmm2,%%ymm2                \n"
+#ifdef HAS_Y210TOI210ROW_AVX2
+static const lvec32 kPermdY210UV = {0, 4, 2, 6, 1, 5, 3, 7};
 
-    // 32 pixels per loop.
-    LABELALIGN
+void Y210ToI210Row_AVX2(const uint16_t* src_y210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width) {
+  asm volatile(
+      "vbroadcastf128 %5,%%ymm4                  \n"
+      "vmovdqu     %6,%%ymm5                     \n"
+      "sub         %2,%3                         \n"
+
+      // 16 pixels per loop.
+      LABELALIGN
       "1:                                        \n"
       "vmovdqu     (%0),%%ymm0                   \n"
       "vmovdqu     0x20(%0),%%ymm1               \n"
-      "add         $0x40,%0                      \n"
-      "vpmulhuw    %%ymm2,%%ymm0,%%ymm0          \n"
-      "vpmulhuw    %%ymm2,%%ymm1,%%ymm1          \n"
-      "vpackuswb   %%ymm1,%%ymm0,%%ymm0          \n"  // mutates
+      "lea         0x40(%0),%0                   \n"
+      "vpsrlw      $0x6,%%ymm0,%%ymm0            \n"
+      "vpsrlw      $0x6,%%ymm1,%%ymm1            \n"
+      "vpshufb     %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpshufb     %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpunpckhqdq %%ymm1,%%ymm0,%%ymm2          \n"
+      "vpunpcklqdq %%ymm1,%%ymm0,%%ymm0          \n"
       "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vpermd      %%ymm2,%%ymm5,%%ymm2          \n"
       "vmovdqu     %%ymm0,(%1)                   \n"
-      "add         $0x20,%1                      \n"
-      "sub         $0x20,%2                      \n"
+      "lea         0x20(%1),%1                   \n"
+      "vmovdqu     %%xmm2,(%2)                   \n"
+      "vextracti128 $0x1,%%ymm2,0x00(%2,%3,1)    \n"
+      "lea         0x10(%2),%2                   \n"
+      "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-  : "+r"(src_y),   // %0
-    "+r"(dst_y),   // %1
-    "+r"(width)    // %2
-  : "r"(scale)     // %3
-  : "memory", "cc", "xmm0", "xmm1", "xmm2");
-  // clang-format on
+      : "+r"(src_y210),     // %0
+        "+r"(dst_y),        // %1
+        "+r"(dst_u),        // %2
+        "+r"(dst_v),        // %3
+        "+r"(width)         // %4
+      : "m"(kShuffleY210),  // %5
+        "m"(kPermdY210UV)   // %6
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm4", "xmm5");
+}
+#endif  // HAS_Y210TOI210ROW_AVX2
+
+#ifdef HAS_I210TOY210ROW_AVX2
+void I210ToY210Row_AVX2(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint16_t* dst_y210,
+                        int width) {
+  asm volatile(
+      "vpcmpeqb    %%ymm5,%%ymm5,%%ymm5          \n"  // 1023
+      "vpsrlw      $0x6,%%ymm5,%%ymm5            \n"
+      "sub         %1,%2                         \n"
+
+      // 16 pixels per loop.
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     (%1),%%xmm1                   \n"
+      "vmovdqu     0x00(%1,%2,1),%%xmm2          \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "vpunpckhwd  %%xmm2,%%xmm1,%%xmm3          \n"
+      "vpunpcklwd  %%xmm2,%%xmm1,%%xmm1          \n"
+      "vinserti128 $0x1,%%xmm3,%%ymm1,%%ymm1     \n"
+      "vpminuw     %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpminuw     %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpsllw      $0x6,%%ymm0,%%ymm0            \n"
+      "vpsllw      $0x6,%%ymm1,%%ymm1            \n"
+      "vpunpckhwd  %%ymm1,%%ymm0,%%ymm2          \n"
+      "vpunpcklwd  %%ymm1,%%ymm0,%%ymm0          \n"
+      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm1    \n"
+      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm0    \n"
+      "vmovdqu     %%ymm1,(%3)                   \n"
+      "vmovdqu     %%ymm0,0x20(%3)               \n"
+      "lea         0x40(%3),%3                   \n"
+      "sub         $0x10,%4                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_y210),  // %3
+        "+r"(width)      // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm5");
 }
-#endif  // HAS_CONVERT16TO8ROW_AVX2
+#endif  // HAS_I210TOY210ROW_AVX2
 
-// Use scale to convert to lsb formats depending how many bits there are:
-// 512 = 9 bits
-// 1024 = 10 bits
-// 4096 = 12 bits
-void Convert8To16Row_SSE2(const uint8_t* src_y,
-                          uint16_t* dst_y,
-                          int scale,
-                          int width) {
-  // clang-format off
-  asm volatile (
-      "movd        %3,%%xmm2                     \n"
-      "punpcklwd   %%xmm2,%%xmm2                 \n"
-      "pshufd      $0x0,%%xmm2,%%xmm2            \n"
+#ifdef HAS_Y410TOI410ROW_SSE2
+void Y410ToI410Row_SSE2(const uint8_t* src_y410,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width) {
+  asm volatile(
+      "pcmpeqb     %%xmm5,%%xmm5                 \n"  // 0x3ff
+      "psrld       $0x16,%%xmm5                  \n"
+      "sub         %1,%2                         \n"
+      "sub         %1,%3                         \n"
 
-    // 32 pixels per loop.
-    LABELALIGN
+      // 8 pixels per loop.
+      LABELALIGN
       "1:                                        \n"
       "movdqu      (%0),%%xmm0                   \n"
-      "movdqa      %%xmm0,%%xmm1                 \n"
-      "punpcklbw   %%xmm0,%%xmm0                 \n"
-      "punpckhbw   %%xmm1,%%xmm1                 \n"
-      "add         $0x10,%0                      \n"
-      "pmulhuw     %%xmm2,%%xmm0                 \n"
-      "pmulhuw     %%xmm2,%%xmm1                 \n"
-      "movdqu      %%xmm0,(%1)                   \n"
-      "movdqu      %%xmm1,0x10(%1)               \n"
-      "add         $0x20,%1                      \n"
-      "sub         $0x10,%2                      \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "lea         0x20(%0),%0                   \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "pand        %%xmm5,%%xmm2                 \n"
+      "pand        %%xmm5,%%xmm3                 \n"
+      "packssdw    %%xmm3,%%xmm2                 \n"
+      "movdqu      %%xmm2,0x00(%1,%2,1)          \n"  // U
+      "psrld       $0xa,%%xmm0                   \n"
+      "psrld       $0xa,%%xmm1                   \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "pand        %%xmm5,%%xmm2                 \n"
+      "pand        %%xmm5,%%xmm3                 \n"
+      "packssdw    %%xmm3,%%xmm2                 \n"
+      "movdqu      %%xmm2,(%1)                   \n"  // Y
+      "psrld       $0xa,%%xmm0                   \n"
+      "psrld       $0xa,%%xmm1                   \n"
+      "pand        %%xmm5,%%xmm0                 \n"
+      "pand        %%xmm5,%%xmm1                 \n"
+      "packssdw    %%xmm1,%%xmm0                 \n"
+      "movdqu      %%xmm0,0x00(%1,%3,1)          \n"  // V
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x8,%4                       \n"
       "jg          1b                            \n"
-  : "+r"(src_y),   // %0
-    "+r"(dst_y),   // %1
-    "+r"(width)    // %2
-  : "r"(scale)     // %3
-  : "memory", "cc", "xmm0", "xmm1", "xmm2");
-  // clang-format on
+      : "+r"(src_y410),  // %0
+        "+r"(dst_y),     // %1
+        "+r"(dst_u),     // %2
+        "+r"(dst_v),     // %3
+        "+r"(width)      // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm5");
 }
+#endif  // HAS_Y410TOI410ROW_SSE2
 
-#ifdef HAS_CONVERT8TO16ROW_AVX2
-void Convert8To16Row_AVX2(const uint8_t* src_y,
-                          uint16_t* dst_y,
-                          int scale,
-                          int width) {
-  // clang-format off
-  asm volatile (
-      "vmovd       %3,%%xmm2                     \n"
-      "vpunpcklwd  %%xmm2,%%xmm2,%%xmm2          \n"
-      "vbroadcastss %%xmm2,%%ymm2                \n"
+#ifdef HAS_Y410TOI410ROW_AVX2
+void Y410ToI410Row_AVX2(const uint8_t* src_y410,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width) {
+  asm volatile(
+      "vpcmpeqb    %%ymm5,%%ymm5,%%ymm5          \n"  // 0x3ff
+      "vpsrld      $0x16,%%ymm5,%%ymm5           \n"
+      "sub         %1,%2                         \n"
+      "sub         %1,%3                         \n"
 
-    // 32 pixels per loop.
-    LABELALIGN
+      // 16 pixels per loop.
+      LABELALIGN
       "1:                                        \n"
       "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "lea         0x40(%0),%0                   \n"
+      "vpand       %%ymm5,%%ymm0,%%ymm2          \n"
+      "vpand       %%ymm5,%%ymm1,%%ymm3          \n"
+      "vpackssdw   %%ymm3,%%ymm2,%%ymm2          \n"
+      "vpermq      $0xd8,%%ymm2,%%ymm2           \n"
+      "vmovdqu     %%ymm2,0x00(%1,%2,1)          \n"  // U
+      "vpsrld      $0xa,%%ymm0,%%ymm0            \n"
+      "vpsrld      $0xa,%%ymm1,%%ymm1            \n"
+      "vpand       %%ymm5,%%ymm0,%%ymm2          \n"
+      "vpand       %%ymm5,%%ymm1,%%ymm3          \n"
+      "vpackssdw   %%ymm3,%%ymm2,%%ymm2          \n"
+      "vpermq      $0xd8,%%ymm2,%%ymm2           \n"
+      "vmovdqu     %%ymm2,(%1)                   \n"  // Y
+      "vpsrld      $0xa,%%ymm0,%%ymm0            \n"
+      "vpsrld      $0xa,%%ymm1,%%ymm1            \n"
+      "vpand       %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpand       %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpackssdw   %%ymm1,%%ymm0,%%ymm0          \n"
       "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
-      "add         $0x20,%0                      \n"
-      "vpunpckhbw  %%ymm0,%%ymm0,%%ymm1          \n"
-      "vpunpcklbw  %%ymm0,%%ymm0,%%ymm0          \n"
-      "vpmulhuw    %%ymm2,%%ymm0,%%ymm0          \n"
-      "vpmulhuw    %%ymm2,%%ymm1,%%ymm1          \n"
-      "vmovdqu     %%ymm0,(%1)                   \n"
-      "vmovdqu     %%ymm1,0x20(%1)               \n"
-      "add         $0x40,%1                      \n"
-      "sub         $0x20,%2                      \n"
+      "vmovdqu     %%ymm0,0x00(%1,%3,1)          \n"  // V
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-  : "+r"(src_y),   // %0
-    "+r"(dst_y),   // %1
-    "+r"(width)    // %2
-  : "r"(scale)     // %3
-  : "memory", "cc", "xmm0", "xmm1", "xmm2");
-  // clang-format on
+      : "+r"(src_y410),  // %0
+        "+r"(dst_y),     // %1
+        "+r"(dst_u),     // %2
+        "+r"(dst_v),     // %3
+        "+r"(width)      // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm5");
 }
-#endif  // HAS_CONVERT8TO16ROW_AVX2
-
-#ifdef HAS_SPLITRGBROW_SSSE3
-// Shuffle table for converting RGB to Planar.
-static const uvec8 kSplitRGBShuffle[9] = {
-    {0u, 3u, 6u, 9u, 12u, 15u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u,
-     128u, 128u},
-    {128u, 128u, 128u, 128u, 128u, 128u, 2u, 5u, 8u, 11u, 14u, 128u, 128u, 128u,
-     128u, 128u},
-    {128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 1u, 4u,
-     7u, 10u, 13u},
-    {1u, 4u, 7u, 10u, 13u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u,
-     128u, 128u},
-    {128u, 128u, 128u, 128u, 128u, 0u, 3u, 6u, 9u, 12u, 15u, 128u, 128u, 128u,
-     128u, 128u},
-    {128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 2u, 5u,
-     8u, 11u, 14u},
-    {2u, 5u, 8u, 11u, 14u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u,
-     128u, 128u},
-    {128u, 128u, 128u, 128u, 128u, 1u, 4u, 7u, 10u, 13u, 128u, 128u, 128u, 128u,
-     128u, 128u},
-    {128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 0u, 3u, 6u, 9u,
-     12u, 15u}};
+#endif  // HAS_Y410TOI410ROW_AVX2
 
-void SplitRGBRow_SSSE3(const uint8_t* src_rgb,
-                       uint8_t* dst_r,
-                       uint8_t* dst_g,
-                       uint8_t* dst_b,
-                       int width) {
+#ifdef HAS_I410TOY410ROW_AVX2
+void I410ToY410Row_AVX2(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint8_t* dst_y410,
+                        int width) {
   asm volatile(
+      "vpcmpeqb    %%ymm4,%%ymm4,%%ymm4          \n"  // 0xc0000000
+      "vpslld      $0x1e,%%ymm4,%%ymm4           \n"
+      "vpcmpeqb    %%ymm5,%%ymm5,%%ymm5          \n"  // 1023
+      "vpsrld      $0x16,%%ymm5,%%ymm5           \n"
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
 
+      // 8 pixels per loop.
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      0x10(%0),%%xmm1               \n"
-      "movdqu      0x20(%0),%%xmm2               \n"
-      "pshufb      0(%5), %%xmm0                 \n"
-      "pshufb      16(%5), %%xmm1                \n"
-      "pshufb      32(%5), %%xmm2                \n"
-      "por         %%xmm1,%%xmm0                 \n"
-      "por         %%xmm2,%%xmm0                 \n"
-      "movdqu      %%xmm0,(%1)                   \n"
+      "vpmovzxwd   (%0),%%ymm0                   \n"
+      "vpmovzxwd   0x00(%0,%1,1),%%ymm1          \n"
+      "vpmovzxwd   0x00(%0,%2,1),%%ymm2          \n"
+      "lea         0x10(%0),%0                   \n"
+      "vpminud     %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpminud     %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpminud     %%ymm5,%%ymm2,%%ymm2          \n"
+      "vpslld      $0xa,%%ymm0,%%ymm0            \n"
+      "vpslld      $0x14,%%ymm2,%%ymm2           \n"
+      "vpor        %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpor        %%ymm4,%%ymm2,%%ymm2          \n"
+      "vpor        %%ymm2,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,(%3)                   \n"
+      "lea         0x20(%3),%3                   \n"
+      "sub         $0x8,%4                       \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_y410),  // %3
+        "+r"(width)      // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm4", "xmm5");
+}
+#endif  // HAS_I410TOY410ROW_AVX2
+
+#if defined(HAS_BAYERROWTOARGBROW_SSE2) || defined(HAS_BAYERROWTOARGBROW_AVX2)
+// Selects the lanes that hold the row's own R or B sample.
+static const uvec8 kBayerSiteMask[2] = {
+    {255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u,
+     255u, 0u},
+    {0u, 255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u, 255u, 0u,
+     255u}};
+// All ones when the row holds B, so R and B are exchanged before storing.
+static const uvec8 kBayerSwapMask[2] = {
+    {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u},
+    {255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u, 255u,
+     255u, 255u, 255u, 255u}};
+#endif
+
+#ifdef HAS_BAYERROWTOARGBROW_SSE2
+void BayerRowToARGBRow_SSE2(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2,
+                            uint8_t* dst_argb,
+                            int layout,
+                            int width) {
+  asm volatile(
+      "movdqa      %5,%%xmm6                     \n"
+      "movdqa      %6,%%xmm7                     \n"
+      "sub         %1,%0                         \n"
+      "sub         %1,%2                         \n"
+
+      // 16 pixels per loop.
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      -0x1(%1,%0,1),%%xmm4          \n"  // diagonals
+      "movdqu      0x1(%1,%0,1),%%xmm5           \n"
+      "pavgb       %%xmm5,%%xmm4                 \n"
+      "movdqu      -0x1(%1,%2,1),%%xmm5          \n"
+      "movdqu      0x1(%1,%2,1),%%xmm0           \n"
+      "pavgb       %%xmm0,%%xmm5                 \n"
+      "pavgb       %%xmm4,%%xmm5                 \n"
+      "movdqu      -0x1(%1),%%xmm1               \n"  // left and right
+      "movdqu      0x1(%1),%%xmm0                \n"
+      "pavgb       %%xmm0,%%xmm1                 \n"
+      "movdqu      0x00(%1,%0,1),%%xmm2          \n"  // above and below
+      "movdqu      0x00(%1,%2,1),%%xmm0          \n"
+      "pavgb       %%xmm0,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"  // 4 neighbours
+      "pavgb       %%xmm2,%%xmm3                 \n"
+      "movdqu      (%1),%%xmm0                   \n"  // center
       "lea         0x10(%1),%1                   \n"
 
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      0x10(%0),%%xmm1               \n"
-      "movdqu      0x20(%0),%%xmm2               \n"
-      "pshufb      48(%5),%%xmm0                 \n"
-      "pshufb      64(%5),%%xmm1                 \n"
-      "pshufb      80(%5), %%xmm2                \n"
-      "por         %%xmm1,%%xmm0                 \n"
-      "por         %%xmm2,%%xmm0                 \n"
-      "movdqu      %%xmm0,(%2)                   \n"
-      "lea         0x10(%2),%2                   \n"
+      // Pick by site: own color, G and other color.
+      "movdqa      %%xmm0,%%xmm4                 \n"
+      "pxor        %%xmm1,%%xmm4                 \n"
+      "pand        %%xmm6,%%xmm4                 \n"
+      "pxor        %%xmm4,%%xmm1                 \n"
+      "pxor        %%xmm0,%%xmm3                 \n"
+      "pand        %%xmm6,%%xmm3                 \n"
+      "pxor        %%xmm0,%%xmm3                 \n"
+      "pxor        %%xmm2,%%xmm5                 \n"
+      "pand        %%xmm6,%%xmm5                 \n"
+      "pxor        %%xmm2,%%xmm5                 \n"
+      "movdqa      %%xmm1,%%xmm0                 \n"  // R in xmm1, B in xmm5
+      "pxor        %%xmm5,%%xmm0                 \n"
+      "pand        %%xmm7,%%xmm0                 \n"
+      "pxor        %%xmm0,%%xmm1                 \n"
+      "pxor        %%xmm0,%%xmm5                 \n"
 
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      0x10(%0),%%xmm1               \n"
-      "movdqu      0x20(%0),%%xmm2               \n"
-      "pshufb      96(%5), %%xmm0                \n"
-      "pshufb      112(%5), %%xmm1               \n"
-      "pshufb      128(%5), %%xmm2               \n"
-      "por         %%xmm1,%%xmm0                 \n"
-      "por         %%xmm2,%%xmm0                 \n"
+      // Weave into ARGB.
+      "pcmpeqb     %%xmm2,%%xmm2                 \n"
+      "movdqa      %%xmm5,%%xmm0                 \n"
+      "punpcklbw   %%xmm3,%%xmm0                 \n"
+      "punpckhbw   %%xmm3,%%xmm5                 \n"
+      "movdqa      %%xmm1,%%xmm4                 \n"
+      "punpcklbw   %%xmm2,%%xmm4                 \n"
+      "punpckhbw   %%xmm2,%%xmm1                 \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpcklwd   %%xmm4,%%xmm0                 \n"
+      "punpckhwd   %%xmm4,%%xmm2                 \n"
+      "movdqa      %%xmm5,%%xmm4                 \n"
+      "punpcklwd   %%xmm1,%%xmm5                 \n"
+      "punpckhwd   %%xmm1,%%xmm4                 \n"
       "movdqu      %%xmm0,(%3)                   \n"
-      "lea         0x10(%3),%3                   \n"
-      "lea         0x30(%0),%0                   \n"
+      "movdqu      %%xmm2,0x10(%3)               \n"
+      "movdqu      %%xmm5,0x20(%3)               \n"
+      "movdqu      %%xmm4,0x30(%3)               \n"
+      "lea         0x40(%3),%3                   \n"
       "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
-      : "+r"(src_rgb),             // %0
-        "+r"(dst_r),               // %1
-        "+r"(dst_g),               // %2
-        "+r"(dst_b),               // %3
-        "+r"(width)                // %4
-      : "r"(&kSplitRGBShuffle[0])  // %5
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      : "+r"(src_bayer0),                      // %0
+        "+r"(src_bayer1),                      // %1
+        "+r"(src_bayer2),                      // %2
+        "+r"(dst_argb),                        // %3
+        "+r"(width)                            // %4
+      : "m"(kBayerSiteMask[layout & 1]),       // %5
+        "m"(kBayerSwapMask[(layout >> 1) & 1])  // %6
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_SPLITRGBROW_SSSE3
-
-#ifdef HAS_MERGERGBROW_SSSE3
-// Shuffle table for converting Planar to RGB.
-static const uvec8 kMergeRGBShuffle[9] = {
-    {0u, 128u, 128u, 1u, 128u, 128u, 2u, 128u, 128u, 3u, 128u, 128u, 4u, 128u,
-     128u, 5u},
-    {128u, 0u, 128u, 128u, 1u, 128u, 128u, 2u, 128u, 128u, 3u, 128u, 128u, 4u,
-     128u, 128u},
-    {128u, 128u, 0u, 128u, 128u, 1u, 128u, 128u, 2u, 128u, 128u, 3u, 128u, 128u,
-     4u, 128u},
-    {128u, 128u, 6u, 128u, 128u, 7u, 128u, 128u, 8u, 128u, 128u, 9u, 128u, 128u,
-     10u, 128u},
-    {5u, 128u, 128u, 6u, 128u, 128u, 7u, 128u, 128u, 8u, 128u, 128u, 9u, 128u,
-     128u, 10u},
-    {128u, 5u, 128u, 128u, 6u, 128u, 128u, 7u, 128u, 128u, 8u, 128u, 128u, 9u,
-     128u, 128u},
-    {128u, 11u, 128u, 128u, 12u, 128u, 128u, 13u, 128u, 128u, 14u, 128u, 128u,
-     15u, 128u, 128u},
-    {128u, 128u, 11u, 128u, 128u, 12u, 128u, 128u, 13u, 128u, 128u, 14u, 128u,
-     128u, 15u, 128u},
-    {10u, 128u, 128u, 11u, 128u, 128u, 12u, 128u, 128u, 13u, 128u, 128u, 14u,
-     128u, 128u, 15u}};
+#endif  // HAS_BAYERROWTOARGBROW_SSE2
 
-void MergeRGBRow_SSSE3(const uint8_t* src_r,
-                       const uint8_t* src_g,
-                       const uint8_t* src_b,
-                       uint8_t* dst_rgb,
-                       int width) {
+#ifdef HAS_BAYERROWTOARGBROW_AVX2
+void BayerRowToARGBRow_AVX2(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2,
+                            uint8_t* dst_argb,
+                            int layout,
+                            int width) {
   asm volatile(
+      "vbroadcastf128 %5,%%ymm6                  \n"
+      "vbroadcastf128 %6,%%ymm7                  \n"
+      "sub         %1,%0                         \n"
+      "sub         %1,%2                         \n"
 
+      // 32 pixels per loop.
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      (%1),%%xmm1                   \n"
-      "movdqu      (%2),%%xmm2                   \n"
-      "pshufb      (%5), %%xmm0                  \n"
-      "pshufb      16(%5), %%xmm1                \n"
-      "pshufb      32(%5), %%xmm2                \n"
-      "por         %%xmm1,%%xmm0                 \n"
-      "por         %%xmm2,%%xmm0                 \n"
-      "movdqu      %%xmm0,(%3)                   \n"
-
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      (%1),%%xmm1                   \n"
-      "movdqu      (%2),%%xmm2                   \n"
-      "pshufb      48(%5), %%xmm0                \n"
-      "pshufb      64(%5), %%xmm1                \n"
-      "pshufb      80(%5), %%xmm2                \n"
-      "por         %%xmm1,%%xmm0                 \n"
-      "por         %%xmm2,%%xmm0                 \n"
-      "movdqu      %%xmm0,16(%3)                 \n"
-
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      (%1),%%xmm1                   \n"
-      "movdqu      (%2),%%xmm2                   \n"
-      "pshufb      96(%5), %%xmm0                \n"
-      "pshufb      112(%5), %%xmm1               \n"
-      "pshufb      128(%5), %%xmm2               \n"
-      "por         %%xmm1,%%xmm0                 \n"
-      "por         %%xmm2,%%xmm0                 \n"
-      "movdqu      %%xmm0,32(%3)                 \n"
+      "vmovdqu     -0x1(%1,%0,1),%%ymm4          \n"  // diagonals
+      "vpavgb      0x1(%1,%0,1),%%ymm4,%%ymm4    \n"
+      "vmovdqu     -0x1(%1,%2,1),%%ymm5          \n"
+      "vpavgb      0x1(%1,%2,1),%%ymm5,%%ymm5    \n"
+      "vpavgb      %%ymm4,%%ymm5,%%ymm5          \n"
+      "vmovdqu     -0x1(%1),%%ymm1               \n"  // left and right
+      "vpavgb      0x1(%1),%%ymm1,%%ymm1         \n"
+      "vmovdqu     0x00(%1,%0,1),%%ymm2          \n"  // above and below
+      "vpavgb      0x00(%1,%2,1),%%ymm2,%%ymm2   \n"
+      "vpavgb      %%ymm2,%%ymm1,%%ymm3          \n"  // 4 neighbours
+      "vmovdqu     (%1),%%ymm0                   \n"  // center
+      "lea         0x20(%1),%1                   \n"
 
-      "lea         0x10(%0),%0                   \n"
-      "lea         0x10(%1),%1                   \n"
-      "lea         0x10(%2),%2                   \n"
-      "lea         0x30(%3),%3                   \n"
-      "sub         $0x10,%4                      \n"
+      // Pick by site: own color, G and other color.
+      "vpxor       %%ymm1,%%ymm0,%%ymm4          \n"
+      "vpand       %%ymm6,%%ymm4,%%ymm4          \n"
+      "vpxor       %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm0,%%ymm3,%%ymm3          \n"
+      "vpand       %%ymm6,%%ymm3,%%ymm3          \n"
+      "vpxor       %%ymm0,%%ymm3,%%ymm3          \n"
+      "vpxor       %%ymm2,%%ymm5,%%ymm5          \n"
+      "vpand       %%ymm6,%%ymm5,%%ymm5          \n"
+      "vpxor       %%ymm2,%%ymm5,%%ymm5          \n"
+      "vpxor       %%ymm5,%%ymm1,%%ymm0          \n"  // R in ymm1, B in ymm5
+      "vpand       %%ymm7,%%ymm0,%%ymm0          \n"
+      "vpxor       %%ymm0,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm0,%%ymm5,%%ymm5          \n"
+
+      // Weave into ARGB.
+      "vpermq      $0xd8,%%ymm1,%%ymm1           \n"
+      "vpermq      $0xd8,%%ymm3,%%ymm3           \n"
+      "vpermq      $0xd8,%%ymm5,%%ymm5           \n"
+      "vpcmpeqb    %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpunpcklbw  %%ymm3,%%ymm5,%%ymm0          \n"  // BG 0..15
+      "vpunpckhbw  %%ymm3,%%ymm5,%%ymm5          \n"  // BG 16..31
+      "vpunpcklbw  %%ymm2,%%ymm1,%%ymm4          \n"  // RA 0..15
+      "vpunpckhbw  %%ymm2,%%ymm1,%%ymm1          \n"  // RA 16..31
+      "vpunpcklwd  %%ymm4,%%ymm0,%%ymm2          \n"  // 0..3, 8..11
+      "vpunpckhwd  %%ymm4,%%ymm0,%%ymm0          \n"  // 4..7, 12..15
+      "vpunpcklwd  %%ymm1,%%ymm5,%%ymm4          \n"  // 16..19, 24..27
+      "vpunpckhwd  %%ymm1,%%ymm5,%%ymm5          \n"  // 20..23, 28..31
+      "vperm2i128  $0x20,%%ymm0,%%ymm2,%%ymm1    \n"
+      "vperm2i128  $0x31,%%ymm0,%%ymm2,%%ymm2    \n"
+      "vperm2i128  $0x20,%%ymm5,%%ymm4,%%ymm3    \n"
+      "vperm2i128  $0x31,%%ymm5,%%ymm4,%%ymm4    \n"
+      "vmovdqu     %%ymm1,(%3)                   \n"
+      "vmovdqu     %%ymm2,0x20(%3)               \n"
+      "vmovdqu     %%ymm3,0x40(%3)               \n"
+      "vmovdqu     %%ymm4,0x60(%3)               \n"
+      "lea         0x80(%3),%3                   \n"
+      "sub         $0x20,%4                      \n"
       "jg          1b                            \n"
-      : "+r"(src_r),               // %0
-        "+r"(src_g),               // %1
-        "+r"(src_b),               // %2
-        "+r"(dst_rgb),             // %3
-        "+r"(width)                // %4
-      : "r"(&kMergeRGBShuffle[0])  // %5
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      "vzeroupper                                \n"
+      : "+r"(src_bayer0),                      // %0
+        "+r"(src_bayer1),                      // %1
+        "+r"(src_bayer2),                      // %2
+        "+r"(dst_argb),                        // %3
+        "+r"(width)                            // %4
+      : "m"(kBayerSiteMask[layout & 1]),       // %5
+        "m"(kBayerSwapMask[(layout >> 1) & 1])  // %6
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_MERGERGBROW_SSSE3
-
-#ifdef HAS_MERGEARGBROW_SSE2
-void MergeARGBRow_SSE2(const uint8_t* src_r,
-                       const uint8_t* src_g,
-                       const uint8_t* src_b,
-                       const uint8_t* src_a,
-                       uint8_t* dst_argb,
-                       int width) {
-  asm volatile(
+#endif  // HAS_BAYERROWTOARGBROW_AVX2
 
+// Use scale to convert lsb formats to msb, depending how many bits there are:
+// 128 = 9 bits
+// 64 = 10 bits
+// 16 = 12 bits
+// 1 = 16 bits
+#ifdef HAS_MULTIPLYROW_16_AVX2
+void MultiplyRow_16_AVX2(const uint16_t* src_y,
+                         uint16_t* dst_y,
+                         int scale,
+                         int width) {
+  // clang-format off
+  asm volatile (
+      "vmovd       %3,%%xmm3                     \n"
+      "vpunpcklwd  %%xmm3,%%xmm3,%%xmm3          \n"
+      "vbroadcastss %%xmm3,%%ymm3                \n"
       "sub         %0,%1                         \n"
-      "sub         %0,%2                         \n"
-      "sub         %0,%3                         \n"
 
-      LABELALIGN
+    // 32 pixels per loop.
+    LABELALIGN
       "1:                                        \n"
-
-      "movq        (%0,%2),%%xmm0                \n"  // B
-      "movq        (%0),%%xmm1                   \n"  // R
-      "movq        (%0,%1),%%xmm2                \n"  // G
-      "punpcklbw   %%xmm1,%%xmm0                 \n"  // BR
-      "movq        (%0,%3),%%xmm1                \n"  // A
-      "punpcklbw   %%xmm1,%%xmm2                 \n"  // GA
-      "movdqa      %%xmm0,%%xmm1                 \n"  // BR
-      "punpckhbw   %%xmm2,%%xmm1                 \n"  // BGRA (hi)
-      "punpcklbw   %%xmm2,%%xmm0                 \n"  // BGRA (lo)
-      "movdqu      %%xmm0,(%4)                   \n"
-      "movdqu      %%xmm1,16(%4)                 \n"
-
-      "lea         8(%0),%0                      \n"
-      "lea         32(%4),%4                     \n"
-      "sub         $0x8,%5                       \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "vpmullw     %%ymm3,%%ymm0,%%ymm0          \n"
+      "vpmullw     %%ymm3,%%ymm1,%%ymm1          \n"
+      "vmovdqu     %%ymm0,(%0,%1)                \n"
+      "vmovdqu     %%ymm1,0x20(%0,%1)            \n"
+      "add         $0x40,%0                      \n"
+      "sub         $0x20,%2                      \n"
       "jg          1b                            \n"
-      : "+r"(src_r),     // %0
-        "+r"(src_g),     // %1
-        "+r"(src_b),     // %2
-        "+r"(src_a),     // %3
-        "+r"(dst_argb),  // %4
-        "+r"(width)      // %5
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      "vzeroupper                                \n"
+  : "+r"(src_y),   // %0
+    "+r"(dst_y),   // %1
+    "+r"(width)    // %2
+  : "r"(scale)     // %3
+  : "memory", "cc", "xmm0", "xmm1", "xmm3");
+  // clang-format on
 }
-#endif
+#endif  // HAS_MULTIPLYROW_16_AVX2
 
-#ifdef HAS_MERGEXRGBROW_SSE2
-void MergeXRGBRow_SSE2(const uint8_t* src_r,
-                       const uint8_t* src_g,
-                       const uint8_t* src_b,
-                       uint8_t* dst_argb,
+// Use scale to convert msb formats to lsb, depending how many bits there are:
+// 512 = 9 bits
+// 1024 = 10 bits
+// 4096 = 12 bits
+// 65536 = 16 bits
+#ifdef HAS_DIVIDEROW_16_AVX2
+void DivideRow_16_AVX2(const uint16_t* src_y,
+                       uint16_t* dst_y,
+                       int scale,
                        int width) {
-  asm volatile(
+  // clang-format off
+  asm volatile (
+      "vmovd       %3,%%xmm3                     \n"
+      "vpunpcklwd  %%xmm3,%%xmm3,%%xmm3          \n"
+      "vbroadcastss %%xmm3,%%ymm3                \n"
+      "sub         %0,%1                         \n"
 
-      LABELALIGN
+    // 32 pixels per loop.
+    LABELALIGN
       "1:                                        \n"
-
-      "movq        (%2),%%xmm0                   \n"  // B
-      "movq        (%0),%%xmm1                   \n"  // R
-      "movq        (%1),%%xmm2                   \n"  // G
-      "punpcklbw   %%xmm1,%%xmm0                 \n"  // BR
-      "pcmpeqd     %%xmm1,%%xmm1                 \n"  // A(255)
-      "punpcklbw   %%xmm1,%%xmm2                 \n"  // GA
-      "movdqa      %%xmm0,%%xmm1                 \n"  // BR
-      "punpckhbw   %%xmm2,%%xmm1                 \n"  // BGRA (hi)
-      "punpcklbw   %%xmm2,%%xmm0                 \n"  // BGRA (lo)
-      "movdqu      %%xmm0,(%3)                   \n"
-      "movdqu      %%xmm1,16(%3)                 \n"
-
-      "lea         8(%0),%0                      \n"
-      "lea         8(%1),%1                      \n"
-      "lea         8(%2),%2                      \n"
-      "lea         32(%3),%3                     \n"
-      "sub         $0x8,%4                       \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "vpmulhuw    %%ymm3,%%ymm0,%%ymm0          \n"
+      "vpmulhuw    %%ymm3,%%ymm1,%%ymm1          \n"
+      "vmovdqu     %%ymm0,(%0,%1)                \n"
+      "vmovdqu     %%ymm1,0x20(%0,%1)            \n"
+      "add         $0x40,%0                      \n"
+      "sub         $0x20,%2                      \n"
       "jg          1b                            \n"
-      : "+r"(src_r),     // %0
-        "+r"(src_g),     // %1
-        "+r"(src_b),     // %2
-        "+r"(dst_argb),  // %3
-        "+r"(width)      // %4
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      "vzeroupper                                \n"
+  : "+r"(src_y),   // %0
+    "+r"(dst_y),   // %1
+    "+r"(width),    // %2
+    "+r"(scale)     // %3
+  :
+  : "memory", "cc", "xmm0", "xmm1", "xmm3");
+  // clang-format on
 }
-#endif  // HAS_MERGEARGBROW_SSE2
-
-#ifdef HAS_MERGEARGBROW_AVX2
-void MergeARGBRow_AVX2(const uint8_t* src_r,
-                       const uint8_t* src_g,
-                       const uint8_t* src_b,
-                       const uint8_t* src_a,
-                       uint8_t* dst_argb,
-                       int width) {
-  asm volatile(
+#endif  // HAS_MULTIPLYROW_16_AVX2
 
-      "sub         %0,%1                         \n"
-      "sub         %0,%2                         \n"
-      "sub         %0,%3                         \n"
+// Use scale to convert lsb formats to msb, depending how many bits there are:
+// 32768 = 9 bits
+// 16384 = 10 bits
+// 4096 = 12 bits
+// 256 = 16 bits
+void Convert16To8Row_SSSE3(const uint16_t* src_y,
+                           uint8_t* dst_y,
+                           int scale,
+                           int width) {
+  // clang-format off
+  asm volatile (
+      "movd        %3,%%xmm2                     \n"
+      "punpcklwd   %%xmm2,%%xmm2                 \n"
+      "pshufd      $0x0,%%xmm2,%%xmm2            \n"
 
-      LABELALIGN
+    // 32 pixels per loop.
+    LABELALIGN
       "1:                                        \n"
-
-      "vmovdqu     (%0,%2),%%xmm0                \n"  // B
-      "vmovdqu     (%0,%1),%%xmm1                \n"  // R
-      "vinserti128 $1,(%0),%%ymm0,%%ymm0         \n"  // G
-      "vinserti128 $1,(%0,%3),%%ymm1,%%ymm1      \n"  // A
-      "vpunpckhbw  %%ymm1,%%ymm0,%%ymm2          \n"
-      "vpunpcklbw  %%ymm1,%%ymm0,%%ymm0          \n"
-      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
-      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
-      "vpunpckhwd  %%ymm1,%%ymm0,%%ymm2          \n"
-      "vpunpcklwd  %%ymm1,%%ymm0,%%ymm0          \n"
-      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
-      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
-      "vmovdqu     %%ymm0,(%4)                   \n"  // First 8
-      "vmovdqu     %%ymm1,32(%4)                 \n"  // Next 8
-
-      "lea         16(%0),%0                     \n"
-      "lea         64(%4),%4                     \n"
-      "sub         $0x10,%5                      \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "add         $0x20,%0                      \n"
+      "pmulhuw     %%xmm2,%%xmm0                 \n"
+      "pmulhuw     %%xmm2,%%xmm1                 \n"
+      "packuswb    %%xmm1,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "add         $0x10,%1                      \n"
+      "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_r),     // %0
-        "+r"(src_g),     // %1
-        "+r"(src_b),     // %2
-        "+r"(src_a),     // %3
-        "+r"(dst_argb),  // %4
-        "+r"(width)      // %5
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+  : "+r"(src_y),   // %0
+    "+r"(dst_y),   // %1
+    "+r"(width)    // %2
+  : "r"(scale)     // %3
+  : "memory", "cc", "xmm0", "xmm1", "xmm2");
+  // clang-format on
 }
-#endif
 
-#ifdef HAS_MERGEXRGBROW_AVX2
-void MergeXRGBRow_AVX2(const uint8_t* src_r,
-                       const uint8_t* src_g,
-                       const uint8_t* src_b,
-                       uint8_t* dst_argb,
-                       int width) {
-  asm volatile(
+#ifdef HAS_CONVERT16TO8ROW_AVX2
+void Convert16To8Row_AVX2(const uint16_t* src_y,
+                          uint8_t* dst_y,
+                          int scale,
+                          int width) {
+  // clang-format off
+  asm volatile (
+      "vmovd       %3,%%xmm2                     \n"
+      "vpunpcklwd  %%xmm2,%%xmm2,%%xmm2          \n"
+      "vbroadcastss %%xmm2,%%ymm2                \n"
 
-      LABELALIGN
+    // 32 pixels per loop.
+    LABELALIGN
       "1:                                        \n"
-
-      "vmovdqu     (%2),%%xmm0                   \n"  // B
-      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"  // A(255)
-      "vinserti128 $0,(%1),%%ymm1,%%ymm1         \n"  // R
-      "vinserti128 $1,(%0),%%ymm0,%%ymm0         \n"  // G
-      "vpunpckhbw  %%ymm1,%%ymm0,%%ymm2          \n"
-      "vpunpcklbw  %%ymm1,%%ymm0,%%ymm0          \n"
-      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
-      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
-      "vpunpckhwd  %%ymm1,%%ymm0,%%ymm2          \n"
-      "vpunpcklwd  %%ymm1,%%ymm0,%%ymm0          \n"
-      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
-      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
-      "vmovdqu     %%ymm0,(%3)                   \n"  // First 8
-      "vmovdqu     %%ymm1,32(%3)                 \n"  // Next 8
-
-      "lea         16(%0),%0                     \n"
-      "lea         16(%1),%1                     \n"
-      "lea         16(%2),%2                     \n"
-      "lea         64(%3),%3                     \n"
-      "sub         $0x10,%4                      \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "add         $0x40,%0                      \n"
+      "vpmulhuw    %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpmulhuw    %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpackuswb   %%ymm1,%%ymm0,%%ymm0          \n"  // mutates
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "add         $0x20,%1                      \n"
+      "sub         $0x20,%2                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_r),     // %0
-        "+r"(src_g),     // %1
-        "+r"(src_b),     // %2
-        "+r"(dst_argb),  // %3
-        "+rm"(width)     // %4
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+  : "+r"(src_y),   // %0
+    "+r"(dst_y),   // %1
+    "+r"(width)    // %2
+  : "r"(scale)     // %3
+  : "memory", "cc", "xmm0", "xmm1", "xmm2");
+  // clang-format on
 }
-#endif  // HAS_MERGEARGBROW_AVX2
-
-#ifdef HAS_SPLITARGBROW_SSE2
-void SplitARGBRow_SSE2(const uint8_t* src_argb,
-                       uint8_t* dst_r,
-                       uint8_t* dst_g,
-                       uint8_t* dst_b,
-                       uint8_t* dst_a,
-                       int width) {
-  asm volatile(
+#endif  // HAS_CONVERT16TO8ROW_AVX2
 
-      "sub         %1,%2                         \n"
-      "sub         %1,%3                         \n"
-      "sub         %1,%4                         \n"
+// Use scale to convert to lsb formats depending how many bits there are:
+// 512 = 9 bits
+// 1024 = 10 bits
+// 4096 = 12 bits
+void Convert8To16Row_SSE2(const uint8_t* src_y,
+                          uint16_t* dst_y,
+                          int scale,
+                          int width) {
+  // clang-format off
+  asm volatile (
+      "movd        %3,%%xmm2                     \n"
+      "punpcklwd   %%xmm2,%%xmm2                 \n"
+      "pshufd      $0x0,%%xmm2,%%xmm2            \n"
 
-      LABELALIGN
+    // 32 pixels per loop.
+    LABELALIGN
       "1:                                        \n"
-
-      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
-      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 00-07 10-17
-      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 08-0F 18-1F
-      "movdqa      %%xmm0,%%xmm1                 \n"
-      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 08192A3B4C5D6E7F (lo)
-      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 08192A3B4C5D6E7F (hi)
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 08192A3B08192A3B
-      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 4C5D6E7F4C5D6E7F
+      "movdqu      (%0),%%xmm0                   \n"
       "movdqa      %%xmm0,%%xmm1                 \n"
-      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
-      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
-      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
-      "movlps      %%xmm0,(%1,%3)                \n"  // B
-      "movhps      %%xmm0,(%1,%2)                \n"  // G
-      "movlps      %%xmm2,(%1)                   \n"  // R
-      "movhps      %%xmm2,(%1,%4)                \n"  // A
+      "punpcklbw   %%xmm0,%%xmm0                 \n"
+      "punpckhbw   %%xmm1,%%xmm1                 \n"
+      "add         $0x10,%0                      \n"
+      "pmulhuw     %%xmm2,%%xmm0                 \n"
+      "pmulhuw     %%xmm2,%%xmm1                 \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "movdqu      %%xmm1,0x10(%1)               \n"
+      "add         $0x20,%1                      \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+  : "+r"(src_y),   // %0
+    "+r"(dst_y),   // %1
+    "+r"(width)    // %2
+  : "r"(scale)     // %3
+  : "memory", "cc", "xmm0", "xmm1", "xmm2");
+  // clang-format on
+}
 
-      "lea         32(%0),%0                     \n"
-      "lea         8(%1),%1                      \n"
-      "sub         $0x8,%5                       \n"
+#ifdef HAS_CONVERT8TO16ROW_AVX2
+void Convert8To16Row_AVX2(const uint8_t* src_y,
+                          uint16_t* dst_y,
+                          int scale,
+                          int width) {
+  // clang-format off
+  asm volatile (
+      "vmovd       %3,%%xmm2                     \n"
+      "vpunpcklwd  %%xmm2,%%xmm2,%%xmm2          \n"
+      "vbroadcastss %%xmm2,%%ymm2                \n"
+
+    // 32 pixels per loop.
+    LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "add         $0x20,%0                      \n"
+      "vpunpckhbw  %%ymm0,%%ymm0,%%ymm1          \n"
+      "vpunpcklbw  %%ymm0,%%ymm0,%%ymm0          \n"
+      "vpmulhuw    %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpmulhuw    %%ymm2,%%ymm1,%%ymm1          \n"
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "vmovdqu     %%ymm1,0x20(%1)               \n"
+      "add         $0x40,%1                      \n"
+      "sub         $0x20,%2                      \n"
       "jg          1b                            \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_r),     // %1
-        "+r"(dst_g),     // %2
-        "+r"(dst_b),     // %3
-        "+r"(dst_a),     // %4
-        "+rm"(width)     // %5
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      "vzeroupper                                \n"
+  : "+r"(src_y),   // %0
+    "+r"(dst_y),   // %1
+    "+r"(width)    // %2
+  : "r"(scale)     // %3
+  : "memory", "cc", "xmm0", "xmm1", "xmm2");
+  // clang-format on
 }
-#endif
+#endif  // HAS_CONVERT8TO16ROW_AVX2
 
-#ifdef HAS_SPLITXRGBROW_SSE2
-void SplitXRGBRow_SSE2(const uint8_t* src_argb,
+#ifdef HAS_SPLITRGBROW_SSSE3
+// Shuffle table for converting RGB to Planar.
+static const uvec8 kSplitRGBShuffle[9] = {
+    {0u, 3u, 6u, 9u, 12u, 15u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u,
+     128u, 128u},
+    {128u, 128u, 128u, 128u, 128u, 128u, 2u, 5u, 8u, 11u, 14u, 128u, 128u, 128u,
+     128u, 128u},
+    {128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 1u, 4u,
+     7u, 10u, 13u},
+    {1u, 4u, 7u, 10u, 13u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u,
+     128u, 128u},
+    {128u, 128u, 128u, 128u, 128u, 0u, 3u, 6u, 9u, 12u, 15u, 128u, 128u, 128u,
+     128u, 128u},
+    {128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 2u, 5u,
+     8u, 11u, 14u},
+    {2u, 5u, 8u, 11u, 14u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u,
+     128u, 128u},
+    {128u, 128u, 128u, 128u, 128u, 1u, 4u, 7u, 10u, 13u, 128u, 128u, 128u, 128u,
+     128u, 128u},
+    {128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 128u, 0u, 3u, 6u, 9u,
+     12u, 15u}};
+
+void SplitRGBRow_SSSE3(const uint8_t* src_rgb,
                        uint8_t* dst_r,
                        uint8_t* dst_g,
                        uint8_t* dst_b,
@@ -5924,797 +6612,1154 @@ void SplitXRGBRow_SSE2(const uint8_t* src_argb,
 
       LABELALIGN
       "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "movdqu      0x20(%0),%%xmm2               \n"
+      "pshufb      0(%5), %%xmm0                 \n"
+      "pshufb      16(%5), %%xmm1                \n"
+      "pshufb      32(%5), %%xmm2                \n"
+      "por         %%xmm1,%%xmm0                 \n"
+      "por         %%xmm2,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "lea         0x10(%1),%1                   \n"
 
-      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
-      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 00-07 10-17
-      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 08-0F 18-1F
-      "movdqa      %%xmm0,%%xmm1                 \n"
-      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 08192A3B4C5D6E7F (lo)
-      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 08192A3B4C5D6E7F (hi)
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 08192A3B08192A3B
-      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 4C5D6E7F4C5D6E7F
-      "movdqa      %%xmm0,%%xmm1                 \n"
-      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
-      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
-      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
-      "movlps      %%xmm0,(%3)                   \n"  // B
-      "movhps      %%xmm0,(%2)                   \n"  // G
-      "movlps      %%xmm2,(%1)                   \n"  // R
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "movdqu      0x20(%0),%%xmm2               \n"
+      "pshufb      48(%5),%%xmm0                 \n"
+      "pshufb      64(%5),%%xmm1                 \n"
+      "pshufb      80(%5), %%xmm2                \n"
+      "por         %%xmm1,%%xmm0                 \n"
+      "por         %%xmm2,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%2)                   \n"
+      "lea         0x10(%2),%2                   \n"
 
-      "lea         32(%0),%0                     \n"
-      "lea         8(%1),%1                      \n"
-      "lea         8(%2),%2                      \n"
-      "lea         8(%3),%3                      \n"
-      "sub         $0x8,%4                       \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "movdqu      0x20(%0),%%xmm2               \n"
+      "pshufb      96(%5), %%xmm0                \n"
+      "pshufb      112(%5), %%xmm1               \n"
+      "pshufb      128(%5), %%xmm2               \n"
+      "por         %%xmm1,%%xmm0                 \n"
+      "por         %%xmm2,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%3)                   \n"
+      "lea         0x10(%3),%3                   \n"
+      "lea         0x30(%0),%0                   \n"
+      "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_r),     // %1
-        "+r"(dst_g),     // %2
-        "+r"(dst_b),     // %3
-        "+rm"(width)     // %4
-      :
+      : "+r"(src_rgb),             // %0
+        "+r"(dst_r),               // %1
+        "+r"(dst_g),               // %2
+        "+r"(dst_b),               // %3
+        "+r"(width)                // %4
+      : "r"(&kSplitRGBShuffle[0])  // %5
       : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
-#endif
+#endif  // HAS_SPLITRGBROW_SSSE3
 
-static const uvec8 kShuffleMaskARGBSplit = {0, 4, 8,  12, 1, 5, 9,  13,
-                                            2, 6, 10, 14, 3, 7, 11, 15};
-#ifdef HAS_SPLITARGBROW_SSSE3
-void SplitARGBRow_SSSE3(const uint8_t* src_argb,
-                        uint8_t* dst_r,
-                        uint8_t* dst_g,
-                        uint8_t* dst_b,
-                        uint8_t* dst_a,
-                        int width) {
-  asm volatile(
+#ifdef HAS_MERGERGBROW_SSSE3
+// Shuffle table for converting Planar to RGB.
+static const uvec8 kMergeRGBShuffle[9] = {
+    {0u, 128u, 128u, 1u, 128u, 128u, 2u, 128u, 128u, 3u, 128u, 128u, 4u, 128u,
+     128u, 5u},
+    {128u, 0u, 128u, 128u, 1u, 128u, 128u, 2u, 128u, 128u, 3u, 128u, 128u, 4u,
+     128u, 128u},
+    {128u, 128u, 0u, 128u, 128u, 1u, 128u, 128u, 2u, 128u, 128u, 3u, 128u, 128u,
+     4u, 128u},
+    {128u, 128u, 6u, 128u, 128u, 7u, 128u, 128u, 8u, 128u, 128u, 9u, 128u, 128u,
+     10u, 128u},
+    {5u, 128u, 128u, 6u, 128u, 128u, 7u, 128u, 128u, 8u, 128u, 128u, 9u, 128u,
+     128u, 10u},
+    {128u, 5u, 128u, 128u, 6u, 128u, 128u, 7u, 128u, 128u, 8u, 128u, 128u, 9u,
+     128u, 128u},
+    {128u, 11u, 128u, 128u, 12u, 128u, 128u, 13u, 128u, 128u, 14u, 128u, 128u,
+     15u, 128u, 128u},
+    {128u, 128u, 11u, 128u, 128u, 12u, 128u, 128u, 13u, 128u, 128u, 14u, 128u,
+     128u, 15u, 128u},
+    {10u, 128u, 128u, 11u, 128u, 128u, 12u, 128u, 128u, 13u, 128u, 128u, 14u,
+     128u, 128u, 15u}};
 
-      "movdqa      %6,%%xmm3                     \n"
-      "sub         %1,%2                         \n"
-      "sub         %1,%3                         \n"
-      "sub         %1,%4                         \n"
+void MergeRGBRow_SSSE3(const uint8_t* src_r,
+                       const uint8_t* src_g,
+                       const uint8_t* src_b,
+                       uint8_t* dst_rgb,
+                       int width) {
+  asm volatile(
 
       LABELALIGN
       "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      (%1),%%xmm1                   \n"
+      "movdqu      (%2),%%xmm2                   \n"
+      "pshufb      (%5), %%xmm0                  \n"
+      "pshufb      16(%5), %%xmm1                \n"
+      "pshufb      32(%5), %%xmm2                \n"
+      "por         %%xmm1,%%xmm0                 \n"
+      "por         %%xmm2,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%3)                   \n"
 
-      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
-      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
-      "pshufb      %%xmm3,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
-      "pshufb      %%xmm3,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
-      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
-      "movlps      %%xmm0,(%1,%3)                \n"  // B
-      "movhps      %%xmm0,(%1,%2)                \n"  // G
-      "movlps      %%xmm2,(%1)                   \n"  // R
-      "movhps      %%xmm2,(%1,%4)                \n"  // A
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      (%1),%%xmm1                   \n"
+      "movdqu      (%2),%%xmm2                   \n"
+      "pshufb      48(%5), %%xmm0                \n"
+      "pshufb      64(%5), %%xmm1                \n"
+      "pshufb      80(%5), %%xmm2                \n"
+      "por         %%xmm1,%%xmm0                 \n"
+      "por         %%xmm2,%%xmm0                 \n"
+      "movdqu      %%xmm0,16(%3)                 \n"
 
-      "lea         32(%0),%0                     \n"
-      "lea         8(%1),%1                      \n"
-      "subl        $0x8,%5                       \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      (%1),%%xmm1                   \n"
+      "movdqu      (%2),%%xmm2                   \n"
+      "pshufb      96(%5), %%xmm0                \n"
+      "pshufb      112(%5), %%xmm1               \n"
+      "pshufb      128(%5), %%xmm2               \n"
+      "por         %%xmm1,%%xmm0                 \n"
+      "por         %%xmm2,%%xmm0                 \n"
+      "movdqu      %%xmm0,32(%3)                 \n"
+
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "lea         0x30(%3),%3                   \n"
+      "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_r),     // %1
-        "+r"(dst_g),     // %2
-        "+r"(dst_b),     // %3
-        "+r"(dst_a),     // %4
-#if defined(__i386__)
-        "+m"(width)  // %5
-#else
-        "+rm"(width)          // %5
-#endif
-      : "m"(kShuffleMaskARGBSplit)  // %6
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3");
+      : "+r"(src_r),               // %0
+        "+r"(src_g),               // %1
+        "+r"(src_b),               // %2
+        "+r"(dst_rgb),             // %3
+        "+r"(width)                // %4
+      : "r"(&kMergeRGBShuffle[0])  // %5
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
-#endif
+#endif  // HAS_MERGERGBROW_SSSE3
 
-#ifdef HAS_SPLITXRGBROW_SSSE3
-void SplitXRGBRow_SSSE3(const uint8_t* src_argb,
-                        uint8_t* dst_r,
-                        uint8_t* dst_g,
-                        uint8_t* dst_b,
-                        int width) {
+#ifdef HAS_MERGEARGBROW_SSE2
+void MergeARGBRow_SSE2(const uint8_t* src_r,
+                       const uint8_t* src_g,
+                       const uint8_t* src_b,
+                       const uint8_t* src_a,
+                       uint8_t* dst_argb,
+                       int width) {
   asm volatile(
 
-      "movdqa      %5,%%xmm3                     \n"
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
+      "sub         %0,%3                         \n"
 
       LABELALIGN
       "1:                                        \n"
 
-      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
-      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
-      "pshufb      %%xmm3,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
-      "pshufb      %%xmm3,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
-      "movdqa      %%xmm0,%%xmm2                 \n"
-      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
-      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
-      "movlps      %%xmm0,(%3)                   \n"  // B
-      "movhps      %%xmm0,(%2)                   \n"  // G
-      "movlps      %%xmm2,(%1)                   \n"  // R
+      "movq        (%0,%2),%%xmm0                \n"  // B
+      "movq        (%0),%%xmm1                   \n"  // R
+      "movq        (%0,%1),%%xmm2                \n"  // G
+      "punpcklbw   %%xmm1,%%xmm0                 \n"  // BR
+      "movq        (%0,%3),%%xmm1                \n"  // A
+      "punpcklbw   %%xmm1,%%xmm2                 \n"  // GA
+      "movdqa      %%xmm0,%%xmm1                 \n"  // BR
+      "punpckhbw   %%xmm2,%%xmm1                 \n"  // BGRA (hi)
+      "punpcklbw   %%xmm2,%%xmm0                 \n"  // BGRA (lo)
+      "movdqu      %%xmm0,(%4)                   \n"
+      "movdqu      %%xmm1,16(%4)                 \n"
 
-      "lea         32(%0),%0                     \n"
-      "lea         8(%1),%1                      \n"
-      "lea         8(%2),%2                      \n"
-      "lea         8(%3),%3                      \n"
-      "sub         $0x8,%4                       \n"
+      "lea         8(%0),%0                      \n"
+      "lea         32(%4),%4                     \n"
+      "sub         $0x8,%5                       \n"
       "jg          1b                            \n"
-      : "+r"(src_argb),             // %0
-        "+r"(dst_r),                // %1
-        "+r"(dst_g),                // %2
-        "+r"(dst_b),                // %3
-        "+r"(width)                 // %4
-      : "m"(kShuffleMaskARGBSplit)  // %5
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3");
+      : "+r"(src_r),     // %0
+        "+r"(src_g),     // %1
+        "+r"(src_b),     // %2
+        "+r"(src_a),     // %3
+        "+r"(dst_argb),  // %4
+        "+r"(width)      // %5
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
 #endif
 
-#ifdef HAS_SPLITARGBROW_AVX2
-static const ulvec32 kShuffleMaskARGBPermute = {0, 4, 1, 5, 2, 6, 3, 7};
-void SplitARGBRow_AVX2(const uint8_t* src_argb,
-                       uint8_t* dst_r,
-                       uint8_t* dst_g,
-                       uint8_t* dst_b,
-                       uint8_t* dst_a,
+#ifdef HAS_MERGEXRGBROW_SSE2
+void MergeXRGBRow_SSE2(const uint8_t* src_r,
+                       const uint8_t* src_g,
+                       const uint8_t* src_b,
+                       uint8_t* dst_argb,
                        int width) {
   asm volatile(
 
-      "sub         %1,%2                         \n"
-      "sub         %1,%3                         \n"
-      "sub         %1,%4                         \n"
-      "vmovdqa     %7,%%ymm3                     \n"
-      "vbroadcastf128 %6,%%ymm4                  \n"
-
       LABELALIGN
       "1:                                        \n"
 
-      "vmovdqu     (%0),%%xmm0                   \n"  // 00-0F
-      "vmovdqu     16(%0),%%xmm1                 \n"  // 10-1F
-      "vinserti128 $1,32(%0),%%ymm0,%%ymm0       \n"  // 00-0F 20-2F
-      "vinserti128 $1,48(%0),%%ymm1,%%ymm1       \n"  // 10-1F 30-3F
-      "vpshufb     %%ymm4,%%ymm0,%%ymm0          \n"
-      "vpshufb     %%ymm4,%%ymm1,%%ymm1          \n"
-      "vpermd      %%ymm0,%%ymm3,%%ymm0          \n"
-      "vpermd      %%ymm1,%%ymm3,%%ymm1          \n"
-      "vpunpckhdq  %%ymm1,%%ymm0,%%ymm2          \n"  // GA
-      "vpunpckldq  %%ymm1,%%ymm0,%%ymm0          \n"  // BR
-      "vmovdqu     %%xmm0,(%1,%3)                \n"  // B
-      "vextracti128 $1,%%ymm0,(%1)               \n"  // R
-      "vmovdqu     %%xmm2,(%1,%2)                \n"  // G
-      "vextracti128 $1,%%ymm2,(%1,%4)            \n"  // A
-      "lea         64(%0),%0                     \n"
-      "lea         16(%1),%1                     \n"
-      "subl        $0x10,%5                      \n"
+      "movq        (%2),%%xmm0                   \n"  // B
+      "movq        (%0),%%xmm1                   \n"  // R
+      "movq        (%1),%%xmm2                   \n"  // G
+      "punpcklbw   %%xmm1,%%xmm0                 \n"  // BR
+      "pcmpeqd     %%xmm1,%%xmm1                 \n"  // A(255)
+      "punpcklbw   %%xmm1,%%xmm2                 \n"  // GA
+      "movdqa      %%xmm0,%%xmm1                 \n"  // BR
+      "punpckhbw   %%xmm2,%%xmm1                 \n"  // BGRA (hi)
+      "punpcklbw   %%xmm2,%%xmm0                 \n"  // BGRA (lo)
+      "movdqu      %%xmm0,(%3)                   \n"
+      "movdqu      %%xmm1,16(%3)                 \n"
+
+      "lea         8(%0),%0                      \n"
+      "lea         8(%1),%1                      \n"
+      "lea         8(%2),%2                      \n"
+      "lea         32(%3),%3                     \n"
+      "sub         $0x8,%4                       \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_r),     // %1
-        "+r"(dst_g),     // %2
-        "+r"(dst_b),     // %3
-        "+r"(dst_a),     // %4
-#if defined(__i386__)
-        "+m"(width)  // %5
-#else
-        "+rm"(width)          // %5
-#endif
-      : "m"(kShuffleMaskARGBSplit),   // %6
-        "m"(kShuffleMaskARGBPermute)  // %7
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4");
+      : "+r"(src_r),     // %0
+        "+r"(src_g),     // %1
+        "+r"(src_b),     // %2
+        "+r"(dst_argb),  // %3
+        "+r"(width)      // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
-#endif
+#endif  // HAS_MERGEARGBROW_SSE2
 
-#ifdef HAS_SPLITXRGBROW_AVX2
-void SplitXRGBRow_AVX2(const uint8_t* src_argb,
-                       uint8_t* dst_r,
-                       uint8_t* dst_g,
-                       uint8_t* dst_b,
+#ifdef HAS_MERGEARGBROW_AVX2
+void MergeARGBRow_AVX2(const uint8_t* src_r,
+                       const uint8_t* src_g,
+                       const uint8_t* src_b,
+                       const uint8_t* src_a,
+                       uint8_t* dst_argb,
                        int width) {
   asm volatile(
 
-      "vmovdqa     %6,%%ymm3                     \n"
-      "vbroadcastf128 %5,%%ymm4                  \n"
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
+      "sub         %0,%3                         \n"
 
       LABELALIGN
       "1:                                        \n"
 
-      "vmovdqu     (%0),%%xmm0                   \n"  // 00-0F
-      "vmovdqu     16(%0),%%xmm1                 \n"  // 10-1F
-      "vinserti128 $1,32(%0),%%ymm0,%%ymm0       \n"  // 00-0F 20-2F
-      "vinserti128 $1,48(%0),%%ymm1,%%ymm1       \n"  // 10-1F 30-3F
-      "vpshufb     %%ymm4,%%ymm0,%%ymm0          \n"
-      "vpshufb     %%ymm4,%%ymm1,%%ymm1          \n"
-      "vpermd      %%ymm0,%%ymm3,%%ymm0          \n"
-      "vpermd      %%ymm1,%%ymm3,%%ymm1          \n"
-      "vpunpckhdq  %%ymm1,%%ymm0,%%ymm2          \n"  // GA
-      "vpunpckldq  %%ymm1,%%ymm0,%%ymm0          \n"  // BR
-      "vmovdqu     %%xmm0,(%3)                   \n"  // B
-      "vextracti128 $1,%%ymm0,(%1)               \n"  // R
-      "vmovdqu     %%xmm2,(%2)                   \n"  // G
+      "vmovdqu     (%0,%2),%%xmm0                \n"  // B
+      "vmovdqu     (%0,%1),%%xmm1                \n"  // R
+      "vinserti128 $1,(%0),%%ymm0,%%ymm0         \n"  // G
+      "vinserti128 $1,(%0,%3),%%ymm1,%%ymm1      \n"  // A
+      "vpunpckhbw  %%ymm1,%%ymm0,%%ymm2          \n"
+      "vpunpcklbw  %%ymm1,%%ymm0,%%ymm0          \n"
+      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
+      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
+      "vpunpckhwd  %%ymm1,%%ymm0,%%ymm2          \n"
+      "vpunpcklwd  %%ymm1,%%ymm0,%%ymm0          \n"
+      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
+      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
+      "vmovdqu     %%ymm0,(%4)                   \n"  // First 8
+      "vmovdqu     %%ymm1,32(%4)                 \n"  // Next 8
 
-      "lea         64(%0),%0                     \n"
-      "lea         16(%1),%1                     \n"
-      "lea         16(%2),%2                     \n"
-      "lea         16(%3),%3                     \n"
-      "sub         $0x10,%4                      \n"
+      "lea         16(%0),%0                     \n"
+      "lea         64(%4),%4                     \n"
+      "sub         $0x10,%5                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_argb),               // %0
-        "+r"(dst_r),                  // %1
-        "+r"(dst_g),                  // %2
-        "+r"(dst_b),                  // %3
-        "+r"(width)                   // %4
-      : "m"(kShuffleMaskARGBSplit),   // %5
-        "m"(kShuffleMaskARGBPermute)  // %6
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4");
+      : "+r"(src_r),     // %0
+        "+r"(src_g),     // %1
+        "+r"(src_b),     // %2
+        "+r"(src_a),     // %3
+        "+r"(dst_argb),  // %4
+        "+r"(width)      // %5
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
 #endif
 
-#ifdef HAS_MERGEXR30ROW_AVX2
-void MergeXR30Row_AVX2(const uint16_t* src_r,
-                       const uint16_t* src_g,
-                       const uint16_t* src_b,
-                       uint8_t* dst_ar30,
-                       int depth,
+#ifdef HAS_MERGEXRGBROW_AVX2
+void MergeXRGBRow_AVX2(const uint8_t* src_r,
+                       const uint8_t* src_g,
+                       const uint8_t* src_b,
+                       uint8_t* dst_argb,
                        int width) {
-  int shift = depth - 10;
   asm volatile(
 
-      "sub         %0,%1                         \n"
-      "sub         %0,%2                         \n"
-      "vpcmpeqb    %%ymm5,%%ymm5,%%ymm5          \n"  // AR30 constants
-      "vpsrlw      $14,%%ymm5,%%ymm5             \n"
-      "vpsllw      $4,%%ymm5,%%ymm5              \n"  // 2 alpha bits
-      "vpcmpeqb    %%ymm6,%%ymm6,%%ymm6          \n"
-      "vpsrlw      $6,%%ymm6,%%ymm6              \n"
-      "vmovd       %5,%%xmm4                     \n"
-
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"
-      "vmovdqu     (%0,%1),%%ymm1                \n"
-      "vmovdqu     (%0,%2),%%ymm2                \n"
-      "vpsrlw      %%xmm4,%%ymm0,%%ymm0          \n"
-      "vpsrlw      %%xmm4,%%ymm1,%%ymm1          \n"
-      "vpsrlw      %%xmm4,%%ymm2,%%ymm2          \n"
-      "vpminuw     %%ymm0,%%ymm6,%%ymm0          \n"
-      "vpminuw     %%ymm1,%%ymm6,%%ymm1          \n"
-      "vpminuw     %%ymm2,%%ymm6,%%ymm2          \n"
-      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
-      "vpermq      $0xd8,%%ymm1,%%ymm1           \n"
-      "vpermq      $0xd8,%%ymm2,%%ymm2           \n"
-      "vpsllw      $0x4,%%ymm0,%%ymm0            \n"  // Shift R to target bit
-      "vpunpckhwd  %%ymm0,%%ymm2,%%ymm3          \n"  // RB
-      "vpunpcklwd  %%ymm0,%%ymm2,%%ymm0          \n"
-      "vpunpckhwd  %%ymm5,%%ymm1,%%ymm2          \n"  // AG
-      "vpunpcklwd  %%ymm5,%%ymm1,%%ymm1          \n"
-      "vpslld      $0xa,%%ymm1,%%ymm1            \n"  // Shift AG to target bit
-      "vpslld      $0xa,%%ymm2,%%ymm2            \n"
-      "vpor        %%ymm1,%%ymm0,%%ymm0          \n"  // Combine
-      "vpor        %%ymm2,%%ymm3,%%ymm3          \n"
-      "vmovdqu     %%ymm0,(%3)                   \n"
-      "vmovdqu     %%ymm3,0x20(%3)               \n"
-      "lea         0x20(%0),%0                   \n"
-      "lea         0x40(%3),%3                   \n"
+
+      "vmovdqu     (%2),%%xmm0                   \n"  // B
+      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"  // A(255)
+      "vinserti128 $0,(%1),%%ymm1,%%ymm1         \n"  // R
+      "vinserti128 $1,(%0),%%ymm0,%%ymm0         \n"  // G
+      "vpunpckhbw  %%ymm1,%%ymm0,%%ymm2          \n"
+      "vpunpcklbw  %%ymm1,%%ymm0,%%ymm0          \n"
+      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
+      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
+      "vpunpckhwd  %%ymm1,%%ymm0,%%ymm2          \n"
+      "vpunpcklwd  %%ymm1,%%ymm0,%%ymm0          \n"
+      "vperm2i128  $0x31,%%ymm2,%%ymm0,%%ymm1    \n"
+      "vperm2i128  $0x20,%%ymm2,%%ymm0,%%ymm0    \n"
+      "vmovdqu     %%ymm0,(%3)                   \n"  // First 8
+      "vmovdqu     %%ymm1,32(%3)                 \n"  // Next 8
+
+      "lea         16(%0),%0                     \n"
+      "lea         16(%1),%1                     \n"
+      "lea         16(%2),%2                     \n"
+      "lea         64(%3),%3                     \n"
       "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
       : "+r"(src_r),     // %0
         "+r"(src_g),     // %1
         "+r"(src_b),     // %2
-        "+r"(dst_ar30),  // %3
-        "+r"(width)      // %4
-#if defined(__i386__)
-      : "m"(shift)  // %5
-#else
-      : "rm"(shift)           // %5
-#endif
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+        "+r"(dst_argb),  // %3
+        "+rm"(width)     // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
-#endif
+#endif  // HAS_MERGEARGBROW_AVX2
 
-#ifdef HAS_MERGEAR64ROW_AVX2
-static const lvec32 MergeAR64Permute = {0, 4, 2, 6, 1, 5, 3, 7};
-void MergeAR64Row_AVX2(const uint16_t* src_r,
-                       const uint16_t* src_g,
-                       const uint16_t* src_b,
-                       const uint16_t* src_a,
-                       uint16_t* dst_ar64,
-                       int depth,
+#ifdef HAS_SPLITARGBROW_SSE2
+void SplitARGBRow_SSE2(const uint8_t* src_argb,
+                       uint8_t* dst_r,
+                       uint8_t* dst_g,
+                       uint8_t* dst_b,
+                       uint8_t* dst_a,
                        int width) {
-  int shift = 16 - depth;
-  int mask = (1 << depth) - 1;
-  mask = (mask << 16) + mask;
   asm volatile(
 
-      "sub         %0,%1                         \n"
-      "sub         %0,%2                         \n"
-      "sub         %0,%3                         \n"
-      "vmovdqa     %8,%%ymm5                     \n"
-      "vmovd       %6,%%xmm6                     \n"
-      "vbroadcastss %7,%%ymm7                    \n"
+      "sub         %1,%2                         \n"
+      "sub         %1,%3                         \n"
+      "sub         %1,%4                         \n"
 
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"  // R
-      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
-      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
-      "vmovdqu     (%0,%3),%%ymm3                \n"  // A
-      "vpminuw     %%ymm0,%%ymm7,%%ymm0          \n"
-      "vpminuw     %%ymm1,%%ymm7,%%ymm1          \n"
-      "vpminuw     %%ymm2,%%ymm7,%%ymm2          \n"
-      "vpminuw     %%ymm3,%%ymm7,%%ymm3          \n"
-      "vpsllw      %%xmm6,%%ymm0,%%ymm0          \n"
-      "vpsllw      %%xmm6,%%ymm1,%%ymm1          \n"
-      "vpsllw      %%xmm6,%%ymm2,%%ymm2          \n"
-      "vpsllw      %%xmm6,%%ymm3,%%ymm3          \n"
-      "vpermd      %%ymm0,%%ymm5,%%ymm0          \n"
-      "vpermd      %%ymm1,%%ymm5,%%ymm1          \n"
-      "vpermd      %%ymm2,%%ymm5,%%ymm2          \n"
-      "vpermd      %%ymm3,%%ymm5,%%ymm3          \n"
-      "vpunpcklwd  %%ymm1,%%ymm2,%%ymm4          \n"  // BG(low)
-      "vpunpckhwd  %%ymm1,%%ymm2,%%ymm1          \n"  // BG(hi)
-      "vpunpcklwd  %%ymm3,%%ymm0,%%ymm2          \n"  // RA(low)
-      "vpunpckhwd  %%ymm3,%%ymm0,%%ymm0          \n"  // RA(hi)
-      "vpunpckldq  %%ymm2,%%ymm4,%%ymm3          \n"  // BGRA(1)
-      "vpunpckhdq  %%ymm2,%%ymm4,%%ymm4          \n"  // BGRA(3)
-      "vpunpckldq  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA(2)
-      "vpunpckhdq  %%ymm0,%%ymm1,%%ymm1          \n"  // BGRA(4)
-      "vmovdqu     %%ymm3,(%4)                   \n"
-      "vmovdqu     %%ymm2,0x20(%4)               \n"
-      "vmovdqu     %%ymm4,0x40(%4)               \n"
-      "vmovdqu     %%ymm1,0x60(%4)               \n"
-      "lea         0x20(%0),%0                   \n"
-      "lea         0x80(%4),%4                   \n"
-      "subl        $0x10,%5                      \n"
+
+      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
+      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 00-07 10-17
+      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 08-0F 18-1F
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 08192A3B4C5D6E7F (lo)
+      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 08192A3B4C5D6E7F (hi)
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 08192A3B08192A3B
+      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 4C5D6E7F4C5D6E7F
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
+      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
+      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
+      "movlps      %%xmm0,(%1,%3)                \n"  // B
+      "movhps      %%xmm0,(%1,%2)                \n"  // G
+      "movlps      %%xmm2,(%1)                   \n"  // R
+      "movhps      %%xmm2,(%1,%4)                \n"  // A
+
+      "lea         32(%0),%0                     \n"
+      "lea         8(%1),%1                      \n"
+      "sub         $0x8,%5                       \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_r),     // %0
-        "+r"(src_g),     // %1
-        "+r"(src_b),     // %2
-        "+r"(src_a),     // %3
-        "+r"(dst_ar64),  // %4
-#if defined(__i386__)
-        "+m"(width)  // %5
-#else
-        "+rm"(width)          // %5
-#endif
-      : "m"(shift),            // %6
-        "m"(mask),             // %7
-        "m"(MergeAR64Permute)  // %8
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
-        "xmm7");
+      : "+r"(src_argb),  // %0
+        "+r"(dst_r),     // %1
+        "+r"(dst_g),     // %2
+        "+r"(dst_b),     // %3
+        "+r"(dst_a),     // %4
+        "+rm"(width)     // %5
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
 #endif
 
-#ifdef HAS_MERGEXR64ROW_AVX2
-void MergeXR64Row_AVX2(const uint16_t* src_r,
-                       const uint16_t* src_g,
-                       const uint16_t* src_b,
-                       uint16_t* dst_ar64,
-                       int depth,
+#ifdef HAS_SPLITXRGBROW_SSE2
+void SplitXRGBRow_SSE2(const uint8_t* src_argb,
+                       uint8_t* dst_r,
+                       uint8_t* dst_g,
+                       uint8_t* dst_b,
                        int width) {
-  int shift = 16 - depth;
-  int mask = (1 << depth) - 1;
-  mask = (mask << 16) + mask;
   asm volatile(
 
-      "sub         %0,%1                         \n"
-      "sub         %0,%2                         \n"
-      "vmovdqa     %7,%%ymm5                     \n"
-      "vmovd       %5,%%xmm6                     \n"
-      "vbroadcastss %6,%%ymm7                    \n"
-
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"  // R
-      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
-      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
-      "vpminuw     %%ymm0,%%ymm7,%%ymm0          \n"
-      "vpminuw     %%ymm1,%%ymm7,%%ymm1          \n"
-      "vpminuw     %%ymm2,%%ymm7,%%ymm2          \n"
-      "vpsllw      %%xmm6,%%ymm0,%%ymm0          \n"
-      "vpsllw      %%xmm6,%%ymm1,%%ymm1          \n"
-      "vpsllw      %%xmm6,%%ymm2,%%ymm2          \n"
-      "vpermd      %%ymm0,%%ymm5,%%ymm0          \n"
-      "vpermd      %%ymm1,%%ymm5,%%ymm1          \n"
-      "vpermd      %%ymm2,%%ymm5,%%ymm2          \n"
-      "vpcmpeqb    %%ymm3,%%ymm3,%%ymm3          \n"  // A (0xffff)
-      "vpunpcklwd  %%ymm1,%%ymm2,%%ymm4          \n"  // BG(low)
-      "vpunpckhwd  %%ymm1,%%ymm2,%%ymm1          \n"  // BG(hi)
-      "vpunpcklwd  %%ymm3,%%ymm0,%%ymm2          \n"  // RA(low)
-      "vpunpckhwd  %%ymm3,%%ymm0,%%ymm0          \n"  // RA(hi)
-      "vpunpckldq  %%ymm2,%%ymm4,%%ymm3          \n"  // BGRA(1)
-      "vpunpckhdq  %%ymm2,%%ymm4,%%ymm4          \n"  // BGRA(3)
-      "vpunpckldq  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA(2)
-      "vpunpckhdq  %%ymm0,%%ymm1,%%ymm1          \n"  // BGRA(4)
-      "vmovdqu     %%ymm3,(%3)                   \n"
-      "vmovdqu     %%ymm2,0x20(%3)               \n"
-      "vmovdqu     %%ymm4,0x40(%3)               \n"
-      "vmovdqu     %%ymm1,0x60(%3)               \n"
-      "lea         0x20(%0),%0                   \n"
-      "lea         0x80(%3),%3                   \n"
-      "subl        $0x10,%4                      \n"
-      "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_r),           // %0
-        "+r"(src_g),           // %1
-        "+r"(src_b),           // %2
-        "+r"(dst_ar64),        // %3
-        "+r"(width)            // %4
-      : "m"(shift),            // %5
-        "m"(mask),             // %6
-        "m"(MergeAR64Permute)  // %7
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
-        "xmm7");
-}
-#endif
 
-#ifdef HAS_MERGEARGB16TO8ROW_AVX2
-static const uvec8 MergeARGB16To8Shuffle = {0, 8,  1, 9,  2, 10, 3, 11,
-                                            4, 12, 5, 13, 6, 14, 7, 15};
-void MergeARGB16To8Row_AVX2(const uint16_t* src_r,
-                            const uint16_t* src_g,
-                            const uint16_t* src_b,
-                            const uint16_t* src_a,
-                            uint8_t* dst_argb,
-                            int depth,
-                            int width) {
-  int shift = depth - 8;
+      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
+      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 00-07 10-17
+      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 08-0F 18-1F
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 08192A3B4C5D6E7F (lo)
+      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 08192A3B4C5D6E7F (hi)
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpcklqdq  %%xmm1,%%xmm0                 \n"  // 08192A3B08192A3B
+      "punpckhqdq  %%xmm1,%%xmm2                 \n"  // 4C5D6E7F4C5D6E7F
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
+      "punpckhbw   %%xmm2,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
+      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
+      "movlps      %%xmm0,(%3)                   \n"  // B
+      "movhps      %%xmm0,(%2)                   \n"  // G
+      "movlps      %%xmm2,(%1)                   \n"  // R
+
+      "lea         32(%0),%0                     \n"
+      "lea         8(%1),%1                      \n"
+      "lea         8(%2),%2                      \n"
+      "lea         8(%3),%3                      \n"
+      "sub         $0x8,%4                       \n"
+      "jg          1b                            \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_r),     // %1
+        "+r"(dst_g),     // %2
+        "+r"(dst_b),     // %3
+        "+rm"(width)     // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+}
+#endif
+
+static const uvec8 kShuffleMaskARGBSplit = {0, 4, 8,  12, 1, 5, 9,  13,
+                                            2, 6, 10, 14, 3, 7, 11, 15};
+#ifdef HAS_SPLITARGBROW_SSSE3
+void SplitARGBRow_SSSE3(const uint8_t* src_argb,
+                        uint8_t* dst_r,
+                        uint8_t* dst_g,
+                        uint8_t* dst_b,
+                        uint8_t* dst_a,
+                        int width) {
   asm volatile(
 
-      "sub         %0,%1                         \n"
-      "sub         %0,%2                         \n"
-      "sub         %0,%3                         \n"
-      "vbroadcastf128 %7,%%ymm5                  \n"
-      "vmovd       %6,%%xmm6                     \n"
+      "movdqa      %6,%%xmm3                     \n"
+      "sub         %1,%2                         \n"
+      "sub         %1,%3                         \n"
+      "sub         %1,%4                         \n"
 
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"  // R
-      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
-      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
-      "vmovdqu     (%0,%3),%%ymm3                \n"  // A
-      "vpsrlw      %%xmm6,%%ymm0,%%ymm0          \n"
-      "vpsrlw      %%xmm6,%%ymm1,%%ymm1          \n"
-      "vpsrlw      %%xmm6,%%ymm2,%%ymm2          \n"
-      "vpsrlw      %%xmm6,%%ymm3,%%ymm3          \n"
-      "vpackuswb   %%ymm1,%%ymm2,%%ymm1          \n"  // BG (planar)
-      "vpackuswb   %%ymm3,%%ymm0,%%ymm0          \n"  // RA (planar)
-      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"  // BG (interleave)
-      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"  // RA (interleave)
-      "vpermq      $0xd8,%%ymm1,%%ymm1           \n"
-      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
-      "vpunpcklwd  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA (low)
-      "vpunpckhwd  %%ymm0,%%ymm1,%%ymm0          \n"  // BGRA (hi)
-      "vmovdqu     %%ymm2,(%4)                   \n"
-      "vmovdqu     %%ymm0,0x20(%4)               \n"
-      "lea         0x20(%0),%0                   \n"
-      "lea         0x40(%4),%4                   \n"
-      "subl        $0x10,%5                      \n"
+
+      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
+      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
+      "pshufb      %%xmm3,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
+      "pshufb      %%xmm3,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
+      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
+      "movlps      %%xmm0,(%1,%3)                \n"  // B
+      "movhps      %%xmm0,(%1,%2)                \n"  // G
+      "movlps      %%xmm2,(%1)                   \n"  // R
+      "movhps      %%xmm2,(%1,%4)                \n"  // A
+
+      "lea         32(%0),%0                     \n"
+      "lea         8(%1),%1                      \n"
+      "subl        $0x8,%5                       \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_r),     // %0
-        "+r"(src_g),     // %1
-        "+r"(src_b),     // %2
-        "+r"(src_a),     // %3
-        "+r"(dst_argb),  // %4
+      : "+r"(src_argb),  // %0
+        "+r"(dst_r),     // %1
+        "+r"(dst_g),     // %2
+        "+r"(dst_b),     // %3
+        "+r"(dst_a),     // %4
 #if defined(__i386__)
         "+m"(width)  // %5
 #else
         "+rm"(width)          // %5
 #endif
-      : "m"(shift),                 // %6
-        "m"(MergeARGB16To8Shuffle)  // %7
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+      : "m"(kShuffleMaskARGBSplit)  // %6
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3");
 }
 #endif
 
-#ifdef HAS_MERGEXRGB16TO8ROW_AVX2
-void MergeXRGB16To8Row_AVX2(const uint16_t* src_r,
-                            const uint16_t* src_g,
-                            const uint16_t* src_b,
-                            uint8_t* dst_argb,
-                            int depth,
-                            int width) {
-  int shift = depth - 8;
+#ifdef HAS_SPLITXRGBROW_SSSE3
+void SplitXRGBRow_SSSE3(const uint8_t* src_argb,
+                        uint8_t* dst_r,
+                        uint8_t* dst_g,
+                        uint8_t* dst_b,
+                        int width) {
   asm volatile(
 
-      "sub         %0,%1                         \n"
-      "sub         %0,%2                         \n"
-      "vbroadcastf128 %6,%%ymm5                  \n"
-      "vmovd       %5,%%xmm6                     \n"
-      "vpcmpeqb    %%ymm3,%%ymm3,%%ymm3          \n"
-      "vpsrlw      $8,%%ymm3,%%ymm3              \n"  // A (0xff)
+      "movdqa      %5,%%xmm3                     \n"
 
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"  // R
-      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
-      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
-      "vpsrlw      %%xmm6,%%ymm0,%%ymm0          \n"
-      "vpsrlw      %%xmm6,%%ymm1,%%ymm1          \n"
-      "vpsrlw      %%xmm6,%%ymm2,%%ymm2          \n"
-      "vpackuswb   %%ymm1,%%ymm2,%%ymm1          \n"  // BG (planar)
-      "vpackuswb   %%ymm3,%%ymm0,%%ymm0          \n"  // RA (planar)
-      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"  // BG (interleave)
-      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"  // RA (interleave)
-      "vpermq      $0xd8,%%ymm1,%%ymm1           \n"
-      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
-      "vpunpcklwd  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA (low)
-      "vpunpckhwd  %%ymm0,%%ymm1,%%ymm0          \n"  // BGRA (hi)
-      "vmovdqu     %%ymm2,(%3)                   \n"
-      "vmovdqu     %%ymm0,0x20(%3)               \n"
-      "lea         0x20(%0),%0                   \n"
-      "lea         0x40(%3),%3                   \n"
-      "subl        $0x10,%4                      \n"
+
+      "movdqu      (%0),%%xmm0                   \n"  // 00-0F
+      "movdqu      16(%0),%%xmm1                 \n"  // 10-1F
+      "pshufb      %%xmm3,%%xmm0                 \n"  // 048C159D26AE37BF (lo)
+      "pshufb      %%xmm3,%%xmm1                 \n"  // 048C159D26AE37BF (hi)
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpckldq   %%xmm1,%%xmm0                 \n"  // 048C048C159D159D (BG)
+      "punpckhdq   %%xmm1,%%xmm2                 \n"  // 26AE26AE37BF37BF (RA)
+      "movlps      %%xmm0,(%3)                   \n"  // B
+      "movhps      %%xmm0,(%2)                   \n"  // G
+      "movlps      %%xmm2,(%1)                   \n"  // R
+
+      "lea         32(%0),%0                     \n"
+      "lea         8(%1),%1                      \n"
+      "lea         8(%2),%2                      \n"
+      "lea         8(%3),%3                      \n"
+      "sub         $0x8,%4                       \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_r),                // %0
-        "+r"(src_g),                // %1
-        "+r"(src_b),                // %2
-        "+r"(dst_argb),             // %3
+      : "+r"(src_argb),             // %0
+        "+r"(dst_r),                // %1
+        "+r"(dst_g),                // %2
+        "+r"(dst_b),                // %3
         "+r"(width)                 // %4
-      : "m"(shift),                 // %5
-        "m"(MergeARGB16To8Shuffle)  // %6
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+      : "m"(kShuffleMaskARGBSplit)  // %5
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3");
 }
 #endif
 
-#ifdef HAS_COPYROW_SSE2
-void CopyRow_SSE2(const uint8_t* src, uint8_t* dst, int width) {
+#ifdef HAS_SPLITARGBROW_AVX2
+static const ulvec32 kShuffleMaskARGBPermute = {0, 4, 1, 5, 2, 6, 3, 7};
+void SplitARGBRow_AVX2(const uint8_t* src_argb,
+                       uint8_t* dst_r,
+                       uint8_t* dst_g,
+                       uint8_t* dst_b,
+                       uint8_t* dst_a,
+                       int width) {
   asm volatile(
-      "test        $0xf,%0                       \n"
-      "jne         2f                            \n"
-      "test        $0xf,%1                       \n"
-      "jne         2f                            \n"
+
+      "sub         %1,%2                         \n"
+      "sub         %1,%3                         \n"
+      "sub         %1,%4                         \n"
+      "vmovdqa     %7,%%ymm3                     \n"
+      "vbroadcastf128 %6,%%ymm4                  \n"
 
       LABELALIGN
       "1:                                        \n"
-      "movdqa      (%0),%%xmm0                   \n"
-      "movdqa      0x10(%0),%%xmm1               \n"
-      "lea         0x20(%0),%0                   \n"
-      "movdqa      %%xmm0,(%1)                   \n"
-      "movdqa      %%xmm1,0x10(%1)               \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x20,%2                      \n"
+
+      "vmovdqu     (%0),%%xmm0                   \n"  // 00-0F
+      "vmovdqu     16(%0),%%xmm1                 \n"  // 10-1F
+      "vinserti128 $1,32(%0),%%ymm0,%%ymm0       \n"  // 00-0F 20-2F
+      "vinserti128 $1,48(%0),%%ymm1,%%ymm1       \n"  // 10-1F 30-3F
+      "vpshufb     %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpshufb     %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpermd      %%ymm0,%%ymm3,%%ymm0          \n"
+      "vpermd      %%ymm1,%%ymm3,%%ymm1          \n"
+      "vpunpckhdq  %%ymm1,%%ymm0,%%ymm2          \n"  // GA
+      "vpunpckldq  %%ymm1,%%ymm0,%%ymm0          \n"  // BR
+      "vmovdqu     %%xmm0,(%1,%3)                \n"  // B
+      "vextracti128 $1,%%ymm0,(%1)               \n"  // R
+      "vmovdqu     %%xmm2,(%1,%2)                \n"  // G
+      "vextracti128 $1,%%ymm2,(%1,%4)            \n"  // A
+      "lea         64(%0),%0                     \n"
+      "lea         16(%1),%1                     \n"
+      "subl        $0x10,%5                      \n"
       "jg          1b                            \n"
-      "jmp         9f                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_r),     // %1
+        "+r"(dst_g),     // %2
+        "+r"(dst_b),     // %3
+        "+r"(dst_a),     // %4
+#if defined(__i386__)
+        "+m"(width)  // %5
+#else
+        "+rm"(width)          // %5
+#endif
+      : "m"(kShuffleMaskARGBSplit),   // %6
+        "m"(kShuffleMaskARGBPermute)  // %7
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4");
+}
+#endif
+
+#ifdef HAS_SPLITXRGBROW_AVX2
+void SplitXRGBRow_AVX2(const uint8_t* src_argb,
+                       uint8_t* dst_r,
+                       uint8_t* dst_g,
+                       uint8_t* dst_b,
+                       int width) {
+  asm volatile(
+
+      "vmovdqa     %6,%%ymm3                     \n"
+      "vbroadcastf128 %5,%%ymm4                  \n"
 
       LABELALIGN
-      "2:                                        \n"
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      0x10(%0),%%xmm1               \n"
-      "lea         0x20(%0),%0                   \n"
-      "movdqu      %%xmm0,(%1)                   \n"
-      "movdqu      %%xmm1,0x10(%1)               \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x20,%2                      \n"
-      "jg          2b                            \n"
-
-      LABELALIGN "9:                                        \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-      :
-      : "memory", "cc", "xmm0", "xmm1");
-}
-#endif  // HAS_COPYROW_SSE2
+      "1:                                        \n"
 
-#ifdef HAS_COPYROW_AVX
-void CopyRow_AVX(const uint8_t* src, uint8_t* dst, int width) {
-  asm volatile(
+      "vmovdqu     (%0),%%xmm0                   \n"  // 00-0F
+      "vmovdqu     16(%0),%%xmm1                 \n"  // 10-1F
+      "vinserti128 $1,32(%0),%%ymm0,%%ymm0       \n"  // 00-0F 20-2F
+      "vinserti128 $1,48(%0),%%ymm1,%%ymm1       \n"  // 10-1F 30-3F
+      "vpshufb     %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpshufb     %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpermd      %%ymm0,%%ymm3,%%ymm0          \n"
+      "vpermd      %%ymm1,%%ymm3,%%ymm1          \n"
+      "vpunpckhdq  %%ymm1,%%ymm0,%%ymm2          \n"  // GA
+      "vpunpckldq  %%ymm1,%%ymm0,%%ymm0          \n"  // BR
+      "vmovdqu     %%xmm0,(%3)                   \n"  // B
+      "vextracti128 $1,%%ymm0,(%1)               \n"  // R
+      "vmovdqu     %%xmm2,(%2)                   \n"  // G
 
-      LABELALIGN
-      "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"
-      "vmovdqu     0x20(%0),%%ymm1               \n"
-      "lea         0x40(%0),%0                   \n"
-      "vmovdqu     %%ymm0,(%1)                   \n"
-      "vmovdqu     %%ymm1,0x20(%1)               \n"
-      "lea         0x40(%1),%1                   \n"
-      "sub         $0x40,%2                      \n"
+      "lea         64(%0),%0                     \n"
+      "lea         16(%1),%1                     \n"
+      "lea         16(%2),%2                     \n"
+      "lea         16(%3),%3                     \n"
+      "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-      :
-      : "memory", "cc", "xmm0", "xmm1");
+      : "+r"(src_argb),               // %0
+        "+r"(dst_r),                  // %1
+        "+r"(dst_g),                  // %2
+        "+r"(dst_b),                  // %3
+        "+r"(width)                   // %4
+      : "m"(kShuffleMaskARGBSplit),   // %5
+        "m"(kShuffleMaskARGBPermute)  // %6
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4");
 }
-#endif  // HAS_COPYROW_AVX
+#endif
 
-#ifdef HAS_COPYROW_ERMS
-// Multiple of 1.
-void CopyRow_ERMS(const uint8_t* src, uint8_t* dst, int width) {
-  size_t width_tmp = (size_t)(width);
+#ifdef HAS_MERGEXR30ROW_AVX2
+void MergeXR30Row_AVX2(const uint16_t* src_r,
+                       const uint16_t* src_g,
+                       const uint16_t* src_b,
+                       uint8_t* dst_ar30,
+                       int depth,
+                       int width) {
+  int shift = depth - 10;
   asm volatile(
 
-      "rep         movsb                         \n"
-      : "+S"(src),       // %0
-        "+D"(dst),       // %1
-        "+c"(width_tmp)  // %2
-      :
-      : "memory", "cc");
-}
-#endif  // HAS_COPYROW_ERMS
-
-#ifdef HAS_ARGBCOPYALPHAROW_SSE2
-// width in pixels
-void ARGBCopyAlphaRow_SSE2(const uint8_t* src, uint8_t* dst, int width) {
-  asm volatile(
-      "pcmpeqb     %%xmm0,%%xmm0                 \n"
-      "pslld       $0x18,%%xmm0                  \n"
-      "pcmpeqb     %%xmm1,%%xmm1                 \n"
-      "psrld       $0x8,%%xmm1                   \n"
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
+      "vpcmpeqb    %%ymm5,%%ymm5,%%ymm5          \n"  // AR30 constants
+      "vpsrlw      $14,%%ymm5,%%ymm5             \n"
+      "vpsllw      $4,%%ymm5,%%ymm5              \n"  // 2 alpha bits
+      "vpcmpeqb    %%ymm6,%%ymm6,%%ymm6          \n"
+      "vpsrlw      $6,%%ymm6,%%ymm6              \n"
+      "vmovd       %5,%%xmm4                     \n"
 
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm2                   \n"
-      "movdqu      0x10(%0),%%xmm3               \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     (%0,%1),%%ymm1                \n"
+      "vmovdqu     (%0,%2),%%ymm2                \n"
+      "vpsrlw      %%xmm4,%%ymm0,%%ymm0          \n"
+      "vpsrlw      %%xmm4,%%ymm1,%%ymm1          \n"
+      "vpsrlw      %%xmm4,%%ymm2,%%ymm2          \n"
+      "vpminuw     %%ymm0,%%ymm6,%%ymm0          \n"
+      "vpminuw     %%ymm1,%%ymm6,%%ymm1          \n"
+      "vpminuw     %%ymm2,%%ymm6,%%ymm2          \n"
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vpermq      $0xd8,%%ymm1,%%ymm1           \n"
+      "vpermq      $0xd8,%%ymm2,%%ymm2           \n"
+      "vpsllw      $0x4,%%ymm0,%%ymm0            \n"  // Shift R to target bit
+      "vpunpckhwd  %%ymm0,%%ymm2,%%ymm3          \n"  // RB
+      "vpunpcklwd  %%ymm0,%%ymm2,%%ymm0          \n"
+      "vpunpckhwd  %%ymm5,%%ymm1,%%ymm2          \n"  // AG
+      "vpunpcklwd  %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpslld      $0xa,%%ymm1,%%ymm1            \n"  // Shift AG to target bit
+      "vpslld      $0xa,%%ymm2,%%ymm2            \n"
+      "vpor        %%ymm1,%%ymm0,%%ymm0          \n"  // Combine
+      "vpor        %%ymm2,%%ymm3,%%ymm3          \n"
+      "vmovdqu     %%ymm0,(%3)                   \n"
+      "vmovdqu     %%ymm3,0x20(%3)               \n"
       "lea         0x20(%0),%0                   \n"
-      "movdqu      (%1),%%xmm4                   \n"
-      "movdqu      0x10(%1),%%xmm5               \n"
-      "pand        %%xmm0,%%xmm2                 \n"
-      "pand        %%xmm0,%%xmm3                 \n"
-      "pand        %%xmm1,%%xmm4                 \n"
-      "pand        %%xmm1,%%xmm5                 \n"
-      "por         %%xmm4,%%xmm2                 \n"
-      "por         %%xmm5,%%xmm3                 \n"
-      "movdqu      %%xmm2,(%1)                   \n"
-      "movdqu      %%xmm3,0x10(%1)               \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x8,%2                       \n"
+      "lea         0x40(%3),%3                   \n"
+      "sub         $0x10,%4                      \n"
       "jg          1b                            \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-      :
+      "vzeroupper                                \n"
+      : "+r"(src_r),     // %0
+        "+r"(src_g),     // %1
+        "+r"(src_b),     // %2
+        "+r"(dst_ar30),  // %3
+        "+r"(width)      // %4
+#if defined(__i386__)
+      : "m"(shift)  // %5
+#else
+      : "rm"(shift)           // %5
+#endif
       : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
 }
-#endif  // HAS_ARGBCOPYALPHAROW_SSE2
+#endif
 
-#ifdef HAS_ARGBCOPYALPHAROW_AVX2
-// width in pixels
-void ARGBCopyAlphaRow_AVX2(const uint8_t* src, uint8_t* dst, int width) {
+#ifdef HAS_MERGEAR64ROW_AVX2
+static const lvec32 MergeAR64Permute = {0, 4, 2, 6, 1, 5, 3, 7};
+void MergeAR64Row_AVX2(const uint16_t* src_r,
+                       const uint16_t* src_g,
+                       const uint16_t* src_b,
+                       const uint16_t* src_a,
+                       uint16_t* dst_ar64,
+                       int depth,
+                       int width) {
+  int shift = 16 - depth;
+  int mask = (1 << depth) - 1;
+  mask = (mask << 16) + mask;
   asm volatile(
-      "vpcmpeqb    %%ymm0,%%ymm0,%%ymm0          \n"
-      "vpsrld      $0x8,%%ymm0,%%ymm0            \n"
+
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
+      "sub         %0,%3                         \n"
+      "vmovdqa     %8,%%ymm5                     \n"
+      "vmovd       %6,%%xmm6                     \n"
+      "vbroadcastss %7,%%ymm7                    \n"
 
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm1                   \n"
-      "vmovdqu     0x20(%0),%%ymm2               \n"
-      "lea         0x40(%0),%0                   \n"
-      "vpblendvb   %%ymm0,(%1),%%ymm1,%%ymm1     \n"
-      "vpblendvb   %%ymm0,0x20(%1),%%ymm2,%%ymm2 \n"
-      "vmovdqu     %%ymm1,(%1)                   \n"
-      "vmovdqu     %%ymm2,0x20(%1)               \n"
-      "lea         0x40(%1),%1                   \n"
-      "sub         $0x10,%2                      \n"
+      "vmovdqu     (%0),%%ymm0                   \n"  // R
+      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
+      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
+      "vmovdqu     (%0,%3),%%ymm3                \n"  // A
+      "vpminuw     %%ymm0,%%ymm7,%%ymm0          \n"
+      "vpminuw     %%ymm1,%%ymm7,%%ymm1          \n"
+      "vpminuw     %%ymm2,%%ymm7,%%ymm2          \n"
+      "vpminuw     %%ymm3,%%ymm7,%%ymm3          \n"
+      "vpsllw      %%xmm6,%%ymm0,%%ymm0          \n"
+      "vpsllw      %%xmm6,%%ymm1,%%ymm1          \n"
+      "vpsllw      %%xmm6,%%ymm2,%%ymm2          \n"
+      "vpsllw      %%xmm6,%%ymm3,%%ymm3          \n"
+      "vpermd      %%ymm0,%%ymm5,%%ymm0          \n"
+      "vpermd      %%ymm1,%%ymm5,%%ymm1          \n"
+      "vpermd      %%ymm2,%%ymm5,%%ymm2          \n"
+      "vpermd      %%ymm3,%%ymm5,%%ymm3          \n"
+      "vpunpcklwd  %%ymm1,%%ymm2,%%ymm4          \n"  // BG(low)
+      "vpunpckhwd  %%ymm1,%%ymm2,%%ymm1          \n"  // BG(hi)
+      "vpunpcklwd  %%ymm3,%%ymm0,%%ymm2          \n"  // RA(low)
+      "vpunpckhwd  %%ymm3,%%ymm0,%%ymm0          \n"  // RA(hi)
+      "vpunpckldq  %%ymm2,%%ymm4,%%ymm3          \n"  // BGRA(1)
+      "vpunpckhdq  %%ymm2,%%ymm4,%%ymm4          \n"  // BGRA(3)
+      "vpunpckldq  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA(2)
+      "vpunpckhdq  %%ymm0,%%ymm1,%%ymm1          \n"  // BGRA(4)
+      "vmovdqu     %%ymm3,(%4)                   \n"
+      "vmovdqu     %%ymm2,0x20(%4)               \n"
+      "vmovdqu     %%ymm4,0x40(%4)               \n"
+      "vmovdqu     %%ymm1,0x60(%4)               \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x80(%4),%4                   \n"
+      "subl        $0x10,%5                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      : "+r"(src_r),     // %0
+        "+r"(src_g),     // %1
+        "+r"(src_b),     // %2
+        "+r"(src_a),     // %3
+        "+r"(dst_ar64),  // %4
+#if defined(__i386__)
+        "+m"(width)  // %5
+#else
+        "+rm"(width)          // %5
+#endif
+      : "m"(shift),            // %6
+        "m"(mask),             // %7
+        "m"(MergeAR64Permute)  // %8
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_ARGBCOPYALPHAROW_AVX2
+#endif
 
-#ifdef HAS_ARGBEXTRACTALPHAROW_SSE2
-// width in pixels
-void ARGBExtractAlphaRow_SSE2(const uint8_t* src_argb,
-                              uint8_t* dst_a,
-                              int width) {
+#ifdef HAS_MERGEXR64ROW_AVX2
+void MergeXR64Row_AVX2(const uint16_t* src_r,
+                       const uint16_t* src_g,
+                       const uint16_t* src_b,
+                       uint16_t* dst_ar64,
+                       int depth,
+                       int width) {
+  int shift = 16 - depth;
+  int mask = (1 << depth) - 1;
+  mask = (mask << 16) + mask;
   asm volatile(
 
-      LABELALIGN
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
+      "vmovdqa     %7,%%ymm5                     \n"
+      "vmovd       %5,%%xmm6                     \n"
+      "vbroadcastss %6,%%ymm7                    \n"
+
+      LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0), %%xmm0                  \n"
-      "movdqu      0x10(%0), %%xmm1              \n"
-      "lea         0x20(%0), %0                  \n"
-      "psrld       $0x18, %%xmm0                 \n"
-      "psrld       $0x18, %%xmm1                 \n"
-      "packssdw    %%xmm1, %%xmm0                \n"
-      "packuswb    %%xmm0, %%xmm0                \n"
-      "movq        %%xmm0,(%1)                   \n"
-      "lea         0x8(%1), %1                   \n"
-      "sub         $0x8, %2                      \n"
+      "vmovdqu     (%0),%%ymm0                   \n"  // R
+      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
+      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
+      "vpminuw     %%ymm0,%%ymm7,%%ymm0          \n"
+      "vpminuw     %%ymm1,%%ymm7,%%ymm1          \n"
+      "vpminuw     %%ymm2,%%ymm7,%%ymm2          \n"
+      "vpsllw      %%xmm6,%%ymm0,%%ymm0          \n"
+      "vpsllw      %%xmm6,%%ymm1,%%ymm1          \n"
+      "vpsllw      %%xmm6,%%ymm2,%%ymm2          \n"
+      "vpermd      %%ymm0,%%ymm5,%%ymm0          \n"
+      "vpermd      %%ymm1,%%ymm5,%%ymm1          \n"
+      "vpermd      %%ymm2,%%ymm5,%%ymm2          \n"
+      "vpcmpeqb    %%ymm3,%%ymm3,%%ymm3          \n"  // A (0xffff)
+      "vpunpcklwd  %%ymm1,%%ymm2,%%ymm4          \n"  // BG(low)
+      "vpunpckhwd  %%ymm1,%%ymm2,%%ymm1          \n"  // BG(hi)
+      "vpunpcklwd  %%ymm3,%%ymm0,%%ymm2          \n"  // RA(low)
+      "vpunpckhwd  %%ymm3,%%ymm0,%%ymm0          \n"  // RA(hi)
+      "vpunpckldq  %%ymm2,%%ymm4,%%ymm3          \n"  // BGRA(1)
+      "vpunpckhdq  %%ymm2,%%ymm4,%%ymm4          \n"  // BGRA(3)
+      "vpunpckldq  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA(2)
+      "vpunpckhdq  %%ymm0,%%ymm1,%%ymm1          \n"  // BGRA(4)
+      "vmovdqu     %%ymm3,(%3)                   \n"
+      "vmovdqu     %%ymm2,0x20(%3)               \n"
+      "vmovdqu     %%ymm4,0x40(%3)               \n"
+      "vmovdqu     %%ymm1,0x60(%3)               \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x80(%3),%3                   \n"
+      "subl        $0x10,%4                      \n"
       "jg          1b                            \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_a),     // %1
-        "+rm"(width)     // %2
-      :
-      : "memory", "cc", "xmm0", "xmm1");
+      "vzeroupper                                \n"
+      : "+r"(src_r),           // %0
+        "+r"(src_g),           // %1
+        "+r"(src_b),           // %2
+        "+r"(dst_ar64),        // %3
+        "+r"(width)            // %4
+      : "m"(shift),            // %5
+        "m"(mask),             // %6
+        "m"(MergeAR64Permute)  // %7
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_ARGBEXTRACTALPHAROW_SSE2
+#endif
 
-#ifdef HAS_ARGBEXTRACTALPHAROW_AVX2
-static const uvec8 kShuffleAlphaShort_AVX2 = {
-    3u,  128u, 128u, 128u, 7u,  128u, 128u, 128u,
-    11u, 128u, 128u, 128u, 15u, 128u, 128u, 128u};
+#ifdef HAS_MERGEARGB16TO8ROW_AVX2
+static const uvec8 MergeARGB16To8Shuffle = {0, 8,  1, 9,  2, 10, 3, 11,
+                                            4, 12, 5, 13, 6, 14, 7, 15};
+void MergeARGB16To8Row_AVX2(const uint16_t* src_r,
+                            const uint16_t* src_g,
+                            const uint16_t* src_b,
+                            const uint16_t* src_a,
+                            uint8_t* dst_argb,
+                            int depth,
+                            int width) {
+  int shift = depth - 8;
+  asm volatile(
 
-void ARGBExtractAlphaRow_AVX2(const uint8_t* src_argb,
-                              uint8_t* dst_a,
-                              int width) {
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
+      "sub         %0,%3                         \n"
+      "vbroadcastf128 %7,%%ymm5                  \n"
+      "vmovd       %6,%%xmm6                     \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"  // R
+      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
+      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
+      "vmovdqu     (%0,%3),%%ymm3                \n"  // A
+      "vpsrlw      %%xmm6,%%ymm0,%%ymm0          \n"
+      "vpsrlw      %%xmm6,%%ymm1,%%ymm1          \n"
+      "vpsrlw      %%xmm6,%%ymm2,%%ymm2          \n"
+      "vpsrlw      %%xmm6,%%ymm3,%%ymm3          \n"
+      "vpackuswb   %%ymm1,%%ymm2,%%ymm1          \n"  // BG (planar)
+      "vpackuswb   %%ymm3,%%ymm0,%%ymm0          \n"  // RA (planar)
+      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"  // BG (interleave)
+      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"  // RA (interleave)
+      "vpermq      $0xd8,%%ymm1,%%ymm1           \n"
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vpunpcklwd  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA (low)
+      "vpunpckhwd  %%ymm0,%%ymm1,%%ymm0          \n"  // BGRA (hi)
+      "vmovdqu     %%ymm2,(%4)                   \n"
+      "vmovdqu     %%ymm0,0x20(%4)               \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x40(%4),%4                   \n"
+      "subl        $0x10,%5                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_r),     // %0
+        "+r"(src_g),     // %1
+        "+r"(src_b),     // %2
+        "+r"(src_a),     // %3
+        "+r"(dst_argb),  // %4
+#if defined(__i386__)
+        "+m"(width)  // %5
+#else
+        "+rm"(width)          // %5
+#endif
+      : "m"(shift),                 // %6
+        "m"(MergeARGB16To8Shuffle)  // %7
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+}
+#endif
+
+#ifdef HAS_MERGEXRGB16TO8ROW_AVX2
+void MergeXRGB16To8Row_AVX2(const uint16_t* src_r,
+                            const uint16_t* src_g,
+                            const uint16_t* src_b,
+                            uint8_t* dst_argb,
+                            int depth,
+                            int width) {
+  int shift = depth - 8;
   asm volatile(
-      "vmovdqa     %3,%%ymm4                     \n"
-      "vbroadcastf128 %4,%%ymm5                  \n"
+
+      "sub         %0,%1                         \n"
+      "sub         %0,%2                         \n"
+      "vbroadcastf128 %6,%%ymm5                  \n"
+      "vmovd       %5,%%xmm6                     \n"
+      "vpcmpeqb    %%ymm3,%%ymm3,%%ymm3          \n"
+      "vpsrlw      $8,%%ymm3,%%ymm3              \n"  // A (0xff)
 
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0), %%ymm0                  \n"
-      "vmovdqu     0x20(%0), %%ymm1              \n"
-      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"  // vpsrld $0x18, %%ymm0
-      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
-      "vmovdqu     0x40(%0), %%ymm2              \n"
-      "vmovdqu     0x60(%0), %%ymm3              \n"
-      "lea         0x80(%0), %0                  \n"
-      "vpackssdw   %%ymm1, %%ymm0, %%ymm0        \n"  // mutates
-      "vpshufb     %%ymm5,%%ymm2,%%ymm2          \n"
-      "vpshufb     %%ymm5,%%ymm3,%%ymm3          \n"
-      "vpackssdw   %%ymm3, %%ymm2, %%ymm2        \n"  // mutates
-      "vpackuswb   %%ymm2,%%ymm0,%%ymm0          \n"  // mutates.
-      "vpermd      %%ymm0,%%ymm4,%%ymm0          \n"  // unmutate.
-      "vmovdqu     %%ymm0,(%1)                   \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x20, %2                     \n"
+      "vmovdqu     (%0),%%ymm0                   \n"  // R
+      "vmovdqu     (%0,%1),%%ymm1                \n"  // G
+      "vmovdqu     (%0,%2),%%ymm2                \n"  // B
+      "vpsrlw      %%xmm6,%%ymm0,%%ymm0          \n"
+      "vpsrlw      %%xmm6,%%ymm1,%%ymm1          \n"
+      "vpsrlw      %%xmm6,%%ymm2,%%ymm2          \n"
+      "vpackuswb   %%ymm1,%%ymm2,%%ymm1          \n"  // BG (planar)
+      "vpackuswb   %%ymm3,%%ymm0,%%ymm0          \n"  // RA (planar)
+      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"  // BG (interleave)
+      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"  // RA (interleave)
+      "vpermq      $0xd8,%%ymm1,%%ymm1           \n"
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vpunpcklwd  %%ymm0,%%ymm1,%%ymm2          \n"  // BGRA (low)
+      "vpunpckhwd  %%ymm0,%%ymm1,%%ymm0          \n"  // BGRA (hi)
+      "vmovdqu     %%ymm2,(%3)                   \n"
+      "vmovdqu     %%ymm0,0x20(%3)               \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x40(%3),%3                   \n"
+      "subl        $0x10,%4                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_argb),               // %0
-        "+r"(dst_a),                  // %1
-        "+rm"(width)                  // %2
-      : "m"(kPermdARGBToY_AVX),       // %3
-        "m"(kShuffleAlphaShort_AVX2)  // %4
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+      : "+r"(src_r),                // %0
+        "+r"(src_g),                // %1
+        "+r"(src_b),                // %2
+        "+r"(dst_argb),             // %3
+        "+r"(width)                 // %4
+      : "m"(shift),                 // %5
+        "m"(MergeARGB16To8Shuffle)  // %6
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
 }
-#endif  // HAS_ARGBEXTRACTALPHAROW_AVX2
+#endif
 
-#ifdef HAS_ARGBCOPYYTOALPHAROW_SSE2
-// width in pixels
-void ARGBCopyYToAlphaRow_SSE2(const uint8_t* src, uint8_t* dst, int width) {
+#ifdef HAS_COPYROW_SSE2
+void CopyRow_SSE2(const uint8_t* src, uint8_t* dst, int width) {
   asm volatile(
-      "pcmpeqb     %%xmm0,%%xmm0                 \n"
-      "pslld       $0x18,%%xmm0                  \n"
-      "pcmpeqb     %%xmm1,%%xmm1                 \n"
-      "psrld       $0x8,%%xmm1                   \n"
+      "test        $0xf,%0                       \n"
+      "jne         2f                            \n"
+      "test        $0xf,%1                       \n"
+      "jne         2f                            \n"
 
       LABELALIGN
       "1:                                        \n"
-      "movq        (%0),%%xmm2                   \n"
-      "lea         0x8(%0),%0                    \n"
-      "punpcklbw   %%xmm2,%%xmm2                 \n"
-      "punpckhwd   %%xmm2,%%xmm3                 \n"
-      "punpcklwd   %%xmm2,%%xmm2                 \n"
-      "movdqu      (%1),%%xmm4                   \n"
-      "movdqu      0x10(%1),%%xmm5               \n"
-      "pand        %%xmm0,%%xmm2                 \n"
-      "pand        %%xmm0,%%xmm3                 \n"
-      "pand        %%xmm1,%%xmm4                 \n"
-      "pand        %%xmm1,%%xmm5                 \n"
-      "por         %%xmm4,%%xmm2                 \n"
-      "por         %%xmm5,%%xmm3                 \n"
-      "movdqu      %%xmm2,(%1)                   \n"
-      "movdqu      %%xmm3,0x10(%1)               \n"
+      "movdqa      (%0),%%xmm0                   \n"
+      "movdqa      0x10(%0),%%xmm1               \n"
+      "lea         0x20(%0),%0                   \n"
+      "movdqa      %%xmm0,(%1)                   \n"
+      "movdqa      %%xmm1,0x10(%1)               \n"
       "lea         0x20(%1),%1                   \n"
-      "sub         $0x8,%2                       \n"
+      "sub         $0x20,%2                      \n"
       "jg          1b                            \n"
+      "jmp         9f                            \n"
+
+      LABELALIGN
+      "2:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "lea         0x20(%0),%0                   \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "movdqu      %%xmm1,0x10(%1)               \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x20,%2                      \n"
+      "jg          2b                            \n"
+
+      LABELALIGN "9:                                        \n"
       : "+r"(src),   // %0
         "+r"(dst),   // %1
         "+r"(width)  // %2
       :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+      : "memory", "cc", "xmm0", "xmm1");
 }
-#endif  // HAS_ARGBCOPYYTOALPHAROW_SSE2
+#endif  // HAS_COPYROW_SSE2
 
-#ifdef HAS_ARGBCOPYYTOALPHAROW_AVX2
-// width in pixels
-void ARGBCopyYToAlphaRow_AVX2(const uint8_t* src, uint8_t* dst, int width) {
+#ifdef HAS_COPYROW_AVX
+void CopyRow_AVX(const uint8_t* src, uint8_t* dst, int width) {
   asm volatile(
-      "vpcmpeqb    %%ymm0,%%ymm0,%%ymm0          \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "lea         0x40(%0),%0                   \n"
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "vmovdqu     %%ymm1,0x20(%1)               \n"
+      "lea         0x40(%1),%1                   \n"
+      "sub         $0x40,%2                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1");
+}
+#endif  // HAS_COPYROW_AVX
+
+#ifdef HAS_COPYROW_ERMS
+// Multiple of 1.
+void CopyRow_ERMS(const uint8_t* src, uint8_t* dst, int width) {
+  size_t width_tmp = (size_t)(width);
+  asm volatile(
+
+      "rep         movsb                         \n"
+      : "+S"(src),       // %0
+        "+D"(dst),       // %1
+        "+c"(width_tmp)  // %2
+      :
+      : "memory", "cc");
+}
+#endif  // HAS_COPYROW_ERMS
+
+#ifdef HAS_ARGBCOPYALPHAROW_SSE2
+// width in pixels
+void ARGBCopyAlphaRow_SSE2(const uint8_t* src, uint8_t* dst, int width) {
+  asm volatile(
+      "pcmpeqb     %%xmm0,%%xmm0                 \n"
+      "pslld       $0x18,%%xmm0                  \n"
+      "pcmpeqb     %%xmm1,%%xmm1                 \n"
+      "psrld       $0x8,%%xmm1                   \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm2                   \n"
+      "movdqu      0x10(%0),%%xmm3               \n"
+      "lea         0x20(%0),%0                   \n"
+      "movdqu      (%1),%%xmm4                   \n"
+      "movdqu      0x10(%1),%%xmm5               \n"
+      "pand        %%xmm0,%%xmm2                 \n"
+      "pand        %%xmm0,%%xmm3                 \n"
+      "pand        %%xmm1,%%xmm4                 \n"
+      "pand        %%xmm1,%%xmm5                 \n"
+      "por         %%xmm4,%%xmm2                 \n"
+      "por         %%xmm5,%%xmm3                 \n"
+      "movdqu      %%xmm2,(%1)                   \n"
+      "movdqu      %%xmm3,0x10(%1)               \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x8,%2                       \n"
+      "jg          1b                            \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_ARGBCOPYALPHAROW_SSE2
+
+#ifdef HAS_ARGBCOPYALPHAROW_AVX2
+// width in pixels
+void ARGBCopyAlphaRow_AVX2(const uint8_t* src, uint8_t* dst, int width) {
+  asm volatile(
+      "vpcmpeqb    %%ymm0,%%ymm0,%%ymm0          \n"
+      "vpsrld      $0x8,%%ymm0,%%ymm0            \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm1                   \n"
+      "vmovdqu     0x20(%0),%%ymm2               \n"
+      "lea         0x40(%0),%0                   \n"
+      "vpblendvb   %%ymm0,(%1),%%ymm1,%%ymm1     \n"
+      "vpblendvb   %%ymm0,0x20(%1),%%ymm2,%%ymm2 \n"
+      "vmovdqu     %%ymm1,(%1)                   \n"
+      "vmovdqu     %%ymm2,0x20(%1)               \n"
+      "lea         0x40(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+}
+#endif  // HAS_ARGBCOPYALPHAROW_AVX2
+
+#ifdef HAS_ARGBEXTRACTALPHAROW_SSE2
+// width in pixels
+void ARGBExtractAlphaRow_SSE2(const uint8_t* src_argb,
+                              uint8_t* dst_a,
+                              int width) {
+  asm volatile(
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0), %%xmm0                  \n"
+      "movdqu      0x10(%0), %%xmm1              \n"
+      "lea         0x20(%0), %0                  \n"
+      "psrld       $0x18, %%xmm0                 \n"
+      "psrld       $0x18, %%xmm1                 \n"
+      "packssdw    %%xmm1, %%xmm0                \n"
+      "packuswb    %%xmm0, %%xmm0                \n"
+      "movq        %%xmm0,(%1)                   \n"
+      "lea         0x8(%1), %1                   \n"
+      "sub         $0x8, %2                      \n"
+      "jg          1b                            \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_a),     // %1
+        "+rm"(width)     // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1");
+}
+#endif  // HAS_ARGBEXTRACTALPHAROW_SSE2
+
+#ifdef HAS_ARGBEXTRACTALPHAROW_AVX2
+static const uvec8 kShuffleAlphaShort_AVX2 = {
+    3u,  128u, 128u, 128u, 7u,  128u, 128u, 128u,
+    11u, 128u, 128u, 128u, 15u, 128u, 128u, 128u};
+
+void ARGBExtractAlphaRow_AVX2(const uint8_t* src_argb,
+                              uint8_t* dst_a,
+                              int width) {
+  asm volatile(
+      "vmovdqa     %3,%%ymm4                     \n"
+      "vbroadcastf128 %4,%%ymm5                  \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0), %%ymm0                  \n"
+      "vmovdqu     0x20(%0), %%ymm1              \n"
+      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"  // vpsrld $0x18, %%ymm0
+      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
+      "vmovdqu     0x40(%0), %%ymm2              \n"
+      "vmovdqu     0x60(%0), %%ymm3              \n"
+      "lea         0x80(%0), %0                  \n"
+      "vpackssdw   %%ymm1, %%ymm0, %%ymm0        \n"  // mutates
+      "vpshufb     %%ymm5,%%ymm2,%%ymm2          \n"
+      "vpshufb     %%ymm5,%%ymm3,%%ymm3          \n"
+      "vpackssdw   %%ymm3, %%ymm2, %%ymm2        \n"  // mutates
+      "vpackuswb   %%ymm2,%%ymm0,%%ymm0          \n"  // mutates.
+      "vpermd      %%ymm0,%%ymm4,%%ymm0          \n"  // unmutate.
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x20, %2                     \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_argb),               // %0
+        "+r"(dst_a),                  // %1
+        "+rm"(width)                  // %2
+      : "m"(kPermdARGBToY_AVX),       // %3
+        "m"(kShuffleAlphaShort_AVX2)  // %4
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_ARGBEXTRACTALPHAROW_AVX2
+
+#ifdef HAS_ARGBCOPYYTOALPHAROW_SSE2
+// width in pixels
+void ARGBCopyYToAlphaRow_SSE2(const uint8_t* src, uint8_t* dst, int width) {
+  asm volatile(
+      "pcmpeqb     %%xmm0,%%xmm0                 \n"
+      "pslld       $0x18,%%xmm0                  \n"
+      "pcmpeqb     %%xmm1,%%xmm1                 \n"
+      "psrld       $0x8,%%xmm1                   \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movq        (%0),%%xmm2                   \n"
+      "lea         0x8(%0),%0                    \n"
+      "punpcklbw   %%xmm2,%%xmm2                 \n"
+      "punpckhwd   %%xmm2,%%xmm3                 \n"
+      "punpcklwd   %%xmm2,%%xmm2                 \n"
+      "movdqu      (%1),%%xmm4                   \n"
+      "movdqu      0x10(%1),%%xmm5               \n"
+      "pand        %%xmm0,%%xmm2                 \n"
+      "pand        %%xmm0,%%xmm3                 \n"
+      "pand        %%xmm1,%%xmm4                 \n"
+      "pand        %%xmm1,%%xmm5                 \n"
+      "por         %%xmm4,%%xmm2                 \n"
+      "por         %%xmm5,%%xmm3                 \n"
+      "movdqu      %%xmm2,(%1)                   \n"
+      "movdqu      %%xmm3,0x10(%1)               \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x8,%2                       \n"
+      "jg          1b                            \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_ARGBCOPYYTOALPHAROW_SSE2
+
+#ifdef HAS_ARGBCOPYYTOALPHAROW_AVX2
+// width in pixels
+void ARGBCopyYToAlphaRow_AVX2(const uint8_t* src, uint8_t* dst, int width) {
+  asm volatile(
+      "vpcmpeqb    %%ymm0,%%ymm0,%%ymm0          \n"
       "vpsrld      $0x8,%%ymm0,%%ymm0            \n"
 
       LABELALIGN
@@ -8568,1153 +9613,2741 @@ void CumulativeSumToAverageRow_SSE2(const int32_t* topleft,
         "rm"(area)               // %5
       : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
 }
-#endif  // HAS_CUMULATIVESUMTOAVERAGEROW_SSE2
+#endif  // HAS_CUMULATIVESUMTOAVERAGEROW_SSE2
+
+#ifdef HAS_ARGBAFFINEROW_SSE2
+// Copy ARGB pixels from source image with slope to a row of destination.
+LIBYUV_API
+void ARGBAffineRow_SSE2(const uint8_t* src_argb,
+                        int src_argb_stride,
+                        uint8_t* dst_argb,
+                        const float* src_dudv,
+                        int width) {
+  intptr_t src_argb_stride_temp = src_argb_stride;
+  intptr_t temp;
+  asm volatile(
+      "movq        (%3),%%xmm2                   \n"
+      "movq        0x08(%3),%%xmm7               \n"
+      "shl         $0x10,%1                      \n"
+      "add         $0x4,%1                       \n"
+      "movd        %1,%%xmm5                     \n"
+      "sub         $0x4,%4                       \n"
+      "jl          49f                           \n"
+
+      "pshufd      $0x44,%%xmm7,%%xmm7           \n"
+      "pshufd      $0x0,%%xmm5,%%xmm5            \n"
+      "movdqa      %%xmm2,%%xmm0                 \n"
+      "addps       %%xmm7,%%xmm0                 \n"
+      "movlhps     %%xmm0,%%xmm2                 \n"
+      "movdqa      %%xmm7,%%xmm4                 \n"
+      "addps       %%xmm4,%%xmm4                 \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "addps       %%xmm4,%%xmm3                 \n"
+      "addps       %%xmm4,%%xmm4                 \n"
+
+      // 4 pixel loop
+      LABELALIGN
+      "40:                                       \n"
+      "cvttps2dq   %%xmm2,%%xmm0                 \n"  // x,y float->int first 2
+      "cvttps2dq   %%xmm3,%%xmm1                 \n"  // x,y float->int next 2
+      "packssdw    %%xmm1,%%xmm0                 \n"  // x, y as 8 shorts
+      "pmaddwd     %%xmm5,%%xmm0                 \n"  // off = x*4 + y*stride
+      "movd        %%xmm0,%k1                    \n"
+      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
+      "movd        %%xmm0,%k5                    \n"
+      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
+      "movd        0x00(%0,%1,1),%%xmm1          \n"
+      "movd        0x00(%0,%5,1),%%xmm6          \n"
+      "punpckldq   %%xmm6,%%xmm1                 \n"
+      "addps       %%xmm4,%%xmm2                 \n"
+      "movq        %%xmm1,(%2)                   \n"
+      "movd        %%xmm0,%k1                    \n"
+      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
+      "movd        %%xmm0,%k5                    \n"
+      "movd        0x00(%0,%1,1),%%xmm0          \n"
+      "movd        0x00(%0,%5,1),%%xmm6          \n"
+      "punpckldq   %%xmm6,%%xmm0                 \n"
+      "addps       %%xmm4,%%xmm3                 \n"
+      "movq        %%xmm0,0x08(%2)               \n"
+      "lea         0x10(%2),%2                   \n"
+      "sub         $0x4,%4                       \n"
+      "jge         40b                           \n"
+
+      "49:                                       \n"
+      "add         $0x3,%4                       \n"
+      "jl          19f                           \n"
+
+      // 1 pixel loop
+      LABELALIGN
+      "10:                                       \n"
+      "cvttps2dq   %%xmm2,%%xmm0                 \n"
+      "packssdw    %%xmm0,%%xmm0                 \n"
+      "pmaddwd     %%xmm5,%%xmm0                 \n"
+      "addps       %%xmm7,%%xmm2                 \n"
+      "movd        %%xmm0,%k1                    \n"
+      "movd        0x00(%0,%1,1),%%xmm0          \n"
+      "movd        %%xmm0,(%2)                   \n"
+      "lea         0x04(%2),%2                   \n"
+      "sub         $0x1,%4                       \n"
+      "jge         10b                           \n"
+      "19:                                       \n"
+      : "+r"(src_argb),              // %0
+        "+r"(src_argb_stride_temp),  // %1
+        "+r"(dst_argb),              // %2
+        "+r"(src_dudv),              // %3
+        "+rm"(width),                // %4
+        "=&r"(temp)                  // %5
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
+}
+#endif  // HAS_ARGBAFFINEROW_SSE2
+
+#if defined(HAS_ARGBWARPROW_AVX2) || defined(HAS_WARPROW_AVX2)
+// Deinterleave the u,v pairs in each lane.
+static const lvec32 kPermdWarpUV = {0, 2, 4, 6, 1, 3, 5, 7};
+static const lvec32 kWarpZero = {0, 0, 0, 0, 0, 0, 0, 0};
+static const float kWarpScale = 256.f;
+
+// Convert 8 u,v pairs to x0 in ymm0, y0 in ymm1, fx in ymm2 and fy in ymm3.
+// Coordinates are clamped and split as in WarpCoord.
+#define WARPCOORDS_AVX2                                                \
+  "vbroadcastss %[kWarpScale],%%ymm4             \n"                   \
+  "vmulps      (%[src_uv]),%%ymm4,%%ymm0         \n"                   \
+  "vmulps      0x20(%[src_uv]),%%ymm4,%%ymm1     \n"                   \
+  "lea         0x40(%[src_uv]),%[src_uv]         \n"                   \
+  "vmaxps      %[kWarpZero],%%ymm0,%%ymm0        \n"                   \
+  "vmaxps      %[kWarpZero],%%ymm1,%%ymm1        \n"                   \
+  "vminps      %[uvmax],%%ymm0,%%ymm0            \n"                   \
+  "vminps      %[uvmax],%%ymm1,%%ymm1            \n"                   \
+  "vcvttps2dq  %%ymm0,%%ymm0                     \n"                   \
+  "vcvttps2dq  %%ymm1,%%ymm1                     \n"                   \
+  "vmovdqu     %[kPermdWarpUV],%%ymm4            \n"                   \
+  "vpermd      %%ymm0,%%ymm4,%%ymm0              \n"                   \
+  "vpermd      %%ymm1,%%ymm4,%%ymm1              \n"                   \
+  "vperm2i128  $0x20,%%ymm1,%%ymm0,%%ymm2        \n" /* u * 256 */     \
+  "vperm2i128  $0x31,%%ymm1,%%ymm0,%%ymm3        \n" /* v * 256 */     \
+  "vpsrld      $0x8,%%ymm2,%%ymm0                \n"                   \
+  "vpminsd     %[xmax],%%ymm0,%%ymm0             \n" /* x0 */          \
+  "vpslld      $0x8,%%ymm0,%%ymm4                \n"                   \
+  "vpsubd      %%ymm4,%%ymm2,%%ymm2              \n" /* fx */          \
+  "vpsrld      $0x8,%%ymm3,%%ymm1                \n"                   \
+  "vpminsd     %[ymax],%%ymm1,%%ymm1             \n" /* y0 */          \
+  "vpslld      $0x8,%%ymm1,%%ymm4                \n"                   \
+  "vpsubd      %%ymm4,%%ymm3,%%ymm3              \n" /* fy */
+#endif
+
+#ifdef HAS_ARGBWARPROW_AVX2
+// Replicate the x (low word) or y (high word) fraction into both words.
+static const lvec8 kShuffleWarpFx = {0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8,
+                                     9, 12, 13, 12, 13, 0, 1, 0, 1, 4, 5,
+                                     4, 5, 8, 9, 8, 9, 12, 13, 12, 13};
+static const lvec8 kShuffleWarpFy = {2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10,
+                                     11, 14, 15, 14, 15, 2, 3, 2, 3, 6, 7,
+                                     6, 7, 10, 11, 10, 11, 14, 15, 14, 15};
+static const lvec16 kWarpRound16 = {128, 128, 128, 128, 128, 128, 128, 128,
+                                    128, 128, 128, 128, 128, 128, 128, 128};
+
+// Bilinear sample 8 ARGB pixels per loop with 4 gathers.
+// Requires src_width and src_height of at least 2.
+void ARGBWarpRow_AVX2(const uint8_t* src_argb,
+                      int src_stride_argb,
+                      int src_width,
+                      int src_height,
+                      const float* src_uv,
+                      uint8_t* dst_argb,
+                      int width) {
+  const float fxmax = (float)(src_width - 1) * 256.f;
+  const float fymax = (float)(src_height - 1) * 256.f;
+  const float uvmax[8] = {fxmax, fymax, fxmax, fymax,
+                          fxmax, fymax, fxmax, fymax};
+  int32_t xmax[8], ymax[8], stride[8];
+  int i;
+  for (i = 0; i < 8; ++i) {
+    xmax[i] = src_width - 2;
+    ymax[i] = src_height - 2;
+    stride[i] = src_stride_argb;
+  }
+  asm volatile(
+
+      LABELALIGN
+      "1:                                        \n"  //
+      WARPCOORDS_AVX2
+      "vpmulld     %[stride],%%ymm1,%%ymm1       \n"
+      "vpslld      $0x2,%%ymm0,%%ymm0            \n"
+      "vpaddd      %%ymm1,%%ymm0,%%ymm0          \n"  // offset
+      "vpslld      $0x10,%%ymm3,%%ymm3           \n"
+      "vpor        %%ymm2,%%ymm3,%%ymm3          \n"  // fx | fy << 16
+      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm4,%%ymm4,%%ymm4          \n"  // no false dependency
+      "vpgatherdd  %%ymm1,(%[src],%%ymm0,1),%%ymm4 \n"  // top left
+      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpgatherdd  %%ymm1,0x4(%[src],%%ymm0,1),%%ymm5 \n"  // top right
+      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm6,%%ymm6,%%ymm6          \n"
+      "vpgatherdd  %%ymm1,(%[src1],%%ymm0,1),%%ymm6 \n"  // bottom left
+      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm7,%%ymm7,%%ymm7          \n"
+      "vpgatherdd  %%ymm1,0x4(%[src1],%%ymm0,1),%%ymm7 \n"  // bottom right
+
+      // Top row.  a * 256 + (b - a) * fx wraps but the result fits 16 bits.
+      "vpunpckhbw  %[kWarpZero],%%ymm4,%%ymm0    \n"
+      "vpunpckhbw  %[kWarpZero],%%ymm5,%%ymm1    \n"
+      "vpunpcklbw  %[kWarpZero],%%ymm4,%%ymm4    \n"
+      "vpunpcklbw  %[kWarpZero],%%ymm5,%%ymm5    \n"
+      "vpsubw      %%ymm0,%%ymm1,%%ymm1          \n"
+      "vpsubw      %%ymm4,%%ymm5,%%ymm5          \n"
+      "vpshufb     %[kShuffleWarpFx],%%ymm3,%%ymm2 \n"
+      "vpunpckhdq  %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpmullw     %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpshufb     %[kShuffleWarpFx],%%ymm3,%%ymm2 \n"
+      "vpunpckldq  %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpmullw     %%ymm2,%%ymm5,%%ymm5          \n"
+      "vpsllw      $0x8,%%ymm0,%%ymm0            \n"
+      "vpsllw      $0x8,%%ymm4,%%ymm4            \n"
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpaddw      %%ymm5,%%ymm4,%%ymm4          \n"
+      "vpaddw      %[kWarpRound16],%%ymm0,%%ymm0 \n"
+      "vpaddw      %[kWarpRound16],%%ymm4,%%ymm4 \n"
+      "vpsrlw      $0x8,%%ymm0,%%ymm0            \n"  // top hi
+      "vpsrlw      $0x8,%%ymm4,%%ymm4            \n"  // top lo
+
+      // Bottom row.
+      "vpunpckhbw  %[kWarpZero],%%ymm6,%%ymm1    \n"
+      "vpunpckhbw  %[kWarpZero],%%ymm7,%%ymm5    \n"
+      "vpunpcklbw  %[kWarpZero],%%ymm6,%%ymm6    \n"
+      "vpunpcklbw  %[kWarpZero],%%ymm7,%%ymm7    \n"
+      "vpsubw      %%ymm1,%%ymm5,%%ymm5          \n"
+      "vpsubw      %%ymm6,%%ymm7,%%ymm7          \n"
+      "vpshufb     %[kShuffleWarpFx],%%ymm3,%%ymm2 \n"
+      "vpunpckhdq  %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpmullw     %%ymm2,%%ymm5,%%ymm5          \n"
+      "vpshufb     %[kShuffleWarpFx],%%ymm3,%%ymm2 \n"
+      "vpunpckldq  %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpmullw     %%ymm2,%%ymm7,%%ymm7          \n"
+      "vpsllw      $0x8,%%ymm1,%%ymm1            \n"
+      "vpsllw      $0x8,%%ymm6,%%ymm6            \n"
+      "vpaddw      %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpaddw      %%ymm7,%%ymm6,%%ymm6          \n"
+      "vpaddw      %[kWarpRound16],%%ymm1,%%ymm1 \n"
+      "vpaddw      %[kWarpRound16],%%ymm6,%%ymm6 \n"
+      "vpsrlw      $0x8,%%ymm1,%%ymm1            \n"  // bottom hi
+      "vpsrlw      $0x8,%%ymm6,%%ymm6            \n"  // bottom lo
+
+      // Vertical.
+      "vpsubw      %%ymm0,%%ymm1,%%ymm1          \n"
+      "vpsubw      %%ymm4,%%ymm6,%%ymm6          \n"
+      "vpshufb     %[kShuffleWarpFy],%%ymm3,%%ymm2 \n"
+      "vpunpckhdq  %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpmullw     %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpshufb     %[kShuffleWarpFy],%%ymm3,%%ymm2 \n"
+      "vpunpckldq  %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpmullw     %%ymm2,%%ymm6,%%ymm6          \n"
+      "vpsllw      $0x8,%%ymm0,%%ymm0            \n"
+      "vpsllw      $0x8,%%ymm4,%%ymm4            \n"
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpaddw      %%ymm6,%%ymm4,%%ymm4          \n"
+      "vpaddw      %[kWarpRound16],%%ymm0,%%ymm0 \n"
+      "vpaddw      %[kWarpRound16],%%ymm4,%%ymm4 \n"
+      "vpsrlw      $0x8,%%ymm0,%%ymm0            \n"
+      "vpsrlw      $0x8,%%ymm4,%%ymm4            \n"
+      "vpackuswb   %%ymm0,%%ymm4,%%ymm0          \n"
+      "vmovdqu     %%ymm0,(%[dst])               \n"
+      "lea         0x20(%[dst]),%[dst]           \n"
+      "sub         $0x8,%[width]                 \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : [src_uv] "+r"(src_uv),    // %[src_uv]
+        [dst] "+r"(dst_argb),     // %[dst]
+        [width] "+r"(width)       // %[width]
+      : [src] "r"(src_argb),                     // %[src]
+        [src1] "r"(src_argb + src_stride_argb),  // %[src1]
+        [uvmax] "m"(uvmax),                      // %[uvmax]
+        [xmax] "m"(xmax),                        // %[xmax]
+        [ymax] "m"(ymax),                        // %[ymax]
+        [stride] "m"(stride),                    // %[stride]
+        [kWarpScale] "m"(kWarpScale),            // %[kWarpScale]
+        [kWarpZero] "m"(kWarpZero),              // %[kWarpZero]
+        [kPermdWarpUV] "m"(kPermdWarpUV),        // %[kPermdWarpUV]
+        [kShuffleWarpFx] "m"(kShuffleWarpFx),    // %[kShuffleWarpFx]
+        [kShuffleWarpFy] "m"(kShuffleWarpFy),    // %[kShuffleWarpFy]
+        [kWarpRound16] "m"(kWarpRound16)         // %[kWarpRound16]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
+}
+#endif  // HAS_ARGBWARPROW_AVX2
+
+#ifdef HAS_WARPROW_AVX2
+// Zero extend the 2 pixels in the low word of each dword to words.
+static const ulvec8 kShuffleWarpPair = {
+    0, 128, 1, 128, 4, 128, 5, 128, 8, 128, 9, 128, 12, 128, 13, 128,
+    0, 128, 1, 128, 4, 128, 5, 128, 8, 128, 9, 128, 12, 128, 13, 128};
+static const lvec32 kWarp256 = {256, 256, 256, 256, 256, 256, 256, 256};
+static const lvec32 kWarpRound32 = {128, 128, 128, 128, 128, 128, 128, 128};
+
+// Bilinear sample 8 pixels per loop with 2 dword gathers.  Gather addresses
+// are clamped so the last 3 bytes of the plane are not read past, with the
+// pixel pair shifted down instead.
+// Requires src_width and src_height of at least 2 and a positive stride.
+void WarpRow_AVX2(const uint8_t* src,
+                  int src_stride,
+                  int src_width,
+                  int src_height,
+                  const float* src_uv,
+                  uint8_t* dst,
+                  int width) {
+  const float fxmax = (float)(src_width - 1) * 256.f;
+  const float fymax = (float)(src_height - 1) * 256.f;
+  const float uvmax[8] = {fxmax, fymax, fxmax, fymax,
+                          fxmax, fymax, fxmax, fymax};
+  int32_t xmax[8], ymax[8], stride[8], offmax[8];
+  int i;
+  for (i = 0; i < 8; ++i) {
+    xmax[i] = src_width - 2;
+    ymax[i] = src_height - 2;
+    stride[i] = src_stride;
+    offmax[i] = (src_height - 1) * src_stride + src_width - 4;
+  }
+  asm volatile(
+
+      LABELALIGN
+      "1:                                        \n"  //
+      WARPCOORDS_AVX2
+      "vpmulld     %[stride],%%ymm1,%%ymm1       \n"
+      "vpaddd      %%ymm1,%%ymm0,%%ymm0          \n"  // offset
+      "vmovdqu     %[kWarp256],%%ymm5            \n"
+      "vpsubd      %%ymm2,%%ymm5,%%ymm4          \n"
+      "vpslld      $0x10,%%ymm2,%%ymm2           \n"
+      "vpor        %%ymm4,%%ymm2,%%ymm2          \n"  // 256 - fx, fx
+      "vpsubd      %%ymm3,%%ymm5,%%ymm4          \n"
+      "vpslld      $0x10,%%ymm3,%%ymm3           \n"
+      "vpor        %%ymm4,%%ymm3,%%ymm3          \n"  // 256 - fy, fy
+
+      "vpminsd     %[offmax],%%ymm0,%%ymm4       \n"
+      "vpsubd      %%ymm4,%%ymm0,%%ymm5          \n"
+      "vpslld      $0x3,%%ymm5,%%ymm5            \n"  // shift
+      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm6,%%ymm6,%%ymm6          \n"  // no false dependency
+      "vpgatherdd  %%ymm1,(%[src],%%ymm4,1),%%ymm6 \n"
+      "vpsrlvd     %%ymm5,%%ymm6,%%ymm6          \n"  // top pair
+      "vpaddd      %[stride],%%ymm0,%%ymm0       \n"
+      "vpminsd     %[offmax],%%ymm0,%%ymm4       \n"
+      "vpsubd      %%ymm4,%%ymm0,%%ymm5          \n"
+      "vpslld      $0x3,%%ymm5,%%ymm5            \n"
+      "vpcmpeqd    %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm7,%%ymm7,%%ymm7          \n"
+      "vpgatherdd  %%ymm1,(%[src],%%ymm4,1),%%ymm7 \n"
+      "vpsrlvd     %%ymm5,%%ymm7,%%ymm7          \n"  // bottom pair
+
+      "vpshufb     %[kShuffleWarpPair],%%ymm6,%%ymm6 \n"
+      "vpshufb     %[kShuffleWarpPair],%%ymm7,%%ymm7 \n"
+      "vpmaddwd    %%ymm2,%%ymm6,%%ymm6          \n"
+      "vpmaddwd    %%ymm2,%%ymm7,%%ymm7          \n"
+      "vpaddd      %[kWarpRound32],%%ymm6,%%ymm6 \n"
+      "vpaddd      %[kWarpRound32],%%ymm7,%%ymm7 \n"
+      "vpsrld      $0x8,%%ymm6,%%ymm6            \n"
+      "vpsrld      $0x8,%%ymm7,%%ymm7            \n"
+      "vpslld      $0x10,%%ymm7,%%ymm7           \n"
+      "vpor        %%ymm7,%%ymm6,%%ymm6          \n"
+      "vpmaddwd    %%ymm3,%%ymm6,%%ymm6          \n"
+      "vpaddd      %[kWarpRound32],%%ymm6,%%ymm6 \n"
+      "vpsrld      $0x8,%%ymm6,%%ymm6            \n"
+      "vpackusdw   %%ymm6,%%ymm6,%%ymm6          \n"
+      "vpackuswb   %%ymm6,%%ymm6,%%ymm6          \n"
+      "vextracti128 $0x1,%%ymm6,%%xmm7           \n"
+      "vpunpckldq  %%xmm7,%%xmm6,%%xmm6          \n"
+      "vmovq       %%xmm6,(%[dst])               \n"
+      "lea         0x8(%[dst]),%[dst]            \n"
+      "sub         $0x8,%[width]                 \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : [src_uv] "+r"(src_uv),  // %[src_uv]
+        [dst] "+r"(dst),        // %[dst]
+        [width] "+r"(width)     // %[width]
+      : [src] "r"(src),                              // %[src]
+        [uvmax] "m"(uvmax),                          // %[uvmax]
+        [xmax] "m"(xmax),                            // %[xmax]
+        [ymax] "m"(ymax),                            // %[ymax]
+        [stride] "m"(stride),                        // %[stride]
+        [offmax] "m"(offmax),                        // %[offmax]
+        [kWarpScale] "m"(kWarpScale),                // %[kWarpScale]
+        [kWarpZero] "m"(kWarpZero),                  // %[kWarpZero]
+        [kPermdWarpUV] "m"(kPermdWarpUV),            // %[kPermdWarpUV]
+        [kShuffleWarpPair] "m"(kShuffleWarpPair),    // %[kShuffleWarpPair]
+        [kWarp256] "m"(kWarp256),                    // %[kWarp256]
+        [kWarpRound32] "m"(kWarpRound32)             // %[kWarpRound32]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
+}
+#endif  // HAS_WARPROW_AVX2
+
+#ifdef HAS_BLURCOLUMNROW_SSE2
+// Add src_add - src_sub to 16 running sums per loop.
+void BlurColumnRow_SSE2(const uint8_t* src_add,
+                        const uint8_t* src_sub,
+                        int32_t* dst_sum,
+                        int width) {
+  asm volatile(
+      "pxor        %%xmm5,%%xmm5                 \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      (%1),%%xmm2                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm5,%%xmm0                 \n"
+      "punpckhbw   %%xmm5,%%xmm1                 \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklbw   %%xmm5,%%xmm2                 \n"
+      "punpckhbw   %%xmm5,%%xmm3                 \n"
+      "psubw       %%xmm2,%%xmm0                 \n"  // 16 signed differences
+      "psubw       %%xmm3,%%xmm1                 \n"
+      "movdqa      %%xmm0,%%xmm2                 \n"
+      "punpcklwd   %%xmm0,%%xmm0                 \n"
+      "punpckhwd   %%xmm2,%%xmm2                 \n"
+      "movdqa      %%xmm1,%%xmm3                 \n"
+      "punpcklwd   %%xmm1,%%xmm1                 \n"
+      "punpckhwd   %%xmm3,%%xmm3                 \n"
+      "psrad       $0x10,%%xmm0                  \n"  // sign extend to ints
+      "psrad       $0x10,%%xmm2                  \n"
+      "psrad       $0x10,%%xmm1                  \n"
+      "psrad       $0x10,%%xmm3                  \n"
+      "movdqu      (%2),%%xmm4                   \n"
+      "paddd       %%xmm4,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%2)                   \n"
+      "movdqu      0x10(%2),%%xmm4               \n"
+      "paddd       %%xmm4,%%xmm2                 \n"
+      "movdqu      %%xmm2,0x10(%2)               \n"
+      "movdqu      0x20(%2),%%xmm4               \n"
+      "paddd       %%xmm4,%%xmm1                 \n"
+      "movdqu      %%xmm1,0x20(%2)               \n"
+      "movdqu      0x30(%2),%%xmm4               \n"
+      "paddd       %%xmm4,%%xmm3                 \n"
+      "movdqu      %%xmm3,0x30(%2)               \n"
+      "lea         0x40(%2),%2                   \n"
+      "sub         $0x10,%3                      \n"
+      "jg          1b                            \n"
+      : "+r"(src_add),  // %0
+        "+r"(src_sub),  // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_BLURCOLUMNROW_SSE2
+
+#ifdef HAS_BLURCOLUMNROW_AVX2
+// Add src_add - src_sub to 16 running sums per loop.
+void BlurColumnRow_AVX2(const uint8_t* src_add,
+                        const uint8_t* src_sub,
+                        int32_t* dst_sum,
+                        int width) {
+  asm volatile(
+
+      LABELALIGN
+      "1:                                        \n"
+      "vpmovzxbw   (%0),%%ymm0                   \n"
+      "vpmovzxbw   (%1),%%ymm1                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "vpsubw      %%ymm1,%%ymm0,%%ymm0          \n"  // 16 signed differences
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpmovsxwd   %%xmm0,%%ymm0                 \n"
+      "vpmovsxwd   %%xmm1,%%ymm1                 \n"
+      "vpaddd      (%2),%%ymm0,%%ymm0            \n"
+      "vpaddd      0x20(%2),%%ymm1,%%ymm1        \n"
+      "vmovdqu     %%ymm0,(%2)                   \n"
+      "vmovdqu     %%ymm1,0x20(%2)               \n"
+      "lea         0x40(%2),%2                   \n"
+      "sub         $0x10,%3                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_add),  // %0
+        "+r"(src_sub),  // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "memory", "cc", "xmm0", "xmm1");
+}
+#endif  // HAS_BLURCOLUMNROW_AVX2
+
+#ifdef HAS_BLURSCALEROW_SSE2
+// Normalize 8 box sums per loop.
+void BlurScaleRow_SSE2(const int32_t* src_sum,
+                       const float* src_scale,
+                       float scale,
+                       uint8_t* dst,
+                       int width) {
+  asm volatile(
+      "movd        %4,%%xmm4                     \n"
+      "pshufd      $0x0,%%xmm4,%%xmm4            \n"
+      "pcmpeqb     %%xmm5,%%xmm5                 \n"
+      "psrld       $0x1f,%%xmm5                  \n"
+      "pslld       $0x7,%%xmm5                   \n"  // 128 for rounding
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "movups      (%1),%%xmm2                   \n"
+      "movups      0x10(%1),%%xmm3               \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x20(%1),%1                   \n"
+      "cvtdq2ps    %%xmm0,%%xmm0                 \n"
+      "cvtdq2ps    %%xmm1,%%xmm1                 \n"
+      "mulps       %%xmm2,%%xmm0                 \n"
+      "mulps       %%xmm3,%%xmm1                 \n"
+      "mulps       %%xmm4,%%xmm0                 \n"
+      "mulps       %%xmm4,%%xmm1                 \n"
+      "cvttps2dq   %%xmm0,%%xmm0                 \n"
+      "cvttps2dq   %%xmm1,%%xmm1                 \n"
+      "paddd       %%xmm5,%%xmm0                 \n"
+      "paddd       %%xmm5,%%xmm1                 \n"
+      "psrad       $0x8,%%xmm0                   \n"
+      "psrad       $0x8,%%xmm1                   \n"
+      "packssdw    %%xmm1,%%xmm0                 \n"
+      "packuswb    %%xmm0,%%xmm0                 \n"
+      "movq        %%xmm0,(%2)                   \n"
+      "lea         0x8(%2),%2                    \n"
+      "sub         $0x8,%3                       \n"
+      "jg          1b                            \n"
+      : "+r"(src_sum),    // %0
+        "+r"(src_scale),  // %1
+        "+r"(dst),        // %2
+        "+r"(width)       // %3
+      : "m"(scale)        // %4
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_BLURSCALEROW_SSE2
+
+#ifdef HAS_BLURSCALEROW_AVX2
+// Normalize 16 box sums per loop.
+void BlurScaleRow_AVX2(const int32_t* src_sum,
+                       const float* src_scale,
+                       float scale,
+                       uint8_t* dst,
+                       int width) {
+  asm volatile(
+      "vbroadcastss %4,%%ymm4                    \n"
+      "vpcmpeqb    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpsrld      $0x1f,%%ymm5,%%ymm5           \n"
+      "vpslld      $0x7,%%ymm5,%%ymm5            \n"  // 128 for rounding
+
+      LABELALIGN
+      "1:                                        \n"
+      "vcvtdq2ps   (%0),%%ymm0                   \n"
+      "vcvtdq2ps   0x20(%0),%%ymm1               \n"
+      "vmulps      (%1),%%ymm0,%%ymm0            \n"
+      "vmulps      0x20(%1),%%ymm1,%%ymm1        \n"
+      "lea         0x40(%0),%0                   \n"
+      "lea         0x40(%1),%1                   \n"
+      "vmulps      %%ymm4,%%ymm0,%%ymm0          \n"
+      "vmulps      %%ymm4,%%ymm1,%%ymm1          \n"
+      "vcvttps2dq  %%ymm0,%%ymm0                 \n"
+      "vcvttps2dq  %%ymm1,%%ymm1                 \n"
+      "vpaddd      %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpaddd      %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpsrad      $0x8,%%ymm0,%%ymm0            \n"
+      "vpsrad      $0x8,%%ymm1,%%ymm1            \n"
+      "vpackssdw   %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpackuswb   %%xmm1,%%xmm0,%%xmm0          \n"
+      "vmovdqu     %%xmm0,(%2)                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "sub         $0x10,%3                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_sum),    // %0
+        "+r"(src_scale),  // %1
+        "+r"(dst),        // %2
+        "+r"(width)       // %3
+      : "m"(scale)        // %4
+      : "memory", "cc", "xmm0", "xmm1", "xmm4", "xmm5");
+}
+#endif  // HAS_BLURSCALEROW_AVX2
+
+#ifdef HAS_INTERPOLATEROW_SSSE3
+// Bilinear filter 16x2 -> 16x1
+void InterpolateRow_SSSE3(uint8_t* dst_ptr,
+                          const uint8_t* src_ptr,
+                          ptrdiff_t src_stride,
+                          int width,
+                          int source_y_fraction) {
+  asm volatile(
+      "sub         %1,%0                         \n"
+      "cmp         $0x0,%3                       \n"
+      "je          100f                          \n"
+      "cmp         $0x80,%3                      \n"
+      "je          50f                           \n"
+
+      "movd        %3,%%xmm0                     \n"
+      "neg         %3                            \n"
+      "add         $0x100,%3                     \n"
+      "movd        %3,%%xmm5                     \n"
+      "punpcklbw   %%xmm0,%%xmm5                 \n"
+      "punpcklwd   %%xmm5,%%xmm5                 \n"
+      "pshufd      $0x0,%%xmm5,%%xmm5            \n"
+      "mov         $0x80808080,%%eax             \n"
+      "movd        %%eax,%%xmm4                  \n"
+      "pshufd      $0x0,%%xmm4,%%xmm4            \n"
+
+      // General purpose row blend.
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%1),%%xmm0                   \n"
+      "movdqu      0x00(%1,%4,1),%%xmm2          \n"
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"
+      "punpckhbw   %%xmm2,%%xmm1                 \n"
+      "psubb       %%xmm4,%%xmm0                 \n"
+      "psubb       %%xmm4,%%xmm1                 \n"
+      "movdqa      %%xmm5,%%xmm2                 \n"
+      "movdqa      %%xmm5,%%xmm3                 \n"
+      "pmaddubsw   %%xmm0,%%xmm2                 \n"
+      "pmaddubsw   %%xmm1,%%xmm3                 \n"
+      "paddw       %%xmm4,%%xmm2                 \n"
+      "paddw       %%xmm4,%%xmm3                 \n"
+      "psrlw       $0x8,%%xmm2                   \n"
+      "psrlw       $0x8,%%xmm3                   \n"
+      "packuswb    %%xmm3,%%xmm2                 \n"
+      "movdqu      %%xmm2,0x00(%1,%0,1)          \n"
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+      "jmp         99f                           \n"
+
+      // Blend 50 / 50.
+      LABELALIGN
+      "50:                                       \n"
+      "movdqu      (%1),%%xmm0                   \n"
+      "movdqu      0x00(%1,%4,1),%%xmm1          \n"
+      "pavgb       %%xmm1,%%xmm0                 \n"
+      "movdqu      %%xmm0,0x00(%1,%0,1)          \n"
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          50b                           \n"
+      "jmp         99f                           \n"
+
+      // Blend 100 / 0 - Copy row unchanged.
+      LABELALIGN
+      "100:                                      \n"
+      "movdqu      (%1),%%xmm0                   \n"
+      "movdqu      %%xmm0,0x00(%1,%0,1)          \n"
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          100b                          \n"
+
+      "99:                                       \n"
+      : "+r"(dst_ptr),               // %0
+        "+r"(src_ptr),               // %1
+        "+rm"(width),                // %2
+        "+r"(source_y_fraction)      // %3
+      : "r"((intptr_t)(src_stride))  // %4
+      : "memory", "cc", "eax", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_INTERPOLATEROW_SSSE3
+
+#ifdef HAS_INTERPOLATEROW_AVX2
+// Bilinear filter 32x2 -> 32x1
+void InterpolateRow_AVX2(uint8_t* dst_ptr,
+                         const uint8_t* src_ptr,
+                         ptrdiff_t src_stride,
+                         int width,
+                         int source_y_fraction) {
+  asm volatile(
+      "sub         %1,%0                         \n"
+      "cmp         $0x0,%3                       \n"
+      "je          100f                          \n"
+      "cmp         $0x80,%3                      \n"
+      "je          50f                           \n"
+
+      "vmovd       %3,%%xmm0                     \n"
+      "neg         %3                            \n"
+      "add         $0x100,%3                     \n"
+      "vmovd       %3,%%xmm5                     \n"
+      "vpunpcklbw  %%xmm0,%%xmm5,%%xmm5          \n"
+      "vpunpcklwd  %%xmm5,%%xmm5,%%xmm5          \n"
+      "vbroadcastss %%xmm5,%%ymm5                \n"
+      "mov         $0x80808080,%%eax             \n"
+      "vmovd       %%eax,%%xmm4                  \n"
+      "vbroadcastss %%xmm4,%%ymm4                \n"
+
+      // General purpose row blend.
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%1),%%ymm0                   \n"
+      "vmovdqu     0x00(%1,%4,1),%%ymm2          \n"
+      "vpunpckhbw  %%ymm2,%%ymm0,%%ymm1          \n"
+      "vpunpcklbw  %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpsubb      %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpsubb      %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpmaddubsw  %%ymm1,%%ymm5,%%ymm1          \n"
+      "vpmaddubsw  %%ymm0,%%ymm5,%%ymm0          \n"
+      "vpaddw      %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpaddw      %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpsrlw      $0x8,%%ymm1,%%ymm1            \n"
+      "vpsrlw      $0x8,%%ymm0,%%ymm0            \n"
+      "vpackuswb   %%ymm1,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x20,%2                      \n"
+      "jg          1b                            \n"
+      "jmp         99f                           \n"
+
+      // Blend 50 / 50.
+      LABELALIGN
+      "50:                                       \n"
+      "vmovdqu     (%1),%%ymm0                   \n"
+      "vpavgb      0x00(%1,%4,1),%%ymm0,%%ymm0   \n"
+      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x20,%2                      \n"
+      "jg          50b                           \n"
+      "jmp         99f                           \n"
+
+      // Blend 100 / 0 - Copy row unchanged.
+      LABELALIGN
+      "100:                                      \n"
+      "vmovdqu     (%1),%%ymm0                   \n"
+      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x20,%2                      \n"
+      "jg          100b                          \n"
+
+      "99:                                       \n"
+      "vzeroupper                                \n"
+      : "+r"(dst_ptr),               // %0
+        "+r"(src_ptr),               // %1
+        "+r"(width),                 // %2
+        "+r"(source_y_fraction)      // %3
+      : "r"((intptr_t)(src_stride))  // %4
+      : "memory", "cc", "eax", "xmm0", "xmm1", "xmm2", "xmm4", "xmm5");
+}
+#endif  // HAS_INTERPOLATEROW_AVX2
+
+#ifdef HAS_INTERPOLATEROW_16_AVX2
+// Bilinear filter 16x2 -> 16x1 of 16 bit values.
+// Values are biased by 0x8000 so vpmaddwd can treat them as signed, and the
+// bias is added back with the rounding constant.
+void InterpolateRow_16_AVX2(uint16_t* dst_ptr,
+                            const uint16_t* src_ptr,
+                            ptrdiff_t src_stride,
+                            int width,
+                            int source_y_fraction) {
+  asm volatile(
+      "sub         %1,%0                         \n"
+      "cmp         $0x0,%3                       \n"
+      "je          100f                          \n"
+      "cmp         $0x80,%3                      \n"
+      "je          50f                           \n"
+
+      "vmovd       %3,%%xmm0                     \n"
+      "neg         %3                            \n"
+      "add         $0x100,%3                     \n"
+      "vmovd       %3,%%xmm5                     \n"
+      "vpunpcklwd  %%xmm0,%%xmm5,%%xmm5          \n"
+      "vbroadcastss %%xmm5,%%ymm5                \n"
+      "vpcmpeqb    %%ymm4,%%ymm4,%%ymm4          \n"
+      "vpsllw      $0xf,%%ymm4,%%ymm4            \n"  // 0x8000
+      "mov         $0x800080,%%eax               \n"  // 0x8000 * 256 + 128
+      "vmovd       %%eax,%%xmm3                  \n"
+      "vbroadcastss %%xmm3,%%ymm3                \n"
+
+      // General purpose row blend.
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%1),%%ymm0                   \n"
+      "vmovdqu     0x00(%1,%4,1),%%ymm2          \n"
+      "vpunpckhwd  %%ymm2,%%ymm0,%%ymm1          \n"
+      "vpunpcklwd  %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpxor       %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpxor       %%ymm4,%%ymm0,%%ymm0          \n"
+      "vpmaddwd    %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpmaddwd    %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpaddd      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vpaddd      %%ymm3,%%ymm0,%%ymm0          \n"
+      "vpsrld      $0x8,%%ymm1,%%ymm1            \n"
+      "vpsrld      $0x8,%%ymm0,%%ymm0            \n"
+      "vpackusdw   %%ymm1,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+      "jmp         99f                           \n"
+
+      // Blend 50 / 50.
+      LABELALIGN
+      "50:                                       \n"
+      "vmovdqu     (%1),%%ymm0                   \n"
+      "vpavgw      0x00(%1,%4,1),%%ymm0,%%ymm0   \n"
+      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          50b                           \n"
+      "jmp         99f                           \n"
+
+      // Blend 100 / 0 - Copy row unchanged.
+      LABELALIGN
+      "100:                                      \n"
+      "vmovdqu     (%1),%%ymm0                   \n"
+      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          100b                          \n"
+
+      "99:                                       \n"
+      "vzeroupper                                \n"
+      : "+r"(dst_ptr),                   // %0
+        "+r"(src_ptr),                   // %1
+        "+r"(width),                     // %2
+        "+r"(source_y_fraction)          // %3
+      : "r"((intptr_t)(src_stride * 2))  // %4
+      : "memory", "cc", "eax", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_INTERPOLATEROW_16_AVX2
+
+#ifdef HAS_ARGBSHUFFLEROW_SSSE3
+// For BGRAToARGB, ABGRToARGB, RGBAToARGB, and ARGBToRGBA.
+void ARGBShuffleRow_SSSE3(const uint8_t* src_argb,
+                          uint8_t* dst_argb,
+                          const uint8_t* shuffler,
+                          int width) {
+  asm volatile(
+
+      "movdqu      (%3),%%xmm5                   \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "lea         0x20(%0),%0                   \n"
+      "pshufb      %%xmm5,%%xmm0                 \n"
+      "pshufb      %%xmm5,%%xmm1                 \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "movdqu      %%xmm1,0x10(%1)               \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x8,%2                       \n"
+      "jg          1b                            \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_argb),  // %1
+        "+r"(width)      // %2
+      : "r"(shuffler)    // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm5");
+}
+#endif  // HAS_ARGBSHUFFLEROW_SSSE3
+
+#ifdef HAS_ARGBSHUFFLEROW_AVX2
+// For BGRAToARGB, ABGRToARGB, RGBAToARGB, and ARGBToRGBA.
+void ARGBShuffleRow_AVX2(const uint8_t* src_argb,
+                         uint8_t* dst_argb,
+                         const uint8_t* shuffler,
+                         int width) {
+  asm volatile(
+
+      "vbroadcastf128 (%3),%%ymm5                \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "lea         0x40(%0),%0                   \n"
+      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "vmovdqu     %%ymm1,0x20(%1)               \n"
+      "lea         0x40(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_argb),  // %1
+        "+r"(width)      // %2
+      : "r"(shuffler)    // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm5");
+}
+#endif  // HAS_ARGBSHUFFLEROW_AVX2
+
+#ifdef HAS_I422TOYUY2ROW_SSE2
+void I422ToYUY2Row_SSE2(const uint8_t* src_y,
+                        const uint8_t* src_u,
+                        const uint8_t* src_v,
+                        uint8_t* dst_yuy2,
+                        int width) {
+  asm volatile(
+
+      "sub         %1,%2                         \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movq        (%1),%%xmm2                   \n"
+      "movq        0x00(%1,%2,1),%%xmm1          \n"
+      "add         $0x8,%1                       \n"
+      "punpcklbw   %%xmm1,%%xmm2                 \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "add         $0x10,%0                      \n"
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"
+      "punpckhbw   %%xmm2,%%xmm1                 \n"
+      "movdqu      %%xmm0,(%3)                   \n"
+      "movdqu      %%xmm1,0x10(%3)               \n"
+      "lea         0x20(%3),%3                   \n"
+      "sub         $0x10,%4                      \n"
+      "jg          1b                            \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_yuy2),  // %3
+        "+rm"(width)     // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+}
+#endif  // HAS_I422TOYUY2ROW_SSE2
+
+#ifdef HAS_I422TOUYVYROW_SSE2
+void I422ToUYVYRow_SSE2(const uint8_t* src_y,
+                        const uint8_t* src_u,
+                        const uint8_t* src_v,
+                        uint8_t* dst_uyvy,
+                        int width) {
+  asm volatile(
+
+      "sub         %1,%2                         \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movq        (%1),%%xmm2                   \n"
+      "movq        0x00(%1,%2,1),%%xmm1          \n"
+      "add         $0x8,%1                       \n"
+      "punpcklbw   %%xmm1,%%xmm2                 \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqa      %%xmm2,%%xmm1                 \n"
+      "add         $0x10,%0                      \n"
+      "punpcklbw   %%xmm0,%%xmm1                 \n"
+      "punpckhbw   %%xmm0,%%xmm2                 \n"
+      "movdqu      %%xmm1,(%3)                   \n"
+      "movdqu      %%xmm2,0x10(%3)               \n"
+      "lea         0x20(%3),%3                   \n"
+      "sub         $0x10,%4                      \n"
+      "jg          1b                            \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_uyvy),  // %3
+        "+rm"(width)     // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+}
+#endif  // HAS_I422TOUYVYROW_SSE2
+
+#ifdef HAS_I422TOYUY2ROW_AVX2
+void I422ToYUY2Row_AVX2(const uint8_t* src_y,
+                        const uint8_t* src_u,
+                        const uint8_t* src_v,
+                        uint8_t* dst_yuy2,
+                        int width) {
+  asm volatile(
+
+      "sub         %1,%2                         \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vpmovzxbw   (%1),%%ymm1                   \n"
+      "vpmovzxbw   0x00(%1,%2,1),%%ymm2          \n"
+      "add         $0x10,%1                      \n"
+      "vpsllw      $0x8,%%ymm2,%%ymm2            \n"
+      "vpor        %%ymm1,%%ymm2,%%ymm2          \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "add         $0x20,%0                      \n"
+      "vpunpcklbw  %%ymm2,%%ymm0,%%ymm1          \n"
+      "vpunpckhbw  %%ymm2,%%ymm0,%%ymm2          \n"
+      "vextractf128 $0x0,%%ymm1,(%3)             \n"
+      "vextractf128 $0x0,%%ymm2,0x10(%3)         \n"
+      "vextractf128 $0x1,%%ymm1,0x20(%3)         \n"
+      "vextractf128 $0x1,%%ymm2,0x30(%3)         \n"
+      "lea         0x40(%3),%3                   \n"
+      "sub         $0x20,%4                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_yuy2),  // %3
+        "+rm"(width)     // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+}
+#endif  // HAS_I422TOYUY2ROW_AVX2
+
+#ifdef HAS_I422TOUYVYROW_AVX2
+void I422ToUYVYRow_AVX2(const uint8_t* src_y,
+                        const uint8_t* src_u,
+                        const uint8_t* src_v,
+                        uint8_t* dst_uyvy,
+                        int width) {
+  asm volatile(
+
+      "sub         %1,%2                         \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "vpmovzxbw   (%1),%%ymm1                   \n"
+      "vpmovzxbw   0x00(%1,%2,1),%%ymm2          \n"
+      "add         $0x10,%1                      \n"
+      "vpsllw      $0x8,%%ymm2,%%ymm2            \n"
+      "vpor        %%ymm1,%%ymm2,%%ymm2          \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "add         $0x20,%0                      \n"
+      "vpunpcklbw  %%ymm0,%%ymm2,%%ymm1          \n"
+      "vpunpckhbw  %%ymm0,%%ymm2,%%ymm2          \n"
+      "vextractf128 $0x0,%%ymm1,(%3)             \n"
+      "vextractf128 $0x0,%%ymm2,0x10(%3)         \n"
+      "vextractf128 $0x1,%%ymm1,0x20(%3)         \n"
+      "vextractf128 $0x1,%%ymm2,0x30(%3)         \n"
+      "lea         0x40(%3),%3                   \n"
+      "sub         $0x20,%4                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_uyvy),  // %3
+        "+rm"(width)     // %4
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+}
+#endif  // HAS_I422TOUYVYROW_AVX2
 
-#ifdef HAS_ARGBAFFINEROW_SSE2
-// Copy ARGB pixels from source image with slope to a row of destination.
-LIBYUV_API
-void ARGBAffineRow_SSE2(const uint8_t* src_argb,
-                        int src_argb_stride,
-                        uint8_t* dst_argb,
-                        const float* src_dudv,
-                        int width) {
-  intptr_t src_argb_stride_temp = src_argb_stride;
-  intptr_t temp;
+#ifdef HAS_ARGBPOLYNOMIALROW_SSE2
+void ARGBPolynomialRow_SSE2(const uint8_t* src_argb,
+                            uint8_t* dst_argb,
+                            const float* poly,
+                            int width) {
   asm volatile(
-      "movq        (%3),%%xmm2                   \n"
-      "movq        0x08(%3),%%xmm7               \n"
-      "shl         $0x10,%1                      \n"
-      "add         $0x4,%1                       \n"
-      "movd        %1,%%xmm5                     \n"
-      "sub         $0x4,%4                       \n"
-      "jl          49f                           \n"
 
-      "pshufd      $0x44,%%xmm7,%%xmm7           \n"
-      "pshufd      $0x0,%%xmm5,%%xmm5            \n"
-      "movdqa      %%xmm2,%%xmm0                 \n"
-      "addps       %%xmm7,%%xmm0                 \n"
-      "movlhps     %%xmm0,%%xmm2                 \n"
-      "movdqa      %%xmm7,%%xmm4                 \n"
-      "addps       %%xmm4,%%xmm4                 \n"
-      "movdqa      %%xmm2,%%xmm3                 \n"
-      "addps       %%xmm4,%%xmm3                 \n"
-      "addps       %%xmm4,%%xmm4                 \n"
+      "pxor        %%xmm3,%%xmm3                 \n"
 
-      // 4 pixel loop
+      // 2 pixel loop.
       LABELALIGN
-      "40:                                       \n"
-      "cvttps2dq   %%xmm2,%%xmm0                 \n"  // x,y float->int first 2
-      "cvttps2dq   %%xmm3,%%xmm1                 \n"  // x,y float->int next 2
-      "packssdw    %%xmm1,%%xmm0                 \n"  // x, y as 8 shorts
-      "pmaddwd     %%xmm5,%%xmm0                 \n"  // off = x*4 + y*stride
-      "movd        %%xmm0,%k1                    \n"
-      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
-      "movd        %%xmm0,%k5                    \n"
-      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
-      "movd        0x00(%0,%1,1),%%xmm1          \n"
-      "movd        0x00(%0,%5,1),%%xmm6          \n"
-      "punpckldq   %%xmm6,%%xmm1                 \n"
-      "addps       %%xmm4,%%xmm2                 \n"
-      "movq        %%xmm1,(%2)                   \n"
-      "movd        %%xmm0,%k1                    \n"
-      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
-      "movd        %%xmm0,%k5                    \n"
-      "movd        0x00(%0,%1,1),%%xmm0          \n"
-      "movd        0x00(%0,%5,1),%%xmm6          \n"
-      "punpckldq   %%xmm6,%%xmm0                 \n"
-      "addps       %%xmm4,%%xmm3                 \n"
-      "movq        %%xmm0,0x08(%2)               \n"
-      "lea         0x10(%2),%2                   \n"
-      "sub         $0x4,%4                       \n"
-      "jge         40b                           \n"
+      "1:                                        \n"
+      "movq        (%0),%%xmm0                   \n"
+      "lea         0x8(%0),%0                    \n"
+      "punpcklbw   %%xmm3,%%xmm0                 \n"
+      "movdqa      %%xmm0,%%xmm4                 \n"
+      "punpcklwd   %%xmm3,%%xmm0                 \n"
+      "punpckhwd   %%xmm3,%%xmm4                 \n"
+      "cvtdq2ps    %%xmm0,%%xmm0                 \n"
+      "cvtdq2ps    %%xmm4,%%xmm4                 \n"
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "movdqa      %%xmm4,%%xmm5                 \n"
+      "mulps       0x10(%3),%%xmm0               \n"
+      "mulps       0x10(%3),%%xmm4               \n"
+      "addps       (%3),%%xmm0                   \n"
+      "addps       (%3),%%xmm4                   \n"
+      "movdqa      %%xmm1,%%xmm2                 \n"
+      "movdqa      %%xmm5,%%xmm6                 \n"
+      "mulps       %%xmm1,%%xmm2                 \n"
+      "mulps       %%xmm5,%%xmm6                 \n"
+      "mulps       %%xmm2,%%xmm1                 \n"
+      "mulps       %%xmm6,%%xmm5                 \n"
+      "mulps       0x20(%3),%%xmm2               \n"
+      "mulps       0x20(%3),%%xmm6               \n"
+      "mulps       0x30(%3),%%xmm1               \n"
+      "mulps       0x30(%3),%%xmm5               \n"
+      "addps       %%xmm2,%%xmm0                 \n"
+      "addps       %%xmm6,%%xmm4                 \n"
+      "addps       %%xmm1,%%xmm0                 \n"
+      "addps       %%xmm5,%%xmm4                 \n"
+      "cvttps2dq   %%xmm0,%%xmm0                 \n"
+      "cvttps2dq   %%xmm4,%%xmm4                 \n"
+      "packuswb    %%xmm4,%%xmm0                 \n"
+      "packuswb    %%xmm0,%%xmm0                 \n"
+      "movq        %%xmm0,(%1)                   \n"
+      "lea         0x8(%1),%1                    \n"
+      "sub         $0x2,%2                       \n"
+      "jg          1b                            \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_argb),  // %1
+        "+r"(width)      // %2
+      : "r"(poly)        // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+}
+#endif  // HAS_ARGBPOLYNOMIALROW_SSE2
 
-      "49:                                       \n"
-      "add         $0x3,%4                       \n"
-      "jl          19f                           \n"
+#ifdef HAS_ARGBPOLYNOMIALROW_AVX2
+void ARGBPolynomialRow_AVX2(const uint8_t* src_argb,
+                            uint8_t* dst_argb,
+                            const float* poly,
+                            int width) {
+  asm volatile(
+      "vbroadcastf128 (%3),%%ymm4                \n"
+      "vbroadcastf128 0x10(%3),%%ymm5            \n"
+      "vbroadcastf128 0x20(%3),%%ymm6            \n"
+      "vbroadcastf128 0x30(%3),%%ymm7            \n"
 
-      // 1 pixel loop
+      // 2 pixel loop.
       LABELALIGN
-      "10:                                       \n"
-      "cvttps2dq   %%xmm2,%%xmm0                 \n"
-      "packssdw    %%xmm0,%%xmm0                 \n"
-      "pmaddwd     %%xmm5,%%xmm0                 \n"
-      "addps       %%xmm7,%%xmm2                 \n"
-      "movd        %%xmm0,%k1                    \n"
-      "movd        0x00(%0,%1,1),%%xmm0          \n"
-      "movd        %%xmm0,(%2)                   \n"
-      "lea         0x04(%2),%2                   \n"
-      "sub         $0x1,%4                       \n"
-      "jge         10b                           \n"
-      "19:                                       \n"
-      : "+r"(src_argb),              // %0
-        "+r"(src_argb_stride_temp),  // %1
-        "+r"(dst_argb),              // %2
-        "+r"(src_dudv),              // %3
-        "+rm"(width),                // %4
-        "=&r"(temp)                  // %5
-      :
+      "1:                                        \n"
+      "vpmovzxbd   (%0),%%ymm0                   \n"  // 2 ARGB pixels
+      "lea         0x8(%0),%0                    \n"
+      "vcvtdq2ps   %%ymm0,%%ymm0                 \n"  // X 8 floats
+      "vmulps      %%ymm0,%%ymm0,%%ymm2          \n"  // X * X
+      "vmulps      %%ymm7,%%ymm0,%%ymm3          \n"  // C3 * X
+      "vfmadd132ps %%ymm5,%%ymm4,%%ymm0          \n"  // result = C0 + C1 * X
+      "vfmadd231ps %%ymm6,%%ymm2,%%ymm0          \n"  // result += C2 * X * X
+      "vfmadd231ps %%ymm3,%%ymm2,%%ymm0          \n"  // result += C3 * X * X *
+                                                      // X
+      "vcvttps2dq  %%ymm0,%%ymm0                 \n"
+      "vpackusdw   %%ymm0,%%ymm0,%%ymm0          \n"
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vpackuswb   %%xmm0,%%xmm0,%%xmm0          \n"
+      "vmovq       %%xmm0,(%1)                   \n"
+      "lea         0x8(%1),%1                    \n"
+      "sub         $0x2,%2                       \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_argb),  // %1
+        "+r"(width)      // %2
+      : "r"(poly)        // %3
       : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
         "xmm7");
 }
-#endif  // HAS_ARGBAFFINEROW_SSE2
+#endif  // HAS_ARGBPOLYNOMIALROW_AVX2
 
-#ifdef HAS_INTERPOLATEROW_SSSE3
-// Bilinear filter 16x2 -> 16x1
-void InterpolateRow_SSSE3(uint8_t* dst_ptr,
-                          const uint8_t* src_ptr,
-                          ptrdiff_t src_stride,
-                          int width,
-                          int source_y_fraction) {
+#ifdef HAS_HALFFLOATROW_SSE2
+static float kScaleBias = 1.9259299444e-34f;
+void HalfFloatRow_SSE2(const uint16_t* src,
+                       uint16_t* dst,
+                       float scale,
+                       int width) {
+  scale *= kScaleBias;
   asm volatile(
-      "sub         %1,%0                         \n"
-      "cmp         $0x0,%3                       \n"
-      "je          100f                          \n"
-      "cmp         $0x80,%3                      \n"
-      "je          50f                           \n"
-
-      "movd        %3,%%xmm0                     \n"
-      "neg         %3                            \n"
-      "add         $0x100,%3                     \n"
-      "movd        %3,%%xmm5                     \n"
-      "punpcklbw   %%xmm0,%%xmm5                 \n"
-      "punpcklwd   %%xmm5,%%xmm5                 \n"
-      "pshufd      $0x0,%%xmm5,%%xmm5            \n"
-      "mov         $0x80808080,%%eax             \n"
-      "movd        %%eax,%%xmm4                  \n"
+      "movd        %3,%%xmm4                     \n"
       "pshufd      $0x0,%%xmm4,%%xmm4            \n"
+      "pxor        %%xmm5,%%xmm5                 \n"
+      "sub         %0,%1                         \n"
 
-      // General purpose row blend.
+      // 16 pixel loop.
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%1),%%xmm0                   \n"
-      "movdqu      0x00(%1,%4,1),%%xmm2          \n"
-      "movdqa      %%xmm0,%%xmm1                 \n"
-      "punpcklbw   %%xmm2,%%xmm0                 \n"
-      "punpckhbw   %%xmm2,%%xmm1                 \n"
-      "psubb       %%xmm4,%%xmm0                 \n"
-      "psubb       %%xmm4,%%xmm1                 \n"
-      "movdqa      %%xmm5,%%xmm2                 \n"
-      "movdqa      %%xmm5,%%xmm3                 \n"
-      "pmaddubsw   %%xmm0,%%xmm2                 \n"
-      "pmaddubsw   %%xmm1,%%xmm3                 \n"
-      "paddw       %%xmm4,%%xmm2                 \n"
-      "paddw       %%xmm4,%%xmm3                 \n"
-      "psrlw       $0x8,%%xmm2                   \n"
-      "psrlw       $0x8,%%xmm3                   \n"
-      "packuswb    %%xmm3,%%xmm2                 \n"
-      "movdqu      %%xmm2,0x00(%1,%0,1)          \n"
-      "lea         0x10(%1),%1                   \n"
-      "sub         $0x10,%2                      \n"
+      "movdqu      (%0),%%xmm2                   \n"  // 8 shorts
+      "add         $0x10,%0                      \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklwd   %%xmm5,%%xmm2                 \n"  // 8 ints in xmm2/1
+      "cvtdq2ps    %%xmm2,%%xmm2                 \n"  // 8 floats
+      "punpckhwd   %%xmm5,%%xmm3                 \n"
+      "cvtdq2ps    %%xmm3,%%xmm3                 \n"
+      "mulps       %%xmm4,%%xmm2                 \n"
+      "mulps       %%xmm4,%%xmm3                 \n"
+      "psrld       $0xd,%%xmm2                   \n"
+      "psrld       $0xd,%%xmm3                   \n"
+      "packssdw    %%xmm3,%%xmm2                 \n"
+      "movdqu      %%xmm2,-0x10(%0,%1,1)         \n"
+      "sub         $0x8,%2                       \n"
       "jg          1b                            \n"
-      "jmp         99f                           \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      : "m"(scale)   // %3
+      : "memory", "cc", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_HALFFLOATROW_SSE2
 
-      // Blend 50 / 50.
-      LABELALIGN
-      "50:                                       \n"
-      "movdqu      (%1),%%xmm0                   \n"
-      "movdqu      0x00(%1,%4,1),%%xmm1          \n"
-      "pavgb       %%xmm1,%%xmm0                 \n"
-      "movdqu      %%xmm0,0x00(%1,%0,1)          \n"
-      "lea         0x10(%1),%1                   \n"
-      "sub         $0x10,%2                      \n"
-      "jg          50b                           \n"
-      "jmp         99f                           \n"
+#ifdef HAS_HALFFLOATROW_AVX2
+void HalfFloatRow_AVX2(const uint16_t* src,
+                       uint16_t* dst,
+                       float scale,
+                       int width) {
+  scale *= kScaleBias;
+  asm volatile(
+      "vbroadcastss %3, %%ymm4                   \n"
+      "vpxor       %%ymm5,%%ymm5,%%ymm5          \n"
+      "sub         %0,%1                         \n"
 
-      // Blend 100 / 0 - Copy row unchanged.
+      // 16 pixel loop.
       LABELALIGN
-      "100:                                      \n"
-      "movdqu      (%1),%%xmm0                   \n"
-      "movdqu      %%xmm0,0x00(%1,%0,1)          \n"
-      "lea         0x10(%1),%1                   \n"
+      "1:                                        \n"
+      "vmovdqu     (%0),%%ymm2                   \n"  // 16 shorts
+      "add         $0x20,%0                      \n"
+      "vpunpckhwd  %%ymm5,%%ymm2,%%ymm3          \n"  // mutates
+      "vpunpcklwd  %%ymm5,%%ymm2,%%ymm2          \n"
+      "vcvtdq2ps   %%ymm3,%%ymm3                 \n"
+      "vcvtdq2ps   %%ymm2,%%ymm2                 \n"
+      "vmulps      %%ymm3,%%ymm4,%%ymm3          \n"
+      "vmulps      %%ymm2,%%ymm4,%%ymm2          \n"
+      "vpsrld      $0xd,%%ymm3,%%ymm3            \n"
+      "vpsrld      $0xd,%%ymm2,%%ymm2            \n"
+      "vpackssdw   %%ymm3, %%ymm2, %%ymm2        \n"  // unmutates
+      "vmovdqu     %%ymm2,-0x20(%0,%1,1)         \n"
       "sub         $0x10,%2                      \n"
-      "jg          100b                          \n"
+      "jg          1b                            \n"
 
-      "99:                                       \n"
-      : "+r"(dst_ptr),               // %0
-        "+r"(src_ptr),               // %1
-        "+rm"(width),                // %2
-        "+r"(source_y_fraction)      // %3
-      : "r"((intptr_t)(src_stride))  // %4
-      : "memory", "cc", "eax", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+      "vzeroupper                                \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+#if defined(__x86_64__)
+      : "x"(scale)  // %3
+#else
+      : "m"(scale)            // %3
+#endif
+      : "memory", "cc", "xmm2", "xmm3", "xmm4", "xmm5");
 }
-#endif  // HAS_INTERPOLATEROW_SSSE3
+#endif  // HAS_HALFFLOATROW_AVX2
 
-#ifdef HAS_INTERPOLATEROW_AVX2
-// Bilinear filter 32x2 -> 32x1
-void InterpolateRow_AVX2(uint8_t* dst_ptr,
-                         const uint8_t* src_ptr,
-                         ptrdiff_t src_stride,
-                         int width,
-                         int source_y_fraction) {
+#ifdef HAS_HALFFLOATROW_F16C
+void HalfFloatRow_F16C(const uint16_t* src,
+                       uint16_t* dst,
+                       float scale,
+                       int width) {
   asm volatile(
-      "sub         %1,%0                         \n"
-      "cmp         $0x0,%3                       \n"
-      "je          100f                          \n"
-      "cmp         $0x80,%3                      \n"
-      "je          50f                           \n"
-
-      "vmovd       %3,%%xmm0                     \n"
-      "neg         %3                            \n"
-      "add         $0x100,%3                     \n"
-      "vmovd       %3,%%xmm5                     \n"
-      "vpunpcklbw  %%xmm0,%%xmm5,%%xmm5          \n"
-      "vpunpcklwd  %%xmm5,%%xmm5,%%xmm5          \n"
-      "vbroadcastss %%xmm5,%%ymm5                \n"
-      "mov         $0x80808080,%%eax             \n"
-      "vmovd       %%eax,%%xmm4                  \n"
-      "vbroadcastss %%xmm4,%%ymm4                \n"
+      "vbroadcastss %3, %%ymm4                   \n"
+      "sub         %0,%1                         \n"
 
-      // General purpose row blend.
+      // 16 pixel loop.
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%1),%%ymm0                   \n"
-      "vmovdqu     0x00(%1,%4,1),%%ymm2          \n"
-      "vpunpckhbw  %%ymm2,%%ymm0,%%ymm1          \n"
-      "vpunpcklbw  %%ymm2,%%ymm0,%%ymm0          \n"
-      "vpsubb      %%ymm4,%%ymm1,%%ymm1          \n"
-      "vpsubb      %%ymm4,%%ymm0,%%ymm0          \n"
-      "vpmaddubsw  %%ymm1,%%ymm5,%%ymm1          \n"
-      "vpmaddubsw  %%ymm0,%%ymm5,%%ymm0          \n"
-      "vpaddw      %%ymm4,%%ymm1,%%ymm1          \n"
-      "vpaddw      %%ymm4,%%ymm0,%%ymm0          \n"
-      "vpsrlw      $0x8,%%ymm1,%%ymm1            \n"
-      "vpsrlw      $0x8,%%ymm0,%%ymm0            \n"
-      "vpackuswb   %%ymm1,%%ymm0,%%ymm0          \n"
-      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x20,%2                      \n"
+      "vpmovzxwd   (%0),%%ymm2                   \n"  // 16 shorts -> 16 ints
+      "vpmovzxwd   0x10(%0),%%ymm3               \n"
+      "vcvtdq2ps   %%ymm2,%%ymm2                 \n"
+      "vcvtdq2ps   %%ymm3,%%ymm3                 \n"
+      "vmulps      %%ymm2,%%ymm4,%%ymm2          \n"
+      "vmulps      %%ymm3,%%ymm4,%%ymm3          \n"
+      "vcvtps2ph   $3, %%ymm2, %%xmm2            \n"
+      "vcvtps2ph   $3, %%ymm3, %%xmm3            \n"
+      "vmovdqu     %%xmm2,0x00(%0,%1,1)          \n"
+      "vmovdqu     %%xmm3,0x10(%0,%1,1)          \n"
+      "add         $0x20,%0                      \n"
+      "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
-      "jmp         99f                           \n"
-
-      // Blend 50 / 50.
-      LABELALIGN
-      "50:                                       \n"
-      "vmovdqu     (%1),%%ymm0                   \n"
-      "vpavgb      0x00(%1,%4,1),%%ymm0,%%ymm0   \n"
-      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x20,%2                      \n"
-      "jg          50b                           \n"
-      "jmp         99f                           \n"
-
-      // Blend 100 / 0 - Copy row unchanged.
-      LABELALIGN
-      "100:                                      \n"
-      "vmovdqu     (%1),%%ymm0                   \n"
-      "vmovdqu     %%ymm0,0x00(%1,%0,1)          \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x20,%2                      \n"
-      "jg          100b                          \n"
-
-      "99:                                       \n"
       "vzeroupper                                \n"
-      : "+r"(dst_ptr),               // %0
-        "+r"(src_ptr),               // %1
-        "+r"(width),                 // %2
-        "+r"(source_y_fraction)      // %3
-      : "r"((intptr_t)(src_stride))  // %4
-      : "memory", "cc", "eax", "xmm0", "xmm1", "xmm2", "xmm4", "xmm5");
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+#if defined(__x86_64__)
+      : "x"(scale)  // %3
+#else
+      : "m"(scale)            // %3
+#endif
+      : "memory", "cc", "xmm2", "xmm3", "xmm4");
 }
-#endif  // HAS_INTERPOLATEROW_AVX2
+#endif  // HAS_HALFFLOATROW_F16C
 
-#ifdef HAS_ARGBSHUFFLEROW_SSSE3
-// For BGRAToARGB, ABGRToARGB, RGBAToARGB, and ARGBToRGBA.
-void ARGBShuffleRow_SSSE3(const uint8_t* src_argb,
-                          uint8_t* dst_argb,
-                          const uint8_t* shuffler,
-                          int width) {
+#ifdef HAS_HALFFLOATROW_F16C
+void HalfFloat1Row_F16C(const uint16_t* src, uint16_t* dst, float, int width) {
   asm volatile(
-
-      "movdqu      (%3),%%xmm5                   \n"
-
+      "sub         %0,%1                         \n"
+      // 16 pixel loop.
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      0x10(%0),%%xmm1               \n"
-      "lea         0x20(%0),%0                   \n"
-      "pshufb      %%xmm5,%%xmm0                 \n"
-      "pshufb      %%xmm5,%%xmm1                 \n"
-      "movdqu      %%xmm0,(%1)                   \n"
-      "movdqu      %%xmm1,0x10(%1)               \n"
-      "lea         0x20(%1),%1                   \n"
-      "sub         $0x8,%2                       \n"
+      "vpmovzxwd   (%0),%%ymm2                   \n"  // 16 shorts -> 16 ints
+      "vpmovzxwd   0x10(%0),%%ymm3               \n"
+      "vcvtdq2ps   %%ymm2,%%ymm2                 \n"
+      "vcvtdq2ps   %%ymm3,%%ymm3                 \n"
+      "vcvtps2ph   $3, %%ymm2, %%xmm2            \n"
+      "vcvtps2ph   $3, %%ymm3, %%xmm3            \n"
+      "vmovdqu     %%xmm2,0x00(%0,%1,1)          \n"
+      "vmovdqu     %%xmm3,0x10(%0,%1,1)          \n"
+      "add         $0x20,%0                      \n"
+      "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_argb),  // %1
-        "+r"(width)      // %2
-      : "r"(shuffler)    // %3
-      : "memory", "cc", "xmm0", "xmm1", "xmm5");
+      "vzeroupper                                \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "memory", "cc", "xmm2", "xmm3");
 }
-#endif  // HAS_ARGBSHUFFLEROW_SSSE3
+#endif  // HAS_HALFFLOATROW_F16C
 
-#ifdef HAS_ARGBSHUFFLEROW_AVX2
-// For BGRAToARGB, ABGRToARGB, RGBAToARGB, and ARGBToRGBA.
-void ARGBShuffleRow_AVX2(const uint8_t* src_argb,
-                         uint8_t* dst_argb,
-                         const uint8_t* shuffler,
-                         int width) {
+#ifdef HAS_ARGBTORGBPLANARFLOATROW_AVX2
+// Convert 8 ARGB pixels to R, G and B float planes with scale and bias.
+void ARGBToRGBPlanarFloatRow_AVX2(const uint8_t* src_argb,
+                                  float* dst_r,
+                                  float* dst_g,
+                                  float* dst_b,
+                                  const float* scale_bias,
+                                  int width) {
   asm volatile(
-
-      "vbroadcastf128 (%3),%%ymm5                \n"
+      "vbroadcastss (%5),%%ymm2                  \n"  // scale R
+      "vbroadcastss 0x4(%5),%%ymm3               \n"  // scale G
+      "vbroadcastss 0x8(%5),%%ymm4               \n"  // scale B
+      "vbroadcastss 0x60(%5),%%ymm5              \n"  // bias R
+      "vbroadcastss 0x64(%5),%%ymm6              \n"  // bias G
+      "vbroadcastss 0x68(%5),%%ymm7              \n"  // bias B
+      "sub         %1,%2                         \n"
+      "sub         %1,%3                         \n"
 
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"
-      "vmovdqu     0x20(%0),%%ymm1               \n"
-      "lea         0x40(%0),%0                   \n"
-      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"
-      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
-      "vmovdqu     %%ymm0,(%1)                   \n"
-      "vmovdqu     %%ymm1,0x20(%1)               \n"
-      "lea         0x40(%1),%1                   \n"
-      "sub         $0x10,%2                      \n"
+      "vmovdqu     (%0),%%ymm0                   \n"  // 8 ARGB
+      "vpslld      $0x8,%%ymm0,%%ymm1            \n"  // R
+      "vpsrld      $0x18,%%ymm1,%%ymm1           \n"
+      "vcvtdq2ps   %%ymm1,%%ymm1                 \n"
+      "vmulps      %%ymm2,%%ymm1,%%ymm1          \n"
+      "vaddps      %%ymm5,%%ymm1,%%ymm1          \n"
+      "vmovups     %%ymm1,(%1)                   \n"
+      "vpslld      $0x10,%%ymm0,%%ymm1           \n"  // G
+      "vpsrld      $0x18,%%ymm1,%%ymm1           \n"
+      "vcvtdq2ps   %%ymm1,%%ymm1                 \n"
+      "vmulps      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vaddps      %%ymm6,%%ymm1,%%ymm1          \n"
+      "vmovups     %%ymm1,0x00(%1,%2,1)          \n"
+      "vpslld      $0x18,%%ymm0,%%ymm1           \n"  // B
+      "vpsrld      $0x18,%%ymm1,%%ymm1           \n"
+      "vcvtdq2ps   %%ymm1,%%ymm1                 \n"
+      "vmulps      %%ymm4,%%ymm1,%%ymm1          \n"
+      "vaddps      %%ymm7,%%ymm1,%%ymm1          \n"
+      "vmovups     %%ymm1,0x00(%1,%3,1)          \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x8,%4                       \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_argb),  // %1
-        "+r"(width)      // %2
-      : "r"(shuffler)    // %3
-      : "memory", "cc", "xmm0", "xmm1", "xmm5");
+      : "+r"(src_argb),   // %0
+        "+r"(dst_r),      // %1
+        "+r"(dst_g),      // %2
+        "+r"(dst_b),      // %3
+        "+r"(width)       // %4
+      : "r"(scale_bias)   // %5
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_ARGBSHUFFLEROW_AVX2
+#endif  // HAS_ARGBTORGBPLANARFLOATROW_AVX2
 
-#ifdef HAS_I422TOYUY2ROW_SSE2
-void I422ToYUY2Row_SSE2(const uint8_t* src_y,
-                        const uint8_t* src_u,
-                        const uint8_t* src_v,
-                        uint8_t* dst_yuy2,
+#ifdef HAS_RAWTOFLOATROW_AVX2
+// Convert 8 RAW pixels to 24 RGB floats with scale and bias.
+void RAWToFloatRow_AVX2(const uint8_t* src_raw,
+                        float* dst,
+                        const float* scale_bias,
                         int width) {
   asm volatile(
-
-      "sub         %1,%2                         \n"
-
       LABELALIGN
       "1:                                        \n"
-      "movq        (%1),%%xmm2                   \n"
-      "movq        0x00(%1,%2,1),%%xmm1          \n"
-      "add         $0x8,%1                       \n"
-      "punpcklbw   %%xmm1,%%xmm2                 \n"
-      "movdqu      (%0),%%xmm0                   \n"
-      "add         $0x10,%0                      \n"
-      "movdqa      %%xmm0,%%xmm1                 \n"
-      "punpcklbw   %%xmm2,%%xmm0                 \n"
-      "punpckhbw   %%xmm2,%%xmm1                 \n"
-      "movdqu      %%xmm0,(%3)                   \n"
-      "movdqu      %%xmm1,0x10(%3)               \n"
-      "lea         0x20(%3),%3                   \n"
-      "sub         $0x10,%4                      \n"
+      "vpmovzxbd   (%0),%%ymm0                   \n"  // 24 bytes -> 24 ints
+      "vpmovzxbd   0x8(%0),%%ymm1                \n"
+      "vpmovzxbd   0x10(%0),%%ymm2               \n"
+      "vcvtdq2ps   %%ymm0,%%ymm0                 \n"
+      "vcvtdq2ps   %%ymm1,%%ymm1                 \n"
+      "vcvtdq2ps   %%ymm2,%%ymm2                 \n"
+      "vmulps      (%3),%%ymm0,%%ymm0            \n"
+      "vmulps      0x20(%3),%%ymm1,%%ymm1        \n"
+      "vmulps      0x40(%3),%%ymm2,%%ymm2        \n"
+      "vaddps      0x60(%3),%%ymm0,%%ymm0        \n"
+      "vaddps      0x80(%3),%%ymm1,%%ymm1        \n"
+      "vaddps      0xa0(%3),%%ymm2,%%ymm2        \n"
+      "vmovups     %%ymm0,(%1)                   \n"
+      "vmovups     %%ymm1,0x20(%1)               \n"
+      "vmovups     %%ymm2,0x40(%1)               \n"
+      "lea         0x18(%0),%0                   \n"
+      "lea         0x60(%1),%1                   \n"
+      "sub         $0x8,%2                       \n"
       "jg          1b                            \n"
-      : "+r"(src_y),     // %0
-        "+r"(src_u),     // %1
-        "+r"(src_v),     // %2
-        "+r"(dst_yuy2),  // %3
-        "+rm"(width)     // %4
-      :
+      "vzeroupper                                \n"
+      : "+r"(src_raw),    // %0
+        "+r"(dst),        // %1
+        "+r"(width)       // %2
+      : "r"(scale_bias)   // %3
       : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
-#endif  // HAS_I422TOYUY2ROW_SSE2
+#endif  // HAS_RAWTOFLOATROW_AVX2
 
-#ifdef HAS_I422TOUYVYROW_SSE2
-void I422ToUYVYRow_SSE2(const uint8_t* src_y,
-                        const uint8_t* src_u,
-                        const uint8_t* src_v,
-                        uint8_t* dst_uyvy,
-                        int width) {
+#ifdef HAS_CONVERTFP32TOFP16ROW_F16C
+// Convert 16 floats to half floats, rounding to nearest even.
+void ConvertFP32ToFP16Row_F16C(const float* src, uint16_t* dst, int width) {
   asm volatile(
-
-      "sub         %1,%2                         \n"
-
       LABELALIGN
       "1:                                        \n"
-      "movq        (%1),%%xmm2                   \n"
-      "movq        0x00(%1,%2,1),%%xmm1          \n"
-      "add         $0x8,%1                       \n"
-      "punpcklbw   %%xmm1,%%xmm2                 \n"
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqa      %%xmm2,%%xmm1                 \n"
-      "add         $0x10,%0                      \n"
-      "punpcklbw   %%xmm0,%%xmm1                 \n"
-      "punpckhbw   %%xmm0,%%xmm2                 \n"
-      "movdqu      %%xmm1,(%3)                   \n"
-      "movdqu      %%xmm2,0x10(%3)               \n"
-      "lea         0x20(%3),%3                   \n"
-      "sub         $0x10,%4                      \n"
+      "vmovups     (%0),%%ymm0                   \n"
+      "vmovups     0x20(%0),%%ymm1               \n"
+      "vcvtps2ph   $0,%%ymm0,(%1)                \n"
+      "vcvtps2ph   $0,%%ymm1,0x10(%1)            \n"
+      "lea         0x40(%0),%0                   \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
-      : "+r"(src_y),     // %0
-        "+r"(src_u),     // %1
-        "+r"(src_v),     // %2
-        "+r"(dst_uyvy),  // %3
-        "+rm"(width)     // %4
+      "vzeroupper                                \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
       :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      : "memory", "cc", "xmm0", "xmm1");
 }
-#endif  // HAS_I422TOUYVYROW_SSE2
+#endif  // HAS_CONVERTFP32TOFP16ROW_F16C
 
-#ifdef HAS_I422TOYUY2ROW_AVX2
-void I422ToYUY2Row_AVX2(const uint8_t* src_y,
-                        const uint8_t* src_u,
-                        const uint8_t* src_v,
-                        uint8_t* dst_yuy2,
-                        int width) {
-  asm volatile(
+#ifdef HAS_CONVERTFP32TOINT8ROW_AVX2
+static const float kInt8Range[2] = {-128.f, 127.f};
 
-      "sub         %1,%2                         \n"
+// Convert 16 floats to int8, rounding to nearest even with saturation.
+void ConvertFP32ToInt8Row_AVX2(const float* src, int8_t* dst, int width) {
+  asm volatile(
+      "vbroadcastss %3,%%ymm4                    \n"  // -128
+      "vbroadcastss %4,%%ymm5                    \n"  // 127
 
       LABELALIGN
       "1:                                        \n"
-      "vpmovzxbw   (%1),%%ymm1                   \n"
-      "vpmovzxbw   0x00(%1,%2,1),%%ymm2          \n"
-      "add         $0x10,%1                      \n"
-      "vpsllw      $0x8,%%ymm2,%%ymm2            \n"
-      "vpor        %%ymm1,%%ymm2,%%ymm2          \n"
-      "vmovdqu     (%0),%%ymm0                   \n"
-      "add         $0x20,%0                      \n"
-      "vpunpcklbw  %%ymm2,%%ymm0,%%ymm1          \n"
-      "vpunpckhbw  %%ymm2,%%ymm0,%%ymm2          \n"
-      "vextractf128 $0x0,%%ymm1,(%3)             \n"
-      "vextractf128 $0x0,%%ymm2,0x10(%3)         \n"
-      "vextractf128 $0x1,%%ymm1,0x20(%3)         \n"
-      "vextractf128 $0x1,%%ymm2,0x30(%3)         \n"
-      "lea         0x40(%3),%3                   \n"
-      "sub         $0x20,%4                      \n"
+      "vmaxps      (%0),%%ymm4,%%ymm0            \n"
+      "vmaxps      0x20(%0),%%ymm4,%%ymm1        \n"
+      "vminps      %%ymm5,%%ymm0,%%ymm0          \n"
+      "vminps      %%ymm5,%%ymm1,%%ymm1          \n"
+      "vcvtps2dq   %%ymm0,%%ymm0                 \n"
+      "vcvtps2dq   %%ymm1,%%ymm1                 \n"
+      "vpackssdw   %%ymm1,%%ymm0,%%ymm0          \n"  // mutates
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"  // unmutate
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpacksswb   %%xmm1,%%xmm0,%%xmm0          \n"
+      "vmovdqu     %%xmm0,(%1)                   \n"
+      "lea         0x40(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_y),     // %0
-        "+r"(src_u),     // %1
-        "+r"(src_v),     // %2
-        "+r"(dst_yuy2),  // %3
-        "+rm"(width)     // %4
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      : "+r"(src),           // %0
+        "+r"(dst),           // %1
+        "+r"(width)          // %2
+      : "m"(kInt8Range[0]),  // %3
+        "m"(kInt8Range[1])   // %4
+      : "memory", "cc", "xmm0", "xmm1", "xmm4", "xmm5");
 }
-#endif  // HAS_I422TOYUY2ROW_AVX2
+#endif  // HAS_CONVERTFP32TOINT8ROW_AVX2
 
-#ifdef HAS_I422TOUYVYROW_AVX2
-void I422ToUYVYRow_AVX2(const uint8_t* src_y,
-                        const uint8_t* src_u,
-                        const uint8_t* src_v,
-                        uint8_t* dst_uyvy,
-                        int width) {
+#ifdef HAS_ARGBCOLORTABLEROW_X86
+// Tranform ARGB pixels with color table.
+void ARGBColorTableRow_X86(uint8_t* dst_argb,
+                           const uint8_t* table_argb,
+                           int width) {
+  uintptr_t pixel_temp;
   asm volatile(
-
-      "sub         %1,%2                         \n"
-
+      // 1 pixel loop.
       LABELALIGN
       "1:                                        \n"
-      "vpmovzxbw   (%1),%%ymm1                   \n"
-      "vpmovzxbw   0x00(%1,%2,1),%%ymm2          \n"
-      "add         $0x10,%1                      \n"
-      "vpsllw      $0x8,%%ymm2,%%ymm2            \n"
-      "vpor        %%ymm1,%%ymm2,%%ymm2          \n"
-      "vmovdqu     (%0),%%ymm0                   \n"
-      "add         $0x20,%0                      \n"
-      "vpunpcklbw  %%ymm0,%%ymm2,%%ymm1          \n"
-      "vpunpckhbw  %%ymm0,%%ymm2,%%ymm2          \n"
-      "vextractf128 $0x0,%%ymm1,(%3)             \n"
-      "vextractf128 $0x0,%%ymm2,0x10(%3)         \n"
-      "vextractf128 $0x1,%%ymm1,0x20(%3)         \n"
-      "vextractf128 $0x1,%%ymm2,0x30(%3)         \n"
-      "lea         0x40(%3),%3                   \n"
-      "sub         $0x20,%4                      \n"
+      "movzb       (%0),%1                       \n"
+      "lea         0x4(%0),%0                    \n"
+      "movzb       0x00(%3,%1,4),%1              \n"
+      "mov         %b1,-0x4(%0)                  \n"
+      "movzb       -0x3(%0),%1                   \n"
+      "movzb       0x01(%3,%1,4),%1              \n"
+      "mov         %b1,-0x3(%0)                  \n"
+      "movzb       -0x2(%0),%1                   \n"
+      "movzb       0x02(%3,%1,4),%1              \n"
+      "mov         %b1,-0x2(%0)                  \n"
+      "movzb       -0x1(%0),%1                   \n"
+      "movzb       0x03(%3,%1,4),%1              \n"
+      "mov         %b1,-0x1(%0)                  \n"
+      "dec         %2                            \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_y),     // %0
-        "+r"(src_u),     // %1
-        "+r"(src_v),     // %2
-        "+r"(dst_uyvy),  // %3
-        "+rm"(width)     // %4
-      :
-      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+      : "+r"(dst_argb),     // %0
+        "=&d"(pixel_temp),  // %1
+        "+r"(width)         // %2
+      : "r"(table_argb)     // %3
+      : "memory", "cc");
 }
-#endif  // HAS_I422TOUYVYROW_AVX2
+#endif  // HAS_ARGBCOLORTABLEROW_X86
 
-#ifdef HAS_ARGBPOLYNOMIALROW_SSE2
-void ARGBPolynomialRow_SSE2(const uint8_t* src_argb,
-                            uint8_t* dst_argb,
-                            const float* poly,
-                            int width) {
+#ifdef HAS_RGBCOLORTABLEROW_X86
+// Tranform RGB pixels with color table.
+void RGBColorTableRow_X86(uint8_t* dst_argb,
+                          const uint8_t* table_argb,
+                          int width) {
+  uintptr_t pixel_temp;
   asm volatile(
+      // 1 pixel loop.
+      LABELALIGN
+      "1:                                        \n"
+      "movzb       (%0),%1                       \n"
+      "lea         0x4(%0),%0                    \n"
+      "movzb       0x00(%3,%1,4),%1              \n"
+      "mov         %b1,-0x4(%0)                  \n"
+      "movzb       -0x3(%0),%1                   \n"
+      "movzb       0x01(%3,%1,4),%1              \n"
+      "mov         %b1,-0x3(%0)                  \n"
+      "movzb       -0x2(%0),%1                   \n"
+      "movzb       0x02(%3,%1,4),%1              \n"
+      "mov         %b1,-0x2(%0)                  \n"
+      "dec         %2                            \n"
+      "jg          1b                            \n"
+      : "+r"(dst_argb),     // %0
+        "=&d"(pixel_temp),  // %1
+        "+r"(width)         // %2
+      : "r"(table_argb)     // %3
+      : "memory", "cc");
+}
+#endif  // HAS_RGBCOLORTABLEROW_X86
 
-      "pxor        %%xmm3,%%xmm3                 \n"
+#ifdef HAS_ARGBLUMACOLORTABLEROW_SSSE3
+// Tranform RGB pixels with luma table.
+void ARGBLumaColorTableRow_SSSE3(const uint8_t* src_argb,
+                                 uint8_t* dst_argb,
+                                 int width,
+                                 const uint8_t* luma,
+                                 uint32_t lumacoeff) {
+  uintptr_t pixel_temp;
+  uintptr_t table_temp;
+  asm volatile(
+      "movd        %6,%%xmm3                     \n"
+      "pshufd      $0x0,%%xmm3,%%xmm3            \n"
+      "pcmpeqb     %%xmm4,%%xmm4                 \n"
+      "psllw       $0x8,%%xmm4                   \n"
+      "pxor        %%xmm5,%%xmm5                 \n"
 
-      // 2 pixel loop.
+      // 4 pixel loop.
       LABELALIGN
       "1:                                        \n"
-      "movq        (%0),%%xmm0                   \n"
-      "lea         0x8(%0),%0                    \n"
-      "punpcklbw   %%xmm3,%%xmm0                 \n"
-      "movdqa      %%xmm0,%%xmm4                 \n"
-      "punpcklwd   %%xmm3,%%xmm0                 \n"
-      "punpckhwd   %%xmm3,%%xmm4                 \n"
-      "cvtdq2ps    %%xmm0,%%xmm0                 \n"
-      "cvtdq2ps    %%xmm4,%%xmm4                 \n"
-      "movdqa      %%xmm0,%%xmm1                 \n"
-      "movdqa      %%xmm4,%%xmm5                 \n"
-      "mulps       0x10(%3),%%xmm0               \n"
-      "mulps       0x10(%3),%%xmm4               \n"
-      "addps       (%3),%%xmm0                   \n"
-      "addps       (%3),%%xmm4                   \n"
-      "movdqa      %%xmm1,%%xmm2                 \n"
-      "movdqa      %%xmm5,%%xmm6                 \n"
-      "mulps       %%xmm1,%%xmm2                 \n"
-      "mulps       %%xmm5,%%xmm6                 \n"
-      "mulps       %%xmm2,%%xmm1                 \n"
-      "mulps       %%xmm6,%%xmm5                 \n"
-      "mulps       0x20(%3),%%xmm2               \n"
-      "mulps       0x20(%3),%%xmm6               \n"
-      "mulps       0x30(%3),%%xmm1               \n"
-      "mulps       0x30(%3),%%xmm5               \n"
-      "addps       %%xmm2,%%xmm0                 \n"
-      "addps       %%xmm6,%%xmm4                 \n"
-      "addps       %%xmm1,%%xmm0                 \n"
-      "addps       %%xmm5,%%xmm4                 \n"
-      "cvttps2dq   %%xmm0,%%xmm0                 \n"
-      "cvttps2dq   %%xmm4,%%xmm4                 \n"
-      "packuswb    %%xmm4,%%xmm0                 \n"
-      "packuswb    %%xmm0,%%xmm0                 \n"
-      "movq        %%xmm0,(%1)                   \n"
-      "lea         0x8(%1),%1                    \n"
-      "sub         $0x2,%2                       \n"
+      "movdqu      (%2),%%xmm0                   \n"
+      "pmaddubsw   %%xmm3,%%xmm0                 \n"
+      "phaddw      %%xmm0,%%xmm0                 \n"
+      "pand        %%xmm4,%%xmm0                 \n"
+      "punpcklwd   %%xmm5,%%xmm0                 \n"
+      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
+      "add         %5,%1                         \n"
+      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
+
+      "movzb       (%2),%0                       \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,(%3)                      \n"
+      "movzb       0x1(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0x1(%3)                   \n"
+      "movzb       0x2(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0x2(%3)                   \n"
+      "movzb       0x3(%2),%0                    \n"
+      "mov         %b0,0x3(%3)                   \n"
+
+      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
+      "add         %5,%1                         \n"
+      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
+
+      "movzb       0x4(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0x4(%3)                   \n"
+      "movzb       0x5(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0x5(%3)                   \n"
+      "movzb       0x6(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0x6(%3)                   \n"
+      "movzb       0x7(%2),%0                    \n"
+      "mov         %b0,0x7(%3)                   \n"
+
+      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
+      "add         %5,%1                         \n"
+      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
+
+      "movzb       0x8(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0x8(%3)                   \n"
+      "movzb       0x9(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0x9(%3)                   \n"
+      "movzb       0xa(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0xa(%3)                   \n"
+      "movzb       0xb(%2),%0                    \n"
+      "mov         %b0,0xb(%3)                   \n"
+
+      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
+      "add         %5,%1                         \n"
+
+      "movzb       0xc(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0xc(%3)                   \n"
+      "movzb       0xd(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0xd(%3)                   \n"
+      "movzb       0xe(%2),%0                    \n"
+      "movzb       0x00(%1,%0,1),%0              \n"
+      "mov         %b0,0xe(%3)                   \n"
+      "movzb       0xf(%2),%0                    \n"
+      "mov         %b0,0xf(%3)                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "lea         0x10(%3),%3                   \n"
+      "sub         $0x4,%4                       \n"
       "jg          1b                            \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_argb),  // %1
-        "+r"(width)      // %2
-      : "r"(poly)        // %3
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+      : "=&d"(pixel_temp),  // %0
+        "=&a"(table_temp),  // %1
+        "+r"(src_argb),     // %2
+        "+r"(dst_argb),     // %3
+        "+rm"(width)        // %4
+      : "r"(luma),          // %5
+        "rm"(lumacoeff)     // %6
+      : "memory", "cc", "xmm0", "xmm3", "xmm4", "xmm5");
 }
-#endif  // HAS_ARGBPOLYNOMIALROW_SSE2
+#endif  // HAS_ARGBLUMACOLORTABLEROW_SSSE3
 
-#ifdef HAS_ARGBPOLYNOMIALROW_AVX2
-void ARGBPolynomialRow_AVX2(const uint8_t* src_argb,
-                            uint8_t* dst_argb,
-                            const float* poly,
-                            int width) {
-  asm volatile(
-      "vbroadcastf128 (%3),%%ymm4                \n"
-      "vbroadcastf128 0x10(%3),%%ymm5            \n"
-      "vbroadcastf128 0x20(%3),%%ymm6            \n"
-      "vbroadcastf128 0x30(%3),%%ymm7            \n"
+static const uvec8 kYUV24Shuffle[3] = {
+    {8, 9, 0, 8, 9, 1, 10, 11, 2, 10, 11, 3, 12, 13, 4, 12},
+    {9, 1, 10, 11, 2, 10, 11, 3, 12, 13, 4, 12, 13, 5, 14, 15},
+    {2, 10, 11, 3, 12, 13, 4, 12, 13, 5, 14, 15, 6, 14, 15, 7}};
 
-      // 2 pixel loop.
-      LABELALIGN
+// Convert biplanar NV21 to packed YUV24
+// NV21 has VU in memory for chroma.
+// YUV24 is VUY in memory
+void NV21ToYUV24Row_SSSE3(const uint8_t* src_y,
+                          const uint8_t* src_vu,
+                          uint8_t* dst_yuv24,
+                          int width) {
+  asm volatile(
+      "sub         %0,%1                         \n"
+      "movdqa      (%4),%%xmm4                   \n"  // 3 shuffler constants
+      "movdqa      16(%4),%%xmm5                 \n"
+      "movdqa      32(%4),%%xmm6                 \n"
       "1:                                        \n"
-      "vpmovzxbd   (%0),%%ymm0                   \n"  // 2 ARGB pixels
-      "lea         0x8(%0),%0                    \n"
-      "vcvtdq2ps   %%ymm0,%%ymm0                 \n"  // X 8 floats
-      "vmulps      %%ymm0,%%ymm0,%%ymm2          \n"  // X * X
-      "vmulps      %%ymm7,%%ymm0,%%ymm3          \n"  // C3 * X
-      "vfmadd132ps %%ymm5,%%ymm4,%%ymm0          \n"  // result = C0 + C1 * X
-      "vfmadd231ps %%ymm6,%%ymm2,%%ymm0          \n"  // result += C2 * X * X
-      "vfmadd231ps %%ymm3,%%ymm2,%%ymm0          \n"  // result += C3 * X * X *
-                                                      // X
-      "vcvttps2dq  %%ymm0,%%ymm0                 \n"
-      "vpackusdw   %%ymm0,%%ymm0,%%ymm0          \n"
-      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
-      "vpackuswb   %%xmm0,%%xmm0,%%xmm0          \n"
-      "vmovq       %%xmm0,(%1)                   \n"
-      "lea         0x8(%1),%1                    \n"
-      "sub         $0x2,%2                       \n"
+      "movdqu      (%0),%%xmm2                   \n"  // load 16 Y values
+      "movdqu      (%0,%1),%%xmm3                \n"  // load 8 VU values
+      "lea         16(%0),%0                     \n"
+      "movdqa      %%xmm2,%%xmm0                 \n"
+      "movdqa      %%xmm2,%%xmm1                 \n"
+      "shufps      $0x44,%%xmm3,%%xmm0           \n"  // Y 0..7,  UV 0..3
+      "shufps      $0x99,%%xmm3,%%xmm1           \n"  // Y 4..11, UV 2..5
+      "shufps      $0xee,%%xmm3,%%xmm2           \n"  // Y 8..15, UV 4..7
+      "pshufb      %%xmm4, %%xmm0                \n"  // weave into YUV24
+      "pshufb      %%xmm5, %%xmm1                \n"
+      "pshufb      %%xmm6, %%xmm2                \n"
+      "movdqu      %%xmm0,(%2)                   \n"
+      "movdqu      %%xmm1,16(%2)                 \n"
+      "movdqu      %%xmm2,32(%2)                 \n"
+      "lea         48(%2),%2                     \n"
+      "sub         $16,%3                        \n"  // 16 pixels per loop
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_argb),  // %0
-        "+r"(dst_argb),  // %1
-        "+r"(width)      // %2
-      : "r"(poly)        // %3
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
-        "xmm7");
+      : "+r"(src_y),            // %0
+        "+r"(src_vu),           // %1
+        "+r"(dst_yuv24),        // %2
+        "+r"(width)             // %3
+      : "r"(&kYUV24Shuffle[0])  // %4
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
 }
-#endif  // HAS_ARGBPOLYNOMIALROW_AVX2
 
-#ifdef HAS_HALFFLOATROW_SSE2
-static float kScaleBias = 1.9259299444e-34f;
-void HalfFloatRow_SSE2(const uint16_t* src,
-                       uint16_t* dst,
-                       float scale,
-                       int width) {
-  scale *= kScaleBias;
+// Convert biplanar NV21 to packed YUV24
+// NV21 has VU in memory for chroma.
+// YUV24 is VUY in memory
+void NV21ToYUV24Row_AVX2(const uint8_t* src_y,
+                         const uint8_t* src_vu,
+                         uint8_t* dst_yuv24,
+                         int width) {
   asm volatile(
-      "movd        %3,%%xmm4                     \n"
-      "pshufd      $0x0,%%xmm4,%%xmm4            \n"
-      "pxor        %%xmm5,%%xmm5                 \n"
       "sub         %0,%1                         \n"
+      "vbroadcastf128 (%4),%%ymm4                \n"  // 3 shuffler constants
+      "vbroadcastf128 16(%4),%%ymm5              \n"
+      "vbroadcastf128 32(%4),%%ymm6              \n"
 
-      // 16 pixel loop.
-      LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm2                   \n"  // 8 shorts
-      "add         $0x10,%0                      \n"
-      "movdqa      %%xmm2,%%xmm3                 \n"
-      "punpcklwd   %%xmm5,%%xmm2                 \n"  // 8 ints in xmm2/1
-      "cvtdq2ps    %%xmm2,%%xmm2                 \n"  // 8 floats
-      "punpckhwd   %%xmm5,%%xmm3                 \n"
-      "cvtdq2ps    %%xmm3,%%xmm3                 \n"
-      "mulps       %%xmm4,%%xmm2                 \n"
-      "mulps       %%xmm4,%%xmm3                 \n"
-      "psrld       $0xd,%%xmm2                   \n"
-      "psrld       $0xd,%%xmm3                   \n"
-      "packssdw    %%xmm3,%%xmm2                 \n"
-      "movdqu      %%xmm2,-0x10(%0,%1,1)         \n"
-      "sub         $0x8,%2                       \n"
+      "vmovdqu     (%0),%%ymm2                   \n"  // load 32 Y values
+      "vmovdqu     (%0,%1),%%ymm3                \n"  // load 16 VU values
+      "lea         32(%0),%0                     \n"
+      "vshufps     $0x44,%%ymm3,%%ymm2,%%ymm0    \n"  // Y 0..7,  UV 0..3
+      "vshufps     $0x99,%%ymm3,%%ymm2,%%ymm1    \n"  // Y 4..11, UV 2..5
+      "vshufps     $0xee,%%ymm3,%%ymm2,%%ymm2    \n"  // Y 8..15, UV 4..7
+      "vpshufb     %%ymm4,%%ymm0,%%ymm0          \n"  // weave into YUV24
+      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpshufb     %%ymm6,%%ymm2,%%ymm2          \n"
+      "vperm2i128  $0x20,%%ymm1,%%ymm0,%%ymm3    \n"
+      "vperm2i128  $0x30,%%ymm0,%%ymm2,%%ymm0    \n"
+      "vperm2i128  $0x31,%%ymm2,%%ymm1,%%ymm1    \n"
+      "vmovdqu     %%ymm3,(%2)                   \n"
+      "vmovdqu     %%ymm0,32(%2)                 \n"
+      "vmovdqu     %%ymm1,64(%2)                 \n"
+      "lea         96(%2),%2                     \n"
+      "sub         $32,%3                        \n"  // 32 pixels per loop
       "jg          1b                            \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-      : "m"(scale)   // %3
-      : "memory", "cc", "xmm2", "xmm3", "xmm4", "xmm5");
+      "vzeroupper                                \n"
+      : "+r"(src_y),            // %0
+        "+r"(src_vu),           // %1
+        "+r"(dst_yuv24),        // %2
+        "+r"(width)             // %3
+      : "r"(&kYUV24Shuffle[0])  // %4
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
 }
-#endif  // HAS_HALFFLOATROW_SSE2
 
-#ifdef HAS_HALFFLOATROW_AVX2
-void HalfFloatRow_AVX2(const uint16_t* src,
-                       uint16_t* dst,
-                       float scale,
-                       int width) {
-  scale *= kScaleBias;
+#ifdef HAS_NV21ToYUV24ROW_AVX512
+// The following VMBI VEX256 code tests okay with the intelsde emulator.
+static const lvec8 kYUV24Perm[3] = {
+    {32, 33, 0,  32, 33, 1,  34, 35, 2,  34, 35, 3,  36, 37, 4,  36,
+     37, 5,  38, 39, 6,  38, 39, 7,  40, 41, 8,  40, 41, 9,  42, 43},
+    {10, 42, 43, 11, 44, 45, 12, 44, 45, 13, 46, 47, 14, 46, 47, 15,
+     48, 49, 16, 48, 49, 17, 50, 51, 18, 50, 51, 19, 52, 53, 20, 52},
+    {53, 21, 54, 55, 22, 54, 55, 23, 56, 57, 24, 56, 57, 25, 58, 59,
+     26, 58, 59, 27, 60, 61, 28, 60, 61, 29, 62, 63, 30, 62, 63, 31}};
+
+void NV21ToYUV24Row_AVX512(const uint8_t* src_y,
+                           const uint8_t* src_vu,
+                           uint8_t* dst_yuv24,
+                           int width) {
   asm volatile(
-      "vbroadcastss %3, %%ymm4                   \n"
-      "vpxor       %%ymm5,%%ymm5,%%ymm5          \n"
       "sub         %0,%1                         \n"
-
-      // 16 pixel loop.
-      LABELALIGN
+      "vmovdqa     (%4),%%ymm4                   \n"  // 3 shuffler constants
+      "vmovdqa     32(%4),%%ymm5                 \n"
+      "vmovdqa     64(%4),%%ymm6                 \n" LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm2                   \n"  // 16 shorts
-      "add         $0x20,%0                      \n"
-      "vpunpckhwd  %%ymm5,%%ymm2,%%ymm3          \n"  // mutates
-      "vpunpcklwd  %%ymm5,%%ymm2,%%ymm2          \n"
-      "vcvtdq2ps   %%ymm3,%%ymm3                 \n"
-      "vcvtdq2ps   %%ymm2,%%ymm2                 \n"
-      "vmulps      %%ymm3,%%ymm4,%%ymm3          \n"
-      "vmulps      %%ymm2,%%ymm4,%%ymm2          \n"
-      "vpsrld      $0xd,%%ymm3,%%ymm3            \n"
-      "vpsrld      $0xd,%%ymm2,%%ymm2            \n"
-      "vpackssdw   %%ymm3, %%ymm2, %%ymm2        \n"  // unmutates
-      "vmovdqu     %%ymm2,-0x20(%0,%1,1)         \n"
-      "sub         $0x10,%2                      \n"
+      "vmovdqu     (%0),%%ymm2                   \n"  // load 32 Y values
+      "vmovdqu     (%0,%1),%%ymm3                \n"  // load 16 VU values
+      "lea         32(%0),%0                     \n"
+      "vmovdqa     %%ymm2, %%ymm0                \n"
+      "vmovdqa     %%ymm2, %%ymm1                \n"
+      "vpermt2b    %%ymm3,%%ymm4,%%ymm0          \n"
+      "vpermt2b    %%ymm3,%%ymm5,%%ymm1          \n"
+      "vpermt2b    %%ymm3,%%ymm6,%%ymm2          \n"
+      "vmovdqu     %%ymm0,(%2)                   \n"
+      "vmovdqu     %%ymm1,32(%2)                 \n"
+      "vmovdqu     %%ymm2,64(%2)                 \n"
+      "lea         96(%2),%2                     \n"
+      "sub         $32,%3                        \n"
       "jg          1b                            \n"
-
       "vzeroupper                                \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-#if defined(__x86_64__)
-      : "x"(scale)  // %3
-#else
-      : "m"(scale)            // %3
-#endif
-      : "memory", "cc", "xmm2", "xmm3", "xmm4", "xmm5");
+      : "+r"(src_y),         // %0
+        "+r"(src_vu),        // %1
+        "+r"(dst_yuv24),     // %2
+        "+r"(width)          // %3
+      : "r"(&kYUV24Perm[0])  // %4
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
 }
-#endif  // HAS_HALFFLOATROW_AVX2
 
-#ifdef HAS_HALFFLOATROW_F16C
-void HalfFloatRow_F16C(const uint16_t* src,
-                       uint16_t* dst,
-                       float scale,
-                       int width) {
+#endif  // HAS_NV21ToYUV24ROW_AVX512
+
+#ifdef HAS_SWAPUVROW_SSSE3
+
+// Shuffle table for reversing the bytes.
+static const uvec8 kShuffleUVToVU = {1u, 0u, 3u,  2u,  5u,  4u,  7u,  6u,
+                                     9u, 8u, 11u, 10u, 13u, 12u, 15u, 14u};
+
+// Convert UV plane of NV12 to VU of NV21.
+void SwapUVRow_SSSE3(const uint8_t* src_uv, uint8_t* dst_vu, int width) {
   asm volatile(
-      "vbroadcastss %3, %%ymm4                   \n"
-      "sub         %0,%1                         \n"
 
-      // 16 pixel loop.
+      "movdqu      %3,%%xmm5                     \n"
+
       LABELALIGN
       "1:                                        \n"
-      "vpmovzxwd   (%0),%%ymm2                   \n"  // 16 shorts -> 16 ints
-      "vpmovzxwd   0x10(%0),%%ymm3               \n"
-      "vcvtdq2ps   %%ymm2,%%ymm2                 \n"
-      "vcvtdq2ps   %%ymm3,%%ymm3                 \n"
-      "vmulps      %%ymm2,%%ymm4,%%ymm2          \n"
-      "vmulps      %%ymm3,%%ymm4,%%ymm3          \n"
-      "vcvtps2ph   $3, %%ymm2, %%xmm2            \n"
-      "vcvtps2ph   $3, %%ymm3, %%xmm3            \n"
-      "vmovdqu     %%xmm2,0x00(%0,%1,1)          \n"
-      "vmovdqu     %%xmm3,0x10(%0,%1,1)          \n"
-      "add         $0x20,%0                      \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "lea         0x20(%0),%0                   \n"
+      "pshufb      %%xmm5,%%xmm0                 \n"
+      "pshufb      %%xmm5,%%xmm1                 \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "movdqu      %%xmm1,0x10(%1)               \n"
+      "lea         0x20(%1),%1                   \n"
       "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-#if defined(__x86_64__)
-      : "x"(scale)  // %3
-#else
-      : "m"(scale)            // %3
-#endif
-      : "memory", "cc", "xmm2", "xmm3", "xmm4");
+      : "+r"(src_uv),        // %0
+        "+r"(dst_vu),        // %1
+        "+r"(width)          // %2
+      : "m"(kShuffleUVToVU)  // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm5");
 }
-#endif  // HAS_HALFFLOATROW_F16C
+#endif  // HAS_SWAPUVROW_SSSE3
 
-#ifdef HAS_HALFFLOATROW_F16C
-void HalfFloat1Row_F16C(const uint16_t* src, uint16_t* dst, float, int width) {
+#ifdef HAS_SWAPUVROW_AVX2
+void SwapUVRow_AVX2(const uint8_t* src_uv, uint8_t* dst_vu, int width) {
   asm volatile(
-      "sub         %0,%1                         \n"
-      // 16 pixel loop.
+
+      "vbroadcastf128 %3,%%ymm5                  \n"
+
       LABELALIGN
       "1:                                        \n"
-      "vpmovzxwd   (%0),%%ymm2                   \n"  // 16 shorts -> 16 ints
-      "vpmovzxwd   0x10(%0),%%ymm3               \n"
-      "vcvtdq2ps   %%ymm2,%%ymm2                 \n"
-      "vcvtdq2ps   %%ymm3,%%ymm3                 \n"
-      "vcvtps2ph   $3, %%ymm2, %%xmm2            \n"
-      "vcvtps2ph   $3, %%ymm3, %%xmm3            \n"
-      "vmovdqu     %%xmm2,0x00(%0,%1,1)          \n"
-      "vmovdqu     %%xmm3,0x10(%0,%1,1)          \n"
-      "add         $0x20,%0                      \n"
-      "sub         $0x10,%2                      \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "lea         0x40(%0),%0                   \n"
+      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "vmovdqu     %%ymm1,0x20(%1)               \n"
+      "lea         0x40(%1),%1                   \n"
+      "sub         $0x20,%2                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src),   // %0
-        "+r"(dst),   // %1
-        "+r"(width)  // %2
-      :
-      : "memory", "cc", "xmm2", "xmm3");
+      : "+r"(src_uv),        // %0
+        "+r"(dst_vu),        // %1
+        "+r"(width)          // %2
+      : "m"(kShuffleUVToVU)  // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm5");
 }
-#endif  // HAS_HALFFLOATROW_F16C
+#endif  // HAS_SWAPUVROW_AVX2
 
-#ifdef HAS_ARGBCOLORTABLEROW_X86
-// Tranform ARGB pixels with color table.
-void ARGBColorTableRow_X86(uint8_t* dst_argb,
-                           const uint8_t* table_argb,
-                           int width) {
-  uintptr_t pixel_temp;
+void HalfMergeUVRow_SSSE3(const uint8_t* src_u,
+                          int src_stride_u,
+                          const uint8_t* src_v,
+                          int src_stride_v,
+                          uint8_t* dst_uv,
+                          int width) {
   asm volatile(
-      // 1 pixel loop.
+      "pcmpeqb     %%xmm4,%%xmm4                 \n"
+      "psrlw       $0xf,%%xmm4                   \n"
+      "packuswb    %%xmm4,%%xmm4                 \n"
+      "pxor        %%xmm5,%%xmm5                 \n"
+
       LABELALIGN
       "1:                                        \n"
-      "movzb       (%0),%1                       \n"
-      "lea         0x4(%0),%0                    \n"
-      "movzb       0x00(%3,%1,4),%1              \n"
-      "mov         %b1,-0x4(%0)                  \n"
-      "movzb       -0x3(%0),%1                   \n"
-      "movzb       0x01(%3,%1,4),%1              \n"
-      "mov         %b1,-0x3(%0)                  \n"
-      "movzb       -0x2(%0),%1                   \n"
-      "movzb       0x02(%3,%1,4),%1              \n"
-      "mov         %b1,-0x2(%0)                  \n"
-      "movzb       -0x1(%0),%1                   \n"
-      "movzb       0x03(%3,%1,4),%1              \n"
-      "mov         %b1,-0x1(%0)                  \n"
-      "dec         %2                            \n"
+      "movdqu      (%0),%%xmm0                   \n"  // load 16 U values
+      "movdqu      (%1),%%xmm1                   \n"  // load 16 V values
+      "movdqu      0(%0,%4,1),%%xmm2             \n"  // 16 from next row
+      "movdqu      0(%1,%5,1),%%xmm3             \n"
+      "lea         0x10(%0),%0                   \n"
+      "pmaddubsw   %%xmm4,%%xmm0                 \n"  // half size
+      "pmaddubsw   %%xmm4,%%xmm1                 \n"
+      "pmaddubsw   %%xmm4,%%xmm2                 \n"
+      "pmaddubsw   %%xmm4,%%xmm3                 \n"
+      "lea         0x10(%1),%1                   \n"
+      "paddw       %%xmm2,%%xmm0                 \n"
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "psrlw       $0x1,%%xmm0                   \n"
+      "psrlw       $0x1,%%xmm1                   \n"
+      "pavgw       %%xmm5,%%xmm0                 \n"
+      "pavgw       %%xmm5,%%xmm1                 \n"
+      "packuswb    %%xmm0,%%xmm0                 \n"
+      "packuswb    %%xmm1,%%xmm1                 \n"
+      "punpcklbw   %%xmm1,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%2)                   \n"  // store 8 UV pixels
+      "lea         0x10(%2),%2                   \n"
+      "sub         $0x10,%3                      \n"  // 16 src pixels per loop
       "jg          1b                            \n"
-      : "+r"(dst_argb),     // %0
-        "=&d"(pixel_temp),  // %1
-        "+r"(width)         // %2
-      : "r"(table_argb)     // %3
-      : "memory", "cc");
+      : "+r"(src_u),                    // %0
+        "+r"(src_v),                    // %1
+        "+r"(dst_uv),                   // %2
+        "+r"(width)                     // %3
+      : "r"((intptr_t)(src_stride_u)),  // %4
+        "r"((intptr_t)(src_stride_v))   // %5
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
 }
-#endif  // HAS_ARGBCOLORTABLEROW_X86
 
-#ifdef HAS_RGBCOLORTABLEROW_X86
-// Tranform RGB pixels with color table.
-void RGBColorTableRow_X86(uint8_t* dst_argb,
-                          const uint8_t* table_argb,
-                          int width) {
-  uintptr_t pixel_temp;
+void HalfMergeUVRow_AVX2(const uint8_t* src_u,
+                         int src_stride_u,
+                         const uint8_t* src_v,
+                         int src_stride_v,
+                         uint8_t* dst_uv,
+                         int width) {
   asm volatile(
-      // 1 pixel loop.
+      "vpcmpeqb    %%ymm4,%%ymm4,%%ymm4          \n"
+      "vpsrlw      $0xf,%%ymm4,%%ymm4            \n"
+      "vpackuswb   %%ymm4,%%ymm4,%%ymm4          \n"
+      "vpxor       %%ymm5,%%ymm5,%%ymm5          \n"
+
       LABELALIGN
       "1:                                        \n"
-      "movzb       (%0),%1                       \n"
-      "lea         0x4(%0),%0                    \n"
-      "movzb       0x00(%3,%1,4),%1              \n"
-      "mov         %b1,-0x4(%0)                  \n"
-      "movzb       -0x3(%0),%1                   \n"
-      "movzb       0x01(%3,%1,4),%1              \n"
-      "mov         %b1,-0x3(%0)                  \n"
-      "movzb       -0x2(%0),%1                   \n"
-      "movzb       0x02(%3,%1,4),%1              \n"
-      "mov         %b1,-0x2(%0)                  \n"
-      "dec         %2                            \n"
+      "vmovdqu     (%0),%%ymm0                   \n"  // load 32 U values
+      "vmovdqu     (%1),%%ymm1                   \n"  // load 32 V values
+      "vmovdqu     0(%0,%4,1),%%ymm2             \n"  // 32 from next row
+      "vmovdqu     0(%1,%5,1),%%ymm3             \n"
+      "lea         0x20(%0),%0                   \n"
+      "vpmaddubsw  %%ymm4,%%ymm0,%%ymm0          \n"  // half size
+      "vpmaddubsw  %%ymm4,%%ymm1,%%ymm1          \n"
+      "vpmaddubsw  %%ymm4,%%ymm2,%%ymm2          \n"
+      "vpmaddubsw  %%ymm4,%%ymm3,%%ymm3          \n"
+      "lea         0x20(%1),%1                   \n"
+      "vpaddw      %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpaddw      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vpsrlw      $0x1,%%ymm0,%%ymm0            \n"
+      "vpsrlw      $0x1,%%ymm1,%%ymm1            \n"
+      "vpavgw      %%ymm5,%%ymm0,%%ymm0          \n"
+      "vpavgw      %%ymm5,%%ymm1,%%ymm1          \n"
+      "vpackuswb   %%ymm0,%%ymm0,%%ymm0          \n"
+      "vpackuswb   %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpunpcklbw  %%ymm1,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,(%2)                   \n"  // store 16 UV pixels
+      "lea         0x20(%2),%2                   \n"
+      "sub         $0x20,%3                      \n"  // 32 src pixels per loop
       "jg          1b                            \n"
-      : "+r"(dst_argb),     // %0
-        "=&d"(pixel_temp),  // %1
-        "+r"(width)         // %2
-      : "r"(table_argb)     // %3
-      : "memory", "cc");
+      "vzeroupper                                \n"
+      : "+r"(src_u),                    // %0
+        "+r"(src_v),                    // %1
+        "+r"(dst_uv),                   // %2
+        "+r"(width)                     // %3
+      : "r"((intptr_t)(src_stride_u)),  // %4
+        "r"((intptr_t)(src_stride_v))   // %5
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+
+#ifdef HAS_GAUSSCOL_8_SSSE3
+static const uvec8 kGaussCol14 = {1, 4, 1, 4, 1, 4, 1, 4,
+                                  1, 4, 1, 4, 1, 4, 1, 4};
+static const uvec8 kGaussCol64 = {6, 4, 6, 4, 6, 4, 6, 4,
+                                  6, 4, 6, 4, 6, 4, 6, 4};
+
+// filter 5 rows with 1, 4, 6, 4, 1 coefficients to produce 1 row.
+// 16 pixels per loop.
+void GaussCol_8_SSSE3(const uint8_t* src0,
+                      const uint8_t* src1,
+                      const uint8_t* src2,
+                      const uint8_t* src3,
+                      const uint8_t* src4,
+                      uint16_t* dst,
+                      int width) {
+  asm volatile(
+      "movdqa      %[kGaussCol14],%%xmm6         \n"
+      "movdqa      %[kGaussCol64],%%xmm7         \n"
+      "pxor        %%xmm5,%%xmm5                 \n"
+
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"  // rows 0 and 1
+      "movdqu      (%1),%%xmm2                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"
+      "punpckhbw   %%xmm2,%%xmm1                 \n"
+      "pmaddubsw   %%xmm6,%%xmm0                 \n"  // * 1, * 4
+      "pmaddubsw   %%xmm6,%%xmm1                 \n"
+      "movdqu      (%2),%%xmm2                   \n"  // rows 2 and 3
+      "movdqu      (%3),%%xmm4                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "lea         0x10(%3),%3                   \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklbw   %%xmm4,%%xmm2                 \n"
+      "punpckhbw   %%xmm4,%%xmm3                 \n"
+      "pmaddubsw   %%xmm7,%%xmm2                 \n"  // * 6, * 4
+      "pmaddubsw   %%xmm7,%%xmm3                 \n"
+      "paddw       %%xmm2,%%xmm0                 \n"
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "movdqu      (%4),%%xmm2                   \n"  // row 4
+      "lea         0x10(%4),%4                   \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklbw   %%xmm5,%%xmm2                 \n"
+      "punpckhbw   %%xmm5,%%xmm3                 \n"
+      "paddw       %%xmm2,%%xmm0                 \n"  // * 1
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "movdqu      %%xmm0,(%5)                   \n"
+      "movdqu      %%xmm1,0x10(%5)               \n"
+      "lea         0x20(%5),%5                   \n"
+      "sub         $0x10,%6                      \n"
+      "jg          1b                            \n"
+      : "+r"(src0),                        // %0
+        "+r"(src1),                        // %1
+        "+r"(src2),                        // %2
+        "+r"(src3),                        // %3
+        "+r"(src4),                        // %4
+        "+r"(dst),                         // %5
+        "+r"(width)                        // %6
+      : [kGaussCol14] "m"(kGaussCol14),  // %[kGaussCol14]
+        [kGaussCol64] "m"(kGaussCol64)   // %[kGaussCol64]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_RGBCOLORTABLEROW_X86
-
-#ifdef HAS_ARGBLUMACOLORTABLEROW_SSSE3
-// Tranform RGB pixels with luma table.
-void ARGBLumaColorTableRow_SSSE3(const uint8_t* src_argb,
-                                 uint8_t* dst_argb,
-                                 int width,
-                                 const uint8_t* luma,
-                                 uint32_t lumacoeff) {
-  uintptr_t pixel_temp;
-  uintptr_t table_temp;
+#endif  // HAS_GAUSSCOL_8_SSSE3
+
+#ifdef HAS_GAUSS7COL_8_SSSE3
+static const uvec8 kGauss7Col16 = {1, 6, 1, 6, 1, 6, 1, 6,
+                                   1, 6, 1, 6, 1, 6, 1, 6};
+static const uvec8 kGauss7Col1520 = {15, 20, 15, 20, 15, 20, 15, 20,
+                                     15, 20, 15, 20, 15, 20, 15, 20};
+static const uvec8 kGauss7Col156 = {15, 6, 15, 6, 15, 6, 15, 6,
+                                    15, 6, 15, 6, 15, 6, 15, 6};
+
+// filter 7 rows with 1, 6, 15, 20, 15, 6, 1 coefficients to produce 1 row.
+// 16 pixels per loop.
+void Gauss7Col_8_SSSE3(const uint8_t* src0,
+                       const uint8_t* src1,
+                       const uint8_t* src2,
+                       const uint8_t* src3,
+                       const uint8_t* src4,
+                       const uint8_t* src5,
+                       const uint8_t* src6,
+                       uint16_t* dst,
+                       int width) {
   asm volatile(
-      "movd        %6,%%xmm3                     \n"
-      "pshufd      $0x0,%%xmm3,%%xmm3            \n"
-      "pcmpeqb     %%xmm4,%%xmm4                 \n"
-      "psllw       $0x8,%%xmm4                   \n"
       "pxor        %%xmm5,%%xmm5                 \n"
 
-      // 4 pixel loop.
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%2),%%xmm0                   \n"
-      "pmaddubsw   %%xmm3,%%xmm0                 \n"
-      "phaddw      %%xmm0,%%xmm0                 \n"
-      "pand        %%xmm4,%%xmm0                 \n"
-      "punpcklwd   %%xmm5,%%xmm0                 \n"
-      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
-      "add         %5,%1                         \n"
-      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
-
-      "movzb       (%2),%0                       \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,(%3)                      \n"
-      "movzb       0x1(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0x1(%3)                   \n"
-      "movzb       0x2(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0x2(%3)                   \n"
-      "movzb       0x3(%2),%0                    \n"
-      "mov         %b0,0x3(%3)                   \n"
-
-      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
-      "add         %5,%1                         \n"
-      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
-
-      "movzb       0x4(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0x4(%3)                   \n"
-      "movzb       0x5(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0x5(%3)                   \n"
-      "movzb       0x6(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0x6(%3)                   \n"
-      "movzb       0x7(%2),%0                    \n"
-      "mov         %b0,0x7(%3)                   \n"
-
-      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
-      "add         %5,%1                         \n"
-      "pshufd      $0x39,%%xmm0,%%xmm0           \n"
+      "movdqu      (%0),%%xmm0                   \n"  // rows 0 and 1
+      "movdqu      (%1),%%xmm2                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklbw   %%xmm2,%%xmm0                 \n"
+      "punpckhbw   %%xmm2,%%xmm1                 \n"
+      "pmaddubsw   %[kGauss7Col16],%%xmm0        \n"  // * 1, * 6
+      "pmaddubsw   %[kGauss7Col16],%%xmm1        \n"
+      "movdqu      (%2),%%xmm2                   \n"  // rows 2 and 3
+      "movdqu      (%3),%%xmm4                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "lea         0x10(%3),%3                   \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklbw   %%xmm4,%%xmm2                 \n"
+      "punpckhbw   %%xmm4,%%xmm3                 \n"
+      "pmaddubsw   %[kGauss7Col1520],%%xmm2      \n"  // * 15, * 20
+      "pmaddubsw   %[kGauss7Col1520],%%xmm3      \n"
+      "paddw       %%xmm2,%%xmm0                 \n"
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "movdqu      (%4),%%xmm2                   \n"  // rows 4 and 5
+      "movdqu      (%5),%%xmm4                   \n"
+      "lea         0x10(%4),%4                   \n"
+      "lea         0x10(%5),%5                   \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklbw   %%xmm4,%%xmm2                 \n"
+      "punpckhbw   %%xmm4,%%xmm3                 \n"
+      "pmaddubsw   %[kGauss7Col156],%%xmm2       \n"  // * 15, * 6
+      "pmaddubsw   %[kGauss7Col156],%%xmm3       \n"
+      "paddw       %%xmm2,%%xmm0                 \n"
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "movdqu      (%6),%%xmm2                   \n"  // row 6
+      "lea         0x10(%6),%6                   \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklbw   %%xmm5,%%xmm2                 \n"
+      "punpckhbw   %%xmm5,%%xmm3                 \n"
+      "paddw       %%xmm2,%%xmm0                 \n"  // * 1
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "movdqu      %%xmm0,(%7)                   \n"
+      "movdqu      %%xmm1,0x10(%7)               \n"
+      "lea         0x20(%7),%7                   \n"
+      "sub         $0x10,%8                      \n"
+      "jg          1b                            \n"
+      : "+r"(src0),                              // %0
+        "+r"(src1),                              // %1
+        "+r"(src2),                              // %2
+        "+r"(src3),                              // %3
+        "+r"(src4),                              // %4
+        "+r"(src5),                              // %5
+        "+r"(src6),                              // %6
+        "+r"(dst),                               // %7
+        "+r"(width)                              // %8
+      : [kGauss7Col16] "m"(kGauss7Col16),      // %[kGauss7Col16]
+        [kGauss7Col1520] "m"(kGauss7Col1520),  // %[kGauss7Col1520]
+        [kGauss7Col156] "m"(kGauss7Col156)     // %[kGauss7Col156]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+}
+#endif  // HAS_GAUSS7COL_8_SSSE3
 
-      "movzb       0x8(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0x8(%3)                   \n"
-      "movzb       0x9(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0x9(%3)                   \n"
-      "movzb       0xa(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0xa(%3)                   \n"
-      "movzb       0xb(%2),%0                    \n"
-      "mov         %b0,0xb(%3)                   \n"
+#if defined(HAS_GAUSSROW_8_SSE2) || defined(HAS_GAUSSROW_8_AVX2)
+// Constants shared by the 128 and 256 bit Gaussian filters.
+static const lvec16 kGauss6 = {6, 6, 6, 6, 6, 6, 6, 6,
+                               6, 6, 6, 6, 6, 6, 6, 6};
+static const lvec16 kGaussRound8 = {128, 128, 128, 128, 128, 128, 128, 128,
+                                    128, 128, 128, 128, 128, 128, 128, 128};
+#endif
+#if defined(HAS_GAUSS7ROW_8_SSE2) || defined(HAS_GAUSS7ROW_8_AVX2)
+static const lvec16 kGauss7Row16 = {1, 6, 1, 6, 1, 6, 1, 6,
+                                    1, 6, 1, 6, 1, 6, 1, 6};
+static const lvec16 kGauss7Row1520 = {15, 20, 15, 20, 15, 20, 15, 20,
+                                      15, 20, 15, 20, 15, 20, 15, 20};
+static const lvec32 kGaussRound12 = {2048, 2048, 2048, 2048,
+                                     2048, 2048, 2048, 2048};
+#endif
 
-      "movd        %%xmm0,%k1                    \n"  // 32 bit offset
-      "add         %5,%1                         \n"
+#ifdef HAS_GAUSSROW_8_SSE2
+// filter 16 pixels with 1, 4, 6, 4, 1 coefficients and round to bytes.
+// The sums fit in 16 bits unsigned.
+void GaussRow_8_SSE2(const uint16_t* src, uint8_t* dst, int width) {
+  asm volatile(
+      "movdqa      %[kGauss6],%%xmm6             \n"
+      "movdqa      %[kGaussRound8],%%xmm7        \n"
 
-      "movzb       0xc(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0xc(%3)                   \n"
-      "movzb       0xd(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0xd(%3)                   \n"
-      "movzb       0xe(%2),%0                    \n"
-      "movzb       0x00(%1,%0,1),%0              \n"
-      "mov         %b0,0xe(%3)                   \n"
-      "movzb       0xf(%2),%0                    \n"
-      "mov         %b0,0xf(%3)                   \n"
-      "lea         0x10(%2),%2                   \n"
-      "lea         0x10(%3),%3                   \n"
-      "sub         $0x4,%4                       \n"
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "movdqu      0x8(%0),%%xmm2                \n"
+      "movdqu      0x18(%0),%%xmm3               \n"
+      "paddw       %%xmm2,%%xmm0                 \n"  // * 1
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "movdqu      0x2(%0),%%xmm2                \n"
+      "movdqu      0x12(%0),%%xmm3               \n"
+      "movdqu      0x6(%0),%%xmm4                \n"
+      "movdqu      0x16(%0),%%xmm5               \n"
+      "paddw       %%xmm4,%%xmm2                 \n"
+      "paddw       %%xmm5,%%xmm3                 \n"
+      "psllw       $0x2,%%xmm2                   \n"  // * 4
+      "psllw       $0x2,%%xmm3                   \n"
+      "paddw       %%xmm2,%%xmm0                 \n"
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "movdqu      0x4(%0),%%xmm2                \n"
+      "movdqu      0x14(%0),%%xmm3               \n"
+      "pmullw      %%xmm6,%%xmm2                 \n"  // * 6
+      "pmullw      %%xmm6,%%xmm3                 \n"
+      "paddw       %%xmm2,%%xmm0                 \n"
+      "paddw       %%xmm3,%%xmm1                 \n"
+      "paddw       %%xmm7,%%xmm0                 \n"  // round
+      "paddw       %%xmm7,%%xmm1                 \n"
+      "psrlw       $0x8,%%xmm0                   \n"
+      "psrlw       $0x8,%%xmm1                   \n"
+      "packuswb    %%xmm1,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
-      : "=&d"(pixel_temp),  // %0
-        "=&a"(table_temp),  // %1
-        "+r"(src_argb),     // %2
-        "+r"(dst_argb),     // %3
-        "+rm"(width)        // %4
-      : "r"(luma),          // %5
-        "rm"(lumacoeff)     // %6
-      : "memory", "cc", "xmm0", "xmm3", "xmm4", "xmm5");
+      : "+r"(src),                          // %0
+        "+r"(dst),                          // %1
+        "+r"(width)                         // %2
+      : [kGauss6] "m"(kGauss6),             // %[kGauss6]
+        [kGaussRound8] "m"(kGaussRound8)    // %[kGaussRound8]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_ARGBLUMACOLORTABLEROW_SSSE3
-
-static const uvec8 kYUV24Shuffle[3] = {
-    {8, 9, 0, 8, 9, 1, 10, 11, 2, 10, 11, 3, 12, 13, 4, 12},
-    {9, 1, 10, 11, 2, 10, 11, 3, 12, 13, 4, 12, 13, 5, 14, 15},
-    {2, 10, 11, 3, 12, 13, 4, 12, 13, 5, 14, 15, 6, 14, 15, 7}};
+#endif  // HAS_GAUSSROW_8_SSE2
 
-// Convert biplanar NV21 to packed YUV24
-// NV21 has VU in memory for chroma.
-// YUV24 is VUY in memory
-void NV21ToYUV24Row_SSSE3(const uint8_t* src_y,
-                          const uint8_t* src_vu,
-                          uint8_t* dst_yuv24,
-                          int width) {
+#ifdef HAS_GAUSS7ROW_8_SSE2
+// filter 8 pixels with 1, 6, 15, 20, 15, 6, 1 coefficients and round to
+// bytes.  Symmetric taps are added first then multiplied in pairs.
+void Gauss7Row_8_SSE2(const uint16_t* src, uint8_t* dst, int width) {
   asm volatile(
-      "sub         %0,%1                         \n"
-      "movdqa      (%4),%%xmm4                   \n"  // 3 shuffler constants
-      "movdqa      16(%4),%%xmm5                 \n"
-      "movdqa      32(%4),%%xmm6                 \n"
+      "movdqa      %[kGauss7Row16],%%xmm5        \n"
+      "movdqa      %[kGauss7Row1520],%%xmm6      \n"
+      "movdqa      %[kGaussRound12],%%xmm7       \n"
+
+      LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm2                   \n"  // load 16 Y values
-      "movdqu      (%0,%1),%%xmm3                \n"  // load 8 VU values
-      "lea         16(%0),%0                     \n"
-      "movdqa      %%xmm2,%%xmm0                 \n"
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0xc(%0),%%xmm1                \n"
+      "paddw       %%xmm1,%%xmm0                 \n"  // taps 0 + 6
+      "movdqu      0x2(%0),%%xmm1                \n"
+      "movdqu      0xa(%0),%%xmm2                \n"
+      "paddw       %%xmm2,%%xmm1                 \n"  // taps 1 + 5
+      "movdqu      0x4(%0),%%xmm2                \n"
+      "movdqu      0x8(%0),%%xmm3                \n"
+      "paddw       %%xmm3,%%xmm2                 \n"  // taps 2 + 4
+      "movdqu      0x6(%0),%%xmm3                \n"  // tap 3
+      "movdqa      %%xmm0,%%xmm4                 \n"
+      "punpcklwd   %%xmm1,%%xmm0                 \n"
+      "punpckhwd   %%xmm1,%%xmm4                 \n"
       "movdqa      %%xmm2,%%xmm1                 \n"
-      "shufps      $0x44,%%xmm3,%%xmm0           \n"  // Y 0..7,  UV 0..3
-      "shufps      $0x99,%%xmm3,%%xmm1           \n"  // Y 4..11, UV 2..5
-      "shufps      $0xee,%%xmm3,%%xmm2           \n"  // Y 8..15, UV 4..7
-      "pshufb      %%xmm4, %%xmm0                \n"  // weave into YUV24
-      "pshufb      %%xmm5, %%xmm1                \n"
-      "pshufb      %%xmm6, %%xmm2                \n"
-      "movdqu      %%xmm0,(%2)                   \n"
-      "movdqu      %%xmm1,16(%2)                 \n"
-      "movdqu      %%xmm2,32(%2)                 \n"
-      "lea         48(%2),%2                     \n"
-      "sub         $16,%3                        \n"  // 16 pixels per loop
+      "punpcklwd   %%xmm3,%%xmm2                 \n"
+      "punpckhwd   %%xmm3,%%xmm1                 \n"
+      "pmaddwd     %%xmm5,%%xmm0                 \n"  // * 1, * 6
+      "pmaddwd     %%xmm5,%%xmm4                 \n"
+      "pmaddwd     %%xmm6,%%xmm2                 \n"  // * 15, * 20
+      "pmaddwd     %%xmm6,%%xmm1                 \n"
+      "paddd       %%xmm2,%%xmm0                 \n"
+      "paddd       %%xmm1,%%xmm4                 \n"
+      "paddd       %%xmm7,%%xmm0                 \n"  // round
+      "paddd       %%xmm7,%%xmm4                 \n"
+      "psrld       $0xc,%%xmm0                   \n"
+      "psrld       $0xc,%%xmm4                   \n"
+      "packssdw    %%xmm4,%%xmm0                 \n"
+      "packuswb    %%xmm0,%%xmm0                 \n"
+      "movq        %%xmm0,(%1)                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x8(%1),%1                    \n"
+      "sub         $0x8,%2                       \n"
       "jg          1b                            \n"
-      : "+r"(src_y),            // %0
-        "+r"(src_vu),           // %1
-        "+r"(dst_yuv24),        // %2
-        "+r"(width)             // %3
-      : "r"(&kYUV24Shuffle[0])  // %4
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+      : "+r"(src),                             // %0
+        "+r"(dst),                             // %1
+        "+r"(width)                            // %2
+      : [kGauss7Row16] "m"(kGauss7Row16),      // %[kGauss7Row16]
+        [kGauss7Row1520] "m"(kGauss7Row1520),  // %[kGauss7Row1520]
+        [kGaussRound12] "m"(kGaussRound12)     // %[kGaussRound12]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
+#endif  // HAS_GAUSS7ROW_8_SSE2
+
+#ifdef HAS_GAUSSCOL_SSE2
+// filter 5 rows with 1, 4, 6, 4, 1 coefficients to produce 1 row.
+// 8 samples per loop.
+void GaussCol_SSE2(const uint16_t* src0,
+                   const uint16_t* src1,
+                   const uint16_t* src2,
+                   const uint16_t* src3,
+                   const uint16_t* src4,
+                   uint32_t* dst,
+                   int width) {
+  asm volatile(
+      "pxor        %%xmm7,%%xmm7                 \n"
 
-// Convert biplanar NV21 to packed YUV24
-// NV21 has VU in memory for chroma.
-// YUV24 is VUY in memory
-void NV21ToYUV24Row_AVX2(const uint8_t* src_y,
-                         const uint8_t* src_vu,
-                         uint8_t* dst_yuv24,
-                         int width) {
+      LABELALIGN
+      "1:                                        \n"
+      "movdqu      (%0),%%xmm0                   \n"  // rows 0 and 4
+      "movdqu      (%4),%%xmm2                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%4),%4                   \n"
+      "movdqa      %%xmm0,%%xmm1                 \n"
+      "punpcklwd   %%xmm7,%%xmm0                 \n"
+      "punpckhwd   %%xmm7,%%xmm1                 \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklwd   %%xmm7,%%xmm2                 \n"
+      "punpckhwd   %%xmm7,%%xmm3                 \n"
+      "paddd       %%xmm2,%%xmm0                 \n"  // * 1
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "movdqu      (%1),%%xmm2                   \n"  // rows 1 and 3
+      "movdqu      (%3),%%xmm4                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "lea         0x10(%3),%3                   \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklwd   %%xmm7,%%xmm2                 \n"
+      "punpckhwd   %%xmm7,%%xmm3                 \n"
+      "movdqa      %%xmm4,%%xmm5                 \n"
+      "punpcklwd   %%xmm7,%%xmm4                 \n"
+      "punpckhwd   %%xmm7,%%xmm5                 \n"
+      "paddd       %%xmm4,%%xmm2                 \n"
+      "paddd       %%xmm5,%%xmm3                 \n"
+      "pslld       $0x2,%%xmm2                   \n"  // * 4
+      "pslld       $0x2,%%xmm3                   \n"
+      "paddd       %%xmm2,%%xmm0                 \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "movdqu      (%2),%%xmm2                   \n"  // row 2
+      "lea         0x10(%2),%2                   \n"
+      "movdqa      %%xmm2,%%xmm3                 \n"
+      "punpcklwd   %%xmm7,%%xmm2                 \n"
+      "punpckhwd   %%xmm7,%%xmm3                 \n"
+      "pslld       $0x1,%%xmm2                   \n"  // * 2
+      "pslld       $0x1,%%xmm3                   \n"
+      "paddd       %%xmm2,%%xmm0                 \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "pslld       $0x1,%%xmm2                   \n"  // * 4
+      "pslld       $0x1,%%xmm3                   \n"
+      "paddd       %%xmm2,%%xmm0                 \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "movdqu      %%xmm0,(%5)                   \n"
+      "movdqu      %%xmm1,0x10(%5)               \n"
+      "lea         0x20(%5),%5                   \n"
+      "sub         $0x8,%6                       \n"
+      "jg          1b                            \n"
+      : "+r"(src0),  // %0
+        "+r"(src1),  // %1
+        "+r"(src2),  // %2
+        "+r"(src3),  // %3
+        "+r"(src4),  // %4
+        "+r"(dst),   // %5
+        "+r"(width)  // %6
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+        "xmm7");
+}
+#endif  // HAS_GAUSSCOL_SSE2
+
+#ifdef HAS_GAUSSROW_SSE2
+// filter 8 samples with 1, 4, 6, 4, 1 coefficients and round to 16 bits.
+void GaussRow_SSE2(const uint32_t* src, uint16_t* dst, int width) {
   asm volatile(
-      "sub         %0,%1                         \n"
-      "vbroadcastf128 (%4),%%ymm4                \n"  // 3 shuffler constants
-      "vbroadcastf128 16(%4),%%ymm5              \n"
-      "vbroadcastf128 32(%4),%%ymm6              \n"
+      "pcmpeqb     %%xmm7,%%xmm7                 \n"
+      "psrld       $0x1f,%%xmm7                  \n"
+      "pslld       $0x7,%%xmm7                   \n"  // 128 for rounding
 
+      LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm2                   \n"  // load 32 Y values
-      "vmovdqu     (%0,%1),%%ymm3                \n"  // load 16 VU values
-      "lea         32(%0),%0                     \n"
-      "vshufps     $0x44,%%ymm3,%%ymm2,%%ymm0    \n"  // Y 0..7,  UV 0..3
-      "vshufps     $0x99,%%ymm3,%%ymm2,%%ymm1    \n"  // Y 4..11, UV 2..5
-      "vshufps     $0xee,%%ymm3,%%ymm2,%%ymm2    \n"  // Y 8..15, UV 4..7
-      "vpshufb     %%ymm4,%%ymm0,%%ymm0          \n"  // weave into YUV24
-      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
-      "vpshufb     %%ymm6,%%ymm2,%%ymm2          \n"
-      "vperm2i128  $0x20,%%ymm1,%%ymm0,%%ymm3    \n"
-      "vperm2i128  $0x30,%%ymm0,%%ymm2,%%ymm0    \n"
-      "vperm2i128  $0x31,%%ymm2,%%ymm1,%%ymm1    \n"
-      "vmovdqu     %%ymm3,(%2)                   \n"
-      "vmovdqu     %%ymm0,32(%2)                 \n"
-      "vmovdqu     %%ymm1,64(%2)                 \n"
-      "lea         96(%2),%2                     \n"
-      "sub         $32,%3                        \n"  // 32 pixels per loop
+      "movdqu      (%0),%%xmm0                   \n"
+      "movdqu      0x10(%0),%%xmm1               \n"
+      "movdqu      0x10(%0),%%xmm2               \n"
+      "movdqu      0x20(%0),%%xmm3               \n"
+      "paddd       %%xmm2,%%xmm0                 \n"  // * 1
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "movdqu      0x4(%0),%%xmm2                \n"
+      "movdqu      0x14(%0),%%xmm3               \n"
+      "movdqu      0xc(%0),%%xmm4                \n"
+      "movdqu      0x1c(%0),%%xmm5               \n"
+      "paddd       %%xmm4,%%xmm2                 \n"
+      "paddd       %%xmm5,%%xmm3                 \n"
+      "pslld       $0x2,%%xmm2                   \n"  // * 4
+      "pslld       $0x2,%%xmm3                   \n"
+      "paddd       %%xmm2,%%xmm0                 \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "movdqu      0x8(%0),%%xmm2                \n"
+      "movdqu      0x18(%0),%%xmm3               \n"
+      "pslld       $0x1,%%xmm2                   \n"  // * 2
+      "pslld       $0x1,%%xmm3                   \n"
+      "paddd       %%xmm2,%%xmm0                 \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "pslld       $0x1,%%xmm2                   \n"  // * 4
+      "pslld       $0x1,%%xmm3                   \n"
+      "paddd       %%xmm2,%%xmm0                 \n"
+      "paddd       %%xmm3,%%xmm1                 \n"
+      "paddd       %%xmm7,%%xmm0                 \n"  // round
+      "paddd       %%xmm7,%%xmm1                 \n"
+      "psrld       $0x8,%%xmm0                   \n"
+      "psrld       $0x8,%%xmm1                   \n"
+      "pslld       $0x10,%%xmm0                  \n"  // sign extend low
+      "pslld       $0x10,%%xmm1                  \n"  // words so packssdw
+      "psrad       $0x10,%%xmm0                  \n"  // keeps all 16 bits
+      "psrad       $0x10,%%xmm1                  \n"
+      "packssdw    %%xmm1,%%xmm0                 \n"
+      "movdqu      %%xmm0,(%1)                   \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x8,%2                       \n"
       "jg          1b                            \n"
-      "vzeroupper                                \n"
-      : "+r"(src_y),            // %0
-        "+r"(src_vu),           // %1
-        "+r"(dst_yuv24),        // %2
-        "+r"(width)             // %3
-      : "r"(&kYUV24Shuffle[0])  // %4
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+        "xmm7");
 }
-
-#ifdef HAS_NV21ToYUV24ROW_AVX512
-// The following VMBI VEX256 code tests okay with the intelsde emulator.
-static const lvec8 kYUV24Perm[3] = {
-    {32, 33, 0,  32, 33, 1,  34, 35, 2,  34, 35, 3,  36, 37, 4,  36,
-     37, 5,  38, 39, 6,  38, 39, 7,  40, 41, 8,  40, 41, 9,  42, 43},
-    {10, 42, 43, 11, 44, 45, 12, 44, 45, 13, 46, 47, 14, 46, 47, 15,
-     48, 49, 16, 48, 49, 17, 50, 51, 18, 50, 51, 19, 52, 53, 20, 52},
-    {53, 21, 54, 55, 22, 54, 55, 23, 56, 57, 24, 56, 57, 25, 58, 59,
-     26, 58, 59, 27, 60, 61, 28, 60, 61, 29, 62, 63, 30, 62, 63, 31}};
-
-void NV21ToYUV24Row_AVX512(const uint8_t* src_y,
-                           const uint8_t* src_vu,
-                           uint8_t* dst_yuv24,
-                           int width) {
+#endif  // HAS_GAUSSROW_SSE2
+
+#ifdef HAS_GAUSSCOL_8_AVX2
+// filter 5 rows with 1, 4, 6, 4, 1 coefficients to produce 1 row.
+// 16 pixels per loop.
+void GaussCol_8_AVX2(const uint8_t* src0,
+                     const uint8_t* src1,
+                     const uint8_t* src2,
+                     const uint8_t* src3,
+                     const uint8_t* src4,
+                     uint16_t* dst,
+                     int width) {
   asm volatile(
-      "sub         %0,%1                         \n"
-      "vmovdqa     (%4),%%ymm4                   \n"  // 3 shuffler constants
-      "vmovdqa     32(%4),%%ymm5                 \n"
-      "vmovdqa     64(%4),%%ymm6                 \n" LABELALIGN
+      "vmovdqu     %[kGauss6],%%ymm6             \n"
+
+      LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm2                   \n"  // load 32 Y values
-      "vmovdqu     (%0,%1),%%ymm3                \n"  // load 16 VU values
-      "lea         32(%0),%0                     \n"
-      "vmovdqa     %%ymm2, %%ymm0                \n"
-      "vmovdqa     %%ymm2, %%ymm1                \n"
-      "vpermt2b    %%ymm3,%%ymm4,%%ymm0          \n"
-      "vpermt2b    %%ymm3,%%ymm5,%%ymm1          \n"
-      "vpermt2b    %%ymm3,%%ymm6,%%ymm2          \n"
-      "vmovdqu     %%ymm0,(%2)                   \n"
-      "vmovdqu     %%ymm1,32(%2)                 \n"
-      "vmovdqu     %%ymm2,64(%2)                 \n"
-      "lea         96(%2),%2                     \n"
-      "sub         $32,%3                        \n"
+      "vpmovzxbw   (%0),%%ymm0                   \n"
+      "vpmovzxbw   (%4),%%ymm1                   \n"
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"  // * 1
+      "vpmovzxbw   (%1),%%ymm1                   \n"
+      "vpmovzxbw   (%3),%%ymm2                   \n"
+      "vpaddw      %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpsllw      $0x2,%%ymm1,%%ymm1            \n"  // * 4
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpmovzxbw   (%2),%%ymm1                   \n"
+      "vpmullw     %%ymm6,%%ymm1,%%ymm1          \n"  // * 6
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,(%5)                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "lea         0x10(%3),%3                   \n"
+      "lea         0x10(%4),%4                   \n"
+      "lea         0x20(%5),%5                   \n"
+      "sub         $0x10,%6                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_y),         // %0
-        "+r"(src_vu),        // %1
-        "+r"(dst_yuv24),     // %2
-        "+r"(width)          // %3
-      : "r"(&kYUV24Perm[0])  // %4
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6");
+      : "+r"(src0),              // %0
+        "+r"(src1),              // %1
+        "+r"(src2),              // %2
+        "+r"(src3),              // %3
+        "+r"(src4),              // %4
+        "+r"(dst),               // %5
+        "+r"(width)              // %6
+      : [kGauss6] "m"(kGauss6)   // %[kGauss6]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm6");
 }
+#endif  // HAS_GAUSSCOL_8_AVX2
+
+#ifdef HAS_GAUSS7COL_8_AVX2
+static const lvec16 kGauss15 = {15, 15, 15, 15, 15, 15, 15, 15,
+                                15, 15, 15, 15, 15, 15, 15, 15};
+static const lvec16 kGauss20 = {20, 20, 20, 20, 20, 20, 20, 20,
+                                20, 20, 20, 20, 20, 20, 20, 20};
+
+// filter 7 rows with 1, 6, 15, 20, 15, 6, 1 coefficients to produce 1 row.
+// 16 pixels per loop.
+void Gauss7Col_8_AVX2(const uint8_t* src0,
+                      const uint8_t* src1,
+                      const uint8_t* src2,
+                      const uint8_t* src3,
+                      const uint8_t* src4,
+                      const uint8_t* src5,
+                      const uint8_t* src6,
+                      uint16_t* dst,
+                      int width) {
+  asm volatile(
 
-#endif  // HAS_NV21ToYUV24ROW_AVX512
-
-#ifdef HAS_SWAPUVROW_SSSE3
-
-// Shuffle table for reversing the bytes.
-static const uvec8 kShuffleUVToVU = {1u, 0u, 3u,  2u,  5u,  4u,  7u,  6u,
-                                     9u, 8u, 11u, 10u, 13u, 12u, 15u, 14u};
+      LABELALIGN
+      "1:                                        \n"
+      "vpmovzxbw   (%0),%%ymm0                   \n"
+      "vpmovzxbw   (%6),%%ymm1                   \n"
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"  // * 1
+      "vpmovzxbw   (%1),%%ymm1                   \n"
+      "vpmovzxbw   (%5),%%ymm2                   \n"
+      "vpaddw      %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpmullw     %[kGauss6],%%ymm1,%%ymm1      \n"  // * 6
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpmovzxbw   (%2),%%ymm1                   \n"
+      "vpmovzxbw   (%4),%%ymm2                   \n"
+      "vpaddw      %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpmullw     %[kGauss15],%%ymm1,%%ymm1     \n"  // * 15
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpmovzxbw   (%3),%%ymm1                   \n"
+      "vpmullw     %[kGauss20],%%ymm1,%%ymm1     \n"  // * 20
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,(%7)                   \n"
+      "lea         0x10(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "lea         0x10(%2),%2                   \n"
+      "lea         0x10(%3),%3                   \n"
+      "lea         0x10(%4),%4                   \n"
+      "lea         0x10(%5),%5                   \n"
+      "lea         0x10(%6),%6                   \n"
+      "lea         0x20(%7),%7                   \n"
+      "sub         $0x10,%8                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src0),                  // %0
+        "+r"(src1),                  // %1
+        "+r"(src2),                  // %2
+        "+r"(src3),                  // %3
+        "+r"(src4),                  // %4
+        "+r"(src5),                  // %5
+        "+r"(src6),                  // %6
+        "+r"(dst),                   // %7
+        "+r"(width)                  // %8
+      : [kGauss6] "m"(kGauss6),      // %[kGauss6]
+        [kGauss15] "m"(kGauss15),    // %[kGauss15]
+        [kGauss20] "m"(kGauss20)     // %[kGauss20]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
+}
+#endif  // HAS_GAUSS7COL_8_AVX2
 
-// Convert UV plane of NV12 to VU of NV21.
-void SwapUVRow_SSSE3(const uint8_t* src_uv, uint8_t* dst_vu, int width) {
+#ifdef HAS_GAUSSROW_8_AVX2
+// filter 16 pixels with 1, 4, 6, 4, 1 coefficients and round to bytes.
+void GaussRow_8_AVX2(const uint16_t* src, uint8_t* dst, int width) {
   asm volatile(
-
-      "movdqu      %3,%%xmm5                     \n"
+      "vmovdqu     %[kGauss6],%%ymm6             \n"
+      "vmovdqu     %[kGaussRound8],%%ymm7        \n"
 
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm0                   \n"
-      "movdqu      0x10(%0),%%xmm1               \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vpaddw      0x8(%0),%%ymm0,%%ymm0         \n"  // * 1
+      "vmovdqu     0x2(%0),%%ymm1                \n"
+      "vpaddw      0x6(%0),%%ymm1,%%ymm1         \n"
+      "vpsllw      $0x2,%%ymm1,%%ymm1            \n"  // * 4
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpmullw     0x4(%0),%%ymm6,%%ymm1         \n"  // * 6
+      "vpaddw      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpaddw      %%ymm7,%%ymm0,%%ymm0          \n"  // round
+      "vpsrlw      $0x8,%%ymm0,%%ymm0            \n"
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpackuswb   %%xmm1,%%xmm0,%%xmm0          \n"
+      "vmovdqu     %%xmm0,(%1)                   \n"
       "lea         0x20(%0),%0                   \n"
-      "pshufb      %%xmm5,%%xmm0                 \n"
-      "pshufb      %%xmm5,%%xmm1                 \n"
-      "movdqu      %%xmm0,(%1)                   \n"
-      "movdqu      %%xmm1,0x10(%1)               \n"
-      "lea         0x20(%1),%1                   \n"
+      "lea         0x10(%1),%1                   \n"
       "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
-      : "+r"(src_uv),        // %0
-        "+r"(dst_vu),        // %1
-        "+r"(width)          // %2
-      : "m"(kShuffleUVToVU)  // %3
-      : "memory", "cc", "xmm0", "xmm1", "xmm5");
+      "vzeroupper                                \n"
+      : "+r"(src),                         // %0
+        "+r"(dst),                         // %1
+        "+r"(width)                        // %2
+      : [kGauss6] "m"(kGauss6),            // %[kGauss6]
+        [kGaussRound8] "m"(kGaussRound8)   // %[kGaussRound8]
+      : "memory", "cc", "xmm0", "xmm1", "xmm6", "xmm7");
 }
-#endif  // HAS_SWAPUVROW_SSSE3
+#endif  // HAS_GAUSSROW_8_AVX2
 
-#ifdef HAS_SWAPUVROW_AVX2
-void SwapUVRow_AVX2(const uint8_t* src_uv, uint8_t* dst_vu, int width) {
+#ifdef HAS_GAUSS7ROW_8_AVX2
+// filter 16 pixels with 1, 6, 15, 20, 15, 6, 1 coefficients and round to
+// bytes.  Symmetric taps are added first then multiplied in pairs.
+void Gauss7Row_8_AVX2(const uint16_t* src, uint8_t* dst, int width) {
   asm volatile(
-
-      "vbroadcastf128 %3,%%ymm5                  \n"
+      "vmovdqu     %[kGauss7Row16],%%ymm5        \n"
+      "vmovdqu     %[kGauss7Row1520],%%ymm6      \n"
+      "vmovdqu     %[kGaussRound12],%%ymm7       \n"
 
       LABELALIGN
       "1:                                        \n"
       "vmovdqu     (%0),%%ymm0                   \n"
-      "vmovdqu     0x20(%0),%%ymm1               \n"
-      "lea         0x40(%0),%0                   \n"
-      "vpshufb     %%ymm5,%%ymm0,%%ymm0          \n"
-      "vpshufb     %%ymm5,%%ymm1,%%ymm1          \n"
-      "vmovdqu     %%ymm0,(%1)                   \n"
-      "vmovdqu     %%ymm1,0x20(%1)               \n"
-      "lea         0x40(%1),%1                   \n"
-      "sub         $0x20,%2                      \n"
+      "vpaddw      0xc(%0),%%ymm0,%%ymm0         \n"  // taps 0 + 6
+      "vmovdqu     0x2(%0),%%ymm1                \n"
+      "vpaddw      0xa(%0),%%ymm1,%%ymm1         \n"  // taps 1 + 5
+      "vmovdqu     0x4(%0),%%ymm2                \n"
+      "vpaddw      0x8(%0),%%ymm2,%%ymm2         \n"  // taps 2 + 4
+      "vmovdqu     0x6(%0),%%ymm3                \n"  // tap 3
+      "vpunpckhwd  %%ymm1,%%ymm0,%%ymm4          \n"
+      "vpunpcklwd  %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpunpckhwd  %%ymm3,%%ymm2,%%ymm1          \n"
+      "vpunpcklwd  %%ymm3,%%ymm2,%%ymm2          \n"
+      "vpmaddwd    %%ymm5,%%ymm0,%%ymm0          \n"  // * 1, * 6
+      "vpmaddwd    %%ymm5,%%ymm4,%%ymm4          \n"
+      "vpmaddwd    %%ymm6,%%ymm2,%%ymm2          \n"  // * 15, * 20
+      "vpmaddwd    %%ymm6,%%ymm1,%%ymm1          \n"
+      "vpaddd      %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpaddd      %%ymm1,%%ymm4,%%ymm4          \n"
+      "vpaddd      %%ymm7,%%ymm0,%%ymm0          \n"  // round
+      "vpaddd      %%ymm7,%%ymm4,%%ymm4          \n"
+      "vpsrld      $0xc,%%ymm0,%%ymm0            \n"
+      "vpsrld      $0xc,%%ymm4,%%ymm4            \n"
+      "vpackssdw   %%ymm4,%%ymm0,%%ymm0          \n"  // lanes pack in order
+      "vextracti128 $0x1,%%ymm0,%%xmm1           \n"
+      "vpackuswb   %%xmm1,%%xmm0,%%xmm0          \n"
+      "vmovdqu     %%xmm0,(%1)                   \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x10(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_uv),        // %0
-        "+r"(dst_vu),        // %1
-        "+r"(width)          // %2
-      : "m"(kShuffleUVToVU)  // %3
-      : "memory", "cc", "xmm0", "xmm1", "xmm5");
+      : "+r"(src),                             // %0
+        "+r"(dst),                             // %1
+        "+r"(width)                            // %2
+      : [kGauss7Row16] "m"(kGauss7Row16),      // %[kGauss7Row16]
+        [kGauss7Row1520] "m"(kGauss7Row1520),  // %[kGauss7Row1520]
+        [kGaussRound12] "m"(kGaussRound12)     // %[kGaussRound12]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6",
+        "xmm7");
 }
-#endif  // HAS_SWAPUVROW_AVX2
-
-void HalfMergeUVRow_SSSE3(const uint8_t* src_u,
-                          int src_stride_u,
-                          const uint8_t* src_v,
-                          int src_stride_v,
-                          uint8_t* dst_uv,
-                          int width) {
+#endif  // HAS_GAUSS7ROW_8_AVX2
+
+#ifdef HAS_GAUSSCOL_AVX2
+// filter 5 rows with 1, 4, 6, 4, 1 coefficients to produce 1 row.
+// 8 samples per loop.
+void GaussCol_AVX2(const uint16_t* src0,
+                   const uint16_t* src1,
+                   const uint16_t* src2,
+                   const uint16_t* src3,
+                   const uint16_t* src4,
+                   uint32_t* dst,
+                   int width) {
   asm volatile(
-      "pcmpeqb     %%xmm4,%%xmm4                 \n"
-      "psrlw       $0xf,%%xmm4                   \n"
-      "packuswb    %%xmm4,%%xmm4                 \n"
-      "pxor        %%xmm5,%%xmm5                 \n"
 
       LABELALIGN
       "1:                                        \n"
-      "movdqu      (%0),%%xmm0                   \n"  // load 16 U values
-      "movdqu      (%1),%%xmm1                   \n"  // load 16 V values
-      "movdqu      0(%0,%4,1),%%xmm2             \n"  // 16 from next row
-      "movdqu      0(%1,%5,1),%%xmm3             \n"
+      "vpmovzxwd   (%0),%%ymm0                   \n"
+      "vpmovzxwd   (%4),%%ymm1                   \n"
+      "vpaddd      %%ymm1,%%ymm0,%%ymm0          \n"  // * 1
+      "vpmovzxwd   (%1),%%ymm1                   \n"
+      "vpmovzxwd   (%3),%%ymm2                   \n"
+      "vpaddd      %%ymm2,%%ymm1,%%ymm1          \n"
+      "vpslld      $0x2,%%ymm1,%%ymm1            \n"  // * 4
+      "vpaddd      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpmovzxwd   (%2),%%ymm1                   \n"
+      "vpslld      $0x1,%%ymm1,%%ymm1            \n"  // * 2
+      "vpaddd      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpslld      $0x1,%%ymm1,%%ymm1            \n"  // * 4
+      "vpaddd      %%ymm1,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,(%5)                   \n"
       "lea         0x10(%0),%0                   \n"
-      "pmaddubsw   %%xmm4,%%xmm0                 \n"  // half size
-      "pmaddubsw   %%xmm4,%%xmm1                 \n"
-      "pmaddubsw   %%xmm4,%%xmm2                 \n"
-      "pmaddubsw   %%xmm4,%%xmm3                 \n"
       "lea         0x10(%1),%1                   \n"
-      "paddw       %%xmm2,%%xmm0                 \n"
-      "paddw       %%xmm3,%%xmm1                 \n"
-      "psrlw       $0x1,%%xmm0                   \n"
-      "psrlw       $0x1,%%xmm1                   \n"
-      "pavgw       %%xmm5,%%xmm0                 \n"
-      "pavgw       %%xmm5,%%xmm1                 \n"
-      "packuswb    %%xmm0,%%xmm0                 \n"
-      "packuswb    %%xmm1,%%xmm1                 \n"
-      "punpcklbw   %%xmm1,%%xmm0                 \n"
-      "movdqu      %%xmm0,(%2)                   \n"  // store 8 UV pixels
       "lea         0x10(%2),%2                   \n"
-      "sub         $0x10,%3                      \n"  // 16 src pixels per loop
+      "lea         0x10(%3),%3                   \n"
+      "lea         0x10(%4),%4                   \n"
+      "lea         0x20(%5),%5                   \n"
+      "sub         $0x8,%6                       \n"
       "jg          1b                            \n"
-      : "+r"(src_u),                    // %0
-        "+r"(src_v),                    // %1
-        "+r"(dst_uv),                   // %2
-        "+r"(width)                     // %3
-      : "r"((intptr_t)(src_stride_u)),  // %4
-        "r"((intptr_t)(src_stride_v))   // %5
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+      "vzeroupper                                \n"
+      : "+r"(src0),  // %0
+        "+r"(src1),  // %1
+        "+r"(src2),  // %2
+        "+r"(src3),  // %3
+        "+r"(src4),  // %4
+        "+r"(dst),   // %5
+        "+r"(width)  // %6
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2");
 }
+#endif  // HAS_GAUSSCOL_AVX2
 
-void HalfMergeUVRow_AVX2(const uint8_t* src_u,
-                         int src_stride_u,
-                         const uint8_t* src_v,
-                         int src_stride_v,
-                         uint8_t* dst_uv,
-                         int width) {
+#ifdef HAS_GAUSSROW_AVX2
+// filter 16 samples with 1, 4, 6, 4, 1 coefficients and round to 16 bits.
+void GaussRow_AVX2(const uint32_t* src, uint16_t* dst, int width) {
   asm volatile(
-      "vpcmpeqb    %%ymm4,%%ymm4,%%ymm4          \n"
-      "vpsrlw      $0xf,%%ymm4,%%ymm4            \n"
-      "vpackuswb   %%ymm4,%%ymm4,%%ymm4          \n"
-      "vpxor       %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpcmpeqb    %%ymm7,%%ymm7,%%ymm7          \n"
+      "vpsrld      $0x1f,%%ymm7,%%ymm7           \n"
+      "vpslld      $0x7,%%ymm7,%%ymm7            \n"  // 128 for rounding
 
       LABELALIGN
       "1:                                        \n"
-      "vmovdqu     (%0),%%ymm0                   \n"  // load 32 U values
-      "vmovdqu     (%1),%%ymm1                   \n"  // load 32 V values
-      "vmovdqu     0(%0,%4,1),%%ymm2             \n"  // 32 from next row
-      "vmovdqu     0(%1,%5,1),%%ymm3             \n"
+      "vmovdqu     (%0),%%ymm0                   \n"
+      "vmovdqu     0x20(%0),%%ymm1               \n"
+      "vpaddd      0x10(%0),%%ymm0,%%ymm0        \n"  // * 1
+      "vpaddd      0x30(%0),%%ymm1,%%ymm1        \n"
+      "vmovdqu     0x4(%0),%%ymm2                \n"
+      "vmovdqu     0x24(%0),%%ymm3               \n"
+      "vpaddd      0xc(%0),%%ymm2,%%ymm2         \n"
+      "vpaddd      0x2c(%0),%%ymm3,%%ymm3        \n"
+      "vpslld      $0x2,%%ymm2,%%ymm2            \n"  // * 4
+      "vpslld      $0x2,%%ymm3,%%ymm3            \n"
+      "vpaddd      %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpaddd      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vmovdqu     0x8(%0),%%ymm2                \n"
+      "vmovdqu     0x28(%0),%%ymm3               \n"
+      "vpslld      $0x1,%%ymm2,%%ymm2            \n"  // * 2
+      "vpslld      $0x1,%%ymm3,%%ymm3            \n"
+      "vpaddd      %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpaddd      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vpslld      $0x1,%%ymm2,%%ymm2            \n"  // * 4
+      "vpslld      $0x1,%%ymm3,%%ymm3            \n"
+      "vpaddd      %%ymm2,%%ymm0,%%ymm0          \n"
+      "vpaddd      %%ymm3,%%ymm1,%%ymm1          \n"
+      "vpaddd      %%ymm7,%%ymm0,%%ymm0          \n"  // round
+      "vpaddd      %%ymm7,%%ymm1,%%ymm1          \n"
+      "vpsrld      $0x8,%%ymm0,%%ymm0            \n"
+      "vpsrld      $0x8,%%ymm1,%%ymm1            \n"
+      "vpackusdw   %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpermq      $0xd8,%%ymm0,%%ymm0           \n"
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "lea         0x40(%0),%0                   \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm7");
+}
+#endif  // HAS_GAUSSROW_AVX2
+
+#if defined(HAS_GAUSSCOL_F32_AVX2) || defined(HAS_GAUSSROW_F32_AVX2)
+// 4, 6 and 1 / 256 for the float Gaussian filters.
+static const float kGaussF32[3] = {4.0f, 6.0f, 1.0f / 256.0f};
+#endif
+
+#ifdef HAS_GAUSSCOL_F32_AVX2
+// filter 5 rows with 1, 4, 6, 4, 1 coefficients to produce 1 row.
+void GaussCol_F32_AVX2(const float* src0,
+                       const float* src1,
+                       const float* src2,
+                       const float* src3,
+                       const float* src4,
+                       float* dst,
+                       int width) {
+  asm volatile(
+      "vbroadcastss (%7),%%ymm5                  \n"  // 4
+      "vbroadcastss 0x4(%7),%%ymm6               \n"  // 6
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovups     (%0),%%ymm0                   \n"
+      "vmovups     (%1),%%ymm1                   \n"
+      "vfmadd231ps %%ymm5,%%ymm1,%%ymm0          \n"  // * 4
+      "vmovups     (%2),%%ymm1                   \n"
+      "vfmadd231ps %%ymm6,%%ymm1,%%ymm0          \n"  // * 6
+      "vmovups     (%3),%%ymm1                   \n"
+      "vfmadd231ps %%ymm5,%%ymm1,%%ymm0          \n"  // * 4
+      "vaddps      (%4),%%ymm0,%%ymm0            \n"  // * 1
+      "vmovups     %%ymm0,(%5)                   \n"
       "lea         0x20(%0),%0                   \n"
-      "vpmaddubsw  %%ymm4,%%ymm0,%%ymm0          \n"  // half size
-      "vpmaddubsw  %%ymm4,%%ymm1,%%ymm1          \n"
-      "vpmaddubsw  %%ymm4,%%ymm2,%%ymm2          \n"
-      "vpmaddubsw  %%ymm4,%%ymm3,%%ymm3          \n"
       "lea         0x20(%1),%1                   \n"
-      "vpaddw      %%ymm2,%%ymm0,%%ymm0          \n"
-      "vpaddw      %%ymm3,%%ymm1,%%ymm1          \n"
-      "vpsrlw      $0x1,%%ymm0,%%ymm0            \n"
-      "vpsrlw      $0x1,%%ymm1,%%ymm1            \n"
-      "vpavgw      %%ymm5,%%ymm0,%%ymm0          \n"
-      "vpavgw      %%ymm5,%%ymm1,%%ymm1          \n"
-      "vpackuswb   %%ymm0,%%ymm0,%%ymm0          \n"
-      "vpackuswb   %%ymm1,%%ymm1,%%ymm1          \n"
-      "vpunpcklbw  %%ymm1,%%ymm0,%%ymm0          \n"
-      "vmovdqu     %%ymm0,(%2)                   \n"  // store 16 UV pixels
       "lea         0x20(%2),%2                   \n"
-      "sub         $0x20,%3                      \n"  // 32 src pixels per loop
+      "lea         0x20(%3),%3                   \n"
+      "lea         0x20(%4),%4                   \n"
+      "lea         0x20(%5),%5                   \n"
+      "sub         $0x8,%6                       \n"
       "jg          1b                            \n"
       "vzeroupper                                \n"
-      : "+r"(src_u),                    // %0
-        "+r"(src_v),                    // %1
-        "+r"(dst_uv),                   // %2
-        "+r"(width)                     // %3
-      : "r"((intptr_t)(src_stride_u)),  // %4
-        "r"((intptr_t)(src_stride_v))   // %5
-      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5");
+      : "+r"(src0),      // %0
+        "+r"(src1),      // %1
+        "+r"(src2),      // %2
+        "+r"(src3),      // %3
+        "+r"(src4),      // %4
+        "+r"(dst),       // %5
+        "+r"(width)      // %6
+      : "r"(kGaussF32)   // %7
+      : "memory", "cc", "xmm0", "xmm1", "xmm5", "xmm6");
+}
+#endif  // HAS_GAUSSCOL_F32_AVX2
+
+#ifdef HAS_GAUSSROW_F32_AVX2
+// filter 8 samples with 1, 4, 6, 4, 1 coefficients and scale by 1 / 256.
+void GaussRow_F32_AVX2(const float* src, float* dst, int width) {
+  asm volatile(
+      "vbroadcastss (%3),%%ymm5                  \n"  // 4
+      "vbroadcastss 0x4(%3),%%ymm6               \n"  // 6
+      "vbroadcastss 0x8(%3),%%ymm7               \n"  // 1 / 256
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovups     (%0),%%ymm0                   \n"
+      "vmovups     0x4(%0),%%ymm1                \n"
+      "vfmadd231ps %%ymm5,%%ymm1,%%ymm0          \n"  // * 4
+      "vmovups     0x8(%0),%%ymm1                \n"
+      "vfmadd231ps %%ymm6,%%ymm1,%%ymm0          \n"  // * 6
+      "vmovups     0xc(%0),%%ymm1                \n"
+      "vfmadd231ps %%ymm5,%%ymm1,%%ymm0          \n"  // * 4
+      "vaddps      0x10(%0),%%ymm0,%%ymm0        \n"  // * 1
+      "vmulps      %%ymm7,%%ymm0,%%ymm0          \n"
+      "vmovups     %%ymm0,(%1)                   \n"
+      "lea         0x20(%0),%0                   \n"
+      "lea         0x20(%1),%1                   \n"
+      "sub         $0x8,%2                       \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src),       // %0
+        "+r"(dst),       // %1
+        "+r"(width)      // %2
+      : "r"(kGaussF32)   // %3
+      : "memory", "cc", "xmm0", "xmm1", "xmm5", "xmm6", "xmm7");
+}
+#endif  // HAS_GAUSSROW_F32_AVX2
+
+#ifdef HAS_AR30TOARGBTONEMAPROW_AVX2
+// Tone map 8 AR30 pixels per loop. Each channel is looked up in kEotf with a
+// dword gather, mixed with vpmulld and looked up in kOetf with a byte gather.
+// Offsets are KTONEMAPEOTF, KTONEMAPGAMUT and KTONEMAPOETF.
+void AR30ToARGBToneMapRow_AVX2(const uint8_t* src_ar30,
+                               uint8_t* dst_argb,
+                               const struct ToneMapConstants* tonemap,
+                               int width) {
+  asm volatile(
+      "vpcmpeqb    %%ymm6,%%ymm6,%%ymm6          \n"
+      "vpsrld      $0x16,%%ymm6,%%ymm6           \n"  // 0x3ff
+
+      LABELALIGN
+      "1:                                        \n"
+      "vmovdqu     (%[src_ar30]),%%ymm0          \n"
+      "lea         0x20(%[src_ar30]),%[src_ar30] \n"
+      "vpsrld      $0xa,%%ymm0,%%ymm2            \n"
+      "vpsrld      $0x14,%%ymm0,%%ymm3           \n"
+      "vpand       %%ymm6,%%ymm0,%%ymm1          \n"  // b
+      "vpand       %%ymm6,%%ymm2,%%ymm2          \n"  // g
+      "vpand       %%ymm6,%%ymm3,%%ymm3          \n"  // r
+
+      // Linearize.
+      "vpcmpeqd    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpxor       %%ymm0,%%ymm0,%%ymm0          \n"
+      "vpgatherdd  %%ymm5,(%[tonemap],%%ymm1,4),%%ymm0 \n"
+      "vpcmpeqd    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpxor       %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpgatherdd  %%ymm5,(%[tonemap],%%ymm2,4),%%ymm1 \n"
+      "vpcmpeqd    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpxor       %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpgatherdd  %%ymm5,(%[tonemap],%%ymm3,4),%%ymm2 \n"
+
+      // BT.2020 to BT.709 primaries.
+      "vpmulld     4096(%[tonemap]),%%ymm2,%%ymm3 \n"
+      "vpmulld     4128(%[tonemap]),%%ymm1,%%ymm5 \n"
+      "vpaddd      %%ymm5,%%ymm3,%%ymm3          \n"
+      "vpmulld     4160(%[tonemap]),%%ymm0,%%ymm5 \n"
+      "vpaddd      %%ymm5,%%ymm3,%%ymm3          \n"  // R
+      "vpmulld     4192(%[tonemap]),%%ymm2,%%ymm4 \n"
+      "vpmulld     4224(%[tonemap]),%%ymm1,%%ymm5 \n"
+      "vpaddd      %%ymm5,%%ymm4,%%ymm4          \n"
+      "vpmulld     4256(%[tonemap]),%%ymm0,%%ymm5 \n"
+      "vpaddd      %%ymm5,%%ymm4,%%ymm4          \n"  // G
+      "vpmulld     4288(%[tonemap]),%%ymm2,%%ymm7 \n"
+      "vpmulld     4320(%[tonemap]),%%ymm1,%%ymm5 \n"
+      "vpaddd      %%ymm5,%%ymm7,%%ymm7          \n"
+      "vpmulld     4352(%[tonemap]),%%ymm0,%%ymm5 \n"
+      "vpaddd      %%ymm5,%%ymm7,%%ymm7          \n"  // B
+      "vpaddd      4384(%[tonemap]),%%ymm3,%%ymm3 \n"
+      "vpaddd      4384(%[tonemap]),%%ymm4,%%ymm4 \n"
+      "vpaddd      4384(%[tonemap]),%%ymm7,%%ymm7 \n"
+      "vpsrad      $0x10,%%ymm3,%%ymm3           \n"
+      "vpsrad      $0x10,%%ymm4,%%ymm4           \n"
+      "vpsrad      $0x10,%%ymm7,%%ymm7           \n"
+      "vpxor       %%ymm0,%%ymm0,%%ymm0          \n"
+      "vpmaxsd     %%ymm0,%%ymm3,%%ymm3          \n"
+      "vpmaxsd     %%ymm0,%%ymm4,%%ymm4          \n"
+      "vpmaxsd     %%ymm0,%%ymm7,%%ymm7          \n"
+      "vpminsd     4416(%[tonemap]),%%ymm3,%%ymm3 \n"
+      "vpminsd     4416(%[tonemap]),%%ymm4,%%ymm4 \n"
+      "vpminsd     4416(%[tonemap]),%%ymm7,%%ymm7 \n"
+
+      // Tone map and encode.
+      "vpcmpeqd    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpgatherdd  %%ymm5,4448(%[tonemap],%%ymm7,1),%%ymm0 \n"
+      "vpcmpeqd    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpxor       %%ymm1,%%ymm1,%%ymm1          \n"
+      "vpgatherdd  %%ymm5,4448(%[tonemap],%%ymm4,1),%%ymm1 \n"
+      "vpcmpeqd    %%ymm5,%%ymm5,%%ymm5          \n"
+      "vpxor       %%ymm2,%%ymm2,%%ymm2          \n"
+      "vpgatherdd  %%ymm5,4448(%[tonemap],%%ymm3,1),%%ymm2 \n"
+      "vpslld      $0x18,%%ymm0,%%ymm0           \n"
+      "vpslld      $0x18,%%ymm1,%%ymm1           \n"
+      "vpslld      $0x18,%%ymm2,%%ymm2           \n"
+      "vpsrld      $0x18,%%ymm0,%%ymm0           \n"  // b
+      "vpsrld      $0x10,%%ymm1,%%ymm1           \n"  // g
+      "vpsrld      $0x8,%%ymm2,%%ymm2            \n"  // r
+      "vpcmpeqb    %%ymm3,%%ymm3,%%ymm3          \n"
+      "vpslld      $0x18,%%ymm3,%%ymm3           \n"  // a
+      "vpor        %%ymm1,%%ymm0,%%ymm0          \n"
+      "vpor        %%ymm3,%%ymm2,%%ymm2          \n"
+      "vpor        %%ymm2,%%ymm0,%%ymm0          \n"
+      "vmovdqu     %%ymm0,(%[dst_argb])          \n"
+      "lea         0x20(%[dst_argb]),%[dst_argb] \n"
+      "sub         $0x8,%[width]                 \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : [src_ar30] "+r"(src_ar30),  // %[src_ar30]
+        [dst_argb] "+r"(dst_argb),  // %[dst_argb]
+        [width] "+rm"(width)        // %[width]
+      : [tonemap] "r"(tonemap)      // %[tonemap]
+      : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+        "xmm6", "xmm7");
 }
+#endif  // HAS_AR30TOARGBTONEMAPROW_AVX2
 
 void ClampFloatToZero_SSE2(const float* src_x, float* dst_y, int width) {
   asm volatile(
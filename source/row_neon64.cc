@@ -4081,6 +4081,144 @@ void ConvertFP32ToFP16Row_NEON(const float* src,
       : "cc", "memory", "v1", "v2", "v3");
 }
 
+// Convert FP32 Floats to int8 with round to nearest even and saturation.
+void ConvertFP32ToInt8Row_NEON(const float* src, int8_t* dst, int width) {
+  asm volatile(
+      "1:                                        \n"
+      "ldp         q0, q1, [%0], #32             \n"  // load 16 floats
+      "ldp         q2, q3, [%0], #32             \n"
+      "subs        %w2, %w2, #16                 \n"  // 16 floats per loop
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "fcvtns      v0.4s, v0.4s                  \n"  // round to int
+      "fcvtns      v1.4s, v1.4s                  \n"
+      "fcvtns      v2.4s, v2.4s                  \n"
+      "fcvtns      v3.4s, v3.4s                  \n"
+      "sqxtn       v0.4h, v0.4s                  \n"  // saturate to short
+      "sqxtn2      v0.8h, v1.4s                  \n"
+      "sqxtn       v2.4h, v2.4s                  \n"
+      "sqxtn2      v2.8h, v3.4s                  \n"
+      "sqxtn       v0.8b, v0.8h                  \n"  // saturate to int8
+      "sqxtn2      v0.16b, v2.8h                 \n"
+      "str         q0, [%1], #16                 \n"  // store 16 int8
+      "b.gt        1b                            \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3");
+}
+
+// Convert 8 ARGB pixels to R, G and B float planes with scale and bias.
+void ARGBToRGBPlanarFloatRow_NEON(const uint8_t* src_argb,
+                                  float* dst_r,
+                                  float* dst_g,
+                                  float* dst_b,
+                                  const float* scale_bias,
+                                  int width) {
+  asm volatile(
+      "ldr         q16, [%5]                     \n"  // scale R, G, B
+      "ldr         q17, [%5, #96]                \n"  // bias R, G, B
+      "dup         v20.4s, v17.s[0]              \n"
+      "dup         v21.4s, v17.s[1]              \n"
+      "dup         v22.4s, v17.s[2]              \n"
+      "1:                                        \n"
+      "ld4         {v0.8b,v1.8b,v2.8b,v3.8b}, [%0], #32 \n"  // load 8 ARGB
+      "subs        %w4, %w4, #8                  \n"  // 8 pixels per loop
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "uxtl        v2.8h, v2.8b                  \n"  // R
+      "uxtl        v1.8h, v1.8b                  \n"  // G
+      "uxtl        v0.8h, v0.8b                  \n"  // B
+      "uxtl        v4.4s, v2.4h                  \n"
+      "uxtl2       v5.4s, v2.8h                  \n"
+      "uxtl        v6.4s, v1.4h                  \n"
+      "uxtl2       v7.4s, v1.8h                  \n"
+      "uxtl        v18.4s, v0.4h                 \n"
+      "uxtl2       v19.4s, v0.8h                 \n"
+      "ucvtf       v4.4s, v4.4s                  \n"
+      "ucvtf       v5.4s, v5.4s                  \n"
+      "ucvtf       v6.4s, v6.4s                  \n"
+      "ucvtf       v7.4s, v7.4s                  \n"
+      "ucvtf       v18.4s, v18.4s                \n"
+      "ucvtf       v19.4s, v19.4s                \n"
+      "fmul        v4.4s, v4.4s, v16.s[0]        \n"
+      "fmul        v5.4s, v5.4s, v16.s[0]        \n"
+      "fmul        v6.4s, v6.4s, v16.s[1]        \n"
+      "fmul        v7.4s, v7.4s, v16.s[1]        \n"
+      "fmul        v18.4s, v18.4s, v16.s[2]      \n"
+      "fmul        v19.4s, v19.4s, v16.s[2]      \n"
+      "fadd        v4.4s, v4.4s, v20.4s          \n"
+      "fadd        v5.4s, v5.4s, v20.4s          \n"
+      "fadd        v6.4s, v6.4s, v21.4s          \n"
+      "fadd        v7.4s, v7.4s, v21.4s          \n"
+      "fadd        v18.4s, v18.4s, v22.4s        \n"
+      "fadd        v19.4s, v19.4s, v22.4s        \n"
+      "stp         q4, q5, [%1], #32             \n"  // store 8 R
+      "stp         q6, q7, [%2], #32             \n"  // store 8 G
+      "stp         q18, q19, [%3], #32           \n"  // store 8 B
+      "b.gt        1b                            \n"
+      : "+r"(src_argb),  // %0
+        "+r"(dst_r),     // %1
+        "+r"(dst_g),     // %2
+        "+r"(dst_b),     // %3
+        "+r"(width)      // %4
+      : "r"(scale_bias)  // %5
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16",
+        "v17", "v18", "v19", "v20", "v21", "v22");
+}
+
+// Convert 8 RAW pixels to 24 RGB floats with scale and bias.
+void RAWToFloatRow_NEON(const uint8_t* src_raw,
+                        float* dst,
+                        const float* scale_bias,
+                        int width) {
+  asm volatile(
+      "ldr         q16, [%3]                     \n"  // scale R, G, B
+      "ldr         q17, [%3, #96]                \n"  // bias R, G, B
+      "dup         v20.4s, v17.s[0]              \n"
+      "dup         v21.4s, v17.s[1]              \n"
+      "dup         v22.4s, v17.s[2]              \n"
+      "1:                                        \n"
+      "ld3         {v0.8b,v1.8b,v2.8b}, [%0], #24 \n"  // load 8 RAW
+      "subs        %w2, %w2, #8                  \n"  // 8 pixels per loop
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "uxtl        v0.8h, v0.8b                  \n"  // R
+      "uxtl        v1.8h, v1.8b                  \n"  // G
+      "uxtl        v2.8h, v2.8b                  \n"  // B
+      "uxtl        v4.4s, v0.4h                  \n"
+      "uxtl        v5.4s, v1.4h                  \n"
+      "uxtl        v6.4s, v2.4h                  \n"
+      "uxtl2       v24.4s, v0.8h                 \n"
+      "uxtl2       v25.4s, v1.8h                 \n"
+      "uxtl2       v26.4s, v2.8h                 \n"
+      "ucvtf       v4.4s, v4.4s                  \n"
+      "ucvtf       v5.4s, v5.4s                  \n"
+      "ucvtf       v6.4s, v6.4s                  \n"
+      "ucvtf       v24.4s, v24.4s                \n"
+      "ucvtf       v25.4s, v25.4s                \n"
+      "ucvtf       v26.4s, v26.4s                \n"
+      "fmul        v4.4s, v4.4s, v16.s[0]        \n"
+      "fmul        v5.4s, v5.4s, v16.s[1]        \n"
+      "fmul        v6.4s, v6.4s, v16.s[2]        \n"
+      "fmul        v24.4s, v24.4s, v16.s[0]      \n"
+      "fmul        v25.4s, v25.4s, v16.s[1]      \n"
+      "fmul        v26.4s, v26.4s, v16.s[2]      \n"
+      "fadd        v4.4s, v4.4s, v20.4s          \n"
+      "fadd        v5.4s, v5.4s, v21.4s          \n"
+      "fadd        v6.4s, v6.4s, v22.4s          \n"
+      "fadd        v24.4s, v24.4s, v20.4s        \n"
+      "fadd        v25.4s, v25.4s, v21.4s        \n"
+      "fadd        v26.4s, v26.4s, v22.4s        \n"
+      "st3         {v4.4s,v5.4s,v6.4s}, [%1], #48 \n"  // store 12 floats
+      "st3         {v24.4s,v25.4s,v26.4s}, [%1], #48 \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_raw),   // %0
+        "+r"(dst),       // %1
+        "+r"(width)      // %2
+      : "r"(scale_bias)  // %3
+      : "cc", "memory", "v0", "v1", "v2", "v4", "v5", "v6", "v16", "v17", "v20",
+        "v21", "v22", "v24", "v25", "v26");
+}
+
 float ScaleMaxSamples_NEON(const float* src,
                            float* dst,
                            float scale,
@@ -4323,6 +4461,172 @@ void GaussRow_F32_NEON(const float* src, float* dst, int width) {
       : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v8");
 }
 
+// filter 5 rows with 1, 4, 6, 4, 1 coefficients to produce 1 row.
+void GaussCol_8_NEON(const uint8_t* src0,
+                     const uint8_t* src1,
+                     const uint8_t* src2,
+                     const uint8_t* src3,
+                     const uint8_t* src4,
+                     uint16_t* dst,
+                     int width) {
+  asm volatile(
+      "movi        v6.16b, #4                    \n"  // constant 4
+      "movi        v7.16b, #6                    \n"  // constant 6
+
+      "1:                                        \n"
+      "ld1         {v0.16b}, [%0], #16           \n"  // load 16 pixels, 5 rows
+      "ld1         {v1.16b}, [%4], #16           \n"
+      "uaddl       v2.8h, v0.8b, v1.8b           \n"  // * 1
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "uaddl2      v3.8h, v0.16b, v1.16b         \n"
+      "ld1         {v0.16b}, [%1], #16           \n"
+      "umlal       v2.8h, v0.8b, v6.8b           \n"  // * 4
+      "prfm        pldl1keep, [%1, 448]          \n"
+      "umlal2      v3.8h, v0.16b, v6.16b         \n"
+      "ld1         {v0.16b}, [%2], #16           \n"
+      "umlal       v2.8h, v0.8b, v7.8b           \n"  // * 6
+      "prfm        pldl1keep, [%2, 448]          \n"
+      "umlal2      v3.8h, v0.16b, v7.16b         \n"
+      "ld1         {v0.16b}, [%3], #16           \n"
+      "umlal       v2.8h, v0.8b, v6.8b           \n"  // * 4
+      "prfm        pldl1keep, [%3, 448]          \n"
+      "umlal2      v3.8h, v0.16b, v6.16b         \n"
+      "subs        %w6, %w6, #16                 \n"  // 16 processed per loop
+      "st1         {v2.8h, v3.8h}, [%5], #32     \n"  // store 16 sums
+      "prfm        pldl1keep, [%4, 448]          \n"
+      "b.gt        1b                            \n"
+      : "+r"(src0),  // %0
+        "+r"(src1),  // %1
+        "+r"(src2),  // %2
+        "+r"(src3),  // %3
+        "+r"(src4),  // %4
+        "+r"(dst),   // %5
+        "+r"(width)  // %6
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v6", "v7");
+}
+
+// filter 5 columns with 1, 4, 6, 4, 1 coefficients and round to bytes.
+// Reads 8 samples past the last tap.
+void GaussRow_8_NEON(const uint16_t* src, uint8_t* dst, int width) {
+  asm volatile(
+      "movi        v6.8h, #4                     \n"  // constant 4
+      "movi        v7.8h, #6                     \n"  // constant 6
+
+      "1:                                        \n"
+      "ld1         {v0.8h, v1.8h}, [%0]          \n"  // load 16 samples
+      "add         %0, %0, #16                   \n"
+      "ext         v2.16b, v0.16b, v1.16b, #8    \n"
+      "add         v2.8h, v2.8h, v0.8h           \n"  // * 1
+      "ext         v3.16b, v0.16b, v1.16b, #2    \n"
+      "ext         v4.16b, v0.16b, v1.16b, #6    \n"
+      "add         v3.8h, v3.8h, v4.8h           \n"
+      "mla         v2.8h, v3.8h, v6.8h           \n"  // * 4
+      "ext         v3.16b, v0.16b, v1.16b, #4    \n"
+      "mla         v2.8h, v3.8h, v7.8h           \n"  // * 6
+      "subs        %w2, %w2, #8                  \n"  // 8 processed per loop
+      "uqrshrn     v0.8b, v2.8h, #8              \n"  // round and pack
+      "st1         {v0.8b}, [%1], #8             \n"
+      "b.gt        1b                            \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v6", "v7");
+}
+
+// filter 7 rows with 1, 6, 15, 20, 15, 6, 1 coefficients to produce 1 row.
+void Gauss7Col_8_NEON(const uint8_t* src0,
+                      const uint8_t* src1,
+                      const uint8_t* src2,
+                      const uint8_t* src3,
+                      const uint8_t* src4,
+                      const uint8_t* src5,
+                      const uint8_t* src6,
+                      uint16_t* dst,
+                      int width) {
+  asm volatile(
+      "movi        v5.16b, #6                    \n"  // constant 6
+      "movi        v6.16b, #15                   \n"  // constant 15
+      "movi        v7.16b, #20                   \n"  // constant 20
+
+      "1:                                        \n"
+      "ld1         {v0.16b}, [%0], #16           \n"  // load 16 pixels, 7 rows
+      "ld1         {v1.16b}, [%6], #16           \n"
+      "uaddl       v2.8h, v0.8b, v1.8b           \n"  // * 1
+      "uaddl2      v3.8h, v0.16b, v1.16b         \n"
+      "ld1         {v0.16b}, [%1], #16           \n"
+      "ld1         {v1.16b}, [%5], #16           \n"
+      "umlal       v2.8h, v0.8b, v5.8b           \n"  // * 6
+      "umlal2      v3.8h, v0.16b, v5.16b         \n"
+      "umlal       v2.8h, v1.8b, v5.8b           \n"
+      "umlal2      v3.8h, v1.16b, v5.16b         \n"
+      "ld1         {v0.16b}, [%2], #16           \n"
+      "ld1         {v1.16b}, [%4], #16           \n"
+      "umlal       v2.8h, v0.8b, v6.8b           \n"  // * 15
+      "umlal2      v3.8h, v0.16b, v6.16b         \n"
+      "umlal       v2.8h, v1.8b, v6.8b           \n"
+      "umlal2      v3.8h, v1.16b, v6.16b         \n"
+      "ld1         {v0.16b}, [%3], #16           \n"
+      "umlal       v2.8h, v0.8b, v7.8b           \n"  // * 20
+      "umlal2      v3.8h, v0.16b, v7.16b         \n"
+      "subs        %w8, %w8, #16                 \n"  // 16 processed per loop
+      "st1         {v2.8h, v3.8h}, [%7], #32     \n"  // store 16 sums
+      "b.gt        1b                            \n"
+      : "+r"(src0),  // %0
+        "+r"(src1),  // %1
+        "+r"(src2),  // %2
+        "+r"(src3),  // %3
+        "+r"(src4),  // %4
+        "+r"(src5),  // %5
+        "+r"(src6),  // %6
+        "+r"(dst),   // %7
+        "+r"(width)  // %8
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v5", "v6", "v7");
+}
+
+// filter 7 columns with 1, 6, 15, 20, 15, 6, 1 coefficients and round to
+// bytes.  Reads 6 samples past the last tap.
+void Gauss7Row_8_NEON(const uint16_t* src, uint8_t* dst, int width) {
+  asm volatile(
+      "movi        v6.8h, #6                     \n"  // constant 6
+      "movi        v7.8h, #15                    \n"  // constant 15
+      "movi        v16.8h, #20                   \n"  // constant 20
+
+      "1:                                        \n"
+      "ld1         {v0.8h, v1.8h}, [%0]          \n"  // load 16 samples
+      "add         %0, %0, #16                   \n"
+      "ext         v2.16b, v0.16b, v1.16b, #12   \n"
+      "uaddl       v3.4s, v0.4h, v2.4h           \n"  // * 1
+      "uaddl2      v4.4s, v0.8h, v2.8h           \n"
+      "ext         v2.16b, v0.16b, v1.16b, #2    \n"
+      "ext         v5.16b, v0.16b, v1.16b, #10   \n"
+      "add         v2.8h, v2.8h, v5.8h           \n"
+      "umlal       v3.4s, v2.4h, v6.4h           \n"  // * 6
+      "umlal2      v4.4s, v2.8h, v6.8h           \n"
+      "ext         v2.16b, v0.16b, v1.16b, #4    \n"
+      "ext         v5.16b, v0.16b, v1.16b, #8    \n"
+      "add         v2.8h, v2.8h, v5.8h           \n"
+      "umlal       v3.4s, v2.4h, v7.4h           \n"  // * 15
+      "umlal2      v4.4s, v2.8h, v7.8h           \n"
+      "ext         v2.16b, v0.16b, v1.16b, #6    \n"
+      "umlal       v3.4s, v2.4h, v16.4h          \n"  // * 20
+      "umlal2      v4.4s, v2.8h, v16.8h          \n"
+      "subs        %w2, %w2, #8                  \n"  // 8 processed per loop
+      "uqrshrn     v0.4h, v3.4s, #12             \n"  // round and pack
+      "uqrshrn2    v0.8h, v4.4s, #12             \n"
+      "uqxtn       v0.8b, v0.8h                  \n"
+      "st1         {v0.8b}, [%1], #8             \n"
+      "b.gt        1b                            \n"
+      : "+r"(src),   // %0
+        "+r"(dst),   // %1
+        "+r"(width)  // %2
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+        "v16");
+}
+
 #if LIBYUV_USE_ST3
 // Convert biplanar NV21 to packed YUV24
 void NV21ToYUV24Row_NEON(const uint8_t* src_y,
@@ -4545,6 +4849,250 @@ void SplitUVRow_16_NEON(const uint16_t* src_uv,
       : "cc", "memory", "v0", "v1", "v2");
 }
 
+// Table lookups gather the 2 bytes holding each sample of 2 v210 groups into
+// Y, Y, U and V vectors, then shifts move each sample to the lsbs.
+static const uint8_t kV210ToI210Table[64] = {
+    1,  2,  4,  5,  6,  7,  9,  10, 12, 13, 14,  15,  17,  18,  20,  21,
+    22, 23, 25, 26, 28, 29, 30, 31, 255, 255, 255, 255, 255, 255, 255, 255,
+    0,  1,  5,  6,  10, 11, 16, 17, 21, 22, 26,  27,  255, 255, 255, 255,
+    2,  3,  8,  9,  13, 14, 18, 19, 24, 25, 29,  30,  255, 255, 255, 255};
+static const int16_t kV210ToI210Shift[32] = {
+    -2, 0,  -4, -2, 0,  -4, -2, 0,  -4, -2, 0, -4, 0, 0, 0, 0,
+    0,  -2, -4, 0,  -2, -4, 0,  0,  -4, 0,  -2, -4, 0, -2, 0, 0};
+
+void V210ToI210Row_NEON(const uint8_t* src_v210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width) {
+  asm volatile(
+      "ld1         {v16.16b,v17.16b,v18.16b,v19.16b}, [%5] \n"
+      "ld1         {v20.8h,v21.8h,v22.8h,v23.8h}, [%6] \n"
+      "mvni        v24.8h, #0xfc, lsl #8         \n"  // 0x3ff
+      "1:                                        \n"
+      "ld1         {v0.16b,v1.16b}, [%0], #32    \n"  // load 2 groups
+      "subs        %w4, %w4, #12                 \n"  // 12 pixels per loop
+      "tbl         v2.16b, {v0.16b,v1.16b}, v16.16b \n"
+      "tbl         v3.16b, {v0.16b,v1.16b}, v17.16b \n"
+      "tbl         v4.16b, {v0.16b,v1.16b}, v18.16b \n"
+      "tbl         v5.16b, {v0.16b,v1.16b}, v19.16b \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "ushl        v2.8h, v2.8h, v20.8h          \n"
+      "ushl        v3.8h, v3.8h, v21.8h          \n"
+      "ushl        v4.8h, v4.8h, v22.8h          \n"
+      "ushl        v5.8h, v5.8h, v23.8h          \n"
+      "and         v2.16b, v2.16b, v24.16b       \n"
+      "and         v3.16b, v3.16b, v24.16b       \n"
+      "and         v4.16b, v4.16b, v24.16b       \n"
+      "and         v5.16b, v5.16b, v24.16b       \n"
+      "st1         {v2.8h}, [%1], #16            \n"  // store 12 Y
+      "st1         {v3.4h}, [%1], #8             \n"
+      "st1         {v4.4h}, [%2], #8             \n"  // store 6 U
+      "st1         {v4.s}[2], [%2], #4           \n"
+      "st1         {v5.4h}, [%3], #8             \n"  // store 6 V
+      "st1         {v5.s}[2], [%3], #4           \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_v210),          // %0
+        "+r"(dst_y),             // %1
+        "+r"(dst_u),             // %2
+        "+r"(dst_v),             // %3
+        "+r"(width)              // %4
+      : "r"(kV210ToI210Table),   // %5
+        "r"(kV210ToI210Shift)    // %6
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v16", "v17",
+        "v18", "v19", "v20", "v21", "v22", "v23", "v24");
+}
+
+void Y210ToI210Row_NEON(const uint16_t* src_y210,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width) {
+  asm volatile(
+      "1:                                        \n"
+      "ld4         {v0.8h,v1.8h,v2.8h,v3.8h}, [%0], #64 \n"  // load 16 YUYV
+      "subs        %w4, %w4, #16                 \n"  // 16 pixels per loop
+      "ushr        v4.8h, v0.8h, #6              \n"
+      "ushr        v5.8h, v2.8h, #6              \n"
+      "ushr        v1.8h, v1.8h, #6              \n"
+      "ushr        v3.8h, v3.8h, #6              \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "st2         {v4.8h,v5.8h}, [%1], #32      \n"  // store 16 Y
+      "st1         {v1.8h}, [%2], #16            \n"  // store 8 U
+      "st1         {v3.8h}, [%3], #16            \n"  // store 8 V
+      "b.gt        1b                            \n"
+      : "+r"(src_y210),  // %0
+        "+r"(dst_y),     // %1
+        "+r"(dst_u),     // %2
+        "+r"(dst_v),     // %3
+        "+r"(width)      // %4
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5");
+}
+
+void I210ToY210Row_NEON(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint16_t* dst_y210,
+                        int width) {
+  asm volatile(
+      "mvni        v16.8h, #0xfc, lsl #8         \n"  // 1023
+      "1:                                        \n"
+      "ld1         {v4.8h}, [%0], #16            \n"  // load 16 Y
+      "ld1         {v6.8h}, [%0], #16            \n"
+      "ld1         {v2.8h}, [%1], #16            \n"  // load 8 U
+      "ld1         {v3.8h}, [%2], #16            \n"  // load 8 V
+      "subs        %w4, %w4, #16                 \n"  // 16 pixels per loop
+      "umin        v4.8h, v4.8h, v16.8h          \n"
+      "umin        v6.8h, v6.8h, v16.8h          \n"
+      "umin        v2.8h, v2.8h, v16.8h          \n"
+      "umin        v3.8h, v3.8h, v16.8h          \n"
+      "shl         v4.8h, v4.8h, #6              \n"
+      "shl         v6.8h, v6.8h, #6              \n"
+      "shl         v2.8h, v2.8h, #6              \n"
+      "shl         v3.8h, v3.8h, #6              \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "zip1        v5.8h, v2.8h, v3.8h           \n"
+      "zip2        v7.8h, v2.8h, v3.8h           \n"
+      "st2         {v4.8h,v5.8h}, [%3], #32      \n"  // store 16 YUYV
+      "st2         {v6.8h,v7.8h}, [%3], #32      \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_y210),  // %3
+        "+r"(width)      // %4
+      :
+      : "cc", "memory", "v2", "v3", "v4", "v5", "v6", "v7", "v16");
+}
+
+void Y410ToI410Row_NEON(const uint8_t* src_y410,
+                        uint16_t* dst_y,
+                        uint16_t* dst_u,
+                        uint16_t* dst_v,
+                        int width) {
+  asm volatile(
+      "mvni        v16.8h, #0xfc, lsl #8         \n"  // 0x3ff
+      "1:                                        \n"
+      "ld1         {v0.4s,v1.4s}, [%0], #32      \n"  // load 8 pixels
+      "subs        %w4, %w4, #8                  \n"  // 8 pixels per loop
+      "xtn         v2.4h, v0.4s                  \n"
+      "shrn        v3.4h, v0.4s, #10             \n"
+      "shrn        v4.4h, v0.4s, #16             \n"
+      "xtn2        v2.8h, v1.4s                  \n"
+      "shrn2       v3.8h, v1.4s, #10             \n"
+      "shrn2       v4.8h, v1.4s, #16             \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "ushr        v4.8h, v4.8h, #4              \n"
+      "and         v2.16b, v2.16b, v16.16b       \n"
+      "and         v3.16b, v3.16b, v16.16b       \n"
+      "and         v4.16b, v4.16b, v16.16b       \n"
+      "st1         {v3.8h}, [%1], #16            \n"  // store 8 Y
+      "st1         {v2.8h}, [%2], #16            \n"  // store 8 U
+      "st1         {v4.8h}, [%3], #16            \n"  // store 8 V
+      "b.gt        1b                            \n"
+      : "+r"(src_y410),  // %0
+        "+r"(dst_y),     // %1
+        "+r"(dst_u),     // %2
+        "+r"(dst_v),     // %3
+        "+r"(width)      // %4
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v16");
+}
+
+void I410ToY410Row_NEON(const uint16_t* src_y,
+                        const uint16_t* src_u,
+                        const uint16_t* src_v,
+                        uint8_t* dst_y410,
+                        int width) {
+  asm volatile(
+      "mvni        v16.8h, #0xfc, lsl #8         \n"  // 1023
+      "movi        v17.4s, #0xc0, lsl #24        \n"  // opaque alpha
+      "1:                                        \n"
+      "ld1         {v0.8h}, [%0], #16            \n"  // load 8 Y
+      "ld1         {v1.8h}, [%1], #16            \n"  // load 8 U
+      "ld1         {v2.8h}, [%2], #16            \n"  // load 8 V
+      "subs        %w4, %w4, #8                  \n"  // 8 pixels per loop
+      "umin        v0.8h, v0.8h, v16.8h          \n"
+      "umin        v1.8h, v1.8h, v16.8h          \n"
+      "umin        v2.8h, v2.8h, v16.8h          \n"
+      "ushll       v3.4s, v1.4h, #0              \n"
+      "ushll2      v4.4s, v1.8h, #0              \n"
+      "ushll       v5.4s, v0.4h, #10             \n"
+      "ushll2      v6.4s, v0.8h, #10             \n"
+      "orr         v3.16b, v3.16b, v5.16b        \n"
+      "orr         v4.16b, v4.16b, v6.16b        \n"
+      "ushll       v5.4s, v2.4h, #0              \n"
+      "ushll2      v6.4s, v2.8h, #0              \n"
+      "prfm        pldl1keep, [%0, 448]          \n"
+      "shl         v5.4s, v5.4s, #20             \n"
+      "shl         v6.4s, v6.4s, #20             \n"
+      "orr         v5.16b, v5.16b, v17.16b       \n"
+      "orr         v6.16b, v6.16b, v17.16b       \n"
+      "orr         v3.16b, v3.16b, v5.16b        \n"
+      "orr         v4.16b, v4.16b, v6.16b        \n"
+      "st1         {v3.4s,v4.4s}, [%3], #32      \n"  // store 8 Y410
+      "b.gt        1b                            \n"
+      : "+r"(src_y),     // %0
+        "+r"(src_u),     // %1
+        "+r"(src_v),     // %2
+        "+r"(dst_y410),  // %3
+        "+r"(width)      // %4
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v16",
+        "v17");
+}
+
+void BayerRowToARGBRow_NEON(const uint8_t* src_bayer0,
+                            const uint8_t* src_bayer1,
+                            const uint8_t* src_bayer2,
+                            uint8_t* dst_argb,
+                            int layout,
+                            int width) {
+  const int site = (layout & 1) ? 0xff00 : 0x00ff;
+  const int swap = (layout & 2) ? 0xff : 0;
+  asm volatile(
+      "dup         v6.8h, %w5                    \n"  // own color sites
+      "dup         v7.16b, %w6                   \n"  // swap R and B
+      "movi        v19.16b, #255                 \n"  // alpha
+      "1:                                        \n"
+      "ldur        q4, [%0, #-1]                 \n"  // diagonals
+      "ldur        q20, [%0, #1]                 \n"
+      "urhadd      v4.16b, v4.16b, v20.16b       \n"
+      "ldur        q5, [%2, #-1]                 \n"
+      "ldur        q20, [%2, #1]                 \n"
+      "urhadd      v5.16b, v5.16b, v20.16b       \n"
+      "urhadd      v5.16b, v5.16b, v4.16b        \n"
+      "ldur        q1, [%1, #-1]                 \n"  // left and right
+      "ldur        q20, [%1, #1]                 \n"
+      "urhadd      v1.16b, v1.16b, v20.16b       \n"
+      "ld1         {v2.16b}, [%0], #16           \n"  // above and below
+      "ld1         {v20.16b}, [%2], #16          \n"
+      "urhadd      v2.16b, v2.16b, v20.16b       \n"
+      "urhadd      v17.16b, v1.16b, v2.16b       \n"  // 4 neighbours
+      "ld1         {v0.16b}, [%1], #16           \n"  // center
+      "subs        %w4, %w4, #16                 \n"  // 16 pixels per loop
+      "bit         v1.16b, v0.16b, v6.16b        \n"  // own color
+      "bif         v17.16b, v0.16b, v6.16b       \n"  // G
+      "bif         v5.16b, v2.16b, v6.16b        \n"  // other color
+      "mov         v16.16b, v5.16b               \n"
+      "bit         v16.16b, v1.16b, v7.16b       \n"  // B
+      "mov         v18.16b, v1.16b               \n"
+      "bit         v18.16b, v5.16b, v7.16b       \n"  // R
+      "prfm        pldl1keep, [%1, 448]          \n"
+      "st4         {v16.16b,v17.16b,v18.16b,v19.16b}, [%3], #64 \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_bayer0),  // %0
+        "+r"(src_bayer1),  // %1
+        "+r"(src_bayer2),  // %2
+        "+r"(dst_argb),    // %3
+        "+r"(width)        // %4
+      : "r"(site),         // %5
+        "r"(swap)          // %6
+      : "cc", "memory", "v0", "v1", "v2", "v4", "v5", "v6", "v7", "v16", "v17",
+        "v18", "v19", "v20");
+}
+
 void MultiplyRow_16_NEON(const uint16_t* src_y,
                          uint16_t* dst_y,
                          int scale,
@@ -4622,6 +5170,273 @@ void Convert16To8Row_NEON(const uint16_t* src_y,
       : "cc", "memory", "v0", "v1", "v2");
 }
 
+// Convert 4 u,v pairs to x0 in v2, y0 in v3, fx in v0 and fy in v1.
+// Coordinates are clamped and split as in WarpCoord.
+#define WARPCOORDS_NEON                                                \
+  "ld2         {v0.4s,v1.4s}, [%[src_uv]], #32   \n"                   \
+  "fmaxnm      v0.4s, v0.4s, v29.4s              \n" /* NaN to 0 */    \
+  "fmaxnm      v1.4s, v1.4s, v29.4s              \n"                   \
+  "fmin        v0.4s, v0.4s, v24.4s              \n"                   \
+  "fmin        v1.4s, v1.4s, v25.4s              \n"                   \
+  "fcvtzs      v0.4s, v0.4s, #8                  \n" /* u * 256 */     \
+  "fcvtzs      v1.4s, v1.4s, #8                  \n" /* v * 256 */     \
+  "ushr        v2.4s, v0.4s, #8                  \n"                   \
+  "ushr        v3.4s, v1.4s, #8                  \n"                   \
+  "smin        v2.4s, v2.4s, v26.4s              \n" /* x0 */          \
+  "smin        v3.4s, v3.4s, v27.4s              \n" /* y0 */          \
+  "shl         v4.4s, v2.4s, #8                  \n"                   \
+  "shl         v5.4s, v3.4s, #8                  \n"                   \
+  "sub         v0.4s, v0.4s, v4.4s               \n" /* fx */          \
+  "sub         v1.4s, v1.4s, v5.4s               \n" /* fy */          \
+  "mul         v3.4s, v3.4s, v28.4s              \n"
+
+#define WARPSETUP_NEON                                                 \
+  "dup         v24.4s, %w[xmax]                  \n"                   \
+  "dup         v25.4s, %w[ymax]                  \n"                   \
+  "scvtf       v24.4s, v24.4s                    \n"                   \
+  "scvtf       v25.4s, v25.4s                    \n"                   \
+  "dup         v26.4s, %w[xmax]                  \n"                   \
+  "dup         v27.4s, %w[ymax]                  \n"                   \
+  "movi        v29.4s, #1                        \n"                   \
+  "sub         v26.4s, v26.4s, v29.4s            \n" /* width - 2 */   \
+  "sub         v27.4s, v27.4s, v29.4s            \n" /* height - 2 */  \
+  "dup         v28.4s, %w[stride]                \n"                   \
+  "movi        v29.4s, #0                        \n"
+
+// Bilinear sample 4 ARGB pixels per loop.
+// Requires src_width and src_height of at least 2.
+void ARGBWarpRow_NEON(const uint8_t* src_argb,
+                      int src_stride_argb,
+                      int src_width,
+                      int src_height,
+                      const float* src_uv,
+                      uint8_t* dst_argb,
+                      int width) {
+  int64_t stride = src_stride_argb;
+  int64_t t0, t1;
+  asm volatile(
+      WARPSETUP_NEON
+      "1:                                        \n"  //
+      WARPCOORDS_NEON
+      "shl         v2.4s, v2.4s, #2              \n"
+      "add         v2.4s, v2.4s, v3.4s           \n"  // offset
+      "smov        %[t0], v2.s[0]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v4.d}[0],      [%[t0]]              \n"
+      "ld1         {v6.d}[0],      [%[t1]]              \n"
+      "smov        %[t0], v2.s[1]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v4.d}[1],      [%[t0]]              \n"
+      "ld1         {v6.d}[1],      [%[t1]]              \n"
+      "smov        %[t0], v2.s[2]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v5.d}[0],      [%[t0]]              \n"
+      "ld1         {v7.d}[0],      [%[t1]]              \n"
+      "smov        %[t0], v2.s[3]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v5.d}[1],      [%[t0]]              \n"
+      "ld1         {v7.d}[1],      [%[t1]]              \n"
+      "uzp1        v16.4s, v4.4s, v5.4s          \n"  // top left
+      "uzp2        v17.4s, v4.4s, v5.4s          \n"  // top right
+      "uzp1        v18.4s, v6.4s, v7.4s          \n"  // bottom left
+      "uzp2        v19.4s, v6.4s, v7.4s          \n"  // bottom right
+      "xtn         v20.4h, v0.4s                 \n"
+      "zip1        v20.8h, v20.8h, v20.8h        \n"
+      "zip2        v21.8h, v20.8h, v20.8h        \n"  // fx for pixels 2, 3
+      "zip1        v20.8h, v20.8h, v20.8h        \n"  // fx for pixels 0, 1
+      "xtn         v22.4h, v1.4s                 \n"
+      "zip1        v22.8h, v22.8h, v22.8h        \n"
+      "zip2        v23.8h, v22.8h, v22.8h        \n"  // fy for pixels 2, 3
+      "zip1        v22.8h, v22.8h, v22.8h        \n"  // fy for pixels 0, 1
+
+      // Top row.  a * 256 + (b - a) * fx wraps but the result fits 16 bits.
+      "uxtl        v4.8h, v16.8b                 \n"
+      "uxtl2       v5.8h, v16.16b                \n"
+      "uxtl        v6.8h, v17.8b                 \n"
+      "uxtl2       v7.8h, v17.16b                \n"
+      "sub         v6.8h, v6.8h, v4.8h           \n"
+      "sub         v7.8h, v7.8h, v5.8h           \n"
+      "shl         v4.8h, v4.8h, #8              \n"
+      "shl         v5.8h, v5.8h, #8              \n"
+      "mla         v4.8h, v6.8h, v20.8h          \n"
+      "mla         v5.8h, v7.8h, v21.8h          \n"
+      "urshr       v4.8h, v4.8h, #8              \n"
+      "urshr       v5.8h, v5.8h, #8              \n"
+
+      // Bottom row.
+      "uxtl        v6.8h, v18.8b                 \n"
+      "uxtl2       v7.8h, v18.16b                \n"
+      "uxtl        v16.8h, v19.8b                \n"
+      "uxtl2       v17.8h, v19.16b               \n"
+      "sub         v16.8h, v16.8h, v6.8h         \n"
+      "sub         v17.8h, v17.8h, v7.8h         \n"
+      "shl         v6.8h, v6.8h, #8              \n"
+      "shl         v7.8h, v7.8h, #8              \n"
+      "mla         v6.8h, v16.8h, v20.8h         \n"
+      "mla         v7.8h, v17.8h, v21.8h         \n"
+      "urshr       v6.8h, v6.8h, #8              \n"
+      "urshr       v7.8h, v7.8h, #8              \n"
+
+      // Vertical.
+      "sub         v6.8h, v6.8h, v4.8h           \n"
+      "sub         v7.8h, v7.8h, v5.8h           \n"
+      "shl         v4.8h, v4.8h, #8              \n"
+      "shl         v5.8h, v5.8h, #8              \n"
+      "mla         v4.8h, v6.8h, v22.8h          \n"
+      "mla         v5.8h, v7.8h, v23.8h          \n"
+      "uqrshrn     v4.8b, v4.8h, #8              \n"
+      "uqrshrn2    v4.16b, v5.8h, #8             \n"
+      "subs        %w[width], %w[width], #4      \n"  // 4 pixels per loop
+      "st1         {v4.16b}, [%[dst]], #16       \n"
+      "b.gt        1b                            \n"
+      : [src_uv] "+r"(src_uv),    // %[src_uv]
+        [dst] "+r"(dst_argb),     // %[dst]
+        [width] "+r"(width),      // %[width]
+        [t0] "=&r"(t0),           // %[t0]
+        [t1] "=&r"(t1)            // %[t1]
+      : [src] "r"(src_argb),      // %[src]
+        [stride] "r"(stride),     // %[stride]
+        [xmax] "r"(src_width - 1),   // %[xmax]
+        [ymax] "r"(src_height - 1)   // %[ymax]
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16",
+        "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25", "v26",
+        "v27", "v28", "v29");
+}
+
+// Bilinear sample 4 pixels per loop.
+// Requires src_width and src_height of at least 2.
+void WarpRow_NEON(const uint8_t* src,
+                  int src_stride,
+                  int src_width,
+                  int src_height,
+                  const float* src_uv,
+                  uint8_t* dst,
+                  int width) {
+  int64_t stride = src_stride;
+  int64_t t0, t1;
+  asm volatile(
+      WARPSETUP_NEON
+      "1:                                        \n"  //
+      WARPCOORDS_NEON
+      "add         v2.4s, v2.4s, v3.4s           \n"  // offset
+      "smov        %[t0], v2.s[0]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v4.h}[0], [%[t0]]              \n"
+      "ld1         {v5.h}[0], [%[t1]]              \n"
+      "smov        %[t0], v2.s[1]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v4.h}[1], [%[t0]]              \n"
+      "ld1         {v5.h}[1], [%[t1]]              \n"
+      "smov        %[t0], v2.s[2]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v4.h}[2], [%[t0]]              \n"
+      "ld1         {v5.h}[2], [%[t1]]              \n"
+      "smov        %[t0], v2.s[3]                \n"
+      "add         %[t0], %[src], %[t0]           \n"
+      "add         %[t1], %[t0], %[stride]        \n"
+      "ld1         {v4.h}[3], [%[t0]]              \n"
+      "ld1         {v5.h}[3], [%[t1]]              \n"
+      "uzp1        v6.8b, v4.8b, v5.8b           \n"  // left, top and bottom
+      "uzp2        v7.8b, v4.8b, v5.8b           \n"  // right
+      "xtn         v20.4h, v0.4s                 \n"
+      "mov         v20.d[1], v20.d[0]            \n"  // fx
+      "xtn         v21.4h, v1.4s                 \n"  // fy
+      "uxtl        v6.8h, v6.8b                  \n"
+      "uxtl        v7.8h, v7.8b                  \n"
+      "sub         v7.8h, v7.8h, v6.8h           \n"
+      "shl         v6.8h, v6.8h, #8              \n"
+      "mla         v6.8h, v7.8h, v20.8h          \n"
+      "urshr       v6.8h, v6.8h, #8              \n"
+      "ext         v7.16b, v6.16b, v6.16b, #8    \n"  // bottom
+      "sub         v7.4h, v7.4h, v6.4h           \n"
+      "shl         v6.4h, v6.4h, #8              \n"
+      "mla         v6.4h, v7.4h, v21.4h          \n"
+      "uqrshrn     v6.8b, v6.8h, #8              \n"
+      "subs        %w[width], %w[width], #4      \n"  // 4 pixels per loop
+      "st1         {v6.s}[0], [%[dst]], #4       \n"
+      "b.gt        1b                            \n"
+      : [src_uv] "+r"(src_uv),    // %[src_uv]
+        [dst] "+r"(dst),          // %[dst]
+        [width] "+r"(width),      // %[width]
+        [t0] "=&r"(t0),           // %[t0]
+        [t1] "=&r"(t1)            // %[t1]
+      : [src] "r"(src),           // %[src]
+        [stride] "r"(stride),     // %[stride]
+        [xmax] "r"(src_width - 1),   // %[xmax]
+        [ymax] "r"(src_height - 1)   // %[ymax]
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v20",
+        "v21", "v24", "v25", "v26", "v27", "v28", "v29");
+}
+
+#undef WARPCOORDS_NEON
+#undef WARPSETUP_NEON
+
+// Add src_add - src_sub to 16 running sums per loop.
+void BlurColumnRow_NEON(const uint8_t* src_add,
+                        const uint8_t* src_sub,
+                        int32_t* dst_sum,
+                        int width) {
+  asm volatile(
+      "1:                                        \n"
+      "ld1         {v0.16b}, [%0], #16           \n"
+      "ld1         {v1.16b}, [%1], #16           \n"
+      "ld1         {v2.4s, v3.4s, v4.4s, v5.4s}, [%2] \n"
+      "subs        %w3, %w3, #16                 \n"  // 16 sums per loop
+      "usubl       v6.8h, v0.8b, v1.8b           \n"  // signed differences
+      "usubl2      v7.8h, v0.16b, v1.16b         \n"
+      "saddw       v2.4s, v2.4s, v6.4h           \n"
+      "saddw2      v3.4s, v3.4s, v6.8h           \n"
+      "saddw       v4.4s, v4.4s, v7.4h           \n"
+      "saddw2      v5.4s, v5.4s, v7.8h           \n"
+      "st1         {v2.4s, v3.4s, v4.4s, v5.4s}, [%2], #64 \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_add),  // %0
+        "+r"(src_sub),  // %1
+        "+r"(dst_sum),  // %2
+        "+r"(width)     // %3
+      :
+      : "cc", "memory", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7");
+}
+
+// Normalize 8 box sums per loop.
+void BlurScaleRow_NEON(const int32_t* src_sum,
+                       const float* src_scale,
+                       float scale,
+                       uint8_t* dst,
+                       int width) {
+  asm volatile(
+      "1:                                        \n"
+      "ld1         {v0.4s, v1.4s}, [%0], #32     \n"
+      "ld1         {v2.4s, v3.4s}, [%1], #32     \n"
+      "subs        %w3, %w3, #8                  \n"  // 8 sums per loop
+      "scvtf       v0.4s, v0.4s                  \n"
+      "scvtf       v1.4s, v1.4s                  \n"
+      "fmul        v0.4s, v0.4s, v2.4s           \n"
+      "fmul        v1.4s, v1.4s, v3.4s           \n"
+      "fmul        v0.4s, v0.4s, %4.s[0]         \n"
+      "fmul        v1.4s, v1.4s, %4.s[0]         \n"
+      "fcvtzs      v0.4s, v0.4s                  \n"
+      "fcvtzs      v1.4s, v1.4s                  \n"
+      "sqrshrun    v0.4h, v0.4s, #8              \n"  // (v + 128) >> 8
+      "sqrshrun2   v0.8h, v1.4s, #8              \n"
+      "uqxtn       v0.8b, v0.8h                  \n"
+      "st1         {v0.8b}, [%2], #8             \n"
+      "b.gt        1b                            \n"
+      : "+r"(src_sum),    // %0
+        "+r"(src_scale),  // %1
+        "+r"(dst),        // %2
+        "+r"(width)       // %3
+      : "w"(scale)        // %4
+      : "cc", "memory", "v0", "v1", "v2", "v3");
+}
+
 #endif  // !defined(LIBYUV_DISABLE_NEON) && defined(__aarch64__)
 
 #ifdef __cplusplus
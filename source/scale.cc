@@ -1065,6 +1065,14 @@ static void ScalePlaneBox_16(int src_width,
       ScaleAddRow = ScaleAddRow_16_SSE2;
     }
 #endif
+#if defined(HAS_SCALEADDROW_16_AVX2)
+    if (TestCpuFlag(kCpuHasAVX2)) {
+      ScaleAddRow = ScaleAddRow_16_Any_AVX2;
+      if (IS_ALIGNED(src_width, 16)) {
+        ScaleAddRow = ScaleAddRow_16_AVX2;
+      }
+    }
+#endif
 
     for (j = 0; j < dst_height; ++j) {
       int boxheight;
@@ -2110,6 +2118,38 @@ void ScalePlane(const uint8_t* src,
                    dst_stride, src, dst);
 }
 
+// Scale a plane of sRGB encoded values in linear light.
+LIBYUV_API
+void ScalePlaneLinearLight(const uint8_t* src,
+                           int src_stride,
+                           int src_width,
+                           int src_height,
+                           uint8_t* dst,
+                           int dst_stride,
+                           int dst_width,
+                           int dst_height,
+                           enum FilterMode filtering) {
+  // Simplify filtering when possible.
+  filtering = ScaleFilterReduce(src_width, src_height, dst_width, dst_height,
+                                filtering);
+
+  // Negative height means invert the image.
+  if (src_height < 0) {
+    src_height = -src_height;
+    src = src + (src_height - 1) * (int64_t)src_stride;
+    src_stride = -src_stride;
+  }
+  // Point sampling and copies do not mix pixels.
+  if (filtering == kFilterNone ||
+      (dst_width == src_width && dst_height == src_height)) {
+    ScalePlane(src, src_stride, src_width, src_height, dst, dst_stride,
+               dst_width, dst_height, filtering);
+    return;
+  }
+  ScaleLinearLight(src_width, src_height, dst_width, dst_height, src_stride,
+                   dst_stride, src, dst, /*bpp=*/1, filtering);
+}
+
 LIBYUV_API
 void ScalePlane_16(const uint16_t* src,
                    int src_stride,
@@ -2369,6 +2409,62 @@ int I420Scale_12(const uint16_t* src_y,
   return 0;
 }
 
+// Scale an I420 image with alpha.
+// The alpha plane is full size and is scaled like the Y plane.
+// If attenuate is true, the scaled Y, U and V are premultiplied by the scaled
+// alpha, which is equivalent to I420Blend over black: Y is multiplied by
+// alpha and U and V are blended toward 128 using alpha subsampled 2x2.
+
+LIBYUV_API
+int I420AScale(const uint8_t* src_y,
+               int src_stride_y,
+               const uint8_t* src_u,
+               int src_stride_u,
+               const uint8_t* src_v,
+               int src_stride_v,
+               const uint8_t* src_a,
+               int src_stride_a,
+               int src_width,
+               int src_height,
+               uint8_t* dst_y,
+               int dst_stride_y,
+               uint8_t* dst_u,
+               int dst_stride_u,
+               uint8_t* dst_v,
+               int dst_stride_v,
+               uint8_t* dst_a,
+               int dst_stride_a,
+               int dst_width,
+               int dst_height,
+               enum FilterMode filtering,
+               int attenuate) {
+  int r;
+  if (!src_a || !dst_a) {
+    return -1;
+  }
+  r = I420Scale(src_y, src_stride_y, src_u, src_stride_u, src_v, src_stride_v,
+                src_width, src_height, dst_y, dst_stride_y, dst_u, dst_stride_u,
+                dst_v, dst_stride_v, dst_width, dst_height, filtering);
+  if (r != 0) {
+    return r;
+  }
+  ScalePlane(src_a, src_stride_a, src_width, src_height, dst_a, dst_stride_a,
+             dst_width, dst_height, filtering);
+  if (attenuate) {
+    // Background is a single black row used with a stride of 0.
+    int dst_halfwidth = SUBSAMPLE(dst_width, 1, 1);
+    align_buffer_64(black, dst_width + dst_halfwidth);
+    memset(black, 0, dst_width);
+    memset(black + dst_width, 128, dst_halfwidth);
+    r = I420Blend(dst_y, dst_stride_y, dst_u, dst_stride_u, dst_v, dst_stride_v,
+                  black, 0, black + dst_width, 0, black + dst_width, 0, dst_a,
+                  dst_stride_a, dst_y, dst_stride_y, dst_u, dst_stride_u, dst_v,
+                  dst_stride_v, dst_width, dst_height);
+    free_aligned_buffer_64(black);
+  }
+  return r;
+}
+
 // Scale an I444 image.
 // This function in turn calls a scaling function for each plane.
 
@@ -2471,6 +2567,61 @@ int I444Scale_12(const uint16_t* src_y,
   return 0;
 }
 
+// Scale an I444 image with alpha.
+// If attenuate is true, the scaled Y is multiplied by the scaled alpha and
+// U and V are blended toward 128.
+
+LIBYUV_API
+int I444AScale(const uint8_t* src_y,
+               int src_stride_y,
+               const uint8_t* src_u,
+               int src_stride_u,
+               const uint8_t* src_v,
+               int src_stride_v,
+               const uint8_t* src_a,
+               int src_stride_a,
+               int src_width,
+               int src_height,
+               uint8_t* dst_y,
+               int dst_stride_y,
+               uint8_t* dst_u,
+               int dst_stride_u,
+               uint8_t* dst_v,
+               int dst_stride_v,
+               uint8_t* dst_a,
+               int dst_stride_a,
+               int dst_width,
+               int dst_height,
+               enum FilterMode filtering,
+               int attenuate) {
+  int r;
+  if (!src_a || !dst_a) {
+    return -1;
+  }
+  r = I444Scale(src_y, src_stride_y, src_u, src_stride_u, src_v, src_stride_v,
+                src_width, src_height, dst_y, dst_stride_y, dst_u, dst_stride_u,
+                dst_v, dst_stride_v, dst_width, dst_height, filtering);
+  if (r != 0) {
+    return r;
+  }
+  ScalePlane(src_a, src_stride_a, src_width, src_height, dst_a, dst_stride_a,
+             dst_width, dst_height, filtering);
+  if (attenuate) {
+    // Background is a single black row used with a stride of 0.
+    align_buffer_64(black, dst_width * 2);
+    memset(black, 0, dst_width);
+    memset(black + dst_width, 128, dst_width);
+    BlendPlane(dst_y, dst_stride_y, black, 0, dst_a, dst_stride_a, dst_y,
+               dst_stride_y, dst_width, dst_height);
+    BlendPlane(dst_u, dst_stride_u, black + dst_width, 0, dst_a, dst_stride_a,
+               dst_u, dst_stride_u, dst_width, dst_height);
+    BlendPlane(dst_v, dst_stride_v, black + dst_width, 0, dst_a, dst_stride_a,
+               dst_v, dst_stride_v, dst_width, dst_height);
+    free_aligned_buffer_64(black);
+  }
+  return 0;
+}
+
 // Scale an I422 image.
 // This function in turn calls a scaling function for each plane.
 
@@ -2617,6 +2768,410 @@ int NV12Scale(const uint8_t* src_y,
   return 0;
 }
 
+// Split a packed 4:2:2 row into Y, U and V rows stored one after another,
+// each followed by a copy of its last pixel for bilinear filtering.
+static void UnpackPacked422Row(const uint8_t* src_ptr,
+                               uint8_t* dst_ptr,
+                               int width,
+                               void (*ToYRow)(const uint8_t* src_ptr,
+                                              uint8_t* dst_y,
+                                              int width),
+                               void (*ToUV422Row)(const uint8_t* src_ptr,
+                                                  uint8_t* dst_u,
+                                                  uint8_t* dst_v,
+                                                  int width)) {
+  const int halfwidth = SUBSAMPLE(width, 1, 1);
+  uint8_t* dst_u = dst_ptr + width + 1;
+  uint8_t* dst_v = dst_u + halfwidth + 1;
+  ToYRow(src_ptr, dst_ptr, width);
+  ToUV422Row(src_ptr, dst_u, dst_v, width);
+  dst_ptr[width] = dst_ptr[width - 1];
+  dst_u[halfwidth] = dst_u[halfwidth - 1];
+  dst_v[halfwidth] = dst_v[halfwidth - 1];
+}
+
+// Scale packed 4:2:2 rows without unpacking the whole image.
+// Each source row is split into Y, U and V rows, which are filtered with the
+// planar row functions and packed back into the destination row.  The 3
+// unpacked planes of a row are kept together so 1 InterpolateRow blends them.
+static void ScalePacked422(int src_width,
+                           int src_height,
+                           int dst_width,
+                           int dst_height,
+                           int src_stride,
+                           int dst_stride,
+                           const uint8_t* src_ptr,
+                           uint8_t* dst_ptr,
+                           enum FilterMode filtering,
+                           void (*ToYRow)(const uint8_t* src_ptr,
+                                          uint8_t* dst_y,
+                                          int width),
+                           void (*ToUV422Row)(const uint8_t* src_ptr,
+                                              uint8_t* dst_u,
+                                              uint8_t* dst_v,
+                                              int width),
+                           void (*I422ToPackedRow)(const uint8_t* src_y,
+                                                   const uint8_t* src_u,
+                                                   const uint8_t* src_v,
+                                                   uint8_t* dst_ptr,
+                                                   int width)) {
+  const int src_halfwidth = SUBSAMPLE(src_width, 1, 1);
+  const int dst_halfwidth = SUBSAMPLE(dst_width, 1, 1);
+  // Unpacked rows include 1 extra pixel per plane for the right edge.
+  const int src_widths[3] = {src_width, src_halfwidth, src_halfwidth};
+  const int dst_widths[3] = {dst_width, dst_halfwidth, dst_halfwidth};
+  const int src_offsets[3] = {0, src_width + 1, src_width + src_halfwidth + 2};
+  const int dst_offsets[3] = {0, dst_width, dst_width + dst_halfwidth};
+  const int row_size = (src_width + src_halfwidth * 2 + 3 + 63) & ~63;
+  int xs[3] = {0, 0, 0};
+  int dxs[3] = {0, 0, 0};
+  int y = 0;
+  int dy = 0;
+  int i;
+  int j;
+  align_buffer_64(dst_row, dst_width + dst_halfwidth * 2);
+
+  // Box filter is only used to scale down.
+  if (filtering == kFilterBox &&
+      (src_width < dst_width || src_height < dst_height)) {
+    filtering = kFilterBilinear;
+  }
+  for (i = 0; i < 3; ++i) {
+    ScaleSlope(src_widths[i], src_height, dst_widths[i], dst_height,
+               filtering, &xs[i], &y, &dxs[i], &dy);
+  }
+
+  if (filtering == kFilterBox) {
+    const int max_y = (src_height << 16);
+    void (*ScaleAddRow)(const uint8_t* src_ptr, uint16_t* dst_ptr,
+                        int src_width) = ScaleAddRow_C;
+    align_buffer_64(row, row_size);
+    align_buffer_64(row16, row_size * 2);
+#if defined(HAS_SCALEADDROW_SSE2)
+    if (TestCpuFlag(kCpuHasSSE2)) {
+      ScaleAddRow = ScaleAddRow_Any_SSE2;
+    }
+#endif
+#if defined(HAS_SCALEADDROW_AVX2)
+    if (TestCpuFlag(kCpuHasAVX2)) {
+      ScaleAddRow = ScaleAddRow_Any_AVX2;
+    }
+#endif
+#if defined(HAS_SCALEADDROW_NEON)
+    if (TestCpuFlag(kCpuHasNEON)) {
+      ScaleAddRow = ScaleAddRow_Any_NEON;
+    }
+#endif
+    for (j = 0; j < dst_height; ++j) {
+      int boxheight;
+      int k;
+      int iy = y >> 16;
+      const uint8_t* src = src_ptr + iy * (int64_t)src_stride;
+      y += dy;
+      if (y > max_y) {
+        y = max_y;
+      }
+      boxheight = MIN1((y >> 16) - iy);
+      memset(row16, 0, row_size * 2);
+      for (k = 0; k < boxheight; ++k) {
+        UnpackPacked422Row(src, row, src_width, ToYRow, ToUV422Row);
+        for (i = 0; i < 3; ++i) {
+          ScaleAddRow(row + src_offsets[i],
+                      (uint16_t*)(row16) + src_offsets[i], src_widths[i]);
+        }
+        src += src_stride;
+      }
+      for (i = 0; i < 3; ++i) {
+        void (*ScaleAddCols)(int dst_width, int boxheight, int x, int dx,
+                             const uint16_t* src_ptr, uint8_t* dst_ptr) =
+            (dxs[i] & 0xffff)
+                ? ScaleAddCols2_C
+                : ((dxs[i] != 0x10000) ? ScaleAddCols1_C : ScaleAddCols0_C);
+        ScaleAddCols(dst_widths[i], boxheight, xs[i], dxs[i],
+                     (uint16_t*)(row16) + src_offsets[i],
+                     dst_row + dst_offsets[i]);
+      }
+      I422ToPackedRow(dst_row, dst_row + dst_offsets[1],
+                      dst_row + dst_offsets[2], dst_ptr, dst_width);
+      dst_ptr += dst_stride;
+    }
+    free_aligned_buffer_64(row);
+    free_aligned_buffer_64(row16);
+  } else {
+    const int max_y = (src_height - 1) << 16;
+    int lasty = -1;
+    void (*InterpolateRow)(uint8_t* dst_ptr, const uint8_t* src_ptr,
+                           ptrdiff_t src_stride, int dst_width,
+                           int source_y_fraction) = InterpolateRow_C;
+    void (*ScaleCols)(uint8_t* dst_ptr, const uint8_t* src_ptr, int dst_width,
+                      int x, int dx) =
+        (filtering == kFilterNone)
+            ? ScaleCols_C
+            : ((src_width >= 32768) ? ScaleFilterCols64_C : ScaleFilterCols_C);
+    align_buffer_64(rows, row_size * 3);
+    uint8_t* rowa = rows;
+    uint8_t* rowb = rows + row_size;
+    uint8_t* row = rows + row_size * 2;
+#if defined(HAS_INTERPOLATEROW_SSSE3)
+    if (TestCpuFlag(kCpuHasSSSE3)) {
+      InterpolateRow = InterpolateRow_SSSE3;
+    }
+#endif
+#if defined(HAS_INTERPOLATEROW_AVX2)
+    if (TestCpuFlag(kCpuHasAVX2)) {
+      InterpolateRow = InterpolateRow_AVX2;
+    }
+#endif
+#if defined(HAS_INTERPOLATEROW_NEON)
+    if (TestCpuFlag(kCpuHasNEON)) {
+      InterpolateRow = InterpolateRow_NEON;
+    }
+#endif
+    if (filtering != kFilterNone) {
+#if defined(HAS_SCALEFILTERCOLS_SSSE3)
+      if (TestCpuFlag(kCpuHasSSSE3) && src_width < 32768) {
+        ScaleCols = ScaleFilterCols_SSSE3;
+      }
+#endif
+#if defined(HAS_SCALEFILTERCOLS_NEON)
+      if (TestCpuFlag(kCpuHasNEON) && src_width < 32768) {
+        ScaleCols = ScaleFilterCols_Any_NEON;
+      }
+#endif
+    }
+    for (j = 0; j < dst_height; ++j) {
+      int yi;
+      int yf;
+      if (y > max_y) {
+        y = max_y;
+      }
+      yi = y >> 16;
+      yf = (filtering == kFilterBilinear) ? ((y >> 8) & 255) : 0;
+      // Keep the 2 unpacked source rows for the next destination row.
+      if (yi != lasty) {
+        int yi1 = (yi + 1 < src_height) ? yi + 1 : yi;
+        if (lasty >= 0 && yi == lasty + 1 && filtering == kFilterBilinear) {
+          uint8_t* tmp = rowa;
+          rowa = rowb;
+          rowb = tmp;
+        } else {
+          UnpackPacked422Row(src_ptr + yi * (int64_t)src_stride, rowa,
+                             src_width, ToYRow, ToUV422Row);
+        }
+        if (filtering == kFilterBilinear) {
+          UnpackPacked422Row(src_ptr + yi1 * (int64_t)src_stride, rowb,
+                             src_width, ToYRow, ToUV422Row);
+        }
+        lasty = yi;
+      }
+      if (yf != 0) {
+        InterpolateRow(row, rowa, rowb - rowa, row_size, yf);
+      }
+      for (i = 0; i < 3; ++i) {
+        ScaleCols(dst_row + dst_offsets[i],
+                  (yf ? row : rowa) + src_offsets[i], dst_widths[i], xs[i],
+                  dxs[i]);
+      }
+      I422ToPackedRow(dst_row, dst_row + dst_offsets[1],
+                      dst_row + dst_offsets[2], dst_ptr, dst_width);
+      dst_ptr += dst_stride;
+      y += dy;
+    }
+    free_aligned_buffer_64(rows);
+  }
+  free_aligned_buffer_64(dst_row);
+}
+
+// Scale a YUY2 image.
+LIBYUV_API
+int YUY2Scale(const uint8_t* src_yuy2,
+              int src_stride_yuy2,
+              int src_width,
+              int src_height,
+              uint8_t* dst_yuy2,
+              int dst_stride_yuy2,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering) {
+  void (*YUY2ToUV422Row)(const uint8_t* src_yuy2, uint8_t* dst_u,
+                         uint8_t* dst_v, int width) = YUY2ToUV422Row_C;
+  void (*YUY2ToYRow)(const uint8_t* src_yuy2, uint8_t* dst_y, int width) =
+      YUY2ToYRow_C;
+  void (*I422ToYUY2Row)(const uint8_t* src_y, const uint8_t* src_u,
+                        const uint8_t* src_v, uint8_t* dst_yuy2, int width) =
+      I422ToYUY2Row_C;
+  if (!src_yuy2 || src_width <= 0 || src_height == 0 || src_width > 32768 ||
+      src_height > 32768 || !dst_yuy2 || dst_width <= 0 || dst_height <= 0) {
+    return -1;
+  }
+  filtering = ScaleFilterReduce(src_width, src_height, dst_width, dst_height,
+                                filtering);
+  // Negative height means invert the image.
+  if (src_height < 0) {
+    src_height = -src_height;
+    src_yuy2 = src_yuy2 + (src_height - 1) * (int64_t)src_stride_yuy2;
+    src_stride_yuy2 = -src_stride_yuy2;
+  }
+  if (dst_width == src_width && dst_height == src_height) {
+    CopyPlane(src_yuy2, src_stride_yuy2, dst_yuy2, dst_stride_yuy2,
+              src_width * 2, src_height);
+    return 0;
+  }
+#if defined(HAS_YUY2TOYROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    YUY2ToUV422Row = YUY2ToUV422Row_Any_SSE2;
+    YUY2ToYRow = YUY2ToYRow_Any_SSE2;
+    if (IS_ALIGNED(src_width, 16)) {
+      YUY2ToUV422Row = YUY2ToUV422Row_SSE2;
+      YUY2ToYRow = YUY2ToYRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_YUY2TOYROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    YUY2ToUV422Row = YUY2ToUV422Row_Any_AVX2;
+    YUY2ToYRow = YUY2ToYRow_Any_AVX2;
+    if (IS_ALIGNED(src_width, 32)) {
+      YUY2ToUV422Row = YUY2ToUV422Row_AVX2;
+      YUY2ToYRow = YUY2ToYRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_YUY2TOYROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    YUY2ToYRow = YUY2ToYRow_Any_NEON;
+    YUY2ToUV422Row = YUY2ToUV422Row_Any_NEON;
+    if (IS_ALIGNED(src_width, 16)) {
+      YUY2ToYRow = YUY2ToYRow_NEON;
+      YUY2ToUV422Row = YUY2ToUV422Row_NEON;
+    }
+  }
+#endif
+#if defined(HAS_I422TOYUY2ROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    I422ToYUY2Row = I422ToYUY2Row_Any_SSE2;
+    if (IS_ALIGNED(dst_width, 16)) {
+      I422ToYUY2Row = I422ToYUY2Row_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_I422TOYUY2ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    I422ToYUY2Row = I422ToYUY2Row_Any_AVX2;
+    if (IS_ALIGNED(dst_width, 32)) {
+      I422ToYUY2Row = I422ToYUY2Row_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_I422TOYUY2ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    I422ToYUY2Row = I422ToYUY2Row_Any_NEON;
+    if (IS_ALIGNED(dst_width, 16)) {
+      I422ToYUY2Row = I422ToYUY2Row_NEON;
+    }
+  }
+#endif
+  ScalePacked422(src_width, src_height, dst_width, dst_height, src_stride_yuy2,
+                 dst_stride_yuy2, src_yuy2, dst_yuy2, filtering, YUY2ToYRow,
+                 YUY2ToUV422Row, I422ToYUY2Row);
+  return 0;
+}
+
+// Scale a UYVY image.
+LIBYUV_API
+int UYVYScale(const uint8_t* src_uyvy,
+              int src_stride_uyvy,
+              int src_width,
+              int src_height,
+              uint8_t* dst_uyvy,
+              int dst_stride_uyvy,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering) {
+  void (*UYVYToUV422Row)(const uint8_t* src_uyvy, uint8_t* dst_u,
+                         uint8_t* dst_v, int width) = UYVYToUV422Row_C;
+  void (*UYVYToYRow)(const uint8_t* src_uyvy, uint8_t* dst_y, int width) =
+      UYVYToYRow_C;
+  void (*I422ToUYVYRow)(const uint8_t* src_y, const uint8_t* src_u,
+                        const uint8_t* src_v, uint8_t* dst_uyvy, int width) =
+      I422ToUYVYRow_C;
+  if (!src_uyvy || src_width <= 0 || src_height == 0 || src_width > 32768 ||
+      src_height > 32768 || !dst_uyvy || dst_width <= 0 || dst_height <= 0) {
+    return -1;
+  }
+  filtering = ScaleFilterReduce(src_width, src_height, dst_width, dst_height,
+                                filtering);
+  // Negative height means invert the image.
+  if (src_height < 0) {
+    src_height = -src_height;
+    src_uyvy = src_uyvy + (src_height - 1) * (int64_t)src_stride_uyvy;
+    src_stride_uyvy = -src_stride_uyvy;
+  }
+  if (dst_width == src_width && dst_height == src_height) {
+    CopyPlane(src_uyvy, src_stride_uyvy, dst_uyvy, dst_stride_uyvy,
+              src_width * 2, src_height);
+    return 0;
+  }
+#if defined(HAS_UYVYTOYROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    UYVYToUV422Row = UYVYToUV422Row_Any_SSE2;
+    UYVYToYRow = UYVYToYRow_Any_SSE2;
+    if (IS_ALIGNED(src_width, 16)) {
+      UYVYToUV422Row = UYVYToUV422Row_SSE2;
+      UYVYToYRow = UYVYToYRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_UYVYTOYROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    UYVYToUV422Row = UYVYToUV422Row_Any_AVX2;
+    UYVYToYRow = UYVYToYRow_Any_AVX2;
+    if (IS_ALIGNED(src_width, 32)) {
+      UYVYToUV422Row = UYVYToUV422Row_AVX2;
+      UYVYToYRow = UYVYToYRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_UYVYTOYROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    UYVYToYRow = UYVYToYRow_Any_NEON;
+    UYVYToUV422Row = UYVYToUV422Row_Any_NEON;
+    if (IS_ALIGNED(src_width, 16)) {
+      UYVYToYRow = UYVYToYRow_NEON;
+      UYVYToUV422Row = UYVYToUV422Row_NEON;
+    }
+  }
+#endif
+#if defined(HAS_I422TOUYVYROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    I422ToUYVYRow = I422ToUYVYRow_Any_SSE2;
+    if (IS_ALIGNED(dst_width, 16)) {
+      I422ToUYVYRow = I422ToUYVYRow_SSE2;
+    }
+  }
+#endif
+#if defined(HAS_I422TOUYVYROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    I422ToUYVYRow = I422ToUYVYRow_Any_AVX2;
+    if (IS_ALIGNED(dst_width, 32)) {
+      I422ToUYVYRow = I422ToUYVYRow_AVX2;
+    }
+  }
+#endif
+#if defined(HAS_I422TOUYVYROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    I422ToUYVYRow = I422ToUYVYRow_Any_NEON;
+    if (IS_ALIGNED(dst_width, 16)) {
+      I422ToUYVYRow = I422ToUYVYRow_NEON;
+    }
+  }
+#endif
+  ScalePacked422(src_width, src_height, dst_width, dst_height, src_stride_uyvy,
+                 dst_stride_uyvy, src_uyvy, dst_uyvy, filtering, UYVYToYRow,
+                 UYVYToUV422Row, I422ToUYVYRow);
+  return 0;
+}
+
 // Deprecated api
 LIBYUV_API
 int Scale(const uint8_t* src_y,
@@ -608,6 +608,21 @@ SAANY(ScaleAddRow_Any_LSX, ScaleAddRow_LSX, ScaleAddRow_C, 15)
 
 #endif  // SASIMDONLY
 
+// Add 16 bit rows box filter scale down.
+#define SAANY16(NAMEANY, SCALEADDROW_SIMD, SCALEADDROW_C, MASK)              \
+  void NAMEANY(const uint16_t* src_ptr, uint32_t* dst_ptr, int src_width) { \
+    int n = src_width & ~MASK;                                               \
+    if (n > 0) {                                                             \
+      SCALEADDROW_SIMD(src_ptr, dst_ptr, n);                                 \
+    }                                                                        \
+    SCALEADDROW_C(src_ptr + n, dst_ptr + n, src_width & MASK);               \
+  }
+
+#ifdef HAS_SCALEADDROW_16_AVX2
+SAANY16(ScaleAddRow_16_Any_AVX2, ScaleAddRow_16_AVX2, ScaleAddRow_16_C, 15)
+#endif
+#undef SAANY16
+
 // Definition for ScaleFilterCols, ScaleARGBCols and ScaleARGBFilterCols
 #define CANY(NAMEANY, TERP_SIMD, TERP_C, BPP, MASK)                            \
   void NAMEANY(uint8_t* dst_ptr, const uint8_t* src_ptr, int dst_width, int x, \
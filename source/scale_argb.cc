@@ -18,6 +18,7 @@
 #include "libyuv/row.h"
 #include "libyuv/scale_argb.h"
 #include "libyuv/scale_row.h"
+#include "libyuv/video_common.h"  // For FOURCC_I420
 
 #ifdef __cplusplus
 namespace libyuv {
@@ -1089,6 +1090,95 @@ static void ScaleARGB(const uint8_t* src,
                   dst_stride, src, dst, x, dx, y, dy);
 }
 
+// Number of source rows attenuated per strip, not counting the margin.
+#define kPremultiplyStripRows 64
+// Rows above and below a strip that a scaler may read.  Box reads up to 4.
+#define kPremultiplyStripMargin 4
+
+// Scale an unattenuated ARGB image with filtering done on premultiplied
+// pixels.  The destination is processed in strips of rows.  For each strip
+// the source rows it reads are attenuated into a cache sized buffer, scaled
+// with ScaleARGB as a clip of the full destination, so the subpixel
+// positions match a whole image scale, then the strip is unattenuated in
+// place while it is still in cache.
+static void ScaleARGBPremultiplied(const uint8_t* src,
+                                   int src_stride,
+                                   int src_width,
+                                   int src_height,
+                                   uint8_t* dst,
+                                   int dst_stride,
+                                   int dst_width,
+                                   int dst_height,
+                                   int clip_x,
+                                   int clip_y,
+                                   int clip_width,
+                                   int clip_height,
+                                   enum FilterMode filtering) {
+  int x = 0;
+  int y = 0;
+  int dx = 0;
+  int dy = 0;
+  int j;
+  int strip_height;
+  int row_size;
+  filtering = ScaleFilterReduce(src_width, src_height, dst_width, dst_height,
+                                filtering);
+  // Point sampling does not mix pixels so alpha does not need to be applied.
+  if (filtering == kFilterNone) {
+    ScaleARGB(src, src_stride, src_width, src_height, dst, dst_stride,
+              dst_width, dst_height, clip_x, clip_y, clip_width, clip_height,
+              filtering);
+    return;
+  }
+  // Negative src_height means invert the image.
+  if (src_height < 0) {
+    src_height = -src_height;
+    src = src + (src_height - 1) * (intptr_t)src_stride;
+    src_stride = -src_stride;
+  }
+  ScaleSlope(src_width, src_height, dst_width, dst_height, filtering, &x, &y,
+             &dx, &dy);
+  row_size = Abs(src_width) * 4;
+  strip_height = (int)(((int64_t)kPremultiplyStripRows << 16) / (dy | 1));
+  if (strip_height < 1) {
+    strip_height = 1;
+  }
+  {
+    align_buffer_64(
+        strip,
+        row_size * (kPremultiplyStripRows + kPremultiplyStripMargin * 2 + 2));
+    for (j = clip_y; j < clip_y + clip_height; j += strip_height) {
+      int n = clip_y + clip_height - j;
+      int s0;
+      int s1;
+      if (n > strip_height) {
+        n = strip_height;
+      }
+      s0 = (int)((y + (int64_t)j * dy) >> 16) - kPremultiplyStripMargin;
+      s1 = (int)((y + (int64_t)(j + n - 1) * dy) >> 16) +
+           kPremultiplyStripMargin + 1;
+      if (s0 < 0) {
+        s0 = 0;
+      }
+      if (s1 > src_height) {
+        s1 = src_height;
+      }
+      ARGBAttenuate(src + s0 * (intptr_t)src_stride, src_stride, strip,
+                    row_size, Abs(src_width), s1 - s0);
+      // Offset the strip so that row s0 of the source maps to its first row.
+      ScaleARGB(strip - s0 * (intptr_t)row_size, row_size, src_width,
+                src_height, dst, dst_stride, dst_width, dst_height, clip_x, j,
+                clip_width, n, filtering);
+      ARGBUnattenuate(dst + j * (intptr_t)dst_stride + clip_x * 4, dst_stride,
+                      dst + j * (intptr_t)dst_stride + clip_x * 4, dst_stride,
+                      clip_width, n);
+    }
+    free_aligned_buffer_64(strip);
+  }
+}
+#undef kPremultiplyStripRows
+#undef kPremultiplyStripMargin
+
 LIBYUV_API
 int ARGBScaleClip(const uint8_t* src_argb,
                   int src_stride_argb,
@@ -1137,6 +1227,175 @@ int ARGBScale(const uint8_t* src_argb,
   return 0;
 }
 
+// Scale an unattenuated ARGB image, filtering premultiplied pixels.
+LIBYUV_API
+int ARGBScalePremultiplied(const uint8_t* src_argb,
+                           int src_stride_argb,
+                           int src_width,
+                           int src_height,
+                           uint8_t* dst_argb,
+                           int dst_stride_argb,
+                           int dst_width,
+                           int dst_height,
+                           enum FilterMode filtering) {
+  if (!src_argb || src_width == 0 || src_height == 0 || src_width > 32768 ||
+      src_height > 32768 || !dst_argb || dst_width <= 0 || dst_height <= 0) {
+    return -1;
+  }
+  ScaleARGBPremultiplied(src_argb, src_stride_argb, src_width, src_height,
+                         dst_argb, dst_stride_argb, dst_width, dst_height, 0,
+                         0, dst_width, dst_height, filtering);
+  return 0;
+}
+
+LIBYUV_API
+int ARGBScaleClipPremultiplied(const uint8_t* src_argb,
+                               int src_stride_argb,
+                               int src_width,
+                               int src_height,
+                               uint8_t* dst_argb,
+                               int dst_stride_argb,
+                               int dst_width,
+                               int dst_height,
+                               int clip_x,
+                               int clip_y,
+                               int clip_width,
+                               int clip_height,
+                               enum FilterMode filtering) {
+  if (!src_argb || src_width == 0 || src_height == 0 || !dst_argb ||
+      dst_width <= 0 || dst_height <= 0 || clip_x < 0 || clip_y < 0 ||
+      clip_width > 32768 || clip_height > 32768 ||
+      (clip_x + clip_width) > dst_width ||
+      (clip_y + clip_height) > dst_height) {
+    return -1;
+  }
+  ScaleARGBPremultiplied(src_argb, src_stride_argb, src_width, src_height,
+                         dst_argb, dst_stride_argb, dst_width, dst_height,
+                         clip_x, clip_y, clip_width, clip_height, filtering);
+  return 0;
+}
+
+// Scale an sRGB encoded ARGB image in linear light.
+LIBYUV_API
+int ARGBScaleLinearLight(const uint8_t* src_argb,
+                         int src_stride_argb,
+                         int src_width,
+                         int src_height,
+                         uint8_t* dst_argb,
+                         int dst_stride_argb,
+                         int dst_width,
+                         int dst_height,
+                         enum FilterMode filtering) {
+  if (!src_argb || src_width == 0 || src_height == 0 || src_width > 32768 ||
+      src_height > 32768 || !dst_argb || dst_width <= 0 || dst_height <= 0) {
+    return -1;
+  }
+  filtering = ScaleFilterReduce(src_width, src_height, dst_width, dst_height,
+                                filtering);
+  if (src_height < 0) {
+    src_height = -src_height;
+    src_argb = src_argb + (src_height - 1) * (intptr_t)src_stride_argb;
+    src_stride_argb = -src_stride_argb;
+  }
+  // Point sampling and copies do not mix pixels.
+  if (filtering == kFilterNone ||
+      (dst_width == src_width && dst_height == src_height)) {
+    return ARGBScale(src_argb, src_stride_argb, src_width, src_height,
+                     dst_argb, dst_stride_argb, dst_width, dst_height,
+                     filtering);
+  }
+  ScaleLinearLight(src_width, src_height, dst_width, dst_height,
+                   src_stride_argb, dst_stride_argb, src_argb, dst_argb,
+                   /*bpp=*/4, filtering);
+  return 0;
+}
+
+// Scale AR64 with 16 bits per channel.
+LIBYUV_API
+int AR64Scale(const uint16_t* src_ar64,
+              int src_stride_ar64,
+              int src_width,
+              int src_height,
+              uint16_t* dst_ar64,
+              int dst_stride_ar64,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering) {
+  if (!src_ar64 || src_width == 0 || src_height == 0 || src_width > 32768 ||
+      src_height > 32768 || !dst_ar64 || dst_width <= 0 || dst_height <= 0) {
+    return -1;
+  }
+  filtering = ScaleFilterReduce(src_width, src_height, dst_width, dst_height,
+                                filtering);
+  if (src_height < 0) {
+    src_height = -src_height;
+    src_ar64 = src_ar64 + (src_height - 1) * (intptr_t)src_stride_ar64;
+    src_stride_ar64 = -src_stride_ar64;
+  }
+  if (dst_width == src_width && dst_height == src_height) {
+    CopyPlane_16(src_ar64, src_stride_ar64, dst_ar64, dst_stride_ar64,
+                 src_width * 4, src_height);
+    return 0;
+  }
+  if (filtering == kFilterNone) {
+    int x = 0;
+    int y = 0;
+    int dx = 0;
+    int dy = 0;
+    int j;
+    ScaleSlope(src_width, src_height, dst_width, dst_height, filtering, &x,
+               &y, &dx, &dy);
+    for (j = 0; j < dst_height; ++j) {
+      ScaleAR64Cols_C(dst_ar64,
+                      src_ar64 + (y >> 16) * (intptr_t)src_stride_ar64,
+                      dst_width, x, dx);
+      dst_ar64 += dst_stride_ar64;
+      y += dy;
+    }
+    return 0;
+  }
+  ScaleConvert_16(src_width, src_height, dst_width, dst_height,
+                  src_stride_ar64 * 2, dst_stride_ar64 * 2,
+                  (const uint8_t*)src_ar64, (uint8_t*)dst_ar64, 4, filtering,
+                  NULL, NULL);
+  return 0;
+}
+
+// Scale AR30 by filtering each row unpacked to AR64.
+LIBYUV_API
+int AR30Scale(const uint8_t* src_ar30,
+              int src_stride_ar30,
+              int src_width,
+              int src_height,
+              uint8_t* dst_ar30,
+              int dst_stride_ar30,
+              int dst_width,
+              int dst_height,
+              enum FilterMode filtering) {
+  if (!src_ar30 || src_width == 0 || src_height == 0 || src_width > 32768 ||
+      src_height > 32768 || !dst_ar30 || dst_width <= 0 || dst_height <= 0) {
+    return -1;
+  }
+  filtering = ScaleFilterReduce(src_width, src_height, dst_width, dst_height,
+                                filtering);
+  // Point sampling and copies move whole 32 bit pixels like ARGB.
+  if (filtering == kFilterNone ||
+      (dst_width == src_width && dst_height == src_height)) {
+    return ARGBScale(src_ar30, src_stride_ar30, src_width, src_height,
+                     dst_ar30, dst_stride_ar30, dst_width, dst_height,
+                     filtering);
+  }
+  if (src_height < 0) {
+    src_height = -src_height;
+    src_ar30 = src_ar30 + (src_height - 1) * (intptr_t)src_stride_ar30;
+    src_stride_ar30 = -src_stride_ar30;
+  }
+  ScaleConvert_16(src_width, src_height, dst_width, dst_height,
+                  src_stride_ar30, dst_stride_ar30, src_ar30, dst_ar30, 4,
+                  filtering, AR30ToAR64Row_C, AR64ToAR30Row_C);
+  return 0;
+}
+
 // Scale with YUV conversion to ARGB and clipping.
 LIBYUV_API
 int YUVToARGBScaleClip(const uint8_t* src_y,
@@ -1172,6 +1431,834 @@ int YUVToARGBScaleClip(const uint8_t* src_y,
   return r;
 }
 
+// Row functions shared by every crop of a batch.  Any versions are used so
+// one dispatch serves all crop and destination widths.
+struct CropScaleRowFuncs {
+  void (*I422ToARGBRow)(const uint8_t* y_buf,
+                        const uint8_t* u_buf,
+                        const uint8_t* v_buf,
+                        uint8_t* rgb_buf,
+                        const struct YuvConstants* yuvconstants,
+                        int width);
+  void (*NV12ToARGBRow)(const uint8_t* y_buf,
+                        const uint8_t* uv_buf,
+                        uint8_t* rgb_buf,
+                        const struct YuvConstants* yuvconstants,
+                        int width);
+  void (*SplitUVRow)(const uint8_t* src_uv,
+                     uint8_t* dst_u,
+                     uint8_t* dst_v,
+                     int width);
+  void (*ScaleARGBFilterCols)(uint8_t* dst_argb,
+                              const uint8_t* src_argb,
+                              int dst_width,
+                              int x,
+                              int dx);
+  void (*ScaleARGBCols)(uint8_t* dst_argb,
+                        const uint8_t* src_argb,
+                        int dst_width,
+                        int x,
+                        int dx);
+  void (*ScaleFilterCols)(uint8_t* dst_ptr,
+                          const uint8_t* src_ptr,
+                          int dst_width,
+                          int x,
+                          int dx);
+  void (*InterpolateRow)(uint8_t* dst_ptr,
+                         const uint8_t* src_ptr,
+                         ptrdiff_t src_stride,
+                         int width,
+                         int source_y_fraction);
+  void (*ARGBToRAWRow)(const uint8_t* src_argb, uint8_t* dst_rgb, int width);
+  void (*ARGBToRGBPlanarFloatRow)(const uint8_t* src_argb,
+                                  float* dst_r,
+                                  float* dst_g,
+                                  float* dst_b,
+                                  const float* scale_bias,
+                                  int width);
+  void (*RAWToFloatRow)(const uint8_t* src_raw,
+                        float* dst,
+                        const float* scale_bias,
+                        int width);
+  void (*ConvertFP32ToFP16Row)(const float* src, uint16_t* dst, int width);
+  void (*ConvertFP32ToInt8Row)(const float* src, int8_t* dst, int width);
+};
+
+static void InitCropScaleRowFuncs(struct CropScaleRowFuncs* f) {
+  f->I422ToARGBRow = I422ToARGBRow_C;
+  f->NV12ToARGBRow = NV12ToARGBRow_C;
+  f->SplitUVRow = SplitUVRow_C;
+  f->ScaleARGBFilterCols = ScaleARGBFilterCols_C;
+  f->ScaleARGBCols = ScaleARGBCols_C;
+  f->ScaleFilterCols = ScaleFilterCols_C;
+  f->InterpolateRow = InterpolateRow_C;
+  f->ARGBToRAWRow = ARGBToRAWRow_C;
+  f->ARGBToRGBPlanarFloatRow = ARGBToRGBPlanarFloatRow_C;
+  f->RAWToFloatRow = RAWToFloatRow_C;
+  f->ConvertFP32ToFP16Row = ConvertFP32ToFP16Row_C;
+  f->ConvertFP32ToInt8Row = ConvertFP32ToInt8Row_C;
+#if defined(HAS_I422TOARGBROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    f->I422ToARGBRow = I422ToARGBRow_Any_SSSE3;
+  }
+#endif
+#if defined(HAS_NV12TOARGBROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    f->NV12ToARGBRow = NV12ToARGBRow_Any_SSSE3;
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->I422ToARGBRow = I422ToARGBRow_Any_AVX2;
+  }
+#endif
+#if defined(HAS_NV12TOARGBROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->NV12ToARGBRow = NV12ToARGBRow_Any_AVX2;
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_AVX512BW)
+  if (TestCpuFlag(kCpuHasAVX512BW | kCpuHasAVX512VL) ==
+      (kCpuHasAVX512BW | kCpuHasAVX512VL)) {
+    f->I422ToARGBRow = I422ToARGBRow_Any_AVX512BW;
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->I422ToARGBRow = I422ToARGBRow_Any_NEON;
+  }
+#endif
+#if defined(HAS_NV12TOARGBROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->NV12ToARGBRow = NV12ToARGBRow_Any_NEON;
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->I422ToARGBRow = I422ToARGBRow_Any_MSA;
+  }
+#endif
+#if defined(HAS_NV12TOARGBROW_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->NV12ToARGBRow = NV12ToARGBRow_Any_MSA;
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->I422ToARGBRow = I422ToARGBRow_Any_LSX;
+  }
+#endif
+#if defined(HAS_NV12TOARGBROW_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->NV12ToARGBRow = NV12ToARGBRow_Any_LSX;
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_LASX)
+  if (TestCpuFlag(kCpuHasLASX)) {
+    f->I422ToARGBRow = I422ToARGBRow_Any_LASX;
+  }
+#endif
+#if defined(HAS_NV12TOARGBROW_LASX)
+  if (TestCpuFlag(kCpuHasLASX)) {
+    f->NV12ToARGBRow = NV12ToARGBRow_Any_LASX;
+  }
+#endif
+#if defined(HAS_I422TOARGBROW_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    f->I422ToARGBRow = I422ToARGBRow_RVV;
+  }
+#endif
+#if defined(HAS_NV12TOARGBROW_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    f->NV12ToARGBRow = NV12ToARGBRow_RVV;
+  }
+#endif
+
+#if defined(HAS_SPLITUVROW_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    f->SplitUVRow = SplitUVRow_Any_SSE2;
+  }
+#endif
+#if defined(HAS_SPLITUVROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->SplitUVRow = SplitUVRow_Any_AVX2;
+  }
+#endif
+#if defined(HAS_SPLITUVROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->SplitUVRow = SplitUVRow_Any_NEON;
+  }
+#endif
+#if defined(HAS_SPLITUVROW_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->SplitUVRow = SplitUVRow_Any_MSA;
+  }
+#endif
+#if defined(HAS_SPLITUVROW_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->SplitUVRow = SplitUVRow_Any_LSX;
+  }
+#endif
+#if defined(HAS_SPLITUVROW_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    f->SplitUVRow = SplitUVRow_RVV;
+  }
+#endif
+
+#if defined(HAS_SCALEARGBFILTERCOLS_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    f->ScaleARGBFilterCols = ScaleARGBFilterCols_SSSE3;
+  }
+#endif
+#if defined(HAS_SCALEARGBFILTERCOLS_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->ScaleARGBFilterCols = ScaleARGBFilterCols_Any_NEON;
+  }
+#endif
+#if defined(HAS_SCALEARGBFILTERCOLS_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->ScaleARGBFilterCols = ScaleARGBFilterCols_Any_MSA;
+  }
+#endif
+#if defined(HAS_SCALEARGBFILTERCOLS_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->ScaleARGBFilterCols = ScaleARGBFilterCols_Any_LSX;
+  }
+#endif
+#if defined(HAS_SCALEARGBCOLS_SSE2)
+  if (TestCpuFlag(kCpuHasSSE2)) {
+    f->ScaleARGBCols = ScaleARGBCols_SSE2;
+  }
+#endif
+#if defined(HAS_SCALEARGBCOLS_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->ScaleARGBCols = ScaleARGBCols_Any_NEON;
+  }
+#endif
+#if defined(HAS_SCALEARGBCOLS_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->ScaleARGBCols = ScaleARGBCols_Any_MSA;
+  }
+#endif
+#if defined(HAS_SCALEARGBCOLS_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->ScaleARGBCols = ScaleARGBCols_Any_LSX;
+  }
+#endif
+#if defined(HAS_SCALEFILTERCOLS_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    f->ScaleFilterCols = ScaleFilterCols_SSSE3;
+  }
+#endif
+#if defined(HAS_SCALEFILTERCOLS_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->ScaleFilterCols = ScaleFilterCols_Any_NEON;
+  }
+#endif
+#if defined(HAS_SCALEFILTERCOLS_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->ScaleFilterCols = ScaleFilterCols_Any_MSA;
+  }
+#endif
+#if defined(HAS_SCALEFILTERCOLS_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->ScaleFilterCols = ScaleFilterCols_Any_LSX;
+  }
+#endif
+
+#if defined(HAS_INTERPOLATEROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    f->InterpolateRow = InterpolateRow_Any_SSSE3;
+  }
+#endif
+#if defined(HAS_INTERPOLATEROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->InterpolateRow = InterpolateRow_Any_AVX2;
+  }
+#endif
+#if defined(HAS_INTERPOLATEROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->InterpolateRow = InterpolateRow_Any_NEON;
+  }
+#endif
+#if defined(HAS_INTERPOLATEROW_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->InterpolateRow = InterpolateRow_Any_MSA;
+  }
+#endif
+#if defined(HAS_INTERPOLATEROW_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->InterpolateRow = InterpolateRow_Any_LSX;
+  }
+#endif
+#if defined(HAS_INTERPOLATEROW_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    f->InterpolateRow = InterpolateRow_RVV;
+  }
+#endif
+
+#if defined(HAS_ARGBTORAWROW_SSSE3)
+  if (TestCpuFlag(kCpuHasSSSE3)) {
+    f->ARGBToRAWRow = ARGBToRAWRow_Any_SSSE3;
+  }
+#endif
+#if defined(HAS_ARGBTORAWROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->ARGBToRAWRow = ARGBToRAWRow_Any_AVX2;
+  }
+#endif
+#if defined(HAS_ARGBTORAWROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->ARGBToRAWRow = ARGBToRAWRow_Any_NEON;
+  }
+#endif
+#if defined(HAS_ARGBTORAWROW_MSA)
+  if (TestCpuFlag(kCpuHasMSA)) {
+    f->ARGBToRAWRow = ARGBToRAWRow_Any_MSA;
+  }
+#endif
+#if defined(HAS_ARGBTORAWROW_LSX)
+  if (TestCpuFlag(kCpuHasLSX)) {
+    f->ARGBToRAWRow = ARGBToRAWRow_Any_LSX;
+  }
+#endif
+#if defined(HAS_ARGBTORAWROW_LASX)
+  if (TestCpuFlag(kCpuHasLASX)) {
+    f->ARGBToRAWRow = ARGBToRAWRow_Any_LASX;
+  }
+#endif
+#if defined(HAS_ARGBTORAWROW_RVV)
+  if (TestCpuFlag(kCpuHasRVV)) {
+    f->ARGBToRAWRow = ARGBToRAWRow_RVV;
+  }
+#endif
+
+#if defined(HAS_ARGBTORGBPLANARFLOATROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->ARGBToRGBPlanarFloatRow = ARGBToRGBPlanarFloatRow_Any_AVX2;
+  }
+#endif
+#if defined(HAS_ARGBTORGBPLANARFLOATROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->ARGBToRGBPlanarFloatRow = ARGBToRGBPlanarFloatRow_Any_NEON;
+  }
+#endif
+#if defined(HAS_RAWTOFLOATROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->RAWToFloatRow = RAWToFloatRow_Any_AVX2;
+  }
+#endif
+#if defined(HAS_RAWTOFLOATROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->RAWToFloatRow = RAWToFloatRow_Any_NEON;
+  }
+#endif
+#if defined(HAS_CONVERTFP32TOFP16ROW_F16C)
+  if (TestCpuFlag(kCpuHasAVX2) && TestCpuFlag(kCpuHasF16C)) {
+    f->ConvertFP32ToFP16Row = ConvertFP32ToFP16Row_Any_F16C;
+  }
+#endif
+#if defined(HAS_CONVERTFP32TOFP16ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->ConvertFP32ToFP16Row = ConvertFP32ToFP16Row_Any_NEON;
+  }
+#endif
+#if defined(HAS_CONVERTFP32TOINT8ROW_AVX2)
+  if (TestCpuFlag(kCpuHasAVX2)) {
+    f->ConvertFP32ToInt8Row = ConvertFP32ToInt8Row_Any_AVX2;
+  }
+#endif
+#if defined(HAS_CONVERTFP32TOINT8ROW_NEON)
+  if (TestCpuFlag(kCpuHasNEON)) {
+    f->ConvertFP32ToInt8Row = ConvertFP32ToInt8Row_Any_NEON;
+  }
+#endif
+}
+
+// Everything a batch of crops shares: the source frame, row functions,
+// output format and scratch memory.
+struct CropScaleBatch {
+  struct CropScaleRowFuncs funcs;
+  const uint8_t* src_y;
+  const uint8_t* src_u;
+  const uint8_t* src_v;  // NULL for NV12, with src_u interleaved UV.
+  int src_stride_y;
+  int src_stride_u;
+  int src_stride_v;
+  const struct YuvConstants* yuvconstants;
+  const struct CropScaleRegion* regions;
+  uint32_t dst_fourcc;  // FOURCC_ARGB, FOURCC_I420 or 0 for a tensor.
+  enum TensorLayout layout;
+  enum TensorType type;
+  enum FilterMode filtering;
+  SIMD_ALIGNED(float scale_bias[48]);
+  uint8_t* scratch;
+  int scratch_size;  // Bytes of scratch for each region run in parallel.
+  int parallel;
+};
+
+// Scratch for one region: 3 rows at dst_width, 1 source row, 1 row of RAW
+// and 1 row of RGB floats.  Planes for I420 fit in the same space.
+static int CropScaleScratchSize(const struct CropScaleRegion* region) {
+  const int row_size = (region->dst_width * 4 + 31) & ~31;
+  const int src_row_size = ((region->crop_width + 2) * 4 + 31) & ~31;
+  const int raw_row_size = (region->dst_width * 3 + 31) & ~31;
+  return row_size * 3 + src_row_size * 2 + raw_row_size +
+         region->dst_width * 3 * 4;
+}
+
+// Produce row y of plane -1 (ARGB converted from YUV), 0 (Y), 1 (U) or 2 (V)
+// from column x, with the last pixel repeated once for the column filter.
+static void CropScaleSourceRow(const struct CropScaleBatch* batch,
+                               int plane,
+                               int x,
+                               int y,
+                               int width,
+                               uint8_t* dst,
+                               uint8_t* tmp) {
+  const struct CropScaleRowFuncs* f = &batch->funcs;
+  const uint8_t* src_y = batch->src_y + y * (intptr_t)batch->src_stride_y;
+  const uint8_t* src_u = batch->src_u + y * (intptr_t)batch->src_stride_u;
+  switch (plane) {
+    case -1:
+      src_u = batch->src_u + (y >> 1) * (intptr_t)batch->src_stride_u;
+      if (batch->src_v) {
+        f->I422ToARGBRow(
+            src_y + x, src_u + x / 2,
+            batch->src_v + (y >> 1) * (intptr_t)batch->src_stride_v + x / 2,
+            dst, batch->yuvconstants, width);
+      } else {
+        f->NV12ToARGBRow(src_y + x, src_u + x, dst, batch->yuvconstants,
+                         width);
+      }
+      memcpy(dst + width * 4, dst + width * 4 - 4, 4);
+      return;
+    case 0:
+      memcpy(dst, src_y + x, width);
+      break;
+    default:
+      if (batch->src_v) {
+        memcpy(dst,
+               (plane == 1 ? src_u
+                           : batch->src_v + y * (intptr_t)batch->src_stride_v) +
+                   x,
+               width);
+      } else {
+        f->SplitUVRow(src_u + x * 2, plane == 1 ? dst : tmp,
+                      plane == 1 ? tmp : dst, width);
+      }
+      break;
+  }
+  dst[width] = dst[width - 1];
+}
+
+// Scale a crop of a plane, or of ARGB converted from YUV, a row at a time.
+// Each source row is filtered horizontally to dst_width, two are blended
+// vertically and the result is stored to dst, or normalized into the
+// tensor when dst_fourcc is 0.
+static void CropScalePlane(const struct CropScaleBatch* batch,
+                           int plane,
+                           int crop_x,
+                           int crop_y,
+                           int crop_width,
+                           int crop_height,
+                           uint8_t* dst,
+                           int dst_stride,
+                           int dst_width,
+                           int dst_height,
+                           uint8_t* scratch) {
+  const struct CropScaleRowFuncs* f = &batch->funcs;
+  const enum FilterMode filtering = batch->filtering;
+  const int bpp = plane < 0 ? 4 : 1;
+  // Odd crop_x converts from the pixel before so chroma stays paired.
+  const int x_offset = plane < 0 ? crop_x & 1 : 0;
+  const int convert_width = crop_width + x_offset;
+  const int row_size = (dst_width * 4 + 31) & ~31;
+  const int src_row_size = ((crop_width + 2) * 4 + 31) & ~31;
+  const int raw_row_size = (dst_width * 3 + 31) & ~31;
+  const intptr_t plane_size = (intptr_t)dst_width * dst_height;
+  uint8_t* rowptr0 = scratch;
+  uint8_t* rowptr1 = scratch + row_size;
+  uint8_t* blend_row = scratch + row_size * 2;
+  uint8_t* src_row = blend_row + row_size;
+  uint8_t* tmp_row = src_row + src_row_size;
+  uint8_t* raw_row = tmp_row + src_row_size;
+  float* float_row = (float*)(raw_row + raw_row_size);
+  void (*ScaleCols)(uint8_t* dst_ptr, const uint8_t* src_ptr, int dst_width,
+                    int x, int dx);
+  int x = 0;
+  int y = 0;
+  int dx = 0;
+  int dy = 0;
+  int lasty = -2;
+  int max_y;
+  int j;
+
+  ScaleSlope(crop_width, crop_height, dst_width, dst_height, filtering, &x, &y,
+             &dx, &dy);
+  x += x_offset << 16;
+  max_y = (crop_height - 1) << 16;
+  // Columns that all land on whole pixels are copied, as the column filter
+  // does not reproduce pixels exactly.
+  if (filtering && ((x | dx) & 0xffff)) {
+    ScaleCols = bpp == 4 ? f->ScaleARGBFilterCols : f->ScaleFilterCols;
+    if (crop_width >= 32768) {
+      ScaleCols = bpp == 4 ? ScaleARGBFilterCols64_C : ScaleFilterCols64_C;
+    }
+  } else {
+    ScaleCols = bpp == 4 ? f->ScaleARGBCols : ScaleCols_C;
+    if (bpp == 4 && crop_width >= 32768) {
+      ScaleCols = ScaleARGBCols64_C;
+    }
+  }
+
+  for (j = 0; j < dst_height; ++j) {
+    const uint8_t* row = rowptr0;
+    int yi;
+    int k;
+    if (y > max_y) {
+      y = max_y;
+    }
+    yi = y >> 16;
+    if (yi != lasty) {
+      // Reuse the previous bottom row when stepping down by one row.
+      k = 0;
+      if (filtering && yi == lasty + 1) {
+        uint8_t* tmp = rowptr0;
+        rowptr0 = rowptr1;
+        rowptr1 = tmp;
+        k = 1;
+      }
+      for (; k < (filtering ? 2 : 1); ++k) {
+        int sy = yi + k < crop_height ? yi + k : crop_height - 1;
+        CropScaleSourceRow(batch, plane, crop_x - x_offset, crop_y + sy,
+                           convert_width, src_row, tmp_row);
+        ScaleCols(k ? rowptr1 : rowptr0, src_row, dst_width, x, dx);
+      }
+      lasty = yi;
+    }
+    if (filtering) {
+      row = batch->dst_fourcc ? dst : blend_row;
+      f->InterpolateRow((uint8_t*)row, rowptr0, rowptr1 - rowptr0,
+                        dst_width * bpp, (y >> 8) & 255);
+    } else if (batch->dst_fourcc) {
+      memcpy(dst, rowptr0, dst_width * bpp);
+    }
+    y += dy;
+    if (batch->dst_fourcc) {
+      dst += dst_stride;
+      continue;
+    }
+
+    if (batch->layout == kTensorCHW) {
+      // Float32 is written directly to the tensor planes.
+      float* dst_r = float_row;
+      intptr_t dst_plane = dst_width;
+      if (batch->type == kTensorFloat32) {
+        dst_r = (float*)dst + (intptr_t)j * dst_width;
+        dst_plane = plane_size;
+      }
+      f->ARGBToRGBPlanarFloatRow(row, dst_r, dst_r + dst_plane,
+                                 dst_r + dst_plane * 2, batch->scale_bias,
+                                 dst_width);
+    } else {
+      f->ARGBToRAWRow(row, raw_row, dst_width);
+      f->RAWToFloatRow(raw_row,
+                       batch->type == kTensorFloat32
+                           ? (float*)dst + (intptr_t)j * dst_width * 3
+                           : float_row,
+                       batch->scale_bias, dst_width);
+    }
+    // Store fp16 or int8 from floats, a plane or a row at a time.
+    if (batch->type != kTensorFloat32) {
+      const int n = (batch->layout == kTensorCHW) ? dst_width : dst_width * 3;
+      const intptr_t offset = (intptr_t)j * n;
+      for (k = 0; k < 3; k += (batch->layout == kTensorCHW) ? 1 : 3) {
+        if (batch->type == kTensorFloat16) {
+          f->ConvertFP32ToFP16Row(float_row + k * dst_width,
+                                  (uint16_t*)dst + offset + k * plane_size, n);
+        } else {
+          f->ConvertFP32ToInt8Row(float_row + k * dst_width,
+                                  (int8_t*)dst + offset + k * plane_size, n);
+        }
+      }
+    }
+  }
+}
+
+// Scale one region of a batch.  Regions run in parallel use their own slice
+// of scratch.
+static void CropScaleRegionTask(void* context, int index) {
+  const struct CropScaleBatch* batch = (const struct CropScaleBatch*)context;
+  const struct CropScaleRegion* r = &batch->regions[index];
+  uint8_t* scratch =
+      batch->scratch +
+      (batch->parallel ? (intptr_t)index * batch->scratch_size : 0);
+  if (batch->dst_fourcc == FOURCC_I420) {
+    // Chroma crops cover the luma crop, as I420Scale of a cropped I420 does.
+    const int crop_uv_x = r->crop_x >> 1;
+    const int crop_uv_y = r->crop_y >> 1;
+    const int crop_uv_width =
+        ((r->crop_x + r->crop_width + 1) >> 1) - crop_uv_x;
+    const int crop_uv_height =
+        ((r->crop_y + r->crop_height + 1) >> 1) - crop_uv_y;
+    const int dst_uv_width = (r->dst_width + 1) >> 1;
+    const int dst_uv_height = (r->dst_height + 1) >> 1;
+    CropScalePlane(batch, 0, r->crop_x, r->crop_y, r->crop_width,
+                   r->crop_height, r->dst[0], r->dst_stride[0], r->dst_width,
+                   r->dst_height, scratch);
+    CropScalePlane(batch, 1, crop_uv_x, crop_uv_y, crop_uv_width,
+                   crop_uv_height, r->dst[1], r->dst_stride[1], dst_uv_width,
+                   dst_uv_height, scratch);
+    CropScalePlane(batch, 2, crop_uv_x, crop_uv_y, crop_uv_width,
+                   crop_uv_height, r->dst[2], r->dst_stride[2], dst_uv_width,
+                   dst_uv_height, scratch);
+  } else {
+    CropScalePlane(batch, -1, r->crop_x, r->crop_y, r->crop_width,
+                   r->crop_height, r->dst[0], r->dst_stride[0], r->dst_width,
+                   r->dst_height, scratch);
+  }
+}
+
+// Validate a batch, allocate its scratch and scale every region.
+// src_v is NULL for NV12, with src_u pointing to interleaved UV.
+static int CropScaleRegions(struct CropScaleBatch* batch,
+                            int src_width,
+                            int src_height,
+                            const struct CropScaleRegion* regions,
+                            int num_regions,
+                            ParallelForFunc parallel_for,
+                            void* executor_context) {
+  int scratch_size = 0;
+  int i;
+  if (!batch->src_y || !batch->src_u || !batch->yuvconstants ||
+      src_width <= 0 || src_height == 0 || !regions || num_regions <= 0) {
+    return -1;
+  }
+  for (i = 0; i < num_regions; ++i) {
+    const struct CropScaleRegion* r = &regions[i];
+    if (r->crop_x < 0 || r->crop_y < 0 || r->crop_width <= 0 ||
+        r->crop_height <= 0 || r->crop_x + r->crop_width > src_width ||
+        r->crop_y + r->crop_height > Abs(src_height) || !r->dst[0] ||
+        r->dst_width <= 0 || r->dst_height <= 0 ||
+        (batch->dst_fourcc == FOURCC_I420 && (!r->dst[1] || !r->dst[2]))) {
+      return -1;
+    }
+    if (CropScaleScratchSize(r) > scratch_size) {
+      scratch_size = CropScaleScratchSize(r);
+    }
+  }
+  // Negative height means invert the image.
+  if (src_height < 0) {
+    const int src_height_uv = (-src_height + 1) / 2;
+    batch->src_y += (-src_height - 1) * (intptr_t)batch->src_stride_y;
+    batch->src_u += (src_height_uv - 1) * (intptr_t)batch->src_stride_u;
+    batch->src_stride_y = -batch->src_stride_y;
+    batch->src_stride_u = -batch->src_stride_u;
+    if (batch->src_v) {
+      batch->src_v += (src_height_uv - 1) * (intptr_t)batch->src_stride_v;
+      batch->src_stride_v = -batch->src_stride_v;
+    }
+  }
+  // Point sampling or bilinear.  Box filtering is not supported a row at a
+  // time, so other modes are bilinear.
+  if (batch->filtering != kFilterNone) {
+    batch->filtering = kFilterBilinear;
+  }
+  InitCropScaleRowFuncs(&batch->funcs);
+  batch->regions = regions;
+  batch->scratch_size = scratch_size;
+  batch->parallel = parallel_for && num_regions > 1;
+  {
+    align_buffer_64(scratch, (intptr_t)scratch_size *
+                                 (batch->parallel ? num_regions : 1));
+    batch->scratch = scratch;
+    if (batch->parallel) {
+      parallel_for(executor_context, CropScaleRegionTask, batch, num_regions);
+    } else {
+      for (i = 0; i < num_regions; ++i) {
+        CropScaleRegionTask(batch, i);
+      }
+    }
+    free_aligned_buffer_64(scratch);
+  }
+  return 0;
+}
+
+static int YUVCropScaleSource(struct CropScaleBatch* batch,
+                              const uint8_t* src_y,
+                              int src_stride_y,
+                              const uint8_t* src_u,
+                              int src_stride_u,
+                              const uint8_t* src_v,
+                              int src_stride_v,
+                              uint32_t src_fourcc,
+                              const struct YuvConstants* yuvconstants) {
+  memset(batch, 0, sizeof(*batch));
+  batch->src_y = src_y;
+  batch->src_stride_y = src_stride_y;
+  batch->src_u = src_u;
+  batch->src_stride_u = src_stride_u;
+  batch->yuvconstants = yuvconstants;
+  switch (CanonicalFourCC(src_fourcc)) {
+    case FOURCC_I420:
+      if (!src_v) {
+        return -1;
+      }
+      batch->src_v = src_v;
+      batch->src_stride_v = src_stride_v;
+      return 0;
+    case FOURCC_NV12:
+      return 0;
+    default:
+      return -1;
+  }
+}
+
+LIBYUV_API
+int YUVCropScaleBatch(const uint8_t* src_y,
+                      int src_stride_y,
+                      const uint8_t* src_u,
+                      int src_stride_u,
+                      const uint8_t* src_v,
+                      int src_stride_v,
+                      uint32_t src_fourcc,
+                      const struct YuvConstants* yuvconstants,
+                      int src_width,
+                      int src_height,
+                      const struct CropScaleRegion* regions,
+                      int num_regions,
+                      uint32_t dst_fourcc,
+                      enum FilterMode filtering,
+                      ParallelForFunc parallel_for,
+                      void* executor_context) {
+  struct CropScaleBatch batch;
+  if (YUVCropScaleSource(&batch, src_y, src_stride_y, src_u, src_stride_u,
+                         src_v, src_stride_v, src_fourcc, yuvconstants)) {
+    return -1;
+  }
+  dst_fourcc = CanonicalFourCC(dst_fourcc);
+  if (dst_fourcc != FOURCC_ARGB && dst_fourcc != FOURCC_I420) {
+    return -1;
+  }
+  batch.dst_fourcc = dst_fourcc;
+  batch.filtering = filtering;
+  return CropScaleRegions(&batch, src_width, src_height, regions, num_regions,
+                          parallel_for, executor_context);
+}
+
+LIBYUV_API
+int YUVCropScaleBatchToRGBTensor(const uint8_t* src_y,
+                                 int src_stride_y,
+                                 const uint8_t* src_u,
+                                 int src_stride_u,
+                                 const uint8_t* src_v,
+                                 int src_stride_v,
+                                 uint32_t src_fourcc,
+                                 const struct YuvConstants* yuvconstants,
+                                 int src_width,
+                                 int src_height,
+                                 const struct CropScaleRegion* regions,
+                                 int num_regions,
+                                 const float* scale,
+                                 const float* bias,
+                                 enum TensorLayout layout,
+                                 enum TensorType type,
+                                 enum FilterMode filtering,
+                                 ParallelForFunc parallel_for,
+                                 void* executor_context) {
+  struct CropScaleBatch batch;
+  int i;
+  if (YUVCropScaleSource(&batch, src_y, src_stride_y, src_u, src_stride_u,
+                         src_v, src_stride_v, src_fourcc, yuvconstants) ||
+      !scale || !bias || (layout != kTensorCHW && layout != kTensorHWC) ||
+      (type != kTensorFloat32 && type != kTensorFloat16 &&
+       type != kTensorInt8)) {
+    return -1;
+  }
+  batch.layout = layout;
+  batch.type = type;
+  batch.filtering = filtering;
+  for (i = 0; i < 24; ++i) {
+    batch.scale_bias[i] = scale[i % 3];
+    batch.scale_bias[24 + i] = bias[i % 3];
+  }
+  return CropScaleRegions(&batch, src_width, src_height, regions, num_regions,
+                          parallel_for, executor_context);
+}
+
+LIBYUV_API
+int I420ToRGBTensor(const uint8_t* src_y,
+                    int src_stride_y,
+                    const uint8_t* src_u,
+                    int src_stride_u,
+                    const uint8_t* src_v,
+                    int src_stride_v,
+                    const struct YuvConstants* yuvconstants,
+                    int src_width,
+                    int src_height,
+                    int crop_x,
+                    int crop_y,
+                    int crop_width,
+                    int crop_height,
+                    void* dst_tensor,
+                    int dst_width,
+                    int dst_height,
+                    const float* scale,
+                    const float* bias,
+                    enum TensorLayout layout,
+                    enum TensorType type,
+                    enum FilterMode filtering) {
+  struct CropScaleRegion region;
+  memset(&region, 0, sizeof(region));
+  region.crop_x = crop_x;
+  region.crop_y = crop_y;
+  region.crop_width = crop_width;
+  region.crop_height = crop_height;
+  region.dst[0] = (uint8_t*)dst_tensor;
+  region.dst_width = dst_width;
+  region.dst_height = dst_height;
+  return YUVCropScaleBatchToRGBTensor(
+      src_y, src_stride_y, src_u, src_stride_u, src_v, src_stride_v,
+      FOURCC_I420, yuvconstants, src_width, src_height, &region, 1, scale,
+      bias, layout, type, filtering, NULL, NULL);
+}
+
+LIBYUV_API
+int NV12ToRGBTensor(const uint8_t* src_y,
+                    int src_stride_y,
+                    const uint8_t* src_uv,
+                    int src_stride_uv,
+                    const struct YuvConstants* yuvconstants,
+                    int src_width,
+                    int src_height,
+                    int crop_x,
+                    int crop_y,
+                    int crop_width,
+                    int crop_height,
+                    void* dst_tensor,
+                    int dst_width,
+                    int dst_height,
+                    const float* scale,
+                    const float* bias,
+                    enum TensorLayout layout,
+                    enum TensorType type,
+                    enum FilterMode filtering) {
+  struct CropScaleRegion region;
+  memset(&region, 0, sizeof(region));
+  region.crop_x = crop_x;
+  region.crop_y = crop_y;
+  region.crop_width = crop_width;
+  region.crop_height = crop_height;
+  region.dst[0] = (uint8_t*)dst_tensor;
+  region.dst_width = dst_width;
+  region.dst_height = dst_height;
+  return YUVCropScaleBatchToRGBTensor(
+      src_y, src_stride_y, src_uv, src_stride_uv, NULL, 0, FOURCC_NV12,
+      yuvconstants, src_width, src_height, &region, 1, scale, bias, layout,
+      type, filtering, NULL, NULL);
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
@@ -853,6 +853,28 @@ void ScaleFilterCols64_16_C(uint16_t* dst_ptr,
     dst_ptr[0] = BLENDER(a, b, x & 0xffff);
   }
 }
+
+// Bilinear filter columns of 16 bit per channel ARGB.
+void ScaleAR64FilterCols_C(uint16_t* dst_ar64,
+                           const uint16_t* src_ar64,
+                           int dst_width,
+                           int x32,
+                           int dx) {
+  int64_t x = (int64_t)(x32);
+  int j;
+  for (j = 0; j < dst_width; ++j) {
+    int64_t xi = x >> 16;
+    int xf = (int)(x & 0xffff);
+    const uint16_t* a = src_ar64 + xi * 4;
+    const uint16_t* b = a + 4;
+    dst_ar64[0] = BLENDER(a[0], b[0], xf);
+    dst_ar64[1] = BLENDER(a[1], b[1], xf);
+    dst_ar64[2] = BLENDER(a[2], b[2], xf);
+    dst_ar64[3] = BLENDER(a[3], b[3], xf);
+    x += dx;
+    dst_ar64 += 4;
+  }
+}
 #undef BLENDER
 
 void ScaleRowDown38_C(const uint8_t* src_ptr,
@@ -1154,6 +1176,21 @@ void ScaleARGBCols_C(uint8_t* dst_argb,
   }
 }
 
+void ScaleAR64Cols_C(uint16_t* dst_ar64,
+                     const uint16_t* src_ar64,
+                     int dst_width,
+                     int x32,
+                     int dx) {
+  int64_t x = (int64_t)(x32);
+  const uint64_t* src = (const uint64_t*)(src_ar64);
+  uint64_t* dst = (uint64_t*)(dst_ar64);
+  int j;
+  for (j = 0; j < dst_width; ++j) {
+    dst[j] = src[x >> 16];
+    x += dx;
+  }
+}
+
 void ScaleARGBCols64_C(uint8_t* dst_argb,
                        const uint8_t* src_argb,
                        int dst_width,
@@ -1964,6 +2001,610 @@ void ScaleSlope(int src_width,
 }
 #undef CENTERSTART
 
+// sRGB to 16 bit linear light.  65535 is 1.0.
+static const uint16_t kSRGBToLinear16[256] = {
+    0, 20, 40, 60, 80, 99, 119, 139, 159, 179, 199, 219, 241, 264, 288, 313,
+    340, 367, 396, 427, 458, 491, 526, 562, 599, 637, 677, 718, 761, 805, 851,
+    898, 947, 997, 1048, 1101, 1156, 1212, 1270, 1330, 1391, 1453, 1517, 1583,
+    1651, 1720, 1790, 1863, 1937, 2013, 2090, 2170, 2250, 2333, 2418, 2504,
+    2592, 2681, 2773, 2866, 2961, 3058, 3157, 3258, 3360, 3464, 3570, 3678,
+    3788, 3900, 4014, 4129, 4247, 4366, 4488, 4611, 4736, 4864, 4993, 5124,
+    5257, 5392, 5530, 5669, 5810, 5953, 6099, 6246, 6395, 6547, 6700, 6856,
+    7014, 7174, 7335, 7500, 7666, 7834, 8004, 8177, 8352, 8528, 8708, 8889,
+    9072, 9258, 9445, 9635, 9828, 10022, 10219, 10417, 10619, 10822, 11028,
+    11235, 11446, 11658, 11873, 12090, 12309, 12530, 12754, 12980, 13209, 13440,
+    13673, 13909, 14146, 14387, 14629, 14874, 15122, 15371, 15623, 15878, 16135,
+    16394, 16656, 16920, 17187, 17456, 17727, 18001, 18277, 18556, 18837, 19121,
+    19407, 19696, 19987, 20281, 20577, 20876, 21177, 21481, 21787, 22096, 22407,
+    22721, 23038, 23357, 23678, 24002, 24329, 24658, 24990, 25325, 25662, 26001,
+    26344, 26688, 27036, 27386, 27739, 28094, 28452, 28813, 29176, 29542, 29911,
+    30282, 30656, 31033, 31412, 31794, 32179, 32567, 32957, 33350, 33745, 34143,
+    34544, 34948, 35355, 35764, 36176, 36591, 37008, 37429, 37852, 38278, 38706,
+    39138, 39572, 40009, 40449, 40891, 41337, 41785, 42236, 42690, 43147, 43606,
+    44069, 44534, 45002, 45473, 45947, 46423, 46903, 47385, 47871, 48359, 48850,
+    49344, 49841, 50341, 50844, 51349, 51858, 52369, 52884, 53401, 53921, 54445,
+    54971, 55500, 56032, 56567, 57105, 57646, 58190, 58737, 59287, 59840, 60396,
+    60955, 61517, 62082, 62650, 63221, 63795, 64372, 64952, 65535};
+// Smallest 16 bit linear value that rounds up to the next sRGB code.
+static const uint16_t kLinear16ToSRGBThreshold[256] = {
+    10, 30, 50, 70, 90, 109, 129, 149, 169, 189, 209, 230, 253, 276, 301, 327,
+    354, 382, 412, 443, 475, 509, 544, 581, 618, 657, 698, 740, 783, 828, 875,
+    923, 972, 1023, 1075, 1129, 1184, 1241, 1300, 1361, 1422, 1485, 1550, 1617,
+    1686, 1755, 1827, 1900, 1975, 2052, 2130, 2210, 2292, 2376, 2461, 2548,
+    2637, 2727, 2820, 2914, 3010, 3108, 3208, 3309, 3412, 3517, 3624, 3733,
+    3844, 3957, 4072, 4188, 4307, 4427, 4550, 4674, 4800, 4929, 5059, 5191,
+    5325, 5461, 5600, 5740, 5882, 6026, 6173, 6321, 6471, 6624, 6778, 6935,
+    7094, 7255, 7418, 7583, 7750, 7919, 8091, 8265, 8440, 8618, 8799, 8981,
+    9165, 9352, 9540, 9732, 9925, 10121, 10318, 10518, 10721, 10925, 11132,
+    11341, 11552, 11766, 11982, 12200, 12420, 12642, 12867, 13095, 13325, 13557,
+    13791, 14028, 14267, 14508, 14752, 14998, 15247, 15497, 15751, 16007, 16265,
+    16525, 16788, 17054, 17322, 17592, 17864, 18139, 18417, 18697, 18979, 19264,
+    19552, 19842, 20134, 20429, 20727, 21027, 21329, 21634, 21942, 22252, 22564,
+    22880, 23198, 23518, 23840, 24166, 24494, 24824, 25158, 25494, 25832, 26173,
+    26516, 26862, 27211, 27563, 27917, 28273, 28633, 28995, 29359, 29727, 30097,
+    30469, 30845, 31223, 31603, 31987, 32373, 32762, 33154, 33548, 33944, 34344,
+    34746, 35152, 35560, 35970, 36384, 36800, 37219, 37641, 38065, 38492, 38922,
+    39355, 39791, 40229, 40670, 41114, 41561, 42011, 42463, 42919, 43377, 43838,
+    44302, 44768, 45238, 45710, 46185, 46663, 47144, 47628, 48115, 48605, 49097,
+    49593, 50091, 50593, 51097, 51604, 52114, 52627, 53143, 53661, 54183, 54708,
+    55236, 55766, 56300, 56836, 57376, 57918, 58464, 59012, 59564, 60118, 60676,
+    61236, 61800, 62366, 62936, 63508, 64084, 64662, 65244, 65535};
+// 16 bit linear light >> 4 to sRGB.  Refined with kLinear16ToSRGBThreshold
+// to the nearest code.  Codes are at least 16 apart so 1 step is enough.
+static const uint8_t kLinear16ToSRGB[4096] = {
+    0, 1, 2, 2, 3, 4, 5, 6, 6, 7, 8, 9, 10, 10, 11, 12, 13, 13, 14, 15, 15, 16,
+    16, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 23, 24, 24, 25, 25,
+    25, 26, 26, 27, 27, 27, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32,
+    32, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 36, 36, 36, 37, 37, 37, 37, 38,
+    38, 38, 38, 39, 39, 39, 39, 40, 40, 40, 41, 41, 41, 41, 42, 42, 42, 42, 43,
+    43, 43, 43, 43, 44, 44, 44, 44, 45, 45, 45, 45, 46, 46, 46, 46, 46, 47, 47,
+    47, 47, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 51, 51,
+    51, 51, 51, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 55,
+    55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 58, 58, 58,
+    58, 58, 58, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60, 60, 61, 61, 61, 61,
+    61, 61, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64,
+    64, 64, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 67, 67, 67, 67,
+    67, 67, 67, 68, 68, 68, 68, 68, 68, 68, 69, 69, 69, 69, 69, 69, 69, 70, 70,
+    70, 70, 70, 70, 70, 71, 71, 71, 71, 71, 71, 71, 72, 72, 72, 72, 72, 72, 72,
+    72, 73, 73, 73, 73, 73, 73, 73, 74, 74, 74, 74, 74, 74, 74, 74, 75, 75, 75,
+    75, 75, 75, 75, 75, 76, 76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 80,
+    80, 80, 80, 80, 80, 80, 80, 81, 81, 81, 81, 81, 81, 81, 81, 81, 82, 82, 82,
+    82, 82, 82, 82, 82, 83, 83, 83, 83, 83, 83, 83, 83, 83, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 85, 85, 85, 85, 85, 85, 85, 85, 85, 86, 86, 86, 86, 86, 86,
+    86, 86, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 89, 89, 89, 89, 89, 89, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 94, 94, 94, 94, 94,
+    94, 94, 94, 94, 94, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+    99, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 105, 105, 105,
+    105, 105, 105, 105, 105, 105, 105, 105, 105, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+    109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 116, 116,
+    116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 118, 118, 118, 118, 118,
+    118, 118, 118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119,
+    119, 119, 119, 119, 119, 119, 119, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+    122, 122, 122, 122, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+    123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+    124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+    130, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+    131, 131, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+    132, 132, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+    133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+    135, 135, 135, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+    137, 137, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, 138, 138, 138, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140,
+    140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 141, 141, 141,
+    141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+    144, 144, 144, 144, 144, 144, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 147, 147, 147, 147,
+    147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 148, 148,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    148, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+    149, 149, 149, 149, 149, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+    150, 150, 150, 150, 150, 150, 150, 150, 151, 151, 151, 151, 151, 151, 151,
+    151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 152, 152, 152, 152,
+    152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+    153, 153, 153, 153, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155,
+    155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156, 156,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    156, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+    157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+    161, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162, 162, 162, 162, 162,
+    162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 163,
+    163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+    163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+    164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 165, 165, 165, 165, 165,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+    166, 166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167,
+    167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+    168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+    168, 168, 168, 168, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170,
+    170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+    170, 170, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+    173, 173, 173, 173, 173, 173, 173, 174, 174, 174, 174, 174, 174, 174, 174,
+    174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 175,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 176, 176, 176,
+    176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 178, 178, 178, 178, 178, 178, 178, 178,
+    178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 179,
+    179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+    179, 179, 179, 179, 179, 179, 179, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 182,
+    182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+    182, 182, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+    185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+    188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+    190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+    190, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192, 192, 192,
+    192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+    192, 192, 192, 192, 192, 192, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+    193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+    193, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 196, 196, 196, 196, 196, 196, 196,
+    196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+    196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+    197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 200, 200, 200,
+    200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+    200, 200, 200, 200, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+    201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+    202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202,
+    202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 203, 203, 203,
+    203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+    203, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 205, 205, 205, 205, 205, 205, 205, 205, 205,
+    205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205,
+    205, 205, 205, 205, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+    206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+    206, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207,
+    207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 208,
+    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 212, 212, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+    213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+    213, 213, 213, 213, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+    214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+    217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+    217, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+    218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+    218, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+    219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+    219, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+    220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+    221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+    221, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+    223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+    223, 223, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+    224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+    224, 224, 224, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+    225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+    225, 225, 225, 225, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+    226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+    226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 227, 228, 228, 228, 228, 228, 228, 228, 228,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+    228, 228, 228, 228, 228, 228, 228, 228, 229, 229, 229, 229, 229, 229, 229,
+    229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+    229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 231, 231, 231,
+    231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+    231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 232,
+    232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+    232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+    232, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+    233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+    233, 233, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+    235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+    235, 235, 235, 235, 235, 235, 235, 235, 235, 236, 236, 236, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+    238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+    238, 238, 238, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+    239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+    239, 239, 239, 239, 239, 239, 239, 240, 240, 240, 240, 240, 240, 240, 240,
+    240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+    240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241,
+    241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+    241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 242,
+    242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+    243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+    243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244,
+    244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+    244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 245, 245, 245,
+    245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+    245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+    245, 245, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246,
+    246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246,
+    246, 246, 246, 246, 246, 246, 246, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+    249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+    249, 249, 249, 249, 249, 249, 249, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 251, 251,
+    251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
+
+static __inline uint8_t LinearToSRGB(uint16_t v) {
+  int c = kLinear16ToSRGB[v >> 4];
+  if (c < 255 && v >= kLinear16ToSRGBThreshold[c]) {
+    ++c;
+  }
+  return (uint8_t)c;
+}
+
+void SRGBToLinearRow_C(const uint8_t* src_y, uint16_t* dst_y, int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    dst_y[x] = kSRGBToLinear16[src_y[x]];
+  }
+}
+
+void LinearToSRGBRow_C(const uint16_t* src_y, uint8_t* dst_y, int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    dst_y[x] = LinearToSRGB(src_y[x]);
+  }
+}
+
+// Alpha is not gamma encoded and is scaled to 16 bits linearly.
+void ARGBSRGBToLinearRow_C(const uint8_t* src_argb,
+                           uint16_t* dst_ar64,
+                           int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    dst_ar64[0] = kSRGBToLinear16[src_argb[0]];
+    dst_ar64[1] = kSRGBToLinear16[src_argb[1]];
+    dst_ar64[2] = kSRGBToLinear16[src_argb[2]];
+    dst_ar64[3] = src_argb[3] * 0x0101;
+    src_argb += 4;
+    dst_ar64 += 4;
+  }
+}
+
+void ARGBLinearToSRGBRow_C(const uint16_t* src_ar64,
+                           uint8_t* dst_argb,
+                           int width) {
+  int x;
+  for (x = 0; x < width; ++x) {
+    dst_argb[0] = LinearToSRGB(src_ar64[0]);
+    dst_argb[1] = LinearToSRGB(src_ar64[1]);
+    dst_argb[2] = LinearToSRGB(src_ar64[2]);
+    dst_argb[3] = (uint8_t)((src_ar64[3] * 255 + 32768) >> 16);
+    src_ar64 += 4;
+    dst_argb += 4;
+  }
+}
+
+#define MIN1(x) ((x) < 1 ? 1 : (x))
+
+// Box filter columns of summed rows for bpp channels per pixel.
+static void ScaleAddColsN_16_C(int dst_width,
+                               int boxheight,
+                               int x,
+                               int dx,
+                               const uint32_t* src_ptr,
+                               uint16_t* dst_ptr,
+                               int bpp) {
+  int i;
+  int c;
+  int k;
+  uint32_t scaletbl[2];
+  int minboxwidth = dx >> 16;
+  scaletbl[0] = 65536 / (MIN1(minboxwidth) * boxheight);
+  scaletbl[1] = 65536 / (MIN1(minboxwidth + 1) * boxheight);
+  for (i = 0; i < dst_width; ++i) {
+    int ix = x >> 16;
+    int boxwidth;
+    uint32_t scaleval;
+    x += dx;
+    boxwidth = MIN1((x >> 16) - ix);
+    scaleval = scaletbl[boxwidth - minboxwidth];
+    for (c = 0; c < bpp; ++c) {
+      uint32_t sum = 0;
+      for (k = 0; k < boxwidth; ++k) {
+        sum += src_ptr[(ix + k) * bpp + c];
+      }
+      *dst_ptr++ = (uint16_t)((sum * scaleval) >> 16);
+    }
+  }
+}
+
+// Convert a source row to 16 bits per channel and repeat the last pixel once
+// so bilinear filtering can read 1 pixel past the right edge.
+// A NULL ToRow16 means the source is already 16 bit.
+static void ConvertRow16(const uint8_t* src_ptr,
+                         uint16_t* dst_ptr,
+                         int width,
+                         int bpp,
+                         void (*ToRow16)(const uint8_t* src_ptr,
+                                         uint16_t* dst_ptr,
+                                         int width)) {
+  if (ToRow16) {
+    ToRow16(src_ptr, dst_ptr, width);
+  } else {
+    memcpy(dst_ptr, src_ptr, width * bpp * 2);
+  }
+  memcpy(dst_ptr + width * bpp, dst_ptr + (width - 1) * bpp, bpp * 2);
+}
+
+// Scale pixels through a 16 bit per channel intermediate.
+// Each source row is converted to 16 bits, filtered with the 16 bit box or
+// bilinear row functions and the destination row is converted back, so the
+// conversions do not need their own passes.
+// bpp is the number of channels: 1 for a plane or 4 for ARGB.
+// Strides are in bytes.  A NULL FromRow16 stores the 16 bit result directly.
+void ScaleConvert_16(int src_width,
+                     int src_height,
+                     int dst_width,
+                     int dst_height,
+                     int src_stride,
+                     int dst_stride,
+                     const uint8_t* src_ptr,
+                     uint8_t* dst_ptr,
+                     int bpp,
+                     enum FilterMode filtering,
+                     void (*ToRow16)(const uint8_t* src_ptr,
+                                     uint16_t* dst_ptr,
+                                     int width),
+                     void (*FromRow16)(const uint16_t* src_ptr,
+                                       uint8_t* dst_ptr,
+                                       int width)) {
+  // Initial source x/y coordinate and step values as 16.16 fixed point.
+  int x = 0;
+  int y = 0;
+  int dx = 0;
+  int dy = 0;
+  int j;
+  assert(bpp == 1 || bpp == 4);
+  assert(filtering != kFilterNone);
+  // Box filter is only used to scale down.
+  if (filtering == kFilterBox &&
+      (src_width < dst_width || src_height < dst_height)) {
+    filtering = kFilterBilinear;
+  }
+  ScaleSlope(src_width, src_height, dst_width, dst_height, filtering, &x, &y,
+             &dx, &dy);
+  src_width = Abs(src_width);
+
+  if (filtering == kFilterBox) {
+    const int max_y = (src_height << 16);
+    void (*ScaleAddRow)(const uint16_t* src_ptr, uint32_t* dst_ptr,
+                        int src_width) = ScaleAddRow_16_C;
+    align_buffer_64(row32, src_width * bpp * 4);
+    align_buffer_64(row16, (src_width + 1) * bpp * 2);
+    align_buffer_64(dst16, dst_width * bpp * 2);
+#if defined(HAS_SCALEADDROW_16_AVX2)
+    if (TestCpuFlag(kCpuHasAVX2)) {
+      ScaleAddRow = ScaleAddRow_16_Any_AVX2;
+      if (IS_ALIGNED(src_width * bpp, 16)) {
+        ScaleAddRow = ScaleAddRow_16_AVX2;
+      }
+    }
+#endif
+    for (j = 0; j < dst_height; ++j) {
+      int boxheight;
+      int k;
+      int iy = y >> 16;
+      const uint8_t* src = src_ptr + iy * (intptr_t)src_stride;
+      uint16_t* dst = FromRow16 ? (uint16_t*)dst16 : (uint16_t*)dst_ptr;
+      y += dy;
+      if (y > max_y) {
+        y = max_y;
+      }
+      boxheight = MIN1((y >> 16) - iy);
+      memset(row32, 0, src_width * bpp * 4);
+      for (k = 0; k < boxheight; ++k) {
+        if (ToRow16) {
+          ToRow16(src, (uint16_t*)row16, src_width);
+          ScaleAddRow((uint16_t*)row16, (uint32_t*)row32, src_width * bpp);
+        } else {
+          ScaleAddRow((const uint16_t*)src, (uint32_t*)row32,
+                      src_width * bpp);
+        }
+        src += src_stride;
+      }
+      ScaleAddColsN_16_C(dst_width, boxheight, x, dx, (uint32_t*)row32, dst,
+                         bpp);
+      if (FromRow16) {
+        FromRow16(dst, dst_ptr, dst_width);
+      }
+      dst_ptr += dst_stride;
+    }
+    free_aligned_buffer_64(row32);
+    free_aligned_buffer_64(row16);
+    free_aligned_buffer_64(dst16);
+  } else {
+    // Rows include 1 extra pixel for the right edge.
+    const int row_size = (src_width + 1) * bpp;
+    const int max_y = (src_height - 1) << 16;
+    int lasty = -1;
+    void (*InterpolateRow)(uint16_t* dst_ptr, const uint16_t* src_ptr,
+                           ptrdiff_t src_stride, int dst_width,
+                           int source_y_fraction) = InterpolateRow_16_C;
+    void (*ScaleFilterCols)(uint16_t* dst_ptr, const uint16_t* src_ptr,
+                            int dst_width, int x, int dx) =
+        (bpp == 4) ? ScaleAR64FilterCols_C
+                   : ((src_width >= 32768) ? ScaleFilterCols64_16_C
+                                           : ScaleFilterCols_16_C);
+    align_buffer_64(rows, row_size * 2 * 3);
+    align_buffer_64(dst16, dst_width * bpp * 2);
+    uint16_t* rowa = (uint16_t*)rows;
+    uint16_t* rowb = rowa + row_size;
+    uint16_t* row = rowb + row_size;
+#if defined(HAS_INTERPOLATEROW_16_AVX2)
+    if (TestCpuFlag(kCpuHasAVX2)) {
+      InterpolateRow = InterpolateRow_16_Any_AVX2;
+      if (IS_ALIGNED(row_size, 16)) {
+        InterpolateRow = InterpolateRow_16_AVX2;
+      }
+    }
+#endif
+#if defined(HAS_INTERPOLATEROW_16_NEON)
+    if (TestCpuFlag(kCpuHasNEON)) {
+      InterpolateRow = InterpolateRow_16_Any_NEON;
+      if (IS_ALIGNED(row_size, 8)) {
+        InterpolateRow = InterpolateRow_16_NEON;
+      }
+    }
+#endif
+    for (j = 0; j < dst_height; ++j) {
+      int yi;
+      int yf;
+      uint16_t* dst = FromRow16 ? (uint16_t*)dst16 : (uint16_t*)dst_ptr;
+      if (y > max_y) {
+        y = max_y;
+      }
+      yi = y >> 16;
+      yf = (filtering == kFilterLinear) ? 0 : ((y >> 8) & 255);
+      // Keep the 2 converted source rows for the next destination row.
+      if (yi != lasty) {
+        int yi1 = (yi + 1 < src_height) ? yi + 1 : yi;
+        if (lasty >= 0 && yi == lasty + 1 && filtering != kFilterLinear) {
+          uint16_t* tmp = rowa;
+          rowa = rowb;
+          rowb = tmp;
+        } else {
+          ConvertRow16(src_ptr + yi * (intptr_t)src_stride, rowa, src_width,
+                       bpp, ToRow16);
+        }
+        if (filtering != kFilterLinear) {
+          ConvertRow16(src_ptr + yi1 * (intptr_t)src_stride, rowb, src_width,
+                       bpp, ToRow16);
+        }
+        lasty = yi;
+      }
+      if (yf == 0) {
+        ScaleFilterCols(dst, rowa, dst_width, x, dx);
+      } else {
+        InterpolateRow(row, rowa, rowb - rowa, row_size, yf);
+        ScaleFilterCols(dst, row, dst_width, x, dx);
+      }
+      if (FromRow16) {
+        FromRow16(dst, dst_ptr, dst_width);
+      }
+      dst_ptr += dst_stride;
+      y += dy;
+    }
+    free_aligned_buffer_64(rows);
+    free_aligned_buffer_64(dst16);
+  }
+}
+
+// Scale sRGB encoded pixels in linear light.
+// bpp is 1 for a plane or 4 for ARGB.
+void ScaleLinearLight(int src_width,
+                      int src_height,
+                      int dst_width,
+                      int dst_height,
+                      int src_stride,
+                      int dst_stride,
+                      const uint8_t* src_ptr,
+                      uint8_t* dst_ptr,
+                      int bpp,
+                      enum FilterMode filtering) {
+  assert(bpp == 1 || bpp == 4);
+  ScaleConvert_16(src_width, src_height, dst_width, dst_height, src_stride,
+                  dst_stride, src_ptr, dst_ptr, bpp, filtering,
+                  (bpp == 4) ? ARGBSRGBToLinearRow_C : SRGBToLinearRow_C,
+                  (bpp == 4) ? ARGBLinearToSRGBRow_C : LinearToSRGBRow_C);
+}
+#undef MIN1
+
 #ifdef __cplusplus
 }  // extern "C"
 }  // namespace libyuv
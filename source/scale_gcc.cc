@@ -1819,6 +1819,33 @@ void ScaleAddRow_AVX2(const uint8_t* src_ptr,
 }
 #endif  // HAS_SCALEADDROW_AVX2
 
+#ifdef HAS_SCALEADDROW_16_AVX2
+// Reads 16 shorts and accumulates to 16 ints at a time.
+void ScaleAddRow_16_AVX2(const uint16_t* src_ptr,
+                         uint32_t* dst_ptr,
+                         int src_width) {
+  asm volatile(
+      LABELALIGN
+      "1:                                        \n"
+      "vpmovzxwd   (%0),%%ymm0                   \n"
+      "vpmovzxwd   0x10(%0),%%ymm1               \n"
+      "lea         0x20(%0),%0                   \n"  // src_ptr += 16
+      "vpaddd      (%1),%%ymm0,%%ymm0            \n"
+      "vpaddd      0x20(%1),%%ymm1,%%ymm1        \n"
+      "vmovdqu     %%ymm0,(%1)                   \n"
+      "vmovdqu     %%ymm1,0x20(%1)               \n"
+      "lea         0x40(%1),%1                   \n"
+      "sub         $0x10,%2                      \n"
+      "jg          1b                            \n"
+      "vzeroupper                                \n"
+      : "+r"(src_ptr),   // %0
+        "+r"(dst_ptr),   // %1
+        "+r"(src_width)  // %2
+      :
+      : "memory", "cc", "xmm0", "xmm1");
+}
+#endif  // HAS_SCALEADDROW_16_AVX2
+
 // Constant for making pixels signed to avoid pmaddubsw
 // saturation.
 static const uvec8 kFsub80 = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
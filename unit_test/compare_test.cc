@@ -153,6 +153,77 @@ TEST_F(LibYUVCompareTest, BenchmarkDjb2_Unaligned) {
   free_aligned_buffer_page_end(src_a);
 }
 
+TEST_F(LibYUVCompareTest, BenchmarkHashPlane_Opt) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int kStride = kWidth + 17;
+  align_buffer_page_end(src_a, kWidth * kHeight);
+  align_buffer_page_end(src_b, kStride * kHeight);
+  MemRandomize(src_a, kWidth * kHeight);
+  MemRandomize(src_b, kStride * kHeight);
+  for (int y = 0; y < kHeight; ++y) {
+    memcpy(src_b + y * kStride, src_a + y * kWidth, kWidth);
+  }
+
+  MaskCpuFlags(disable_cpu_flags_);
+  uint64_t h_c = HashPlane(src_a, kWidth, kWidth, kHeight, 5381);
+  MaskCpuFlags(benchmark_cpu_info_);
+  uint64_t h_opt = 0;
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    h_opt = HashPlane(src_a, kWidth, kWidth, kHeight, 5381);
+  }
+  EXPECT_EQ(h_c, h_opt);
+  // Stride padding is not hashed.
+  EXPECT_EQ(h_opt, HashPlane(src_b, kStride, kWidth, kHeight, 5381));
+  EXPECT_NE(h_opt, HashPlane(src_a, kWidth, kWidth, kHeight, 5382));
+
+  // Any single bit change changes the hash.
+  src_a[kWidth * kHeight - 1] ^= 1;
+  EXPECT_NE(h_opt, HashPlane(src_a, kWidth, kWidth, kHeight, 5381));
+  src_a[kWidth * kHeight - 1] ^= 1;
+  src_a[(kWidth * kHeight) / 2] ^= 0x80;
+  EXPECT_NE(h_opt, HashPlane(src_a, kWidth, kWidth, kHeight, 5381));
+  src_a[(kWidth * kHeight) / 2] ^= 0x80;
+  EXPECT_EQ(h_opt, HashPlane(src_a, kWidth, kWidth, kHeight, 5381));
+
+  free_aligned_buffer_page_end(src_b);
+  free_aligned_buffer_page_end(src_a);
+}
+
+TEST_F(LibYUVCompareTest, HashPlane) {
+  const int kWidth = 131;
+  const int kHeight = 4;
+  SIMD_ALIGNED(uint8_t plane[kHeight][kWidth]);
+  SIMD_ALIGNED(uint8_t swapped[kHeight][kWidth]);
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      plane[y][x] = static_cast<uint8_t>(x * 3 + y * 17);
+    }
+  }
+  memcpy(swapped[0], plane[1], kWidth);
+  memcpy(swapped[1], plane[0], kWidth);
+  memcpy(swapped[2], plane[2], kWidth * 2);
+  uint64_t h = HashPlane(&plane[0][0], kWidth, kWidth, kHeight, 0);
+  // Row order, dimensions and orientation all affect the hash.
+  EXPECT_NE(h, HashPlane(&swapped[0][0], kWidth, kWidth, kHeight, 0));
+  EXPECT_NE(h, HashPlane(&plane[0][0], kWidth, kWidth - 1, kHeight, 0));
+  EXPECT_NE(h, HashPlane(&plane[0][0], kWidth, kWidth, kHeight - 1, 0));
+  EXPECT_NE(h, HashPlane(&plane[0][0], kWidth, kWidth, -kHeight, 0));
+  EXPECT_EQ(HashPlane(&plane[kHeight - 1][0], -kWidth, kWidth, kHeight, 0),
+            HashPlane(&plane[0][0], kWidth, kWidth, -kHeight, 0));
+  // A zero row must not hash the same as a shorter row with zero padding.
+  memset(plane, 0, sizeof(plane));
+  EXPECT_NE(HashPlane(&plane[0][0], kWidth, 64, 1, 0),
+            HashPlane(&plane[0][0], kWidth, 63, 1, 0));
+  EXPECT_EQ(0u, HashPlane(NULL, kWidth, kWidth, kHeight, 0));
+
+  uint64_t h420 = HashI420(&plane[0][0], kWidth, &plane[2][0], kWidth,
+                           &plane[3][0], kWidth, 8, 4, 0);
+  plane[3][3] = 1;
+  EXPECT_NE(h420, HashI420(&plane[0][0], kWidth, &plane[2][0], kWidth,
+                           &plane[3][0], kWidth, 8, 4, 0));
+}
+
 TEST_F(LibYUVCompareTest, BenchmarkARGBDetect_Opt) {
   uint32_t fourcc;
   const int kMaxTest = benchmark_width_ * benchmark_height_ * 4;
@@ -209,6 +280,102 @@ TEST_F(LibYUVCompareTest, BenchmarkARGBDetect_Unaligned) {
   free_aligned_buffer_page_end(src_a);
 }
 
+// Non opaque pixels at every position must be found in scan order, including
+// the remainder handled after the SIMD blocks.
+TEST_F(LibYUVCompareTest, TestARGBDetect_Position) {
+  const int kWidth = benchmark_width_ + 5;
+  const int kHeight = 3;
+  const int kStride = kWidth * 4 + 8;
+  align_buffer_page_end(src_a, kStride * kHeight);
+  memset(src_a, 255, kStride * kHeight);
+  EXPECT_EQ(0u, ARGBDetect(src_a, kStride, kWidth, kHeight));
+
+  for (int i = 0; i < kWidth * kHeight; i += (i < 40 ? 1 : 7)) {
+    uint8_t* pixel = src_a + (i / kWidth) * kStride + (i % kWidth) * 4;
+    // Middle bytes do not affect detection.
+    pixel[1] = 0;
+    pixel[2] = 0;
+    EXPECT_EQ(0u, ARGBDetect(src_a, kStride, kWidth, kHeight));
+    pixel[0] = 0;
+    EXPECT_EQ(static_cast<uint32_t>(libyuv::FOURCC_BGRA),
+              ARGBDetect(src_a, kStride, kWidth, kHeight));
+    pixel[0] = 255;
+    pixel[3] = 0;
+    EXPECT_EQ(static_cast<uint32_t>(libyuv::FOURCC_ARGB),
+              ARGBDetect(src_a, kStride, kWidth, kHeight));
+    // A later pixel does not override the first one found.
+    if (i + 1 < kWidth * kHeight) {
+      uint8_t* next =
+          src_a + ((i + 1) / kWidth) * kStride + ((i + 1) % kWidth) * 4;
+      next[0] = 0;
+      EXPECT_EQ(static_cast<uint32_t>(libyuv::FOURCC_ARGB),
+                ARGBDetect(src_a, kStride, kWidth, kHeight));
+      next[0] = 255;
+    }
+    pixel[1] = 255;
+    pixel[2] = 255;
+    pixel[3] = 255;
+  }
+  free_aligned_buffer_page_end(src_a);
+}
+
+TEST_F(LibYUVCompareTest, BenchmarkARGBIsOpaque_Opt) {
+  const int kSize = benchmark_width_ * benchmark_height_ * 4;
+  align_buffer_page_end(src_a, kSize);
+  int opaque = 0;
+  MemRandomize(src_a, kSize);
+  for (int i = 3; i < kSize; i += 4) {
+    src_a[i] = 255;
+  }
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    opaque = ARGBIsOpaque(src_a, benchmark_width_ * 4, benchmark_width_,
+                          benchmark_height_);
+  }
+  EXPECT_EQ(1, opaque);
+
+  src_a[kSize - 1] = 254;
+  EXPECT_EQ(0, ARGBIsOpaque(src_a, benchmark_width_ * 4, benchmark_width_,
+                            benchmark_height_));
+  EXPECT_EQ(0, ARGBIsOpaque(src_a, benchmark_width_ * 4, benchmark_width_,
+                            -benchmark_height_));
+  src_a[kSize - 1] = 255;
+  src_a[3] = 0;
+  EXPECT_EQ(0, ARGBIsOpaque(src_a, benchmark_width_ * 4, benchmark_width_,
+                            benchmark_height_));
+  // Odd width with a stride that skips a transparent pixel.
+  if (benchmark_width_ > 1) {
+    EXPECT_EQ(1, ARGBIsOpaque(src_a + 4, benchmark_width_ * 4,
+                              benchmark_width_ - 1, benchmark_height_));
+  }
+  EXPECT_EQ(0, ARGBIsOpaque(src_a, benchmark_width_ * 4, 0, 1));
+  free_aligned_buffer_page_end(src_a);
+}
+
+TEST_F(LibYUVCompareTest, TestPlaneIsConstant) {
+  const int kWidth = benchmark_width_ + 3;
+  const int kStride = kWidth + 5;
+  const int kHeight = benchmark_height_;
+  align_buffer_page_end(src_a, kStride * kHeight);
+  memset(src_a, 0x5a, kStride * kHeight);
+  EXPECT_EQ(1, PlaneIsConstant(src_a, kStride, kWidth, kHeight));
+  EXPECT_EQ(1, PlaneIsConstant(src_a, kStride, kWidth, -kHeight));
+
+  // Padding between rows is not part of the plane.
+  src_a[kWidth] = 0;
+  EXPECT_EQ(1, PlaneIsConstant(src_a, kStride, kWidth, kHeight));
+
+  for (int i = 0; i < kWidth * kHeight; i += (i < 40 ? 1 : 13)) {
+    uint8_t* p = src_a + (i / kWidth) * kStride + (i % kWidth);
+    *p = 0x5b;
+    EXPECT_EQ(0, PlaneIsConstant(src_a, kStride, kWidth, kHeight));
+    *p = 0x59;
+    EXPECT_EQ(0, PlaneIsConstant(src_a, kStride, kWidth, kHeight));
+    *p = 0x5a;
+  }
+  EXPECT_EQ(1, PlaneIsConstant(src_a, kStride, kWidth, kHeight));
+  free_aligned_buffer_page_end(src_a);
+}
+
 #ifdef ENABLE_ROW_TESTS
 TEST_F(LibYUVCompareTest, BenchmarkHammingDistance_Opt) {
   const int kMaxWidth = 4096 * 3;
@@ -407,6 +574,78 @@ TEST_F(LibYUVCompareTest, TestHammingDistance_Opt) {
   free_aligned_buffer_page_end(src_a);
   free_aligned_buffer_page_end(src_b);
 }
+
+#if defined(HAS_HAMMINGDISTANCE_AVX512VPOPCNTDQ)
+TEST_F(LibYUVCompareTest, BenchmarkHammingDistance_AVX512) {
+  const int kMaxWidth = 4096 * 3;
+  align_buffer_page_end(src_a, kMaxWidth);
+  align_buffer_page_end(src_b, kMaxWidth);
+  MemRandomize(src_a, kMaxWidth);
+  MemRandomize(src_b, kMaxWidth);
+
+  uint32_t h0 = HammingDistance_C(src_a, src_b, kMaxWidth);
+  uint32_t h1 = h0;
+
+  int has_avx512 = TestCpuFlag(kCpuHasAVX512VPOPCNTDQ);
+  int count =
+      benchmark_iterations_ *
+      ((benchmark_width_ * benchmark_height_ + kMaxWidth - 1) / kMaxWidth);
+  for (int i = 0; i < count; ++i) {
+    if (has_avx512) {
+      h1 = HammingDistance_AVX512VPOPCNTDQ(src_a, src_b, kMaxWidth);
+    } else {
+      h1 = HammingDistance_C(src_a, src_b, kMaxWidth);
+    }
+  }
+  EXPECT_EQ(h0, h1);
+
+  // 64 bytes is the minimum the kernel handles.
+  if (has_avx512) {
+    EXPECT_EQ(HammingDistance_C(src_a, src_b, 64),
+              HammingDistance_AVX512VPOPCNTDQ(src_a, src_b, 64));
+  }
+
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(src_b);
+}
+#endif  // HAS_HAMMINGDISTANCE_AVX512VPOPCNTDQ
+
+#if defined(HAS_SUMSQUAREERROR_AVX512BW)
+TEST_F(LibYUVCompareTest, BenchmarkSumSquareError_AVX512) {
+  const int kMaxWidth = 4096 * 3;
+  align_buffer_page_end(src_a, kMaxWidth);
+  align_buffer_page_end(src_b, kMaxWidth);
+  MemRandomize(src_a, kMaxWidth);
+  MemRandomize(src_b, kMaxWidth);
+
+  uint32_t s0 = SumSquareError_C(src_a, src_b, kMaxWidth);
+  uint32_t s1 = s0;
+
+  int has_avx512 = TestCpuFlag(kCpuHasAVX512BW);
+  int count =
+      benchmark_iterations_ *
+      ((benchmark_width_ * benchmark_height_ + kMaxWidth - 1) / kMaxWidth);
+  for (int i = 0; i < count; ++i) {
+    if (has_avx512) {
+      s1 = SumSquareError_AVX512BW(src_a, src_b, kMaxWidth);
+    } else {
+      s1 = SumSquareError_C(src_a, src_b, kMaxWidth);
+    }
+  }
+  EXPECT_EQ(s0, s1);
+
+  // Counts that are an odd multiple of 32 use the tail path.
+  if (has_avx512) {
+    EXPECT_EQ(SumSquareError_C(src_a, src_b, 32),
+              SumSquareError_AVX512BW(src_a, src_b, 32));
+    EXPECT_EQ(SumSquareError_C(src_a, src_b, 96),
+              SumSquareError_AVX512BW(src_a, src_b, 96));
+  }
+
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(src_b);
+}
+#endif  // HAS_SUMSQUAREERROR_AVX512BW
 #endif  // ENABLE_ROW_TESTS
 
 TEST_F(LibYUVCompareTest, TestHammingDistance) {
@@ -498,6 +737,338 @@ TEST_F(LibYUVCompareTest, SumSquareError) {
   free_aligned_buffer_page_end(src_b);
 }
 
+// Odd counts exercise every SIMD width plus the C remainder.
+TEST_F(LibYUVCompareTest, SumSquareError_Lengths) {
+  const int kMaxWidth = 4096 + 161;
+  align_buffer_page_end(src_a, kMaxWidth);
+  align_buffer_page_end(src_b, kMaxWidth);
+  MemRandomize(src_a, kMaxWidth);
+  MemRandomize(src_b, kMaxWidth);
+
+  for (int count = 1; count <= kMaxWidth; count += 31) {
+    MaskCpuFlags(disable_cpu_flags_);
+    uint64_t c_err = ComputeSumSquareError(src_a, src_b, count);
+    uint64_t c_dist = ComputeHammingDistance(src_a, src_b, count);
+    MaskCpuFlags(benchmark_cpu_info_);
+    uint64_t opt_err = ComputeSumSquareError(src_a, src_b, count);
+    uint64_t opt_dist = ComputeHammingDistance(src_a, src_b, count);
+    EXPECT_EQ(c_err, opt_err) << count;
+    EXPECT_EQ(c_dist, opt_dist) << count;
+  }
+
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(src_b);
+}
+
+TEST_F(LibYUVCompareTest, BenchmarkSumSquareErrorPlane_16_Opt) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int kStride = kWidth + 3;
+  const int kSize = kStride * kHeight * 2;
+  align_buffer_page_end(src_a, kSize);
+  align_buffer_page_end(src_b, kSize);
+  MemRandomize(src_a, kSize);
+  MemRandomize(src_b, kSize);
+  const uint16_t* src_a16 = reinterpret_cast<const uint16_t*>(src_a);
+  const uint16_t* src_b16 = reinterpret_cast<const uint16_t*>(src_b);
+
+  // Full 16 bit range overflows 32 bit sums after a few pixels.
+  uint64_t ref_err = 0;
+  for (int i = 0; i < kHeight; ++i) {
+    for (int j = 0; j < kWidth; ++j) {
+      int64_t diff = static_cast<int64_t>(src_a16[i * kStride + j]) -
+                     src_b16[i * kStride + j];
+      ref_err += static_cast<uint64_t>(diff * diff);
+    }
+  }
+
+  MaskCpuFlags(disable_cpu_flags_);
+  uint64_t c_err = ComputeSumSquareErrorPlane_16(src_a16, kStride, src_b16,
+                                                 kStride, kWidth, kHeight);
+  MaskCpuFlags(benchmark_cpu_info_);
+  uint64_t opt_err = 0;
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    opt_err = ComputeSumSquareErrorPlane_16(src_a16, kStride, src_b16,
+                                            kStride, kWidth, kHeight);
+  }
+  EXPECT_EQ(ref_err, c_err);
+  EXPECT_EQ(ref_err, opt_err);
+
+  // Contiguous planes are coalesced into a single row.
+  MaskCpuFlags(disable_cpu_flags_);
+  c_err = ComputeSumSquareErrorPlane_16(src_a16, kWidth, src_b16, kWidth,
+                                        kWidth, kHeight);
+  MaskCpuFlags(benchmark_cpu_info_);
+  opt_err = ComputeSumSquareErrorPlane_16(src_a16, kWidth, src_b16, kWidth,
+                                          kWidth, kHeight);
+  EXPECT_EQ(c_err, opt_err);
+
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(src_b);
+}
+
+// Compare block SAD/SSE maps from optimized code against C and, at full
+// resolution, against a direct per pixel reference.
+static void TestBlockPlane(int width,
+                           int height,
+                           int block_size,
+                           int downscale,
+                           int sse,
+                           int benchmark_iterations,
+                           int disable_cpu_flags,
+                           int benchmark_cpu_info) {
+  const int kStride = width + 3;
+  const int kBlockWidth = downscale ? (width + 1) / 2 : width;
+  const int kBlockHeight = downscale ? (height + 1) / 2 : height;
+  const int kBlocksX = (kBlockWidth + block_size - 1) / block_size;
+  const int kBlocksY = (kBlockHeight + block_size - 1) / block_size;
+  const int kBlocks = kBlocksX * kBlocksY;
+  int (*ComputeBlockPlane)(const uint8_t*, int, const uint8_t*, int,
+                           uint32_t*, int, int, int, int, int) =
+      sse ? ComputeBlockSsePlane : ComputeBlockSadPlane;
+  align_buffer_page_end(src_a, kStride * height);
+  align_buffer_page_end(src_b, kStride * height);
+  align_buffer_page_end(dst_c, kBlocks * 4);
+  align_buffer_page_end(dst_opt, kBlocks * 4);
+  uint32_t* blocks_c = reinterpret_cast<uint32_t*>(dst_c);
+  uint32_t* blocks_opt = reinterpret_cast<uint32_t*>(dst_opt);
+  MemRandomize(src_a, kStride * height);
+  MemRandomize(src_b, kStride * height);
+  memset(dst_c, 1, kBlocks * 4);
+  memset(dst_opt, 2, kBlocks * 4);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, ComputeBlockPlane(src_a, kStride, src_b, kStride, blocks_c,
+                                 kBlocksX, width, height, block_size,
+                                 downscale));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    ComputeBlockPlane(src_a, kStride, src_b, kStride, blocks_opt, kBlocksX,
+                      width, height, block_size, downscale);
+  }
+  for (int i = 0; i < kBlocks; ++i) {
+    EXPECT_EQ(blocks_c[i], blocks_opt[i]);
+  }
+
+  if (!downscale) {
+    for (int by = 0; by < kBlocksY; ++by) {
+      for (int bx = 0; bx < kBlocksX; ++bx) {
+        uint32_t expected = 0;
+        for (int y = by * block_size;
+             y < (by + 1) * block_size && y < height; ++y) {
+          for (int x = bx * block_size;
+               x < (bx + 1) * block_size && x < width; ++x) {
+            int diff = src_a[y * kStride + x] - src_b[y * kStride + x];
+            expected += sse ? diff * diff : abs(diff);
+          }
+        }
+        EXPECT_EQ(expected, blocks_opt[by * kBlocksX + bx]);
+      }
+    }
+  }
+
+  free_aligned_buffer_page_end(dst_opt);
+  free_aligned_buffer_page_end(dst_c);
+  free_aligned_buffer_page_end(src_b);
+  free_aligned_buffer_page_end(src_a);
+}
+
+#define TESTBLOCKPLANE(NAME, BLOCK, DOWNSCALE, SSE)                          \
+  TEST_F(LibYUVCompareTest, NAME##BLOCK##_Opt) {                             \
+    TestBlockPlane(benchmark_width_, benchmark_height_, BLOCK, DOWNSCALE,    \
+                   SSE, benchmark_iterations_, disable_cpu_flags_,           \
+                   benchmark_cpu_info_);                                     \
+  }                                                                          \
+  TEST_F(LibYUVCompareTest, NAME##BLOCK##_Any) {                             \
+    TestBlockPlane(benchmark_width_ + 5, benchmark_height_ + 3, BLOCK,       \
+                   DOWNSCALE, SSE, 1, disable_cpu_flags_,                    \
+                   benchmark_cpu_info_);                                     \
+  }
+
+TESTBLOCKPLANE(BlockSadPlane, 8, 0, 0)
+TESTBLOCKPLANE(BlockSadPlane, 16, 0, 0)
+TESTBLOCKPLANE(BlockSadPlane, 32, 0, 0)
+TESTBLOCKPLANE(BlockSsePlane, 8, 0, 1)
+TESTBLOCKPLANE(BlockSsePlane, 16, 0, 1)
+TESTBLOCKPLANE(BlockSsePlane, 32, 0, 1)
+TESTBLOCKPLANE(BlockSadPlaneHalf, 16, 1, 0)
+TESTBLOCKPLANE(BlockSsePlaneHalf, 16, 1, 1)
+
+TEST_F(LibYUVCompareTest, BlockSadPlane_Invalid) {
+  SIMD_ALIGNED(uint8_t plane[16 * 16]);
+  SIMD_ALIGNED(uint32_t blocks[4]);
+  memset(plane, 0, sizeof(plane));
+  EXPECT_EQ(-1, ComputeBlockSadPlane(plane, 16, plane, 16, blocks, 1, 16, 16,
+                                     12, 0));
+  EXPECT_EQ(-1, ComputeBlockSsePlane(plane, 16, plane, 16, NULL, 1, 16, 16,
+                                     16, 0));
+  EXPECT_EQ(0, ComputeBlockSadPlane(plane, 16, plane, 16, blocks, 2, 16, 16,
+                                    8, 0));
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(0u, blocks[i]);
+  }
+}
+
+TEST_F(LibYUVCompareTest, BenchmarkAnalyzeFrameChange_Opt) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int kHalfWidth = (kWidth + 1) / 2;
+  const int kHalfHeight = (kHeight + 1) / 2;
+  const int kTilesX = (kWidth + 31) / 32;
+  const int kTilesY = (kHeight + 31) / 32;
+  align_buffer_page_end(src_y, kWidth * kHeight);
+  align_buffer_page_end(src_u, kHalfWidth * kHalfHeight);
+  align_buffer_page_end(src_v, kHalfWidth * kHalfHeight);
+  align_buffer_page_end(prev_y, kWidth * kHeight);
+  align_buffer_page_end(prev_u, kHalfWidth * kHalfHeight);
+  align_buffer_page_end(prev_v, kHalfWidth * kHalfHeight);
+  align_buffer_page_end(tiles_c, kTilesX * kTilesY);
+  align_buffer_page_end(tiles_opt, kTilesX * kTilesY);
+  MemRandomize(src_y, kWidth * kHeight);
+  MemRandomize(src_u, kHalfWidth * kHalfHeight);
+  MemRandomize(src_v, kHalfWidth * kHalfHeight);
+  memcpy(prev_y, src_y, kWidth * kHeight);
+  memcpy(prev_u, src_u, kHalfWidth * kHalfHeight);
+  memcpy(prev_v, src_v, kHalfWidth * kHalfHeight);
+  // Change a few pixels.
+  prev_y[kWidth * kHeight - 1] ^= 1;
+  prev_y[0] += 3;
+  prev_v[kHalfWidth * kHalfHeight / 2] ^= 0x80;
+
+  FrameChangeReport report_c;
+  FrameChangeReport report_opt;
+  MaskCpuFlags(disable_cpu_flags_);
+  EXPECT_EQ(0, AnalyzeFrameChange(src_y, kWidth, src_u, kHalfWidth, src_v,
+                                  kHalfWidth, prev_y, kWidth, prev_u,
+                                  kHalfWidth, prev_v, kHalfWidth, tiles_c,
+                                  kTilesX, kWidth, kHeight, 32, &report_c));
+  MaskCpuFlags(benchmark_cpu_info_);
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    AnalyzeFrameChange(src_y, kWidth, src_u, kHalfWidth, src_v, kHalfWidth,
+                       prev_y, kWidth, prev_u, kHalfWidth, prev_v, kHalfWidth,
+                       tiles_opt, kTilesX, kWidth, kHeight, 32, &report_opt);
+  }
+  EXPECT_EQ(report_c.sad_y, report_opt.sad_y);
+  EXPECT_EQ(report_c.sad_uv, report_opt.sad_uv);
+  EXPECT_EQ(report_c.histogram_delta, report_opt.histogram_delta);
+  EXPECT_EQ(report_c.changed_tiles, report_opt.changed_tiles);
+  EXPECT_EQ(kTilesX * kTilesY, report_opt.num_tiles);
+  EXPECT_EQ(0, report_opt.is_duplicate);
+  EXPECT_EQ(0, report_opt.is_scene_cut);
+  EXPECT_EQ(0x80u, report_opt.sad_uv);
+  for (int i = 0; i < kTilesX * kTilesY; ++i) {
+    EXPECT_EQ(tiles_c[i], tiles_opt[i]);
+  }
+  EXPECT_EQ(1, tiles_opt[0]);
+  EXPECT_EQ(1, tiles_opt[kTilesX * kTilesY - 1]);
+
+  free_aligned_buffer_page_end(tiles_opt);
+  free_aligned_buffer_page_end(tiles_c);
+  free_aligned_buffer_page_end(prev_v);
+  free_aligned_buffer_page_end(prev_u);
+  free_aligned_buffer_page_end(prev_y);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_y);
+}
+
+TEST_F(LibYUVCompareTest, AnalyzeFrameChange) {
+  const int kWidth = 100;
+  const int kHeight = 51;
+  const int kTilesX = (kWidth + 15) / 16;
+  const int kTilesY = (kHeight + 15) / 16;
+  align_buffer_page_end(src_y, kWidth * kHeight);
+  align_buffer_page_end(prev_y, kWidth * kHeight);
+  uint8_t tiles[kTilesX * kTilesY];
+  FrameChangeReport report;
+  for (int i = 0; i < kWidth * kHeight; ++i) {
+    src_y[i] = static_cast<uint8_t>(i * 7);
+  }
+  memcpy(prev_y, src_y, kWidth * kHeight);
+
+  // Identical luma only frames are duplicates.
+  EXPECT_EQ(0, AnalyzeFrameChange(src_y, kWidth, NULL, 0, NULL, 0, prev_y,
+                                  kWidth, NULL, 0, NULL, 0, tiles, kTilesX,
+                                  kWidth, kHeight, 16, &report));
+  EXPECT_EQ(1, report.is_duplicate);
+  EXPECT_EQ(0, report.is_scene_cut);
+  EXPECT_EQ(0, report.changed_tiles);
+  EXPECT_EQ(kTilesX * kTilesY, report.num_tiles);
+  EXPECT_EQ(0u, report.histogram_delta);
+
+  // One pixel in the last partial tile changes.
+  prev_y[50 * kWidth + 99] += 5;
+  EXPECT_EQ(0, AnalyzeFrameChange(src_y, kWidth, NULL, 0, NULL, 0, prev_y,
+                                  kWidth, NULL, 0, NULL, 0, tiles, kTilesX,
+                                  kWidth, kHeight, 16, &report));
+  EXPECT_EQ(0, report.is_duplicate);
+  EXPECT_EQ(1, report.changed_tiles);
+  EXPECT_EQ(5u, report.sad_y);
+  for (int i = 0; i < kTilesX * kTilesY; ++i) {
+    EXPECT_EQ(i == kTilesX * kTilesY - 1 ? 1 : 0, tiles[i]);
+  }
+
+  // A bright frame after a dark one is a scene cut.
+  memset(src_y, 230, kWidth * kHeight);
+  memset(prev_y, 20, kWidth * kHeight);
+  EXPECT_EQ(0, AnalyzeFrameChange(src_y, kWidth, NULL, 0, NULL, 0, prev_y,
+                                  kWidth, NULL, 0, NULL, 0, NULL, 0, kWidth,
+                                  -kHeight, 16, &report));
+  EXPECT_EQ(1, report.is_scene_cut);
+  EXPECT_EQ(1024u, report.histogram_delta);
+  EXPECT_EQ(kTilesX * kTilesY, report.changed_tiles);
+  EXPECT_EQ(210u * kWidth * kHeight, report.sad_y);
+
+  EXPECT_EQ(-1, AnalyzeFrameChange(src_y, kWidth, NULL, 0, NULL, 0, prev_y,
+                                   kWidth, NULL, 0, NULL, 0, NULL, 0, kWidth,
+                                   kHeight, 24, &report));
+  free_aligned_buffer_page_end(prev_y);
+  free_aligned_buffer_page_end(src_y);
+}
+
+TEST_F(LibYUVCompareTest, ARGBDirtyTiles) {
+  const int kWidth = 150;
+  const int kHeight = 70;
+  const int kTilesX = (kWidth + 15) / 16;  // 10 tiles of 16.
+  const int kTilesY = (kHeight + 15) / 16;
+  const int kBitmapStride = 3;
+  align_buffer_page_end(src_argb, kWidth * kHeight * 4);
+  align_buffer_page_end(prev_argb, kWidth * kHeight * 4);
+  uint8_t dirty[kBitmapStride * kTilesY];
+  MemRandomize(src_argb, kWidth * kHeight * 4);
+  memcpy(prev_argb, src_argb, kWidth * kHeight * 4);
+
+  memset(dirty, 0xff, sizeof(dirty));
+  EXPECT_EQ(0, ARGBDirtyTiles(src_argb, kWidth * 4, prev_argb, kWidth * 4,
+                              dirty, kBitmapStride, kWidth, kHeight, 16));
+  for (int y = 0; y < kTilesY; ++y) {
+    EXPECT_EQ(0, dirty[y * kBitmapStride]);
+    EXPECT_EQ(0, dirty[y * kBitmapStride + 1]);
+  }
+
+  // Tile (9, 4) is partial in both directions; tile (3, 1) is full.
+  prev_argb[(69 * kWidth + 149) * 4 + 2] ^= 1;
+  prev_argb[(17 * kWidth + 63) * 4] ^= 1;
+  EXPECT_EQ(2, ARGBDirtyTiles(src_argb, kWidth * 4, prev_argb, kWidth * 4,
+                              dirty, kBitmapStride, kWidth, kHeight, 16));
+  for (int y = 0; y < kTilesY; ++y) {
+    for (int x = 0; x < kTilesX; ++x) {
+      int expected = (x == 9 && y == 4) || (x == 3 && y == 1);
+      EXPECT_EQ(expected,
+                (dirty[y * kBitmapStride + (x >> 3)] >> (x & 7)) & 1);
+    }
+  }
+  // Inverted with tiles of 64, both changes are in the first tile row.
+  EXPECT_EQ(2, ARGBDirtyTiles(src_argb, kWidth * 4, prev_argb, kWidth * 4,
+                              dirty, kBitmapStride, kWidth, -kHeight, 64));
+  EXPECT_EQ(0x5, dirty[0]);
+  EXPECT_EQ(-1, ARGBDirtyTiles(src_argb, kWidth * 4, prev_argb, kWidth * 4,
+                               dirty, kBitmapStride, kWidth, kHeight, 8));
+
+  free_aligned_buffer_page_end(prev_argb);
+  free_aligned_buffer_page_end(src_argb);
+}
+
 TEST_F(LibYUVCompareTest, BenchmarkPsnr_Opt) {
   align_buffer_page_end(src_a, benchmark_width_ * benchmark_height_);
   align_buffer_page_end(src_b, benchmark_width_ * benchmark_height_);
@@ -736,4 +1307,108 @@ TEST_F(LibYUVCompareTest, Ssim) {
   free_aligned_buffer_page_end(src_b);
 }
 
+TEST_F(LibYUVCompareTest, I010Psnr) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int kWidthUV = (kWidth + 1) / 2;
+  const int kHeightUV = (kHeight + 1) / 2;
+  const int kSizeY = kWidth * kHeight;
+  const int kSizeUV = kWidthUV * kHeightUV;
+  align_buffer_page_end(src_a, (kSizeY + kSizeUV * 2) * 2);
+  align_buffer_page_end(src_b, (kSizeY + kSizeUV * 2) * 2);
+  align_buffer_page_end(p010_a, (kSizeY + kSizeUV * 2) * 2);
+  align_buffer_page_end(p010_b, (kSizeY + kSizeUV * 2) * 2);
+  uint16_t* a16 = reinterpret_cast<uint16_t*>(src_a);
+  uint16_t* b16 = reinterpret_cast<uint16_t*>(src_b);
+  uint16_t* pa16 = reinterpret_cast<uint16_t*>(p010_a);
+  uint16_t* pb16 = reinterpret_cast<uint16_t*>(p010_b);
+  for (int i = 0; i < kSizeY + kSizeUV * 2; ++i) {
+    a16[i] = fastrand() & 1023;
+    b16[i] = a16[i];
+  }
+
+  double err = I010Psnr(a16, kWidth, a16 + kSizeY, kWidthUV,
+                        a16 + kSizeY + kSizeUV, kWidthUV, b16, kWidth,
+                        b16 + kSizeY, kWidthUV, b16 + kSizeY + kSizeUV,
+                        kWidthUV, kWidth, kHeight);
+  EXPECT_EQ(kMaxPsnr, err);
+
+  for (int i = 0; i < kSizeY + kSizeUV * 2; ++i) {
+    b16[i] = (a16[i] + (fastrand() & 15)) & 1023;
+  }
+  err = I010Psnr(a16, kWidth, a16 + kSizeY, kWidthUV, a16 + kSizeY + kSizeUV,
+                 kWidthUV, b16, kWidth, b16 + kSizeY, kWidthUV,
+                 b16 + kSizeY + kSizeUV, kWidthUV, kWidth, kHeight);
+  EXPECT_GT(err, 0.0);
+  EXPECT_LT(err, static_cast<double>(kMaxPsnr));
+
+  // The same frame in P010 layout gives the same PSNR.
+  for (int i = 0; i < kSizeY; ++i) {
+    pa16[i] = a16[i] << 6;
+    pb16[i] = b16[i] << 6;
+  }
+  for (int i = 0; i < kSizeUV; ++i) {
+    pa16[kSizeY + i * 2 + 0] = a16[kSizeY + i] << 6;
+    pa16[kSizeY + i * 2 + 1] = a16[kSizeY + kSizeUV + i] << 6;
+    pb16[kSizeY + i * 2 + 0] = b16[kSizeY + i] << 6;
+    pb16[kSizeY + i * 2 + 1] = b16[kSizeY + kSizeUV + i] << 6;
+  }
+  double p010_err = P010Psnr(pa16, kWidth, pa16 + kSizeY, kWidthUV * 2, pb16,
+                             kWidth, pb16 + kSizeY, kWidthUV * 2, kWidth,
+                             kHeight);
+  EXPECT_NEAR(err, p010_err, 0.000001);
+
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(src_b);
+  free_aligned_buffer_page_end(p010_a);
+  free_aligned_buffer_page_end(p010_b);
+}
+
+TEST_F(LibYUVCompareTest, I010Ssim) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int kWidthUV = (kWidth + 1) / 2;
+  const int kHeightUV = (kHeight + 1) / 2;
+  const int kSizeY = kWidth * kHeight;
+  const int kSizeUV = kWidthUV * kHeightUV;
+  if (kWidthUV <= 8 || kHeightUV <= 8) {
+    return;
+  }
+  const int kSize = kSizeY + kSizeUV * 2;
+  align_buffer_page_end(src_a, kSize);
+  align_buffer_page_end(src_b, kSize);
+  align_buffer_page_end(src_a16, kSize * 2);
+  align_buffer_page_end(src_b16, kSize * 2);
+  uint16_t* a16 = reinterpret_cast<uint16_t*>(src_a16);
+  uint16_t* b16 = reinterpret_cast<uint16_t*>(src_b16);
+  for (int i = 0; i < kSize; ++i) {
+    src_a[i] = fastrand() & 0xff;
+    src_b[i] = (src_a[i] + (fastrand() & 31)) & 0xff;
+    a16[i] = src_a[i] << 2;
+    b16[i] = src_b[i] << 2;
+  }
+
+  double ssim = I010Ssim(a16, kWidth, a16 + kSizeY, kWidthUV,
+                         a16 + kSizeY + kSizeUV, kWidthUV, a16, kWidth,
+                         a16 + kSizeY, kWidthUV, a16 + kSizeY + kSizeUV,
+                         kWidthUV, kWidth, kHeight);
+  EXPECT_NEAR(1.0, ssim, 0.000001);
+
+  // 10 bit copies of 8 bit frames score close to the 8 bit SSIM.
+  double ssim8 = I420Ssim(src_a, kWidth, src_a + kSizeY, kWidthUV,
+                          src_a + kSizeY + kSizeUV, kWidthUV, src_b, kWidth,
+                          src_b + kSizeY, kWidthUV, src_b + kSizeY + kSizeUV,
+                          kWidthUV, kWidth, kHeight);
+  ssim = I010Ssim(a16, kWidth, a16 + kSizeY, kWidthUV, a16 + kSizeY + kSizeUV,
+                  kWidthUV, b16, kWidth, b16 + kSizeY, kWidthUV,
+                  b16 + kSizeY + kSizeUV, kWidthUV, kWidth, kHeight);
+  EXPECT_LT(ssim, 1.0);
+  EXPECT_NEAR(ssim8, ssim, 0.01);
+
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(src_b);
+  free_aligned_buffer_page_end(src_a16);
+  free_aligned_buffer_page_end(src_b16);
+}
+
 }  // namespace libyuv
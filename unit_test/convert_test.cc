@@ -4644,4 +4644,1456 @@ TEST_F(LibYUVConvertTest, TestRGB24ToI420) {
 }
 #endif
 
+// Converting only dirty tiles on top of the previous frame's conversion must
+// match converting the whole new frame.
+static void TestARGBToYUVTiles(int width,
+                               int height,
+                               int tile_size,
+                               int nv12,
+                               int benchmark_iterations) {
+  const int kHalfWidth = (width + 1) / 2;
+  const int kHalfHeight = (height + 1) / 2;
+  const int kTilesX = (width + tile_size - 1) / tile_size;
+  const int kTilesY = (height + tile_size - 1) / tile_size;
+  const int kBitmapStride = (kTilesX + 7) / 8;
+  const int kSizeUV = kHalfWidth * 2 * kHalfHeight;
+  align_buffer_page_end(prev_argb, width * height * 4);
+  align_buffer_page_end(src_argb, width * height * 4);
+  align_buffer_page_end(dst_y, width * height);
+  align_buffer_page_end(dst_uv, kSizeUV);
+  align_buffer_page_end(ref_y, width * height);
+  align_buffer_page_end(ref_uv, kSizeUV);
+  align_buffer_page_end(dirty, kBitmapStride * kTilesY);
+  MemRandomize(prev_argb, width * height * 4);
+  memcpy(src_argb, prev_argb, width * height * 4);
+  // Change the first pixel, the last pixel and one in the middle.
+  src_argb[0] ^= 0x40;
+  src_argb[width * height * 4 - 1] ^= 0x40;
+  src_argb[(height / 2 * width + width / 2) * 4 + 1] ^= 0x40;
+
+  if (nv12) {
+    ARGBToNV12(prev_argb, width * 4, dst_y, width, dst_uv, kHalfWidth * 2,
+               width, height);
+    ARGBToNV12(src_argb, width * 4, ref_y, width, ref_uv, kHalfWidth * 2,
+               width, height);
+  } else {
+    ARGBToI420(prev_argb, width * 4, dst_y, width, dst_uv, kHalfWidth,
+               dst_uv + kHalfWidth * kHalfHeight, kHalfWidth, width, height);
+    ARGBToI420(src_argb, width * 4, ref_y, width, ref_uv, kHalfWidth,
+               ref_uv + kHalfWidth * kHalfHeight, kHalfWidth, width, height);
+  }
+  int num_dirty = 0;
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    num_dirty = ARGBDirtyTiles(src_argb, width * 4, prev_argb, width * 4,
+                               dirty, kBitmapStride, width, height, tile_size);
+  }
+  EXPECT_LE(1, num_dirty);
+  EXPECT_GE(3, num_dirty);
+  if (nv12) {
+    EXPECT_EQ(0, ARGBToNV12Tiles(src_argb, width * 4, dst_y, width, dst_uv,
+                                 kHalfWidth * 2, width, height, dirty,
+                                 kBitmapStride, tile_size));
+  } else {
+    EXPECT_EQ(0, ARGBToI420Tiles(src_argb, width * 4, dst_y, width, dst_uv,
+                                 kHalfWidth, dst_uv + kHalfWidth * kHalfHeight,
+                                 kHalfWidth, width, height, dirty,
+                                 kBitmapStride, tile_size));
+  }
+  for (int i = 0; i < width * height; ++i) {
+    EXPECT_EQ(ref_y[i], dst_y[i]);
+  }
+  for (int i = 0; i < kSizeUV; ++i) {
+    EXPECT_EQ(ref_uv[i], dst_uv[i]);
+  }
+
+  free_aligned_buffer_page_end(dirty);
+  free_aligned_buffer_page_end(ref_uv);
+  free_aligned_buffer_page_end(ref_y);
+  free_aligned_buffer_page_end(dst_uv);
+  free_aligned_buffer_page_end(dst_y);
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(prev_argb);
+}
+
+TEST_F(LibYUVConvertTest, ARGBToI420Tiles_Opt) {
+  TestARGBToYUVTiles(benchmark_width_, benchmark_height_, 32, 0,
+                     benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, ARGBToI420Tiles_Any) {
+  TestARGBToYUVTiles(benchmark_width_ + 7, benchmark_height_ + 5, 16, 0, 1);
+}
+
+TEST_F(LibYUVConvertTest, ARGBToNV12Tiles_Opt) {
+  TestARGBToYUVTiles(benchmark_width_, benchmark_height_, 64, 1,
+                     benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, ARGBToNV12Tiles_Any) {
+  TestARGBToYUVTiles(benchmark_width_ + 7, benchmark_height_ + 5, 32, 1, 1);
+}
+
+// Tone mapped conversions must match between C and SIMD.
+static void TestP010ToARGBToneMapped(int width,
+                                     int height,
+                                     enum ToneMapTransfer transfer,
+                                     int disable_cpu_flags,
+                                     int benchmark_cpu_info,
+                                     int benchmark_iterations) {
+  const int kStrideUV = ((width + 1) / 2) * 2;
+  const int kHeightUV = (height + 1) / 2;
+  struct ToneMapConstants tonemap;
+  EXPECT_EQ(0, InitToneMapConstants(&tonemap, transfer, 1000, 203));
+  align_buffer_page_end(src_y, width * height * 2);
+  align_buffer_page_end(src_uv, kStrideUV * kHeightUV * 2);
+  align_buffer_page_end(dst_argb_c, width * height * 4);
+  align_buffer_page_end(dst_argb_opt, width * height * 4);
+  uint16_t* src_y16 = reinterpret_cast<uint16_t*>(src_y);
+  uint16_t* src_uv16 = reinterpret_cast<uint16_t*>(src_uv);
+  for (int i = 0; i < width * height; ++i) {
+    src_y16[i] = (fastrand() & 1023) << 6;
+  }
+  for (int i = 0; i < kStrideUV * kHeightUV; ++i) {
+    src_uv16[i] = (fastrand() & 1023) << 6;
+  }
+  memset(dst_argb_c, 1, width * height * 4);
+  memset(dst_argb_opt, 2, width * height * 4);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, P010ToARGBToneMapped(src_y16, width, src_uv16, kStrideUV,
+                                    dst_argb_c, width * 4, &tonemap, width,
+                                    height));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    P010ToARGBToneMapped(src_y16, width, src_uv16, kStrideUV, dst_argb_opt,
+                         width * 4, &tonemap, width, height);
+  }
+  for (int i = 0; i < width * height * 4; ++i) {
+    EXPECT_EQ(dst_argb_c[i], dst_argb_opt[i]);
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_uv);
+  free_aligned_buffer_page_end(dst_argb_c);
+  free_aligned_buffer_page_end(dst_argb_opt);
+}
+
+TEST_F(LibYUVConvertTest, P010ToARGBToneMapped_Opt) {
+  TestP010ToARGBToneMapped(benchmark_width_, benchmark_height_, kToneMapPQ,
+                           disable_cpu_flags_, benchmark_cpu_info_,
+                           benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, P010ToARGBToneMapped_Any) {
+  TestP010ToARGBToneMapped(benchmark_width_ + 3, benchmark_height_ + 1,
+                           kToneMapHLG, disable_cpu_flags_,
+                           benchmark_cpu_info_, 1);
+}
+
+static void TestI010ToNV12ToneMapped(int width,
+                                     int height,
+                                     int disable_cpu_flags,
+                                     int benchmark_cpu_info,
+                                     int benchmark_iterations) {
+  const int kWidthUV = (width + 1) / 2;
+  const int kHeightUV = (height + 1) / 2;
+  const int kSizeUV = kWidthUV * 2 * kHeightUV;
+  struct ToneMapConstants tonemap;
+  EXPECT_EQ(0, InitToneMapConstants(&tonemap, kToneMapPQ, 4000, 100));
+  align_buffer_page_end(src_y, width * height * 2);
+  align_buffer_page_end(src_u, kWidthUV * kHeightUV * 2);
+  align_buffer_page_end(src_v, kWidthUV * kHeightUV * 2);
+  align_buffer_page_end(dst_y_c, width * height);
+  align_buffer_page_end(dst_uv_c, kSizeUV);
+  align_buffer_page_end(dst_y_opt, width * height);
+  align_buffer_page_end(dst_uv_opt, kSizeUV);
+  uint16_t* src_y16 = reinterpret_cast<uint16_t*>(src_y);
+  uint16_t* src_u16 = reinterpret_cast<uint16_t*>(src_u);
+  uint16_t* src_v16 = reinterpret_cast<uint16_t*>(src_v);
+  for (int i = 0; i < width * height; ++i) {
+    src_y16[i] = fastrand() & 1023;
+  }
+  for (int i = 0; i < kWidthUV * kHeightUV; ++i) {
+    src_u16[i] = fastrand() & 1023;
+    src_v16[i] = fastrand() & 1023;
+  }
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, I010ToNV12ToneMapped(src_y16, width, src_u16, kWidthUV,
+                                    src_v16, kWidthUV, dst_y_c, width,
+                                    dst_uv_c, kWidthUV * 2, &tonemap, width,
+                                    height));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    I010ToNV12ToneMapped(src_y16, width, src_u16, kWidthUV, src_v16,
+                         kWidthUV, dst_y_opt, width, dst_uv_opt, kWidthUV * 2,
+                         &tonemap, width, height);
+  }
+  for (int i = 0; i < width * height; ++i) {
+    EXPECT_EQ(dst_y_c[i], dst_y_opt[i]);
+  }
+  for (int i = 0; i < kSizeUV; ++i) {
+    EXPECT_EQ(dst_uv_c[i], dst_uv_opt[i]);
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(dst_y_c);
+  free_aligned_buffer_page_end(dst_uv_c);
+  free_aligned_buffer_page_end(dst_y_opt);
+  free_aligned_buffer_page_end(dst_uv_opt);
+}
+
+TEST_F(LibYUVConvertTest, I010ToNV12ToneMapped_Opt) {
+  TestI010ToNV12ToneMapped(benchmark_width_, benchmark_height_,
+                           disable_cpu_flags_, benchmark_cpu_info_,
+                           benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, I010ToNV12ToneMapped_Any) {
+  TestI010ToNV12ToneMapped(benchmark_width_ + 3, benchmark_height_ + 1,
+                           disable_cpu_flags_, benchmark_cpu_info_, 1);
+}
+
+TEST_F(LibYUVConvertTest, InitToneMapConstants) {
+  struct ToneMapConstants tonemap;
+  EXPECT_EQ(-1, InitToneMapConstants(NULL, kToneMapPQ, 1000, 203));
+  EXPECT_EQ(-1, InitToneMapConstants(&tonemap, kToneMapPQ, 0, 203));
+  EXPECT_EQ(-1, InitToneMapConstants(&tonemap, kToneMapPQ, 1000, 0));
+  EXPECT_EQ(0, InitToneMapConstants(&tonemap, kToneMapPQ, 1000, 203));
+
+  // Black stays black and 10000 nits clips to the 1000 nit peak.
+  EXPECT_EQ(0u, tonemap.kEotf[0]);
+  EXPECT_EQ(65535u, tonemap.kEotf[1023]);
+  EXPECT_EQ(0, tonemap.kOetf[0]);
+  EXPECT_EQ(255, tonemap.kOetf[16383]);
+  for (int i = 1; i < 1024; ++i) {
+    EXPECT_LE(tonemap.kEotf[i - 1], tonemap.kEotf[i]);
+  }
+  for (int i = 1; i < 16384; ++i) {
+    EXPECT_LE(tonemap.kOetf[i - 1], tonemap.kOetf[i]);
+  }
+
+  // PQ 203 nits is R'G'B' code 592, which is limited range Y' 571. It is
+  // above the knee so lands a little below SDR white.
+  uint16_t src_y[4] = {571 << 6, 571 << 6, 571 << 6, 571 << 6};
+  uint16_t src_uv[2] = {512 << 6, 512 << 6};
+  uint8_t argb[16];
+  EXPECT_EQ(0, P010ToARGBToneMapped(src_y, 2, src_uv, 2, argb, 8, &tonemap, 2,
+                                    2));
+  EXPECT_NEAR(argb[0], argb[1], 1);
+  EXPECT_NEAR(argb[1], argb[2], 1);
+  EXPECT_GT(argb[1], 220);
+  EXPECT_LT(argb[1], 255);
+  EXPECT_EQ(255, argb[3]);
+}
+
+TEST_F(LibYUVConvertTest, GetYuvConstants) {
+  const struct YuvConstants* yuvconstants = NULL;
+  const struct YuvConstants* yvuconstants = NULL;
+  const struct YuvConstants* again = NULL;
+  EXPECT_EQ(-1, GetYuvConstants(&yuvconstants, NULL, 0.f, 0.0593f, 8, 16,
+                                235, 16, 240));
+  EXPECT_EQ(-1, GetYuvConstants(&yuvconstants, NULL, 0.6f, 0.5f, 8, 16, 235,
+                                16, 240));
+  EXPECT_EQ(-1, GetYuvConstants(&yuvconstants, NULL, 0.2627f, 0.0593f, 7, 16,
+                                235, 16, 240));
+  EXPECT_EQ(-1, GetYuvConstants(&yuvconstants, NULL, 0.2627f, 0.0593f, 8, 16,
+                                16, 16, 240));
+  EXPECT_EQ(-1, GetYuvConstants(&yuvconstants, NULL, 0.2627f, 0.0593f, 8, 0,
+                                256, 16, 240));
+  // Too narrow a luma range overflows the 16 bit Y scale.
+  EXPECT_EQ(-1, GetYuvConstants(&yuvconstants, NULL, 0.2627f, 0.0593f, 8, 64,
+                                160, 16, 240));
+
+  EXPECT_EQ(0, GetYuvConstants(&yuvconstants, &yvuconstants, 0.2627f, 0.0593f,
+                               10, 64, 940, 64, 960));
+  EXPECT_EQ(0, GetYuvConstants(&again, NULL, 0.2627f, 0.0593f, 10, 64, 940,
+                               64, 960));
+  EXPECT_EQ(yuvconstants, again);
+  EXPECT_NE(yuvconstants, yvuconstants);
+
+  // BT.2020 tables are derived from the exact matrix, so building them
+  // reproduces kYuv2020Constants and kYuvV2020Constants.
+  const int kWidth = 64;
+  const int kHeight = 4;
+  align_buffer_page_end(src_y, kWidth * kHeight);
+  align_buffer_page_end(src_u, kWidth / 2 * kHeight / 2);
+  align_buffer_page_end(src_v, kWidth / 2 * kHeight / 2);
+  align_buffer_page_end(dst_argb_fixed, kWidth * 4 * kHeight);
+  align_buffer_page_end(dst_argb_built, kWidth * 4 * kHeight);
+  MemRandomize(src_y, kWidth * kHeight);
+  MemRandomize(src_u, kWidth / 2 * kHeight / 2);
+  MemRandomize(src_v, kWidth / 2 * kHeight / 2);
+
+  EXPECT_EQ(0, GetYuvConstants(&yuvconstants, &yvuconstants, 0.2627f, 0.0593f,
+                               8, 16, 235, 16, 240));
+  I420ToARGBMatrix(src_y, kWidth, src_u, kWidth / 2, src_v, kWidth / 2,
+                   dst_argb_fixed, kWidth * 4, &kYuv2020Constants, kWidth,
+                   kHeight);
+  I420ToARGBMatrix(src_y, kWidth, src_u, kWidth / 2, src_v, kWidth / 2,
+                   dst_argb_built, kWidth * 4, yuvconstants, kWidth, kHeight);
+  for (int i = 0; i < kWidth * 4 * kHeight; ++i) {
+    EXPECT_EQ(dst_argb_fixed[i], dst_argb_built[i]);
+  }
+  I420ToARGBMatrix(src_y, kWidth, src_v, kWidth / 2, src_u, kWidth / 2,
+                   dst_argb_fixed, kWidth * 4, &kYvu2020Constants, kWidth,
+                   kHeight);
+  I420ToARGBMatrix(src_y, kWidth, src_v, kWidth / 2, src_u, kWidth / 2,
+                   dst_argb_built, kWidth * 4, yvuconstants, kWidth, kHeight);
+  for (int i = 0; i < kWidth * 4 * kHeight; ++i) {
+    EXPECT_EQ(dst_argb_fixed[i], dst_argb_built[i]);
+  }
+
+  EXPECT_EQ(0, GetYuvConstants(&yuvconstants, NULL, 0.2627f, 0.0593f, 8, 0,
+                               255, 0, 255));
+  I420ToARGBMatrix(src_y, kWidth, src_u, kWidth / 2, src_v, kWidth / 2,
+                   dst_argb_fixed, kWidth * 4, &kYuvV2020Constants, kWidth,
+                   kHeight);
+  I420ToARGBMatrix(src_y, kWidth, src_u, kWidth / 2, src_v, kWidth / 2,
+                   dst_argb_built, kWidth * 4, yuvconstants, kWidth, kHeight);
+  for (int i = 0; i < kWidth * 4 * kHeight; ++i) {
+    EXPECT_EQ(dst_argb_fixed[i], dst_argb_built[i]);
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(dst_argb_fixed);
+  free_aligned_buffer_page_end(dst_argb_built);
+}
+
+// SMPTE 240M full range, which has no fixed table, against a float reference.
+TEST_F(LibYUVConvertTest, I444ToARGBMatrixCustom) {
+  const float kKr = 0.212f;
+  const float kKb = 0.087f;
+  const struct YuvConstants* yuvconstants = NULL;
+  EXPECT_EQ(0, GetYuvConstants(&yuvconstants, NULL, kKr, kKb, 8, 0, 255, 0,
+                               255));
+  const int kWidth = 256;
+  align_buffer_page_end(src_y, kWidth);
+  align_buffer_page_end(src_u, kWidth);
+  align_buffer_page_end(src_v, kWidth);
+  align_buffer_page_end(dst_argb, kWidth * 4);
+  MemRandomize(src_y, kWidth);
+  MemRandomize(src_u, kWidth);
+  MemRandomize(src_v, kWidth);
+  I444ToARGBMatrix(src_y, kWidth, src_u, kWidth, src_v, kWidth, dst_argb,
+                   kWidth * 4, yuvconstants, kWidth, 1);
+  const double kKg = 1.0 - kKr - kKb;
+  for (int i = 0; i < kWidth; ++i) {
+    double y = src_y[i];
+    double u = src_u[i] - 128.0;
+    double v = src_v[i] - 128.0;
+    double r = y + 2.0 * (1.0 - kKr) * v;
+    double g = y - 2.0 * (1.0 - kKb) * kKb / kKg * u -
+               2.0 * (1.0 - kKr) * kKr / kKg * v;
+    double b = y + 2.0 * (1.0 - kKb) * u;
+    r = r < 0.0 ? 0.0 : (r > 255.0 ? 255.0 : r);
+    g = g < 0.0 ? 0.0 : (g > 255.0 ? 255.0 : g);
+    b = b < 0.0 ? 0.0 : (b > 255.0 ? 255.0 : b);
+    EXPECT_NEAR(b, dst_argb[i * 4 + 0], 2.5);
+    EXPECT_NEAR(g, dst_argb[i * 4 + 1], 2.5);
+    EXPECT_NEAR(r, dst_argb[i * 4 + 2], 2.5);
+    EXPECT_EQ(255, dst_argb[i * 4 + 3]);
+  }
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(dst_argb);
+}
+
+// Built matrices run through the SIMD rows; they must match the C rows.
+static void TestI010ToARGBMatrixCustom(int width,
+                                       int height,
+                                       int disable_cpu_flags,
+                                       int benchmark_cpu_info,
+                                       int benchmark_iterations) {
+  const int kWidthUV = (width + 1) / 2;
+  const int kHeightUV = (height + 1) / 2;
+  const struct YuvConstants* yuvconstants = NULL;
+  // SMPTE 240M limited range 10 bit.
+  EXPECT_EQ(0, GetYuvConstants(&yuvconstants, NULL, 0.212f, 0.087f, 10, 64,
+                               940, 64, 960));
+  align_buffer_page_end(src_y, width * height * 2);
+  align_buffer_page_end(src_u, kWidthUV * kHeightUV * 2);
+  align_buffer_page_end(src_v, kWidthUV * kHeightUV * 2);
+  align_buffer_page_end(dst_argb_c, width * 4 * height);
+  align_buffer_page_end(dst_argb_opt, width * 4 * height);
+  uint16_t* src_y16 = reinterpret_cast<uint16_t*>(src_y);
+  uint16_t* src_u16 = reinterpret_cast<uint16_t*>(src_u);
+  uint16_t* src_v16 = reinterpret_cast<uint16_t*>(src_v);
+  for (int i = 0; i < width * height; ++i) {
+    src_y16[i] = fastrand() & 1023;
+  }
+  for (int i = 0; i < kWidthUV * kHeightUV; ++i) {
+    src_u16[i] = fastrand() & 1023;
+    src_v16[i] = fastrand() & 1023;
+  }
+  memset(dst_argb_c, 1, width * 4 * height);
+  memset(dst_argb_opt, 101, width * 4 * height);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, I010ToARGBMatrix(src_y16, width, src_u16, kWidthUV, src_v16,
+                                kWidthUV, dst_argb_c, width * 4, yuvconstants,
+                                width, height));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    I010ToARGBMatrix(src_y16, width, src_u16, kWidthUV, src_v16, kWidthUV,
+                     dst_argb_opt, width * 4, yuvconstants, width, height);
+  }
+  for (int i = 0; i < width * 4 * height; ++i) {
+    EXPECT_EQ(dst_argb_c[i], dst_argb_opt[i]);
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(dst_argb_c);
+  free_aligned_buffer_page_end(dst_argb_opt);
+}
+
+TEST_F(LibYUVConvertTest, I010ToARGBMatrixCustom_Opt) {
+  TestI010ToARGBMatrixCustom(benchmark_width_, benchmark_height_,
+                             disable_cpu_flags_, benchmark_cpu_info_,
+                             benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, I010ToARGBMatrixCustom_Any) {
+  TestI010ToARGBMatrixCustom(benchmark_width_ + 3, benchmark_height_ + 1,
+                             disable_cpu_flags_, benchmark_cpu_info_, 1);
+}
+
+// Fills an I210 or I410 frame with random 10 bit samples.
+static void FillRandom10(uint16_t* dst, int count) {
+  for (int i = 0; i < count; ++i) {
+    dst[i] = fastrand() & 1023;
+  }
+}
+
+// v210 packs losslessly, so I210 -> v210 -> I210 must be exact for both the
+// C and SIMD unpackers.  Rows use the usual 128 byte alignment.
+static void TestV210RoundTrip(int width,
+                              int height,
+                              int disable_cpu_flags,
+                              int benchmark_cpu_info,
+                              int benchmark_iterations) {
+  const int kWidthUV = (width + 1) / 2;
+  const int kStrideV210 = (width + 47) / 48 * 128;
+  align_buffer_page_end(src_i210, (width + kWidthUV * 2) * height * 2);
+  align_buffer_page_end(dst_v210, kStrideV210 * height);
+  align_buffer_page_end(dst_i210_c, (width + kWidthUV * 2) * height * 2);
+  align_buffer_page_end(dst_i210_opt, (width + kWidthUV * 2) * height * 2);
+  align_buffer_page_end(dst_p210_c, (width + kWidthUV * 2) * height * 2);
+  align_buffer_page_end(dst_p210_opt, (width + kWidthUV * 2) * height * 2);
+  uint16_t* src_y = reinterpret_cast<uint16_t*>(src_i210);
+  uint16_t* src_u = src_y + width * height;
+  uint16_t* src_v = src_u + kWidthUV * height;
+  uint16_t* dst_y_c = reinterpret_cast<uint16_t*>(dst_i210_c);
+  uint16_t* dst_y_opt = reinterpret_cast<uint16_t*>(dst_i210_opt);
+  uint16_t* dst_p210_y_c = reinterpret_cast<uint16_t*>(dst_p210_c);
+  uint16_t* dst_p210_y_opt = reinterpret_cast<uint16_t*>(dst_p210_opt);
+  FillRandom10(src_y, (width + kWidthUV * 2) * height);
+  memset(dst_v210, 0, kStrideV210 * height);
+  memset(dst_i210_c, 1, (width + kWidthUV * 2) * height * 2);
+  memset(dst_i210_opt, 101, (width + kWidthUV * 2) * height * 2);
+
+  EXPECT_EQ(0, I210ToV210(src_y, width, src_u, kWidthUV, src_v, kWidthUV,
+                          dst_v210, kStrideV210, width, height));
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, V210ToI210(dst_v210, kStrideV210, dst_y_c, width,
+                          dst_y_c + width * height, kWidthUV,
+                          dst_y_c + (width + kWidthUV) * height, kWidthUV,
+                          width, height));
+  EXPECT_EQ(0, V210ToP210(dst_v210, kStrideV210, dst_p210_y_c, width,
+                          dst_p210_y_c + width * height, kWidthUV * 2, width,
+                          height));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    V210ToI210(dst_v210, kStrideV210, dst_y_opt, width,
+               dst_y_opt + width * height, kWidthUV,
+               dst_y_opt + (width + kWidthUV) * height, kWidthUV, width,
+               height);
+  }
+  EXPECT_EQ(0, V210ToP210(dst_v210, kStrideV210, dst_p210_y_opt, width,
+                          dst_p210_y_opt + width * height, kWidthUV * 2, width,
+                          height));
+  for (int i = 0; i < (width + kWidthUV * 2) * height; ++i) {
+    EXPECT_EQ(src_y[i], dst_y_c[i]);
+    EXPECT_EQ(src_y[i], dst_y_opt[i]);
+  }
+  // P210 holds the same samples in the msbs with UV interleaved.
+  for (int i = 0; i < width * height; ++i) {
+    EXPECT_EQ(src_y[i] << 6, dst_p210_y_c[i]);
+  }
+  for (int i = 0; i < kWidthUV * height; ++i) {
+    EXPECT_EQ(src_u[i] << 6, dst_p210_y_c[width * height + i * 2]);
+    EXPECT_EQ(src_v[i] << 6, dst_p210_y_c[width * height + i * 2 + 1]);
+  }
+  for (int i = 0; i < (width + kWidthUV * 2) * height; ++i) {
+    EXPECT_EQ(dst_p210_y_c[i], dst_p210_y_opt[i]);
+  }
+
+  free_aligned_buffer_page_end(src_i210);
+  free_aligned_buffer_page_end(dst_v210);
+  free_aligned_buffer_page_end(dst_i210_c);
+  free_aligned_buffer_page_end(dst_i210_opt);
+  free_aligned_buffer_page_end(dst_p210_c);
+  free_aligned_buffer_page_end(dst_p210_opt);
+}
+
+TEST_F(LibYUVConvertTest, V210RoundTrip_Opt) {
+  TestV210RoundTrip(benchmark_width_, benchmark_height_, disable_cpu_flags_,
+                    benchmark_cpu_info_, benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, V210RoundTrip_Any) {
+  TestV210RoundTrip(benchmark_width_ + 5, benchmark_height_ + 1,
+                    disable_cpu_flags_, benchmark_cpu_info_, 1);
+}
+
+// Y210 and Y410 are lossless for 10 bit samples too; also checks the packers
+// match their C versions.
+static void TestY210RoundTrip(int width,
+                              int height,
+                              int disable_cpu_flags,
+                              int benchmark_cpu_info,
+                              int benchmark_iterations) {
+  const int kWidthUV = (width + 1) / 2;
+  const int kSize = (width + kWidthUV * 2) * height;
+  align_buffer_page_end(src_i210, kSize * 2);
+  align_buffer_page_end(dst_y210_c, kWidthUV * 4 * height * 2);
+  align_buffer_page_end(dst_y210_opt, kWidthUV * 4 * height * 2);
+  align_buffer_page_end(dst_i210, kSize * 2);
+  uint16_t* src_y = reinterpret_cast<uint16_t*>(src_i210);
+  uint16_t* src_u = src_y + width * height;
+  uint16_t* src_v = src_u + kWidthUV * height;
+  uint16_t* y210_c = reinterpret_cast<uint16_t*>(dst_y210_c);
+  uint16_t* y210_opt = reinterpret_cast<uint16_t*>(dst_y210_opt);
+  uint16_t* dst_y = reinterpret_cast<uint16_t*>(dst_i210);
+  FillRandom10(src_y, kSize);
+  memset(dst_y210_c, 1, kWidthUV * 4 * height * 2);
+  memset(dst_y210_opt, 101, kWidthUV * 4 * height * 2);
+  memset(dst_i210, 0, kSize * 2);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, I210ToY210(src_y, width, src_u, kWidthUV, src_v, kWidthUV,
+                          y210_c, kWidthUV * 4, width, height));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    I210ToY210(src_y, width, src_u, kWidthUV, src_v, kWidthUV, y210_opt,
+               kWidthUV * 4, width, height);
+  }
+  EXPECT_EQ(0, Y210ToI210(y210_opt, kWidthUV * 4, dst_y, width,
+                          dst_y + width * height, kWidthUV,
+                          dst_y + (width + kWidthUV) * height, kWidthUV, width,
+                          height));
+  for (int y = 0; y < height; ++y) {
+    // An odd width leaves the last Y of each row unspecified.
+    for (int x = 0; x < width * 2; ++x) {
+      EXPECT_EQ(y210_c[y * kWidthUV * 4 + x], y210_opt[y * kWidthUV * 4 + x]);
+    }
+  }
+  for (int i = 0; i < kSize; ++i) {
+    EXPECT_EQ(src_y[i], dst_y[i]);
+  }
+
+  free_aligned_buffer_page_end(src_i210);
+  free_aligned_buffer_page_end(dst_y210_c);
+  free_aligned_buffer_page_end(dst_y210_opt);
+  free_aligned_buffer_page_end(dst_i210);
+}
+
+TEST_F(LibYUVConvertTest, Y210RoundTrip_Opt) {
+  TestY210RoundTrip(benchmark_width_, benchmark_height_, disable_cpu_flags_,
+                    benchmark_cpu_info_, benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, Y210RoundTrip_Any) {
+  TestY210RoundTrip(benchmark_width_ + 3, benchmark_height_ + 1,
+                    disable_cpu_flags_, benchmark_cpu_info_, 1);
+}
+
+static void TestY410RoundTrip(int width,
+                              int height,
+                              int disable_cpu_flags,
+                              int benchmark_cpu_info,
+                              int benchmark_iterations) {
+  const int kSize = width * height;
+  align_buffer_page_end(src_i410, kSize * 3 * 2);
+  align_buffer_page_end(dst_y410_c, kSize * 4);
+  align_buffer_page_end(dst_y410_opt, kSize * 4);
+  align_buffer_page_end(dst_i410_c, kSize * 3 * 2);
+  align_buffer_page_end(dst_i410_opt, kSize * 3 * 2);
+  uint16_t* src_y = reinterpret_cast<uint16_t*>(src_i410);
+  uint16_t* dst_y_c = reinterpret_cast<uint16_t*>(dst_i410_c);
+  uint16_t* dst_y_opt = reinterpret_cast<uint16_t*>(dst_i410_opt);
+  FillRandom10(src_y, kSize * 3);
+  memset(dst_y410_c, 1, kSize * 4);
+  memset(dst_y410_opt, 101, kSize * 4);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, I410ToY410(src_y, width, src_y + kSize, width,
+                          src_y + kSize * 2, width, dst_y410_c, width * 4,
+                          width, height));
+  EXPECT_EQ(0, Y410ToI410(dst_y410_c, width * 4, dst_y_c, width,
+                          dst_y_c + kSize, width, dst_y_c + kSize * 2, width,
+                          width, height));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    I410ToY410(src_y, width, src_y + kSize, width, src_y + kSize * 2, width,
+               dst_y410_opt, width * 4, width, height);
+  }
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    Y410ToI410(dst_y410_opt, width * 4, dst_y_opt, width, dst_y_opt + kSize,
+               width, dst_y_opt + kSize * 2, width, width, height);
+  }
+  for (int i = 0; i < kSize * 4; ++i) {
+    EXPECT_EQ(dst_y410_c[i], dst_y410_opt[i]);
+  }
+  for (int i = 0; i < kSize * 3; ++i) {
+    EXPECT_EQ(src_y[i], dst_y_c[i]);
+    EXPECT_EQ(src_y[i], dst_y_opt[i]);
+  }
+
+  free_aligned_buffer_page_end(src_i410);
+  free_aligned_buffer_page_end(dst_y410_c);
+  free_aligned_buffer_page_end(dst_y410_opt);
+  free_aligned_buffer_page_end(dst_i410_c);
+  free_aligned_buffer_page_end(dst_i410_opt);
+}
+
+TEST_F(LibYUVConvertTest, Y410RoundTrip_Opt) {
+  TestY410RoundTrip(benchmark_width_, benchmark_height_, disable_cpu_flags_,
+                    benchmark_cpu_info_, benchmark_iterations_);
+}
+
+TEST_F(LibYUVConvertTest, Y410RoundTrip_Any) {
+  TestY410RoundTrip(benchmark_width_ + 3, benchmark_height_ + 1,
+                    disable_cpu_flags_, benchmark_cpu_info_, 1);
+}
+
+// ConvertToI420 of cropped v210 matches I210ToI420 of the same crop.
+TEST_F(LibYUVConvertTest, V210ConvertToI420Crop) {
+  const int kWidth = 100;
+  const int kHeight = 10;
+  const int kCropX = 8;
+  const int kCropY = 2;
+  const int kCropWidth = 64;
+  const int kCropHeight = 6;
+  const int kWidthUV = (kWidth + 1) / 2;
+  const int kStrideV210 = (kWidth + 47) / 48 * 128;
+  align_buffer_page_end(src_i210, (kWidth + kWidthUV * 2) * kHeight * 2);
+  align_buffer_page_end(src_v210, kStrideV210 * kHeight);
+  align_buffer_page_end(dst_i420_c, kCropWidth * kCropHeight * 2);
+  align_buffer_page_end(dst_i420_opt, kCropWidth * kCropHeight * 2);
+  uint16_t* src_y = reinterpret_cast<uint16_t*>(src_i210);
+  uint16_t* src_u = src_y + kWidth * kHeight;
+  uint16_t* src_v = src_u + kWidthUV * kHeight;
+  uint8_t* dst_u_c = dst_i420_c + kCropWidth * kCropHeight;
+  uint8_t* dst_v_c = dst_u_c + kCropWidth / 2 * kCropHeight / 2;
+  uint8_t* dst_u_opt = dst_i420_opt + kCropWidth * kCropHeight;
+  uint8_t* dst_v_opt = dst_u_opt + kCropWidth / 2 * kCropHeight / 2;
+  FillRandom10(src_y, (kWidth + kWidthUV * 2) * kHeight);
+  memset(src_v210, 0, kStrideV210 * kHeight);
+  memset(dst_i420_c, 1, kCropWidth * kCropHeight * 2);
+  memset(dst_i420_opt, 101, kCropWidth * kCropHeight * 2);
+
+  EXPECT_EQ(0, I210ToV210(src_y, kWidth, src_u, kWidthUV, src_v, kWidthUV,
+                          src_v210, kStrideV210, kWidth, kHeight));
+  EXPECT_EQ(0, I210ToI420(src_y + kCropY * kWidth + kCropX, kWidth,
+                          src_u + kCropY * kWidthUV + kCropX / 2, kWidthUV,
+                          src_v + kCropY * kWidthUV + kCropX / 2, kWidthUV,
+                          dst_i420_c, kCropWidth, dst_u_c, kCropWidth / 2,
+                          dst_v_c, kCropWidth / 2, kCropWidth, kCropHeight));
+  EXPECT_EQ(0, ConvertToI420(src_v210, kStrideV210 * kHeight, dst_i420_opt,
+                             kCropWidth, dst_u_opt, kCropWidth / 2, dst_v_opt,
+                             kCropWidth / 2, kCropX, kCropY, kWidth, kHeight,
+                             kCropWidth, kCropHeight, kRotate0, FOURCC_V210));
+  for (int i = 0; i < kCropWidth * kCropHeight * 3 / 2; ++i) {
+    EXPECT_EQ(dst_i420_c[i], dst_i420_opt[i]);
+  }
+  // Odd crop would split a chroma pair.
+  EXPECT_EQ(-1, ConvertToI420(src_v210, kStrideV210 * kHeight, dst_i420_opt,
+                              kCropWidth, dst_u_opt, kCropWidth / 2, dst_v_opt,
+                              kCropWidth / 2, kCropX + 1, kCropY, kWidth,
+                              kHeight, kCropWidth, kCropHeight, kRotate0,
+                              FOURCC_V210));
+
+  free_aligned_buffer_page_end(src_i210);
+  free_aligned_buffer_page_end(src_v210);
+  free_aligned_buffer_page_end(dst_i420_c);
+  free_aligned_buffer_page_end(dst_i420_opt);
+}
+
+// Reads a Bayer sample, mirroring coordinates outside the image.  A 1 pixel
+// wide or high image repeats its only sample.
+static int BayerSample(const uint8_t* src, int width, int height, int x, int y) {
+  x = x < 0 ? -x : (x >= width ? 2 * width - 2 - x : x);
+  y = y < 0 ? -y : (y >= height ? 2 * height - 2 - y : y);
+  x = width > 1 ? x : 0;
+  y = height > 1 ? y : 0;
+  return src[y * width + x];
+}
+
+#define BAVG(a, b) (((a) + (b) + 1) >> 1)
+
+// Straightforward bilinear demosaic used to check the row functions.
+static void BayerToARGBReference(const uint8_t* src,
+                                 uint8_t* dst_argb,
+                                 int width,
+                                 int height,
+                                 const char* pattern) {
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const char site = pattern[(y & 1) * 2 + (x & 1)];
+      const char horz = pattern[(y & 1) * 2 + ((x + 1) & 1)];
+      const int c = BayerSample(src, width, height, x, y);
+      const int h = BAVG(BayerSample(src, width, height, x - 1, y),
+                         BayerSample(src, width, height, x + 1, y));
+      const int v = BAVG(BayerSample(src, width, height, x, y - 1),
+                         BayerSample(src, width, height, x, y + 1));
+      const int d = BAVG(BAVG(BayerSample(src, width, height, x - 1, y - 1),
+                              BayerSample(src, width, height, x + 1, y - 1)),
+                         BAVG(BayerSample(src, width, height, x - 1, y + 1),
+                              BayerSample(src, width, height, x + 1, y + 1)));
+      uint8_t* argb = dst_argb + (y * width + x) * 4;
+      for (int ch = 0; ch < 3; ++ch) {
+        const char color = "BGR"[ch];
+        int value;
+        if (site == color) {
+          value = c;
+        } else if (color == 'G') {
+          value = BAVG(h, v);
+        } else if (site == 'G') {
+          value = horz == color ? h : v;
+        } else {
+          value = d;
+        }
+        argb[ch] = value;
+      }
+      argb[3] = 255;
+    }
+  }
+}
+
+#undef BAVG
+
+static void TestBayerToARGB(uint32_t fourcc,
+                            const char* pattern,
+                            int width,
+                            int height,
+                            int disable_cpu_flags,
+                            int benchmark_cpu_info,
+                            int benchmark_iterations) {
+  align_buffer_page_end(src_bayer, width * height);
+  align_buffer_page_end(src_bayer_16, width * height * 2);
+  align_buffer_page_end(dst_argb_ref, width * 4 * height);
+  align_buffer_page_end(dst_argb_c, width * 4 * height);
+  align_buffer_page_end(dst_argb_opt, width * 4 * height);
+  align_buffer_page_end(dst_argb_16, width * 4 * height);
+  uint16_t* src_16 = reinterpret_cast<uint16_t*>(src_bayer_16);
+  for (int i = 0; i < width * height; ++i) {
+    src_bayer[i] = fastrand() & 0xff;
+    src_16[i] = (src_bayer[i] << 2) | (fastrand() & 3);  // 10 bit.
+  }
+  memset(dst_argb_c, 1, width * 4 * height);
+  memset(dst_argb_opt, 101, width * 4 * height);
+  BayerToARGBReference(src_bayer, dst_argb_ref, width, height, pattern);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, BayerToARGB(src_bayer, width, dst_argb_c, width * 4, width,
+                           height, fourcc));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    BayerToARGB(src_bayer, width, dst_argb_opt, width * 4, width, height,
+                fourcc);
+  }
+  EXPECT_EQ(0, Bayer16ToARGB(src_16, width, dst_argb_16, width * 4, width,
+                             height, 10, fourcc));
+  for (int i = 0; i < width * 4 * height; ++i) {
+    EXPECT_EQ(dst_argb_ref[i], dst_argb_c[i]);
+    EXPECT_EQ(dst_argb_ref[i], dst_argb_opt[i]);
+    EXPECT_EQ(dst_argb_ref[i], dst_argb_16[i]);
+  }
+
+  free_aligned_buffer_page_end(src_bayer);
+  free_aligned_buffer_page_end(src_bayer_16);
+  free_aligned_buffer_page_end(dst_argb_ref);
+  free_aligned_buffer_page_end(dst_argb_c);
+  free_aligned_buffer_page_end(dst_argb_opt);
+  free_aligned_buffer_page_end(dst_argb_16);
+}
+
+// I420 and NV12 from Bayer must match demosaic to ARGB then ARGBToI420.
+static void TestBayerToI420(uint32_t fourcc,
+                            int width,
+                            int height,
+                            int disable_cpu_flags,
+                            int benchmark_cpu_info,
+                            int benchmark_iterations) {
+  const int kWidthUV = (width + 1) / 2;
+  const int kHeightUV = (height + 1) / 2;
+  const int kSize = width * height + kWidthUV * kHeightUV * 2;
+  align_buffer_page_end(src_bayer, width * height);
+  align_buffer_page_end(src_bayer_16, width * height * 2);
+  align_buffer_page_end(dst_argb, width * 4 * height);
+  align_buffer_page_end(dst_i420_ref, kSize);
+  align_buffer_page_end(dst_i420_c, kSize);
+  align_buffer_page_end(dst_i420_opt, kSize);
+  align_buffer_page_end(dst_nv12_ref, kSize);
+  align_buffer_page_end(dst_nv12_opt, kSize);
+  uint16_t* src_16 = reinterpret_cast<uint16_t*>(src_bayer_16);
+  for (int i = 0; i < width * height; ++i) {
+    src_bayer[i] = fastrand() & 0xff;
+    src_16[i] = (src_bayer[i] << 4) | (fastrand() & 15);  // 12 bit.
+  }
+  memset(dst_i420_c, 1, kSize);
+  memset(dst_i420_opt, 101, kSize);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, BayerToARGB(src_bayer, width, dst_argb, width * 4, width,
+                           height, fourcc));
+  EXPECT_EQ(0, ARGBToI420(dst_argb, width * 4, dst_i420_ref, width,
+                          dst_i420_ref + width * height, kWidthUV,
+                          dst_i420_ref + width * height + kWidthUV * kHeightUV,
+                          kWidthUV, width, height));
+  EXPECT_EQ(0, ARGBToNV12(dst_argb, width * 4, dst_nv12_ref, width,
+                          dst_nv12_ref + width * height, kWidthUV * 2, width,
+                          height));
+  EXPECT_EQ(0, BayerToI420(src_bayer, width, dst_i420_c, width,
+                           dst_i420_c + width * height, kWidthUV,
+                           dst_i420_c + width * height + kWidthUV * kHeightUV,
+                           kWidthUV, width, height, fourcc));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    BayerToI420(src_bayer, width, dst_i420_opt, width,
+                dst_i420_opt + width * height, kWidthUV,
+                dst_i420_opt + width * height + kWidthUV * kHeightUV, kWidthUV,
+                width, height, fourcc);
+  }
+  EXPECT_EQ(0, Bayer16ToNV12(src_16, width, dst_nv12_opt, width,
+                             dst_nv12_opt + width * height, kWidthUV * 2,
+                             width, height, 12, fourcc));
+  for (int i = 0; i < kSize; ++i) {
+    EXPECT_EQ(dst_i420_ref[i], dst_i420_c[i]);
+    EXPECT_NEAR(dst_i420_ref[i], dst_i420_opt[i], 1);
+  }
+  // Opt NV12 against C ARGB based reference; row functions may round Y and
+  // UV differently by 1.
+  for (int i = 0; i < kSize; ++i) {
+    EXPECT_NEAR(dst_nv12_ref[i], dst_nv12_opt[i], 1);
+  }
+
+  free_aligned_buffer_page_end(src_bayer);
+  free_aligned_buffer_page_end(src_bayer_16);
+  free_aligned_buffer_page_end(dst_argb);
+  free_aligned_buffer_page_end(dst_i420_ref);
+  free_aligned_buffer_page_end(dst_i420_c);
+  free_aligned_buffer_page_end(dst_i420_opt);
+  free_aligned_buffer_page_end(dst_nv12_ref);
+  free_aligned_buffer_page_end(dst_nv12_opt);
+}
+
+#define TESTBAYER(FMT)                                                       \
+  TEST_F(LibYUVConvertTest, FMT##ToARGB_Opt) {                               \
+    TestBayerToARGB(FOURCC_##FMT, #FMT, benchmark_width_, benchmark_height_, \
+                    disable_cpu_flags_, benchmark_cpu_info_,                 \
+                    benchmark_iterations_);                                  \
+  }                                                                          \
+  TEST_F(LibYUVConvertTest, FMT##ToARGB_Any) {                               \
+    TestBayerToARGB(FOURCC_##FMT, #FMT, benchmark_width_ + 3,                \
+                    benchmark_height_ + 1, disable_cpu_flags_,               \
+                    benchmark_cpu_info_, 1);                                 \
+  }                                                                          \
+  TEST_F(LibYUVConvertTest, FMT##ToI420_Opt) {                               \
+    TestBayerToI420(FOURCC_##FMT, benchmark_width_, benchmark_height_,       \
+                    disable_cpu_flags_, benchmark_cpu_info_,                 \
+                    benchmark_iterations_);                                  \
+  }                                                                          \
+  TEST_F(LibYUVConvertTest, FMT##ToI420_Any) {                               \
+    TestBayerToI420(FOURCC_##FMT, benchmark_width_ + 3,                      \
+                    benchmark_height_ + 1, disable_cpu_flags_,               \
+                    benchmark_cpu_info_, 1);                                 \
+  }
+
+TESTBAYER(RGGB)
+TESTBAYER(BGGR)
+TESTBAYER(GRBG)
+TESTBAYER(GBRG)
+#undef TESTBAYER
+
+// Convert with AVX512BW rows and compare with AVX2 rows, which must match
+// exactly.  The AVX512BW conversion is repeated for benchmarking.
+#define TESTPLANARTOB_AVX512BW(FMT_PLANAR, SUBSAMP_X, SUBSAMP_Y, T, BIT_DEPTH, \
+                               FMT_B, BPP_B)                                   \
+  TEST_F(LibYUVConvertTest, FMT_PLANAR##To##FMT_B##_AVX512BW) {                \
+    const int kWidth = benchmark_width_;                                       \
+    const int kHeight = benchmark_height_;                                     \
+    const int kStrideUV = SUBSAMPLE(kWidth, SUBSAMP_X);                        \
+    const int kSizeUV = kStrideUV * SUBSAMPLE(kHeight, SUBSAMP_Y);             \
+    const int kStrideB = kWidth * BPP_B;                                       \
+    align_buffer_page_end(src_y, kWidth* kHeight * sizeof(T));                 \
+    align_buffer_page_end(src_u, kSizeUV * sizeof(T));                         \
+    align_buffer_page_end(src_v, kSizeUV * sizeof(T));                         \
+    align_buffer_page_end(dst_avx2, kStrideB* kHeight);                        \
+    align_buffer_page_end(dst_opt, kStrideB* kHeight);                         \
+    T* y = reinterpret_cast<T*>(src_y);                                        \
+    T* u = reinterpret_cast<T*>(src_u);                                        \
+    T* v = reinterpret_cast<T*>(src_v);                                        \
+    for (int i = 0; i < kWidth * kHeight; ++i) {                               \
+      y[i] = static_cast<T>(fastrand() & ((1 << BIT_DEPTH) - 1));              \
+    }                                                                          \
+    for (int i = 0; i < kSizeUV; ++i) {                                        \
+      u[i] = static_cast<T>(fastrand() & ((1 << BIT_DEPTH) - 1));              \
+      v[i] = static_cast<T>(fastrand() & ((1 << BIT_DEPTH) - 1));              \
+    }                                                                          \
+    memset(dst_avx2, 1, kStrideB * kHeight);                                   \
+    memset(dst_opt, 2, kStrideB * kHeight);                                    \
+    MaskCpuFlags(benchmark_cpu_info_ & ~kCpuHasAVX512BW);                      \
+    FMT_PLANAR##To##FMT_B(y, kWidth, u, kStrideUV, v, kStrideUV, dst_avx2,     \
+                          kStrideB, kWidth, kHeight);                          \
+    MaskCpuFlags(benchmark_cpu_info_);                                         \
+    for (int i = 0; i < benchmark_iterations_; ++i) {                          \
+      FMT_PLANAR##To##FMT_B(y, kWidth, u, kStrideUV, v, kStrideUV, dst_opt,    \
+                            kStrideB, kWidth, kHeight);                        \
+    }                                                                          \
+    for (int i = 0; i < kStrideB * kHeight; ++i) {                             \
+      EXPECT_EQ(dst_avx2[i], dst_opt[i]);                                      \
+    }                                                                          \
+    free_aligned_buffer_page_end(src_y);                                       \
+    free_aligned_buffer_page_end(src_u);                                       \
+    free_aligned_buffer_page_end(src_v);                                       \
+    free_aligned_buffer_page_end(dst_avx2);                                    \
+    free_aligned_buffer_page_end(dst_opt);                                     \
+  }
+
+TESTPLANARTOB_AVX512BW(I420, 2, 2, uint8_t, 8, ARGB, 4)
+TESTPLANARTOB_AVX512BW(I420, 2, 2, uint8_t, 8, ABGR, 4)
+TESTPLANARTOB_AVX512BW(I422, 2, 1, uint8_t, 8, ARGB, 4)
+TESTPLANARTOB_AVX512BW(I444, 1, 1, uint8_t, 8, ARGB, 4)
+TESTPLANARTOB_AVX512BW(I444, 1, 1, uint8_t, 8, ABGR, 4)
+TESTPLANARTOB_AVX512BW(I420, 2, 2, uint8_t, 8, AR30, 4)
+TESTPLANARTOB_AVX512BW(I420, 2, 2, uint8_t, 8, AB30, 4)
+TESTPLANARTOB_AVX512BW(I010, 2, 2, uint16_t, 10, ARGB, 4)
+TESTPLANARTOB_AVX512BW(I010, 2, 2, uint16_t, 10, ABGR, 4)
+TESTPLANARTOB_AVX512BW(I010, 2, 2, uint16_t, 10, AR30, 4)
+TESTPLANARTOB_AVX512BW(I210, 2, 1, uint16_t, 10, AR30, 4)
+TESTPLANARTOB_AVX512BW(I410, 1, 1, uint16_t, 10, ARGB, 4)
+TESTPLANARTOB_AVX512BW(I410, 1, 1, uint16_t, 10, AR30, 4)
+#undef TESTPLANARTOB_AVX512BW
+
+TEST_F(LibYUVConvertTest, NV12ToARGB_AVX512BW) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int kStrideUV = SUBSAMPLE(kWidth, 2) * 2;
+  const int kSizeUV = kStrideUV * SUBSAMPLE(kHeight, 2);
+  align_buffer_page_end(src_y, kWidth * kHeight);
+  align_buffer_page_end(src_uv, kSizeUV);
+  align_buffer_page_end(dst_avx2, kWidth * 4 * kHeight);
+  align_buffer_page_end(dst_opt, kWidth * 4 * kHeight);
+  MemRandomize(src_y, kWidth * kHeight);
+  MemRandomize(src_uv, kSizeUV);
+  memset(dst_avx2, 1, kWidth * 4 * kHeight);
+  memset(dst_opt, 2, kWidth * 4 * kHeight);
+  MaskCpuFlags(benchmark_cpu_info_ & ~kCpuHasAVX512BW);
+  NV12ToARGB(src_y, kWidth, src_uv, kStrideUV, dst_avx2, kWidth * 4, kWidth,
+             kHeight);
+  MaskCpuFlags(benchmark_cpu_info_);
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    NV12ToARGB(src_y, kWidth, src_uv, kStrideUV, dst_opt, kWidth * 4, kWidth,
+               kHeight);
+  }
+  for (int i = 0; i < kWidth * 4 * kHeight; ++i) {
+    EXPECT_EQ(dst_avx2[i], dst_opt[i]);
+  }
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_uv);
+  free_aligned_buffer_page_end(dst_avx2);
+  free_aligned_buffer_page_end(dst_opt);
+}
+
+// Runs tasks in reverse order on the calling thread.
+static void ReverseParallelFor(void* executor_context,
+                               void (*task)(void* task_context, int index),
+                               void* task_context,
+                               int count) {
+  (void)executor_context;
+  for (int i = count - 1; i >= 0; --i) {
+    task(task_context, i);
+  }
+}
+
+// Frames large enough to be split into bands, with an odd height.
+static const int kThreadsWidth = 642;
+static const int kThreadsHeight = 363;
+
+#define TESTPLANARTOB_THREADS(FMT_PLANAR, SUBSAMP_X, SUBSAMP_Y, T, BIT_DEPTH, \
+                              FMT_B, BPP_B)                                   \
+  TEST_F(LibYUVConvertTest, FMT_PLANAR##To##FMT_B##_Threads) {                \
+    const int kWidth = kThreadsWidth;                                         \
+    const int kHeight = kThreadsHeight;                                       \
+    const int kStrideUV = SUBSAMPLE(kWidth, SUBSAMP_X);                       \
+    const int kSizeUV = kStrideUV * SUBSAMPLE(kHeight, SUBSAMP_Y);            \
+    const int kStrideB = kWidth * BPP_B;                                      \
+    align_buffer_page_end(src_y, kWidth* kHeight * sizeof(T));                \
+    align_buffer_page_end(src_u, kSizeUV * sizeof(T));                        \
+    align_buffer_page_end(src_v, kSizeUV * sizeof(T));                        \
+    align_buffer_page_end(dst_c, kStrideB* kHeight);                          \
+    align_buffer_page_end(dst_threads, kStrideB* kHeight);                    \
+    align_buffer_page_end(dst_executor, kStrideB* kHeight);                   \
+    T* y = reinterpret_cast<T*>(src_y);                                       \
+    T* u = reinterpret_cast<T*>(src_u);                                       \
+    T* v = reinterpret_cast<T*>(src_v);                                       \
+    for (int i = 0; i < kWidth * kHeight; ++i) {                              \
+      y[i] = static_cast<T>(fastrand() & ((1 << BIT_DEPTH) - 1));             \
+    }                                                                         \
+    for (int i = 0; i < kSizeUV; ++i) {                                       \
+      u[i] = static_cast<T>(fastrand() & ((1 << BIT_DEPTH) - 1));             \
+      v[i] = static_cast<T>(fastrand() & ((1 << BIT_DEPTH) - 1));             \
+    }                                                                         \
+    memset(dst_c, 1, kStrideB * kHeight);                                     \
+    memset(dst_threads, 2, kStrideB * kHeight);                               \
+    memset(dst_executor, 3, kStrideB * kHeight);                              \
+    FMT_PLANAR##To##FMT_B(y, kWidth, u, kStrideUV, v, kStrideUV, dst_c,       \
+                          kStrideB, kWidth, -kHeight);                        \
+    EXPECT_EQ(0, SetConvertThreads(4));                                       \
+    for (int i = 0; i < benchmark_iterations_; ++i) {                         \
+      FMT_PLANAR##To##FMT_B(y, kWidth, u, kStrideUV, v, kStrideUV,            \
+                            dst_threads, kStrideB, kWidth, -kHeight);         \
+    }                                                                         \
+    EXPECT_EQ(0, SetConvertThreads(0));                                       \
+    EXPECT_EQ(0, SetConvertExecutor(ReverseParallelFor, NULL, 7));            \
+    FMT_PLANAR##To##FMT_B(y, kWidth, u, kStrideUV, v, kStrideUV,              \
+                          dst_executor, kStrideB, kWidth, -kHeight);          \
+    EXPECT_EQ(0, SetConvertExecutor(NULL, NULL, 0));                          \
+    for (int i = 0; i < kStrideB * kHeight; ++i) {                            \
+      EXPECT_EQ(dst_c[i], dst_threads[i]);                                    \
+      EXPECT_EQ(dst_c[i], dst_executor[i]);                                   \
+    }                                                                         \
+    free_aligned_buffer_page_end(src_y);                                      \
+    free_aligned_buffer_page_end(src_u);                                      \
+    free_aligned_buffer_page_end(src_v);                                      \
+    free_aligned_buffer_page_end(dst_c);                                      \
+    free_aligned_buffer_page_end(dst_threads);                                \
+    free_aligned_buffer_page_end(dst_executor);                               \
+  }
+
+TESTPLANARTOB_THREADS(I420, 2, 2, uint8_t, 8, ARGB, 4)
+TESTPLANARTOB_THREADS(I420, 2, 2, uint8_t, 8, RGB24, 3)
+TESTPLANARTOB_THREADS(I420, 2, 2, uint8_t, 8, RGB565, 2)
+TESTPLANARTOB_THREADS(I422, 2, 1, uint8_t, 8, ABGR, 4)
+TESTPLANARTOB_THREADS(I444, 1, 1, uint8_t, 8, ARGB, 4)
+TESTPLANARTOB_THREADS(I010, 2, 2, uint16_t, 10, AR30, 4)
+TESTPLANARTOB_THREADS(I012, 2, 2, uint16_t, 12, ARGB, 4)
+TESTPLANARTOB_THREADS(I210, 2, 1, uint16_t, 10, ARGB, 4)
+TESTPLANARTOB_THREADS(I410, 1, 1, uint16_t, 10, AR30, 4)
+#undef TESTPLANARTOB_THREADS
+
+TEST_F(LibYUVConvertTest, NV12ToABGR_Threads) {
+  const int kWidth = kThreadsWidth;
+  const int kHeight = kThreadsHeight;
+  const int kStrideUV = SUBSAMPLE(kWidth, 2) * 2;
+  const int kSizeUV = kStrideUV * SUBSAMPLE(kHeight, 2);
+  const int kStrideB = kWidth * 4;
+  align_buffer_page_end(src_y, kWidth * kHeight);
+  align_buffer_page_end(src_uv, kSizeUV);
+  align_buffer_page_end(dst_c, kStrideB * kHeight);
+  align_buffer_page_end(dst_threads, kStrideB * kHeight);
+  MemRandomize(src_y, kWidth * kHeight);
+  MemRandomize(src_uv, kSizeUV);
+  memset(dst_c, 1, kStrideB * kHeight);
+  memset(dst_threads, 2, kStrideB * kHeight);
+  NV12ToABGR(src_y, kWidth, src_uv, kStrideUV, dst_c, kStrideB, kWidth,
+             kHeight);
+  EXPECT_EQ(0, SetConvertThreads(3));
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    NV12ToABGR(src_y, kWidth, src_uv, kStrideUV, dst_threads, kStrideB,
+               kWidth, kHeight);
+  }
+  EXPECT_EQ(0, SetConvertThreads(0));
+  for (int i = 0; i < kStrideB * kHeight; ++i) {
+    EXPECT_EQ(dst_c[i], dst_threads[i]);
+  }
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_uv);
+  free_aligned_buffer_page_end(dst_c);
+  free_aligned_buffer_page_end(dst_threads);
+}
+
+TEST_F(LibYUVConvertTest, P010ToAR30_Threads) {
+  const int kWidth = kThreadsWidth;
+  const int kHeight = kThreadsHeight;
+  const int kStrideUV = SUBSAMPLE(kWidth, 2) * 2;
+  const int kSizeUV = kStrideUV * SUBSAMPLE(kHeight, 2);
+  const int kStrideB = kWidth * 4;
+  align_buffer_page_end(src_y, kWidth * kHeight * 2);
+  align_buffer_page_end(src_uv, kSizeUV * 2);
+  align_buffer_page_end(dst_c, kStrideB * kHeight);
+  align_buffer_page_end(dst_executor, kStrideB * kHeight);
+  MemRandomize(src_y, kWidth * kHeight * 2);
+  MemRandomize(src_uv, kSizeUV * 2);
+  memset(dst_c, 1, kStrideB * kHeight);
+  memset(dst_executor, 2, kStrideB * kHeight);
+  P010ToAR30(reinterpret_cast<uint16_t*>(src_y), kWidth,
+             reinterpret_cast<uint16_t*>(src_uv), kStrideUV, dst_c, kStrideB,
+             kWidth, kHeight);
+  EXPECT_EQ(0, SetConvertExecutor(ReverseParallelFor, NULL, 16));
+  P010ToAR30(reinterpret_cast<uint16_t*>(src_y), kWidth,
+             reinterpret_cast<uint16_t*>(src_uv), kStrideUV, dst_executor,
+             kStrideB, kWidth, kHeight);
+  EXPECT_EQ(0, SetConvertExecutor(NULL, NULL, 0));
+  for (int i = 0; i < kStrideB * kHeight; ++i) {
+    EXPECT_EQ(dst_c[i], dst_executor[i]);
+  }
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_uv);
+  free_aligned_buffer_page_end(dst_c);
+  free_aligned_buffer_page_end(dst_executor);
+}
+
+TEST_F(LibYUVConvertTest, I420AlphaToARGB_Threads) {
+  const int kWidth = kThreadsWidth;
+  const int kHeight = kThreadsHeight;
+  const int kStrideUV = SUBSAMPLE(kWidth, 2);
+  const int kSizeUV = kStrideUV * SUBSAMPLE(kHeight, 2);
+  const int kStrideB = kWidth * 4;
+  align_buffer_page_end(src_y, kWidth * kHeight);
+  align_buffer_page_end(src_u, kSizeUV);
+  align_buffer_page_end(src_v, kSizeUV);
+  align_buffer_page_end(src_a, kWidth * kHeight);
+  align_buffer_page_end(dst_c, kStrideB * kHeight);
+  align_buffer_page_end(dst_threads, kStrideB * kHeight);
+  MemRandomize(src_y, kWidth * kHeight);
+  MemRandomize(src_u, kSizeUV);
+  MemRandomize(src_v, kSizeUV);
+  MemRandomize(src_a, kWidth * kHeight);
+  memset(dst_c, 1, kStrideB * kHeight);
+  memset(dst_threads, 2, kStrideB * kHeight);
+  I420AlphaToARGB(src_y, kWidth, src_u, kStrideUV, src_v, kStrideUV, src_a,
+                  kWidth, dst_c, kStrideB, kWidth, kHeight, 1);
+  EXPECT_EQ(0, SetConvertThreads(4));
+  I420AlphaToARGB(src_y, kWidth, src_u, kStrideUV, src_v, kStrideUV, src_a,
+                  kWidth, dst_threads, kStrideB, kWidth, kHeight, 1);
+  EXPECT_EQ(0, SetConvertThreads(0));
+  for (int i = 0; i < kStrideB * kHeight; ++i) {
+    EXPECT_EQ(dst_c[i], dst_threads[i]);
+  }
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(dst_c);
+  free_aligned_buffer_page_end(dst_threads);
+}
+
+TEST_F(LibYUVConvertTest, SetConvertThreadsInvalid) {
+  EXPECT_EQ(-1, SetConvertThreads(-1));
+  EXPECT_EQ(-1, SetConvertThreads(65));
+  EXPECT_EQ(-1, SetConvertExecutor(ReverseParallelFor, NULL, 0));
+  EXPECT_EQ(0, SetConvertThreads(0));
+  EXPECT_EQ(0, SetConvertExecutor(NULL, NULL, 0));
+}
+
+// Converts frames in slices copied to a scratch buffer that is cleared after
+// each slice, and checks the result against whole frame conversion.
+static void TestI420ToARGBSlices(int width,
+                                 int height,
+                                 FilterMode filter,
+                                 int slice_rows,
+                                 int num_frames) {
+  const int kAbsHeight = height < 0 ? -height : height;
+  const int kStrideUV = SUBSAMPLE(width, 2);
+  const int kSizeUV = kStrideUV * SUBSAMPLE(kAbsHeight, 2);
+  const int kStrideB = width * 4;
+  align_buffer_page_end(src_y, width * kAbsHeight);
+  align_buffer_page_end(src_u, kSizeUV);
+  align_buffer_page_end(src_v, kSizeUV);
+  align_buffer_page_end(slice_y, width * slice_rows);
+  align_buffer_page_end(slice_u, kStrideUV * (slice_rows / 2 + 1));
+  align_buffer_page_end(slice_v, kStrideUV * (slice_rows / 2 + 1));
+  align_buffer_page_end(dst_ref, kStrideB * kAbsHeight);
+  align_buffer_page_end(dst_slices, kStrideB * kAbsHeight);
+  MemRandomize(src_y, width * kAbsHeight);
+  MemRandomize(src_u, kSizeUV);
+  MemRandomize(src_v, kSizeUV);
+  memset(dst_ref, 1, kStrideB * kAbsHeight);
+  EXPECT_EQ(0, I420ToARGBMatrixFilter(src_y, width, src_u, kStrideUV, src_v,
+                                      kStrideUV, dst_ref, kStrideB,
+                                      &kYuvI601Constants, width, height,
+                                      filter));
+
+  I420ToARGBSlicer* slicer =
+      I420ToARGBSlicerCreate(&kYuvI601Constants, width, height, filter);
+  ASSERT_TRUE(slicer != NULL);
+  for (int frame = 0; frame < num_frames; ++frame) {
+    memset(dst_slices, 2, kStrideB * kAbsHeight);
+    for (int y = 0; y < kAbsHeight; y += slice_rows) {
+      const int n = y + slice_rows < kAbsHeight ? slice_rows : kAbsHeight - y;
+      const int c0 = (y + 1) / 2;
+      const int c1 = (y + n + 1) / 2;
+      memcpy(slice_y, src_y + y * width, n * width);
+      memcpy(slice_u, src_u + c0 * kStrideUV, (c1 - c0) * kStrideUV);
+      memcpy(slice_v, src_v + c0 * kStrideUV, (c1 - c0) * kStrideUV);
+      const int done =
+          I420ToARGBSliceConvert(slicer, slice_y, width, slice_u, kStrideUV,
+                                 slice_v, kStrideUV, n, dst_slices, kStrideB);
+      if (y + n == kAbsHeight) {
+        EXPECT_EQ(kAbsHeight, done);
+      } else {
+        EXPECT_LE(y + n - 1, done);
+        EXPECT_GE(y + n, done);
+      }
+      memset(slice_y, 3, width * slice_rows);
+      memset(slice_u, 4, kStrideUV * (slice_rows / 2 + 1));
+      memset(slice_v, 5, kStrideUV * (slice_rows / 2 + 1));
+    }
+    for (int i = 0; i < kStrideB * kAbsHeight; ++i) {
+      EXPECT_EQ(dst_ref[i], dst_slices[i]);
+    }
+  }
+  EXPECT_EQ(-1, I420ToARGBSliceConvert(slicer, src_y, width, src_u, kStrideUV,
+                                       src_v, kStrideUV, kAbsHeight + 1,
+                                       dst_slices, kStrideB));
+  I420ToARGBSlicerDestroy(slicer);
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(slice_y);
+  free_aligned_buffer_page_end(slice_u);
+  free_aligned_buffer_page_end(slice_v);
+  free_aligned_buffer_page_end(dst_ref);
+  free_aligned_buffer_page_end(dst_slices);
+}
+
+TEST_F(LibYUVConvertTest, I420ToARGBSlices_None) {
+  TestI420ToARGBSlices(benchmark_width_, benchmark_height_, kFilterNone, 16,
+                       benchmark_iterations_);
+  TestI420ToARGBSlices(benchmark_width_, benchmark_height_, kFilterNone, 7, 2);
+  TestI420ToARGBSlices(benchmark_width_ + 3, benchmark_height_ + 1,
+                       kFilterNone, 1, 2);
+}
+
+TEST_F(LibYUVConvertTest, I420ToARGBSlices_Bilinear) {
+  TestI420ToARGBSlices(benchmark_width_, benchmark_height_, kFilterBilinear,
+                       16, benchmark_iterations_);
+  TestI420ToARGBSlices(benchmark_width_, benchmark_height_, kFilterBilinear,
+                       7, 2);
+  TestI420ToARGBSlices(benchmark_width_ + 3, benchmark_height_ + 1,
+                       kFilterBilinear, 1, 2);
+  TestI420ToARGBSlices(benchmark_width_ + 3, benchmark_height_ + 1,
+                       kFilterBilinear, 64, 2);
+}
+
+TEST_F(LibYUVConvertTest, I420ToARGBSlices_Invert) {
+  TestI420ToARGBSlices(benchmark_width_, -benchmark_height_, kFilterNone, 7,
+                       2);
+  TestI420ToARGBSlices(benchmark_width_, -benchmark_height_, kFilterBilinear,
+                       16, 2);
+}
+
+TEST_F(LibYUVConvertTest, I420ToARGBSlicerInvalid) {
+  EXPECT_TRUE(I420ToARGBSlicerCreate(&kYuvI601Constants, 0, 16,
+                                     kFilterNone) == NULL);
+  EXPECT_TRUE(I420ToARGBSlicerCreate(&kYuvI601Constants, 16, 0,
+                                     kFilterNone) == NULL);
+  EXPECT_TRUE(I420ToARGBSlicerCreate(&kYuvI601Constants, 16, 16,
+                                     kFilterLinear) == NULL);
+  EXPECT_TRUE(I420ToARGBSlicerCreate(NULL, 16, 16, kFilterNone) == NULL);
+}
+
+// Reference conversion of a whole frame by chained calls. Negative height
+// flips the source. The reference functions flip the destination instead,
+// which only matches ConvertFrame for even heights.
+typedef void (*ConvertFrameRefFunc)(const uint8_t* src,
+                                    uint8_t* dst,
+                                    int width,
+                                    int height);
+
+static void UYVYToNV12Ref(const uint8_t* src,
+                          uint8_t* dst,
+                          int width,
+                          int height) {
+  const int abs_height = height < 0 ? -height : height;
+  align_buffer_page_end(argb, width * 4 * abs_height);
+  UYVYToARGB(src, (width + 1) / 2 * 4, argb, width * 4, width, height);
+  ARGBToNV12(argb, width * 4, dst, width, dst + width * abs_height,
+             (width + 1) / 2 * 2, width, abs_height);
+  free_aligned_buffer_page_end(argb);
+}
+
+static void RGB24ToP010Ref(const uint8_t* src,
+                           uint8_t* dst,
+                           int width,
+                           int height) {
+  const int abs_height = height < 0 ? -height : height;
+  const int uv_width = (width + 1) / 2 * 2;
+  const int uv_height = (abs_height + 1) / 2;
+  uint16_t* dst_y = reinterpret_cast<uint16_t*>(dst);
+  uint16_t* dst_uv = dst_y + width * abs_height;
+  align_buffer_page_end(argb, width * 4 * abs_height);
+  align_buffer_page_end(nv12, width * abs_height + uv_width * uv_height);
+  RGB24ToARGB(src, width * 3, argb, width * 4, width, height);
+  ARGBToNV12(argb, width * 4, nv12, width, nv12 + width * abs_height,
+             uv_width, width, abs_height);
+  Convert8To16Plane(nv12, width, dst_y, width, 1024, width, abs_height);
+  Convert8To16Plane(nv12 + width * abs_height, uv_width, dst_uv, uv_width,
+                    1024, uv_width, uv_height);
+  ConvertToMSBPlane_16(dst_y, width, dst_y, width, width, abs_height, 10);
+  ConvertToMSBPlane_16(dst_uv, uv_width, dst_uv, uv_width, uv_width,
+                       uv_height, 10);
+  free_aligned_buffer_page_end(argb);
+  free_aligned_buffer_page_end(nv12);
+}
+
+static void I420ToRGB565Ref(const uint8_t* src,
+                            uint8_t* dst,
+                            int width,
+                            int height) {
+  const int abs_height = height < 0 ? -height : height;
+  const int half_width = (width + 1) / 2;
+  const uint8_t* src_u = src + width * abs_height;
+  const uint8_t* src_v = src_u + half_width * ((abs_height + 1) / 2);
+  align_buffer_page_end(argb, width * 4 * abs_height);
+  I420ToARGB(src, width, src_u, half_width, src_v, half_width, argb,
+             width * 4, width, height);
+  ARGBToRGB565(argb, width * 4, dst, width * 2, width, abs_height);
+  free_aligned_buffer_page_end(argb);
+}
+
+static void YV12ToARGBRef(const uint8_t* src,
+                          uint8_t* dst,
+                          int width,
+                          int height) {
+  const int abs_height = height < 0 ? -height : height;
+  const int half_width = (width + 1) / 2;
+  const uint8_t* src_v = src + width * abs_height;
+  const uint8_t* src_u = src_v + half_width * ((abs_height + 1) / 2);
+  I420ToARGB(src, width, src_u, half_width, src_v, half_width, dst,
+             width * 4, width, height);
+}
+
+static void P010ToABGRRef(const uint8_t* src,
+                          uint8_t* dst,
+                          int width,
+                          int height) {
+  const int abs_height = height < 0 ? -height : height;
+  const uint16_t* src_y = reinterpret_cast<const uint16_t*>(src);
+  align_buffer_page_end(argb, width * 4 * abs_height);
+  P010ToARGB(src_y, width, src_y + width * abs_height, (width + 1) / 2 * 2,
+             argb, width * 4, width, height);
+  ARGBToABGR(argb, width * 4, dst, width * 4, width, abs_height);
+  free_aligned_buffer_page_end(argb);
+}
+
+static void CopyFrameRef(const uint8_t* src,
+                         uint8_t* dst,
+                         int width,
+                         int height) {
+  const int abs_height = height < 0 ? -height : height;
+  const int uv_width = (width + 1) / 2 * 2;
+  CopyPlane(src, width, dst, width, width, height);
+  CopyPlane(src + width * abs_height, uv_width, dst + width * abs_height,
+            uv_width, uv_width, height < 0 ? -(abs_height + 1) / 2
+                                           : (abs_height + 1) / 2);
+}
+
+static void TestConvertFrame(uint32_t src_fourcc,
+                             uint32_t dst_fourcc,
+                             ConvertFrameRefFunc ref,
+                             int width,
+                             int height,
+                             int benchmark_iterations) {
+  const int src_size = ConvertFrameSize(src_fourcc, width, height);
+  const int dst_size = ConvertFrameSize(dst_fourcc, width, height);
+  ASSERT_GT(src_size, 0);
+  ASSERT_GT(dst_size, 0);
+  align_buffer_page_end(src, src_size);
+  align_buffer_page_end(dst_ref, dst_size);
+  align_buffer_page_end(dst_frame, dst_size);
+  MemRandomize(src, src_size);
+  if (src_fourcc == FOURCC_P010) {
+    // Keep samples to 10 bits in the msbs.
+    uint16_t* src16 = reinterpret_cast<uint16_t*>(src);
+    for (int i = 0; i < src_size / 2; ++i) {
+      src16[i] &= 0xffc0;
+    }
+  }
+  memset(dst_ref, 1, dst_size);
+  memset(dst_frame, 2, dst_size);
+  ref(src, dst_ref, width, height);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    EXPECT_EQ(0, ConvertFrame(src, src_size, src_fourcc, dst_frame, dst_size,
+                              dst_fourcc, width, height));
+  }
+  for (int i = 0; i < dst_size; ++i) {
+    EXPECT_EQ(dst_ref[i], dst_frame[i]);
+  }
+  free_aligned_buffer_page_end(src);
+  free_aligned_buffer_page_end(dst_ref);
+  free_aligned_buffer_page_end(dst_frame);
+}
+
+#define TESTCONVERTFRAME(SRC, DST)                                            \
+  TEST_F(LibYUVConvertTest, ConvertFrame##SRC##To##DST) {                     \
+    TestConvertFrame(FOURCC_##SRC, FOURCC_##DST, SRC##To##DST##Ref,           \
+                     benchmark_width_, benchmark_height_,                     \
+                     benchmark_iterations_);                                  \
+    TestConvertFrame(FOURCC_##SRC, FOURCC_##DST, SRC##To##DST##Ref,           \
+                     benchmark_width_ + 3, -((benchmark_height_ + 1) & ~1),   \
+                     1);                                                      \
+    TestConvertFrame(FOURCC_##SRC, FOURCC_##DST, SRC##To##DST##Ref,           \
+                     kThreadsWidth + 1, kThreadsHeight, 2);                   \
+  }
+
+// The 4 character code of RGB24 is 24BG and of RGB565 is RGBP.
+#define FOURCC_RGB24 FOURCC_24BG
+#define FOURCC_RGB565 FOURCC_RGBP
+
+TESTCONVERTFRAME(UYVY, NV12)
+TESTCONVERTFRAME(RGB24, P010)
+TESTCONVERTFRAME(I420, RGB565)
+TESTCONVERTFRAME(YV12, ARGB)
+TESTCONVERTFRAME(P010, ABGR)
+
+#undef FOURCC_RGB24
+#undef FOURCC_RGB565
+
+TEST_F(LibYUVConvertTest, ConvertFrameCopy) {
+  TestConvertFrame(FOURCC_NV12, FOURCC_NV12, CopyFrameRef, benchmark_width_,
+                   benchmark_height_, benchmark_iterations_);
+  TestConvertFrame(FOURCC_NV12, FOURCC_NV12, CopyFrameRef,
+                   benchmark_width_ + 3, -benchmark_height_ - 1, 1);
+}
+
+TEST_F(LibYUVConvertTest, ConvertFrameInvalid) {
+  const int kSize = ConvertFrameSize(FOURCC_I420, 16, 16);
+  align_buffer_page_end(src, kSize);
+  align_buffer_page_end(dst, 16 * 16 * 4);
+  memset(src, 0, kSize);
+  EXPECT_EQ(16 * 16 * 3 / 2, kSize);
+  EXPECT_EQ(16 * 16 * 4, ConvertFrameSize(FOURCC_ARGB, 16, 16));
+  EXPECT_EQ(-1, ConvertFrameSize(FOURCC_MJPG, 16, 16));
+  EXPECT_EQ(-1, ConvertFrameSize(FOURCC_I420, 0, 16));
+  EXPECT_EQ(0, ConvertFrame(src, kSize, FOURCC_I420, dst, 16 * 16 * 4,
+                            FOURCC_ARGB, 16, 16));
+  EXPECT_EQ(-1, ConvertFrame(src, kSize, FOURCC_MJPG, dst, 16 * 16 * 4,
+                             FOURCC_ARGB, 16, 16));
+  // Sources only.
+  EXPECT_EQ(-1, ConvertFrame(src, kSize, FOURCC_I420, dst, 16 * 16 * 4,
+                             FOURCC_H420, 16, 16));
+  EXPECT_EQ(-1, ConvertFrame(src, kSize - 1, FOURCC_I420, dst, 16 * 16 * 4,
+                             FOURCC_ARGB, 16, 16));
+  EXPECT_EQ(-1, ConvertFrame(src, kSize, FOURCC_I420, dst, 16 * 16 * 4 - 1,
+                             FOURCC_ARGB, 16, 16));
+  EXPECT_EQ(-1, ConvertFrame(src, kSize, FOURCC_I420, dst, 16 * 16 * 4,
+                             FOURCC_ARGB, 16, 0));
+  EXPECT_EQ(-1, ConvertFrame(NULL, kSize, FOURCC_I420, dst, 16 * 16 * 4,
+                             FOURCC_ARGB, 16, 16));
+  free_aligned_buffer_page_end(src);
+  free_aligned_buffer_page_end(dst);
+}
+
 }  // namespace libyuv
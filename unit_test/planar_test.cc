@@ -1551,6 +1551,211 @@ TEST_F(LibYUVPlanarTest, TestAffine) {
 #endif
 }
 
+// Rotate about the center by 0.2 radians and zoom out, so some samples fall
+// outside the source.
+static void WarpTestMatrix(int width, int height, float* matrix) {
+  const float kScale = 1.25f;
+  const float c = cosf(0.2f) * kScale;
+  const float s = sinf(0.2f) * kScale;
+  const float cx = (width - 1) * 0.5f;
+  const float cy = (height - 1) * 0.5f;
+  matrix[0] = c;
+  matrix[1] = -s;
+  matrix[2] = cx - c * cx + s * cy;
+  matrix[3] = s;
+  matrix[4] = c;
+  matrix[5] = cy - s * cx - c * cy;
+  matrix[6] = 0.0002f;
+  matrix[7] = -0.0001f;
+  matrix[8] = 1.f;
+}
+
+static int TestARGBWarp(int width,
+                        int height,
+                        int benchmark_iterations,
+                        int disable_cpu_flags,
+                        int benchmark_cpu_info,
+                        const float* matrix) {
+  const int kStride = width * 4;
+  align_buffer_page_end(src_argb, kStride * height);
+  align_buffer_page_end(dst_argb_c, kStride * height);
+  align_buffer_page_end(dst_argb_opt, kStride * height);
+  MemRandomize(src_argb, kStride * height);
+  memset(dst_argb_c, 1, kStride * height);
+  memset(dst_argb_opt, 2, kStride * height);
+
+  MaskCpuFlags(disable_cpu_flags);
+  ARGBPerspective(src_argb, kStride, width, height, dst_argb_c, kStride, width,
+                  height, matrix);
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    ARGBPerspective(src_argb, kStride, width, height, dst_argb_opt, kStride,
+                    width, height, matrix);
+  }
+  int max_diff = 0;
+  for (int i = 0; i < kStride * height; ++i) {
+    int abs_diff = abs(static_cast<int>(dst_argb_c[i]) -
+                       static_cast<int>(dst_argb_opt[i]));
+    if (abs_diff > max_diff) {
+      max_diff = abs_diff;
+    }
+  }
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(dst_argb_c);
+  free_aligned_buffer_page_end(dst_argb_opt);
+  return max_diff;
+}
+
+TEST_F(LibYUVPlanarTest, ARGBPerspective_Opt) {
+  float matrix[9];
+  WarpTestMatrix(benchmark_width_, benchmark_height_, matrix);
+  int max_diff =
+      TestARGBWarp(benchmark_width_, benchmark_height_, benchmark_iterations_,
+                   disable_cpu_flags_, benchmark_cpu_info_, matrix);
+  EXPECT_EQ(0, max_diff);
+}
+
+TEST_F(LibYUVPlanarTest, ARGBPerspective_Any) {
+  float matrix[9];
+  WarpTestMatrix(benchmark_width_ + 1, benchmark_height_, matrix);
+  int max_diff =
+      TestARGBWarp(benchmark_width_ + 1, benchmark_height_,
+                   benchmark_iterations_, disable_cpu_flags_,
+                   benchmark_cpu_info_, matrix);
+  EXPECT_EQ(0, max_diff);
+}
+
+TEST_F(LibYUVPlanarTest, ARGBAffine_Opt) {
+  float matrix[9];
+  WarpTestMatrix(benchmark_width_, benchmark_height_, matrix);
+  const int kStride = benchmark_width_ * 4;
+  const int kSize = kStride * benchmark_height_;
+  align_buffer_page_end(src_argb, kSize);
+  align_buffer_page_end(dst_argb_c, kSize);
+  align_buffer_page_end(dst_argb_opt, kSize);
+  MemRandomize(src_argb, kSize);
+
+  MaskCpuFlags(disable_cpu_flags_);
+  ARGBAffine(src_argb, kStride, benchmark_width_, benchmark_height_,
+             dst_argb_c, kStride, benchmark_width_, benchmark_height_, matrix);
+  MaskCpuFlags(benchmark_cpu_info_);
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    ARGBAffine(src_argb, kStride, benchmark_width_, benchmark_height_,
+               dst_argb_opt, kStride, benchmark_width_, benchmark_height_,
+               matrix);
+  }
+  EXPECT_EQ(0, memcmp(dst_argb_c, dst_argb_opt, kSize));
+
+  // Identity is a copy.
+  const float kIdentity[6] = {1.f, 0.f, 0.f, 0.f, 1.f, 0.f};
+  EXPECT_EQ(0, ARGBAffine(src_argb, kStride, benchmark_width_,
+                          benchmark_height_, dst_argb_opt, kStride,
+                          benchmark_width_, benchmark_height_, kIdentity));
+  EXPECT_EQ(0, memcmp(src_argb, dst_argb_opt, kSize));
+
+  // Half pixel shift averages neighbours, and the edge repeats.
+  const float kShift[6] = {1.f, 0.f, 0.5f, 0.f, 1.f, 0.f};
+  ARGBAffine(src_argb, kStride, benchmark_width_, benchmark_height_,
+             dst_argb_opt, kStride, benchmark_width_, benchmark_height_,
+             kShift);
+  for (int i = 0; i < kStride - 4; ++i) {
+    EXPECT_EQ((src_argb[i] + src_argb[i + 4] + 1) >> 1, dst_argb_opt[i]);
+  }
+  for (int i = kStride - 4; i < kStride; ++i) {
+    EXPECT_EQ(src_argb[i], dst_argb_opt[i]);
+  }
+
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(dst_argb_c);
+  free_aligned_buffer_page_end(dst_argb_opt);
+}
+
+static int TestI420Warp(int width,
+                        int height,
+                        int benchmark_iterations,
+                        int disable_cpu_flags,
+                        int benchmark_cpu_info,
+                        const float* matrix) {
+  const int kHalfWidth = (width + 1) / 2;
+  const int kHalfHeight = (height + 1) / 2;
+  const int kYSize = width * height;
+  const int kUVSize = kHalfWidth * kHalfHeight;
+  align_buffer_page_end(src_y, kYSize);
+  align_buffer_page_end(src_u, kUVSize);
+  align_buffer_page_end(src_v, kUVSize);
+  align_buffer_page_end(dst_c, kYSize + kUVSize * 2);
+  align_buffer_page_end(dst_opt, kYSize + kUVSize * 2);
+  MemRandomize(src_y, kYSize);
+  MemRandomize(src_u, kUVSize);
+  MemRandomize(src_v, kUVSize);
+
+  MaskCpuFlags(disable_cpu_flags);
+  I420Warp(src_y, width, src_u, kHalfWidth, src_v, kHalfWidth, width, height,
+           dst_c, width, dst_c + kYSize, kHalfWidth, dst_c + kYSize + kUVSize,
+           kHalfWidth, width, height, matrix);
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    I420Warp(src_y, width, src_u, kHalfWidth, src_v, kHalfWidth, width,
+             height, dst_opt, width, dst_opt + kYSize, kHalfWidth,
+             dst_opt + kYSize + kUVSize, kHalfWidth, width, height, matrix);
+  }
+  int max_diff = 0;
+  for (int i = 0; i < kYSize + kUVSize * 2; ++i) {
+    int abs_diff =
+        abs(static_cast<int>(dst_c[i]) - static_cast<int>(dst_opt[i]));
+    if (abs_diff > max_diff) {
+      max_diff = abs_diff;
+    }
+  }
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(dst_c);
+  free_aligned_buffer_page_end(dst_opt);
+  return max_diff;
+}
+
+TEST_F(LibYUVPlanarTest, I420Warp_Opt) {
+  float matrix[9];
+  WarpTestMatrix(benchmark_width_, benchmark_height_, matrix);
+  int max_diff =
+      TestI420Warp(benchmark_width_, benchmark_height_, benchmark_iterations_,
+                   disable_cpu_flags_, benchmark_cpu_info_, matrix);
+  EXPECT_EQ(0, max_diff);
+}
+
+TEST_F(LibYUVPlanarTest, I420Warp_Any) {
+  float matrix[9];
+  WarpTestMatrix(benchmark_width_ + 1, benchmark_height_, matrix);
+  int max_diff =
+      TestI420Warp(benchmark_width_ + 1, benchmark_height_,
+                   benchmark_iterations_, disable_cpu_flags_,
+                   benchmark_cpu_info_, matrix);
+  EXPECT_EQ(0, max_diff);
+}
+
+TEST_F(LibYUVPlanarTest, I420Warp_Identity) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int kHalfWidth = (kWidth + 1) / 2;
+  const int kHalfHeight = (kHeight + 1) / 2;
+  const int kSize = kWidth * kHeight + kHalfWidth * kHalfHeight * 2;
+  const float kIdentity[9] = {1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f};
+  align_buffer_page_end(src, kSize);
+  align_buffer_page_end(dst, kSize);
+  MemRandomize(src, kSize);
+  uint8_t* src_u = src + kWidth * kHeight;
+  uint8_t* src_v = src_u + kHalfWidth * kHalfHeight;
+  uint8_t* dst_u = dst + kWidth * kHeight;
+  uint8_t* dst_v = dst_u + kHalfWidth * kHalfHeight;
+  EXPECT_EQ(0, I420Warp(src, kWidth, src_u, kHalfWidth, src_v, kHalfWidth,
+                        kWidth, kHeight, dst, kWidth, dst_u, kHalfWidth, dst_v,
+                        kHalfWidth, kWidth, kHeight, kIdentity));
+  EXPECT_EQ(0, memcmp(src, dst, kSize));
+  free_aligned_buffer_page_end(src);
+  free_aligned_buffer_page_end(dst);
+}
+
 TEST_F(LibYUVPlanarTest, TestCopyPlane) {
   int err = 0;
   int yw = benchmark_width_;
@@ -2409,6 +2614,139 @@ TEST_F(LibYUVPlanarTest, DISABLED_ARM(ARGBBlurSmall_Opt)) {
   EXPECT_LE(max_diff, 1);
 }
 
+typedef int (*BoxBlurFunc)(const uint8_t* src,
+                           int src_stride,
+                           uint8_t* dst,
+                           int dst_stride,
+                           int width,
+                           int height,
+                           int radius);
+
+static int TestBoxBlur(BoxBlurFunc blur,
+                       int bpp,
+                       int width,
+                       int height,
+                       int benchmark_iterations,
+                       int disable_cpu_flags,
+                       int benchmark_cpu_info,
+                       int invert,
+                       int off,
+                       int radius) {
+  if (width < 1) {
+    width = 1;
+  }
+  const int kStride = width * bpp;
+  align_buffer_page_end(src_a, kStride * height + off);
+  align_buffer_page_end(dst_c, kStride * height);
+  align_buffer_page_end(dst_opt, kStride * height);
+  for (int i = 0; i < kStride * height; ++i) {
+    src_a[i + off] = (fastrand() & 0xff);
+  }
+  memset(dst_c, 0, kStride * height);
+  memset(dst_opt, 0, kStride * height);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, blur(src_a + off, kStride, dst_c, kStride, width,
+                    invert * height, radius));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    blur(src_a + off, kStride, dst_opt, kStride, width, invert * height,
+         radius);
+  }
+  int max_diff = 0;
+  for (int i = 0; i < kStride * height; ++i) {
+    int abs_diff =
+        abs(static_cast<int>(dst_c[i]) - static_cast<int>(dst_opt[i]));
+    if (abs_diff > max_diff) {
+      max_diff = abs_diff;
+    }
+  }
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(dst_c);
+  free_aligned_buffer_page_end(dst_opt);
+  return max_diff;
+}
+
+#define TESTBOXBLUR(NAME, FUNC, BPP, RADIUS)                                 \
+  TEST_F(LibYUVPlanarTest, NAME##_Any) {                                     \
+    EXPECT_EQ(0, TestBoxBlur(FUNC, BPP, benchmark_width_ + 1,                \
+                             benchmark_height_, benchmark_iterations_,       \
+                             disable_cpu_flags_, benchmark_cpu_info_, +1, 0, \
+                             RADIUS));                                       \
+  }                                                                          \
+  TEST_F(LibYUVPlanarTest, NAME##_Unaligned) {                               \
+    EXPECT_EQ(0, TestBoxBlur(FUNC, BPP, benchmark_width_, benchmark_height_, \
+                             benchmark_iterations_, disable_cpu_flags_,      \
+                             benchmark_cpu_info_, +1, 1, RADIUS));           \
+  }                                                                          \
+  TEST_F(LibYUVPlanarTest, NAME##_Invert) {                                  \
+    EXPECT_EQ(0, TestBoxBlur(FUNC, BPP, benchmark_width_, benchmark_height_, \
+                             benchmark_iterations_, disable_cpu_flags_,      \
+                             benchmark_cpu_info_, -1, 0, RADIUS));           \
+  }                                                                          \
+  TEST_F(LibYUVPlanarTest, NAME##_Opt) {                                     \
+    EXPECT_EQ(0, TestBoxBlur(FUNC, BPP, benchmark_width_, benchmark_height_, \
+                             benchmark_iterations_, disable_cpu_flags_,      \
+                             benchmark_cpu_info_, +1, 0, RADIUS));           \
+  }
+
+TESTBOXBLUR(BoxBlurPlane, BoxBlurPlane, 1, kBlurSize)
+TESTBOXBLUR(BoxBlurUVPlane, BoxBlurUVPlane, 2, kBlurSize)
+TESTBOXBLUR(ARGBBoxBlur, ARGBBoxBlur, 4, kBlurSize)
+TESTBOXBLUR(ARGBBoxBlurSmall, ARGBBoxBlur, 4, kBlurSmallSize)
+#undef TESTBOXBLUR
+
+// Compare against a brute force average of the clipped box.
+TEST_F(LibYUVPlanarTest, BoxBlur_Reference) {
+  const int kWidth = 37;
+  const int kHeight = 23;
+  const int kBpp[3] = {1, 2, 4};
+  const BoxBlurFunc kBlur[3] = {BoxBlurPlane, BoxBlurUVPlane, ARGBBoxBlur};
+  const int kRadius[4] = {0, 1, 5, 40};
+  align_buffer_page_end(src, kWidth * kHeight * 4);
+  align_buffer_page_end(dst, kWidth * kHeight * 4);
+  for (int i = 0; i < kWidth * kHeight * 4; ++i) {
+    src[i] = (fastrand() & 0xff);
+  }
+  for (int f = 0; f < 3; ++f) {
+    const int bpp = kBpp[f];
+    const int stride = kWidth * bpp;
+    for (int r = 0; r < 4; ++r) {
+      const int radius = kRadius[r];
+      int max_diff = 0;
+      EXPECT_EQ(0, kBlur[f](src, stride, dst, stride, kWidth, kHeight, radius));
+      for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+          for (int c = 0; c < bpp; ++c) {
+            int sum = 0;
+            int count = 0;
+            for (int j = y - radius; j <= y + radius; ++j) {
+              for (int i = x - radius; i <= x + radius; ++i) {
+                if (j >= 0 && j < kHeight && i >= 0 && i < kWidth) {
+                  sum += src[j * stride + i * bpp + c];
+                  ++count;
+                }
+              }
+            }
+            int expected = (sum * 2 + count) / (count * 2);
+            int abs_diff = abs(dst[y * stride + x * bpp + c] - expected);
+            if (abs_diff > max_diff) {
+              max_diff = abs_diff;
+            }
+          }
+        }
+      }
+      EXPECT_LE(max_diff, 1) << "bpp " << bpp << " radius " << radius;
+      if (radius == 0) {
+        EXPECT_EQ(0, memcmp(src, dst, stride * kHeight));
+      }
+    }
+  }
+  EXPECT_EQ(-1, BoxBlurPlane(src, kWidth, dst, kWidth, kWidth, kHeight, -1));
+  free_aligned_buffer_page_end(src);
+  free_aligned_buffer_page_end(dst);
+}
+
 TEST_F(LibYUVPlanarTest, DISABLED_ARM(TestARGBPolynomial)) {
   SIMD_ALIGNED(uint8_t orig_pixels[1280][4]);
   SIMD_ALIGNED(uint8_t dst_pixels_opt[1280][4]);
@@ -4432,6 +4770,140 @@ TEST_F(LibYUVPlanarTest, TestGaussPlane_F32) {
   free_aligned_buffer_page_end(orig_pixels);
 }
 
+static int TestGaussPlane(int width,
+                          int height,
+                          int benchmark_iterations,
+                          int disable_cpu_flags,
+                          int benchmark_cpu_info,
+                          int invert,
+                          int kernel_size) {
+  const int kSize = width * height;
+  align_buffer_page_end(orig_pixels, kSize);
+  align_buffer_page_end(dst_pixels_opt, kSize);
+  align_buffer_page_end(dst_pixels_c, kSize);
+  MemRandomize(orig_pixels, kSize);
+  memset(dst_pixels_opt, 1, kSize);
+  memset(dst_pixels_c, 2, kSize);
+
+  MaskCpuFlags(disable_cpu_flags);
+  EXPECT_EQ(0, GaussPlane(orig_pixels, width, dst_pixels_c, width, width,
+                          invert * height, kernel_size));
+  MaskCpuFlags(benchmark_cpu_info);
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    GaussPlane(orig_pixels, width, dst_pixels_opt, width, width,
+               invert * height, kernel_size);
+  }
+  int max_diff = 0;
+  for (int i = 0; i < kSize; ++i) {
+    int abs_diff = abs(static_cast<int>(dst_pixels_c[i]) -
+                       static_cast<int>(dst_pixels_opt[i]));
+    if (abs_diff > max_diff) {
+      max_diff = abs_diff;
+    }
+  }
+  free_aligned_buffer_page_end(dst_pixels_c);
+  free_aligned_buffer_page_end(dst_pixels_opt);
+  free_aligned_buffer_page_end(orig_pixels);
+  return max_diff;
+}
+
+TEST_F(LibYUVPlanarTest, TestGaussPlane_Opt) {
+  EXPECT_EQ(0, TestGaussPlane(benchmark_width_, benchmark_height_,
+                              benchmark_iterations_, disable_cpu_flags_,
+                              benchmark_cpu_info_, +1, 5));
+}
+
+TEST_F(LibYUVPlanarTest, TestGaussPlane_Any) {
+  EXPECT_EQ(0, TestGaussPlane(benchmark_width_ + 1, benchmark_height_,
+                              benchmark_iterations_, disable_cpu_flags_,
+                              benchmark_cpu_info_, +1, 5));
+}
+
+TEST_F(LibYUVPlanarTest, TestGaussPlane_Invert) {
+  EXPECT_EQ(0, TestGaussPlane(benchmark_width_, benchmark_height_,
+                              benchmark_iterations_, disable_cpu_flags_,
+                              benchmark_cpu_info_, -1, 5));
+}
+
+TEST_F(LibYUVPlanarTest, TestGauss7Plane_Opt) {
+  EXPECT_EQ(0, TestGaussPlane(benchmark_width_, benchmark_height_,
+                              benchmark_iterations_, disable_cpu_flags_,
+                              benchmark_cpu_info_, +1, 7));
+}
+
+TEST_F(LibYUVPlanarTest, TestGauss7Plane_Any) {
+  EXPECT_EQ(0, TestGaussPlane(benchmark_width_ + 1, benchmark_height_,
+                              benchmark_iterations_, disable_cpu_flags_,
+                              benchmark_cpu_info_, +1, 7));
+}
+
+// A constant plane blurs to itself and an impulse spreads as the kernel.
+TEST_F(LibYUVPlanarTest, TestGaussPlane_Kernel) {
+  const int kWidth = 33;
+  const int kHeight = 9;
+  SIMD_ALIGNED(uint8_t orig_pixels[kHeight][kWidth]);
+  SIMD_ALIGNED(uint8_t dst_pixels[kHeight][kWidth]);
+  static const int kTaps7[7] = {1, 6, 15, 20, 15, 6, 1};
+
+  memset(orig_pixels, 200, sizeof(orig_pixels));
+  EXPECT_EQ(0, GaussPlane(&orig_pixels[0][0], kWidth, &dst_pixels[0][0],
+                          kWidth, kWidth, kHeight, 5));
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      EXPECT_EQ(200, dst_pixels[y][x]);
+    }
+  }
+
+  memset(orig_pixels, 0, sizeof(orig_pixels));
+  orig_pixels[4][16] = 255;
+  EXPECT_EQ(0, GaussPlane(&orig_pixels[0][0], kWidth, &dst_pixels[0][0],
+                          kWidth, kWidth, kHeight, 7));
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      int dy = y - 4 + 3;
+      int dx = x - 16 + 3;
+      int expected = 0;
+      if (dy >= 0 && dy < 7 && dx >= 0 && dx < 7) {
+        expected = (255 * kTaps7[dy] * kTaps7[dx] + 2048) >> 12;
+      }
+      EXPECT_NEAR(expected, dst_pixels[y][x], 1) << x << "," << y;
+    }
+  }
+  EXPECT_EQ(-1, GaussPlane(&orig_pixels[0][0], kWidth, &dst_pixels[0][0],
+                           kWidth, kWidth, kHeight, 3));
+}
+
+TEST_F(LibYUVPlanarTest, TestGaussPlane_16) {
+  const int kPixels = benchmark_width_ * benchmark_height_;
+  align_buffer_page_end(orig_pixels, kPixels * 2);
+  align_buffer_page_end(dst_pixels_opt, kPixels * 2);
+  align_buffer_page_end(dst_pixels_c, kPixels * 2);
+  MemRandomize(orig_pixels, kPixels * 2);
+  memset(dst_pixels_opt, 1, kPixels * 2);
+  memset(dst_pixels_c, 2, kPixels * 2);
+
+  MaskCpuFlags(disable_cpu_flags_);
+  EXPECT_EQ(0, GaussPlane_16(reinterpret_cast<const uint16_t*>(orig_pixels),
+                             benchmark_width_,
+                             reinterpret_cast<uint16_t*>(dst_pixels_c),
+                             benchmark_width_, benchmark_width_,
+                             benchmark_height_));
+  MaskCpuFlags(benchmark_cpu_info_);
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    GaussPlane_16(reinterpret_cast<const uint16_t*>(orig_pixels),
+                  benchmark_width_, reinterpret_cast<uint16_t*>(dst_pixels_opt),
+                  benchmark_width_, benchmark_width_, benchmark_height_);
+  }
+  for (int i = 0; i < kPixels; ++i) {
+    EXPECT_EQ(reinterpret_cast<uint16_t*>(dst_pixels_c)[i],
+              reinterpret_cast<uint16_t*>(dst_pixels_opt)[i]);
+  }
+
+  free_aligned_buffer_page_end(dst_pixels_c);
+  free_aligned_buffer_page_end(dst_pixels_opt);
+  free_aligned_buffer_page_end(orig_pixels);
+}
+
 TEST_F(LibYUVPlanarTest, HalfMergeUVPlane_Opt) {
   int dst_width = (benchmark_width_ + 1) / 2;
   int dst_height = (benchmark_height_ + 1) / 2;
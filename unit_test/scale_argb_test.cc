@@ -8,12 +8,15 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <math.h>
 #include <stdlib.h>
 #include <time.h>
 
 #include "../unit_test/unit_test.h"
 #include "libyuv/convert_argb.h"
+#include "libyuv/convert_from_argb.h"
 #include "libyuv/cpu_id.h"
+#include "libyuv/planar_functions.h"
 #include "libyuv/scale_argb.h"
 #include "libyuv/video_common.h"
 
@@ -585,4 +588,811 @@ TEST_F(LibYUVScaleTest, ARGBTest4x) {
   free_aligned_buffer_page_end(orig_pixels);
 }
 
+// Test premultiplied scale matches attenuate, scale and unattenuate.
+static int ARGBPremultipliedTestFilter(int src_width,
+                                       int src_height,
+                                       int dst_width,
+                                       int dst_height,
+                                       FilterMode f,
+                                       int benchmark_iterations) {
+  const int kSrcStride = Abs(src_width) * 4;
+  const int kDstStride = dst_width * 4;
+  align_buffer_page_end(src_argb, kSrcStride * Abs(src_height));
+  align_buffer_page_end(tmp_argb, kSrcStride * Abs(src_height));
+  align_buffer_page_end(dst_argb_ref, kDstStride * dst_height);
+  align_buffer_page_end(dst_argb_opt, kDstStride * dst_height);
+  MemRandomize(src_argb, kSrcStride * Abs(src_height));
+  // Make some pixels fully transparent.
+  for (int i = 0; i < Abs(src_width) * Abs(src_height); i += 3) {
+    src_argb[i * 4 + 3] = 0;
+  }
+
+  ARGBAttenuate(src_argb, kSrcStride, tmp_argb, kSrcStride, Abs(src_width),
+                Abs(src_height));
+  ARGBScale(tmp_argb, kSrcStride, src_width, src_height, dst_argb_ref,
+            kDstStride, dst_width, dst_height, f);
+  ARGBUnattenuate(dst_argb_ref, kDstStride, dst_argb_ref, kDstStride,
+                  dst_width, dst_height);
+
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    ARGBScalePremultiplied(src_argb, kSrcStride, src_width, src_height,
+                           dst_argb_opt, kDstStride, dst_width, dst_height, f);
+  }
+
+  int max_diff = 0;
+  if (f == kFilterNone) {
+    ARGBScale(src_argb, kSrcStride, src_width, src_height, dst_argb_ref,
+              kDstStride, dst_width, dst_height, f);
+  }
+  for (int i = 0; i < kDstStride * dst_height; ++i) {
+    int abs_diff = Abs(dst_argb_ref[i] - dst_argb_opt[i]);
+    if (abs_diff > max_diff) {
+      max_diff = abs_diff;
+    }
+  }
+
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(tmp_argb);
+  free_aligned_buffer_page_end(dst_argb_ref);
+  free_aligned_buffer_page_end(dst_argb_opt);
+  return max_diff;
+}
+
+#define TEST_PREMULTIPLIED(name, src_width, src_height, dst_width, dst_height) \
+  TEST_F(LibYUVScaleTest, ARGBScalePremultiplied_##name) {                     \
+    EXPECT_EQ(0, ARGBPremultipliedTestFilter(src_width, src_height, dst_width, \
+                                             dst_height, kFilterNone, 1));     \
+    EXPECT_EQ(0, ARGBPremultipliedTestFilter(src_width, src_height, dst_width, \
+                                             dst_height, kFilterLinear, 1));   \
+    EXPECT_EQ(0, ARGBPremultipliedTestFilter(src_width, src_height, dst_width, \
+                                             dst_height, kFilterBilinear, 1)); \
+    EXPECT_EQ(0, ARGBPremultipliedTestFilter(src_width, src_height, dst_width, \
+                                             dst_height, kFilterBox,           \
+                                             benchmark_iterations_));          \
+  }
+
+TEST_PREMULTIPLIED(Down2, 640, 360, 320, 180)
+TEST_PREMULTIPLIED(Down4, 640, 360, 160, 90)
+TEST_PREMULTIPLIED(Down3by4, 640, 360, 480, 270)
+TEST_PREMULTIPLIED(Down37, 1280, 720, 37, 21)
+TEST_PREMULTIPLIED(Up2, 320, 180, 640, 360)
+TEST_PREMULTIPLIED(Up, 123, 57, 640, 361)
+TEST_PREMULTIPLIED(Invert, 640, -360, 213, 121)
+TEST_PREMULTIPLIED(Mirror, -640, 360, 213, 121)
+#undef TEST_PREMULTIPLIED
+
+// Linear reduces to point sampling when only the height changes.
+TEST_F(LibYUVScaleTest, ARGBScalePremultiplied_Vertical) {
+  EXPECT_EQ(0, ARGBPremultipliedTestFilter(320, 180, 320, 397, kFilterBilinear,
+                                           benchmark_iterations_));
+  EXPECT_EQ(0, ARGBPremultipliedTestFilter(320, 397, 320, 180, kFilterBox,
+                                           benchmark_iterations_));
+}
+
+TEST_F(LibYUVScaleTest, ARGBScaleClipPremultiplied) {
+  const int kSrcWidth = 317;
+  const int kSrcHeight = 233;
+  const int kDstWidth = 640;
+  const int kDstHeight = 480;
+  align_buffer_page_end(src_argb, kSrcWidth * kSrcHeight * 4);
+  align_buffer_page_end(dst_argb_ref, kDstWidth * kDstHeight * 4);
+  align_buffer_page_end(dst_argb_opt, kDstWidth * kDstHeight * 4);
+  MemRandomize(src_argb, kSrcWidth * kSrcHeight * 4);
+  memset(dst_argb_opt, 2, kDstWidth * kDstHeight * 4);
+
+  ARGBScalePremultiplied(src_argb, kSrcWidth * 4, kSrcWidth, kSrcHeight,
+                         dst_argb_ref, kDstWidth * 4, kDstWidth, kDstHeight,
+                         kFilterBilinear);
+  EXPECT_EQ(0, ARGBScaleClipPremultiplied(
+                   src_argb, kSrcWidth * 4, kSrcWidth, kSrcHeight, dst_argb_opt,
+                   kDstWidth * 4, kDstWidth, kDstHeight, 100, 50, 300, 200,
+                   kFilterBilinear));
+  for (int y = 0; y < kDstHeight; ++y) {
+    for (int x = 0; x < kDstWidth * 4; ++x) {
+      int i = y * kDstWidth * 4 + x;
+      if (y >= 50 && y < 250 && x >= 100 * 4 && x < 400 * 4) {
+        EXPECT_EQ(dst_argb_ref[i], dst_argb_opt[i]);
+      } else {
+        EXPECT_EQ(2, dst_argb_opt[i]);
+      }
+    }
+  }
+
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(dst_argb_ref);
+  free_aligned_buffer_page_end(dst_argb_opt);
+}
+
+TEST_F(LibYUVScaleTest, ARGBScaleLinearLight) {
+  const int kSrcWidth = 64;
+  const int kSrcHeight = 32;
+  align_buffer_page_end(src_argb, kSrcWidth * kSrcHeight * 4);
+  align_buffer_page_end(dst_argb, kSrcWidth * kSrcHeight * 4);
+
+  // Checkerboard of opaque white and transparent black.
+  for (int y = 0; y < kSrcHeight; ++y) {
+    for (int x = 0; x < kSrcWidth; ++x) {
+      memset(src_argb + (y * kSrcWidth + x) * 4, ((x ^ y) & 1) ? 255 : 0, 4);
+    }
+  }
+  for (int f = kFilterBilinear; f <= kFilterBox; ++f) {
+    EXPECT_EQ(0, ARGBScaleLinearLight(src_argb, kSrcWidth * 4, kSrcWidth,
+                                      kSrcHeight, dst_argb, kSrcWidth * 2,
+                                      kSrcWidth / 2, kSrcHeight / 2,
+                                      static_cast<FilterMode>(f)));
+    for (int i = 0; i < kSrcWidth / 2 * kSrcHeight / 2; ++i) {
+      // Color is averaged in linear light, alpha is averaged linearly.
+      EXPECT_EQ(188, dst_argb[i * 4 + 0]);
+      EXPECT_EQ(188, dst_argb[i * 4 + 1]);
+      EXPECT_EQ(188, dst_argb[i * 4 + 2]);
+      EXPECT_EQ(128, dst_argb[i * 4 + 3]);
+    }
+  }
+
+  // Constant color is unchanged when scaled up.
+  for (int i = 0; i < kSrcWidth * kSrcHeight; ++i) {
+    src_argb[i * 4 + 0] = 10;
+    src_argb[i * 4 + 1] = 100;
+    src_argb[i * 4 + 2] = 200;
+    src_argb[i * 4 + 3] = 77;
+  }
+  EXPECT_EQ(0, ARGBScaleLinearLight(src_argb, kSrcWidth * 4, kSrcWidth / 4,
+                                    kSrcHeight / 4, dst_argb, kSrcWidth * 4,
+                                    kSrcWidth, kSrcHeight, kFilterBilinear));
+  for (int i = 0; i < kSrcWidth * kSrcHeight; ++i) {
+    EXPECT_EQ(10, dst_argb[i * 4 + 0]);
+    EXPECT_EQ(100, dst_argb[i * 4 + 1]);
+    EXPECT_EQ(200, dst_argb[i * 4 + 2]);
+    EXPECT_EQ(77, dst_argb[i * 4 + 3]);
+  }
+
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(dst_argb);
+}
+
+// Test AR64Scale C vs Opt and return maximum channel difference.
+static int AR64TestFilter(int src_width,
+                          int src_height,
+                          int dst_width,
+                          int dst_height,
+                          FilterMode f,
+                          int benchmark_iterations,
+                          int disable_cpu_flags,
+                          int benchmark_cpu_info) {
+  if (!SizeValid(src_width, src_height, dst_width, dst_height)) {
+    return 0;
+  }
+  const int src_stride_ar64 = Abs(src_width) * 4;
+  const int dst_stride_ar64 = dst_width * 4;
+  const int64_t src_size = src_stride_ar64 * Abs(src_height) * 2LL;
+  const int64_t dst_size = dst_stride_ar64 * dst_height * 2LL;
+  align_buffer_page_end(src_ar64, src_size);
+  align_buffer_page_end(dst_ar64_c, dst_size);
+  align_buffer_page_end(dst_ar64_opt, dst_size);
+  MemRandomize(src_ar64, src_size);
+  memset(dst_ar64_c, 2, dst_size);
+  memset(dst_ar64_opt, 3, dst_size);
+
+  MaskCpuFlags(disable_cpu_flags);  // Disable all CPU optimization.
+  double c_time = get_time();
+  AR64Scale(reinterpret_cast<uint16_t*>(src_ar64), src_stride_ar64, src_width,
+            src_height, reinterpret_cast<uint16_t*>(dst_ar64_c),
+            dst_stride_ar64, dst_width, dst_height, f);
+  c_time = (get_time() - c_time);
+
+  MaskCpuFlags(benchmark_cpu_info);  // Enable all CPU optimization.
+  double opt_time = get_time();
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    AR64Scale(reinterpret_cast<uint16_t*>(src_ar64), src_stride_ar64,
+              src_width, src_height, reinterpret_cast<uint16_t*>(dst_ar64_opt),
+              dst_stride_ar64, dst_width, dst_height, f);
+  }
+  opt_time = (get_time() - opt_time) / benchmark_iterations;
+  printf("filter %d - %8d us C - %8d us OPT\n", f,
+         static_cast<int>(c_time * 1e6), static_cast<int>(opt_time * 1e6));
+
+  int max_diff = 0;
+  const uint16_t* c16 = reinterpret_cast<uint16_t*>(dst_ar64_c);
+  const uint16_t* opt16 = reinterpret_cast<uint16_t*>(dst_ar64_opt);
+  for (int i = 0; i < dst_stride_ar64 * dst_height; ++i) {
+    int abs_diff = Abs(c16[i] - opt16[i]);
+    if (abs_diff > max_diff) {
+      max_diff = abs_diff;
+    }
+  }
+  free_aligned_buffer_page_end(src_ar64);
+  free_aligned_buffer_page_end(dst_ar64_c);
+  free_aligned_buffer_page_end(dst_ar64_opt);
+  return max_diff;
+}
+
+#define TEST_AR64SCALE(name, nom, denom)                                     \
+  TEST_F(LibYUVScaleTest, AR64Scale##name) {                                 \
+    for (int f = kFilterNone; f <= kFilterBox; ++f) {                        \
+      int diff = AR64TestFilter(                                             \
+          benchmark_width_, benchmark_height_,                               \
+          benchmark_width_ * nom / denom, benchmark_height_ * nom / denom,   \
+          static_cast<FilterMode>(f), benchmark_iterations_,                 \
+          disable_cpu_flags_, benchmark_cpu_info_);                          \
+      EXPECT_EQ(0, diff);                                                    \
+    }                                                                        \
+  }
+
+TEST_AR64SCALE(Down2, 1, 2)
+TEST_AR64SCALE(Down3by4, 3, 4)
+TEST_AR64SCALE(Up2, 2, 1)
+#undef TEST_AR64SCALE
+
+TEST_F(LibYUVScaleTest, AR64ScaleMatchesARGBScale) {
+  const int kSrcWidth = 160;
+  const int kSrcHeight = 90;
+  const int kDstWidth = 117;
+  const int kDstHeight = 61;
+  align_buffer_page_end(src_argb, kSrcWidth * kSrcHeight * 4);
+  align_buffer_page_end(src_ar64, kSrcWidth * kSrcHeight * 8);
+  align_buffer_page_end(dst_argb, kDstWidth * kDstHeight * 4);
+  align_buffer_page_end(dst_ar64, kDstWidth * kDstHeight * 8);
+  MemRandomize(src_argb, kSrcWidth * kSrcHeight * 4);
+  ARGBToAR64(src_argb, kSrcWidth * 4, reinterpret_cast<uint16_t*>(src_ar64),
+             kSrcWidth * 4, kSrcWidth, kSrcHeight);
+
+  for (int f = kFilterNone; f <= kFilterBox; ++f) {
+    EXPECT_EQ(0, ARGBScale(src_argb, kSrcWidth * 4, kSrcWidth, kSrcHeight,
+                           dst_argb, kDstWidth * 4, kDstWidth, kDstHeight,
+                           static_cast<FilterMode>(f)));
+    EXPECT_EQ(0, AR64Scale(reinterpret_cast<uint16_t*>(src_ar64),
+                           kSrcWidth * 4, kSrcWidth, kSrcHeight,
+                           reinterpret_cast<uint16_t*>(dst_ar64), kDstWidth * 4,
+                           kDstWidth, kDstHeight, static_cast<FilterMode>(f)));
+    const uint16_t* dst16 = reinterpret_cast<uint16_t*>(dst_ar64);
+    int max_diff = 0;
+    for (int i = 0; i < kDstWidth * kDstHeight * 4; ++i) {
+      int abs_diff = Abs(dst_argb[i] - (dst16[i] >> 8));
+      if (abs_diff > max_diff) {
+        max_diff = abs_diff;
+      }
+    }
+    // ARGBScale filters with 7 bit fractions so random pixels may differ.
+    EXPECT_LE(max_diff, (f == kFilterNone) ? 0 : 4);
+  }
+
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(src_ar64);
+  free_aligned_buffer_page_end(dst_argb);
+  free_aligned_buffer_page_end(dst_ar64);
+}
+
+TEST_F(LibYUVScaleTest, AR30Scale) {
+  const int kSrcWidth = benchmark_width_;
+  const int kSrcHeight = benchmark_height_;
+  const int kDstWidth = kSrcWidth * 3 / 4;
+  const int kDstHeight = kSrcHeight * 3 / 4;
+  align_buffer_page_end(src_ar30, kSrcWidth * kSrcHeight * 4);
+  align_buffer_page_end(dst_ar30_c, kDstWidth * kDstHeight * 4);
+  align_buffer_page_end(dst_ar30_opt, kDstWidth * kDstHeight * 4);
+  MemRandomize(src_ar30, kSrcWidth * kSrcHeight * 4);
+
+  for (int f = kFilterNone; f <= kFilterBox; ++f) {
+    MaskCpuFlags(disable_cpu_flags_);
+    EXPECT_EQ(0, AR30Scale(src_ar30, kSrcWidth * 4, kSrcWidth, kSrcHeight,
+                           dst_ar30_c, kDstWidth * 4, kDstWidth, kDstHeight,
+                           static_cast<FilterMode>(f)));
+    MaskCpuFlags(benchmark_cpu_info_);
+    for (int i = 0; i < benchmark_iterations_; ++i) {
+      EXPECT_EQ(0, AR30Scale(src_ar30, kSrcWidth * 4, kSrcWidth, kSrcHeight,
+                             dst_ar30_opt, kDstWidth * 4, kDstWidth,
+                             kDstHeight, static_cast<FilterMode>(f)));
+    }
+    for (int i = 0; i < kDstWidth * kDstHeight * 4; ++i) {
+      EXPECT_EQ(dst_ar30_c[i], dst_ar30_opt[i]);
+    }
+  }
+
+  // A constant 10 bit color and alpha are unchanged by filtering.
+  const uint32_t kPixel = 3u << 30 | 1000u << 20 | 513u << 10 | 7u;
+  for (int i = 0; i < kSrcWidth * kSrcHeight; ++i) {
+    memcpy(src_ar30 + i * 4, &kPixel, 4);
+  }
+  for (int f = kFilterLinear; f <= kFilterBox; ++f) {
+    EXPECT_EQ(0, AR30Scale(src_ar30, kSrcWidth * 4, kSrcWidth, kSrcHeight,
+                           dst_ar30_opt, kDstWidth * 4, kDstWidth, kDstHeight,
+                           static_cast<FilterMode>(f)));
+    for (int i = 0; i < kDstWidth * kDstHeight; ++i) {
+      uint32_t pixel;
+      memcpy(&pixel, dst_ar30_opt + i * 4, 4);
+      EXPECT_EQ(kPixel, pixel);
+    }
+  }
+
+  free_aligned_buffer_page_end(src_ar30);
+  free_aligned_buffer_page_end(dst_ar30_c);
+  free_aligned_buffer_page_end(dst_ar30_opt);
+}
+
+static float HalfToFloat(uint16_t h) {
+  int exponent = (h >> 10) & 31;
+  int mantissa = h & 1023;
+  float value = exponent ? ldexpf(static_cast<float>(mantissa | 1024),
+                                  exponent - 25)
+                         : ldexpf(static_cast<float>(mantissa), -24);
+  return (h & 0x8000) ? -value : value;
+}
+
+static float TensorValue(const uint8_t* tensor, TensorType type, int i) {
+  if (type == kTensorFloat32) {
+    return reinterpret_cast<const float*>(tensor)[i];
+  }
+  if (type == kTensorFloat16) {
+    return HalfToFloat(reinterpret_cast<const uint16_t*>(tensor)[i]);
+  }
+  return reinterpret_cast<const int8_t*>(tensor)[i];
+}
+
+// Convert a crop of I420 or NV12 to an RGB tensor with C and Opt and
+// compare both with I420ToARGB and ARGBScale of the crop, normalized here.
+// Returns the maximum difference in 8 bit pixel levels.
+static float RGBTensorTestFilter(int src_width,
+                                 int src_height,
+                                 int dst_width,
+                                 int dst_height,
+                                 TensorLayout layout,
+                                 TensorType type,
+                                 FilterMode f,
+                                 bool nv12,
+                                 int benchmark_iterations,
+                                 int disable_cpu_flags,
+                                 int benchmark_cpu_info) {
+  const int crop_x = src_width > 4 ? 3 : 0;
+  const int crop_y = src_height > 8 ? 5 : 0;
+  const int crop_width = src_width - crop_x - (src_width > 8 ? 2 : 0);
+  const int crop_height = src_height - crop_y - (src_height > 8 ? 1 : 0);
+  const int src_stride_uv = (src_width + 1) / 2;
+  const int src_height_uv = (src_height + 1) / 2;
+  const int kElementSize =
+      type == kTensorFloat32 ? 4 : (type == kTensorFloat16 ? 2 : 1);
+  const int tensor_size = dst_width * dst_height * 3 * kElementSize;
+  // ImageNet mean and std for floats.  Int8 saturates part of G and B.
+  const float kScaleFloat[3] = {1.f / (255.f * 0.229f), 1.f / (255.f * 0.224f),
+                                1.f / (255.f * 0.225f)};
+  const float kBiasFloat[3] = {-0.485f / 0.229f, -0.456f / 0.224f,
+                               -0.406f / 0.225f};
+  const float kScaleInt8[3] = {1.f, 0.5f, 1.f};
+  const float kBiasInt8[3] = {-128.f, -10.f, -64.f};
+  const float* scale = type == kTensorInt8 ? kScaleInt8 : kScaleFloat;
+  const float* bias = type == kTensorInt8 ? kBiasInt8 : kBiasFloat;
+
+  align_buffer_page_end(src_y, src_width * src_height);
+  align_buffer_page_end(src_u, src_stride_uv * src_height_uv);
+  align_buffer_page_end(src_v, src_stride_uv * src_height_uv);
+  align_buffer_page_end(src_uv, src_stride_uv * 2 * src_height_uv);
+  align_buffer_page_end(src_argb, src_width * src_height * 4);
+  align_buffer_page_end(ref_argb, dst_width * dst_height * 4);
+  align_buffer_page_end(dst_c, tensor_size);
+  align_buffer_page_end(dst_opt, tensor_size);
+  MemRandomize(src_y, src_width * src_height);
+  MemRandomize(src_u, src_stride_uv * src_height_uv);
+  MemRandomize(src_v, src_stride_uv * src_height_uv);
+  MergeUVPlane(src_u, src_stride_uv, src_v, src_stride_uv, src_uv,
+               src_stride_uv * 2, src_stride_uv, src_height_uv);
+  memset(dst_c, 1, tensor_size);
+  memset(dst_opt, 2, tensor_size);
+
+  for (int i = 0; i < benchmark_iterations + 1; ++i) {
+    uint8_t* dst = i ? dst_opt : dst_c;
+    MaskCpuFlags(i ? benchmark_cpu_info : disable_cpu_flags);
+    if (nv12) {
+      EXPECT_EQ(0, NV12ToRGBTensor(src_y, src_width, src_uv, src_stride_uv * 2,
+                                   &kYuvI601Constants, src_width, src_height,
+                                   crop_x, crop_y, crop_width, crop_height,
+                                   dst, dst_width, dst_height, scale, bias,
+                                   layout, type, f));
+    } else {
+      EXPECT_EQ(0, I420ToRGBTensor(src_y, src_width, src_u, src_stride_uv,
+                                   src_v, src_stride_uv, &kYuvI601Constants,
+                                   src_width, src_height, crop_x, crop_y,
+                                   crop_width, crop_height, dst, dst_width,
+                                   dst_height, scale, bias, layout, type, f));
+    }
+  }
+
+  I420ToARGB(src_y, src_width, src_u, src_stride_uv, src_v, src_stride_uv,
+             src_argb, src_width * 4, src_width, src_height);
+  ARGBScale(src_argb + crop_y * src_width * 4 + crop_x * 4, src_width * 4,
+            crop_width, crop_height, ref_argb, dst_width * 4, dst_width,
+            dst_height, f);
+
+  float max_diff = 0.f;
+  for (int y = 0; y < dst_height; ++y) {
+    for (int x = 0; x < dst_width; ++x) {
+      for (int c = 0; c < 3; ++c) {
+        const int index = layout == kTensorCHW
+                              ? (c * dst_height + y) * dst_width + x
+                              : (y * dst_width + x) * 3 + c;
+        float expected = ref_argb[(y * dst_width + x) * 4 + 2 - c] * scale[c] +
+                         bias[c];
+        if (type == kTensorInt8) {
+          expected = expected < -128.f ? -128.f : expected;
+          expected = rintf(expected > 127.f ? 127.f : expected);
+        }
+        const float value_c = TensorValue(dst_c, type, index);
+        const float value_opt = TensorValue(dst_opt, type, index);
+        const float diff_c = fabsf(value_c - expected) / scale[c];
+        const float diff_opt = fabsf(value_opt - value_c) / scale[c];
+        max_diff = diff_c > max_diff ? diff_c : max_diff;
+        max_diff = diff_opt > max_diff ? diff_opt : max_diff;
+      }
+    }
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(src_uv);
+  free_aligned_buffer_page_end(src_argb);
+  free_aligned_buffer_page_end(ref_argb);
+  free_aligned_buffer_page_end(dst_c);
+  free_aligned_buffer_page_end(dst_opt);
+  return max_diff;
+}
+
+// Point sampling matches ARGBScale exactly.  Bilinear filtering rounds rows
+// and columns in a different order when scaling down.
+#define TEST_RGBTENSOR1(name, fmt, nv12, layout, type, filter, nom, denom, \
+                        max_diff)                                          \
+  TEST_F(LibYUVScaleTest, fmt##ToRGBTensor_##name) {                       \
+    float diff = RGBTensorTestFilter(                                      \
+        benchmark_width_, benchmark_height_,                               \
+        (benchmark_width_ * nom + denom - 1) / denom,                      \
+        (benchmark_height_ * nom + denom - 1) / denom, kTensor##layout,    \
+        kTensor##type, kFilter##filter, nv12, benchmark_iterations_,       \
+        disable_cpu_flags_, benchmark_cpu_info_);                          \
+    EXPECT_LE(diff, max_diff);                                             \
+  }
+
+#define TEST_RGBTENSOR(fmt, nv12)                                             \
+  TEST_RGBTENSOR1(CHW_Float32, fmt, nv12, CHW, Float32, Bilinear, 3, 4, 3.f) \
+  TEST_RGBTENSOR1(HWC_Float32, fmt, nv12, HWC, Float32, Bilinear, 3, 4, 3.f) \
+  TEST_RGBTENSOR1(CHW_Float16, fmt, nv12, CHW, Float16, Bilinear, 5, 4, 1.f) \
+  TEST_RGBTENSOR1(HWC_Float16, fmt, nv12, HWC, Float16, Bilinear, 5, 4, 1.f) \
+  TEST_RGBTENSOR1(CHW_Int8, fmt, nv12, CHW, Int8, Bilinear, 5, 4, 1.f)       \
+  TEST_RGBTENSOR1(HWC_Int8, fmt, nv12, HWC, Int8, None, 3, 4, 1.f)           \
+  TEST_RGBTENSOR1(CHW_Float32_None, fmt, nv12, CHW, Float32, None, 3, 4, 0.01f)
+
+TEST_RGBTENSOR(I420, false)
+TEST_RGBTENSOR(NV12, true)
+
+TEST_F(LibYUVScaleTest, RGBTensorInvalid) {
+  uint8_t y[16 * 4];
+  uint8_t u[8 * 2];
+  uint8_t v[8 * 2];
+  float dst[4 * 4 * 3];
+  const float kScale[3] = {1.f, 1.f, 1.f};
+  const float kBias[3] = {0.f, 0.f, 0.f};
+  memset(y, 128, sizeof(y));
+  memset(u, 128, sizeof(u));
+  memset(v, 128, sizeof(v));
+  // Crop outside the source.
+  EXPECT_EQ(-1, I420ToRGBTensor(y, 16, u, 8, v, 8, &kYuvI601Constants, 16, 4,
+                                1, 0, 16, 4, dst, 4, 4, kScale, kBias,
+                                kTensorCHW, kTensorFloat32, kFilterBilinear));
+  EXPECT_EQ(-1, NV12ToRGBTensor(y, 16, u, 16, &kYuvI601Constants, 16, 4, 0, 2,
+                                16, 3, dst, 4, 4, kScale, kBias, kTensorHWC,
+                                kTensorFloat32, kFilterBilinear));
+  EXPECT_EQ(-1, I420ToRGBTensor(y, 16, u, 8, v, 8, &kYuvI601Constants, 16, 4,
+                                0, 0, 16, 4, dst, 4, 4, NULL, kBias,
+                                kTensorCHW, kTensorFloat32, kFilterBilinear));
+  // Grey is 128 in every channel.
+  EXPECT_EQ(0, I420ToRGBTensor(y, 16, u, 8, v, 8, &kYuvI601Constants, 16, 4, 0,
+                               0, 16, 4, dst, 4, 4, kScale, kBias, kTensorCHW,
+                               kTensorFloat32, kFilterBox));
+  for (int i = 0; i < 4 * 4 * 3; ++i) {
+    EXPECT_NEAR(dst[i], 130.f, 2.f);
+  }
+}
+
+// Runs tasks last to first, as a stand in for a thread pool, and counts
+// calls in executor_context.
+static void ReverseParallelFor(void* executor_context,
+                               void (*task)(void* task_context, int index),
+                               void* task_context,
+                               int count) {
+  ++*static_cast<int*>(executor_context);
+  for (int i = count - 1; i >= 0; --i) {
+    task(task_context, i);
+  }
+}
+
+static const int kNumCropRegions = 4;
+
+// Crops of a frame of any size: the whole frame, the middle half, one at an
+// odd x and one near the bottom right.  Even is true to start crops on even
+// coordinates.
+static void SetCropRegions(int width,
+                           int height,
+                           bool even,
+                           CropScaleRegion* regions) {
+  const int kDstWidths[kNumCropRegions] = {(width * 2 + 2) / 3, 37, 64, 5};
+  const int kDstHeights[kNumCropRegions] = {(height * 2 + 2) / 3, 21, 64, 3};
+  memset(regions, 0, sizeof(CropScaleRegion) * kNumCropRegions);
+  regions[0].crop_width = width;
+  regions[0].crop_height = height;
+  regions[1].crop_x = (width / 4) & ~1;
+  regions[1].crop_y = (height / 4) & ~1;
+  regions[1].crop_width = (width + 1) / 2;
+  regions[1].crop_height = (height + 1) / 2;
+  regions[2].crop_x = (width > 2 && !even) ? 1 : 0;
+  regions[2].crop_width = width - regions[2].crop_x;
+  regions[2].crop_height = height;
+  regions[3].crop_x = (width / 2) & ~1;
+  regions[3].crop_y = (height / 2) & ~1;
+  regions[3].crop_width = width - regions[3].crop_x;
+  regions[3].crop_height = height - regions[3].crop_y;
+  for (int i = 0; i < kNumCropRegions; ++i) {
+    regions[i].dst_width = kDstWidths[i];
+    regions[i].dst_height = kDstHeights[i];
+  }
+}
+
+// Scale a batch of crops of I420 to ARGB, serially and with an executor,
+// and compare each with I420ToARGB and ARGBScale of the crop.
+static int YUVCropScaleBatchARGBTest(int src_width,
+                                     int src_height,
+                                     FilterMode f,
+                                     int benchmark_iterations) {
+  const int src_stride_uv = (src_width + 1) / 2;
+  const int src_height_uv = (src_height + 1) / 2;
+  CropScaleRegion regions[kNumCropRegions];
+  CropScaleRegion serial_regions[kNumCropRegions];
+  uint8_t* ref[kNumCropRegions];
+  SetCropRegions(src_width, src_height, false, regions);
+
+  align_buffer_page_end(src_y, src_width * src_height);
+  align_buffer_page_end(src_u, src_stride_uv * src_height_uv);
+  align_buffer_page_end(src_v, src_stride_uv * src_height_uv);
+  align_buffer_page_end(src_argb, src_width * src_height * 4);
+  MemRandomize(src_y, src_width * src_height);
+  MemRandomize(src_u, src_stride_uv * src_height_uv);
+  MemRandomize(src_v, src_stride_uv * src_height_uv);
+  for (int i = 0; i < kNumCropRegions; ++i) {
+    const int size = regions[i].dst_width * regions[i].dst_height * 4;
+    regions[i].dst[0] = new uint8_t[size];
+    regions[i].dst_stride[0] = regions[i].dst_width * 4;
+    serial_regions[i] = regions[i];
+    serial_regions[i].dst[0] = new uint8_t[size];
+    ref[i] = new uint8_t[size];
+    memset(regions[i].dst[0], 1, size);
+    memset(serial_regions[i].dst[0], 2, size);
+  }
+
+  int calls = 0;
+  EXPECT_EQ(0, YUVCropScaleBatch(src_y, src_width, src_u, src_stride_uv, src_v,
+                                 src_stride_uv, FOURCC_I420, &kYuvI601Constants,
+                                 src_width, src_height, serial_regions,
+                                 kNumCropRegions, FOURCC_ARGB, f, NULL, NULL));
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    EXPECT_EQ(0, YUVCropScaleBatch(
+                     src_y, src_width, src_u, src_stride_uv, src_v,
+                     src_stride_uv, FOURCC_I420, &kYuvI601Constants, src_width,
+                     src_height, regions, kNumCropRegions, FOURCC_ARGB, f,
+                     ReverseParallelFor, &calls));
+  }
+  EXPECT_EQ(benchmark_iterations, calls);
+
+  I420ToARGB(src_y, src_width, src_u, src_stride_uv, src_v, src_stride_uv,
+             src_argb, src_width * 4, src_width, src_height);
+  int max_diff = 0;
+  for (int i = 0; i < kNumCropRegions; ++i) {
+    const CropScaleRegion& r = regions[i];
+    const int size = r.dst_width * r.dst_height * 4;
+    ARGBScale(src_argb + r.crop_y * src_width * 4 + r.crop_x * 4,
+              src_width * 4, r.crop_width, r.crop_height, ref[i],
+              r.dst_width * 4, r.dst_width, r.dst_height, f);
+    for (int j = 0; j < size; ++j) {
+      EXPECT_EQ(r.dst[0][j], serial_regions[i].dst[0][j]);
+      int diff = abs(r.dst[0][j] - ref[i][j]);
+      max_diff = diff > max_diff ? diff : max_diff;
+    }
+    delete[] r.dst[0];
+    delete[] serial_regions[i].dst[0];
+    delete[] ref[i];
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(src_argb);
+  return max_diff;
+}
+
+TEST_F(LibYUVScaleTest, YUVCropScaleBatchARGB_None) {
+  int diff = YUVCropScaleBatchARGBTest(benchmark_width_, benchmark_height_,
+                                       kFilterNone, benchmark_iterations_);
+  EXPECT_EQ(0, diff);
+}
+
+TEST_F(LibYUVScaleTest, YUVCropScaleBatchARGB_Bilinear) {
+  int diff = YUVCropScaleBatchARGBTest(benchmark_width_, benchmark_height_,
+                                       kFilterBilinear, benchmark_iterations_);
+  EXPECT_LE(diff, 3);
+}
+
+// Scale a batch of crops of NV12 to I420 and compare each with I420Scale of
+// the crop.
+static int YUVCropScaleBatchI420Test(int src_width,
+                                     int src_height,
+                                     FilterMode f,
+                                     int benchmark_iterations) {
+  const int src_stride_uv = (src_width + 1) / 2;
+  const int src_height_uv = (src_height + 1) / 2;
+  CropScaleRegion regions[kNumCropRegions];
+  SetCropRegions(src_width, src_height, true, regions);
+
+  align_buffer_page_end(src_y, src_width * src_height);
+  align_buffer_page_end(src_u, src_stride_uv * src_height_uv);
+  align_buffer_page_end(src_v, src_stride_uv * src_height_uv);
+  align_buffer_page_end(src_uv, src_stride_uv * 2 * src_height_uv);
+  MemRandomize(src_y, src_width * src_height);
+  MemRandomize(src_u, src_stride_uv * src_height_uv);
+  MemRandomize(src_v, src_stride_uv * src_height_uv);
+  MergeUVPlane(src_u, src_stride_uv, src_v, src_stride_uv, src_uv,
+               src_stride_uv * 2, src_stride_uv, src_height_uv);
+  for (int i = 0; i < kNumCropRegions; ++i) {
+    const int dst_width_uv = (regions[i].dst_width + 1) / 2;
+    const int dst_height_uv = (regions[i].dst_height + 1) / 2;
+    regions[i].dst[0] = new uint8_t[regions[i].dst_width *
+                                    regions[i].dst_height];
+    regions[i].dst[1] = new uint8_t[dst_width_uv * dst_height_uv];
+    regions[i].dst[2] = new uint8_t[dst_width_uv * dst_height_uv];
+    regions[i].dst_stride[0] = regions[i].dst_width;
+    regions[i].dst_stride[1] = dst_width_uv;
+    regions[i].dst_stride[2] = dst_width_uv;
+  }
+
+  int calls = 0;
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    EXPECT_EQ(0, YUVCropScaleBatch(src_y, src_width, src_uv, src_stride_uv * 2,
+                                   NULL, 0, FOURCC_NV12, &kYuvI601Constants,
+                                   src_width, src_height, regions,
+                                   kNumCropRegions, FOURCC_I420, f,
+                                   ReverseParallelFor, &calls));
+  }
+
+  int max_diff = 0;
+  for (int i = 0; i < kNumCropRegions; ++i) {
+    const CropScaleRegion& r = regions[i];
+    const int dst_width_uv = (r.dst_width + 1) / 2;
+    const int dst_height_uv = (r.dst_height + 1) / 2;
+    const int size_y = r.dst_width * r.dst_height;
+    const int size_uv = dst_width_uv * dst_height_uv;
+    align_buffer_page_end(ref, size_y + size_uv * 2);
+    I420Scale(src_y + r.crop_y * src_width + r.crop_x, src_width,
+              src_u + (r.crop_y / 2) * src_stride_uv + r.crop_x / 2,
+              src_stride_uv,
+              src_v + (r.crop_y / 2) * src_stride_uv + r.crop_x / 2,
+              src_stride_uv, r.crop_width, r.crop_height, ref, r.dst_width,
+              ref + size_y, dst_width_uv, ref + size_y + size_uv,
+              dst_width_uv, r.dst_width, r.dst_height, f);
+    for (int p = 0; p < 3; ++p) {
+      const uint8_t* expected = ref + (p ? size_y + (p - 1) * size_uv : 0);
+      for (int j = 0; j < (p ? size_uv : size_y); ++j) {
+        int diff = abs(r.dst[p][j] - expected[j]);
+        max_diff = diff > max_diff ? diff : max_diff;
+      }
+      delete[] r.dst[p];
+    }
+    free_aligned_buffer_page_end(ref);
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(src_uv);
+  return max_diff;
+}
+
+TEST_F(LibYUVScaleTest, YUVCropScaleBatchI420_None) {
+  int diff = YUVCropScaleBatchI420Test(benchmark_width_, benchmark_height_,
+                                       kFilterNone, benchmark_iterations_);
+  EXPECT_EQ(0, diff);
+}
+
+TEST_F(LibYUVScaleTest, YUVCropScaleBatchI420_Bilinear) {
+  int diff = YUVCropScaleBatchI420Test(benchmark_width_, benchmark_height_,
+                                       kFilterBilinear, benchmark_iterations_);
+  EXPECT_LE(diff, 3);
+}
+
+// A batch of tensors matches converting each crop on its own.
+TEST_F(LibYUVScaleTest, YUVCropScaleBatchToRGBTensor) {
+  const int kWidth = benchmark_width_;
+  const int kHeight = benchmark_height_;
+  const int src_stride_uv = (kWidth + 1) / 2;
+  const int src_height_uv = (kHeight + 1) / 2;
+  const float kScale[3] = {1.f / 255.f, 1.f / 255.f, 1.f / 255.f};
+  const float kBias[3] = {-0.5f, -0.5f, -0.5f};
+  CropScaleRegion regions[kNumCropRegions];
+  SetCropRegions(kWidth, kHeight, false, regions);
+
+  align_buffer_page_end(src_y, kWidth * kHeight);
+  align_buffer_page_end(src_uv, src_stride_uv * 2 * src_height_uv);
+  MemRandomize(src_y, kWidth * kHeight);
+  MemRandomize(src_uv, src_stride_uv * 2 * src_height_uv);
+  for (int i = 0; i < kNumCropRegions; ++i) {
+    regions[i].dst[0] =
+        new uint8_t[regions[i].dst_width * regions[i].dst_height * 3 * 2];
+  }
+
+  int calls = 0;
+  EXPECT_EQ(0, YUVCropScaleBatchToRGBTensor(
+                   src_y, kWidth, src_uv, src_stride_uv * 2, NULL, 0,
+                   FOURCC_NV12, &kYuvI601Constants, kWidth, kHeight, regions,
+                   kNumCropRegions, kScale, kBias, kTensorCHW, kTensorFloat16,
+                   kFilterBilinear, ReverseParallelFor, &calls));
+  EXPECT_EQ(1, calls);
+  for (int i = 0; i < kNumCropRegions; ++i) {
+    const CropScaleRegion& r = regions[i];
+    const int size = r.dst_width * r.dst_height * 3 * 2;
+    align_buffer_page_end(ref, size);
+    EXPECT_EQ(0, NV12ToRGBTensor(src_y, kWidth, src_uv, src_stride_uv * 2,
+                                 &kYuvI601Constants, kWidth, kHeight, r.crop_x,
+                                 r.crop_y, r.crop_width, r.crop_height, ref,
+                                 r.dst_width, r.dst_height, kScale, kBias,
+                                 kTensorCHW, kTensorFloat16, kFilterBilinear));
+    EXPECT_EQ(0, memcmp(ref, r.dst[0], size));
+    free_aligned_buffer_page_end(ref);
+    delete[] r.dst[0];
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_uv);
+}
+
+TEST_F(LibYUVScaleTest, YUVCropScaleBatchInvalid) {
+  uint8_t y[16 * 4];
+  uint8_t u[16 * 2];
+  uint8_t v[16 * 2];
+  uint8_t dst[4 * 4 * 4];
+  CropScaleRegion regions[2];
+  memset(y, 128, sizeof(y));
+  memset(u, 128, sizeof(u));
+  memset(v, 128, sizeof(v));
+  memset(regions, 0, sizeof(regions));
+  for (int i = 0; i < 2; ++i) {
+    regions[i].crop_width = 16;
+    regions[i].crop_height = 4;
+    regions[i].dst[0] = dst;
+    regions[i].dst_stride[0] = 16;
+    regions[i].dst_width = 4;
+    regions[i].dst_height = 4;
+  }
+  memset(dst, 0, sizeof(dst));
+  // The second region is outside the source, so nothing is written.
+  regions[1].crop_y = 1;
+  EXPECT_EQ(-1, YUVCropScaleBatch(y, 16, u, 8, v, 8, FOURCC_I420,
+                                  &kYuvI601Constants, 16, 4, regions, 2,
+                                  FOURCC_ARGB, kFilterBilinear, NULL, NULL));
+  EXPECT_EQ(0, dst[0]);
+  regions[1].crop_y = 0;
+  // Unsupported formats and missing planes.
+  EXPECT_EQ(-1, YUVCropScaleBatch(y, 16, u, 8, v, 8, FOURCC_YUY2,
+                                  &kYuvI601Constants, 16, 4, regions, 2,
+                                  FOURCC_ARGB, kFilterBilinear, NULL, NULL));
+  EXPECT_EQ(-1, YUVCropScaleBatch(y, 16, u, 8, v, 8, FOURCC_I420,
+                                  &kYuvI601Constants, 16, 4, regions, 2,
+                                  FOURCC_RGBA, kFilterBilinear, NULL, NULL));
+  EXPECT_EQ(-1, YUVCropScaleBatch(y, 16, u, 8, NULL, 8, FOURCC_I420,
+                                  &kYuvI601Constants, 16, 4, regions, 2,
+                                  FOURCC_ARGB, kFilterBilinear, NULL, NULL));
+  EXPECT_EQ(-1, YUVCropScaleBatch(y, 16, u, 8, v, 8, FOURCC_I420,
+                                  &kYuvI601Constants, 16, 4, regions, 2,
+                                  FOURCC_I420, kFilterBilinear, NULL, NULL));
+  EXPECT_EQ(-1, YUVCropScaleBatch(y, 16, u, 8, v, 8, FOURCC_I420,
+                                  &kYuvI601Constants, 16, 4, regions, 0,
+                                  FOURCC_ARGB, kFilterBilinear, NULL, NULL));
+  EXPECT_EQ(0, YUVCropScaleBatch(y, 16, u, 16, NULL, 0, FOURCC_NV12,
+                                 &kYuvI601Constants, 16, -4, regions, 2,
+                                 FOURCC_ARGB, kFilterBox, NULL, NULL));
+  EXPECT_NEAR(dst[0], 130, 2);
+}
+
 }  // namespace libyuv
@@ -12,7 +12,9 @@
 #include <time.h>
 
 #include "../unit_test/unit_test.h"
+#include "libyuv/convert_from.h"
 #include "libyuv/cpu_id.h"
+#include "libyuv/planar_functions.h"
 #include "libyuv/scale.h"
 
 #ifdef ENABLE_ROW_TESTS
@@ -1556,4 +1558,342 @@ TEST_F(LibYUVScaleTest, PlaneTest1_16_Box) {
   free_aligned_buffer_page_end(dst_pixels_alloc);
   free_aligned_buffer_page_end(orig_pixels_alloc);
 }
+
+TEST_F(LibYUVScaleTest, I420AScale_Attenuate) {
+  const int kSrcWidth = 64;
+  const int kSrcHeight = 48;
+  const int kDstWidth = 33;
+  const int kDstHeight = 17;
+  const int kSrcHalfWidth = kSrcWidth / 2;
+  const int kSrcHalfHeight = kSrcHeight / 2;
+  const int kDstHalfWidth = (kDstWidth + 1) / 2;
+  const int kDstHalfHeight = (kDstHeight + 1) / 2;
+  align_buffer_page_end(src_y, kSrcWidth * kSrcHeight);
+  align_buffer_page_end(src_u, kSrcHalfWidth * kSrcHalfHeight);
+  align_buffer_page_end(src_v, kSrcHalfWidth * kSrcHalfHeight);
+  align_buffer_page_end(src_a, kSrcWidth * kSrcHeight);
+  align_buffer_page_end(dst_y, kDstWidth * kDstHeight);
+  align_buffer_page_end(dst_u, kDstHalfWidth * kDstHalfHeight);
+  align_buffer_page_end(dst_v, kDstHalfWidth * kDstHalfHeight);
+  align_buffer_page_end(dst_a, kDstWidth * kDstHeight);
+  align_buffer_page_end(ref_y, kDstWidth * kDstHeight);
+  align_buffer_page_end(ref_u, kDstHalfWidth * kDstHalfHeight);
+  align_buffer_page_end(ref_v, kDstHalfWidth * kDstHalfHeight);
+  align_buffer_page_end(ref_a, kDstWidth * kDstHeight);
+  MemRandomize(src_y, kSrcWidth * kSrcHeight);
+  MemRandomize(src_u, kSrcHalfWidth * kSrcHalfHeight);
+  MemRandomize(src_v, kSrcHalfWidth * kSrcHalfHeight);
+
+  // Opaque alpha: attenuate is a no-op and alpha stays 255.
+  memset(src_a, 255, kSrcWidth * kSrcHeight);
+  EXPECT_EQ(0, I420AScale(src_y, kSrcWidth, src_u, kSrcHalfWidth, src_v,
+                          kSrcHalfWidth, src_a, kSrcWidth, kSrcWidth,
+                          kSrcHeight, dst_y, kDstWidth, dst_u, kDstHalfWidth,
+                          dst_v, kDstHalfWidth, dst_a, kDstWidth, kDstWidth,
+                          kDstHeight, kFilterBox, 1));
+  EXPECT_EQ(0, I420Scale(src_y, kSrcWidth, src_u, kSrcHalfWidth, src_v,
+                         kSrcHalfWidth, kSrcWidth, kSrcHeight, ref_y,
+                         kDstWidth, ref_u, kDstHalfWidth, ref_v, kDstHalfWidth,
+                         kDstWidth, kDstHeight, kFilterBox));
+  for (int i = 0; i < kDstWidth * kDstHeight; ++i) {
+    EXPECT_EQ(ref_y[i], dst_y[i]);
+    EXPECT_EQ(255, dst_a[i]);
+  }
+  for (int i = 0; i < kDstHalfWidth * kDstHalfHeight; ++i) {
+    EXPECT_EQ(ref_u[i], dst_u[i]);
+    EXPECT_EQ(ref_v[i], dst_v[i]);
+  }
+
+  // Transparent alpha: attenuate produces black.
+  memset(src_a, 0, kSrcWidth * kSrcHeight);
+  EXPECT_EQ(0, I420AScale(src_y, kSrcWidth, src_u, kSrcHalfWidth, src_v,
+                          kSrcHalfWidth, src_a, kSrcWidth, kSrcWidth,
+                          kSrcHeight, dst_y, kDstWidth, dst_u, kDstHalfWidth,
+                          dst_v, kDstHalfWidth, dst_a, kDstWidth, kDstWidth,
+                          kDstHeight, kFilterBilinear, 1));
+  for (int i = 0; i < kDstWidth * kDstHeight; ++i) {
+    EXPECT_EQ(0, dst_y[i]);
+    EXPECT_EQ(0, dst_a[i]);
+  }
+  for (int i = 0; i < kDstHalfWidth * kDstHalfHeight; ++i) {
+    EXPECT_EQ(128, dst_u[i]);
+    EXPECT_EQ(128, dst_v[i]);
+  }
+
+  // Without attenuate, alpha is scaled exactly like a Y plane.
+  MemRandomize(src_a, kSrcWidth * kSrcHeight);
+  EXPECT_EQ(0, I420AScale(src_y, kSrcWidth, src_u, kSrcHalfWidth, src_v,
+                          kSrcHalfWidth, src_a, kSrcWidth, kSrcWidth,
+                          kSrcHeight, dst_y, kDstWidth, dst_u, kDstHalfWidth,
+                          dst_v, kDstHalfWidth, dst_a, kDstWidth, kDstWidth,
+                          kDstHeight, kFilterBilinear, 0));
+  ScalePlane(src_a, kSrcWidth, kSrcWidth, kSrcHeight, ref_a, kDstWidth,
+             kDstWidth, kDstHeight, kFilterBilinear);
+  for (int i = 0; i < kDstWidth * kDstHeight; ++i) {
+    EXPECT_EQ(ref_a[i], dst_a[i]);
+  }
+
+  free_aligned_buffer_page_end(src_y);
+  free_aligned_buffer_page_end(src_u);
+  free_aligned_buffer_page_end(src_v);
+  free_aligned_buffer_page_end(src_a);
+  free_aligned_buffer_page_end(dst_y);
+  free_aligned_buffer_page_end(dst_u);
+  free_aligned_buffer_page_end(dst_v);
+  free_aligned_buffer_page_end(dst_a);
+  free_aligned_buffer_page_end(ref_y);
+  free_aligned_buffer_page_end(ref_u);
+  free_aligned_buffer_page_end(ref_v);
+  free_aligned_buffer_page_end(ref_a);
+}
+
+TEST_F(LibYUVScaleTest, I444AScale_Attenuate) {
+  const int kSrcWidth = 40;
+  const int kSrcHeight = 30;
+  const int kDstWidth = 20;
+  const int kDstHeight = 15;
+  const int kDstSize = kDstWidth * kDstHeight;
+  align_buffer_page_end(src, kSrcWidth * kSrcHeight * 4);
+  align_buffer_page_end(dst, kDstSize * 4);
+  align_buffer_page_end(ref, kDstSize * 4);
+  uint8_t* src_y = src;
+  uint8_t* src_u = src + kSrcWidth * kSrcHeight;
+  uint8_t* src_v = src + kSrcWidth * kSrcHeight * 2;
+  uint8_t* src_a = src + kSrcWidth * kSrcHeight * 3;
+  MemRandomize(src, kSrcWidth * kSrcHeight * 4);
+
+  EXPECT_EQ(0, I444AScale(src_y, kSrcWidth, src_u, kSrcWidth, src_v, kSrcWidth,
+                          src_a, kSrcWidth, kSrcWidth, kSrcHeight, dst,
+                          kDstWidth, dst + kDstSize, kDstWidth,
+                          dst + kDstSize * 2, kDstWidth, dst + kDstSize * 3,
+                          kDstWidth, kDstWidth, kDstHeight, kFilterBox, 1));
+  EXPECT_EQ(0, I444Scale(src_y, kSrcWidth, src_u, kSrcWidth, src_v, kSrcWidth,
+                         kSrcWidth, kSrcHeight, ref, kDstWidth, ref + kDstSize,
+                         kDstWidth, ref + kDstSize * 2, kDstWidth, kDstWidth,
+                         kDstHeight, kFilterBox));
+  ScalePlane(src_a, kSrcWidth, kSrcWidth, kSrcHeight, ref + kDstSize * 3,
+             kDstWidth, kDstWidth, kDstHeight, kFilterBox);
+  for (int i = 0; i < kDstSize; ++i) {
+    int a = ref[kDstSize * 3 + i];
+    EXPECT_EQ(a, dst[kDstSize * 3 + i]);
+    EXPECT_EQ((ref[i] * a + 255) >> 8, dst[i]);
+    EXPECT_EQ((ref[kDstSize + i] * a + 128 * (255 - a) + 255) >> 8,
+              dst[kDstSize + i]);
+    EXPECT_EQ((ref[kDstSize * 2 + i] * a + 128 * (255 - a) + 255) >> 8,
+              dst[kDstSize * 2 + i]);
+  }
+
+  free_aligned_buffer_page_end(src);
+  free_aligned_buffer_page_end(dst);
+  free_aligned_buffer_page_end(ref);
+}
+
+TEST_F(LibYUVScaleTest, ScalePlaneLinearLight) {
+  const int kSrcWidth = 64;
+  const int kSrcHeight = 32;
+  align_buffer_page_end(src, kSrcWidth * kSrcHeight);
+  align_buffer_page_end(dst, kSrcWidth * 2 * kSrcHeight * 2);
+
+  // Constant images are unchanged by every filter and scale.
+  for (int v = 0; v < 256; v += 17) {
+    memset(src, v, kSrcWidth * kSrcHeight);
+    for (int f = kFilterLinear; f <= kFilterBox; ++f) {
+      ScalePlaneLinearLight(src, kSrcWidth, kSrcWidth, kSrcHeight, dst, 31, 31,
+                            13, static_cast<FilterMode>(f));
+      for (int i = 0; i < 31 * 13; ++i) {
+        EXPECT_EQ(v, dst[i]);
+      }
+      ScalePlaneLinearLight(src, kSrcWidth, kSrcWidth, kSrcHeight, dst,
+                            kSrcWidth * 2, kSrcWidth * 2, kSrcHeight * 2 - 1,
+                            static_cast<FilterMode>(f));
+      for (int i = 0; i < kSrcWidth * 2 * (kSrcHeight * 2 - 1); ++i) {
+        EXPECT_EQ(v, dst[i]);
+      }
+    }
+  }
+
+  // A black and white checkerboard averages to half intensity, which is 188
+  // in sRGB instead of 128.
+  for (int y = 0; y < kSrcHeight; ++y) {
+    for (int x = 0; x < kSrcWidth; ++x) {
+      src[y * kSrcWidth + x] = ((x ^ y) & 1) ? 255 : 0;
+    }
+  }
+  ScalePlaneLinearLight(src, kSrcWidth, kSrcWidth, kSrcHeight, dst,
+                        kSrcWidth / 2, kSrcWidth / 2, kSrcHeight / 2,
+                        kFilterBox);
+  for (int i = 0; i < kSrcWidth / 2 * kSrcHeight / 2; ++i) {
+    EXPECT_EQ(188, dst[i]);
+  }
+  ScalePlaneLinearLight(src, kSrcWidth, kSrcWidth, kSrcHeight, dst,
+                        kSrcWidth / 4, kSrcWidth / 4, kSrcHeight / 3,
+                        kFilterBox);
+  for (int i = 0; i < kSrcWidth / 4 * kSrcHeight / 3; ++i) {
+    EXPECT_NEAR(188, dst[i], 2);
+  }
+
+  free_aligned_buffer_page_end(dst);
+  free_aligned_buffer_page_end(src);
+}
+
+TEST_F(LibYUVScaleTest, ScalePlaneLinearLight_Benchmark) {
+  const int kSrcWidth = benchmark_width_ * 2;
+  const int kSrcHeight = benchmark_height_ * 2;
+  align_buffer_page_end(src, kSrcWidth * kSrcHeight);
+  align_buffer_page_end(dst, benchmark_width_ * benchmark_height_);
+  MemRandomize(src, kSrcWidth * kSrcHeight);
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    ScalePlaneLinearLight(src, kSrcWidth, kSrcWidth, kSrcHeight, dst,
+                          benchmark_width_, benchmark_width_,
+                          benchmark_height_, kFilterBox);
+  }
+  free_aligned_buffer_page_end(dst);
+  free_aligned_buffer_page_end(src);
+}
+
+// Test YUY2Scale or UYVYScale C vs Opt, and against unpacking to I422,
+// I422Scale and packing.  Returns the maximum difference from I422Scale.
+static int Packed422TestFilter(int src_width,
+                               int src_height,
+                               int dst_width,
+                               int dst_height,
+                               FilterMode f,
+                               bool uyvy,
+                               int benchmark_iterations,
+                               int disable_cpu_flags,
+                               int benchmark_cpu_info) {
+  if (!SizeValid(src_width, src_height, dst_width, dst_height) ||
+      dst_width <= 0 || dst_height <= 0) {
+    return 0;
+  }
+  const int src_halfwidth = (src_width + 1) / 2;
+  const int dst_halfwidth = (dst_width + 1) / 2;
+  const int src_stride = src_halfwidth * 4;
+  const int dst_stride = dst_halfwidth * 4;
+  int (*PackedScale)(const uint8_t*, int, int, int, uint8_t*, int, int, int,
+                     FilterMode) = uyvy ? UYVYScale : YUY2Scale;
+  align_buffer_page_end(src_packed, src_stride * src_height);
+  align_buffer_page_end(dst_packed_c, dst_stride * dst_height);
+  align_buffer_page_end(dst_packed_opt, dst_stride * dst_height);
+  align_buffer_page_end(dst_packed_ref, dst_stride * dst_height);
+  align_buffer_page_end(src_i422,
+                        (src_width + src_halfwidth * 2) * src_height);
+  align_buffer_page_end(dst_i422,
+                        (dst_width + dst_halfwidth * 2) * dst_height);
+  MemRandomize(src_packed, src_stride * src_height);
+  memset(dst_packed_c, 1, dst_stride * dst_height);
+  memset(dst_packed_opt, 2, dst_stride * dst_height);
+  memset(dst_packed_ref, 3, dst_stride * dst_height);
+
+  uint8_t* src_y = src_i422;
+  uint8_t* src_u = src_y + src_width * src_height;
+  uint8_t* src_v = src_u + src_halfwidth * src_height;
+  uint8_t* dst_y = dst_i422;
+  uint8_t* dst_u = dst_y + dst_width * dst_height;
+  uint8_t* dst_v = dst_u + dst_halfwidth * dst_height;
+  if (uyvy) {
+    UYVYToI422(src_packed, src_stride, src_y, src_width, src_u, src_halfwidth,
+               src_v, src_halfwidth, src_width, src_height);
+  } else {
+    YUY2ToI422(src_packed, src_stride, src_y, src_width, src_u, src_halfwidth,
+               src_v, src_halfwidth, src_width, src_height);
+  }
+  I422Scale(src_y, src_width, src_u, src_halfwidth, src_v, src_halfwidth,
+            src_width, src_height, dst_y, dst_width, dst_u, dst_halfwidth,
+            dst_v, dst_halfwidth, dst_width, dst_height, f);
+  if (uyvy) {
+    I422ToUYVY(dst_y, dst_width, dst_u, dst_halfwidth, dst_v, dst_halfwidth,
+               dst_packed_ref, dst_stride, dst_width, dst_height);
+  } else {
+    I422ToYUY2(dst_y, dst_width, dst_u, dst_halfwidth, dst_v, dst_halfwidth,
+               dst_packed_ref, dst_stride, dst_width, dst_height);
+  }
+
+  MaskCpuFlags(disable_cpu_flags);  // Disable all CPU optimization.
+  EXPECT_EQ(0, PackedScale(src_packed, src_stride, src_width, src_height,
+                           dst_packed_c, dst_stride, dst_width, dst_height, f));
+  MaskCpuFlags(benchmark_cpu_info);  // Enable all CPU optimization.
+  for (int i = 0; i < benchmark_iterations; ++i) {
+    EXPECT_EQ(0, PackedScale(src_packed, src_stride, src_width, src_height,
+                             dst_packed_opt, dst_stride, dst_width, dst_height,
+                             f));
+  }
+
+  // ScalePlaneDown2 point samples even rows for kFilterLinear and the 2x
+  // upsamplers use a 3:1 kernel, while other scalers, including the packed
+  // one, use the generic slope.  I422Scale may also reduce the filter for
+  // chroma only, where the packed scaler uses the luma filter for all
+  // channels.
+  const bool compare_ref =
+      src_halfwidth > 1 && (dst_halfwidth + 1) / 2 != src_halfwidth &&
+      !(f == kFilterLinear && dst_height * 2 == src_height) &&
+      !(f == kFilterBox &&
+        (dst_halfwidth * 2 >= src_halfwidth) != (dst_width * 2 >= src_width));
+  int max_diff = 0;
+  for (int i = 0; i < dst_height; ++i) {
+    for (int j = 0; j < dst_width * 2; ++j) {
+      int k = i * dst_stride + j;
+      EXPECT_EQ(dst_packed_c[k], dst_packed_opt[k]);
+      if (!compare_ref) {
+        continue;
+      }
+      int abs_diff = abs(dst_packed_opt[k] - dst_packed_ref[k]);
+      if (abs_diff > max_diff) {
+        max_diff = abs_diff;
+      }
+    }
+  }
+  free_aligned_buffer_page_end(src_packed);
+  free_aligned_buffer_page_end(dst_packed_c);
+  free_aligned_buffer_page_end(dst_packed_opt);
+  free_aligned_buffer_page_end(dst_packed_ref);
+  free_aligned_buffer_page_end(src_i422);
+  free_aligned_buffer_page_end(dst_i422);
+  return max_diff;
+}
+
+#define TEST_PACKED422SCALE(name, nom, denom, max_diff)                       \
+  TEST_F(LibYUVScaleTest, YUY2Scale##name) {                                  \
+    for (int f = kFilterNone; f <= kFilterBox; ++f) {                         \
+      int diff = Packed422TestFilter(                                         \
+          benchmark_width_, benchmark_height_,                                \
+          benchmark_width_ * nom / denom, benchmark_height_ * nom / denom,    \
+          static_cast<FilterMode>(f), false, benchmark_iterations_,           \
+          disable_cpu_flags_, benchmark_cpu_info_);                           \
+      EXPECT_LE(diff, max_diff);                                              \
+    }                                                                         \
+  }                                                                           \
+  TEST_F(LibYUVScaleTest, UYVYScale##name) {                                  \
+    for (int f = kFilterNone; f <= kFilterBox; ++f) {                         \
+      int diff = Packed422TestFilter(                                         \
+          benchmark_width_, benchmark_height_,                                \
+          benchmark_width_ * nom / denom, benchmark_height_ * nom / denom,    \
+          static_cast<FilterMode>(f), true, benchmark_iterations_,            \
+          disable_cpu_flags_, benchmark_cpu_info_);                           \
+      EXPECT_LE(diff, max_diff);                                              \
+    }                                                                         \
+  }
+
+TEST_PACKED422SCALE(Down2, 1, 2, 3)
+TEST_PACKED422SCALE(Down2by3, 2, 3, 3)
+TEST_PACKED422SCALE(Down5, 1, 5, 3)
+TEST_PACKED422SCALE(Up3by2, 3, 2, 3)
+#undef TEST_PACKED422SCALE
+
+TEST_F(LibYUVScaleTest, YUY2Scale1080iTo720p) {
+  const int kSrcWidth = 1920;
+  const int kSrcHeight = 1080;
+  const int kDstWidth = 1280;
+  const int kDstHeight = 720;
+  align_buffer_page_end(src_yuy2, kSrcWidth * 2 * kSrcHeight);
+  align_buffer_page_end(dst_yuy2, kDstWidth * 2 * kDstHeight);
+  MemRandomize(src_yuy2, kSrcWidth * 2 * kSrcHeight);
+  for (int i = 0; i < benchmark_iterations_; ++i) {
+    EXPECT_EQ(0, YUY2Scale(src_yuy2, kSrcWidth * 2, kSrcWidth, kSrcHeight,
+                           dst_yuy2, kDstWidth * 2, kDstWidth, kDstHeight,
+                           kFilterBilinear));
+  }
+  free_aligned_buffer_page_end(src_yuy2);
+  free_aligned_buffer_page_end(dst_yuy2);
+}
 }  // namespace libyuv
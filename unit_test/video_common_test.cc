@@ -88,6 +88,13 @@ TEST_F(LibYUVBaseTest, TestFourCC) {
   EXPECT_TRUE(TestValidFourCC(FOURCC_I210, FOURCC_BPP_I210));
   EXPECT_TRUE(TestValidFourCC(FOURCC_P010, FOURCC_BPP_P010));
   EXPECT_TRUE(TestValidFourCC(FOURCC_P210, FOURCC_BPP_P210));
+  EXPECT_TRUE(TestValidFourCC(FOURCC_V210, FOURCC_BPP_V210));
+  EXPECT_TRUE(TestValidFourCC(FOURCC_Y210, FOURCC_BPP_Y210));
+  EXPECT_TRUE(TestValidFourCC(FOURCC_Y410, FOURCC_BPP_Y410));
+  EXPECT_TRUE(TestValidFourCC(FOURCC_RGGB, FOURCC_BPP_RGGB));
+  EXPECT_TRUE(TestValidFourCC(FOURCC_BGGR, FOURCC_BPP_BGGR));
+  EXPECT_TRUE(TestValidFourCC(FOURCC_GRBG, FOURCC_BPP_GRBG));
+  EXPECT_TRUE(TestValidFourCC(FOURCC_GBRG, FOURCC_BPP_GBRG));
   EXPECT_TRUE(TestValidFourCC(FOURCC_MJPG, FOURCC_BPP_MJPG));
   EXPECT_TRUE(TestValidFourCC(FOURCC_YV12, FOURCC_BPP_YV12));
   EXPECT_TRUE(TestValidFourCC(FOURCC_YV16, FOURCC_BPP_YV16));